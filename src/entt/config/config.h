@@ -5,11 +5,13 @@
 
 #if defined(__cpp_exceptions) && !defined(ENTT_NOEXCEPTION)
 #    define ENTT_NOEXCEPT noexcept
+#    define ENTT_NOEXCEPT_IF(expr) noexcept(expr)
 #    define ENTT_THROW throw
 #    define ENTT_TRY try
 #    define ENTT_CATCH catch(...)
 #else
 #    define ENTT_NOEXCEPT
+#    define ENTT_NOEXCEPT_IF(...)
 #    define ENTT_THROW
 #    define ENTT_TRY if(true)
 #    define ENTT_CATCH if(false)
@@ -42,6 +44,54 @@
 #    define ENTT_PACKED_PAGE 1024
 #endif
 
+#ifndef ENTT_PACKED_PAGE_BYTES
+#    define ENTT_PACKED_PAGE_BYTES 0
+#endif
+
+#ifndef ENTT_HUGE_PAGE_ADVICE
+#    define ENTT_HUGE_PAGE_ADVICE(ptr, size) (void(0))
+#endif
+
+#ifndef ENTT_SPARSE_SET_STATISTICS
+#    define ENTT_SPARSE_SET_STATISTICS 0
+#endif
+
+#ifndef ENTT_VIEW_PREFETCH
+#    define ENTT_VIEW_PREFETCH 0
+#endif
+
+#ifndef ENTT_VIEW_STATISTICS
+#    define ENTT_VIEW_STATISTICS 0
+#endif
+
+#ifndef ENTT_ANY_SIZE
+#    define ENTT_ANY_SIZE sizeof(double[2])
+#endif
+
+#ifndef ENTT_META_ANY_SIZE
+#    define ENTT_META_ANY_SIZE ENTT_ANY_SIZE
+#endif
+
+#ifndef ENTT_POLY_INLINE_VTABLE
+#    define ENTT_POLY_INLINE_VTABLE 1
+#endif
+
+#ifndef ENTT_PROFILE_SCOPE
+#    define ENTT_PROFILE_SCOPE(...) (void(0))
+#endif
+
+#if defined __clang__ || defined __GNUC__
+#    define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#    define ENTT_PREFETCH(addr) (void(0))
+#endif
+
+#if !defined ENTT_NO_SSE2 && (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+#    define ENTT_SSE2 true
+#else
+#    define ENTT_SSE2 false
+#endif
+
 #ifdef ENTT_DISABLE_ASSERT
 #    undef ENTT_ASSERT
 #    define ENTT_ASSERT(...) (void(0))
@@ -0,0 +1,235 @@
+#ifndef ENTT_CONTAINER_CONCURRENT_DENSE_MAP_HPP
+#define ENTT_CONTAINER_CONCURRENT_DENSE_MAP_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/memory.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Read-mostly associative container for key-value pairs with unique
+ * keys.
+ *
+ * Readers never lock nor write to shared memory. They get an immutable version
+ * of the map with a single atomic load and look up elements in it.<br/>
+ * Writers are serialized. Each of them copies the current version, applies its
+ * changes to the copy and publishes it in place of the previous one. Bulk
+ * changes should go through `update`, so as to pay for the copy only once.
+ *
+ * Retired versions aren't released until `reclaim` is invoked. Therefore,
+ * references obtained from a version stay valid in the meantime.
+ *
+ * @warning
+ * No other thread must be reading from the map when `reclaim` is invoked (for
+ * example, it can be invoked at the end of every frame, when all workers are
+ * idle).
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam Hash Type of function to use to hash the keys.
+ * @tparam KeyEqual Type of function to use to compare the keys for equality.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, typename Hash, typename KeyEqual, typename Allocator>
+class concurrent_dense_map {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    /*! @brief Type of the immutable versions of the container. */
+    using map_type = dense_map<Key, Type, Hash, KeyEqual, Allocator>;
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+private:
+    using version_type = std::unique_ptr<map_type, allocation_deleter<typename alloc_traits::template rebind_alloc<map_type>>>;
+    using version_container_type = std::vector<version_type, typename alloc_traits::template rebind_alloc<version_type>>;
+
+    template<typename Func>
+    void publish(Func func) {
+        std::lock_guard lock{mutex};
+        auto next = allocate_unique<map_type>(allocator, *current.load(std::memory_order_relaxed), allocator);
+        func(*next);
+        const auto *ptr = next.get();
+        versions.push_back(std::move(next));
+        current.store(ptr, std::memory_order_release);
+    }
+
+public:
+    /*! @brief Default constructor. */
+    concurrent_dense_map()
+        : concurrent_dense_map{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param alloc The allocator to use.
+     */
+    explicit concurrent_dense_map(const allocator_type &alloc)
+        : allocator{alloc},
+          versions{alloc},
+          current{},
+          mutex{} {
+        versions.push_back(allocate_unique<map_type>(allocator, allocator));
+        current.store(versions.back().get(), std::memory_order_release);
+    }
+
+    /*! @brief Copying a concurrent map isn't allowed. */
+    concurrent_dense_map(const concurrent_dense_map &) = delete;
+
+    /*! @brief Default destructor. */
+    ~concurrent_dense_map() = default;
+
+    /**
+     * @brief Copying a concurrent map isn't allowed.
+     * @return This container.
+     */
+    concurrent_dense_map &operator=(const concurrent_dense_map &) = delete;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator;
+    }
+
+    /**
+     * @brief Returns the latest published version of the container.
+     *
+     * The returned version is immutable and stays valid until the next call to
+     * `reclaim`, even though other threads publish newer versions.
+     *
+     * @return The latest published version of the container.
+     */
+    [[nodiscard]] const map_type &snapshot() const ENTT_NOEXCEPT {
+        return *current.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        return snapshot().contains(key);
+    }
+
+    /**
+     * @brief Returns the element with a given key, if any.
+     * @param key Key value of an element to search for.
+     * @return A pointer to the element if it exists, a null pointer otherwise.
+     */
+    [[nodiscard]] const mapped_type *try_get(const key_type &key) const {
+        const auto &map = snapshot();
+        const auto it = map.find(key);
+        return it == map.cend() ? nullptr : &it->second;
+    }
+
+    /**
+     * @brief Returns the number of elements in the latest published version.
+     * @return Number of elements in the container.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return snapshot().size();
+    }
+
+    /**
+     * @brief Checks whether the latest published version is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return snapshot().empty();
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @tparam Arg Type of the key-value pair to insert into the container.
+     * @param value A key-value pair eventually convertible to the value type.
+     */
+    template<typename Arg>
+    void insert(Arg &&value) {
+        publish([&value](map_type &map) { map.insert(std::forward<Arg>(value)); });
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     */
+    template<typename Arg>
+    void insert_or_assign(const key_type &key, Arg &&value) {
+        publish([&key, &value](map_type &map) { map.insert_or_assign(key, std::forward<Arg>(value)); });
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     */
+    void erase(const key_type &key) {
+        publish([&key](map_type &map) { map.erase(key); });
+    }
+
+    /*! @brief Clears the container. */
+    void clear() {
+        publish([](map_type &map) { map.clear(); });
+    }
+
+    /**
+     * @brief Applies a set of changes to a copy of the latest version and
+     * publishes it.
+     *
+     * The function object is invoked with a reference to the new version:
+     *
+     * @code{.cpp}
+     * void(map_type &);
+     * @endcode
+     *
+     * Readers don't see any of the changes until the function returns.
+     *
+     * @tparam Func Type of function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void update(Func func) {
+        publish(std::move(func));
+    }
+
+    /**
+     * @brief Releases all retired versions of the container.
+     *
+     * @warning
+     * All references to the retired versions and their elements are
+     * invalidated. No other thread must be reading from the container.
+     */
+    void reclaim() {
+        std::lock_guard lock{mutex};
+        versions.erase(versions.begin(), versions.end() - 1u);
+    }
+
+private:
+    allocator_type allocator;
+    version_container_type versions;
+    std::atomic<const map_type *> current;
+    std::mutex mutex;
+};
+
+} // namespace entt
+
+#endif
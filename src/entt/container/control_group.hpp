@@ -0,0 +1,249 @@
+#ifndef ENTT_CONTAINER_CONTROL_GROUP_HPP
+#define ENTT_CONTAINER_CONTROL_GROUP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+
+#if ENTT_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+[[nodiscard]] inline std::size_t trailing_zeros(std::uint64_t value) ENTT_NOEXCEPT {
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+    std::size_t count{};
+    for(; !(value & 1u); value >>= 1u, ++count) {}
+    return count;
+#endif
+}
+
+struct control_group final {
+    using mask_type = std::uint64_t;
+
+    static constexpr std::uint8_t empty = 0x80;
+    static constexpr std::uint8_t deleted = 0xFE;
+
+#if ENTT_SSE2
+    static constexpr std::size_t width = 16u;
+
+    explicit control_group(const std::uint8_t *data) ENTT_NOEXCEPT
+        : value{_mm_loadu_si128(reinterpret_cast<const __m128i *>(data))} {}
+
+    [[nodiscard]] mask_type match(const std::uint8_t tag) const ENTT_NOEXCEPT {
+        return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), value)));
+    }
+
+    [[nodiscard]] mask_type match_empty() const ENTT_NOEXCEPT {
+        return match(empty);
+    }
+
+    [[nodiscard]] mask_type match_free() const ENTT_NOEXCEPT {
+        return static_cast<mask_type>(_mm_movemask_epi8(value));
+    }
+
+    [[nodiscard]] static std::size_t lowest(const mask_type mask) ENTT_NOEXCEPT {
+        return trailing_zeros(mask);
+    }
+
+private:
+    __m128i value;
+#else
+    static constexpr std::size_t width = 8u;
+
+    explicit control_group(const std::uint8_t *data) ENTT_NOEXCEPT
+        : value{} {
+        for(std::size_t pos{}; pos < width; ++pos) {
+            value |= static_cast<mask_type>(data[pos]) << (pos * 8u);
+        }
+    }
+
+    // false positives are possible but only for full slots, keys are compared anyway
+    [[nodiscard]] mask_type match(const std::uint8_t tag) const ENTT_NOEXCEPT {
+        const auto other = value ^ (lsb * tag);
+        return (other - lsb) & ~other & msb;
+    }
+
+    [[nodiscard]] mask_type match_empty() const ENTT_NOEXCEPT {
+        return value & (~value << 6u) & msb;
+    }
+
+    [[nodiscard]] mask_type match_free() const ENTT_NOEXCEPT {
+        return value & (~value << 7u) & msb;
+    }
+
+    [[nodiscard]] static std::size_t lowest(const mask_type mask) ENTT_NOEXCEPT {
+        return trailing_zeros(mask) >> 3u;
+    }
+
+private:
+    static constexpr mask_type lsb = 0x0101010101010101ull;
+    static constexpr mask_type msb = 0x8080808080808080ull;
+
+    mask_type value;
+#endif
+};
+
+template<typename Allocator>
+class flat_index final {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using control_container_type = std::vector<std::uint8_t, typename alloc_traits::template rebind_alloc<std::uint8_t>>;
+    using slot_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+    [[nodiscard]] static std::size_t mix(const std::size_t hash) ENTT_NOEXCEPT {
+        constexpr auto bits = std::numeric_limits<std::size_t>::digits;
+        const auto value = hash * static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+        return value ^ (value >> (bits / 2));
+    }
+
+    [[nodiscard]] std::size_t group_mask() const ENTT_NOEXCEPT {
+        return capacity() / control_group::width - 1u;
+    }
+
+public:
+    using size_type = std::size_t;
+
+    static constexpr auto placeholder = (std::numeric_limits<size_type>::max)();
+    static constexpr auto minimum_capacity = control_group::width;
+
+    explicit flat_index(const Allocator &allocator)
+        : control{allocator},
+          slots{allocator},
+          growth{} {}
+
+    flat_index(const flat_index &other, const Allocator &allocator)
+        : control{other.control, allocator},
+          slots{other.slots, allocator},
+          growth{other.growth} {}
+
+    flat_index(flat_index &&other, const Allocator &allocator)
+        : control{std::move(other.control), allocator},
+          slots{std::move(other.slots), allocator},
+          growth{other.growth} {}
+
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return control.size();
+    }
+
+    [[nodiscard]] size_type max_capacity() const ENTT_NOEXCEPT {
+        return control.max_size();
+    }
+
+    [[nodiscard]] size_type growth_left() const ENTT_NOEXCEPT {
+        return growth;
+    }
+
+    void reset(const size_type length, const size_type limit) {
+        ENTT_ASSERT(length >= minimum_capacity && (length & (length - 1u)) == 0u, "Invalid capacity");
+        control_container_type other_control(length, control_group::empty, control.get_allocator());
+        slot_container_type other_slots(length, placeholder, slots.get_allocator());
+        control.swap(other_control);
+        slots.swap(other_slots);
+        growth = limit;
+    }
+
+    template<typename Func>
+    [[nodiscard]] size_type find(const size_type hash, Func pred) const {
+        const auto value = mix(hash);
+        const auto tag = static_cast<std::uint8_t>(value & 0x7Fu);
+        const auto mask = group_mask();
+
+        for(size_type curr = (value >> 7u) & mask, step{}; step <= mask; curr = (curr + ++step) & mask) {
+            const auto offset = curr * control_group::width;
+            const control_group group{control.data() + offset};
+
+            for(auto bits = group.match(tag); bits; bits &= bits - 1u) {
+                if(const auto slot = offset + control_group::lowest(bits); pred(slots[slot])) {
+                    return slot;
+                }
+            }
+
+            if(group.match_empty()) {
+                break;
+            }
+        }
+
+        return placeholder;
+    }
+
+    void prefetch([[maybe_unused]] const size_type hash) const ENTT_NOEXCEPT {
+        ENTT_PREFETCH(control.data() + ((mix(hash) >> 7u) & group_mask()) * control_group::width);
+    }
+
+    size_type emplace(const size_type hash, const size_type pos) ENTT_NOEXCEPT {
+        const auto value = mix(hash);
+        const auto mask = group_mask();
+        auto curr = (value >> 7u) & mask;
+
+        for(size_type step{}; !control_group{control.data() + curr * control_group::width}.match_free(); curr = (curr + ++step) & mask) {}
+
+        const auto slot = curr * control_group::width + control_group::lowest(control_group{control.data() + curr * control_group::width}.match_free());
+        ENTT_ASSERT(control[slot] == control_group::deleted || growth, "No free slots left");
+        growth -= (control[slot] == control_group::empty);
+        control[slot] = static_cast<std::uint8_t>(value & 0x7Fu);
+        slots[slot] = pos;
+        return slot;
+    }
+
+    void erase(const size_type slot) ENTT_NOEXCEPT {
+        // probes never stop at groups without empty slots, they do at this one already
+        if(control_group{control.data() + (slot - slot % control_group::width)}.match_empty()) {
+            control[slot] = control_group::empty;
+            ++growth;
+        } else {
+            control[slot] = control_group::deleted;
+        }
+
+        slots[slot] = placeholder;
+    }
+
+    [[nodiscard]] size_type &operator[](const size_type slot) ENTT_NOEXCEPT {
+        return slots[slot];
+    }
+
+    [[nodiscard]] size_type operator[](const size_type slot) const ENTT_NOEXCEPT {
+        return slots[slot];
+    }
+
+    void swap(flat_index &other) {
+        using std::swap;
+        swap(control, other.control);
+        swap(slots, other.slots);
+        swap(growth, other.growth);
+    }
+
+private:
+    control_container_type control;
+    slot_container_type slots;
+    size_type growth;
+};
+
+template<typename Allocator>
+inline void swap(flat_index<Allocator> &lhs, flat_index<Allocator> &rhs) {
+    lhs.swap(rhs);
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+} // namespace entt
+
+#endif
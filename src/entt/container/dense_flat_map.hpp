@@ -0,0 +1,769 @@
+#ifndef ENTT_CONTAINER_DENSE_FLAT_MAP_HPP
+#define ENTT_CONTAINER_DENSE_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_traits.hpp"
+#include "control_group.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Associative container for key-value pairs with unique keys.
+ *
+ * Elements are stored in a packed array, exactly as it happens with a dense
+ * map. However, lookups don't walk implicit lists within the packed array.
+ * Instead, they probe groups of one byte control slots, each one of which
+ * contains a few bits of the hash of the key it refers to. Whole groups are
+ * compared at once, with SSE2 instructions when available.<br/>
+ * There is no bucket interface, since a key isn't tied to a single slot.
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam Hash Type of function to use to hash the keys.
+ * @tparam KeyEqual Type of function to use to compare the keys for equality.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, typename Hash, typename KeyEqual, typename Allocator>
+class dense_flat_map {
+    static constexpr float default_threshold = 0.875f;
+
+    using node_type = internal::dense_map_node<Key, Type>;
+    using alloc_traits = typename std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::pair<const Key, Type>>, "Invalid value type");
+    using index_type = internal::flat_index<Allocator>;
+    using packed_container_type = std::vector<node_type, typename alloc_traits::template rebind_alloc<node_type>>;
+
+    static constexpr std::size_t minimum_capacity = index_type::minimum_capacity;
+
+    [[nodiscard]] std::size_t limit(const std::size_t length) const ENTT_NOEXCEPT {
+        return (std::min)(length - 1u, static_cast<std::size_t>(length * max_load_factor()));
+    }
+
+    template<typename Other>
+    [[nodiscard]] std::size_t slot_of(const Other &key, const std::size_t hash) const {
+        return sparse.first().find(hash, [this, &key](const std::size_t pos) { return packed.second()(packed.first()[pos].element.first, key); });
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key, const std::size_t hash) {
+        const auto slot = slot_of(key, hash);
+        return (slot == index_type::placeholder) ? end() : (begin() + static_cast<typename iterator::difference_type>(sparse.first()[slot]));
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key, const std::size_t hash) const {
+        const auto slot = slot_of(key, hash);
+        return (slot == index_type::placeholder) ? cend() : (cbegin() + static_cast<typename iterator::difference_type>(sparse.first()[slot]));
+    }
+
+    template<typename Other, typename... Args>
+    [[nodiscard]] auto insert_or_do_nothing(Other &&key, Args &&...args) {
+        const auto hash = sparse.second()(key);
+
+        if(const auto slot = slot_of(key, hash); slot != index_type::placeholder) {
+            return std::make_pair(begin() + static_cast<typename iterator::difference_type>(sparse.first()[slot]), false);
+        }
+
+        packed.first().emplace_back(index_type::placeholder, std::piecewise_construct, std::forward_as_tuple(std::forward<Other>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        index_last(hash);
+
+        return std::make_pair(--end(), true);
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] auto insert_or_overwrite(Other &&key, Arg &&value) {
+        const auto hash = sparse.second()(key);
+
+        if(const auto slot = slot_of(key, hash); slot != index_type::placeholder) {
+            auto it = begin() + static_cast<typename iterator::difference_type>(sparse.first()[slot]);
+            it->second = std::forward<Arg>(value);
+            return std::make_pair(it, false);
+        }
+
+        packed.first().emplace_back(index_type::placeholder, std::forward<Other>(key), std::forward<Arg>(value));
+        index_last(hash);
+
+        return std::make_pair(--end(), true);
+    }
+
+    void index_last(const std::size_t hash) {
+        if(sparse.first().growth_left()) {
+            packed.first().back().next = sparse.first().emplace(hash, size() - 1u);
+        } else {
+            // tombstones are reclaimed in place as long as the table is at most half full
+            const auto length = bucket_count();
+
+            ENTT_TRY {
+                rebuild((size() <= limit(length) / 2u) ? length : (length * 2u));
+            }
+            ENTT_CATCH {
+                packed.first().pop_back();
+                ENTT_THROW;
+            }
+        }
+    }
+
+    void move_and_pop(const std::size_t pos) {
+        if(const auto last = size() - 1u; pos != last) {
+            sparse.first()[packed.first().back().next] = pos;
+            packed.first()[pos] = std::move(packed.first().back());
+        }
+
+        packed.first().pop_back();
+    }
+
+    [[nodiscard]] std::size_t required_capacity(const std::size_t count) const {
+        auto value = (std::max)(count, minimum_capacity);
+        value = (std::max)(value, size() + 1u);
+        return next_power_of_two((std::max)(value, static_cast<std::size_t>(std::ceil(size() / max_load_factor()))));
+    }
+
+    void rebuild(const std::size_t length) {
+        ENTT_ASSERT(limit(length) >= size(), "Invalid capacity");
+        sparse.first().reset(length, limit(length));
+
+        for(std::size_t pos{}, last = size(); pos < last; ++pos) {
+            packed.first()[pos].next = sparse.first().emplace(sparse.second()(packed.first()[pos].element.first), pos);
+        }
+    }
+
+public:
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of function to use to hash the keys. */
+    using hasher = Hash;
+    /*! @brief Type of function to use to compare the keys for equality. */
+    using key_equal = KeyEqual;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::dense_map_iterator<typename packed_container_type::pointer>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::dense_map_iterator<typename packed_container_type::const_pointer>;
+
+    /*! @brief Default constructor. */
+    dense_flat_map()
+        : dense_flat_map(minimum_capacity) {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit dense_flat_map(const allocator_type &allocator)
+        : dense_flat_map{minimum_capacity, hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and user
+     * supplied minimal number of slots.
+     * @param bucket_count Minimal number of slots.
+     * @param allocator The allocator to use.
+     */
+    dense_flat_map(const size_type bucket_count, const allocator_type &allocator)
+        : dense_flat_map{bucket_count, hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function and user supplied minimal number of slots.
+     * @param bucket_count Minimal number of slots.
+     * @param hash Hash function to use.
+     * @param allocator The allocator to use.
+     */
+    dense_flat_map(const size_type bucket_count, const hasher &hash, const allocator_type &allocator)
+        : dense_flat_map{bucket_count, hash, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function, compare function and user supplied minimal number of slots.
+     * @param bucket_count Minimal number of slots.
+     * @param hash Hash function to use.
+     * @param equal Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit dense_flat_map(const size_type bucket_count, const hasher &hash = hasher{}, const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type())
+        : sparse{allocator, hash},
+          packed{allocator, equal},
+          threshold{default_threshold} {
+        rehash(bucket_count);
+    }
+
+    /*! @brief Default copy constructor. */
+    dense_flat_map(const dense_flat_map &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    dense_flat_map(const dense_flat_map &other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(other.sparse.first(), allocator), std::forward_as_tuple(other.sparse.second())},
+          packed{std::piecewise_construct, std::forward_as_tuple(other.packed.first(), allocator), std::forward_as_tuple(other.packed.second())},
+          threshold{other.threshold} {}
+
+    /*! @brief Default move constructor. */
+    dense_flat_map(dense_flat_map &&) = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    dense_flat_map(dense_flat_map &&other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(std::move(other.sparse.first()), allocator), std::forward_as_tuple(std::move(other.sparse.second()))},
+          packed{std::piecewise_construct, std::forward_as_tuple(std::move(other.packed.first()), allocator), std::forward_as_tuple(std::move(other.packed.second()))},
+          threshold{other.threshold} {}
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This container.
+     */
+    dense_flat_map &operator=(const dense_flat_map &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This container.
+     */
+    dense_flat_map &operator=(dense_flat_map &&) = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return packed.first().get_allocator();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the internal array.
+     * If the array is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the internal array. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return packed.first().data() + size();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return packed.first().data() + size();
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return packed.first().empty();
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return packed.first().size();
+    }
+
+    /*! @brief Clears the container. */
+    void clear() ENTT_NOEXCEPT {
+        packed.first().clear();
+        rebuild(minimum_capacity);
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @param value A key-value pair eventually convertible to the value type.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type &value) {
+        return insert_or_do_nothing(value.first, value.second);
+    }
+
+    /*! @copydoc insert */
+    std::pair<iterator, bool> insert(value_type &&value) {
+        return insert_or_do_nothing(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @copydoc insert
+     * @tparam Arg Type of the key-value pair to insert into the container.
+     */
+    template<typename Arg>
+    std::enable_if_t<std::is_constructible_v<value_type, Arg &&>, std::pair<iterator, bool>>
+    insert(Arg &&value) {
+        return insert_or_do_nothing(std::forward<Arg>(value).first, std::forward<Arg>(value).second);
+    }
+
+    /**
+     * @brief Inserts elements into the container, if their keys do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            // sizes the table once for the whole range rather than doubling it repeatedly
+            const auto count = size() + static_cast<size_type>(std::distance(first, last));
+            packed.first().reserve(count);
+
+            if(const auto length = static_cast<size_type>(std::ceil(count / max_load_factor())); length > bucket_count()) {
+                rehash(length);
+            }
+        }
+
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     * @return A pair consisting of an iterator to the element and a bool
+     * denoting whether the insertion took place.
+     */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(const key_type &key, Arg &&value) {
+        return insert_or_overwrite(key, std::forward<Arg>(value));
+    }
+
+    /*! @copydoc insert_or_assign */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(key_type &&key, Arg &&value) {
+        return insert_or_overwrite(std::move(key), std::forward<Arg>(value));
+    }
+
+    /**
+     * @brief Constructs an element in-place, if the key does not exist.
+     *
+     * The element is also constructed when the container already has the key,
+     * in which case the newly constructed object is destroyed immediately.
+     *
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace([[maybe_unused]] Args &&...args) {
+        if constexpr(sizeof...(Args) == 0u) {
+            return insert_or_do_nothing(key_type{});
+        } else if constexpr(sizeof...(Args) == 1u) {
+            return insert_or_do_nothing(std::forward<Args>(args).first..., std::forward<Args>(args).second...);
+        } else if constexpr(sizeof...(Args) == 2u) {
+            return insert_or_do_nothing(std::forward<Args>(args)...);
+        } else {
+            auto &node = packed.first().emplace_back(index_type::placeholder, std::forward<Args>(args)...);
+            const auto hash = sparse.second()(node.element.first);
+
+            if(const auto slot = slot_of(node.element.first, hash); slot != index_type::placeholder) {
+                packed.first().pop_back();
+                return std::make_pair(begin() + static_cast<typename iterator::difference_type>(sparse.first()[slot]), false);
+            }
+
+            index_last(hash);
+            return std::make_pair(--end(), true);
+        }
+    }
+
+    /**
+     * @brief Inserts in-place if the key does not exist, does nothing if the
+     * key exists.
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param key A key used both to look up and to insert if not found.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+        return insert_or_do_nothing(key, std::forward<Args>(args)...);
+    }
+
+    /*! @copydoc try_emplace */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+        return insert_or_do_nothing(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes an element from a given position.
+     * @param pos An iterator to the element to remove.
+     * @return An iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) {
+        const auto diff = pos - cbegin();
+        erase(pos->first);
+        return begin() + diff;
+    }
+
+    /**
+     * @brief Removes the given elements from a container.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     * @return An iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        for(; last != first; --last) {
+            erase((last - 1u)->first);
+        }
+
+        return (begin() + (last - cbegin()));
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const key_type &key) {
+        if(const auto slot = slot_of(key, sparse.second()(key)); slot != index_type::placeholder) {
+            const auto pos = sparse.first()[slot];
+            sparse.first().erase(slot);
+            move_and_pop(pos);
+            return 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given container.
+     * @param other Container to exchange the content with.
+     */
+    void swap(dense_flat_map &other) {
+        using std::swap;
+        swap(sparse, other.sparse);
+        swap(packed, other.packed);
+        swap(threshold, other.threshold);
+    }
+
+    /**
+     * @brief Accesses a given element with bounds checking.
+     * @param key A key of an element to find.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &at(const key_type &key) {
+        auto it = find(key);
+        ENTT_ASSERT(it != end(), "Invalid key");
+        return it->second;
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] const Type &at(const key_type &key) const {
+        auto it = find(key);
+        ENTT_ASSERT(it != cend(), "Invalid key");
+        return it->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &operator[](const key_type &key) {
+        return insert_or_do_nothing(key).first->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &operator[](key_type &&key) {
+        return insert_or_do_nothing(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Finds an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key) {
+        return constrained_find(key, sparse.second()(key));
+    }
+
+    /*! @copydoc find */
+    [[nodiscard]] const_iterator find(const key_type &key) const {
+        return constrained_find(key, sparse.second()(key));
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key) {
+        return constrained_find(key, sparse.second()(key));
+    }
+
+    /*! @copydoc find */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key) const {
+        return constrained_find(key, sparse.second()(key));
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Finds an element with a given key and a precomputed hash value.
+     *
+     * The hash value must be the same that the hash function of the container
+     * returns for the given key, otherwise the behavior is undefined.
+     *
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, hash);
+    }
+
+    /*! @copydoc find(const key_type &, const size_type) */
+    [[nodiscard]] const_iterator find(const key_type &key, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, hash);
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * value, using a precomputed hash value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, hash);
+    }
+
+    /*! @copydoc find(const Other &, const size_type) */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, hash);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key and
+     * a precomputed hash value.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key, const size_type hash) const {
+        return (find(key, hash) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value, using a precomputed hash value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key, const size_type hash) const {
+        return (find(key, hash) != cend());
+    }
+
+    /**
+     * @brief Hints the processor to load the hash table entries for a given
+     * hash value, ahead of a lookup.
+     *
+     * It's worth it when a batch of keys is known in advance, so that the
+     * lookups can be interleaved with the memory accesses they require.
+     *
+     * @param hash Hash value of a key to search for later.
+     */
+    void prefetch([[maybe_unused]] const size_type hash) const ENTT_NOEXCEPT {
+        sparse.first().prefetch(hash);
+    }
+
+    /**
+     * @brief Returns the number of control slots.
+     * @return The number of control slots.
+     */
+    [[nodiscard]] size_type bucket_count() const {
+        return sparse.first().capacity();
+    }
+
+    /**
+     * @brief Returns the maximum number of control slots.
+     * @return The maximum number of control slots.
+     */
+    [[nodiscard]] size_type max_bucket_count() const {
+        return sparse.first().max_capacity();
+    }
+
+    /**
+     * @brief Returns the ratio between elements and control slots.
+     * @return The ratio between elements and control slots.
+     */
+    [[nodiscard]] float load_factor() const {
+        return size() / static_cast<float>(bucket_count());
+    }
+
+    /**
+     * @brief Returns the maximum ratio between elements and control slots.
+     * @return The maximum ratio between elements and control slots.
+     */
+    [[nodiscard]] float max_load_factor() const {
+        return threshold;
+    }
+
+    /**
+     * @brief Sets the desired maximum ratio between elements and control slots.
+     *
+     * At least one control slot is always left empty, no matter what.
+     *
+     * @param value A desired maximum ratio between elements and control slots.
+     */
+    void max_load_factor(const float value) {
+        ENTT_ASSERT(value > 0.f, "Invalid load factor");
+        threshold = value;
+        rebuild(required_capacity(0u));
+    }
+
+    /**
+     * @brief Reserves at least the specified number of control slots and
+     * regenerates the hash table.
+     * @param count New number of control slots.
+     */
+    void rehash(const size_type count) {
+        if(const auto sz = required_capacity(count); sz != bucket_count()) {
+            rebuild(sz);
+        }
+    }
+
+    /**
+     * @brief Reserves space for at least the specified number of elements and
+     * regenerates the hash table.
+     * @param count New number of elements.
+     */
+    void reserve(const size_type count) {
+        packed.first().reserve(count);
+        rehash(static_cast<size_type>(std::ceil(count / max_load_factor())));
+    }
+
+    /**
+     * @brief Returns the function used to hash the keys.
+     * @return The function used to hash the keys.
+     */
+    [[nodiscard]] hasher hash_function() const {
+        return sparse.second();
+    }
+
+    /**
+     * @brief Returns the function used to compare keys for equality.
+     * @return The function used to compare keys for equality.
+     */
+    [[nodiscard]] key_equal key_eq() const {
+        return packed.second();
+    }
+
+private:
+    compressed_pair<index_type, hasher> sparse;
+    compressed_pair<packed_container_type, key_equal> packed;
+    float threshold;
+};
+
+} // namespace entt
+
+#endif
@@ -328,7 +328,7 @@ class dense_map {
     void move_and_pop(const std::size_t pos) {
         if(const auto last = size() - 1u; pos != last) {
             packed.first()[pos] = std::move(packed.first().back());
-            size_type *curr = sparse.first().data() + key_to_bucket(packed.first().back().element.first);
+            size_type *curr = sparse.first().data() + key_to_bucket(packed.first()[pos].element.first);
             for(; *curr != last; curr = &packed.first()[*curr].next) {}
             *curr = pos;
         }
@@ -336,6 +336,28 @@ class dense_map {
         packed.first().pop_back();
     }
 
+    template<typename Exec, typename Func, typename Node>
+    static void par_each(Exec &executor, Func &func, Node *data, const std::size_t length) {
+        if(length) {
+            const auto task = [&func, data, length](const std::size_t chunk) {
+                for(auto pos = chunk * ENTT_PACKED_PAGE, last = (std::min)(length, pos + ENTT_PACKED_PAGE); pos < last; ++pos) {
+                    func(std::as_const(data[pos].element.first), data[pos].element.second);
+                }
+            };
+
+            executor((length + ENTT_PACKED_PAGE - 1u) / ENTT_PACKED_PAGE, std::as_const(task));
+        }
+    }
+
+    void relink() {
+        std::fill(sparse.first().begin(), sparse.first().end(), std::numeric_limits<size_type>::max());
+
+        for(size_type pos{}, last = size(); pos < last; ++pos) {
+            const auto index = key_to_bucket(packed.first()[pos].element.first);
+            packed.first()[pos].next = std::exchange(sparse.first()[index], pos);
+        }
+    }
+
     void rehash_if_required() {
         if(size() > (bucket_count() * max_load_factor())) {
             rehash(bucket_count() * 2u);
@@ -503,6 +525,49 @@ public:
         return packed.first().data() + size();
     }
 
+    /**
+     * @brief Iterates elements in parallel and applies the given function
+     * object to them.
+     *
+     * Elements are contiguous in memory, therefore they're split in chunks of
+     * up to `ENTT_PACKED_PAGE` elements and each chunk is visited by a task.
+     * The executor is invoked once with the number of chunks and a task to
+     * run for each index in the range `[0, count)`. The signature of the
+     * executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed. The order in which elements are
+     * visited isn't specified. The signature of the function object must be
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const key_type &, mapped_type &);
+     * @endcode
+     *
+     * @warning
+     * Inserting or removing elements while the tasks are running results in
+     * undefined behavior.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec &&executor, Func func) {
+        par_each(executor, func, packed.first().data(), size());
+    }
+
+    /*! @copydoc par_each */
+    template<typename Exec, typename Func>
+    void par_each(Exec &&executor, Func func) const {
+        par_each(executor, func, packed.first().data(), size());
+    }
+
     /**
      * @brief Checks whether a container is empty.
      * @return True if the container is empty, false otherwise.
@@ -560,6 +625,16 @@ public:
      */
     template<typename It>
     void insert(It first, It last) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            // sizes the table once for the whole range rather than doubling it repeatedly
+            const auto count = size() + static_cast<size_type>(std::distance(first, last));
+            packed.first().reserve(count);
+
+            if(const auto length = static_cast<size_type>(std::ceil(count / max_load_factor())); length > bucket_count()) {
+                rehash(length);
+            }
+        }
+
         for(; first != last; ++first) {
             insert(*first);
         }
@@ -687,6 +762,70 @@ public:
         return 0u;
     }
 
+    /**
+     * @brief Removes all the elements that satisfy a given predicate.
+     *
+     * Unlike erasing elements one at a time, no element is swapped with the
+     * last one and no bucket is visited while removing them. The surviving
+     * elements are compacted in a single pass and preserve their relative
+     * order, then the buckets are regenerated at once.<br/>
+     * This is the preferred way to remove many elements in a row. There is no
+     * mode that leaves tombstones behind and compacts them later, erasing an
+     * element outside of a batch always moves the last one in its place.
+     *
+     * If the predicate throws, the elements it already selected are removed
+     * while all the others, including the one being tested, are kept. The
+     * map is valid in any case.
+     *
+     * The predicate is invoked once per element and has the following form:
+     *
+     * @code{.cpp}
+     * bool(const key_type &, mapped_type &);
+     * @endcode
+     *
+     * @tparam Func Type of the predicate.
+     * @param pred A valid predicate.
+     * @return Number of elements removed.
+     */
+    template<typename Func>
+    size_type erase_if(Func pred) {
+        auto &nodes = packed.first();
+        const auto length = nodes.size();
+        size_type last{};
+        size_type pos{};
+
+        ENTT_TRY {
+            for(; pos < length; ++pos) {
+                if(!pred(std::as_const(nodes[pos].element.first), nodes[pos].element.second)) {
+                    if(last != pos) {
+                        nodes[last] = std::move(nodes[pos]);
+                    }
+
+                    ++last;
+                }
+            }
+        }
+        ENTT_CATCH {
+            // elements not yet tested are kept, buckets still refer to the old positions
+            for(; pos < length; ++pos, ++last) {
+                if(last != pos) {
+                    nodes[last] = std::move(nodes[pos]);
+                }
+            }
+
+            nodes.erase(nodes.begin() + static_cast<typename packed_container_type::difference_type>(last), nodes.end());
+            relink();
+            ENTT_THROW;
+        }
+
+        if(last != length) {
+            nodes.erase(nodes.begin() + static_cast<typename packed_container_type::difference_type>(last), nodes.end());
+            relink();
+        }
+
+        return length - last;
+    }
+
     /**
      * @brief Exchanges the contents with those of a given container.
      * @param other Container to exchange the content with.
@@ -792,6 +931,90 @@ public:
         return (find(key) != cend());
     }
 
+    /**
+     * @brief Finds an element with a given key and a precomputed hash value.
+     *
+     * The hash value must be the same that the hash function of the container
+     * returns for the given key, otherwise the behavior is undefined.
+     *
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, fast_mod(hash, bucket_count()));
+    }
+
+    /*! @copydoc find(const key_type &, const size_type) */
+    [[nodiscard]] const_iterator find(const key_type &key, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, fast_mod(hash, bucket_count()));
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * value, using a precomputed hash value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, fast_mod(hash, bucket_count()));
+    }
+
+    /*! @copydoc find(const Other &, const size_type) */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(key) == hash, "Invalid hash value");
+        return constrained_find(key, fast_mod(hash, bucket_count()));
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key and
+     * a precomputed hash value.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key, const size_type hash) const {
+        return (find(key, hash) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value, using a precomputed hash value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @param hash Hash value of the key to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key, const size_type hash) const {
+        return (find(key, hash) != cend());
+    }
+
+    /**
+     * @brief Hints the processor to load the hash table entries for a given
+     * hash value, ahead of a lookup.
+     *
+     * It's worth it when a batch of keys is known in advance, so that the
+     * lookups can be interleaved with the memory accesses they require.
+     *
+     * @param hash Hash value of a key to search for later.
+     */
+    void prefetch([[maybe_unused]] const size_type hash) const ENTT_NOEXCEPT {
+        ENTT_PREFETCH(sparse.first().data() + fast_mod(hash, bucket_count()));
+    }
+
     /**
      * @brief Returns an iterator to the beginning of a given bucket.
      * @param index An index of a bucket to access.
@@ -917,12 +1140,7 @@ public:
 
         if(const auto sz = next_power_of_two(value); sz != bucket_count()) {
             sparse.first().resize(sz);
-            std::fill(sparse.first().begin(), sparse.first().end(), std::numeric_limits<size_type>::max());
-
-            for(size_type pos{}, last = size(); pos < last; ++pos) {
-                const auto index = key_to_bucket(packed.first()[pos].element.first);
-                packed.first()[pos].next = std::exchange(sparse.first()[index], pos);
-            }
+            relink();
         }
     }
 
@@ -280,7 +280,7 @@ class dense_set {
     void move_and_pop(const std::size_t pos) {
         if(const auto last = size() - 1u; pos != last) {
             packed.first()[pos] = std::move(packed.first().back());
-            size_type *curr = sparse.first().data() + value_to_bucket(packed.first().back().second);
+            size_type *curr = sparse.first().data() + value_to_bucket(packed.first()[pos].second);
             for(; *curr != last; curr = &packed.first()[*curr].first) {}
             *curr = pos;
         }
@@ -288,6 +288,19 @@ class dense_set {
         packed.first().pop_back();
     }
 
+    template<typename Exec, typename Func>
+    static void par_each(Exec &executor, Func &func, const node_type *data, const std::size_t length) {
+        if(length) {
+            const auto task = [&func, data, length](const std::size_t chunk) {
+                for(auto pos = chunk * ENTT_PACKED_PAGE, last = (std::min)(length, pos + ENTT_PACKED_PAGE); pos < last; ++pos) {
+                    func(data[pos].second);
+                }
+            };
+
+            executor((length + ENTT_PACKED_PAGE - 1u) / ENTT_PACKED_PAGE, std::as_const(task));
+        }
+    }
+
     void rehash_if_required() {
         if(size() > (bucket_count() * max_load_factor())) {
             rehash(bucket_count() * 2u);
@@ -453,6 +466,43 @@ public:
         return packed.first().data() + size();
     }
 
+    /**
+     * @brief Iterates elements in parallel and applies the given function
+     * object to them.
+     *
+     * Elements are contiguous in memory, therefore they're split in chunks of
+     * up to `ENTT_PACKED_PAGE` elements and each chunk is visited by a task.
+     * The executor is invoked once with the number of chunks and a task to
+     * run for each index in the range `[0, count)`. The signature of the
+     * executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed. The order in which elements are
+     * visited isn't specified. The signature of the function object must be
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const value_type &);
+     * @endcode
+     *
+     * @warning
+     * Inserting or removing elements while the tasks are running results in
+     * undefined behavior.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec &&executor, Func func) const {
+        par_each(executor, func, packed.first().data(), size());
+    }
+
     /**
      * @brief Checks whether a container is empty.
      * @return True if the container is empty, false otherwise.
@@ -500,6 +550,16 @@ public:
      */
     template<typename It>
     void insert(It first, It last) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            // sizes the table once for the whole range rather than doubling it repeatedly
+            const auto count = size() + static_cast<size_type>(std::distance(first, last));
+            packed.first().reserve(count);
+
+            if(const auto length = static_cast<size_type>(std::ceil(count / max_load_factor())); length > bucket_count()) {
+                rehash(length);
+            }
+        }
+
         for(; first != last; ++first) {
             insert(*first);
         }
@@ -649,6 +709,90 @@ public:
         return (find(value) != cend());
     }
 
+    /**
+     * @brief Finds an element with a given value and a precomputed hash value.
+     *
+     * The hash value must be the same that the hash function of the container
+     * returns for the given element, otherwise the behavior is undefined.
+     *
+     * @param value Value of an element to search for.
+     * @param hash Hash value of the element to search for.
+     * @return An iterator to an element with the given value. If no such
+     * element is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const value_type &value, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(value) == hash, "Invalid hash value");
+        return constrained_find(value, fast_mod(hash, bucket_count()));
+    }
+
+    /*! @copydoc find(const value_type &, const size_type) */
+    [[nodiscard]] const_iterator find(const value_type &value, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(value) == hash, "Invalid hash value");
+        return constrained_find(value, fast_mod(hash, bucket_count()));
+    }
+
+    /**
+     * @brief Finds an element that compares _equivalent_ to a given value,
+     * using a precomputed hash value.
+     * @tparam Other Type of an element to search for.
+     * @param value Value of an element to search for.
+     * @param hash Hash value of the element to search for.
+     * @return An iterator to an element with the given value. If no such
+     * element is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &value, const size_type hash) {
+        ENTT_ASSERT(sparse.second()(value) == hash, "Invalid hash value");
+        return constrained_find(value, fast_mod(hash, bucket_count()));
+    }
+
+    /*! @copydoc find(const Other &, const size_type) */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &value, const size_type hash) const {
+        ENTT_ASSERT(sparse.second()(value) == hash, "Invalid hash value");
+        return constrained_find(value, fast_mod(hash, bucket_count()));
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given value
+     * and a precomputed hash value.
+     * @param value Value of an element to search for.
+     * @param hash Hash value of the element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const value_type &value, const size_type hash) const {
+        return (find(value, hash) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element that compares
+     * _equivalent_ to a given value, using a precomputed hash value.
+     * @tparam Other Type of an element to search for.
+     * @param value Value of an element to search for.
+     * @param hash Hash value of the element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &value, const size_type hash) const {
+        return (find(value, hash) != cend());
+    }
+
+    /**
+     * @brief Hints the processor to load the hash table entries for a given
+     * hash value, ahead of a lookup.
+     *
+     * It's worth it when a batch of elements is known in advance, so that the
+     * lookups can be interleaved with the memory accesses they require.
+     *
+     * @param hash Hash value of an element to search for later.
+     */
+    void prefetch([[maybe_unused]] const size_type hash) const ENTT_NOEXCEPT {
+        ENTT_PREFETCH(sparse.first().data() + fast_mod(hash, bucket_count()));
+    }
+
     /**
      * @brief Returns an iterator to the beginning of a given bucket.
      * @param index An index of a bucket to access.
@@ -0,0 +1,588 @@
+#ifndef ENTT_CONTAINER_FLAT_MAP_HPP
+#define ENTT_CONTAINER_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_traits.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+#include "small_vector.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Key, typename Type>
+struct flat_map_node final {
+    using value_type = std::pair<Key, Type>;
+
+    template<typename... Args>
+    flat_map_node(Args &&...args)
+        : element{std::forward<Args>(args)...} {}
+
+    template<typename Allocator, typename... Args>
+    flat_map_node(std::allocator_arg_t, const Allocator &allocator, Args &&...args)
+        : element{entt::make_obj_using_allocator<value_type>(allocator, std::forward<Args>(args)...)} {}
+
+    template<typename Allocator>
+    flat_map_node(std::allocator_arg_t, const Allocator &allocator, const flat_map_node &other)
+        : element{entt::make_obj_using_allocator<value_type>(allocator, other.element)} {}
+
+    template<typename Allocator>
+    flat_map_node(std::allocator_arg_t, const Allocator &allocator, flat_map_node &&other)
+        : element{entt::make_obj_using_allocator<value_type>(allocator, std::move(other.element))} {}
+
+    value_type element;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Sorted associative container for small sets of key-value pairs with
+ * unique keys.
+ *
+ * Elements are kept sorted by key in a single contiguous array and found by
+ * means of a branchless binary search. Up to `N` elements are stored within
+ * the container itself, without any dynamic allocation.<br/>
+ * Insertions and removals shift the elements that follow, therefore this
+ * container is meant for maps with a handful of keys.
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam N Number of elements stored inline.
+ * @tparam Compare Type of function to use to compare the keys.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, std::size_t N, typename Compare, typename Allocator>
+class flat_map {
+    using node_type = internal::flat_map_node<Key, Type>;
+    using alloc_traits = typename std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::pair<const Key, Type>>, "Invalid value type");
+    using packed_container_type = internal::small_vector<node_type, N, typename alloc_traits::template rebind_alloc<node_type>>;
+
+    template<typename Other>
+    [[nodiscard]] std::size_t key_to_index(const Other &key) const {
+        return internal::branchless_lower_bound(packed.first().data(), packed.first().size(), [this, &key](const node_type &elem) { return packed.second()(elem.element.first, key); });
+    }
+
+    template<typename Other>
+    [[nodiscard]] bool matches(const std::size_t pos, const Other &key) const {
+        return pos != packed.first().size() && !packed.second()(key, packed.first()[pos].element.first);
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) {
+        const auto pos = key_to_index(key);
+        return matches(pos, key) ? (begin() + static_cast<typename iterator::difference_type>(pos)) : end();
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) const {
+        const auto pos = key_to_index(key);
+        return matches(pos, key) ? (cbegin() + static_cast<typename iterator::difference_type>(pos)) : cend();
+    }
+
+    [[nodiscard]] auto move_into_place(const std::size_t pos) {
+        auto *first = packed.first().data();
+        std::rotate(first + pos, first + packed.first().size() - 1u, first + packed.first().size());
+        return begin() + static_cast<typename iterator::difference_type>(pos);
+    }
+
+    template<typename Other, typename... Args>
+    [[nodiscard]] auto insert_or_do_nothing(Other &&key, Args &&...args) {
+        const auto pos = key_to_index(key);
+
+        if(matches(pos, key)) {
+            return std::make_pair(begin() + static_cast<typename iterator::difference_type>(pos), false);
+        }
+
+        packed.first().emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<Other>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        return std::make_pair(move_into_place(pos), true);
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] auto insert_or_overwrite(Other &&key, Arg &&value) {
+        const auto pos = key_to_index(key);
+
+        if(matches(pos, key)) {
+            auto it = begin() + static_cast<typename iterator::difference_type>(pos);
+            it->second = std::forward<Arg>(value);
+            return std::make_pair(it, false);
+        }
+
+        packed.first().emplace_back(std::forward<Other>(key), std::forward<Arg>(value));
+        return std::make_pair(move_into_place(pos), true);
+    }
+
+public:
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of function to use to compare the keys. */
+    using key_compare = Compare;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::dense_map_iterator<node_type *>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::dense_map_iterator<const node_type *>;
+
+    /*! @brief Number of elements stored inline. */
+    static constexpr size_type inline_capacity = N;
+
+    /*! @brief Default constructor. */
+    flat_map()
+        : flat_map{key_compare{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit flat_map(const allocator_type &allocator)
+        : flat_map{key_compare{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and compare
+     * function.
+     * @param compare Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit flat_map(const key_compare &compare, const allocator_type &allocator = allocator_type{})
+        : packed{std::piecewise_construct, std::forward_as_tuple(allocator), std::forward_as_tuple(compare)} {}
+
+    /*! @brief Default copy constructor. */
+    flat_map(const flat_map &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    flat_map(const flat_map &other, const allocator_type &allocator)
+        : packed{std::piecewise_construct, std::forward_as_tuple(other.packed.first(), allocator), std::forward_as_tuple(other.packed.second())} {}
+
+    /*! @brief Default move constructor. */
+    flat_map(flat_map &&) = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    flat_map(flat_map &&other, const allocator_type &allocator)
+        : packed{std::piecewise_construct, std::forward_as_tuple(std::move(other.packed.first()), allocator), std::forward_as_tuple(std::move(other.packed.second()))} {}
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This container.
+     */
+    flat_map &operator=(const flat_map &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This container.
+     */
+    flat_map &operator=(flat_map &&) = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return packed.first().get_allocator();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the element with the smallest key. If
+     * the container is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first element of the container.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last element
+     * of the container. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last element of the
+     * container.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return packed.first().data() + size();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return packed.first().data() + size();
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (packed.first().size() == 0u);
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return packed.first().size();
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     * @return Maximum possible number of elements.
+     */
+    [[nodiscard]] size_type max_size() const ENTT_NOEXCEPT {
+        return packed.first().max_size();
+    }
+
+    /**
+     * @brief Returns the number of elements that a container has currently
+     * allocated space for.
+     * @return Capacity of the container.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return packed.first().capacity();
+    }
+
+    /**
+     * @brief Increases the capacity of a container.
+     * @param count Desired capacity.
+     */
+    void reserve(const size_type count) {
+        packed.first().reserve(count);
+    }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     *
+     * Elements are moved back to the inline storage if they fit.
+     */
+    void shrink_to_fit() {
+        packed.first().shrink_to_fit();
+    }
+
+    /*! @brief Clears the container. */
+    void clear() ENTT_NOEXCEPT {
+        packed.first().clear();
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @param value A key-value pair eventually convertible to the value type.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type &value) {
+        return insert_or_do_nothing(value.first, value.second);
+    }
+
+    /*! @copydoc insert */
+    std::pair<iterator, bool> insert(value_type &&value) {
+        return insert_or_do_nothing(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @copydoc insert
+     * @tparam Arg Type of the key-value pair to insert into the container.
+     */
+    template<typename Arg>
+    std::enable_if_t<std::is_constructible_v<value_type, Arg &&>, std::pair<iterator, bool>>
+    insert(Arg &&value) {
+        return insert_or_do_nothing(std::forward<Arg>(value).first, std::forward<Arg>(value).second);
+    }
+
+    /**
+     * @brief Inserts elements into the container, if their keys do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     * @return A pair consisting of an iterator to the element and a bool
+     * denoting whether the insertion took place.
+     */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(const key_type &key, Arg &&value) {
+        return insert_or_overwrite(key, std::forward<Arg>(value));
+    }
+
+    /*! @copydoc insert_or_assign */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(key_type &&key, Arg &&value) {
+        return insert_or_overwrite(std::move(key), std::forward<Arg>(value));
+    }
+
+    /**
+     * @brief Constructs an element in-place, if the key does not exist.
+     *
+     * The element is also constructed when the container already has the key,
+     * in which case the newly constructed object is destroyed immediately.
+     *
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace([[maybe_unused]] Args &&...args) {
+        if constexpr(sizeof...(Args) == 0u) {
+            return insert_or_do_nothing(key_type{});
+        } else if constexpr(sizeof...(Args) == 1u) {
+            return insert_or_do_nothing(std::forward<Args>(args).first..., std::forward<Args>(args).second...);
+        } else if constexpr(sizeof...(Args) == 2u) {
+            return insert_or_do_nothing(std::forward<Args>(args)...);
+        } else {
+            auto &node = packed.first().emplace_back(std::forward<Args>(args)...);
+            const auto pos = internal::branchless_lower_bound(packed.first().data(), size() - 1u, [this, &node](const node_type &elem) { return packed.second()(elem.element.first, node.element.first); });
+
+            if(pos != size() - 1u && !packed.second()(node.element.first, packed.first()[pos].element.first)) {
+                packed.first().pop_back();
+                return std::make_pair(begin() + static_cast<typename iterator::difference_type>(pos), false);
+            }
+
+            return std::make_pair(move_into_place(pos), true);
+        }
+    }
+
+    /**
+     * @brief Inserts in-place if the key does not exist, does nothing if the
+     * key exists.
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param key A key used both to look up and to insert if not found.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+        return insert_or_do_nothing(key, std::forward<Args>(args)...);
+    }
+
+    /*! @copydoc try_emplace */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+        return insert_or_do_nothing(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes an element from a given position.
+     * @param pos An iterator to the element to remove.
+     * @return An iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1u);
+    }
+
+    /**
+     * @brief Removes the given elements from a container.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     * @return An iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto diff = first - cbegin();
+        packed.first().erase(static_cast<size_type>(diff), static_cast<size_type>(last - first));
+        return begin() + diff;
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const key_type &key) {
+        if(const auto pos = key_to_index(key); matches(pos, key)) {
+            packed.first().erase(pos);
+            return 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given container.
+     * @param other Container to exchange the content with.
+     */
+    void swap(flat_map &other) {
+        using std::swap;
+        packed.first().swap(other.packed.first());
+        swap(packed.second(), other.packed.second());
+    }
+
+    /**
+     * @brief Accesses a given element with bounds checking.
+     * @param key A key of an element to find.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &at(const key_type &key) {
+        auto it = find(key);
+        ENTT_ASSERT(it != end(), "Invalid key");
+        return it->second;
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] const Type &at(const key_type &key) const {
+        auto it = find(key);
+        ENTT_ASSERT(it != cend(), "Invalid key");
+        return it->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &operator[](const key_type &key) {
+        return insert_or_do_nothing(key).first->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] Type &operator[](key_type &&key) {
+        return insert_or_do_nothing(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Finds an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    [[nodiscard]] const_iterator find(const key_type &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<key_compare>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<key_compare>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<key_compare>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Returns the function used to compare the keys.
+     * @return The function used to compare the keys.
+     */
+    [[nodiscard]] key_compare key_comp() const {
+        return packed.second();
+    }
+
+private:
+    compressed_pair<packed_container_type, key_compare> packed;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,415 @@
+#ifndef ENTT_CONTAINER_FLAT_SET_HPP
+#define ENTT_CONTAINER_FLAT_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/type_traits.hpp"
+#include "fwd.hpp"
+#include "small_vector.hpp"
+
+namespace entt {
+
+/**
+ * @brief Sorted associative container for small sets of unique objects.
+ *
+ * Elements are kept sorted in a single contiguous array and found by means of
+ * a branchless binary search. Up to `N` elements are stored within the
+ * container itself, without any dynamic allocation.<br/>
+ * Insertions and removals shift the elements that follow, therefore this
+ * container is meant for sets with a handful of elements.
+ *
+ * @tparam Type Value type of the associative container.
+ * @tparam N Number of elements stored inline.
+ * @tparam Compare Type of function to use to compare the elements.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, std::size_t N, typename Compare, typename Allocator>
+class flat_set {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using packed_container_type = internal::small_vector<Type, N, Allocator>;
+
+    template<typename Other>
+    [[nodiscard]] std::size_t value_to_index(const Other &value) const {
+        return internal::branchless_lower_bound(packed.first().data(), packed.first().size(), [this, &value](const Type &elem) { return packed.second()(elem, value); });
+    }
+
+    template<typename Other>
+    [[nodiscard]] bool matches(const std::size_t pos, const Other &value) const {
+        return pos != packed.first().size() && !packed.second()(value, packed.first()[pos]);
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &value) const {
+        const auto pos = value_to_index(value);
+        return matches(pos, value) ? (cbegin() + pos) : cend();
+    }
+
+    [[nodiscard]] auto move_into_place(const std::size_t pos) {
+        auto *first = packed.first().data();
+        std::rotate(first + pos, first + packed.first().size() - 1u, first + packed.first().size());
+        return begin() + pos;
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto insert_or_do_nothing(Other &&value) {
+        const auto pos = value_to_index(value);
+
+        if(matches(pos, value)) {
+            return std::make_pair(begin() + pos, false);
+        }
+
+        packed.first().emplace_back(std::forward<Other>(value));
+        return std::make_pair(move_into_place(pos), true);
+    }
+
+public:
+    /*! @brief Key type of the container. */
+    using key_type = Type;
+    /*! @brief Value type of the container. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of function to use to compare the elements. */
+    using key_compare = Compare;
+    /*! @brief Type of function to use to compare the elements. */
+    using value_compare = Compare;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Random access iterator type. */
+    using iterator = const value_type *;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = const value_type *;
+
+    /*! @brief Number of elements stored inline. */
+    static constexpr size_type inline_capacity = N;
+
+    /*! @brief Default constructor. */
+    flat_set()
+        : flat_set{key_compare{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit flat_set(const allocator_type &allocator)
+        : flat_set{key_compare{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and compare
+     * function.
+     * @param compare Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit flat_set(const key_compare &compare, const allocator_type &allocator = allocator_type{})
+        : packed{std::piecewise_construct, std::forward_as_tuple(allocator), std::forward_as_tuple(compare)} {}
+
+    /*! @brief Default copy constructor. */
+    flat_set(const flat_set &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    flat_set(const flat_set &other, const allocator_type &allocator)
+        : packed{std::piecewise_construct, std::forward_as_tuple(other.packed.first(), allocator), std::forward_as_tuple(other.packed.second())} {}
+
+    /*! @brief Default move constructor. */
+    flat_set(flat_set &&) = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    flat_set(flat_set &&other, const allocator_type &allocator)
+        : packed{std::piecewise_construct, std::forward_as_tuple(std::move(other.packed.first()), allocator), std::forward_as_tuple(std::move(other.packed.second()))} {}
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This container.
+     */
+    flat_set &operator=(const flat_set &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This container.
+     */
+    flat_set &operator=(flat_set &&) = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return packed.first().get_allocator();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the smallest element. If the container is
+     * empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first element of the container.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last element
+     * of the container. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last element of the
+     * container.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return packed.first().data() + size();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (packed.first().size() == 0u);
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return packed.first().size();
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     * @return Maximum possible number of elements.
+     */
+    [[nodiscard]] size_type max_size() const ENTT_NOEXCEPT {
+        return packed.first().max_size();
+    }
+
+    /**
+     * @brief Returns the number of elements that a container has currently
+     * allocated space for.
+     * @return Capacity of the container.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return packed.first().capacity();
+    }
+
+    /**
+     * @brief Increases the capacity of a container.
+     * @param count Desired capacity.
+     */
+    void reserve(const size_type count) {
+        packed.first().reserve(count);
+    }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     *
+     * Elements are moved back to the inline storage if they fit.
+     */
+    void shrink_to_fit() {
+        packed.first().shrink_to_fit();
+    }
+
+    /*! @brief Clears the container. */
+    void clear() ENTT_NOEXCEPT {
+        packed.first().clear();
+    }
+
+    /**
+     * @brief Inserts an element into the container, if it does not exist.
+     * @param value An element to insert into the container.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type &value) {
+        return insert_or_do_nothing(value);
+    }
+
+    /*! @copydoc insert */
+    std::pair<iterator, bool> insert(value_type &&value) {
+        return insert_or_do_nothing(std::move(value));
+    }
+
+    /**
+     * @brief Inserts elements into the container, if they do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Constructs an element in-place, if it does not exist.
+     *
+     * The element is also constructed when the container already has the key,
+     * in which case the newly constructed object is destroyed immediately.
+     *
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args) {
+        if constexpr(sizeof...(Args) == 1u && (std::is_same_v<std::decay_t<Args>, value_type> && ...)) {
+            return insert_or_do_nothing(std::forward<Args>(args)...);
+        } else {
+            auto &value = packed.first().emplace_back(std::forward<Args>(args)...);
+            const auto pos = internal::branchless_lower_bound(packed.first().data(), size() - 1u, [this, &value](const Type &elem) { return packed.second()(elem, value); });
+
+            if(pos != size() - 1u && !packed.second()(value, packed.first()[pos])) {
+                packed.first().pop_back();
+                return std::make_pair(begin() + pos, false);
+            }
+
+            return std::make_pair(move_into_place(pos), true);
+        }
+    }
+
+    /**
+     * @brief Removes an element from a given position.
+     * @param pos An iterator to the element to remove.
+     * @return An iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1u);
+    }
+
+    /**
+     * @brief Removes the given elements from a container.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     * @return An iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto diff = first - cbegin();
+        packed.first().erase(static_cast<size_type>(diff), static_cast<size_type>(last - first));
+        return begin() + diff;
+    }
+
+    /**
+     * @brief Removes the element associated with a given value.
+     * @param value Value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const value_type &value) {
+        if(const auto pos = value_to_index(value); matches(pos, value)) {
+            packed.first().erase(pos);
+            return 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given container.
+     * @param other Container to exchange the content with.
+     */
+    void swap(flat_set &other) {
+        using std::swap;
+        packed.first().swap(other.packed.first());
+        swap(packed.second(), other.packed.second());
+    }
+
+    /**
+     * @brief Finds an element with a given value.
+     * @param value Value of an element to search for.
+     * @return An iterator to an element with the given value. If no such
+     * element is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] const_iterator find(const value_type &value) const {
+        return constrained_find(value);
+    }
+
+    /**
+     * @brief Finds an element that compares _equivalent_ to a given value.
+     * @tparam Other Type of an element to search for.
+     * @param value Value of an element to search for.
+     * @return An iterator to an element with the given value. If no such
+     * element is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<key_compare>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &value) const {
+        return constrained_find(value);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given value.
+     * @param value Value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const value_type &value) const {
+        return (find(value) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element that compares
+     * _equivalent_ to a given value.
+     * @tparam Other Type of an element to search for.
+     * @param value Value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<key_compare>, std::conditional_t<false, Other, bool>>
+    contains(const Other &value) const {
+        return (find(value) != cend());
+    }
+
+    /**
+     * @brief Returns the function used to compare the elements.
+     * @return The function used to compare the elements.
+     */
+    [[nodiscard]] key_compare key_comp() const {
+        return packed.second();
+    }
+
+    /*! @copydoc key_comp */
+    [[nodiscard]] value_compare value_comp() const {
+        return packed.second();
+    }
+
+private:
+    compressed_pair<packed_container_type, key_compare> packed;
+};
+
+} // namespace entt
+
+#endif
@@ -1,11 +1,20 @@
 #ifndef ENTT_CONTAINER_FWD_HPP
 #define ENTT_CONTAINER_FWD_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 
 namespace entt {
 
+template<
+    typename Key,
+    typename Type,
+    typename = std::hash<Key>,
+    typename = std::equal_to<Key>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class concurrent_dense_map;
+
 template<
     typename Key,
     typename Type,
@@ -21,6 +30,48 @@ template<
     typename = std::allocator<Type>>
 class dense_set;
 
+template<
+    typename Key,
+    typename Type,
+    typename = std::hash<Key>,
+    typename = std::equal_to<Key>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class dense_flat_map;
+
+template<
+    typename Type,
+    typename = std::hash<Type>,
+    typename = std::equal_to<Type>,
+    typename = std::allocator<Type>>
+class dense_flat_set;
+
+template<
+    typename Key,
+    typename Type,
+    std::size_t = 8u,
+    typename = std::less<Key>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class flat_map;
+
+template<
+    typename Type,
+    std::size_t = 8u,
+    typename = std::less<Type>,
+    typename = std::allocator<Type>>
+class flat_set;
+
+template<typename, std::size_t>
+class perfect_map;
+
+template<typename Char, typename = std::allocator<Char>>
+class basic_string_pool;
+
+/*! @brief Alias declaration for the most common use case. */
+using string_pool = basic_string_pool<char>;
+
+/*! @brief Alias declaration for the most common use case. */
+using wstring_pool = basic_string_pool<wchar_t>;
+
 } // namespace entt
 
 #endif
@@ -0,0 +1,263 @@
+#ifndef ENTT_CONTAINER_PERFECT_MAP_HPP
+#define ENTT_CONTAINER_PERFECT_MAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/memory.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+[[nodiscard]] constexpr std::uint64_t perfect_hash(std::uint64_t value, const std::uint64_t seed) ENTT_NOEXCEPT {
+    value += seed * 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27u)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31u);
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Read-only map of identifiers built with a perfect hash function.
+ *
+ * The set of keys is fixed on construction and the map generates a hash
+ * function without collisions for it (_hash and displace_). Keys are first
+ * split in a handful of buckets, then each bucket gets the seed that sends all
+ * its keys to free slots. Therefore, a lookup reads the seed of a bucket and
+ * compares the key of a single element.<br/>
+ * The map can be built at compile-time when the mapped type allows it, as
+ * it's the case when keys are hashed string literals:
+ *
+ * @code{.cpp}
+ * constexpr entt::perfect_map map{std::pair{"foo"_hs, 0}, std::pair{"bar"_hs, 1}};
+ * static_assert(map.at("bar"_hs) == 1);
+ * @endcode
+ *
+ * Elements are stored in order of construction. If a key appears more than
+ * once, lookups return the first element with that key.
+ *
+ * @tparam Type Mapped type of the map.
+ * @tparam Len Number of elements of the map.
+ */
+template<typename Type, std::size_t Len>
+class perfect_map {
+    static constexpr std::size_t slot_count = next_power_of_two(Len);
+    static constexpr std::size_t bucket_count = next_power_of_two(Len / 2u + 1u);
+
+    [[nodiscard]] static constexpr std::size_t bucket(const id_type key) ENTT_NOEXCEPT {
+        return fast_mod(static_cast<std::size_t>(internal::perfect_hash(key, 0u)), bucket_count);
+    }
+
+    [[nodiscard]] static constexpr std::size_t slot(const id_type key, const std::size_t seed) ENTT_NOEXCEPT {
+        return fast_mod(static_cast<std::size_t>(internal::perfect_hash(key, seed)), slot_count);
+    }
+
+    [[nodiscard]] constexpr std::size_t owner(const std::size_t pos) const ENTT_NOEXCEPT {
+        for(std::size_t other{}; other < pos; ++other) {
+            if(elements[other].first == elements[pos].first) {
+                // duplicates don't belong to any bucket
+                return bucket_count;
+            }
+        }
+
+        return bucket(elements[pos].first);
+    }
+
+    template<typename Owner>
+    constexpr bool place(const Owner &owners, const std::size_t curr, const std::size_t seed) ENTT_NOEXCEPT {
+        for(std::size_t pos{}; pos < Len; ++pos) {
+            if(owners[pos] == curr) {
+                if(auto &elem = slots[slot(elements[pos].first, seed)]; elem == Len) {
+                    elem = pos;
+                } else {
+                    // rolls back the elements of the bucket placed so far
+                    for(std::size_t prev{}; prev < pos; ++prev) {
+                        if(owners[prev] == curr) {
+                            slots[slot(elements[prev].first, seed)] = Len;
+                        }
+                    }
+
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    constexpr void generate() ENTT_NOEXCEPT {
+        std::array<std::size_t, Len> owners{};
+        std::array<std::size_t, bucket_count + 1u> size{};
+        std::array<std::size_t, bucket_count> order{};
+
+        for(auto &&elem: slots) {
+            elem = Len;
+        }
+
+        for(std::size_t pos{}; pos < Len; ++pos) {
+            owners[pos] = owner(pos);
+            ++size[owners[pos]];
+        }
+
+        // larger buckets are the hardest to place and go first
+        for(std::size_t pos{}; pos < bucket_count; ++pos) {
+            auto next = pos;
+
+            for(; next && size[order[next - 1u]] < size[pos]; --next) {
+                order[next] = order[next - 1u];
+            }
+
+            order[next] = pos;
+        }
+
+        for(std::size_t pos{}; pos < bucket_count && size[order[pos]]; ++pos) {
+            auto &seed = displacement[order[pos]];
+            for(seed = 1u; !place(owners, order[pos], seed); ++seed) {}
+        }
+    }
+
+public:
+    /*! @brief Key type of the container. */
+    using key_type = id_type;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const id_type, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type. */
+    using const_iterator = const value_type *;
+    /*! @brief Input iterator type, elements are read-only. */
+    using iterator = const_iterator;
+
+    /**
+     * @brief Constructs a map from a list of key-value pairs.
+     * @tparam Key Types of keys, convertible to identifiers.
+     * @param elem Key-value pairs to use to initialize the map.
+     */
+    template<typename... Key, typename = std::enable_if_t<sizeof...(Key) == Len>>
+    constexpr perfect_map(std::pair<Key, Type>... elem)
+        : elements{value_type{static_cast<id_type>(elem.first), std::move(elem.second)}...},
+          displacement{},
+          slots{} {
+        generate();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     * @return An iterator to the first element of the map.
+     */
+    [[nodiscard]] constexpr const_iterator cbegin() const ENTT_NOEXCEPT {
+        return elements.data();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] constexpr const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last element of the
+     * map.
+     */
+    [[nodiscard]] constexpr const_iterator cend() const ENTT_NOEXCEPT {
+        return elements.data() + Len;
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] constexpr const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks whether a map is empty.
+     * @return True if the map is empty, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const ENTT_NOEXCEPT {
+        return (Len == 0u);
+    }
+
+    /**
+     * @brief Returns the number of elements in a map.
+     * @return Number of elements in a map.
+     */
+    [[nodiscard]] constexpr size_type size() const ENTT_NOEXCEPT {
+        return Len;
+    }
+
+    /**
+     * @brief Finds an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] constexpr const_iterator find(const key_type key) const ENTT_NOEXCEPT {
+        const auto pos = slots[slot(key, displacement[bucket(key)])];
+        return (pos != Len && elements[pos].first == key) ? (cbegin() + pos) : cend();
+    }
+
+    /**
+     * @brief Checks if a map contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] constexpr bool contains(const key_type key) const ENTT_NOEXCEPT {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    [[nodiscard]] constexpr size_type count(const key_type key) const ENTT_NOEXCEPT {
+        return contains(key);
+    }
+
+    /**
+     * @brief Accesses a given element with bounds checking.
+     * @param key A key of an element to find.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] constexpr const mapped_type &at(const key_type key) const {
+        const auto it = find(key);
+        ENTT_ASSERT(it != cend(), "Invalid key");
+        return it->second;
+    }
+
+private:
+    std::array<value_type, Len> elements;
+    std::array<std::size_t, bucket_count> displacement;
+    std::array<std::size_t, slot_count> slots;
+};
+
+/**
+ * @brief Deduction guide.
+ * @tparam Key Type of the first key.
+ * @tparam Type Mapped type of the map.
+ * @tparam Other Types of the other key-value pairs.
+ */
+template<typename Key, typename Type, typename... Other>
+perfect_map(std::pair<Key, Type>, Other...) -> perfect_map<Type, 1u + sizeof...(Other)>;
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,335 @@
+#ifndef ENTT_CONTAINER_SMALL_VECTOR_HPP
+#define ENTT_CONTAINER_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/memory.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Type, typename Func>
+[[nodiscard]] std::size_t branchless_lower_bound(const Type *first, std::size_t length, Func pred) {
+    const auto *base = first;
+
+    if(length != 0u) {
+        for(; length > 1u; length -= length / 2u) {
+            base = pred(base[length / 2u]) ? (base + length / 2u) : base;
+        }
+
+        base += pred(*base);
+    }
+
+    return static_cast<std::size_t>(base - first);
+}
+
+template<typename Type, std::size_t N, typename Allocator>
+class small_vector final {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using pointer_traits = std::pointer_traits<typename alloc_traits::pointer>;
+
+    [[nodiscard]] Type *inline_data() ENTT_NOEXCEPT {
+        return reinterpret_cast<Type *>(storage);
+    }
+
+    [[nodiscard]] bool is_inline() const ENTT_NOEXCEPT {
+        return buffer.first() == reinterpret_cast<const Type *>(storage);
+    }
+
+    void relocate(const std::size_t length) {
+        auto &allocator = buffer.second();
+        Type *other = to_address(alloc_traits::allocate(allocator, length));
+        std::size_t pos{};
+
+        ENTT_TRY {
+            for(; pos < count; ++pos) {
+                alloc_traits::construct(allocator, other + pos, std::move_if_noexcept(buffer.first()[pos]));
+            }
+        }
+        ENTT_CATCH {
+            for(; pos; --pos) {
+                alloc_traits::destroy(allocator, other + pos - 1u);
+            }
+
+            alloc_traits::deallocate(allocator, pointer_traits::pointer_to(*other), length);
+            ENTT_THROW;
+        }
+
+        for(pos = count; pos; --pos) {
+            alloc_traits::destroy(allocator, buffer.first() + pos - 1u);
+        }
+
+        release();
+        buffer.first() = other;
+        space = length;
+    }
+
+    void release() {
+        if(!is_inline()) {
+            alloc_traits::deallocate(buffer.second(), pointer_traits::pointer_to(*buffer.first()), space);
+            buffer.first() = inline_data();
+            space = N;
+        }
+    }
+
+    void steal(small_vector &other) ENTT_NOEXCEPT {
+        buffer.first() = std::exchange(other.buffer.first(), other.inline_data());
+        count = std::exchange(other.count, 0u);
+        space = std::exchange(other.space, N);
+    }
+
+public:
+    using allocator_type = Allocator;
+    using value_type = Type;
+    using size_type = std::size_t;
+
+    explicit small_vector(const allocator_type &allocator)
+        : buffer{inline_data(), allocator},
+          count{},
+          space{N} {}
+
+    small_vector(const small_vector &other)
+        : small_vector{other, alloc_traits::select_on_container_copy_construction(other.get_allocator())} {}
+
+    small_vector(const small_vector &other, const allocator_type &allocator)
+        : small_vector{allocator} {
+        reserve(other.count);
+
+        for(; count < other.count; ++count) {
+            alloc_traits::construct(buffer.second(), buffer.first() + count, std::as_const(other.buffer.first()[count]));
+        }
+    }
+
+    small_vector(small_vector &&other)
+        : small_vector{std::move(other), other.get_allocator()} {}
+
+    small_vector(small_vector &&other, const allocator_type &allocator)
+        : small_vector{allocator} {
+        if(!other.is_inline() && allocator == other.get_allocator()) {
+            steal(other);
+        } else {
+            reserve(other.count);
+
+            for(; count < other.count; ++count) {
+                alloc_traits::construct(buffer.second(), buffer.first() + count, std::move(other.buffer.first()[count]));
+            }
+
+            other.clear();
+        }
+    }
+
+    ~small_vector() {
+        clear();
+        release();
+    }
+
+    small_vector &operator=(const small_vector &other) {
+        if(this != &other) {
+            clear();
+            release();
+
+            if constexpr(alloc_traits::propagate_on_container_copy_assignment::value) {
+                buffer.second() = other.buffer.second();
+            }
+
+            reserve(other.count);
+
+            for(; count < other.count; ++count) {
+                alloc_traits::construct(buffer.second(), buffer.first() + count, std::as_const(other.buffer.first()[count]));
+            }
+        }
+
+        return *this;
+    }
+
+    small_vector &operator=(small_vector &&other) {
+        if(this != &other) {
+            clear();
+            release();
+            propagate_on_container_move_assignment(buffer.second(), other.buffer.second());
+
+            if(!other.is_inline() && buffer.second() == other.buffer.second()) {
+                steal(other);
+            } else {
+                reserve(other.count);
+
+                for(; count < other.count; ++count) {
+                    alloc_traits::construct(buffer.second(), buffer.first() + count, std::move(other.buffer.first()[count]));
+                }
+
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return buffer.second();
+    }
+
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return space;
+    }
+
+    [[nodiscard]] size_type max_size() const ENTT_NOEXCEPT {
+        return alloc_traits::max_size(buffer.second());
+    }
+
+    [[nodiscard]] Type *data() ENTT_NOEXCEPT {
+        return buffer.first();
+    }
+
+    [[nodiscard]] const Type *data() const ENTT_NOEXCEPT {
+        return buffer.first();
+    }
+
+    [[nodiscard]] Type &operator[](const size_type pos) ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < count, "Index out of bounds");
+        return buffer.first()[pos];
+    }
+
+    [[nodiscard]] const Type &operator[](const size_type pos) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < count, "Index out of bounds");
+        return buffer.first()[pos];
+    }
+
+    void reserve(const size_type length) {
+        if(length > space) {
+            relocate(length);
+        }
+    }
+
+    void shrink_to_fit() {
+        if(!is_inline() && count < space) {
+            if(count <= N) {
+                auto *other = buffer.first();
+
+                for(size_type pos{}; pos < count; ++pos) {
+                    alloc_traits::construct(buffer.second(), inline_data() + pos, std::move(other[pos]));
+                    alloc_traits::destroy(buffer.second(), other + pos);
+                }
+
+                alloc_traits::deallocate(buffer.second(), pointer_traits::pointer_to(*other), space);
+                buffer.first() = inline_data();
+                space = N;
+            } else {
+                relocate(count);
+            }
+        }
+    }
+
+    template<typename... Args>
+    Type &emplace_back(Args &&...args) {
+        if(count == space) {
+            auto &allocator = buffer.second();
+            const auto length = (space == 0u) ? 1u : (space * 2u);
+            Type *other = to_address(alloc_traits::allocate(allocator, length));
+            bool created = false;
+            size_type pos{};
+
+            ENTT_TRY {
+                // constructs the element first, arguments can refer to elements of the vector
+                alloc_traits::construct(allocator, other + count, std::forward<Args>(args)...);
+                created = true;
+
+                for(; pos < count; ++pos) {
+                    alloc_traits::construct(allocator, other + pos, std::move_if_noexcept(buffer.first()[pos]));
+                }
+            }
+            ENTT_CATCH {
+                for(; pos; --pos) {
+                    alloc_traits::destroy(allocator, other + pos - 1u);
+                }
+
+                if(created) {
+                    alloc_traits::destroy(allocator, other + count);
+                }
+
+                alloc_traits::deallocate(allocator, pointer_traits::pointer_to(*other), length);
+                ENTT_THROW;
+            }
+
+            for(pos = count; pos; --pos) {
+                alloc_traits::destroy(allocator, buffer.first() + pos - 1u);
+            }
+
+            release();
+            buffer.first() = other;
+            space = length;
+        } else {
+            alloc_traits::construct(buffer.second(), buffer.first() + count, std::forward<Args>(args)...);
+        }
+
+        return buffer.first()[count++];
+    }
+
+    void pop_back() {
+        ENTT_ASSERT(count != 0u, "Empty vector");
+        alloc_traits::destroy(buffer.second(), buffer.first() + --count);
+    }
+
+    void erase(const size_type pos, const size_type length = 1u) {
+        ENTT_ASSERT(pos + length <= count, "Index out of bounds");
+        std::move(buffer.first() + pos + length, buffer.first() + count, buffer.first() + pos);
+
+        for(size_type next{}; next < length; ++next) {
+            pop_back();
+        }
+    }
+
+    void clear() {
+        while(count) {
+            pop_back();
+        }
+    }
+
+    void swap(small_vector &other) {
+        ENTT_ASSERT(alloc_traits::propagate_on_container_swap::value || buffer.second() == other.buffer.second(), "Cannot swap the containers");
+
+        if(!is_inline() && !other.is_inline()) {
+            using std::swap;
+            propagate_on_container_swap(buffer.second(), other.buffer.second());
+            swap(buffer.first(), other.buffer.first());
+            swap(count, other.count);
+            swap(space, other.space);
+        } else {
+            small_vector temp{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+    }
+
+private:
+    compressed_pair<Type *, allocator_type> buffer;
+    size_type count;
+    size_type space;
+    alignas(Type) std::byte storage[sizeof(Type) * (N == 0u ? 1u : N)];
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+} // namespace entt
+
+#endif
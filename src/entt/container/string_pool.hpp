@@ -0,0 +1,298 @@
+#ifndef ENTT_CONTAINER_STRING_POOL_HPP
+#define ENTT_CONTAINER_STRING_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/hashed_string.hpp"
+#include "../core/memory.hpp"
+#include "../core/utility.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Pool of interned strings with reverse lookup.
+ *
+ * Strings are copied once into blocks of contiguous memory and are never moved
+ * around nor released until the pool is cleared or destroyed. Therefore, the
+ * hashed strings returned by the pool are stable and the text of an identifier
+ * can be retrieved at any time.<br/>
+ * Identifiers are the same of the `hashed_string` class, so that interned
+ * strings and user defined literals can be used interchangeably.
+ *
+ * Two different strings that produce the same identifier are detected at
+ * insertion time. The pool never replaces an interned string.
+ *
+ * @tparam Char Character type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Char, typename Allocator>
+class basic_string_pool {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Char>, "Invalid value type");
+    using block_type = std::pair<typename alloc_traits::pointer, std::size_t>;
+    using block_container_type = std::vector<block_type, typename alloc_traits::template rebind_alloc<block_type>>;
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Character type. */
+    using value_type = Char;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Hashed string type returned by the pool. */
+    using hashed_string_type = basic_hashed_string<Char>;
+    /*! @brief Underlying identifier type. */
+    using hash_type = typename hashed_string_type::hash_type;
+
+private:
+    using index_type = dense_map<hash_type, hashed_string_type, identity, std::equal_to<hash_type>, typename alloc_traits::template rebind_alloc<std::pair<const hash_type, hashed_string_type>>>;
+
+    [[nodiscard]] Char *acquire(const size_type len) {
+        // room for the null terminator, interned strings are also c-strings
+        const auto length = len + 1u;
+
+        if(length > block_size) {
+            const auto ptr = alloc_traits::allocate(allocator, length);
+
+            ENTT_TRY {
+                if(blocks.empty()) {
+                    blocks.emplace_back(ptr, length);
+                    offset = length;
+                } else {
+                    // dedicated blocks go before the current one, so as to keep filling it
+                    blocks.emplace(blocks.end() - 1u, ptr, length);
+                }
+            }
+            ENTT_CATCH {
+                alloc_traits::deallocate(allocator, ptr, length);
+                ENTT_THROW;
+            }
+
+            return to_address(ptr);
+        }
+
+        if(blocks.empty() || (blocks.back().second - offset) < length) {
+            const auto ptr = alloc_traits::allocate(allocator, block_size);
+
+            ENTT_TRY {
+                blocks.emplace_back(ptr, block_size);
+            }
+            ENTT_CATCH {
+                alloc_traits::deallocate(allocator, ptr, block_size);
+                ENTT_THROW;
+            }
+
+            offset = 0u;
+        }
+
+        Char *elem = to_address(blocks.back().first) + offset;
+        offset += length;
+        return elem;
+    }
+
+    void release() {
+        for(auto &&block: blocks) {
+            alloc_traits::deallocate(allocator, block.first, block.second);
+        }
+
+        blocks.clear();
+        offset = 0u;
+    }
+
+public:
+    /*! @brief Default constructor. */
+    basic_string_pool()
+        : basic_string_pool{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty pool with a given allocator.
+     * @param alloc The allocator to use.
+     */
+    explicit basic_string_pool(const allocator_type &alloc)
+        : basic_string_pool{4096u, alloc} {}
+
+    /**
+     * @brief Constructs an empty pool with a given block size and allocator.
+     * @param size Number of characters per block of memory.
+     * @param alloc The allocator to use.
+     */
+    explicit basic_string_pool(const size_type size, const allocator_type &alloc = allocator_type{})
+        : allocator{alloc},
+          index{alloc},
+          blocks{alloc},
+          block_size{size},
+          offset{} {}
+
+    /*! @brief Copying a string pool isn't allowed. */
+    basic_string_pool(const basic_string_pool &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_string_pool(basic_string_pool &&other) ENTT_NOEXCEPT
+        : allocator{other.allocator},
+          index{std::move(other.index)},
+          blocks{std::move(other.blocks)},
+          block_size{other.block_size},
+          offset{std::exchange(other.offset, 0u)} {
+        other.blocks.clear();
+        other.index.clear();
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_string_pool() {
+        release();
+    }
+
+    /**
+     * @brief Copying a string pool isn't allowed.
+     * @return This pool.
+     */
+    basic_string_pool &operator=(const basic_string_pool &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This pool.
+     */
+    basic_string_pool &operator=(basic_string_pool &&other) ENTT_NOEXCEPT {
+        ENTT_ASSERT(alloc_traits::propagate_on_container_move_assignment::value || get_allocator() == other.get_allocator(), "Cannot move the pool");
+
+        if(this != &other) {
+            clear();
+            propagate_on_container_move_assignment(allocator, other.allocator);
+            index = std::move(other.index);
+            blocks = std::move(other.blocks);
+            block_size = other.block_size;
+            offset = std::exchange(other.offset, 0u);
+            other.blocks.clear();
+            other.index.clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator;
+    }
+
+    /**
+     * @brief Interns a string, if not already in the pool.
+     *
+     * The boolean value is false only if a different string with the same
+     * identifier is already in the pool. In this case, the hashed string
+     * returned refers to the string that is already in the pool.
+     *
+     * @param str Human-readable identifier.
+     * @param len Length of the string to intern.
+     * @return A pair consisting of the interned hashed string and a bool
+     * denoting whether the string is usable as such.
+     */
+    std::pair<hashed_string_type, bool> insert(const value_type *str, const size_type len) {
+        const hashed_string_type hs{str, len};
+
+        if(const auto it = index.find(hs.value()); it != index.end()) {
+            const auto &other = it->second;
+            return {other, std::basic_string_view<Char>{other.data(), other.size()} == std::basic_string_view<Char>{str, len}};
+        }
+
+        Char *elem = acquire(len);
+        std::copy(str, str + len, elem);
+        elem[len] = Char{};
+
+        return {index.emplace(hs.value(), hashed_string_type{elem, len}).first->second, true};
+    }
+
+    /**
+     * @brief Interns a string, if not already in the pool.
+     * @param str Human-readable identifier.
+     * @return A pair consisting of the interned hashed string and a bool
+     * denoting whether the string is usable as such.
+     */
+    std::pair<hashed_string_type, bool> insert(const std::basic_string_view<Char> str) {
+        return insert(str.data(), str.size());
+    }
+
+    /**
+     * @brief Checks if the pool contains a string with a given identifier.
+     * @param id Identifier of the string to search for.
+     * @return True if there is such a string, false otherwise.
+     */
+    [[nodiscard]] bool contains(const hash_type id) const {
+        return index.contains(id);
+    }
+
+    /**
+     * @brief Returns the string associated with a given identifier.
+     *
+     * @warning
+     * Attempting to get a string that isn't in the pool results in undefined
+     * behavior.
+     *
+     * @param id Identifier of the string to search for.
+     * @return The interned hashed string with the given identifier.
+     */
+    [[nodiscard]] hashed_string_type at(const hash_type id) const {
+        return index.at(id);
+    }
+
+    /**
+     * @brief Returns the number of strings in the pool.
+     * @return Number of strings in the pool.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return index.size();
+    }
+
+    /**
+     * @brief Checks whether the pool is empty.
+     * @return True if the pool is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return index.empty();
+    }
+
+    /**
+     * @brief Reserves space for at least the specified number of strings.
+     * @param cnt New number of strings.
+     */
+    void reserve(const size_type cnt) {
+        index.reserve(cnt);
+    }
+
+    /**
+     * @brief Clears the pool.
+     *
+     * @warning
+     * All hashed strings returned by the pool are invalidated.
+     */
+    void clear() {
+        index.clear();
+        release();
+    }
+
+private:
+    allocator_type allocator;
+    index_type index;
+    block_container_type blocks;
+    size_type block_size;
+    size_type offset;
+};
+
+} // namespace entt
+
+#endif
@@ -2,8 +2,10 @@
 #define ENTT_CORE_ALGORITHM_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <thread>
 #include <utility>
 #include <vector>
 #include "utility.hpp"
@@ -68,6 +70,67 @@ struct insertion_sort {
     }
 };
 
+/**
+ * @brief Function object for performing a parallel merge sort.
+ *
+ * The range is split recursively into as many chunks as workers. Chunks are
+ * sorted on their own threads with `std::sort`, then merged pairwise while
+ * unwinding the recursion. The calling thread takes part in the work.
+ *
+ * @warning
+ * The comparison function object is invoked concurrently from multiple threads
+ * and is expected not to throw.
+ */
+struct parallel_sort {
+    /*! @brief Default constructor, one worker per hardware thread. */
+    parallel_sort()
+        : parallel_sort{std::thread::hardware_concurrency()} {}
+
+    /**
+     * @brief Constructs a sort function object with a given number of workers.
+     * @param count Number of workers, the calling thread included.
+     */
+    explicit parallel_sort(const std::size_t count)
+        : workers{(std::max)(count, std::size_t{1u})} {}
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given binary comparison function.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Compare Type of comparison function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     */
+    template<typename It, typename Compare = std::less<>>
+    void operator()(It first, It last, Compare compare = Compare{}) const {
+        if(first < last) {
+            split(std::move(first), std::move(last), compare, workers);
+        }
+    }
+
+private:
+    template<typename It, typename Compare>
+    static void split(It first, It last, const Compare &compare, const std::size_t count) {
+        static constexpr auto threshold = 2048;
+
+        if(count == 1u || (last - first) < threshold) {
+            std::sort(first, last, compare);
+        } else {
+            const auto other = count / 2u;
+            const auto middle = first + (last - first) * static_cast<typename std::iterator_traits<It>::difference_type>(other) / static_cast<typename std::iterator_traits<It>::difference_type>(count);
+            std::thread worker{[first, middle, &compare, other]() { split(first, middle, compare, other); }};
+            split(middle, last, compare, count - other);
+            worker.join();
+            std::inplace_merge(first, middle, last, compare);
+        }
+    }
+
+    std::size_t workers;
+};
+
 /**
  * @brief Function object for performing LSD radix sort.
  * @tparam Bit Number of bits processed per pass.
@@ -94,38 +157,79 @@ struct radix_sort {
      */
     template<typename It, typename Getter = identity>
     void operator()(It first, It last, Getter getter = Getter{}) const {
+        if(first < last) {
+            std::vector<typename std::iterator_traits<It>::value_type> aux{};
+            (*this)(std::move(first), std::move(last), std::move(getter), aux);
+        }
+    }
+
+    /**
+     * @brief Sorts the elements in a range using a scratch buffer.
+     *
+     * The buffer is resized as needed and its contents are left in an
+     * unspecified state. Reusing it from call to call spares an allocation
+     * each time a range is sorted.<br/>
+     * The histograms of all passes are computed with a single sweep over the
+     * range and passes that wouldn't move any element are skipped.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Allocator Type of allocator of the scratch buffer.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param aux A scratch buffer to use during sorting.
+     */
+    template<typename It, typename Getter, typename Allocator>
+    void operator()(It first, It last, Getter getter, std::vector<typename std::iterator_traits<It>::value_type, Allocator> &aux) const {
         if(first < last) {
             static constexpr auto mask = (1 << Bit) - 1;
             static constexpr auto buckets = 1 << Bit;
             static constexpr auto passes = N / Bit;
 
-            using value_type = typename std::iterator_traits<It>::value_type;
-            std::vector<value_type> aux(std::distance(first, last));
+            const auto length = static_cast<std::size_t>(std::distance(first, last));
+            std::size_t index[passes][buckets]{};
+            bool skip[passes]{};
 
-            auto part = [getter = std::move(getter)](auto from, auto to, auto out, auto start) {
-                std::size_t index[buckets]{};
-                std::size_t count[buckets]{};
+            aux.resize(length);
 
-                for(auto it = from; it != to; ++it) {
-                    ++count[(getter(*it) >> start) & mask];
+            for(auto it = first; it != last; ++it) {
+                const auto value = getter(*it);
+
+                for(std::size_t pass{}; pass < passes; ++pass) {
+                    ++index[pass][(value >> (pass * Bit)) & mask];
                 }
+            }
 
-                for(std::size_t pos{}, end = buckets - 1u; pos < end; ++pos) {
-                    index[pos + 1u] = index[pos] + count[pos];
+            for(std::size_t pass{}; pass < passes; ++pass) {
+                for(std::size_t pos{}, offset{}; pos < buckets; ++pos) {
+                    // all elements in the same bucket means that the pass is a no-op
+                    skip[pass] = skip[pass] || (index[pass][pos] == length);
+                    offset += std::exchange(index[pass][pos], offset);
                 }
+            }
 
+            auto part = [&index, &getter](auto from, auto to, auto out, const std::size_t pass) {
                 for(auto it = from; it != to; ++it) {
-                    out[index[(getter(*it) >> start) & mask]++] = std::move(*it);
+                    out[index[pass][(getter(*it) >> (pass * Bit)) & mask]++] = std::move(*it);
                 }
             };
 
-            for(std::size_t pass = 0; pass < (passes & ~1); pass += 2) {
-                part(first, last, aux.begin(), pass * Bit);
-                part(aux.begin(), aux.end(), first, (pass + 1) * Bit);
+            bool swapped = false;
+
+            for(std::size_t pass{}; pass < passes; ++pass) {
+                if(!skip[pass]) {
+                    if(swapped) {
+                        part(aux.begin(), aux.end(), first, pass);
+                    } else {
+                        part(first, last, aux.begin(), pass);
+                    }
+
+                    swapped = !swapped;
+                }
             }
 
-            if constexpr(passes & 1) {
-                part(first, last, aux.begin(), (passes - 1) * Bit);
+            if(swapped) {
                 std::move(aux.begin(), aux.end(), first);
             }
         }
@@ -2,17 +2,51 @@
 #define ENTT_CORE_ANY_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
 #include "../core/utility.hpp"
 #include "fwd.hpp"
+#include "memory.hpp"
 #include "type_info.hpp"
 #include "type_traits.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Type, typename Allocator>
+struct basic_any_node {
+    template<typename... Args>
+    basic_any_node(std::false_type, const Allocator &alloc, Args &&...args)
+        : allocator{alloc},
+          value(std::forward<Args>(args)...) {}
+
+    template<typename... Args>
+    basic_any_node(std::true_type, const Allocator &alloc, Args &&...args)
+        : allocator{alloc},
+          value{std::forward<Args>(args)...} {}
+
+    Allocator allocator;
+    Type value;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief A SBO friendly, type-safe container for single values of any type.
  * @tparam Len Size of the storage reserved for the small buffer optimization.
@@ -42,20 +76,34 @@ class basic_any {
     template<typename Type>
     static constexpr bool in_situ = Len && alignof(Type) <= alignof(storage_type) && sizeof(Type) <= sizeof(storage_type) && std::is_nothrow_move_constructible_v<Type>;
 
-    template<typename Type>
+    template<typename Type, typename Allocator>
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<internal::basic_any_node<Type, Allocator>>;
+
+    template<typename Type, typename Allocator = void>
     static const void *basic_vtable([[maybe_unused]] const operation op, [[maybe_unused]] const basic_any &value, [[maybe_unused]] const void *other) {
         static_assert(!std::is_same_v<Type, void> && std::is_same_v<std::remove_reference_t<std::remove_const_t<Type>>, Type>, "Invalid type");
         const Type *element = nullptr;
 
         if constexpr(in_situ<Type>) {
             element = value.owner() ? reinterpret_cast<const Type *>(&value.storage) : static_cast<const Type *>(value.instance);
-        } else {
+        } else if constexpr(std::is_void_v<Allocator>) {
             element = static_cast<const Type *>(value.instance);
+        } else {
+            // wrappers for references point directly to the element rather than to the node
+            element = (value.owner() && value.instance) ? &static_cast<const internal::basic_any_node<Type, Allocator> *>(value.instance)->value : static_cast<const Type *>(value.instance);
         }
 
         switch(op) {
         case operation::copy:
             if constexpr(std::is_copy_constructible_v<Type>) {
+                if constexpr(!std::is_void_v<Allocator>) {
+                    if(value.owner()) {
+                        const auto &allocator = static_cast<const internal::basic_any_node<Type, Allocator> *>(value.instance)->allocator;
+                        static_cast<basic_any *>(const_cast<void *>(other))->allocate<Type>(std::allocator_traits<Allocator>::select_on_container_copy_construction(allocator), *element);
+                        break;
+                    }
+                }
+
                 static_cast<basic_any *>(const_cast<void *>(other))->initialize<Type>(*element);
             }
             break;
@@ -82,6 +130,15 @@ class basic_any {
         case operation::destroy:
             if constexpr(in_situ<Type>) {
                 element->~Type();
+            } else if constexpr(!std::is_void_v<Allocator>) {
+                using node_type = internal::basic_any_node<Type, Allocator>;
+                using node_traits = std::allocator_traits<node_allocator<Type, Allocator>>;
+                // moved-from wrappers still have a vtable but no longer own a node
+                if(auto *node = static_cast<node_type *>(const_cast<void *>(value.instance)); node) {
+                    node_allocator<Type, Allocator> allocator{node->allocator};
+                    node_traits::destroy(allocator, node);
+                    node_traits::deallocate(allocator, std::pointer_traits<typename node_traits::pointer>::pointer_to(*node), 1u);
+                }
             } else if constexpr(std::is_array_v<Type>) {
                 delete[] element;
             } else {
@@ -112,6 +169,10 @@ class basic_any {
                 mode = std::is_const_v<std::remove_reference_t<Type>> ? policy::cref : policy::ref;
                 instance = (std::addressof(args), ...);
             } else if constexpr(in_situ<Type>) {
+                if constexpr(std::is_trivially_copyable_v<Type> && std::is_copy_constructible_v<Type> && sizeof(Type) <= std::numeric_limits<std::uint16_t>::max()) {
+                    trivial = static_cast<std::uint16_t>(sizeof(Type));
+                }
+
                 if constexpr(sizeof...(Args) != 0u && std::is_aggregate_v<Type>) {
                     new(&storage) Type{std::forward<Args>(args)...};
                 } else {
@@ -127,11 +188,47 @@ class basic_any {
         }
     }
 
+    template<typename Type, typename Allocator, typename... Args>
+    void allocate(const Allocator &allocator, Args &&...args) {
+        if constexpr(std::is_void_v<Type> || std::is_lvalue_reference_v<Type> || in_situ<Type>) {
+            initialize<Type>(std::forward<Args>(args)...);
+        } else {
+            using object_type = std::remove_const_t<Type>;
+            static_assert(!std::is_array_v<object_type>, "Invalid type");
+            using alloc_type = typename std::allocator_traits<Allocator>::template rebind_alloc<object_type>;
+            using node_traits = std::allocator_traits<node_allocator<object_type, alloc_type>>;
+            node_allocator<object_type, alloc_type> node_alloc{allocator};
+            auto *node = to_address(node_traits::allocate(node_alloc, 1u));
+
+            ENTT_TRY {
+                node_traits::construct(node_alloc, node, std::bool_constant<sizeof...(Args) != 0u && std::is_aggregate_v<object_type>>{}, alloc_type{allocator}, std::forward<Args>(args)...);
+            }
+            ENTT_CATCH {
+                node_traits::deallocate(node_alloc, std::pointer_traits<typename node_traits::pointer>::pointer_to(*node), 1u);
+                ENTT_THROW;
+            }
+
+            vtable = basic_vtable<object_type, alloc_type>;
+            info = &type_id<Type>();
+            instance = node;
+        }
+    }
+
     basic_any(const basic_any &other, const policy pol) ENTT_NOEXCEPT
         : instance{other.data()},
           info{other.info},
           vtable{other.vtable},
-          mode{pol} {}
+          mode{pol},
+          trivial{} {}
+
+    void bitwise_copy(const basic_any &other) ENTT_NOEXCEPT {
+        // trivially copyable objects in the internal storage don't go through the vtable
+        std::memcpy(&storage, &other.storage, other.trivial);
+        info = other.info;
+        vtable = other.vtable;
+        mode = other.mode;
+        trivial = other.trivial;
+    }
 
 public:
     /*! @brief Size of the internal storage. */
@@ -144,7 +241,8 @@ public:
         : instance{},
           info{&type_id<void>()},
           vtable{},
-          mode{policy::owner} {}
+          mode{policy::owner},
+          trivial{} {}
 
     /**
      * @brief Constructs a wrapper by directly initializing the new object.
@@ -158,6 +256,25 @@ public:
         initialize<Type>(std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Constructs a wrapper by directly initializing the new object and
+     * using a given allocator for it, if required.
+     *
+     * The allocator is only used for objects that don't fit the internal
+     * storage. In this case, it's also used for all copies of the wrapper.
+     *
+     * @tparam Allocator Type of allocator used to manage the object.
+     * @tparam Type Type of object to use to initialize the wrapper.
+     * @tparam Args Types of arguments to use to construct the new instance.
+     * @param allocator The allocator to use.
+     * @param args Parameters to use to construct the instance.
+     */
+    template<typename Allocator, typename Type, typename... Args>
+    basic_any(std::allocator_arg_t, const Allocator &allocator, std::in_place_type_t<Type>, Args &&...args)
+        : basic_any{} {
+        allocate<Type>(allocator, std::forward<Args>(args)...);
+    }
+
     /**
      * @brief Constructs a wrapper from a given value.
      * @tparam Type Type of object to use to initialize the wrapper.
@@ -175,7 +292,9 @@ public:
      */
     basic_any(const basic_any &other)
         : basic_any{} {
-        if(other.vtable) {
+        if(other.trivial) {
+            bitwise_copy(other);
+        } else if(other.vtable) {
             other.vtable(operation::copy, other, this);
         }
     }
@@ -188,15 +307,18 @@ public:
         : instance{},
           info{other.info},
           vtable{other.vtable},
-          mode{other.mode} {
-        if(other.vtable) {
+          mode{other.mode},
+          trivial{other.trivial} {
+        if(trivial) {
+            std::memcpy(&storage, &other.storage, trivial);
+        } else if(other.vtable) {
             other.vtable(operation::move, other, this);
         }
     }
 
     /*! @brief Frees the internal storage, whatever it means. */
     ~basic_any() {
-        if(vtable && owner()) {
+        if(vtable && owner() && !trivial) {
             vtable(operation::destroy, *this, nullptr);
         }
     }
@@ -209,7 +331,9 @@ public:
     basic_any &operator=(const basic_any &other) {
         reset();
 
-        if(other.vtable) {
+        if(other.trivial) {
+            bitwise_copy(other);
+        } else if(other.vtable) {
             other.vtable(operation::copy, other, this);
         }
 
@@ -224,7 +348,9 @@ public:
     basic_any &operator=(basic_any &&other) ENTT_NOEXCEPT {
         reset();
 
-        if(other.vtable) {
+        if(other.trivial) {
+            bitwise_copy(other);
+        } else if(other.vtable) {
             other.vtable(operation::move, other, this);
             info = other.info;
             vtable = other.vtable;
@@ -306,7 +432,7 @@ public:
      * @param other The value to assign to the contained object.
      * @return True in case of success, false otherwise.
      */
-    bool assign(const any &other) {
+    bool assign(const basic_any &other) {
         if(vtable && mode != policy::cref && *info == *other.info) {
             return (vtable(operation::assign, *this, other.data()) != nullptr);
         }
@@ -315,7 +441,7 @@ public:
     }
 
     /*! @copydoc assign */
-    bool assign(any &&other) {
+    bool assign(basic_any &&other) {
         if(vtable && mode != policy::cref && *info == *other.info) {
             if(auto *val = other.data(); val) {
                 return (vtable(operation::transfer, *this, val) != nullptr);
@@ -329,13 +455,14 @@ public:
 
     /*! @brief Destroys contained object */
     void reset() {
-        if(vtable && owner()) {
+        if(vtable && owner() && !trivial) {
             vtable(operation::destroy, *this, nullptr);
         }
 
         info = &type_id<void>();
         vtable = nullptr;
         mode = policy::owner;
+        trivial = 0u;
     }
 
     /**
@@ -388,6 +515,7 @@ private:
     const type_info *info;
     vtable_type *vtable;
     policy mode;
+    std::uint16_t trivial;
 };
 
 /**
@@ -472,6 +600,23 @@ basic_any<Len, Align> make_any(Args &&...args) {
     return basic_any<Len, Align>{std::in_place_type<Type>, std::forward<Args>(args)...};
 }
 
+/**
+ * @brief Constructs a wrapper from a given type, passing it all arguments and
+ * using a given allocator for the object, if required.
+ * @tparam Type Type of object to use to initialize the wrapper.
+ * @tparam Len Size of the storage reserved for the small buffer optimization.
+ * @tparam Align Optional alignment requirement.
+ * @tparam Allocator Type of allocator used to manage the object.
+ * @tparam Args Types of arguments to use to construct the new instance.
+ * @param allocator The allocator to use.
+ * @param args Parameters to use to construct the instance.
+ * @return A properly initialized wrapper for an object of the given type.
+ */
+template<typename Type, std::size_t Len = basic_any<>::length, std::size_t Align = basic_any<Len>::alignment, typename Allocator, typename... Args>
+basic_any<Len, Align> allocate_any(const Allocator &allocator, Args &&...args) {
+    return basic_any<Len, Align>{std::allocator_arg, allocator, std::in_place_type<Type>, std::forward<Args>(args)...};
+}
+
 /**
  * @brief Forwards its argument and avoids copies for lvalue references.
  * @tparam Len Size of the storage reserved for the small buffer optimization.
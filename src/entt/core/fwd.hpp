@@ -7,7 +7,7 @@
 
 namespace entt {
 
-template<std::size_t Len = sizeof(double[2]), std::size_t = alignof(typename std::aligned_storage_t<Len + !Len>)>
+template<std::size_t Len = ENTT_ANY_SIZE, std::size_t = alignof(typename std::aligned_storage_t<Len + !Len>)>
 class basic_any;
 
 /*! @brief Alias declaration for type identifiers. */
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 #include "../config/config.h"
 #include "fwd.hpp"
 
@@ -32,6 +33,88 @@ struct fnv1a_traits<std::uint64_t> {
     static constexpr std::uint64_t prime = 1099511628211ull;
 };
 
+struct xxh64_traits {
+    static constexpr std::uint64_t prime1 = 11400714785074694791ull;
+    static constexpr std::uint64_t prime2 = 14029467366897019727ull;
+    static constexpr std::uint64_t prime3 = 1609587929392839161ull;
+    static constexpr std::uint64_t prime4 = 9650029242287828579ull;
+    static constexpr std::uint64_t prime5 = 2870177450012600261ull;
+
+    [[nodiscard]] static constexpr std::uint64_t rotl(const std::uint64_t value, const int bits) ENTT_NOEXCEPT {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t round(const std::uint64_t acc, const std::uint64_t input) ENTT_NOEXCEPT {
+        return rotl(acc + input * prime2, 31) * prime1;
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t merge(const std::uint64_t acc, const std::uint64_t value) ENTT_NOEXCEPT {
+        return (acc ^ round(0u, value)) * prime1 + prime4;
+    }
+
+    // little-endian loads regardless of the platform, compilers turn them into plain loads
+    template<std::size_t Len>
+    [[nodiscard]] static std::uint64_t read(const unsigned char *data) ENTT_NOEXCEPT {
+        std::uint64_t value{};
+
+        for(std::size_t pos{}; pos < Len; ++pos) {
+            value |= static_cast<std::uint64_t>(data[pos]) << (pos * 8u);
+        }
+
+        return value;
+    }
+};
+
+// xxHash (XXH64), bit-compatible with the reference implementation
+[[nodiscard]] inline std::uint64_t xxh64(const unsigned char *data, const std::size_t len, const std::uint64_t seed) ENTT_NOEXCEPT {
+    using traits = xxh64_traits;
+    const auto *last = data + len;
+    std::uint64_t hash{};
+
+    if(len >= 32u) {
+        // four independent lanes, so that the multiplications overlap
+        std::uint64_t lane[4u]{seed + traits::prime1 + traits::prime2, seed + traits::prime2, seed, seed - traits::prime1};
+
+        for(; (last - data) >= 32; data += 32u) {
+            lane[0u] = traits::round(lane[0u], traits::read<8u>(data));
+            lane[1u] = traits::round(lane[1u], traits::read<8u>(data + 8u));
+            lane[2u] = traits::round(lane[2u], traits::read<8u>(data + 16u));
+            lane[3u] = traits::round(lane[3u], traits::read<8u>(data + 24u));
+        }
+
+        hash = traits::rotl(lane[0u], 1) + traits::rotl(lane[1u], 7) + traits::rotl(lane[2u], 12) + traits::rotl(lane[3u], 18);
+
+        for(auto value: lane) {
+            hash = traits::merge(hash, value);
+        }
+    } else {
+        hash = seed + traits::prime5;
+    }
+
+    hash += len;
+
+    for(; (last - data) >= 8; data += 8u) {
+        hash = traits::rotl(hash ^ traits::round(0u, traits::read<8u>(data)), 27) * traits::prime1 + traits::prime4;
+    }
+
+    if((last - data) >= 4) {
+        hash = traits::rotl(hash ^ (traits::read<4u>(data) * traits::prime1), 23) * traits::prime2 + traits::prime3;
+        data += 4u;
+    }
+
+    for(; data != last; ++data) {
+        hash = traits::rotl(hash ^ (*data * traits::prime5), 11) * traits::prime1;
+    }
+
+    hash ^= hash >> 33u;
+    hash *= traits::prime2;
+    hash ^= hash >> 29u;
+    hash *= traits::prime3;
+    hash ^= hash >> 32u;
+
+    return hash;
+}
+
 template<typename Char>
 struct basic_hashed_string {
     using value_type = Char;
@@ -300,6 +383,60 @@ template<typename Char>
     return !(lhs < rhs);
 }
 
+/**
+ * @brief Runtime only hash function for strings.
+ *
+ * Hashed strings rely on FNV-1a, that processes one character at a time and
+ * where each step depends on the previous one. This function object relies on
+ * XXH64 instead, that processes long strings several bytes at a time and is
+ * therefore much faster on them.<br/>
+ * It can also be used as a hash function for containers with string keys.
+ *
+ * @warning
+ * The values returned differ from those of the hashed strings for the same
+ * input. Identifiers generated in one way must never be compared with those
+ * generated in the other way.
+ *
+ * @tparam Char Character type.
+ */
+template<typename Char>
+struct basic_runtime_hash {
+    /*! @brief Character type. */
+    using value_type = Char;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Unsigned integer type. */
+    using hash_type = id_type;
+    /*! @brief Strings of any kind can be hashed without conversions. */
+    using is_transparent = void;
+
+    /**
+     * @brief Returns the numeric representation of a string.
+     * @param str Human-readable identifier.
+     * @param len Length of the string to hash.
+     * @param seed Optional seed for the hash function.
+     * @return The numeric representation of the string.
+     */
+    [[nodiscard]] hash_type operator()(const value_type *str, const size_type len, const std::uint64_t seed = 0u) const ENTT_NOEXCEPT {
+        return static_cast<hash_type>(internal::xxh64(reinterpret_cast<const unsigned char *>(str), len * sizeof(value_type), seed));
+    }
+
+    /**
+     * @brief Returns the numeric representation of a string.
+     * @param str Human-readable identifier.
+     * @return The numeric representation of the string.
+     */
+    [[nodiscard]] hash_type operator()(const std::basic_string_view<value_type> str) const ENTT_NOEXCEPT {
+        return operator()(str.data(), str.size());
+    }
+};
+
+/*! @brief Aliases for common character types. */
+using runtime_hash = basic_runtime_hash<char>;
+
+/*! @brief Aliases for common character types. */
+using runtime_whash = basic_runtime_hash<wchar_t>;
+
 /*! @brief Aliases for common character types. */
 using hashed_string = basic_hashed_string<char>;
 
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -104,6 +105,184 @@ constexpr void propagate_on_container_swap([[maybe_unused]] Allocator &lhs, [[ma
     return value & (mod - 1u);
 }
 
+/**
+ * @brief Computes the number of elements per page for a given page size.
+ * @param size The size of the elements, in bytes.
+ * @param bytes The size of the pages, in bytes.
+ * @return The largest power of two of elements that fit the page, at least 1.
+ */
+[[nodiscard]] inline constexpr std::size_t elements_per_page(const std::size_t size, const std::size_t bytes) ENTT_NOEXCEPT {
+    std::size_t count = 1u;
+
+    for(; (count * 2u * size) <= bytes; count *= 2u) {}
+
+    return count;
+}
+
+/**
+ * @brief Allocator that prefers huge pages for large blocks of memory.
+ *
+ * Blocks of at least `huge_page_size` bytes are aligned to a huge page
+ * boundary and passed to `ENTT_HUGE_PAGE_ADVICE`, so that the operating system
+ * can back them with transparent huge pages. Smaller blocks are allocated as
+ * usual.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+struct huge_page_allocator {
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Allocators of this type always compare equal. */
+    using is_always_equal = std::true_type;
+
+    /*! @brief Size of huge pages, in bytes. */
+    static constexpr std::size_t huge_page_size = std::size_t{1u} << 21u;
+
+    /*! @brief Default constructor. */
+    constexpr huge_page_allocator() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of objects allocated by the other allocator.
+     */
+    template<typename Other>
+    constexpr huge_page_allocator(const huge_page_allocator<Other> &) ENTT_NOEXCEPT {}
+
+    /**
+     * @brief Allocates storage for a number of objects.
+     * @param count Number of objects to allocate storage for.
+     * @return A pointer to the beginning of the allocated storage.
+     */
+    [[nodiscard]] value_type *allocate(const std::size_t count) {
+        ENTT_ASSERT(count <= (std::numeric_limits<std::size_t>::max() / sizeof(value_type)), "Numeric limits exceeded");
+
+        if(const auto bytes = count * sizeof(value_type); bytes < huge_page_size) {
+            return std::allocator<value_type>{}.allocate(count);
+        } else {
+            auto *ptr = ::operator new(bytes, std::align_val_t{huge_page_size});
+            ENTT_HUGE_PAGE_ADVICE(ptr, bytes);
+            return static_cast<value_type *>(ptr);
+        }
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated by this allocator.
+     * @param ptr A pointer to the beginning of the allocated storage.
+     * @param count Number of objects the storage was allocated for.
+     */
+    void deallocate(value_type *ptr, const std::size_t count) ENTT_NOEXCEPT {
+        if(count * sizeof(value_type) < huge_page_size) {
+            std::allocator<value_type>{}.deallocate(ptr, count);
+        } else {
+            ::operator delete(ptr, std::align_val_t{huge_page_size});
+        }
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @return True, allocators of this type are stateless.
+     */
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator==(const huge_page_allocator<Other> &) const ENTT_NOEXCEPT {
+        return true;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @return False, allocators of this type are stateless.
+     */
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator!=(const huge_page_allocator<Other> &) const ENTT_NOEXCEPT {
+        return false;
+    }
+};
+
+/**
+ * @brief Allocator that aligns all blocks of memory to a given boundary.
+ *
+ * Useful for pages that are copied as they are to devices with stricter
+ * alignment requirements, such as the buffers of a graphics card.
+ *
+ * @tparam Type Type of objects to allocate.
+ * @tparam Alignment Alignment of the blocks of memory, in bytes.
+ */
+template<typename Type, std::size_t Alignment>
+struct aligned_allocator {
+    static_assert(is_power_of_two(Alignment) && Alignment >= alignof(Type), "Invalid alignment");
+
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Allocators of this type always compare equal. */
+    using is_always_equal = std::true_type;
+
+    /**
+     * @brief Rebinds the allocator to another type of objects.
+     * @tparam Other Type of objects to allocate.
+     */
+    template<typename Other>
+    struct rebind {
+        /*! @brief Rebound allocator type. */
+        using other = aligned_allocator<Other, (Alignment < alignof(Other) ? alignof(Other) : Alignment)>;
+    };
+
+    /*! @brief Alignment of the blocks of memory, in bytes. */
+    static constexpr std::size_t alignment = Alignment;
+
+    /*! @brief Default constructor. */
+    constexpr aligned_allocator() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @tparam Align Alignment of the other allocator.
+     */
+    template<typename Other, std::size_t Align>
+    constexpr aligned_allocator(const aligned_allocator<Other, Align> &) ENTT_NOEXCEPT {}
+
+    /**
+     * @brief Allocates storage for a number of objects.
+     * @param count Number of objects to allocate storage for.
+     * @return A pointer to the beginning of the allocated storage.
+     */
+    [[nodiscard]] value_type *allocate(const std::size_t count) {
+        ENTT_ASSERT(count <= (std::numeric_limits<std::size_t>::max() / sizeof(value_type)), "Numeric limits exceeded");
+        return static_cast<value_type *>(::operator new(count * sizeof(value_type), std::align_val_t{Alignment}));
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated by this allocator.
+     * @param ptr A pointer to the beginning of the allocated storage.
+     */
+    void deallocate(value_type *ptr, const std::size_t) ENTT_NOEXCEPT {
+        ::operator delete(ptr, std::align_val_t{Alignment});
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @tparam Align Alignment of the other allocator.
+     * @return True, allocators of this type are stateless.
+     */
+    template<typename Other, std::size_t Align>
+    [[nodiscard]] constexpr bool operator==(const aligned_allocator<Other, Align> &) const ENTT_NOEXCEPT {
+        return true;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @tparam Align Alignment of the other allocator.
+     * @return False, allocators of this type are stateless.
+     */
+    template<typename Other, std::size_t Align>
+    [[nodiscard]] constexpr bool operator!=(const aligned_allocator<Other, Align> &) const ENTT_NOEXCEPT {
+        return false;
+    }
+};
+
 /**
  * @brief Deleter for allocator-aware unique pointers (waiting for C++20).
  * @tparam Args Types of arguments to use to construct the object.
@@ -1,6 +1,8 @@
 #ifndef ENTT_CORE_TYPE_INFO_HPP
 #define ENTT_CORE_TYPE_INFO_HPP
 
+#include <cstddef>
+#include <new>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -92,6 +94,39 @@ struct ENTT_API type_index final {
     }
 };
 
+/**
+ * @brief Compile-time dense type index.
+ *
+ * The primary template doesn't offer an index. Specializations are meant to
+ * assign dense indices to a fixed set of types known at build time, usually
+ * listed in a header shared by all modules.<br/>
+ * Unlike `type_index`, these indices don't depend on the order in which types
+ * are first used and are therefore the same across shared libraries.
+ *
+ * @tparam Type Type for which to provide a compile-time index.
+ */
+template<typename Type, typename = void>
+struct static_type_index {};
+
+/**
+ * @brief Provides the member constant `value` to true if a given type has a
+ * compile-time dense index, false otherwise.
+ * @tparam Type The type to test.
+ */
+template<typename Type, typename = void>
+struct has_static_type_index: std::false_type {};
+
+/*! @copydoc has_static_type_index */
+template<typename Type>
+struct has_static_type_index<Type, std::void_t<decltype(static_type_index<Type>::value)>>: std::true_type {};
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type The type to test.
+ */
+template<typename Type>
+inline constexpr bool has_static_type_index_v = has_static_type_index<Type>::value;
+
 /**
  * @brief Type hash.
  * @tparam Type Type for which to generate a hash value.
@@ -262,6 +297,94 @@ template<typename Type>
     }
 }
 
+/**
+ * @brief Memory layout and special member functions of a type.
+ *
+ * Layouts let type-erased containers manage objects in raw memory. They're
+ * usually generated from types but can also be filled at runtime, for example
+ * to describe objects that are only known to a scripting language.<br/>
+ * Thunks for the operations that a type doesn't support are null pointers.
+ * Objects of trivial layouts are copied and moved as bytes instead. Thunks
+ * are optional in this case and default construction falls back to
+ * zero-initialization.
+ */
+struct type_layout {
+    /*! @brief Type info object of the described type. */
+    const type_info *info;
+    /*! @brief Size of an object, in bytes. */
+    std::size_t size;
+    /*! @brief Alignment of an object, in bytes. */
+    std::size_t alignment;
+    /*! @brief Default constructs an object in place, if supported. */
+    void (*construct)(void *);
+    /*! @brief Copy constructs an object in place, if supported. */
+    void (*copy)(void *, const void *);
+    /*! @brief Move constructs an object in place. */
+    void (*move)(void *, void *);
+    /*! @brief Destroys an object. */
+    void (*destroy)(void *);
+    /*! @brief Whether objects can be copied as bytes and zero-initialized. */
+    bool trivial{};
+};
+
+/**
+ * @brief Returns the layout of a given type.
+ * @tparam Type Type for which to generate a layout.
+ * @return The layout of the given type.
+ */
+template<typename Type>
+[[nodiscard]] const type_layout &type_layout_of() ENTT_NOEXCEPT {
+    static_assert(std::is_same_v<Type, std::decay_t<Type>> && std::is_move_constructible_v<Type> && std::is_destructible_v<Type>, "Invalid type");
+
+    static const type_layout instance{
+        &type_id<Type>(),
+        sizeof(Type),
+        alignof(Type),
+        [] {
+            if constexpr(std::is_default_constructible_v<Type>) {
+                return +[](void *elem) { ::new(elem) Type(); };
+            } else {
+                return static_cast<void (*)(void *)>(nullptr);
+            }
+        }(),
+        [] {
+            if constexpr(std::is_copy_constructible_v<Type>) {
+                return +[](void *elem, const void *other) { ::new(elem) Type(*static_cast<const Type *>(other)); };
+            } else {
+                return static_cast<void (*)(void *, const void *)>(nullptr);
+            }
+        }(),
+        +[](void *elem, void *other) { ::new(elem) Type(std::move(*static_cast<Type *>(other))); },
+        +[](void *elem) { static_cast<Type *>(elem)->~Type(); },
+        std::is_trivially_copyable_v<Type> && std::is_copy_constructible_v<Type> && std::is_default_constructible_v<Type>
+        // tricks clang-format
+    };
+
+    return instance;
+}
+
+/**
+ * @brief Eager registration of runtime type information.
+ *
+ * Sequential identifiers and type info objects are initialized the first time
+ * they're requested. When this happens concurrently from multiple threads,
+ * they contend on the initialization of local static variables and of the
+ * shared counter.<br/>
+ * Reserving types at startup assigns their identifiers in the order in which
+ * they're listed (provided that none of them was used before), so that later
+ * lookups are all served by already initialized variables.
+ */
+struct type_index_registry final {
+    /**
+     * @brief Assigns identifiers and type info objects to the given types.
+     * @tparam Type Types for which to initialize runtime type information.
+     */
+    template<typename... Type>
+    static void reserve() ENTT_NOEXCEPT {
+        (static_cast<void>(type_id<Type>()), ...);
+    }
+};
+
 } // namespace entt
 
 #endif
@@ -0,0 +1,285 @@
+#ifndef ENTT_ENTITY_CACHED_VIEW_HPP
+#define ENTT_ENTITY_CACHED_VIEW_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+#include "storage.hpp"
+#include "utility.hpp"
+
+namespace entt {
+
+/**
+ * @brief Cached view.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error, but for a few reasonable cases.
+ */
+template<typename, typename, typename>
+class basic_cached_view;
+
+/**
+ * @brief Cached view.
+ *
+ * A cached view keeps the entities that match a query in its own sparse set and
+ * listens to the signals of the registry to keep it up to date, much like a
+ * non-owning group does. Therefore, iterating a cached view never filters any
+ * entity out.<br/>
+ * Unlike groups, cached views aren't owned by the registry. They can be created
+ * and destroyed at any time, don't interfere with other groups and don't affect
+ * the registry once destroyed.
+ *
+ * Each cached view costs a sparse set and a few listeners. Keeping it up to
+ * date costs a handful of lookups every time one of its components is assigned
+ * or removed.
+ *
+ * @warning
+ * Cached views aren't informed when their pools are reset without notifying
+ * the listeners. In this case, the `refresh` member function fills them again.
+ *
+ * @warning
+ * Lifetime of a cached view must not overcome that of the registry that
+ * generated it. In any other case, attempting to use a cached view results in
+ * undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Get Types of components iterated by the view.
+ * @tparam Exclude Types of components used to filter the view.
+ */
+template<typename Entity, typename... Get, typename... Exclude>
+class basic_cached_view<Entity, get_t<Get...>, exclude_t<Exclude...>> final {
+    static_assert(sizeof...(Get) != 0u, "Exclusion-only cached views are not supported");
+    static_assert((std::is_same_v<Exclude, std::decay_t<Exclude>> && ...), "Non-decayed types not allowed");
+    static_assert(std::conjunction_v<std::bool_constant<emit_signals_v<std::remove_const_t<Get>>>..., std::bool_constant<emit_signals_v<Exclude>>...>, "Cached views require storage signals");
+
+    using registry_type = basic_registry<Entity>;
+
+    template<typename Comp>
+    using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Comp>>::storage_type, Comp>;
+
+    template<typename Type>
+    void maybe_valid_if(registry_type &, const Entity entt) {
+        if(!cache.contains(entt)
+           && (std::get<storage_type<Get> *>(gpools)->contains(entt) && ...)
+           && ((std::is_same_v<Type, Exclude> || !std::get<storage_type<Exclude> *>(epools)->contains(entt)) && ...)) {
+            cache.emplace(entt);
+        }
+    }
+
+    void discard_if(registry_type &, const Entity entt) {
+        cache.remove(entt);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Common type among all storage types. */
+    using base_type = basic_sparse_set<Entity>;
+    /*! @brief Random access iterator type. */
+    using iterator = typename base_type::iterator;
+    /*! @brief Reversed iterator type. */
+    using reverse_iterator = typename base_type::reverse_iterator;
+
+    /**
+     * @brief Constructs a cached view that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_cached_view(registry_type &source)
+        : reg{&source},
+          gpools{&source.template storage<std::remove_const_t<Get>>()...},
+          epools{&source.template storage<Exclude>()...},
+          cache{} {
+        (reg->template on_construct<std::remove_const_t<Get>>().template connect<&basic_cached_view::maybe_valid_if<std::remove_const_t<Get>>>(*this), ...);
+        (reg->template on_destroy<Exclude>().template connect<&basic_cached_view::maybe_valid_if<Exclude>>(*this), ...);
+        (reg->template on_destroy<std::remove_const_t<Get>>().template connect<&basic_cached_view::discard_if>(*this), ...);
+        (reg->template on_construct<Exclude>().template connect<&basic_cached_view::discard_if>(*this), ...);
+        refresh();
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_cached_view(const basic_cached_view &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_cached_view(basic_cached_view &&) = delete;
+
+    /*! @brief Disconnects the view from the registry. */
+    ~basic_cached_view() {
+        (reg->template on_construct<std::remove_const_t<Get>>().disconnect(*this), ...);
+        (reg->template on_destroy<Exclude>().disconnect(*this), ...);
+        (reg->template on_destroy<std::remove_const_t<Get>>().disconnect(*this), ...);
+        (reg->template on_construct<Exclude>().disconnect(*this), ...);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This cached view.
+     */
+    basic_cached_view &operator=(const basic_cached_view &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This cached view.
+     */
+    basic_cached_view &operator=(basic_cached_view &&) = delete;
+
+    /**
+     * @brief Fills the view again from its pools.
+     *
+     * Refreshing a view costs linear time in the size of the shortest pool.
+     * It's never required, unless the pools are reset without notifying the
+     * listeners.
+     */
+    void refresh() {
+        const base_type *candidates = std::get<0>(gpools);
+        ((candidates = std::get<storage_type<Get> *>(gpools)->size() < candidates->size() ? std::get<storage_type<Get> *>(gpools) : candidates), ...);
+        cache.clear();
+
+        for(const auto entt: *candidates) {
+            if((std::get<storage_type<Get> *>(gpools)->contains(entt) && ...) && (!std::get<storage_type<Exclude> *>(epools)->contains(entt) && ...)) {
+                cache.emplace(entt);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of entities that are part of the view.
+     * @return Number of entities that are part of the view.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return cache.size();
+    }
+
+    /**
+     * @brief Checks whether a view is empty.
+     * @return True if the view is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return cache.empty();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the view.
+     *
+     * If the view is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the view.
+     */
+    [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+        return cache.begin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the view.
+     * @return An iterator to the entity following the last entity of the view.
+     */
+    [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+        return cache.end();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the reversed view.
+     *
+     * If the view is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first entity of the reversed view.
+     */
+    [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return cache.rbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the reversed
+     * view.
+     * @return An iterator to the entity following the last entity of the
+     * reversed view.
+     */
+    [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
+        return cache.rend();
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
+        return cache.contains(entt);
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.
+     *
+     * @tparam Comp Types of components to get.
+     * @param entt A valid identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    [[nodiscard]] decltype(auto) get(const entity_type entt) const {
+        ENTT_ASSERT(contains(entt), "View does not contain entity");
+
+        if constexpr(sizeof...(Comp) == 0) {
+            return std::tuple_cat(std::get<storage_type<Get> *>(gpools)->get_as_tuple(entt)...);
+        } else if constexpr(sizeof...(Comp) == 1) {
+            return (std::get<storage_type<Comp> *>(gpools)->get(entt), ...);
+        } else {
+            return std::tuple_cat(std::get<storage_type<Comp> *>(gpools)->get_as_tuple(entt)...);
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to non-empty components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &...);
+     * void(Type &...);
+     * @endcode
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned during iterations.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(const auto entt: cache) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_cached_view>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+            } else {
+                std::apply(func, get(entt));
+            }
+        }
+    }
+
+private:
+    registry_type *reg;
+    std::tuple<storage_type<Get> *...> gpools;
+    std::tuple<storage_type<Exclude> *...> epools;
+    base_type cache;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+class command_arena final {
+    static constexpr std::size_t block_size = 4096u;
+
+    struct block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+public:
+    [[nodiscard]] void *allocate(const std::size_t size, const std::size_t align) {
+        for(; current < blocks.size(); ++current, offset = 0u) {
+            const auto pos = (offset + align - 1u) & ~(align - 1u);
+
+            if(pos + size <= blocks[current].size) {
+                offset = pos + size;
+                return blocks[current].data.get() + pos;
+            }
+        }
+
+        const auto length = (size < block_size) ? block_size : size;
+        blocks.push_back({std::make_unique<std::byte[]>(length), length});
+        current = blocks.size() - 1u;
+        offset = size;
+        return blocks.back().data.get();
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        current = {};
+        offset = {};
+    }
+
+private:
+    std::vector<block> blocks{};
+    std::size_t current{};
+    std::size_t offset{};
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Command buffer for deferred structural changes.
+ *
+ * A command buffer records the creation and destruction of entities as well as
+ * the assignment and removal of components, without touching the registry. The
+ * commands are played back later on, in the same order, by means of `flush`.
+ * <br/>
+ * Components are stored in a linear arena that is recycled from a flush to the
+ * next one. Identifiers returned by `create` are placeholders that can be
+ * freely used with the other commands of the same buffer and are replaced with
+ * valid entities during the playback.
+ *
+ * @warning
+ * A command buffer isn't thread safe. Systems running in parallel should use
+ * one buffer per thread and flush them from a single thread afterwards.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_command_buffer final {
+    using entity_traits = entt_traits<Entity>;
+    using registry_type = basic_registry<Entity>;
+
+    struct command {
+        void (*invoke)(registry_type &, const Entity, void *);
+        void (*release)(void *);
+        Entity entity;
+        void *payload;
+    };
+
+    template<typename Component, typename... Args>
+    void push(const Entity entt, Args &&...args) {
+        if constexpr(ignore_as_empty_v<Component>) {
+            commands.push_back({[](registry_type &owner, const Entity elem, void *) { owner.template emplace_or_replace<Component>(elem); }, nullptr, entt, nullptr});
+        } else {
+            static_assert(alignof(Component) <= alignof(std::max_align_t), "Over-aligned components are not supported");
+            auto *instance = ::new(arena.allocate(sizeof(Component), alignof(Component))) Component{std::forward<Args>(args)...};
+
+            ENTT_TRY {
+                commands.push_back({
+                    [](registry_type &owner, const Entity elem, void *value) { owner.template emplace_or_replace<Component>(elem, std::move(*static_cast<Component *>(value))); },
+                    [](void *value) { std::destroy_at(static_cast<Component *>(value)); },
+                    entt,
+                    instance,
+                });
+            }
+            ENTT_CATCH {
+                std::destroy_at(instance);
+                ENTT_THROW;
+            }
+        }
+    }
+
+    [[nodiscard]] Entity resolve(const Entity entt) const {
+        return (entity_traits::to_version(entt) == entity_traits::to_version(tombstone)) ? created[static_cast<size_type>(entity_traits::to_entity(entt))] : entt;
+    }
+
+    void playback(registry_type &reg) {
+        reg.materialize();
+        created.resize(pending);
+        reg.create(created.begin(), created.end());
+
+        for(auto first = commands.begin(), last = commands.end(); first != last;) {
+            if(first->invoke) {
+                first->invoke(reg, resolve(first->entity), first->payload);
+                ++first;
+            } else {
+                // consecutive destructions are played back as a single batch
+                for(scratch.clear(); first != last && !first->invoke; ++first) {
+                    scratch.push_back(resolve(first->entity));
+                }
+
+                reg.destroy(scratch.cbegin(), scratch.cend());
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_command_buffer() = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_command_buffer(const basic_command_buffer &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_command_buffer(basic_command_buffer &&other) ENTT_NOEXCEPT
+        : commands{std::move(other.commands)},
+          created{std::move(other.created)},
+          scratch{std::move(other.scratch)},
+          arena{std::move(other.arena)},
+          pending{std::exchange(other.pending, size_type{})} {
+        other.commands.clear();
+    }
+
+    /*! @brief Destroys all the pending commands. */
+    ~basic_command_buffer() {
+        clear();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(const basic_command_buffer &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(basic_command_buffer &&other) ENTT_NOEXCEPT {
+        clear();
+        commands = std::move(other.commands);
+        created = std::move(other.created);
+        scratch = std::move(other.scratch);
+        arena = std::move(other.arena);
+        pending = std::exchange(other.pending, size_type{});
+        other.commands.clear();
+        return *this;
+    }
+
+    /**
+     * @brief Records the creation of an entity.
+     * @return A placeholder for the identifier, only valid within this buffer.
+     */
+    [[nodiscard]] entity_type create() {
+        ENTT_ASSERT(pending < entity_traits::to_entity(null), "No entities available");
+        return entity_traits::construct(static_cast<typename entity_traits::entity_type>(pending++), entity_traits::to_version(tombstone));
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entt A valid identifier or a placeholder from this buffer.
+     */
+    void destroy(const entity_type entt) {
+        commands.push_back({nullptr, nullptr, entt, nullptr});
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * The component is constructed immediately and moved into the registry
+     * during the playback, replacing the existing one if any.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entt A valid identifier or a placeholder from this buffer.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void emplace(const entity_type entt, Args &&...args) {
+        push<Component>(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the removal of the given components from an entity.
+     * @tparam Component Type of component to remove.
+     * @tparam Other Other types of components to remove.
+     * @param entt A valid identifier or a placeholder from this buffer.
+     */
+    template<typename Component, typename... Other>
+    void remove(const entity_type entt) {
+        commands.push_back({[](registry_type &owner, const Entity elem, void *) { owner.template remove<Component, Other...>(elem); }, nullptr, entt, nullptr});
+    }
+
+    /**
+     * @brief Returns the number of commands recorded so far.
+     * @return Number of commands recorded so far.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return commands.size() + pending;
+    }
+
+    /**
+     * @brief Checks whether a command buffer is empty.
+     * @return True if the command buffer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return commands.empty() && !pending;
+    }
+
+    /*! @brief Discards all the commands recorded so far. */
+    void clear() ENTT_NOEXCEPT {
+        for(auto &&curr: commands) {
+            if(curr.release) {
+                curr.release(curr.payload);
+            }
+        }
+
+        commands.clear();
+        arena.clear();
+        pending = {};
+    }
+
+    /**
+     * @brief Plays back all the commands recorded so far, then clears the
+     * buffer.
+     *
+     * Identifiers reserved by means of the registry are materialized first.
+     * Placeholders are then replaced with entities created all at once before
+     * any other command is played back. Consecutive destructions are batched.
+     *
+     * @warning
+     * If a command throws, the ones not yet played back are discarded.
+     *
+     * @param reg A valid registry.
+     */
+    void flush(registry_type &reg) {
+        ENTT_TRY {
+            playback(reg);
+        }
+        ENTT_CATCH {
+            clear();
+            ENTT_THROW;
+        }
+
+        clear();
+    }
+
+private:
+    std::vector<command> commands{};
+    std::vector<entity_type> created{};
+    std::vector<entity_type> scratch{};
+    internal::command_arena arena{};
+    size_type pending{};
+};
+
+} // namespace entt
+
+#endif
@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/memory.hpp"
+#include "../core/type_traits.hpp"
 
 namespace entt {
 
@@ -22,12 +24,96 @@ struct in_place_delete<Type, std::enable_if_t<Type::in_place_delete>>
     : std::true_type {};
 
 template<typename Type, typename = void>
-struct page_size: std::integral_constant<std::size_t, (ENTT_IGNORE_IF_EMPTY && std::is_empty_v<Type>) ? 0u : ENTT_PACKED_PAGE> {};
+struct page_size: std::integral_constant<std::size_t, (ENTT_IGNORE_IF_EMPTY && std::is_empty_v<Type>) ? 0u : (ENTT_PACKED_PAGE_BYTES ? elements_per_page(sizeof(Type), ENTT_PACKED_PAGE_BYTES) : ENTT_PACKED_PAGE)> {};
 
 template<typename Type>
 struct page_size<Type, std::enable_if_t<std::is_convertible_v<decltype(Type::page_size), std::size_t>>>
     : std::integral_constant<std::size_t, Type::page_size> {};
 
+template<typename Type, typename = void>
+struct page_alignment: std::integral_constant<std::size_t, 0u> {};
+
+template<typename Type>
+struct page_alignment<Type, std::enable_if_t<std::is_convertible_v<decltype(Type::page_alignment), std::size_t>>>
+    : std::integral_constant<std::size_t, Type::page_alignment> {};
+
+template<typename Type, typename = void>
+struct hashed_index: std::false_type {};
+
+template<typename Type>
+struct hashed_index<Type, std::enable_if_t<Type::hashed_index>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct compact_index: std::false_type {};
+
+template<typename Type>
+struct compact_index<Type, std::enable_if_t<Type::compact_index>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct signals: std::true_type {};
+
+template<typename Type>
+struct signals<Type, std::enable_if_t<!Type::signals>>
+    : std::false_type {};
+
+template<typename Type, typename = void>
+struct change_ticks: std::false_type {};
+
+template<typename Type>
+struct change_ticks<Type, std::enable_if_t<Type::change_ticks>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct trace_operations: std::false_type {};
+
+template<typename Type>
+struct trace_operations<Type, std::enable_if_t<Type::trace_operations>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct copy_on_write: std::false_type {};
+
+template<typename Type>
+struct copy_on_write<Type, std::enable_if_t<Type::copy_on_write>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct dirty_pages: std::false_type {};
+
+template<typename Type>
+struct dirty_pages<Type, std::enable_if_t<Type::dirty_pages>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct pinned: std::false_type {};
+
+template<typename Type>
+struct pinned<Type, std::enable_if_t<Type::pinned>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct trivially_relocatable: std::false_type {};
+
+template<typename Type>
+struct trivially_relocatable<Type, std::enable_if_t<Type::trivially_relocatable>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct shared: std::false_type {};
+
+template<typename Type>
+struct shared<Type, std::enable_if_t<Type::shared>>
+    : std::true_type {};
+
+template<typename Traits, typename = void>
+struct soa_layout: std::false_type {};
+
+template<typename Traits>
+struct soa_layout<Traits, std::void_t<typename Traits::soa_members>>
+    : std::bool_constant<!std::is_same_v<typename Traits::soa_members, value_list<>>> {};
+
 } // namespace internal
 
 /**
@@ -43,10 +129,34 @@ template<typename Type, typename = void>
 struct component_traits {
     static_assert(std::is_same_v<std::decay_t<Type>, Type>, "Unsupported type");
 
-    /*! @brief Pointer stability, default is `false`. */
-    static constexpr bool in_place_delete = internal::in_place_delete<Type>::value;
-    /*! @brief Page size, default is `ENTT_PACKED_PAGE` for non-empty types. */
+    /*! @brief Pointer stability, default is `false` unless pinned. */
+    static constexpr bool in_place_delete = internal::in_place_delete<Type>::value || internal::pinned<Type>::value;
+    /*! @brief Elements never move, not even when sorting or compacting, default is `false`. */
+    static constexpr bool pinned = internal::pinned<Type>::value;
+    /*! @brief Page size, default is `ENTT_PACKED_PAGE` (or `ENTT_PACKED_PAGE_BYTES`) for non-empty types. */
     static constexpr std::size_t page_size = internal::page_size<Type>::value;
+    /*! @brief Alignment of pages in bytes, default is `0` (as provided by the allocator). */
+    static constexpr std::size_t page_alignment = internal::page_alignment<Type>::value;
+    /*! @brief Hashed sparse index, default is `false`. */
+    static constexpr bool hashed_index = internal::hashed_index<Type>::value;
+    /*! @brief Sparse index of 16-bit positions, default is `false`. */
+    static constexpr bool compact_index = internal::compact_index<Type>::value;
+    /*! @brief Construction, update and destruction signals, default is `true`. */
+    static constexpr bool signals = internal::signals<Type>::value;
+    /*! @brief Change tracking by means of ticks, default is `false`. */
+    static constexpr bool change_ticks = internal::change_ticks<Type>::value;
+    /*! @brief Recording of operations in a trace, default is `false`. */
+    static constexpr bool trace_operations = internal::trace_operations<Type>::value;
+    /*! @brief Copy-on-write pages for frozen storage, default is `false`. */
+    static constexpr bool copy_on_write = internal::copy_on_write<Type>::value;
+    /*! @brief Per-page dirty bits for partial uploads, default is `false`. */
+    static constexpr bool dirty_pages = internal::dirty_pages<Type>::value;
+    /*! @brief Relocation by means of a bitwise copy, default is `false`. */
+    static constexpr bool trivially_relocatable = internal::trivially_relocatable<Type>::value;
+    /*! @brief Equal instances stored once and shared among entities, default is `false`. */
+    static constexpr bool shared = internal::shared<Type>::value;
+    /*! @brief Data members to lay out in separate arrays, default is none. */
+    using soa_members = value_list<>;
 };
 
 /**
@@ -56,6 +166,90 @@ struct component_traits {
 template<class Type>
 inline constexpr bool ignore_as_empty_v = (component_traits<Type>::page_size == 0u);
 
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr std::size_t page_alignment_v = internal::page_alignment<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool hashed_index_v = internal::hashed_index<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool compact_index_v = internal::compact_index<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool emit_signals_v = internal::signals<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool change_ticks_v = internal::change_ticks<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool trace_operations_v = internal::trace_operations<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool copy_on_write_v = internal::copy_on_write<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool dirty_pages_v = internal::dirty_pages<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool pinned_v = internal::pinned<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool trivially_relocatable_v = internal::trivially_relocatable<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool shared_v = internal::shared<component_traits<Type>>::value;
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<class Type>
+inline constexpr bool soa_layout_v = internal::soa_layout<component_traits<Type>>::value;
+
 } // namespace entt
 
 #endif
@@ -16,35 +16,45 @@ namespace entt {
 
 namespace internal {
 
+// waiting for C++20 (and std::popcount)
+template<typename Type>
+static constexpr int popcount(Type value) ENTT_NOEXCEPT {
+    return value ? (int(value & 1) + popcount(value >> 1)) : 0;
+}
+
 template<typename, typename = void>
 struct entt_traits;
 
 template<typename Type>
 struct entt_traits<Type, std::enable_if_t<std::is_enum_v<Type>>>
-    : entt_traits<std::underlying_type_t<Type>> {};
+    : entt_traits<std::underlying_type_t<Type>> {
+    using value_type = Type;
+};
 
 template<typename Type>
 struct entt_traits<Type, std::enable_if_t<std::is_class_v<Type>>>
-    : entt_traits<typename Type::entity_type> {};
+    : entt_traits<typename Type::entity_type> {
+    using value_type = Type;
+};
 
 template<>
 struct entt_traits<std::uint32_t> {
+    using value_type = std::uint32_t;
     using entity_type = std::uint32_t;
     using version_type = std::uint16_t;
 
     static constexpr entity_type entity_mask = 0xFFFFF;
     static constexpr entity_type version_mask = 0xFFF;
-    static constexpr std::size_t entity_shift = 20u;
 };
 
 template<>
 struct entt_traits<std::uint64_t> {
+    using value_type = std::uint64_t;
     using entity_type = std::uint64_t;
     using version_type = std::uint32_t;
 
     static constexpr entity_type entity_mask = 0xFFFFFFFF;
     static constexpr entity_type version_mask = 0xFFFFFFFF;
-    static constexpr std::size_t entity_shift = 32u;
 };
 
 } // namespace internal
@@ -55,24 +65,38 @@ struct entt_traits<std::uint64_t> {
  */
 
 /**
- * @brief Entity traits.
- * @tparam Type Type of identifier.
+ * @brief Common basic entity traits implementation.
+ *
+ * The split between the entity and the version parts of an identifier is
+ * defined by the masks of the given traits. The entity part takes the lower
+ * bits, the version part takes the bits that follow it.
+ *
+ * @tparam Traits Actual entity traits to use.
  */
-template<typename Type>
-class entt_traits: internal::entt_traits<Type> {
-    using base_type = internal::entt_traits<Type>;
+template<typename Traits>
+class basic_entt_traits {
+    static constexpr auto length = internal::popcount(Traits::entity_mask);
+
+    static_assert(Traits::entity_mask && ((typename Traits::entity_type{1} << length) == (Traits::entity_mask + 1)), "Invalid entity mask");
+    static_assert((typename Traits::entity_type{1} << internal::popcount(Traits::version_mask)) == (Traits::version_mask + 1), "Invalid version mask");
+    static_assert(length + internal::popcount(Traits::version_mask) <= int(sizeof(typename Traits::entity_type) * 8), "Invalid masks");
 
 public:
     /*! @brief Value type. */
-    using value_type = Type;
+    using value_type = typename Traits::value_type;
     /*! @brief Underlying entity type. */
-    using entity_type = typename base_type::entity_type;
+    using entity_type = typename Traits::entity_type;
     /*! @brief Underlying version type. */
-    using version_type = typename base_type::version_type;
+    using version_type = typename Traits::version_type;
+
+    /*! @brief Mask of the entity part. */
+    static constexpr entity_type entity_mask = Traits::entity_mask;
+    /*! @brief Mask of the version part. */
+    static constexpr entity_type version_mask = Traits::version_mask;
     /*! @brief Reserved identifier. */
-    static constexpr entity_type reserved = base_type::entity_mask | (base_type::version_mask << base_type::entity_shift);
-    /*! @brief Page size, default is `ENTT_SPARSE_PAGE`. */
-    static constexpr auto page_size = ENTT_SPARSE_PAGE;
+    static constexpr entity_type reserved = entity_mask | (version_mask << length);
+    /*! @brief Page size, `ENTT_SPARSE_PAGE` unless the entity part is smaller. */
+    static constexpr std::size_t page_size = (ENTT_SPARSE_PAGE < (static_cast<std::size_t>(entity_mask) + 1u)) ? ENTT_SPARSE_PAGE : (static_cast<std::size_t>(entity_mask) + 1u);
 
     /**
      * @brief Converts an entity to its underlying type.
@@ -89,7 +113,7 @@ public:
      * @return The integral representation of the entity part.
      */
     [[nodiscard]] static constexpr entity_type to_entity(const value_type value) ENTT_NOEXCEPT {
-        return (to_integral(value) & base_type::entity_mask);
+        return (to_integral(value) & entity_mask);
     }
 
     /**
@@ -98,7 +122,7 @@ public:
      * @return The integral representation of the version part.
      */
     [[nodiscard]] static constexpr version_type to_version(const value_type value) ENTT_NOEXCEPT {
-        return (to_integral(value) >> base_type::entity_shift);
+        return static_cast<version_type>((to_integral(value) >> length) & version_mask);
     }
 
     /**
@@ -112,7 +136,7 @@ public:
      * @return A properly constructed identifier.
      */
     [[nodiscard]] static constexpr value_type construct(const entity_type entity, const version_type version) ENTT_NOEXCEPT {
-        return value_type{(entity & base_type::entity_mask) | (static_cast<entity_type>(version) << base_type::entity_shift)};
+        return value_type{(entity & entity_mask) | ((static_cast<entity_type>(version) & version_mask) << length)};
     }
 
     /**
@@ -126,11 +150,26 @@ public:
      * @return A properly constructed identifier.
      */
     [[nodiscard]] static constexpr value_type combine(const entity_type lhs, const entity_type rhs) ENTT_NOEXCEPT {
-        constexpr auto mask = (base_type::version_mask << base_type::entity_shift);
-        return value_type{(lhs & base_type::entity_mask) | (rhs & mask)};
+        constexpr auto mask = (version_mask << length);
+        return value_type{(lhs & entity_mask) | (rhs & mask)};
     }
 };
 
+/**
+ * @brief Entity traits.
+ *
+ * Users can specialize this class template for their identifiers in order to
+ * define a custom split between the entity and the version parts, as long as
+ * they inherit from `basic_entt_traits`.
+ *
+ * @tparam Type Type of identifier.
+ */
+template<typename Type>
+struct entt_traits: basic_entt_traits<internal::entt_traits<Type>> {
+    /*! @brief Base type. */
+    using base_type = basic_entt_traits<internal::entt_traits<Type>>;
+};
+
 /**
  * @copydoc entt_traits<Entity>::to_integral
  * @tparam Entity The value type.
@@ -0,0 +1,210 @@
+#ifndef ENTT_ENTITY_ENTITY_MASK_HPP
+#define ENTT_ENTITY_ENTITY_MASK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Bit mask of disabled entities.
+ *
+ * Entities are enabled by default. The mask has a bit for each entity index,
+ * therefore enabling or disabling an entity or checking whether it's enabled
+ * takes constant time and never touches the storage classes. Versions aren't
+ * taken into account, it's up to the owner of the mask to enable entities
+ * again when they are released.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_entity_mask {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using word_type = std::uint64_t;
+    using container_type = std::vector<word_type, typename alloc_traits::template rebind_alloc<word_type>>;
+    using entity_traits = entt_traits<Entity>;
+
+    static constexpr std::size_t word_bits = std::numeric_limits<word_type>::digits;
+
+    [[nodiscard]] static constexpr std::size_t position(const Entity entt) ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(entity_traits::to_entity(entt));
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_entity_mask()
+        : basic_entity_mask{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty mask with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_entity_mask(const allocator_type &allocator)
+        : words{allocator},
+          count{} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_entity_mask(basic_entity_mask &&other) ENTT_NOEXCEPT
+        : words{std::move(other.words)},
+          count{std::exchange(other.count, size_type{})} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_entity_mask(basic_entity_mask &&other, const allocator_type &allocator) ENTT_NOEXCEPT
+        : words{std::move(other.words), allocator},
+          count{std::exchange(other.count, size_type{})} {}
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mask.
+     */
+    basic_entity_mask &operator=(basic_entity_mask &&other) ENTT_NOEXCEPT {
+        words = std::move(other.words);
+        count = std::exchange(other.count, size_type{});
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given mask.
+     * @param other Mask to exchange the content with.
+     */
+    void swap(basic_entity_mask &other) {
+        using std::swap;
+        swap(words, other.words);
+        swap(count, other.count);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{words.get_allocator()};
+    }
+
+    /**
+     * @brief Returns the number of disabled entities.
+     * @return Number of disabled entities.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether all entities are enabled.
+     * @return True if no entity is disabled, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (count == 0u);
+    }
+
+    /**
+     * @brief Checks whether an entity is enabled.
+     * @param entt An identifier, either valid or not.
+     * @return True if the entity is enabled, false otherwise.
+     */
+    [[nodiscard]] bool enabled(const entity_type entt) const ENTT_NOEXCEPT {
+        const auto pos = position(entt);
+        const auto idx = pos / word_bits;
+        return !(idx < words.size()) || !((words[idx] >> (pos % word_bits)) & 1u);
+    }
+
+    /**
+     * @brief Enables or disables an entity.
+     * @param entt A valid identifier.
+     * @param value True to enable the entity, false to disable it.
+     * @return True if the state of the entity changed, false otherwise.
+     */
+    bool enable(const entity_type entt, const bool value = true) {
+        const auto pos = position(entt);
+        const auto idx = pos / word_bits;
+        const auto bit = word_type{1u} << (pos % word_bits);
+
+        if(value) {
+            if(idx < words.size() && (words[idx] & bit)) {
+                words[idx] &= ~bit;
+                --count;
+                return true;
+            }
+        } else {
+            if(!(idx < words.size())) {
+                words.resize(idx + 1u);
+            }
+
+            if(!(words[idx] & bit)) {
+                words[idx] |= bit;
+                ++count;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Disables an entity.
+     * @param entt A valid identifier.
+     * @return True if the state of the entity changed, false otherwise.
+     */
+    bool disable(const entity_type entt) {
+        return enable(entt, false);
+    }
+
+    /*! @brief Enables all entities. */
+    void clear() {
+        words.clear();
+        count = {};
+    }
+
+    /**
+     * @brief Direct access to the words of the mask.
+     *
+     * Bit `n % 64` of word `n / 64` is set if the entity with index `n` is
+     * disabled. Entities past the last word are enabled.
+     *
+     * @return A pointer to the array of words.
+     */
+    [[nodiscard]] const word_type *data() const ENTT_NOEXCEPT {
+        return words.data();
+    }
+
+    /**
+     * @brief Returns the number of words in the mask.
+     * @return Number of words in the mask.
+     */
+    [[nodiscard]] size_type extent() const ENTT_NOEXCEPT {
+        return words.size();
+    }
+
+private:
+    container_type words;
+    size_type count;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef ENTT_ENTITY_FLAGS_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_FLAGS_STORAGE_MIXIN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/enum.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+[[nodiscard]] inline std::size_t flags_first_bit(std::uint64_t value) ENTT_NOEXCEPT {
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+    std::size_t count{};
+    for(; !(value & 1u); value >>= 1u, ++count) {}
+    return count;
+#endif
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Mixin type used to add bit columns to storage types for bitmask
+ * enums.
+ *
+ * Flags are also stored aside in bit columns, one per bit of the enum. Each
+ * block of 64 entities gets a word per bit and blocks are indexed by entity.
+ * Therefore, a filter such as `flags & mask` is evaluated for 64 entities at
+ * once by combining a handful of words and entities that don't match are never
+ * visited.<br/>
+ * Columns are updated when instances are created, patched or destroyed.
+ * Sorting the storage doesn't affect them.
+ *
+ * @warning
+ * Modifying instances by means of references isn't detected. Use `patch` or
+ * `touch` in this case.
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+class flags_storage_mixin: public Type {
+    static_assert(std::is_enum_v<typename Type::value_type> && enum_as_bitmask_v<typename Type::value_type>, "Flags storage requires bitmask enums");
+
+    using entity_traits = entt_traits<typename Type::entity_type>;
+    using underlying_type = std::make_unsigned_t<std::underlying_type_t<typename Type::value_type>>;
+    using word_type = std::uint64_t;
+
+    static constexpr std::size_t columns = std::numeric_limits<underlying_type>::digits;
+    static constexpr std::size_t block_size = std::numeric_limits<word_type>::digits;
+
+    void assign(const typename Type::entity_type entt, const underlying_type value) {
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+        const auto first = (pos / block_size) * columns;
+        const auto bit = word_type{1u} << (pos % block_size);
+
+        if(!(first < bits.size())) {
+            bits.resize(first + columns, word_type{});
+        }
+
+        for(std::size_t column{}; column < columns; ++column) {
+            bits[first + column] = ((value >> column) & 1u) ? (bits[first + column] | bit) : (bits[first + column] & ~bit);
+        }
+    }
+
+    void stamp(const typename Type::entity_type entt) {
+        assign(entt, static_cast<underlying_type>(this->get(entt)));
+    }
+
+    void stamp(const std::size_t from) {
+        for(auto pos = from, last = Type::size(); pos < last; ++pos) {
+            stamp(Type::data()[pos]);
+        }
+    }
+
+    void drop(const typename Type::entity_type entt) {
+        if(entt != tombstone) {
+            assign(entt, underlying_type{});
+        }
+    }
+
+    template<typename Func>
+    void visit(const word_type word, const std::size_t block, Func &func) {
+        for(auto curr = word; curr; curr &= curr - 1u) {
+            const auto entity = static_cast<typename entity_traits::entity_type>(block * block_size + internal::flags_first_bit(curr));
+            const auto entt = entity_traits::construct(entity, Type::current(entity_traits::construct(entity, {})));
+            func(entt, this->get(entt));
+        }
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            drop(*it);
+        }
+
+        Type::swap_and_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::in_place_pop */
+    void in_place_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            drop(*it);
+        }
+
+        Type::in_place_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::pop_n */
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) override {
+        for(auto it = first; it != last; ++it) {
+            drop(*it);
+        }
+
+        Type::pop_n(first, last);
+    }
+
+    /*! @copydoc basic_sparse_set::pop_all */
+    void pop_all() override {
+        std::fill(bits.begin(), bits.end(), word_type{});
+        Type::pop_all();
+    }
+
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        const auto it = Type::try_emplace(entt, force_back, value, move);
+
+        if(it != Type::base_type::end()) {
+            stamp(entt);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Updates the bit columns after an instance changed.
+     * @param entt A valid identifier.
+     */
+    void touch(const entity_type entt) {
+        ENTT_ASSERT(Type::contains(entt), "Storage does not contain entity");
+        stamp(entt);
+    }
+
+    /**
+     * @brief Iterates the instances that have at least one of the given flags
+     * set and applies the given function object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type, value_type &);
+     * @endcode
+     *
+     * @warning
+     * Creating or destroying instances from within the function object
+     * results in undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param mask The flags to look for.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_any(const value_type mask, Func func) {
+        const auto value = static_cast<underlying_type>(mask);
+
+        for(std::size_t block{}, last = bits.size() / columns; block < last; ++block) {
+            const auto *first = bits.data() + block * columns;
+            word_type word{};
+
+            for(std::size_t column{}; column < columns; ++column) {
+                word |= ((value >> column) & 1u) ? first[column] : word_type{};
+            }
+
+            visit(word, block, func);
+        }
+    }
+
+    /**
+     * @brief Iterates the instances that have all the given flags set and
+     * applies the given function object to them.
+     *
+     * @sa each_any
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param mask The flags to look for, at least one.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_all(const value_type mask, Func func) {
+        const auto value = static_cast<underlying_type>(mask);
+        ENTT_ASSERT(value != underlying_type{}, "Empty mask");
+
+        for(std::size_t block{}, last = bits.size() / columns; block < last; ++block) {
+            const auto *first = bits.data() + block * columns;
+            auto word = ~word_type{};
+
+            for(std::size_t column{}; column < columns; ++column) {
+                word &= ((value >> column) & 1u) ? first[column] : ~word_type{};
+            }
+
+            visit(word, block, func);
+        }
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        Type::emplace(entt, std::forward<Args>(args)...);
+        stamp(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        Type::patch(entt, std::forward<Func>(func)...);
+        stamp(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        // entities are always appended to the packed array on insertion
+        stamp(from);
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        stamp(from);
+    }
+
+private:
+    std::vector<word_type> bits{};
+};
+
+} // namespace entt
+
+#endif
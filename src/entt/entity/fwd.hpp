@@ -13,9 +13,20 @@ class basic_sparse_set;
 template<typename, typename Type, typename = std::allocator<Type>, typename = void>
 class basic_storage;
 
-template<typename>
+template<typename, typename Type, typename = std::allocator<Type>>
+class basic_frozen_storage;
+
+template<typename Entity, typename = std::allocator<Entity>>
+class basic_runtime_storage;
+
+class runtime_schema;
+
+template<typename Entity, typename = std::allocator<Entity>>
 class basic_registry;
 
+template<typename Entity, typename = std::allocator<Entity>>
+class basic_entity_mask;
+
 template<typename, typename, typename, typename = void>
 class basic_view;
 
@@ -28,15 +39,56 @@ class basic_group;
 template<typename>
 class basic_observer;
 
+template<typename>
+class basic_observer_set;
+
 template<typename>
 class basic_organizer;
 
+template<typename, auto...>
+class basic_static_organizer;
+
+template<typename>
+class basic_graph_executor;
+
+template<typename, typename, typename>
+class basic_cached_view;
+
 template<typename, typename...>
 struct basic_handle;
 
+template<typename, typename...>
+class basic_lazy_group;
+
+template<typename>
+class basic_signature_cache;
+
+template<typename>
+class basic_command_buffer;
+
+template<typename>
+class basic_prefab;
+
+template<typename>
+class basic_sharded_registry;
+
+class memory_segment;
+
+template<typename>
+class segment_allocator;
+
+template<typename, typename>
+class basic_segment_view;
+
+template<typename>
+class basic_operation_trace;
+
 template<typename>
 class basic_snapshot;
 
+template<typename>
+class basic_delta_snapshot;
+
 template<typename>
 class basic_snapshot_loader;
 
@@ -49,6 +101,9 @@ enum class entity : id_type {};
 /*! @brief Alias declaration for the most common use case. */
 using sparse_set = basic_sparse_set<entity>;
 
+/*! @brief Alias declaration for the most common use case. */
+using entity_mask = basic_entity_mask<entity>;
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Args Other template parameters.
@@ -56,15 +111,48 @@ using sparse_set = basic_sparse_set<entity>;
 template<typename... Args>
 using storage = basic_storage<entity, Args...>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using frozen_storage = basic_frozen_storage<entity, Args...>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of elements of the storage.
+ */
+template<typename Type>
+using segment_view = basic_segment_view<entity, Type>;
+
+/*! @brief Alias declaration for the most common use case. */
+using runtime_storage = basic_runtime_storage<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using registry = basic_registry<entity>;
 
 /*! @brief Alias declaration for the most common use case. */
 using observer = basic_observer<entity>;
 
+/*! @brief Alias declaration for the most common use case. */
+using operation_trace = basic_operation_trace<entity>;
+
+/*! @brief Alias declaration for the most common use case. */
+using observer_set = basic_observer_set<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using organizer = basic_organizer<entity>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Candidate Free functions to add to the task list, in order.
+ */
+template<auto... Candidate>
+using static_organizer = basic_static_organizer<entity, Candidate...>;
+
+/*! @brief Alias declaration for the most common use case. */
+using graph_executor = basic_graph_executor<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<entity>;
 
@@ -85,9 +173,31 @@ using handle_view = basic_handle<entity, Args...>;
 template<typename... Args>
 using const_handle_view = basic_handle<const entity, Args...>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Component Types of components iterated by the group.
+ */
+template<typename... Component>
+using lazy_group = basic_lazy_group<entity, Component...>;
+
+/*! @brief Alias declaration for the most common use case. */
+using signature_cache = basic_signature_cache<entity>;
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<entity>;
+
+/*! @brief Alias declaration for the most common use case. */
+using prefab = basic_prefab<entity>;
+
+/*! @brief Alias declaration for the most common use case. */
+using sharded_registry = basic_sharded_registry<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<entity>;
 
+/*! @brief Alias declaration for the most common use case. */
+using delta_snapshot = basic_delta_snapshot<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot_loader = basic_snapshot_loader<entity>;
 
@@ -102,6 +212,14 @@ using continuous_loader = basic_continuous_loader<entity>;
 template<typename Get, typename Exclude = exclude_t<>>
 using view = basic_view<entity, Get, Exclude>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Get Types of components iterated by the view.
+ * @tparam Exclude Types of components used to filter the view.
+ */
+template<typename Get, typename Exclude = exclude_t<>>
+using cached_view = basic_cached_view<entity, Get, Exclude>;
+
 /*! @brief Alias declaration for the most common use case. */
 using runtime_view = basic_runtime_view<sparse_set>;
 
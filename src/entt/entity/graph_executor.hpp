@@ -0,0 +1,403 @@
+#ifndef ENTT_ENTITY_GRAPH_EXECUTOR_HPP
+#define ENTT_ENTITY_GRAPH_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+class graph_worker_queue final {
+public:
+    void push(const std::size_t task) {
+        std::lock_guard lock{mutex};
+        tasks.push_back(task);
+    }
+
+    [[nodiscard]] bool pop(std::size_t &task) {
+        std::lock_guard lock{mutex};
+
+        if(tasks.empty()) {
+            return false;
+        }
+
+        task = tasks.back();
+        tasks.pop_back();
+        return true;
+    }
+
+    [[nodiscard]] bool steal(std::size_t &task) {
+        std::unique_lock lock{mutex, std::try_to_lock};
+
+        if(!lock || tasks.empty()) {
+            return false;
+        }
+
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Work-stealing executor for the task graphs of an organizer.
+ *
+ * The executor owns a set of worker threads that are kept alive for its whole
+ * lifetime. Each worker has its own queue of tasks and steals from the others
+ * when it runs out of work. A vertex is scheduled as soon as all its parents
+ * have completed, without any barrier between the levels of the graph.<br/>
+ * The calling thread takes part in the execution of the graph as well.
+ *
+ * Frames can also be pipelined. When a frame is submitted while the previous
+ * one is still running, each vertex of the new frame only waits for its parents
+ * and for the vertices of the previous frame that come after it. Therefore, the
+ * head of a frame overlaps with the tail of the previous one.
+ *
+ * @warning
+ * Tasks are expected not to throw. The graph must not be modified while it's
+ * running and it's not possible to run more than one graph at a time.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_graph_executor final {
+    using registry_type = basic_registry<Entity>;
+    using vertex_type = typename basic_organizer<Entity>::vertex;
+
+    // frames in flight plus the one armed for the next submission
+    static constexpr std::size_t slots = 3u;
+
+    void schedule(const std::size_t worker, const std::size_t task) {
+        {
+            // counted in advance, a worker can steal the task as soon as it's pushed
+            std::lock_guard lock{mutex};
+            ++queued;
+        }
+
+        queues[worker].push(task);
+        wakeup.notify_one();
+    }
+
+    void release(const std::size_t worker, const std::size_t slot, const std::size_t pos) {
+        if(const auto task = slot * graph->size() + pos; pending[task].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+            schedule(worker, task);
+        }
+    }
+
+    [[nodiscard]] bool try_next(const std::size_t worker, std::size_t &task) {
+        const auto length = queues.size();
+        bool found = queues[worker].pop(task);
+
+        for(std::size_t next = 1u; !found && next < length; ++next) {
+            found = queues[(worker + next) % length].steal(task);
+        }
+
+        if(found) {
+            std::lock_guard lock{mutex};
+            --queued;
+        }
+
+        return found;
+    }
+
+    void execute(const std::size_t worker, const std::size_t task) {
+        const auto slot = task / graph->size();
+        const auto pos = task % graph->size();
+        const auto &vertex = (*graph)[pos];
+        vertex.callback()(vertex.data(), *owner);
+
+        for(const auto child: vertex.children()) {
+            release(worker, slot, child);
+        }
+
+        for(const auto other: waiters[pos]) {
+            release(worker, (slot + 1u) % slots, other);
+        }
+
+        if(remaining[slot].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+            {
+                std::lock_guard lock{mutex};
+                ++completed;
+            }
+
+            wakeup.notify_all();
+        }
+    }
+
+    void work(const std::size_t worker) {
+        for(std::size_t task{};;) {
+            if(try_next(worker, task)) {
+                execute(worker, task);
+            } else {
+                std::unique_lock lock{mutex};
+                wakeup.wait(lock, [this]() { return stop || queued != 0u; });
+
+                if(stop) {
+                    return;
+                }
+            }
+        }
+    }
+
+    void help(const std::size_t frames) {
+        for(std::size_t task{};;) {
+            if(try_next(0u, task)) {
+                execute(0u, task);
+            } else {
+                std::unique_lock lock{mutex};
+                wakeup.wait(lock, [this, frames]() { return !(completed < frames) || queued != 0u; });
+
+                if(!(completed < frames)) {
+                    break;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t in_flight() {
+        std::lock_guard lock{mutex};
+        return submitted - completed;
+    }
+
+    void setup(const std::vector<vertex_type> &adjacency_list, registry_type &reg) {
+        const auto length = adjacency_list.size();
+
+        graph = &adjacency_list;
+        owner = &reg;
+
+        for(auto &&vertex: adjacency_list) {
+            vertex.prepare(reg);
+        }
+
+        if(length * slots > capacity) {
+            pending = std::make_unique<std::atomic<std::size_t>[]>(length * slots);
+            capacity = length * slots;
+        }
+
+        std::vector<bool> reach(length * length);
+        in_degree.assign(length, 0u);
+        cross.assign(length, 0u);
+        waiters.assign(length, {});
+
+        // sinks reachable from each vertex, edges always go from a vertex to a later one
+        for(auto pos = length; pos; --pos) {
+            const auto curr = pos - 1u;
+            const auto &children = adjacency_list[curr].children();
+            reach[curr * length + curr] = children.empty();
+
+            for(const auto child: children) {
+                ENTT_ASSERT(curr < child, "Invalid graph");
+                ++in_degree[child];
+
+                for(auto other = child; other < length; ++other) {
+                    reach[curr * length + other] = reach[curr * length + other] || reach[child * length + other];
+                }
+            }
+
+            for(auto other = curr; other < length; ++other) {
+                if(reach[curr * length + other]) {
+                    waiters[other].push_back(curr);
+                    ++cross[curr];
+                }
+            }
+        }
+
+        order.resize(length);
+        std::iota(order.begin(), order.end(), std::size_t{});
+        // queues are consumed from the back, the vertices with the highest priority are pushed last
+        std::stable_sort(order.begin(), order.end(), [&adjacency_list](const auto lhs, const auto rhs) { return adjacency_list[lhs].priority() < adjacency_list[rhs].priority(); });
+
+        for(std::size_t pos{}, slot = submitted % slots; pos < length; ++pos) {
+            pending[slot * length + pos].store(1u, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor, one worker per hardware thread. */
+    basic_graph_executor()
+        : basic_graph_executor{std::thread::hardware_concurrency()} {}
+
+    /**
+     * @brief Constructs an executor with a given number of workers.
+     *
+     * The calling thread counts as a worker. Therefore, the executor spawns
+     * one thread less than the requested number of workers.
+     *
+     * @param count Number of workers, the calling thread included.
+     */
+    explicit basic_graph_executor(const size_type count)
+        : queues((std::max)(count, size_type{1u})) {
+        threads.reserve(queues.size() - 1u);
+
+        for(size_type pos = 1u, last = queues.size(); pos < last; ++pos) {
+            threads.emplace_back(&basic_graph_executor::work, this, pos);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_graph_executor(const basic_graph_executor &) = delete;
+
+    /*! @brief Completes all pending frames, then stops and joins all workers. */
+    ~basic_graph_executor() {
+        wait();
+
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+
+        wakeup.notify_all();
+
+        for(auto &&curr: threads) {
+            curr.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_graph_executor &operator=(const basic_graph_executor &) = delete;
+
+    /**
+     * @brief Returns the number of workers, the calling thread included.
+     * @return The number of workers.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return queues.size();
+    }
+
+    /**
+     * @brief Submits a frame and returns without waiting for it to complete.
+     *
+     * At most two frames are in flight at a time. If two frames are already
+     * running, the calling thread helps to complete the oldest one first.<br/>
+     * When nothing is running, all vertices are prepared up-front on the
+     * calling thread, so that the required resources exist before any task
+     * accesses them concurrently. Then top-level vertices are handed to the
+     * workers suggested by the organizer, the ones with the highest priority
+     * first, and all other vertices are scheduled as soon as their last parent
+     * completes.<br/>
+     * Otherwise, the vertices of the new frame also wait for the vertices of
+     * the previous frame that come after them, themselves included. This way,
+     * no task overlaps with itself nor with any task that accesses the same
+     * resources in the previous frame.
+     *
+     * @warning
+     * The graph must outlive all the frames for which it's submitted. Frames
+     * are pipelined only if the same graph and registry are submitted again,
+     * otherwise all pending frames are completed first.
+     *
+     * @param adjacency_list The task graph returned by an organizer.
+     * @param reg A valid registry.
+     */
+    void submit(const std::vector<vertex_type> &adjacency_list, registry_type &reg) {
+        if(graph != &adjacency_list || owner != &reg) {
+            wait();
+        } else if(in_flight() == 2u) {
+            help(submitted - 1u);
+        }
+
+        if(in_flight() == 0u) {
+            setup(adjacency_list, reg);
+        }
+
+        if(const auto length = adjacency_list.size(); length != 0u) {
+            const auto slot = submitted % slots;
+            const auto next = (slot + 1u) % slots;
+
+            remaining[slot].store(length, std::memory_order_relaxed);
+
+            // armed in advance, the vertices of this frame release the ones of the next frame
+            for(size_type pos{}; pos < length; ++pos) {
+                pending[next * length + pos].store(cross[pos] + 1u, std::memory_order_relaxed);
+            }
+
+            for(size_type pos{}; pos < length; ++pos) {
+                pending[slot * length + pos].fetch_add(in_degree[pos], std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard lock{mutex};
+                ++submitted;
+            }
+
+            for(const auto pos: order) {
+                release(adjacency_list[pos].worker() % queues.size(), slot, pos);
+            }
+        }
+    }
+
+    /*! @brief Waits for all the frames submitted so far to complete. */
+    void wait() {
+        help(submitted);
+    }
+
+    /**
+     * @brief Runs a task graph and waits for it to complete.
+     * @sa submit
+     * @param adjacency_list The task graph returned by an organizer.
+     * @param reg A valid registry.
+     */
+    void run(const std::vector<vertex_type> &adjacency_list, registry_type &reg) {
+        submit(adjacency_list, reg);
+        wait();
+    }
+
+private:
+    std::vector<internal::graph_worker_queue> queues;
+    std::vector<std::thread> threads{};
+    std::unique_ptr<std::atomic<size_type>[]> pending{};
+    std::atomic<size_type> remaining[slots]{};
+    std::vector<size_type> in_degree{};
+    std::vector<size_type> cross{};
+    std::vector<std::vector<size_type>> waiters{};
+    std::vector<size_type> order{};
+    size_type capacity{};
+    const std::vector<vertex_type> *graph{};
+    registry_type *owner{};
+    std::mutex mutex{};
+    std::condition_variable wakeup{};
+    size_type queued{};
+    size_type submitted{};
+    size_type completed{};
+    bool stop{};
+};
+
+} // namespace entt
+
+#endif
@@ -1,14 +1,18 @@
 #ifndef ENTT_ENTITY_GROUP_HPP
 #define ENTT_ENTITY_GROUP_HPP
 
+#include <algorithm>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
 #include "../core/iterator.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "component.hpp"
 #include "entity.hpp"
+#include "entity_mask.hpp"
 #include "fwd.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -64,7 +68,8 @@ class basic_group;
 template<typename Entity, typename... Get, typename... Exclude>
 class basic_group<Entity, owned_t<>, get_t<Get...>, exclude_t<Exclude...>> {
     /*! @brief A registry is allowed to create groups. */
-    friend class basic_registry<Entity>;
+    template<typename, typename>
+    friend class basic_registry;
 
     template<typename Comp>
     using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Comp>>::storage_type, Comp>;
@@ -117,7 +122,8 @@ class basic_group<Entity, owned_t<>, get_t<Get...>, exclude_t<Exclude...>> {
 
     basic_group(basic_common_type &ref, storage_type<Get> &...gpool) ENTT_NOEXCEPT
         : handler{&ref},
-          pools{&gpool...} {}
+          pools{&gpool...},
+          disabled{} {}
 
 public:
     /*! @brief Underlying entity identifier. */
@@ -132,10 +138,13 @@ public:
     using reverse_iterator = typename base_type::reverse_iterator;
     /*! @brief Iterable group type. */
     using iterable = iterable_adaptor<extended_group_iterator>;
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<Entity, typename base_type::allocator_type>;
 
     /*! @brief Default constructor to use to create empty, invalid groups. */
     basic_group() ENTT_NOEXCEPT
-        : handler{} {}
+        : handler{},
+          disabled{} {}
 
     /**
      * @brief Returns a const reference to the underlying handler.
@@ -145,6 +154,27 @@ public:
         return *handler;
     }
 
+    /**
+     * @brief Returns the mask of disabled entities of a group, if any.
+     * @return The mask of disabled entities, a null pointer if none.
+     */
+    [[nodiscard]] const mask_type *mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
+    /**
+     * @brief Sets the mask of disabled entities of a group.
+     *
+     * Entities disabled in the mask are skipped by `contains` and `each`. The
+     * entities of the group aren't moved, therefore iterators and functions
+     * that return the underlying data return them anyway.
+     *
+     * @param other A mask of disabled entities, a null pointer to disable none.
+     */
+    void mask(const mask_type *other) ENTT_NOEXCEPT {
+        disabled = other;
+    }
+
     /**
      * @brief Returns the storage for a given component type.
      * @tparam Comp Type of component of which to return the storage.
@@ -304,7 +334,7 @@ public:
      * @return True if the group contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
-        return *this && handler->contains(entt);
+        return *this && handler->contains(entt) && (!disabled || disabled->enabled(entt));
     }
 
     /**
@@ -359,7 +389,12 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
+        ENTT_PROFILE_SCOPE(type_id<basic_group>().name());
         for(const auto entt: *this) {
+            if(disabled && !disabled->enabled(entt)) {
+                continue;
+            }
+
             if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
                 std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
             } else {
@@ -468,6 +503,7 @@ public:
 private:
     base_type *const handler;
     const std::tuple<storage_type<Get> *...> pools;
+    const mask_type *disabled;
 };
 
 /**
@@ -519,7 +555,8 @@ private:
 template<typename Entity, typename... Owned, typename... Get, typename... Exclude>
 class basic_group<Entity, owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> {
     /*! @brief A registry is allowed to create groups. */
-    friend class basic_registry<Entity>;
+    template<typename, typename>
+    friend class basic_registry;
 
     template<typename Comp>
     using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Comp>>::storage_type, Comp>;
@@ -583,9 +620,19 @@ class basic_group<Entity, owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...
         std::tuple<storage_type<Owned> *..., storage_type<Get> *...> pools;
     };
 
+    template<typename Comp>
+    [[nodiscard]] auto chunk_of(const std::size_t pos) const {
+        if constexpr(ignore_as_empty_v<std::remove_const_t<Comp>>) {
+            return std::make_tuple();
+        } else {
+            return std::make_tuple(std::addressof(std::get<storage_type<Comp> *>(pools)->rbegin()[static_cast<typename basic_common_type::iterator::difference_type>(pos)]));
+        }
+    }
+
     basic_group(const std::size_t &extent, storage_type<Owned> &...opool, storage_type<Get> &...gpool) ENTT_NOEXCEPT
         : pools{&opool..., &gpool...},
-          length{&extent} {}
+          length{&extent},
+          disabled{} {}
 
 public:
     /*! @brief Underlying entity identifier. */
@@ -600,10 +647,13 @@ public:
     using reverse_iterator = typename base_type::reverse_iterator;
     /*! @brief Iterable group type. */
     using iterable = iterable_adaptor<extended_group_iterator>;
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<Entity, typename base_type::allocator_type>;
 
     /*! @brief Default constructor to use to create empty, invalid groups. */
     basic_group() ENTT_NOEXCEPT
-        : length{} {}
+        : length{},
+          disabled{} {}
 
     /**
      * @brief Returns the storage for a given component type.
@@ -625,6 +675,27 @@ public:
         return *std::get<Comp>(pools);
     }
 
+    /**
+     * @brief Returns the mask of disabled entities of a group, if any.
+     * @return The mask of disabled entities, a null pointer if none.
+     */
+    [[nodiscard]] const mask_type *mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
+    /**
+     * @brief Sets the mask of disabled entities of a group.
+     *
+     * Entities disabled in the mask are skipped by `contains` and `each`. The
+     * entities of the group aren't moved, therefore iterators and functions
+     * that return the underlying data return them anyway.
+     *
+     * @param other A mask of disabled entities, a null pointer to disable none.
+     */
+    void mask(const mask_type *other) ENTT_NOEXCEPT {
+        disabled = other;
+    }
+
     /**
      * @brief Returns the number of entities that have the given components.
      * @return Number of entities that have the given components.
@@ -748,7 +819,7 @@ public:
      * @return True if the group contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
-        return *this && std::get<0>(pools)->contains(entt) && (std::get<0>(pools)->index(entt) < (*length));
+        return *this && std::get<0>(pools)->contains(entt) && (std::get<0>(pools)->index(entt) < (*length)) && (!disabled || disabled->enabled(entt));
     }
 
     /**
@@ -803,7 +874,12 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
+        ENTT_PROFILE_SCOPE(type_id<basic_group>().name());
         for(auto args: each()) {
+            if(disabled && !disabled->enabled(std::get<0>(args))) {
+                continue;
+            }
+
             if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
                 std::apply(func, args);
             } else {
@@ -830,6 +906,42 @@ public:
         return {extended_group_iterator{last - *length, pools}, extended_group_iterator{last, pools}};
     }
 
+    /**
+     * @brief Iterates owned components one chunk at a time and applies the
+     * given function object to them.
+     *
+     * Owned components are tightly packed and aligned across their pools.
+     * Therefore, the group is split in chunks that never cross a page of any
+     * owned storage and the function object is provided with contiguous arrays
+     * of entities and owned components, along with the number of elements in
+     * each chunk. Components that aren't owned aren't returned.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, Owned *..., const size_type);
+     * @endcode
+     *
+     * Chunks are returned in the order in which they are laid out in memory,
+     * that is, the order of the elements is reversed with respect to the one
+     * of a plain iteration.
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned during iterations.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        static_assert(!(soa_layout_v<std::remove_const_t<Owned>> || ...), "Structure of arrays isn't supported");
+        constexpr auto page = (std::min)({size_type{ENTT_PACKED_PAGE}, (ignore_as_empty_v<std::remove_const_t<Owned>> ? size_type{ENTT_PACKED_PAGE} : size_type{component_traits<std::remove_const_t<Owned>>::page_size})...});
+
+        for(size_type pos{}, last = size(); pos < last; pos += page) {
+            std::apply(func, std::tuple_cat(std::make_tuple(std::get<0>(pools)->data() + pos), chunk_of<Owned>(pos)..., std::make_tuple((std::min)(page, last - pos))));
+        }
+    }
+
     /**
      * @brief Sort a group according to the given comparison function.
      *
@@ -859,6 +971,19 @@ public:
      * * An iterator past the last element of the range to sort.
      * * A comparison function to use to compare the elements.
      *
+     * Sort function objects that work on keys, such as `radix_sort`, are also
+     * supported. In this case, the function object passed to the group returns
+     * the key of an element and its signature is equivalent to one of the
+     * following instead:
+     *
+     * @code{.cpp}
+     * Key(const Component &...);
+     * Key(const Entity);
+     * @endcode
+     *
+     * The order of the first owned storage is applied to all the other owned
+     * pools at once, without comparing the elements again.
+     *
      * @tparam Comp Optional types of components to compare.
      * @tparam Compare Type of comparison function object.
      * @tparam Sort Type of sort function object.
@@ -872,8 +997,14 @@ public:
         auto *cpool = std::get<0>(pools);
 
         if constexpr(sizeof...(Comp) == 0) {
-            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type>, "Invalid comparison function");
+            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type> || std::is_invocable_v<Compare, const entity_type>, "Invalid comparison function");
             cpool->sort_n(*length, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(!std::is_invocable_v<Compare, decltype(std::declval<basic_group>().template get<Comp...>({})), decltype(std::declval<basic_group>().template get<Comp...>({}))>) {
+            auto getter = [this, &compare](const entity_type entt) {
+                return compare(std::as_const(*std::get<storage_type<Comp> *>(pools)).get(entt)...);
+            };
+
+            cpool->sort_n(*length, std::move(getter), std::move(algo), std::forward<Args>(args)...);
         } else {
             auto comp = [this, &compare](const entity_type lhs, const entity_type rhs) {
                 if constexpr(sizeof...(Comp) == 1) {
@@ -887,17 +1018,16 @@ public:
         }
 
         [this](auto *head, auto *...other) {
-            for(auto next = *length; next; --next) {
-                const auto pos = next - 1;
-                [[maybe_unused]] const auto entt = head->data()[pos];
-                (other->swap_elements(other->data()[pos], entt), ...);
-            }
+            // the same permutation is applied to all other owned pools at once
+            [[maybe_unused]] const auto last = head->basic_common_type::end();
+            (other->sort_as(last - static_cast<typename iterator::difference_type>(*length), last), ...);
         }(std::get<storage_type<Owned> *>(pools)...);
     }
 
 private:
     const std::tuple<storage_type<Owned> *..., storage_type<Get> *...> pools;
     const size_type *const length;
+    const mask_type *disabled;
 };
 
 } // namespace entt
@@ -1,6 +1,9 @@
 #ifndef ENTT_ENTITY_HANDLE_HPP
 #define ENTT_ENTITY_HANDLE_HPP
 
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -8,19 +11,45 @@
 #include "../core/type_traits.hpp"
 #include "fwd.hpp"
 #include "registry.hpp"
+#include "storage.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Base, std::size_t Len>
+struct handle_pools {
+    std::array<Base *, Len> pools;
+};
+
+template<typename Base>
+struct handle_pools<Base, 0u> {};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Non-owning handle to an entity.
  *
- * Tiny wrapper around a registry and an entity.
+ * Tiny wrapper around a registry and an entity.<br/>
+ * Non-const handles restricted to a given set of types also keep track of the
+ * pools for these types, much like a view does. Accessing their components
+ * doesn't go through the registry this way.
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Types to which to restrict the scope of a handle.
  */
 template<typename Entity, typename... Type>
-struct basic_handle {
+struct basic_handle: private internal::handle_pools<typename basic_registry<std::remove_const_t<Entity>>::base_type, std::is_const_v<Entity> ? 0u : sizeof...(Type)> {
     /*! @brief Type of registry accepted by the handle. */
     using registry_type = constness_as_t<basic_registry<std::remove_const_t<Entity>>, Entity>;
     /*! @brief Underlying entity identifier. */
@@ -32,17 +61,27 @@ struct basic_handle {
 
     /*! @brief Constructs an invalid handle. */
     basic_handle() ENTT_NOEXCEPT
-        : reg{},
+        : pools_base{},
+          reg{},
           entt{null} {}
 
     /**
      * @brief Constructs a handle from a given registry and entity.
+     *
+     * Pools for the types to which the handle is restricted are created if
+     * they don't exist yet, unless the registry is const.
+     *
      * @param ref An instance of the registry class.
      * @param value A valid identifier.
      */
-    basic_handle(registry_type &ref, entity_type value) ENTT_NOEXCEPT
-        : reg{&ref},
-          entt{value} {}
+    basic_handle(registry_type &ref, entity_type value)
+        : pools_base{},
+          reg{&ref},
+          entt{value} {
+        if constexpr(cached) {
+            this->pools = {&ref.template storage<std::remove_const_t<Type>>()...};
+        }
+    }
 
     /**
      * @brief Constructs a const handle from a non-const one.
@@ -52,7 +91,7 @@ struct basic_handle {
      * entity.
      */
     template<typename Other, typename... Args>
-    operator basic_handle<Other, Args...>() const ENTT_NOEXCEPT {
+    operator basic_handle<Other, Args...>() const {
         static_assert(std::is_same_v<Other, Entity> || std::is_same_v<std::remove_const_t<Other>, Entity>, "Invalid conversion between different handles");
         static_assert((sizeof...(Type) == 0 || ((sizeof...(Args) != 0 && sizeof...(Args) <= sizeof...(Type)) && ... && (type_list_contains_v<type_list<Type...>, Args>))), "Invalid conversion between different handles");
 
@@ -127,7 +166,13 @@ struct basic_handle {
     template<typename Component, typename... Args>
     decltype(auto) emplace(Args &&...args) const {
         static_assert(((sizeof...(Type) == 0) || ... || std::is_same_v<Component, Type>), "Invalid type");
-        return reg->template emplace<Component>(entt, std::forward<Args>(args)...);
+
+        if constexpr(cached) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return pool<Component>().emplace(entt, std::forward<Args>(args)...);
+        } else {
+            return reg->template emplace<Component>(entt, std::forward<Args>(args)...);
+        }
     }
 
     /**
@@ -203,7 +248,12 @@ struct basic_handle {
      */
     template<typename... Component>
     [[nodiscard]] decltype(auto) all_of() const {
-        return reg->template all_of<Component...>(entt);
+        if constexpr(cached && (type_list_contains_v<type_list<Type...>, Component> && ...)) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return (pool<Component>().contains(entt) && ...);
+        } else {
+            return reg->template all_of<Component...>(entt);
+        }
     }
 
     /**
@@ -215,7 +265,12 @@ struct basic_handle {
      */
     template<typename... Component>
     [[nodiscard]] decltype(auto) any_of() const {
-        return reg->template any_of<Component...>(entt);
+        if constexpr(cached && (type_list_contains_v<type_list<Type...>, Component> && ...)) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return (pool<Component>().contains(entt) || ...);
+        } else {
+            return reg->template any_of<Component...>(entt);
+        }
     }
 
     /**
@@ -227,7 +282,16 @@ struct basic_handle {
     template<typename... Component>
     [[nodiscard]] decltype(auto) get() const {
         static_assert(sizeof...(Type) == 0 || (type_list_contains_v<type_list<Type...>, Component> && ...), "Invalid type");
-        return reg->template get<Component...>(entt);
+
+        if constexpr(!cached) {
+            return reg->template get<Component...>(entt);
+        } else if constexpr(sizeof...(Component) == 1u) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return (pool<Component>().get(entt), ...);
+        } else {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return std::tuple_cat(pool<Component>().get_as_tuple(entt)...);
+        }
     }
 
     /**
@@ -241,7 +305,14 @@ struct basic_handle {
     template<typename Component, typename... Args>
     [[nodiscard]] decltype(auto) get_or_emplace(Args &&...args) const {
         static_assert(((sizeof...(Type) == 0) || ... || std::is_same_v<Component, Type>), "Invalid type");
-        return reg->template get_or_emplace<Component>(entt, std::forward<Args>(args)...);
+
+        if constexpr(cached) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            auto &cpool = pool<Component>();
+            return cpool.contains(entt) ? cpool.get(entt) : cpool.emplace(entt, std::forward<Args>(args)...);
+        } else {
+            return reg->template get_or_emplace<Component>(entt, std::forward<Args>(args)...);
+        }
     }
 
     /**
@@ -253,7 +324,15 @@ struct basic_handle {
     template<typename... Component>
     [[nodiscard]] auto try_get() const {
         static_assert(sizeof...(Type) == 0 || (type_list_contains_v<type_list<Type...>, Component> && ...), "Invalid type");
-        return reg->template try_get<Component...>(entt);
+
+        if constexpr(!cached) {
+            return reg->template try_get<Component...>(entt);
+        } else if constexpr(sizeof...(Component) == 1u) {
+            ENTT_ASSERT(reg->valid(entt), "Invalid entity");
+            return ((pool<Component>().contains(entt) ? std::addressof(pool<Component>().get(entt)) : nullptr), ...);
+        } else {
+            return std::make_tuple(try_get<Component>()...);
+        }
     }
 
     /**
@@ -289,6 +368,15 @@ struct basic_handle {
     }
 
 private:
+    using pools_base = internal::handle_pools<typename basic_registry<std::remove_const_t<Entity>>::base_type, std::is_const_v<Entity> ? 0u : sizeof...(Type)>;
+    static constexpr bool cached = !std::is_const_v<Entity> && (sizeof...(Type) != 0u);
+
+    template<typename Component>
+    [[nodiscard]] auto &pool() const {
+        using storage_type = typename storage_traits<entity_type, std::remove_const_t<Component>>::storage_type;
+        return static_cast<constness_as_t<storage_type, Component> &>(*this->pools[type_list_index_v<Component, type_list<Type...>>]);
+    }
+
     registry_type *reg;
     entity_type entt;
 };
@@ -0,0 +1,276 @@
+#ifndef ENTT_ENTITY_HIERARCHY_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_HIERARCHY_STORAGE_MIXIN_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Mixin type used to lay out hierarchies depth-first in storage types.
+ *
+ * The parent function object returns the parent of an instance, if any. Its
+ * signature must be equivalent to the following form:
+ *
+ * @code{.cpp}
+ * entity_type(const value_type &);
+ * @endcode
+ *
+ * Instances whose parent is null or doesn't belong to the storage are roots.
+ * The storage is arranged depth-first on demand, so that iterating it returns
+ * parents before their children and the instances of a subtree are tightly
+ * packed in memory. Arranging a storage takes linear time and doesn't compare
+ * instances.<br/>
+ * Creating, patching or destroying instances invalidates the arrangement. The
+ * storage is arranged again on the next traversal.
+ *
+ * @warning
+ * Modifying instances by means of references or sorting the storage in any
+ * other way isn't detected. Use `patch` or `invalidate` in these cases.
+ *
+ * @warning
+ * Storage classes that are owned by a group cannot be arranged depth-first.
+ *
+ * @tparam Type The type of the underlying storage.
+ * @tparam Parent Type of function object to use to get the parent of instances.
+ */
+template<typename Type, typename Parent>
+class hierarchy_storage_mixin: public Type {
+    static_assert(!component_traits<typename Type::value_type>::in_place_delete, "Hierarchy storage does not support in-place delete");
+    static_assert(!ignore_as_empty_v<typename Type::value_type>, "Hierarchy storage requires non-empty types");
+
+    static constexpr auto npos = (std::numeric_limits<std::size_t>::max)();
+
+    void mark() ENTT_NOEXCEPT {
+        ++changes;
+    }
+
+    void arrange() {
+        const auto length = Type::size();
+        std::vector<std::size_t> up(length, npos);
+        std::vector<std::size_t> child(length, npos);
+        std::vector<std::size_t> sibling(length, npos);
+        std::vector<std::size_t> stack{};
+
+        // children are pushed on the stack in reverse order of iteration
+        for(auto pos = length; pos; --pos) {
+            if(const auto other = parent(this->rbegin()[pos - 1u]); other != null && Type::contains(other)) {
+                up[pos - 1u] = Type::index(other);
+                sibling[pos - 1u] = std::exchange(child[up[pos - 1u]], pos - 1u);
+            }
+        }
+
+        std::vector<typename Type::entity_type> order{};
+        std::vector<std::size_t> visit(length, npos);
+        order.reserve(length);
+
+        for(auto pos = length; pos; --pos) {
+            if(up[pos - 1u] == npos) {
+                stack.push_back(pos - 1u);
+            }
+
+            while(!stack.empty()) {
+                const auto curr = stack.back();
+                stack.pop_back();
+                visit[curr] = order.size();
+                order.push_back(Type::data()[curr]);
+
+                for(auto next = child[curr]; next != npos; next = sibling[next]) {
+                    stack.push_back(next);
+                }
+            }
+        }
+
+        // instances that are part of a cycle are never visited
+        for(auto pos = length; pos; --pos) {
+            if(visit[pos - 1u] == npos) {
+                up[pos - 1u] = npos;
+                visit[pos - 1u] = order.size();
+                order.push_back(Type::data()[pos - 1u]);
+            }
+        }
+
+        // the k-th instance visited lands in position length - k - 1
+        parents.assign(length, npos);
+
+        for(std::size_t pos{}; pos < length; ++pos) {
+            if(up[pos] != npos) {
+                parents[length - visit[pos] - 1u] = length - visit[up[pos]] - 1u;
+            }
+        }
+
+        Type::sort_as(order.begin(), order.end());
+        changes = {};
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        mark();
+        Type::swap_and_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::pop_n */
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) override {
+        mark();
+        Type::pop_n(first, last);
+    }
+
+    /*! @copydoc basic_sparse_set::pop_all */
+    void pop_all() override {
+        mark();
+        Type::pop_all();
+    }
+
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        mark();
+        return Type::try_emplace(entt, force_back, value, move);
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Checks whether a storage is arranged depth-first.
+     * @return True if the storage is arranged depth-first, false otherwise.
+     */
+    [[nodiscard]] bool arranged() const ENTT_NOEXCEPT {
+        return !changes && (parents.size() == Type::size());
+    }
+
+    /*! @brief Forces the storage to be arranged again on next traversal. */
+    void invalidate() ENTT_NOEXCEPT {
+        mark();
+    }
+
+    /**
+     * @brief Arranges the storage depth-first if required.
+     * @return Number of instances in the storage.
+     */
+    size_type refresh() {
+        if(!arranged()) {
+            arrange();
+        }
+
+        return Type::size();
+    }
+
+    /**
+     * @brief Iterates the instances parent first and applies the given
+     * function object to them.
+     *
+     * The storage is arranged first if required. Instances are returned in the
+     * same order in which the storage is iterated, along with a pointer to the
+     * instance of their parent, if any. Parents aren't looked up, therefore a
+     * traversal is a linear sweep of the storage.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type, value_type &, value_type *);
+     * @endcode
+     *
+     * @warning
+     * Creating or destroying instances from within the function object
+     * results in undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void traverse(Func func) {
+        refresh();
+
+        for(auto pos = Type::size(); pos; --pos) {
+            const auto up = parents[pos - 1u];
+            func(Type::data()[pos - 1u], this->rbegin()[pos - 1u], (up == npos) ? nullptr : std::addressof(this->rbegin()[up]));
+        }
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        mark();
+        return Type::emplace(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        mark();
+        return Type::patch(entt, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        changes += Type::size() - from;
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        changes += Type::size() - from;
+    }
+
+private:
+    std::vector<size_type> parents{};
+    size_type changes{};
+    Parent parent{};
+};
+
+} // namespace entt
+
+#endif
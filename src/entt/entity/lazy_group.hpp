@@ -0,0 +1,245 @@
+#ifndef ENTT_ENTITY_LAZY_GROUP_HPP
+#define ENTT_ENTITY_LAZY_GROUP_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "storage.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+struct lazy_group_claims {
+    dense_map<id_type, const void *, identity> owner{};
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Lazy group.
+ *
+ * A lazy group arranges its pools like a full-owning group does, so that the
+ * entities that have all the components are packed at the beginning of each
+ * pool and in the same order. However, it doesn't get the ownership of the
+ * components and the pools aren't kept in sync as changes occur.<br/>
+ * Instead, assigning or removing a component only marks the group as dirty and
+ * the pools are arranged again the first time the group is used afterwards.
+ * Arranging the pools costs linear time in the size of the shortest pool.
+ *
+ * Any number of lazy groups can share the same components. When two of them
+ * overlap, the last one to arrange the pools invalidates the other one, that
+ * arranges them again on next use. Iterating a valid lazy group is as fast as
+ * iterating a full-owning group.
+ *
+ * @warning
+ * Lazy groups are incompatible with storage classes owned by a group. Sorting
+ * or otherwise rearranging their pools requires an explicit call to
+ * `invalidate`.
+ *
+ * @warning
+ * Lifetime of a lazy group must not overcome that of the registry that
+ * generated it. In any other case, attempting to use a lazy group results in
+ * undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components iterated by the group.
+ */
+template<typename Entity, typename... Component>
+class basic_lazy_group final {
+    static_assert(sizeof...(Component) > 1u, "Single component lazy groups are not allowed");
+    static_assert((std::is_same_v<Component, std::decay_t<Component>> && ...), "Non-decayed types not allowed");
+    // nasty workaround for an issue with the toolset v141 that doesn't accept a fold expression here
+    static_assert(!std::disjunction_v<std::bool_constant<component_traits<Component>::in_place_delete>...>, "Lazy groups do not support in-place delete");
+    static_assert(std::conjunction_v<std::bool_constant<emit_signals_v<Component>>...>, "Lazy groups require storage signals");
+
+    using registry_type = basic_registry<Entity>;
+    using claims_type = internal::lazy_group_claims;
+
+    template<typename Type>
+    using storage_type = typename storage_traits<Entity, Type>::storage_type;
+
+    template<typename Type>
+    [[nodiscard]] static auto index_to_element(storage_type<Type> &cpool, const std::size_t pos) {
+        if constexpr(ignore_as_empty_v<Type>) {
+            return std::make_tuple();
+        } else {
+            return std::forward_as_tuple(cpool.rbegin()[pos]);
+        }
+    }
+
+    void discard(registry_type &, const Entity) ENTT_NOEXCEPT {
+        dirty = true;
+    }
+
+    void arrange() {
+        ENTT_ASSERT(!reg->template owned<Component...>(), "Cannot arrange owned storage");
+        auto cpools = std::forward_as_tuple(reg->template storage<Component>()...);
+        const basic_sparse_set<Entity> *candidates = &std::get<0>(cpools);
+        ((candidates = std::get<storage_type<Component> &>(cpools).size() < candidates->size() ? &std::get<storage_type<Component> &>(cpools) : candidates), ...);
+        length = 0u;
+
+        for(size_type pos{}, last = candidates->size(); pos < last; ++pos) {
+            if(const auto entt = candidates->data()[pos]; (std::get<storage_type<Component> &>(cpools).contains(entt) && ...)) {
+                (std::get<storage_type<Component> &>(cpools).swap_elements(std::get<storage_type<Component> &>(cpools).data()[length], entt), ...);
+                ++length;
+            }
+        }
+
+        auto &claims = reg->ctx().template emplace<claims_type>();
+        ((claims.owner[type_hash<Component>::value()] = this), ...);
+        dirty = false;
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a lazy group that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_lazy_group(registry_type &source)
+        : reg{&source},
+          length{},
+          dirty{true} {
+        (reg->template on_construct<Component>().template connect<&basic_lazy_group::discard>(*this), ...);
+        (reg->template on_destroy<Component>().template connect<&basic_lazy_group::discard>(*this), ...);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_lazy_group(const basic_lazy_group &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_lazy_group(basic_lazy_group &&) = delete;
+
+    /*! @brief Disconnects the group and releases its claims on the pools. */
+    ~basic_lazy_group() {
+        (reg->template on_construct<Component>().disconnect(*this), ...);
+        (reg->template on_destroy<Component>().disconnect(*this), ...);
+
+        if(auto *claims = reg->ctx().template find<claims_type>(); claims) {
+            ([claims, this](const id_type id) {
+                if(const auto it = claims->owner.find(id); it != claims->owner.end() && it->second == this) {
+                    claims->owner.erase(it);
+                }
+            }(type_hash<Component>::value()),
+             ...);
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This lazy group.
+     */
+    basic_lazy_group &operator=(const basic_lazy_group &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This lazy group.
+     */
+    basic_lazy_group &operator=(basic_lazy_group &&) = delete;
+
+    /**
+     * @brief Checks whether the pools are arranged for the group.
+     * @return True if the pools are arranged for the group, false otherwise.
+     */
+    [[nodiscard]] bool arranged() const {
+        if(const auto *claims = reg->ctx().template find<claims_type>(); !dirty && claims) {
+            return ([claims, this](const id_type id) {
+                const auto it = claims->owner.find(id);
+                return it != claims->owner.cend() && it->second == this;
+            }(type_hash<Component>::value())
+                    && ...);
+        }
+
+        return false;
+    }
+
+    /*! @brief Forces the group to arrange the pools again on next use. */
+    void invalidate() ENTT_NOEXCEPT {
+        dirty = true;
+    }
+
+    /**
+     * @brief Arranges the pools for the group if required.
+     * @return Number of entities that have all the given components.
+     */
+    size_type refresh() {
+        if(!arranged()) {
+            arrange();
+        }
+
+        return length;
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The pools are arranged first if required. The function object is
+     * invoked for each entity. It is provided with the entity itself and a set
+     * of references to non-empty components. The signature of the function
+     * must be equivalent to one of the following forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &...);
+     * void(Type &...);
+     * @endcode
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned during iterations.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        refresh();
+        auto cpools = std::forward_as_tuple(reg->template storage<Component>()...);
+        const auto *entities = std::get<0>(cpools).data();
+
+        for(auto pos = length; pos; --pos) {
+            const auto args = std::tuple_cat(std::make_tuple(entities[pos - 1u]), index_to_element<Component>(std::get<storage_type<Component> &>(cpools), pos - 1u)...);
+
+            if constexpr(is_applicable_v<Func, decltype(args)>) {
+                std::apply(func, args);
+            } else {
+                std::apply([&func](auto, auto &&...less) { func(std::forward<decltype(less)>(less)...); }, args);
+            }
+        }
+    }
+
+private:
+    registry_type *reg;
+    size_type length;
+    bool dirty;
+};
+
+} // namespace entt
+
+#endif
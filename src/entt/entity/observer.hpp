@@ -1,12 +1,17 @@
 #ifndef ENTT_ENTITY_OBSERVER_HPP
 #define ENTT_ENTITY_OBSERVER_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "../signal/delegate.hpp"
 #include "entity.hpp"
@@ -133,6 +138,10 @@ inline constexpr basic_collector<> collector{};
  * If an entity respects the requirements of multiple matchers, it will be
  * returned once and only once by the observer in any case.
  *
+ * Observers are also double-buffered. Swapping the buffers freezes the current
+ * set of entities in a snapshot and starts collecting a new one, so that the
+ * snapshot can be consumed while the observer keeps tracking changes.
+ *
  * Matchers support also filtering by means of a _where_ clause that accepts
  * both a list of types and an exclusion list.<br/>
  * Whenever a matcher finds that an entity matches its requirements, the
@@ -275,7 +284,8 @@ public:
     /*! @brief Default constructor. */
     basic_observer()
         : release{},
-          storage{} {}
+          storage{},
+          frozen{} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_observer(const basic_observer &) = delete;
@@ -318,6 +328,7 @@ public:
         disconnect();
         connect<Matcher...>(reg, std::index_sequence_for<Matcher...>{});
         storage.clear();
+        frozen.clear();
     }
 
     /*! @brief Disconnects an observer from the registry it keeps track of. */
@@ -336,6 +347,14 @@ public:
         return storage.size();
     }
 
+    /**
+     * @brief Returns the memory currently allocated by an observer.
+     * @return The memory currently allocated by the observer.
+     */
+    [[nodiscard]] memory_footprint memory_usage() const {
+        return storage.memory_usage();
+    }
+
     /**
      * @brief Checks whether an observer is empty.
      * @return True if the observer is empty, false otherwise.
@@ -391,6 +410,37 @@ public:
         storage.clear();
     }
 
+    /**
+     * @brief Freezes the entities collected so far in a snapshot and starts
+     * collecting a new set of entities.
+     *
+     * The buffers are exchanged in constant time. The previous snapshot is
+     * discarded and its memory is reused to collect the new set of entities.
+     *
+     * @warning
+     * The snapshot isn't updated afterwards. Entities that no longer match the
+     * requirements of the observer or that have been destroyed in the meantime
+     * are still part of it.
+     */
+    void swap() {
+        storage.swap(frozen);
+        storage.clear();
+    }
+
+    /**
+     * @brief Returns the entities frozen by the last call to `swap`.
+     *
+     * The snapshot and the entities collected by the observer are stored in
+     * different containers. Therefore, the snapshot can be safely iterated
+     * from a thread while the observer is updated from another one, as long as
+     * calls to `swap` are synchronized with both.
+     *
+     * @return The entities frozen by the last call to `swap`.
+     */
+    [[nodiscard]] const basic_sparse_set<entity_type> &snapshot() const ENTT_NOEXCEPT {
+        return frozen;
+    }
+
     /**
      * @brief Iterates entities and applies the given function object to them.
      *
@@ -429,6 +479,300 @@ public:
 private:
     delegate<void(basic_observer &)> release;
     basic_storage<entity_type, payload_type> storage;
+    basic_storage<entity_type, payload_type> frozen;
+};
+
+
+/**
+ * @brief Set of lightweight observers.
+ *
+ * An observer set behaves like a collection of observers that share the same
+ * data structures. Each entity gets a single bitmask with one bit per matcher
+ * and each storage signal is connected at most once, no matter how many
+ * observers are interested in it.<br/>
+ * Therefore, adding an observer to the set costs a few bits per entity rather
+ * than a new storage and a bunch of listeners.
+ *
+ * Observers are identified by the value returned when they are added to the
+ * set. Iterating an observer or clearing it runs through all the entities of
+ * the set, no matter what observer they belong to.
+ *
+ * @warning
+ * Up to `sizeof(mask_type) * 8` matchers can be shared by a single set.
+ *
+ * @warning
+ * Lifetime of an observer set must not overcome that of the registry to which
+ * it's connected. In any other case, attempting to use an observer set results
+ * in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_observer_set final {
+    using registry_type = basic_registry<Entity>;
+    using condition_type = bool(const registry_type &, const Entity);
+
+    enum signal_kind : std::size_t {
+        construct_kind,
+        update_kind,
+        destroy_kind
+    };
+
+    struct trigger {
+        std::uint64_t discard{};
+        std::vector<std::pair<std::uint64_t, condition_type *>> match{};
+    };
+
+    struct slot {
+        trigger kind[3u]{};
+        void (*release)(basic_observer_set &, registry_type &){};
+    };
+
+    template<typename>
+    struct matcher_handler;
+
+    template<typename... Reject, typename... Require, typename AnyOf>
+    struct matcher_handler<matcher<type_list<Reject...>, type_list<Require...>, AnyOf>> {
+        static bool condition(const registry_type &reg, const Entity entt) {
+            return reg.template all_of<Require...>(entt) && !reg.template any_of<Reject...>(entt);
+        }
+
+        static void connect(basic_observer_set &set, const std::uint64_t bit) {
+            (set.discard_on<Require, destroy_kind>(bit), ...);
+            (set.discard_on<Reject, construct_kind>(bit), ...);
+            set.match_on<AnyOf, update_kind>(bit, &condition);
+            set.discard_on<AnyOf, destroy_kind>(bit);
+        }
+    };
+
+    template<typename... Reject, typename... Require, typename... NoneOf, typename... AllOf>
+    struct matcher_handler<matcher<type_list<Reject...>, type_list<Require...>, type_list<NoneOf...>, AllOf...>> {
+        template<typename... Ignore>
+        static bool condition(const registry_type &reg, const Entity entt) {
+            if constexpr(sizeof...(Ignore) == 0) {
+                return reg.template all_of<AllOf..., Require...>(entt) && !reg.template any_of<NoneOf..., Reject...>(entt);
+            } else {
+                return reg.template all_of<AllOf..., Require...>(entt) && ((std::is_same_v<Ignore..., NoneOf> || !reg.template any_of<NoneOf>(entt)) && ...) && !reg.template any_of<Reject...>(entt);
+            }
+        }
+
+        static void connect(basic_observer_set &set, const std::uint64_t bit) {
+            (set.discard_on<Require, destroy_kind>(bit), ...);
+            (set.discard_on<Reject, construct_kind>(bit), ...);
+            (set.match_on<AllOf, construct_kind>(bit, &condition<>), ...);
+            (set.match_on<NoneOf, destroy_kind>(bit, &condition<NoneOf>), ...);
+            (set.discard_on<AllOf, destroy_kind>(bit), ...);
+            (set.discard_on<NoneOf, construct_kind>(bit), ...);
+        }
+    };
+
+    template<typename Component, std::size_t Kind>
+    void listen(registry_type &owner, const Entity entt) {
+        const auto &elem = slots.find(type_hash<Component>::value())->second.kind[Kind];
+
+        if(elem.discard && storage.contains(entt) && !(storage.get(entt) &= ~elem.discard)) {
+            storage.erase(entt);
+        }
+
+        for(auto &&[bit, condition]: elem.match) {
+            if(condition(owner, entt)) {
+                if(!storage.contains(entt)) {
+                    storage.emplace(entt);
+                }
+
+                storage.get(entt) |= bit;
+            }
+        }
+    }
+
+    template<typename Component>
+    static void release(basic_observer_set &set, registry_type &reg) {
+        reg.template on_construct<Component>().disconnect(set);
+        reg.template on_update<Component>().disconnect(set);
+        reg.template on_destroy<Component>().disconnect(set);
+    }
+
+    template<typename Component>
+    [[nodiscard]] slot &assure() {
+        auto &&elem = slots[type_hash<Component>::value()];
+
+        if(!elem.release) {
+            reg->template on_construct<Component>().template connect<&basic_observer_set::listen<Component, construct_kind>>(*this);
+            reg->template on_update<Component>().template connect<&basic_observer_set::listen<Component, update_kind>>(*this);
+            reg->template on_destroy<Component>().template connect<&basic_observer_set::listen<Component, destroy_kind>>(*this);
+            elem.release = &basic_observer_set::release<Component>;
+        }
+
+        return elem;
+    }
+
+    template<typename Component, std::size_t Kind>
+    void discard_on(const std::uint64_t bit) {
+        assure<Component>().kind[Kind].discard |= bit;
+    }
+
+    template<typename Component, std::size_t Kind>
+    void match_on(const std::uint64_t bit, condition_type *condition) {
+        assure<Component>().kind[Kind].match.emplace_back(bit, condition);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of the masks, one bit per matcher. */
+    using mask_type = std::uint64_t;
+
+    /**
+     * @brief Constructs an observer set that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_observer_set(registry_type &source)
+        : storage{},
+          slots{},
+          columns{},
+          matchers{},
+          reg{&source} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_observer_set(const basic_observer_set &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_observer_set(basic_observer_set &&) = delete;
+
+    /*! @brief Disconnects the observer set from the registry. */
+    ~basic_observer_set() {
+        for(auto &&elem: slots) {
+            elem.second.release(*this, *reg);
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This observer set.
+     */
+    basic_observer_set &operator=(const basic_observer_set &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This observer set.
+     */
+    basic_observer_set &operator=(basic_observer_set &&) = delete;
+
+    /**
+     * @brief Adds an observer to the set.
+     *
+     * Entities that already match the requirements of the new observer aren't
+     * returned until a relevant change occurs, as it happens with observers.
+     *
+     * @tparam Matcher Types of matchers to use to initialize the observer.
+     * @return The identifier of the newly added observer.
+     */
+    template<typename... Matcher>
+    size_type add(basic_collector<Matcher...>) {
+        ENTT_ASSERT(matchers + sizeof...(Matcher) <= std::numeric_limits<mask_type>::digits, "Too many matchers");
+        auto &column = columns.emplace_back();
+        ((matcher_handler<Matcher>::connect(*this, mask_type{1u} << matchers), column |= mask_type{1u} << matchers++), ...);
+        return columns.size() - 1u;
+    }
+
+    /**
+     * @brief Returns the number of observers in the set.
+     * @return Number of observers in the set.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return columns.size();
+    }
+
+    /**
+     * @brief Checks if an observer contains an entity.
+     * @param id A valid observer identifier.
+     * @param entt A valid identifier.
+     * @return True if the observer contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const size_type id, const entity_type entt) const {
+        ENTT_ASSERT(id < columns.size(), "Invalid observer");
+        return storage.contains(entt) && (storage.get(entt) & columns[id]);
+    }
+
+    /**
+     * @brief Checks whether an observer is empty.
+     * @param id A valid observer identifier.
+     * @return True if the observer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty(const size_type id) const {
+        ENTT_ASSERT(id < columns.size(), "Invalid observer");
+        return std::none_of(storage.cbegin(), storage.cend(), [mask = columns[id]](const auto value) { return (value & mask) != mask_type{}; });
+    }
+
+    /**
+     * @brief Clears an observer.
+     * @param id A valid observer identifier.
+     */
+    void clear(const size_type id) {
+        ENTT_ASSERT(id < columns.size(), "Invalid observer");
+
+        for(auto pos = storage.size(); pos; --pos) {
+            if(const auto entt = storage.data()[pos - 1u]; !(storage.get(entt) &= ~columns[id])) {
+                storage.erase(entt);
+            }
+        }
+    }
+
+    /*! @brief Clears all the observers of the set. */
+    void clear() ENTT_NOEXCEPT {
+        storage.clear();
+    }
+
+    /**
+     * @brief Iterates the entities of an observer and applies the given
+     * function object to them.
+     *
+     * The function object is invoked for each entity.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param id A valid observer identifier.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const size_type id, Func func) const {
+        ENTT_ASSERT(id < columns.size(), "Invalid observer");
+
+        for(auto [entt, value]: storage.each()) {
+            if(value & columns[id]) {
+                func(entt);
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates the entities of an observer and applies the given
+     * function object to them, then clears the observer.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param id A valid observer identifier.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const size_type id, Func func) {
+        std::as_const(*this).each(id, std::move(func));
+        clear(id);
+    }
+
+private:
+    basic_storage<entity_type, mask_type> storage;
+    dense_map<id_type, slot, identity> slots;
+    std::vector<mask_type> columns;
+    size_type matchers;
+    registry_type *reg;
 };
 
 } // namespace entt
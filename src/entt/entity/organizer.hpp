@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_ORGANIZER_HPP
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -89,6 +90,117 @@ resource<type_list<std::remove_reference_t<Args>...>, type_list<Req...>> constra
 template<typename... Req>
 resource<type_list<>, type_list<Req...>> to_resource();
 
+template<typename... Req, typename Ret, typename View, typename... Args>
+resource<type_list<View, std::remove_reference_t<Args>...>, type_list<Req...>> split_function_to_resource(Ret (*)(View, std::size_t, std::size_t, Args...));
+
+template<typename Ret, typename View, typename... Args>
+[[nodiscard]] constexpr bool is_split_safe(Ret (*)(View, std::size_t, std::size_t, Args...)) {
+    return ((!std::is_reference_v<Args> || std::is_const_v<std::remove_reference_t<Args>> || is_view_v<std::remove_const_t<std::remove_reference_t<Args>>>) && ...);
+}
+
+template<typename Type, typename Entity>
+[[nodiscard]] decltype(auto) extract(basic_registry<Entity> &reg) {
+    if constexpr(std::is_same_v<Type, basic_registry<Entity>>) {
+        return reg;
+    } else if constexpr(is_view_v<Type>) {
+        return as_view{reg};
+    } else {
+        return reg.ctx().template emplace<std::remove_reference_t<Type>>();
+    }
+}
+
+template<typename Entity, typename... Args>
+[[nodiscard]] auto to_args(basic_registry<Entity> &reg, type_list<Args...>) {
+    return std::tuple<decltype(extract<Args>(reg))...>(extract<Args>(reg)...);
+}
+
+template<typename Type, typename... Other>
+inline constexpr bool same_as_any_v = (std::is_same_v<std::remove_const_t<Type>, std::remove_const_t<Other>> || ...);
+
+template<typename, typename>
+struct overlap;
+
+template<typename... Lhs, typename... Rhs>
+struct overlap<type_list<Lhs...>, type_list<Rhs...>>
+    : std::bool_constant<(same_as_any_v<Lhs, Rhs...> || ...)> {};
+
+template<typename Entity, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool conflicting() {
+    constexpr auto is_sync_point = [](auto resource) {
+        using resource_type = decltype(resource);
+        return type_list_contains_v<typename resource_type::args, basic_registry<Entity>> || (resource_type::ro::size + resource_type::rw::size == 0u);
+    };
+
+    return is_sync_point(Lhs{}) || is_sync_point(Rhs{})
+           || overlap<typename Lhs::rw, type_list_cat_t<typename Rhs::ro, typename Rhs::rw>>::value
+           || overlap<typename Rhs::rw, typename Lhs::ro>::value;
+}
+
+template<typename Entity, typename... Resource, std::size_t... Index>
+[[nodiscard]] constexpr auto static_conflicts(type_list<Resource...>, std::index_sequence<Index...>) {
+    using resources = type_list<Resource...>;
+    constexpr auto length = sizeof...(Resource);
+    return std::array<bool, sizeof...(Index)>{conflicting<Entity, type_list_element_t<Index / length, resources>, type_list_element_t<Index % length, resources>>()...};
+}
+
+template<typename Entity, typename... Resource>
+[[nodiscard]] constexpr auto static_levels(type_list<Resource...> resources) {
+    constexpr auto length = sizeof...(Resource);
+    const auto edges = static_conflicts<Entity>(resources, std::make_index_sequence<length * length>{});
+    std::array<std::size_t, length> level{};
+
+    // a function is one level below the deepest of the previous functions it conflicts with
+    for(std::size_t pos{}; pos < length; ++pos) {
+        for(std::size_t prev{}; prev < pos; ++prev) {
+            if(edges[prev * length + pos] && !(level[prev] < level[pos])) {
+                level[pos] = level[prev] + 1u;
+            }
+        }
+    }
+
+    return level;
+}
+
+template<std::size_t Length>
+[[nodiscard]] constexpr auto static_order(const std::array<std::size_t, Length> &level) {
+    std::array<std::size_t, Length> order{};
+
+    for(std::size_t curr{}, next{}; next < Length; ++curr) {
+        for(std::size_t pos{}; pos < Length; ++pos) {
+            if(level[pos] == curr) {
+                order[next++] = pos;
+            }
+        }
+    }
+
+    return order;
+}
+
+template<std::size_t Length>
+[[nodiscard]] constexpr auto static_offsets(const std::array<std::size_t, Length> &level) {
+    std::array<std::size_t, Length + 1u> offset{};
+
+    for(std::size_t pos{}; pos < Length; ++pos) {
+        ++offset[level[pos] + 1u];
+    }
+
+    for(std::size_t pos{}; pos < Length; ++pos) {
+        offset[pos + 1u] += offset[pos];
+    }
+
+    return offset;
+}
+
+template<typename View>
+[[nodiscard]] auto leading_size(const View &view, choice_t<1>) -> decltype(view.size_hint()) {
+    return view.size_hint();
+}
+
+template<typename View>
+[[nodiscard]] auto leading_size(const View &view, choice_t<0>) -> decltype(view.size()) {
+    return view.size();
+}
+
 } // namespace internal
 
 /**
@@ -122,22 +234,13 @@ class basic_organizer final {
         dependency_type *dependency;
         prepare_type *prepare{};
         const type_info *info{};
+        std::size_t cost{1u};
+        std::size_t chunk{};
+        std::size_t chunks{};
     };
 
-    template<typename Type>
-    [[nodiscard]] static decltype(auto) extract(basic_registry<Entity> &reg) {
-        if constexpr(std::is_same_v<Type, basic_registry<Entity>>) {
-            return reg;
-        } else if constexpr(internal::is_view_v<Type>) {
-            return as_view{reg};
-        } else {
-            return reg.ctx().template emplace<std::remove_reference_t<Type>>();
-        }
-    }
-
-    template<typename... Args>
-    [[nodiscard]] static auto to_args(basic_registry<Entity> &reg, type_list<Args...>) {
-        return std::tuple<decltype(extract<Args>(reg))...>(extract<Args>(reg)...);
+    [[nodiscard]] bool siblings(const std::size_t lhs, const std::size_t rhs) const {
+        return vertices[lhs].chunks && vertices[rhs].chunks && (lhs - vertices[lhs].chunk) == (rhs - vertices[rhs].chunk);
     }
 
     template<typename... Type>
@@ -152,81 +255,80 @@ class basic_organizer final {
         }
     }
 
+    void link(const std::vector<bool> &direct) {
+        const auto index = direct.size();
+        const auto from = incoming.size();
+        std::vector<bool> reach(index, false);
+
+        // a conflict that isn't reachable through a later one is an edge of the transitive reduction
+        for(auto col = index; col; --col) {
+            if(const auto pos = col - 1u; direct[pos] && !reach[pos]) {
+                const auto row = pos * (pos - 1u) / 2u;
+                reach[pos] = true;
+                incoming.push_back(pos);
+
+                for(std::size_t prev{}; prev < pos; ++prev) {
+                    reach[prev] = reach[prev] || closure[row + prev];
+                }
+            }
+        }
+
+        std::reverse(incoming.begin() + from, incoming.end());
+        incoming_offset.push_back(incoming.size());
+        closure.insert(closure.end(), reach.cbegin(), reach.cend());
+    }
+
     template<typename... RO, typename... RW>
     void track_dependencies(std::size_t index, const bool requires_registry, type_list<RO...>, type_list<RW...>) {
-        dependencies[type_hash<basic_registry<Entity>>::value()].emplace_back(index, requires_registry || (sizeof...(RO) + sizeof...(RW) == 0u));
-        (dependencies[type_hash<RO>::value()].emplace_back(index, false), ...);
-        (dependencies[type_hash<RW>::value()].emplace_back(index, true), ...);
+        std::vector<bool> direct(index, false);
+
+        // the chunks of a split task never conflict with each other
+        auto track = [this, index, &direct](const id_type id, const bool rw) {
+            auto &&deps = dependencies[id];
+
+            for(auto &&[other, other_rw]: deps) {
+                if(other != index && (rw || other_rw) && !siblings(other, index)) {
+                    direct[other] = true;
+                }
+            }
+
+            deps.emplace_back(index, rw);
+        };
+
+        track(type_hash<basic_registry<Entity>>::value(), requires_registry || (sizeof...(RO) + sizeof...(RW) == 0u));
+        (track(type_hash<RO>::value(), false), ...);
+        (track(type_hash<RW>::value(), true), ...);
+        link(direct);
     }
 
-    [[nodiscard]] std::vector<bool> adjacency_matrix() {
+    void refresh() {
         const auto length = vertices.size();
-        std::vector<bool> edges(length * length, false);
-
-        // creates the adjacency matrix
-        for(const auto &deps: dependencies) {
-            const auto last = deps.second.cend();
-            auto it = deps.second.cbegin();
-
-            while(it != last) {
-                if(it->second) {
-                    // rw item
-                    if(auto curr = it++; it != last) {
-                        if(it->second) {
-                            edges[curr->first * length + it->first] = true;
-                        } else {
-                            if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
-                                for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
-                                    edges[it->first * length + next->first] = true;
-                                }
-                            } else {
-                                for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
-                                }
-                            }
-                        }
-                    }
-                } else {
-                    // ro item, possibly only on first iteration
-                    if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
-                        for(; it != next; ++it) {
-                            edges[it->first * length + next->first] = true;
-                        }
-                    } else {
-                        it = last;
-                    }
-                }
+
+        if(outgoing_offset.size() != length + 1u) {
+            outgoing_offset.assign(length + 1u, 0u);
+            outgoing.resize(incoming.size());
+
+            for(auto elem: incoming) {
+                ++outgoing_offset[elem + 1u];
             }
-        }
 
-        // computes the transitive closure
-        for(std::size_t vk{}; vk < length; ++vk) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                for(std::size_t vj{}; vj < length; ++vj) {
-                    edges[vi * length + vj] = edges[vi * length + vj] || (edges[vi * length + vk] && edges[vk * length + vj]);
-                }
+            for(std::size_t pos{}; pos < length; ++pos) {
+                outgoing_offset[pos + 1u] += outgoing_offset[pos];
             }
-        }
 
-        // applies the transitive reduction
-        for(std::size_t vert{}; vert < length; ++vert) {
-            edges[vert * length + vert] = false;
-        }
+            // children are visited in order of insertion, as it happens with parents
+            std::vector<std::size_t> next{outgoing_offset.cbegin(), outgoing_offset.cend() - 1u};
 
-        for(std::size_t vj{}; vj < length; ++vj) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                if(edges[vi * length + vj]) {
-                    for(std::size_t vk{}; vk < length; ++vk) {
-                        if(edges[vj * length + vk]) {
-                            edges[vi * length + vk] = false;
-                        }
-                    }
+            for(std::size_t col{}; col < length; ++col) {
+                for(auto pos = parent_begin(col), last = incoming_offset[col]; pos < last; ++pos) {
+                    outgoing[next[incoming[pos]]++] = col;
                 }
             }
         }
+    }
 
-        return edges;
+    [[nodiscard]] std::size_t parent_begin(const std::size_t col) const ENTT_NOEXCEPT {
+        return col ? incoming_offset[col - 1u] : 0u;
     }
 
 public:
@@ -244,11 +346,15 @@ public:
          * @param vtype True if the vertex is a top-level one, false otherwise.
          * @param data The data associated with the vertex.
          * @param edges The indices of the children in the adjacency list.
+         * @param prio The length of the critical path from the vertex.
+         * @param thread The suggested worker for the vertex.
          */
-        vertex(const bool vtype, vertex_data data, std::vector<std::size_t> edges)
+        vertex(const bool vtype, vertex_data data, std::vector<std::size_t> edges, const std::size_t prio = {}, const std::size_t thread = {})
             : is_top_level{vtype},
               node{std::move(data)},
-              reachable{std::move(edges)} {}
+              reachable{std::move(edges)},
+              path{prio},
+              suggested{thread} {}
 
         /**
          * @brief Fills a buffer with the type info objects for the writable
@@ -322,10 +428,49 @@ public:
 
         /**
          * @brief Returns the payload associated with a vertex, if any.
+         *
+         * The chunks of a split task receive the information on the portion of
+         * the entities to visit through their payload.
+         *
          * @return The payload associated with the vertex, if any.
          */
         const void *data() const ENTT_NOEXCEPT {
-            return node.payload;
+            return node.chunks ? &node : node.payload;
+        }
+
+        /**
+         * @brief Returns the number of chunks of a split task.
+         * @return The number of chunks of the task, 0 if it's not split.
+         */
+        size_type chunks() const ENTT_NOEXCEPT {
+            return node.chunks;
+        }
+
+        /**
+         * @brief Returns the estimated cost of a vertex.
+         * @return The estimated cost of the vertex.
+         */
+        size_type cost() const ENTT_NOEXCEPT {
+            return node.cost;
+        }
+
+        /**
+         * @brief Returns the priority of a vertex, that is, the cost of the
+         * most expensive path from the vertex to the end of the graph, the
+         * vertex itself included.
+         * @return The priority of the vertex.
+         */
+        size_type priority() const ENTT_NOEXCEPT {
+            return path;
+        }
+
+        /**
+         * @brief Returns the worker suggested for a vertex by the list
+         * scheduling of the graph.
+         * @return The index of the suggested worker.
+         */
+        size_type worker() const ENTT_NOEXCEPT {
+            return suggested;
         }
 
         /**
@@ -349,6 +494,8 @@ public:
         bool is_top_level;
         vertex_data node;
         std::vector<std::size_t> reachable;
+        std::size_t path;
+        std::size_t suggested;
     };
 
     /**
@@ -363,7 +510,7 @@ public:
         constexpr auto requires_registry = type_list_contains_v<typename resource_type::args, basic_registry<entity_type>>;
 
         callback_type *callback = +[](const void *, basic_registry<entity_type> &reg) {
-            std::apply(Candidate, to_args(reg, typename resource_type::args{}));
+            std::apply(Candidate, internal::to_args(reg, typename resource_type::args{}));
         };
 
         vertex_data vdata{
@@ -373,11 +520,11 @@ public:
             nullptr,
             callback,
             +[](const bool rw, const type_info **buffer, const std::size_t length) { return rw ? fill_dependencies(typename resource_type::rw{}, buffer, length) : fill_dependencies(typename resource_type::ro{}, buffer, length); },
-            +[](basic_registry<entity_type> &reg) { void(to_args(reg, typename resource_type::args{})); },
+            +[](basic_registry<entity_type> &reg) { void(internal::to_args(reg, typename resource_type::args{})); },
             &type_id<std::integral_constant<decltype(Candidate), Candidate>>()};
 
-        track_dependencies(vertices.size(), requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
         vertices.push_back(std::move(vdata));
+        track_dependencies(vertices.size() - 1u, requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
     }
 
     /**
@@ -396,7 +543,7 @@ public:
 
         callback_type *callback = +[](const void *payload, basic_registry<entity_type> &reg) {
             Type *curr = static_cast<Type *>(const_cast<constness_as_t<void, Type> *>(payload));
-            std::apply(Candidate, std::tuple_cat(std::forward_as_tuple(*curr), to_args(reg, typename resource_type::args{})));
+            std::apply(Candidate, std::tuple_cat(std::forward_as_tuple(*curr), internal::to_args(reg, typename resource_type::args{})));
         };
 
         vertex_data vdata{
@@ -406,11 +553,11 @@ public:
             &value_or_instance,
             callback,
             +[](const bool rw, const type_info **buffer, const std::size_t length) { return rw ? fill_dependencies(typename resource_type::rw{}, buffer, length) : fill_dependencies(typename resource_type::ro{}, buffer, length); },
-            +[](basic_registry<entity_type> &reg) { void(to_args(reg, typename resource_type::args{})); },
+            +[](basic_registry<entity_type> &reg) { void(internal::to_args(reg, typename resource_type::args{})); },
             &type_id<std::integral_constant<decltype(Candidate), Candidate>>()};
 
-        track_dependencies(vertices.size(), requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
         vertices.push_back(std::move(vdata));
+        track_dependencies(vertices.size() - 1u, requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
     }
 
     /**
@@ -424,7 +571,6 @@ public:
     template<typename... Req>
     void emplace(function_type *func, const void *payload = nullptr, const char *name = nullptr) {
         using resource_type = internal::resource<type_list<>, type_list<Req...>>;
-        track_dependencies(vertices.size(), true, typename resource_type::ro{}, typename resource_type::rw{});
 
         vertex_data vdata{
             resource_type::ro::size,
@@ -437,35 +583,156 @@ public:
             &type_id<void>()};
 
         vertices.push_back(std::move(vdata));
+        track_dependencies(vertices.size() - 1u, true, typename resource_type::ro{}, typename resource_type::rw{});
+    }
+
+    /**
+     * @brief Adds a free function to the task list and splits it in chunks.
+     *
+     * The function is invoked once per chunk, possibly in parallel. It receives
+     * a view followed by the positions of the first entity of the chunk and the
+     * one past the last within the leading pool of the view, then all its other
+     * arguments. Chunks split the leading pool evenly and don't conflict with
+     * each other, even if they write to the same components. Any other task
+     * that accesses the same resources still waits for all of them.<br/>
+     * Chunks occupy consecutive positions in the task list.
+     *
+     * @warning
+     * Split tasks can only write to the components of their views. Context
+     * variables and the registry must be accessed in read-only mode and
+     * entities and components must not be created or destroyed.
+     *
+     * @tparam Candidate Function to add to the task list.
+     * @tparam Req Additional requirements and/or override resource access mode.
+     * @param count Number of chunks.
+     * @param name Optional name to associate with the task.
+     */
+    template<auto Candidate, typename... Req>
+    void emplace_split(const size_type count, const char *name = nullptr) {
+        using resource_type = decltype(internal::split_function_to_resource<Req...>(Candidate));
+        using view_type = type_list_element_t<0u, typename resource_type::args>;
+        constexpr auto requires_registry = type_list_contains_v<typename resource_type::args, basic_registry<entity_type>>;
+
+        static_assert(internal::is_view_v<view_type>, "The first argument must be a view");
+        static_assert(internal::is_split_safe(Candidate), "Split tasks cannot write context variables or the registry");
+        ENTT_ASSERT(count != 0u, "Invalid number of chunks");
+
+        callback_type *callback = +[](const void *payload, basic_registry<entity_type> &reg) {
+            const auto &curr = *static_cast<const vertex_data *>(payload);
+            auto args = internal::to_args(reg, typename resource_type::args{});
+
+            std::apply([&curr](view_type view, auto &&...other) {
+                const auto length = internal::leading_size(view, choice<1>);
+                Candidate(view, length * curr.chunk / curr.chunks, length * (curr.chunk + 1u) / curr.chunks, std::forward<decltype(other)>(other)...);
+            }, args);
+        };
+
+        for(size_type pos{}; pos < count; ++pos) {
+            vertex_data vdata{
+                resource_type::ro::size,
+                resource_type::rw::size,
+                name,
+                nullptr,
+                callback,
+                +[](const bool rw, const type_info **buffer, const std::size_t length) { return rw ? fill_dependencies(typename resource_type::rw{}, buffer, length) : fill_dependencies(typename resource_type::ro{}, buffer, length); },
+                +[](basic_registry<entity_type> &reg) { void(internal::to_args(reg, typename resource_type::args{})); },
+                &type_id<std::integral_constant<decltype(Candidate), Candidate>>(),
+                1u,
+                pos,
+                count};
+
+            vertices.push_back(std::move(vdata));
+            track_dependencies(vertices.size() - 1u, requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
+        }
+    }
+
+    /**
+     * @brief Sets the estimated cost of a task.
+     *
+     * Costs are expressed in arbitrary units, as long as they're the same for
+     * all tasks. They can be static hints or the times measured during the
+     * previous frames. By default, all tasks have a cost of 1.
+     *
+     * @param pos The index of the task, that is, its position in the order of
+     * insertion.
+     * @param value The estimated cost of the task.
+     */
+    void cost(const size_type pos, const size_type value) {
+        ENTT_ASSERT(pos < vertices.size(), "Index out of bounds");
+        vertices[pos].cost = value;
     }
 
     /**
      * @brief Generates a task graph for the current content.
+     *
+     * Each vertex is given a priority equal to the cost of the most expensive
+     * path from the vertex to the end of the graph. Vertices are then assigned
+     * to the given number of workers by means of list scheduling: the ready
+     * vertex with the highest priority goes to the worker that can start it
+     * first. Executors can rely on both to start heavy tasks as soon as
+     * possible.
+     *
+     * @param workers Number of workers for which to suggest an assignment.
      * @return The adjacency list of the task graph.
      */
-    std::vector<vertex> graph() {
-        const auto edges = adjacency_matrix();
+    std::vector<vertex> graph(const size_type workers = 1u) {
+        const auto length = vertices.size();
+        refresh();
 
-        // creates the adjacency list
-        std::vector<vertex> adjacency_list{};
-        adjacency_list.reserve(vertices.size());
+        // edges always go from a vertex to a later one, priorities are computed backwards
+        std::vector<size_type> priority(length);
 
-        for(std::size_t col{}, length = vertices.size(); col < length; ++col) {
-            std::vector<std::size_t> reachable{};
-            const auto row = col * length;
-            bool is_top_level = true;
+        for(auto col = length; col; --col) {
+            size_type longest{};
 
-            for(std::size_t next{}; next < length; ++next) {
-                if(edges[row + next]) {
-                    reachable.push_back(next);
-                }
+            for(auto pos = outgoing_offset[col - 1u], last = outgoing_offset[col]; pos < last; ++pos) {
+                longest = (std::max)(longest, priority[outgoing[pos]]);
+            }
+
+            priority[col - 1u] = vertices[col - 1u].cost + longest;
+        }
+
+        std::vector<size_type> worker(length);
+        std::vector<size_type> parents(length);
+        std::vector<size_type> ready_at(length);
+        std::vector<size_type> available((std::max)(workers, size_type{1u}));
+        std::vector<size_type> ready{};
+
+        for(size_type col{}; col < length; ++col) {
+            parents[col] = incoming_offset[col] - parent_begin(col);
+
+            if(parents[col] == 0u) {
+                ready.push_back(col);
             }
+        }
+
+        while(!ready.empty()) {
+            const auto it = std::max_element(ready.begin(), ready.end(), [&priority](const auto lhs, const auto rhs) { return priority[lhs] < priority[rhs] || (priority[lhs] == priority[rhs] && lhs > rhs); });
+            const auto curr = *it;
+            ready.erase(it);
+
+            const auto thread = static_cast<size_type>(std::min_element(available.cbegin(), available.cend(), [start = ready_at[curr]](const auto lhs, const auto rhs) { return (std::max)(lhs, start) < (std::max)(rhs, start); }) - available.cbegin());
+            const auto finish = (std::max)(available[thread], ready_at[curr]) + vertices[curr].cost;
+            available[thread] = finish;
+            worker[curr] = thread;
 
-            for(std::size_t next{}; next < length && is_top_level; ++next) {
-                is_top_level = !edges[next * length + col];
+            for(auto pos = outgoing_offset[curr], last = outgoing_offset[curr + 1u]; pos < last; ++pos) {
+                const auto next = outgoing[pos];
+                ready_at[next] = (std::max)(ready_at[next], finish);
+
+                if(--parents[next] == 0u) {
+                    ready.push_back(next);
+                }
             }
+        }
 
-            adjacency_list.emplace_back(is_top_level, vertices[col], std::move(reachable));
+        // creates the adjacency list
+        std::vector<vertex> adjacency_list{};
+        adjacency_list.reserve(length);
+
+        for(std::size_t col{}; col < length; ++col) {
+            std::vector<std::size_t> reachable(outgoing.cbegin() + outgoing_offset[col], outgoing.cbegin() + outgoing_offset[col + 1u]);
+            adjacency_list.emplace_back(parent_begin(col) == incoming_offset[col], vertices[col], std::move(reachable), priority[col], worker[col]);
         }
 
         return adjacency_list;
@@ -475,11 +742,138 @@ public:
     void clear() {
         dependencies.clear();
         vertices.clear();
+        closure.clear();
+        incoming.clear();
+        incoming_offset.clear();
+        outgoing.clear();
+        outgoing_offset.clear();
     }
 
 private:
     dense_map<id_type, std::vector<std::pair<std::size_t, bool>>, identity> dependencies;
     std::vector<vertex_data> vertices;
+    std::vector<bool> closure;
+    std::vector<std::size_t> incoming;
+    std::vector<std::size_t> incoming_offset;
+    std::vector<std::size_t> outgoing;
+    std::vector<std::size_t> outgoing_offset;
+};
+
+/**
+ * @brief Static task graph built at compile-time from a list of functions.
+ *
+ * Dependencies are deduced from the signatures of the functions during the
+ * compilation, in the same way the organizer does. Functions are then grouped
+ * in levels, so that the functions of a level don't conflict with each other
+ * and only depend on those of the previous levels.<br/>
+ * Functions are invoked directly rather than through type-erased callbacks and
+ * no graph is built at runtime.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Candidate Free functions to add to the task list, in order.
+ */
+template<typename Entity, auto... Candidate>
+class basic_static_organizer final {
+    using task_type = void(basic_registry<Entity> &);
+
+    template<auto Func>
+    static void invoke(basic_registry<Entity> &reg) {
+        using resource_type = decltype(internal::free_function_to_resource(Func));
+        std::apply(Func, internal::to_args(reg, typename resource_type::args{}));
+    }
+
+    static constexpr auto level = internal::static_levels<Entity>(type_list<decltype(internal::free_function_to_resource(Candidate))...>{});
+    static constexpr auto order = internal::static_order(level);
+    static constexpr auto offset = internal::static_offsets(level);
+    static constexpr std::array<task_type *, sizeof...(Candidate)> task{&invoke<Candidate>...};
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Returns the number of functions in the task list.
+     * @return The number of functions in the task list.
+     */
+    [[nodiscard]] static constexpr size_type size() ENTT_NOEXCEPT {
+        return sizeof...(Candidate);
+    }
+
+    /**
+     * @brief Returns the number of levels of the task graph.
+     * @return The number of levels of the task graph.
+     */
+    [[nodiscard]] static constexpr size_type depth() ENTT_NOEXCEPT {
+        size_type count{};
+
+        for(auto curr: level) {
+            count = (std::max)(count, curr + 1u);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Returns the level of a function.
+     * @param pos Index of the function in the task list.
+     * @return The level to which the function belongs.
+     */
+    [[nodiscard]] static constexpr size_type level_of(const size_type pos) ENTT_NOEXCEPT {
+        return level[pos];
+    }
+
+    /**
+     * @brief Prepares the registry for the execution of the task list.
+     *
+     * All the context variables required by the functions are created, so
+     * that the levels can be executed in parallel safely.
+     *
+     * @param reg A valid registry.
+     */
+    static void prepare(registry_type &reg) {
+        (void(internal::to_args(reg, typename decltype(internal::free_function_to_resource(Candidate))::args{})), ...);
+    }
+
+    /**
+     * @brief Invokes all functions in order on the calling thread.
+     * @param reg A valid registry.
+     */
+    static void run(registry_type &reg) {
+        (invoke<Candidate>(reg), ...);
+    }
+
+    /**
+     * @brief Invokes all functions level by level by means of an executor.
+     *
+     * The executor is invoked once per level with the number of functions of
+     * the level and a task to run for each index in the range `[0, count)`. The
+     * signature of the executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @param executor A valid executor.
+     * @param reg A valid registry.
+     */
+    template<typename Exec>
+    static void run(Exec &&executor, registry_type &reg) {
+        prepare(reg);
+
+        for(size_type curr{}, last = depth(); curr < last; ++curr) {
+            const auto first = offset[curr];
+
+            executor(offset[curr + 1u] - first, [&reg, first](const size_type index) {
+                task[order[first + index]](reg);
+            });
+        }
+    }
 };
 
 } // namespace entt
@@ -0,0 +1,204 @@
+#ifndef ENTT_ENTITY_PREFAB_HPP
+#define ENTT_ENTITY_PREFAB_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+namespace entt {
+
+/**
+ * @brief Set of components used to spawn entities from a template.
+ *
+ * A prefab stores a copy of each of its components along with a type-erased
+ * function used to assign it to a range of entities. Instantiating a prefab
+ * results in a single bulk insertion per component rather than in a call to
+ * `emplace` per component and entity, therefore pages are filled at once and
+ * the pools are visited only once.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_prefab {
+    using deleter_type = void (*)(void *);
+
+    struct component_data {
+        std::unique_ptr<void, deleter_type> value;
+        void (*assign)(basic_registry<Entity> &, const Entity *, const Entity *, const void *);
+    };
+
+    template<typename Type>
+    static void assign_to(basic_registry<Entity> &reg, const Entity *first, const Entity *last, [[maybe_unused]] const void *value) {
+        if constexpr(ignore_as_empty_v<Type>) {
+            reg.template insert<Type>(first, last);
+        } else {
+            reg.template insert<Type>(first, last, *static_cast<const Type *>(value));
+        }
+    }
+
+public:
+    /*! @brief Type of registry to which the prefab refers. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_prefab() = default;
+
+    /*! @brief Default move constructor. */
+    basic_prefab(basic_prefab &&) = default;
+
+    /*! @brief Default move assignment operator. @return This prefab. */
+    basic_prefab &operator=(basic_prefab &&) = default;
+
+    /**
+     * @brief Assigns the given component to a prefab.
+     *
+     * The component is replaced if the prefab already contains it.
+     *
+     * @tparam Type Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the newly created component.
+     */
+    template<typename Type, typename... Args>
+    decltype(auto) emplace(Args &&...args) {
+        static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Invalid component type");
+
+        if constexpr(ignore_as_empty_v<Type>) {
+            components.insert_or_assign(type_hash<Type>::value(), component_data{{nullptr, [](void *) {}}, &assign_to<Type>});
+        } else {
+            Type *elem = nullptr;
+
+            if constexpr(std::is_aggregate_v<Type>) {
+                elem = new Type{std::forward<Args>(args)...};
+            } else {
+                elem = new Type(std::forward<Args>(args)...);
+            }
+
+            components.insert_or_assign(type_hash<Type>::value(), component_data{{elem, [](void *instance) { delete static_cast<Type *>(instance); }}, &assign_to<Type>});
+            return static_cast<Type &>(*elem);
+        }
+    }
+
+    /**
+     * @brief Copies the given components of an entity to a prefab.
+     *
+     * Components that the entity doesn't own are ignored. Those already part
+     * of the prefab are replaced otherwise.
+     *
+     * @tparam Type Types of components to copy.
+     * @param reg A registry that contains the given entity.
+     * @param entt A valid identifier.
+     */
+    template<typename... Type>
+    void capture(const registry_type &reg, const entity_type entt) {
+        ([this, &reg, entt]() {
+            if(reg.template all_of<Type>(entt)) {
+                if constexpr(ignore_as_empty_v<Type>) {
+                    emplace<Type>();
+                } else {
+                    emplace<Type>(reg.template get<Type>(entt));
+                }
+            }
+        }(),
+         ...);
+    }
+
+    /**
+     * @brief Removes the given components from a prefab.
+     * @tparam Type Types of components to remove.
+     * @return The number of components actually removed.
+     */
+    template<typename... Type>
+    size_type remove() {
+        return (components.erase(type_hash<Type>::value()) + ... + size_type{});
+    }
+
+    /**
+     * @brief Checks if a prefab contains all the given components.
+     * @tparam Type Types of components for which to perform the check.
+     * @return True if the prefab contains all the components, false otherwise.
+     */
+    template<typename... Type>
+    [[nodiscard]] bool all_of() const {
+        return (components.contains(type_hash<Type>::value()) && ...);
+    }
+
+    /**
+     * @brief Returns a component of a prefab.
+     *
+     * @warning
+     * Attempting to get a component that isn't part of the prefab results in
+     * undefined behavior.
+     *
+     * @tparam Type Type of component to get.
+     * @return A reference to the component.
+     */
+    template<typename Type>
+    [[nodiscard]] const Type &get() const {
+        static_assert(!ignore_as_empty_v<Type>, "Empty types have no instances");
+        const auto it = components.find(type_hash<Type>::value());
+        ENTT_ASSERT(it != components.cend(), "Prefab does not contain component");
+        return *static_cast<const Type *>(it->second.value.get());
+    }
+
+    /**
+     * @brief Returns the number of components of a prefab.
+     * @return Number of components.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return components.size();
+    }
+
+    /**
+     * @brief Checks whether a prefab is empty.
+     * @return True if the prefab is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return components.empty();
+    }
+
+    /*! @brief Removes all components from a prefab. */
+    void clear() {
+        components.clear();
+    }
+
+    /**
+     * @brief Assigns the components of a prefab to a range of entities.
+     *
+     * Components are assigned type by type, in the same order in which they
+     * were first added to the prefab.
+     *
+     * @warning
+     * Attempting to assign a component to an entity that already owns it
+     * results in undefined behavior.
+     *
+     * @param reg A registry that contains the given entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void assign(registry_type &reg, const entity_type *first, const entity_type *last) const {
+        for(auto &&curr: components) {
+            curr.second.assign(reg, first, last, curr.second.value.get());
+        }
+    }
+
+private:
+    dense_map<id_type, component_data, identity> components{};
+};
+
+} // namespace entt
+
+#endif
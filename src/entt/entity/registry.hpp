@@ -2,8 +2,11 @@
 #define ENTT_ENTITY_REGISTRY_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -20,8 +23,10 @@
 #include "../core/utility.hpp"
 #include "component.hpp"
 #include "entity.hpp"
+#include "entity_mask.hpp"
 #include "fwd.hpp"
 #include "group.hpp"
+#include "runtime_storage.hpp"
 #include "runtime_view.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -157,10 +162,57 @@ template<typename ILhs, typename IRhs>
     return !(lhs < rhs);
 }
 
-struct registry_context {
+template<typename Allocator>
+class registry_context {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using allocator_type = typename alloc_traits::template rebind_alloc<std::pair<const id_type, basic_any<0u>>>;
+    using slot_type = std::pair<void *, bool>;
+    using slot_container_type = std::vector<slot_type, typename alloc_traits::template rebind_alloc<slot_type>>;
+
+    template<typename Type>
+    [[nodiscard]] static std::size_t slot_of() ENTT_NOEXCEPT {
+        return entt::type_index<std::remove_const_t<Type>>::value();
+    }
+
+    template<typename Type>
+    [[nodiscard]] Type *cached(const id_type id) const ENTT_NOEXCEPT {
+        if(const auto pos = slot_of<Type>(); pos < slots.size() && id == type_id<Type>().hash() && (std::is_const_v<Type> || slots[pos].second)) {
+            return static_cast<Type *>(slots[pos].first);
+        }
+
+        return nullptr;
+    }
+
+    template<typename Type>
+    Type *cache(const id_type id, basic_any<0u> &elem) {
+        auto *value = any_cast<Type>(&elem);
+
+        // values are never stored in place, their addresses don't change when the map rehashes
+        if(const auto pos = slot_of<Type>(); value && id == type_id<Type>().hash()) {
+            if(!(pos < slots.size())) {
+                slots.resize(pos + 1u, slot_type{});
+            }
+
+            slots[pos] = {const_cast<std::remove_const_t<Type> *>(value), any_cast<std::remove_const_t<Type>>(&elem) != nullptr};
+        }
+
+        return value;
+    }
+
+public:
+    registry_context(const allocator_type &allocator)
+        : data{allocator},
+          slots{allocator} {}
+
     template<typename Type, typename... Args>
     Type &emplace_hint(const id_type id, Args &&...args) {
-        return any_cast<Type &>(data.try_emplace(id, std::in_place_type<Type>, std::forward<Args>(args)...).first->second);
+        if(auto *elem = cached<std::remove_reference_t<Type>>(id); elem) {
+            return *elem;
+        }
+
+        auto &node = data.try_emplace(id, std::in_place_type<Type>, std::forward<Args>(args)...).first->second;
+        auto *elem = cache<std::remove_reference_t<Type>>(id, node);
+        return elem ? *elem : any_cast<Type &>(node);
     }
 
     template<typename Type, typename... Args>
@@ -171,39 +223,72 @@ struct registry_context {
     template<typename Type>
     bool erase(const id_type id = type_id<Type>().hash()) {
         const auto it = data.find(id);
-        return it != data.end() && it->second.type() == type_id<Type>() ? (data.erase(it), true) : false;
+
+        if(it != data.end() && it->second.type() == type_id<Type>()) {
+            if(const auto pos = slot_of<Type>(); pos < slots.size() && id == type_id<Type>().hash()) {
+                slots[pos] = slot_type{};
+            }
+
+            data.erase(it);
+            return true;
+        }
+
+        return false;
     }
 
     template<typename Type>
     [[nodiscard]] std::add_const_t<Type> &at(const id_type id = type_id<Type>().hash()) const {
+        if(const auto *elem = cached<std::add_const_t<Type>>(id); elem) {
+            return *elem;
+        }
+
         return any_cast<std::add_const_t<Type> &>(data.at(id));
     }
 
     template<typename Type>
     [[nodiscard]] Type &at(const id_type id = type_id<Type>().hash()) {
-        return any_cast<Type &>(data.at(id));
+        if(auto *elem = cached<Type>(id); elem) {
+            return *elem;
+        }
+
+        auto &node = data.at(id);
+        auto *elem = cache<Type>(id, node);
+        return elem ? *elem : any_cast<Type &>(node);
     }
 
     template<typename Type>
     [[nodiscard]] std::add_const_t<Type> *find(const id_type id = type_id<Type>().hash()) const {
+        if(const auto *elem = cached<std::add_const_t<Type>>(id); elem) {
+            return elem;
+        }
+
         const auto it = data.find(id);
         return it != data.cend() ? any_cast<std::add_const_t<Type>>(&it->second) : nullptr;
     }
 
     template<typename Type>
     [[nodiscard]] Type *find(const id_type id = type_id<Type>().hash()) {
+        if(auto *elem = cached<Type>(id); elem) {
+            return elem;
+        }
+
         const auto it = data.find(id);
-        return it != data.end() ? any_cast<Type>(&it->second) : nullptr;
+        return it != data.end() ? cache<Type>(id, it->second) : nullptr;
     }
 
     template<typename Type>
     [[nodiscard]] bool contains(const id_type id = type_id<Type>().hash()) const {
+        if(cached<std::add_const_t<Type>>(id)) {
+            return true;
+        }
+
         const auto it = data.find(id);
         return it != data.end() && it->second.type() == type_id<Type>();
     }
 
 private:
-    dense_map<id_type, basic_any<0u>, identity> data;
+    dense_map<id_type, basic_any<0u>, identity, std::equal_to<id_type>, allocator_type> data;
+    slot_container_type slots;
 };
 
 } // namespace internal
@@ -213,14 +298,33 @@ private:
  * @endcond
  */
 
+/*! @brief Maintenance policy of owning groups. */
+enum class group_policy : std::uint8_t {
+    /*! @brief Owning groups are kept in sync on every change. */
+    eager = 0u,
+    /*! @brief Owning groups are arranged again on demand. */
+    lazy = 1u
+};
+
 /**
  * @brief Fast and reliable entity-component system.
+ *
+ * The allocator is used for all the internal data structures of the registry,
+ * its context variables and the pools themselves. It's also used to construct
+ * the pools, as long as their allocator types are constructible from it.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Entity>
+template<typename Entity, typename Allocator>
 class basic_registry {
     using entity_traits = entt_traits<Entity>;
-    using basic_common_type = basic_sparse_set<Entity>;
+    using basic_common_type = basic_sparse_set<Entity, Allocator>;
+    using alloc_traits = typename std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using pool_container_type = dense_map<id_type, std::shared_ptr<basic_common_type>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<basic_common_type>>>>;
+    using index_container_type = std::vector<basic_common_type *, typename alloc_traits::template rebind_alloc<basic_common_type *>>;
+    using sequence_container_type = std::vector<std::pair<id_type, basic_common_type *>, typename alloc_traits::template rebind_alloc<std::pair<id_type, basic_common_type *>>>;
 
     template<typename Component>
     using storage_type = typename storage_traits<Entity, Component>::storage_type;
@@ -232,10 +336,35 @@ class basic_registry {
     struct group_handler<exclude_t<Exclude...>, get_t<Get...>, Owned...> {
         // nasty workaround for an issue with the toolset v141 that doesn't accept a fold expression here
         static_assert(!std::disjunction_v<std::bool_constant<component_traits<Owned>::in_place_delete>...>, "Groups do not support in-place delete");
-        std::conditional_t<sizeof...(Owned) == 0, basic_common_type, std::size_t> current{};
+        using current_type = std::conditional_t<sizeof...(Owned) == 0, basic_common_type, std::size_t>;
+
+        group_handler([[maybe_unused]] const Allocator &allocator)
+            : current{[&allocator]() {
+                  if constexpr(sizeof...(Owned) == 0) {
+                      return current_type{allocator};
+                  } else {
+                      return current_type{};
+                  }
+              }()} {}
+
+        current_type current;
+        bool dirty{};
 
         template<typename Component>
         void maybe_valid_if(basic_registry &owner, const Entity entt) {
+            ENTT_PROFILE_SCOPE(type_id<group_handler>().name());
+            if constexpr(sizeof...(Owned) != 0) {
+                if(owner.policy == group_policy::lazy) {
+                    dirty = true;
+                    return;
+                }
+            }
+
+            push_if<Component>(owner, entt);
+        }
+
+        template<typename Component>
+        void push_if(basic_registry &owner, const Entity entt) {
             [[maybe_unused]] const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...);
 
             const auto is_valid = ((std::is_same_v<Component, Owned> || std::get<storage_type<Owned> &>(cpools).contains(entt)) && ...)
@@ -255,8 +384,11 @@ class basic_registry {
         }
 
         void discard_if([[maybe_unused]] basic_registry &owner, const Entity entt) {
+            ENTT_PROFILE_SCOPE(type_id<group_handler>().name());
             if constexpr(sizeof...(Owned) == 0) {
                 current.remove(entt);
+            } else if(owner.policy == group_policy::lazy) {
+                dirty = true;
             } else {
                 if(const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...); std::get<0>(cpools).contains(entt) && (std::get<0>(cpools).index(entt) < current)) {
                     const auto pos = --current;
@@ -264,6 +396,22 @@ class basic_registry {
                 }
             }
         }
+
+        void refresh(basic_registry &owner) {
+            ENTT_PROFILE_SCOPE(type_id<group_handler>().name());
+            if constexpr(sizeof...(Owned) != 0) {
+                if(dirty) {
+                    auto &cpool = owner.assure<type_list_element_t<0, type_list<Owned...>>>();
+                    current = {};
+                    dirty = false;
+
+                    // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
+                    for(auto *first = cpool.data(), *last = first + cpool.size(); first != last; ++first) {
+                        push_if<type_list_element_t<0, type_list<Owned...>>>(owner, *first);
+                    }
+                }
+            }
+        }
     };
 
     struct group_data {
@@ -272,19 +420,91 @@ class basic_registry {
         bool (*owned)(const id_type) ENTT_NOEXCEPT;
         bool (*get)(const id_type) ENTT_NOEXCEPT;
         bool (*exclude)(const id_type) ENTT_NOEXCEPT;
+        std::size_t (*footprint)(const void *);
+        void (*refresh)(void *, basic_registry &);
+        void (*reserve)(void *, const std::size_t);
+        void (*reset)(void *);
     };
 
+    void refresh_groups() {
+        // groups that share owned types are sorted from the least to the most restrictive one
+        for(auto &&gdata: groups) {
+            gdata.refresh(gdata.group.get(), *this);
+        }
+    }
+
+    template<typename Component>
+    [[nodiscard]] basic_common_type *lookup(const id_type id) const ENTT_NOEXCEPT {
+        // default pools are also reachable through flat arrays, named ones only through the map
+        if(id == type_hash<Component>::value()) {
+            if constexpr(has_static_type_index_v<Component>) {
+                if(constexpr std::size_t index = static_type_index<Component>::value; index < indexed.size()) {
+                    return indexed[index];
+                }
+            } else {
+                // runtime indices may differ between modules, entries are validated against the hash
+                if(const std::size_t index = type_index<Component>::value(); index < sequenced.size() && sequenced[index].first == id) {
+                    return sequenced[index].second;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename Component>
+    void cache(const id_type id, basic_common_type *cpool) {
+        if(id == type_hash<Component>::value()) {
+            if constexpr(has_static_type_index_v<Component>) {
+                constexpr std::size_t index = static_type_index<Component>::value;
+
+                if(!(index < indexed.size())) {
+                    indexed.resize(index + 1u);
+                }
+
+                indexed[index] = cpool;
+            } else {
+                const std::size_t index = type_index<Component>::value();
+
+                if(!(index < sequenced.size())) {
+                    sequenced.resize(index + 1u);
+                }
+
+                sequenced[index] = {id, cpool};
+            }
+        }
+    }
+
     template<typename Component>
     [[nodiscard]] auto &assure(const id_type id = type_hash<Component>::value()) {
         static_assert(std::is_same_v<Component, std::decay_t<Component>>, "Non-decayed types not allowed");
+
+        if(auto *elem = lookup<Component>(id); elem) {
+            return static_cast<storage_type<Component> &>(*elem);
+        }
+
+        ENTT_ASSERT(!locked || pools.contains(id), "Pools cannot be created while the registry is frozen");
         auto &&cpool = pools[id];
 
         if(!cpool) {
-            cpool.reset(new storage_type<Component>{});
+            using pool_allocator_type = typename storage_type<Component>::allocator_type;
+
+            if constexpr(std::is_constructible_v<pool_allocator_type, const Allocator &>) {
+                cpool = std::allocate_shared<storage_type<Component>>(get_allocator(), pool_allocator_type{get_allocator()});
+            } else {
+                cpool = std::allocate_shared<storage_type<Component>>(get_allocator());
+            }
+
             cpool->bind(forward_as_any(*this));
         }
 
         ENTT_ASSERT(cpool->type() == type_id<Component>(), "Unexpected type");
+
+        if(!locked) {
+            // lookup tables are shared and only read while the registry is frozen
+            cache<Component>(id, cpool.get());
+        }
+
         return static_cast<storage_type<Component> &>(*cpool);
     }
 
@@ -292,6 +512,10 @@ class basic_registry {
     [[nodiscard]] const auto &assure(const id_type id = type_hash<Component>::value()) const {
         static_assert(std::is_same_v<Component, std::decay_t<Component>>, "Non-decayed types not allowed");
 
+        if(const auto *elem = lookup<Component>(id); elem) {
+            return static_cast<const storage_type<Component> &>(*elem);
+        }
+
         if(const auto it = pools.find(id); it != pools.cend()) {
             ENTT_ASSERT(it->second->type() == type_id<Component>(), "Unexpected type");
             return static_cast<const storage_type<Component> &>(*it->second);
@@ -301,26 +525,107 @@ class basic_registry {
         return placeholder;
     }
 
-    auto generate_identifier(const std::size_t pos) ENTT_NOEXCEPT {
-        ENTT_ASSERT(pos < entity_traits::to_integral(null), "No entities available");
-        return entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), {});
-    }
+    template<typename It, typename Func>
+    void batch(It first, It last, Func func) const {
+        // identifiers are prefetched a few elements ahead, so that independent lookups overlap
+        constexpr std::size_t distance = 8u;
+        auto ahead = first;
+
+        for(std::size_t step{}; step < distance && ahead != last; ++step, ++ahead) {
+            entities.prefetch(*ahead);
+        }
+
+        for(std::size_t pos{}; first != last; ++first, ++pos) {
+            if(ahead != last) {
+                entities.prefetch(*ahead);
+                ++ahead;
+            }
 
-    auto recycle_identifier() ENTT_NOEXCEPT {
-        ENTT_ASSERT(free_list != null, "No entities available");
-        const auto curr = entity_traits::to_entity(free_list);
-        free_list = entity_traits::combine(entity_traits::to_integral(entities[curr]), tombstone);
-        return (entities[curr] = entity_traits::combine(curr, entity_traits::to_integral(entities[curr])));
+            func(pos, *first);
+        }
     }
 
     auto release_entity(const Entity entity, const typename entity_traits::version_type version) {
+        ENTT_ASSERT(!locked, "Entities cannot be released while the registry is frozen");
         const typename entity_traits::version_type vers = version + (version == entity_traits::to_version(tombstone));
-        entities[entity_traits::to_entity(entity)] = entity_traits::construct(entity_traits::to_integral(free_list), vers);
-        free_list = entity_traits::combine(entity_traits::to_integral(entity), tombstone);
+        entities.erase(entity);
+        entities.bump(entity_traits::construct(entity_traits::to_entity(entity), vers));
+        disabled.enable(entity);
         return vers;
     }
 
+    template<typename Type>
+    [[nodiscard]] Type masked(Type elem) const {
+        if constexpr(std::is_same_v<typename Type::mask_type, mask_type>) {
+            elem.mask(&disabled);
+        }
+
+        return elem;
+    }
+
+    template<typename Self, typename It, typename Func>
+    static void visit_pools(Self &self, It first, It last, Func &func) {
+        std::vector<Entity> range(first, last);
+        std::vector<Entity> subset{};
+        basic_sparse_set<Entity> lookup{};
+
+        for(auto &&curr: self.pools) {
+            std::conditional_t<std::is_const_v<Self>, const base_type, base_type> &cpool = *curr.second;
+            subset.clear();
+
+            if(cpool.size() < range.size()) {
+                if(lookup.empty()) {
+                    for(const auto entity: range) {
+                        if(!lookup.contains(entity)) {
+                            lookup.emplace(entity);
+                        }
+                    }
+                }
+
+                std::copy_if(cpool.begin(), cpool.end(), std::back_inserter(subset), [&lookup](const auto entity) { return lookup.contains(entity); });
+            } else {
+                std::copy_if(range.cbegin(), range.cend(), std::back_inserter(subset), [&cpool](const auto entity) { return cpool.contains(entity); });
+            }
+
+            if(!subset.empty()) {
+                func(curr.first, cpool, subset.data(), subset.data() + subset.size());
+            }
+        }
+    }
+
+    template<typename OutIt>
+    OutIt transfer(basic_registry &other, const std::vector<Entity> &range, OutIt out, const bool move) const {
+        ENTT_ASSERT(&other != this, "Same registry");
+        ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }), "Invalid entity");
+
+        std::vector<Entity> created(range.size());
+        other.create(created.begin(), created.end());
+
+        for(auto &&curr: pools) {
+            auto &cpool = *curr.second;
+            const auto count = static_cast<std::size_t>(std::count_if(range.cbegin(), range.cend(), [&cpool](const auto entity) { return cpool.contains(entity); }));
+
+            if(const auto it = other.pools.find(curr.first); it != other.pools.end()) {
+                auto &target = *it->second;
+                target.reserve(target.size() + count);
+
+                for(std::size_t pos{}; pos < range.size(); ++pos) {
+                    if(cpool.contains(range[pos])) {
+                        [[maybe_unused]] const auto elem = move ? target.move_emplace(created[pos], cpool.get(range[pos])) : target.emplace(created[pos], std::as_const(cpool).get(range[pos]));
+                        ENTT_ASSERT(elem != target.end(), "Component not copyable or movable");
+                    }
+                }
+            } else {
+                ENTT_ASSERT(count == 0u, "Missing storage in the target registry");
+            }
+        }
+
+        return std::copy(created.cbegin(), created.cend(), out);
+    }
+
 public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
     /*! @brief Underlying version type. */
@@ -330,10 +635,29 @@ public:
     /*! @brief Common type among all storage types. */
     using base_type = basic_common_type;
     /*! @brief Context type. */
-    using context = internal::registry_context;
+    using context = internal::registry_context<allocator_type>;
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<entity_type, allocator_type>;
 
     /*! @brief Default constructor. */
-    basic_registry() = default;
+    basic_registry()
+        : basic_registry{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty registry with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_registry(const allocator_type &allocator)
+        : pools{allocator},
+          indexed{allocator},
+          sequenced{allocator},
+          groups{allocator},
+          entities{allocator},
+          disabled{allocator},
+          vars{allocator},
+          policy{},
+          locked{},
+          reserved{} {}
 
     /**
      * @brief Move constructor.
@@ -341,10 +665,15 @@ public:
      */
     basic_registry(basic_registry &&other)
         : pools{std::move(other.pools)},
+          indexed{std::move(other.indexed)},
+          sequenced{std::move(other.sequenced)},
           groups{std::move(other.groups)},
           entities{std::move(other.entities)},
-          free_list{other.free_list},
-          vars{std::move(other.vars)} {
+          disabled{std::move(other.disabled)},
+          vars{std::move(other.vars)},
+          policy{other.policy},
+          locked{other.locked},
+          reserved{other.reserved.exchange(0u, std::memory_order_relaxed)} {
         for(auto &&curr: pools) {
             curr.second->bind(forward_as_any(*this));
         }
@@ -357,10 +686,15 @@ public:
      */
     basic_registry &operator=(basic_registry &&other) {
         pools = std::move(other.pools);
+        indexed = std::move(other.indexed);
+        sequenced = std::move(other.sequenced);
         groups = std::move(other.groups);
         entities = std::move(other.entities);
-        free_list = other.free_list;
+        disabled = std::move(other.disabled);
         vars = std::move(other.vars);
+        policy = other.policy;
+        locked = other.locked;
+        reserved.store(other.reserved.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
 
         for(auto &&curr: pools) {
             curr.second->bind(forward_as_any(*this));
@@ -369,6 +703,14 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return entities.get_allocator();
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a registry.
      *
@@ -406,6 +748,35 @@ public:
         return internal::storage_proxy_iterator{pools.find(id)};
     }
 
+    /**
+     * @brief Returns the storage associated with a given name, created from a
+     * type layout if it doesn't exist yet.
+     *
+     * A storage created this way is a runtime storage. Its objects are packed
+     * in pages and constructed in place through the thunks of the layout, so
+     * that components only known at runtime don't require a C++ type.
+     *
+     * @warning
+     * A runtime storage is only accessible in its type-erased form. Accessing
+     * it as the storage of a C++ type results in undefined behavior.
+     *
+     * @param id Name used to map the storage within the registry.
+     * @param layout The layout of the objects assigned to the entities.
+     * @return The storage associated with the given name.
+     */
+    base_type &storage(const id_type id, const type_layout &layout) {
+        ENTT_ASSERT(!locked || pools.contains(id), "Pools cannot be created while the registry is frozen");
+        auto &&cpool = pools[id];
+
+        if(!cpool) {
+            cpool = std::allocate_shared<basic_runtime_storage<entity_type, allocator_type>>(get_allocator(), layout, get_allocator());
+            cpool->bind(forward_as_any(*this));
+        }
+
+        ENTT_ASSERT(cpool->type() == *layout.info, "Unexpected type");
+        return *cpool;
+    }
+
     /**
      * @brief Returns the storage for a given component type.
      * @tparam Component Type of component of which to return the storage.
@@ -449,22 +820,48 @@ public:
      * @brief Returns the number of entities still in use.
      * @return Number of entities still in use.
      */
-    [[nodiscard]] size_type alive() const {
-        auto sz = entities.size();
-
-        for(auto curr = free_list; curr != null; --sz) {
-            curr = entities[entity_traits::to_entity(curr)];
-        }
+    [[nodiscard]] size_type alive() const ENTT_NOEXCEPT {
+        return entities.in_use();
+    }
 
-        return sz;
+    /**
+     * @brief Returns the number of entities released and not yet recycled.
+     * @deprecated Use `size() - alive()` instead. Released entities are no
+     * longer chained in a free list and there is no head to return.
+     * @return Number of entities released and not yet recycled.
+     */
+    [[deprecated("use size() - alive() instead")]] [[nodiscard]] size_type released() const ENTT_NOEXCEPT {
+        return entities.size() - entities.in_use();
     }
 
     /**
-     * @brief Increases the capacity (number of entities) of the registry.
+     * @brief Increases the capacity (number of entities) of the registry and
+     * of the given storage at once.
+     *
+     * Besides entities and components, the pages of the sparse arrays are
+     * allocated in advance for identifiers up to the given capacity. Groups
+     * that observe one of the given types without owning it are prepared as
+     * well, since owning groups rely on the storage they own.<br/>
+     * This way, creating a burst of entities and assigning them components
+     * doesn't allocate memory one page at a time.
+     *
+     * @tparam Component Types of components for which to reserve storage.
      * @param cap Desired capacity.
      */
+    template<typename... Component>
     void reserve(const size_type cap) {
         entities.reserve(cap);
+        entities.reserve_sparse(cap);
+
+        if constexpr(sizeof...(Component) != 0u) {
+            ((assure<Component>().reserve(cap), assure<Component>().reserve_sparse(cap)), ...);
+
+            for(auto &&gdata: groups) {
+                if((gdata.get(type_hash<Component>::value()) || ...)) {
+                    gdata.reserve(gdata.group.get(), cap);
+                }
+            }
+        }
     }
 
     /**
@@ -480,7 +877,7 @@ public:
      * @brief Checks whether the registry is empty (no entities still in use).
      * @return True if the registry is empty, false otherwise.
      */
-    [[nodiscard]] bool empty() const {
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
         return !alive();
     }
 
@@ -488,11 +885,9 @@ public:
      * @brief Direct access to the list of entities of a registry.
      *
      * The returned pointer is such that range `[data(), data() + size())` is
-     * always a valid range, even if the registry is empty.
-     *
-     * @warning
-     * This list contains both valid and destroyed entities and isn't suitable
-     * for direct use.
+     * always a valid range, even if the registry is empty.<br/>
+     * Entities still in use come first and are followed by the released ones,
+     * that is, range `[data(), data() + alive())` only contains valid entities.
      *
      * @return A pointer to the array of entities.
      */
@@ -500,26 +895,13 @@ public:
         return entities.data();
     }
 
-    /**
-     * @brief Returns the head of the list of released entities.
-     *
-     * This function is intended for use in conjunction with `assign`.<br/>
-     * The returned entity has an invalid identifier in all cases.
-     *
-     * @return The head of the list of released entities.
-     */
-    [[nodiscard]] entity_type released() const ENTT_NOEXCEPT {
-        return free_list;
-    }
-
     /**
      * @brief Checks if an identifier refers to a valid entity.
      * @param entity An identifier, either valid or not.
      * @return True if the identifier is valid, false otherwise.
      */
     [[nodiscard]] bool valid(const entity_type entity) const {
-        const auto pos = size_type(entity_traits::to_entity(entity));
-        return (pos < entities.size() && entities[pos] == entity);
+        return entities.alive(entity);
     }
 
     /**
@@ -529,8 +911,54 @@ public:
      * version otherwise.
      */
     [[nodiscard]] version_type current(const entity_type entity) const {
-        const auto pos = size_type(entity_traits::to_entity(entity));
-        return entity_traits::to_version(pos < entities.size() ? entities[pos] : tombstone);
+        return entities.current(entity);
+    }
+
+    /**
+     * @brief Checks if a batch of identifiers refer to valid entities.
+     *
+     * Results are packed in a bitmask, one bit per identifier in order, and
+     * the `N`-th identifier is valid if bit `N % 64` of word `N / 64` is set.
+     * Sparse slots are prefetched a few identifiers ahead of the one being
+     * tested, so that the loads of independent lookups overlap.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param out A pointer to an array of at least `(N + 63) / 64` words,
+     * where `N` is the size of the range.
+     * @return The number of valid identifiers.
+     */
+    template<typename It>
+    size_type valid_n(It first, It last, std::uint64_t *out) const {
+        size_type found{};
+
+        batch(std::move(first), std::move(last), [out, &found, this](const auto pos, const auto entity) {
+            constexpr auto bits = static_cast<size_type>(std::numeric_limits<std::uint64_t>::digits);
+            const bool alive = entities.alive(entity);
+            out[pos / bits] = ((pos % bits) ? out[pos / bits] : std::uint64_t{}) | (std::uint64_t{alive} << (pos % bits));
+            found += alive;
+        });
+
+        return found;
+    }
+
+    /**
+     * @brief Returns the actual versions for a batch of identifiers.
+     *
+     * @sa valid_n
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param out A pointer to an array of at least as many elements as the
+     * range, where to store the versions.
+     */
+    template<typename It>
+    void current_n(It first, It last, version_type *out) const {
+        batch(std::move(first), std::move(last), [out, this](const auto pos, const auto entity) {
+            out[pos] = entities.current(entity);
+        });
     }
 
     /**
@@ -538,7 +966,10 @@ public:
      * @return A valid identifier.
      */
     [[nodiscard]] entity_type create() {
-        return (free_list == null) ? entities.emplace_back(generate_identifier(entities.size())) : recycle_identifier();
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        ENTT_ASSERT(!locked, "Entities cannot be created while the registry is frozen");
+        ENTT_ASSERT(!reserved.load(std::memory_order_relaxed), "Reserved identifiers not materialized");
+        return entities.emplace();
     }
 
     /**
@@ -551,26 +982,10 @@ public:
      * @return A valid identifier.
      */
     [[nodiscard]] entity_type create(const entity_type hint) {
-        const auto length = entities.size();
-
-        if(hint == null || hint == tombstone) {
-            return create();
-        } else if(const auto req = entity_traits::to_entity(hint); !(req < length)) {
-            entities.resize(size_type(req) + 1u, null);
-
-            for(auto pos = length; pos < req; ++pos) {
-                release_entity(generate_identifier(pos), {});
-            }
-
-            return (entities[req] = hint);
-        } else if(const auto curr = entity_traits::to_entity(entities[req]); req == curr) {
-            return create();
-        } else {
-            auto *it = &free_list;
-            for(; entity_traits::to_entity(*it) != req; it = &entities[entity_traits::to_entity(*it)]) {}
-            *it = entity_traits::combine(curr, entity_traits::to_integral(*it));
-            return (entities[req] = hint);
-        }
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        ENTT_ASSERT(!locked, "Entities cannot be created while the registry is frozen");
+        ENTT_ASSERT(!reserved.load(std::memory_order_relaxed), "Reserved identifiers not materialized");
+        return entities.emplace(hint);
     }
 
     /**
@@ -584,26 +999,127 @@ public:
      */
     template<typename It>
     void create(It first, It last) {
-        for(; free_list != null && first != last; ++first) {
-            *first = recycle_identifier();
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        ENTT_ASSERT(!locked, "Entities cannot be created while the registry is frozen");
+        ENTT_ASSERT(!reserved.load(std::memory_order_relaxed), "Reserved identifiers not materialized");
+        entities.insert(std::move(first), std::move(last));
+    }
+
+    /**
+     * @brief Reserves identifiers for entities to create later on.
+     *
+     * Reserved identifiers are taken among those never used so far and are
+     * handed out atomically. Therefore, multiple threads can reserve them at
+     * the same time with no further synchronization, as long as the registry
+     * isn't modified in the meantime. Pools aren't touched at all.<br/>
+     * Reserved identifiers can be used immediately, for example with command
+     * buffers, but they aren't valid until they're materialized.
+     *
+     * @warning
+     * Creating entities or releasing all of them before materializing the
+     * reserved identifiers results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in this
+     * case.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void reserve_entities(It first, It last) {
+        const auto len = static_cast<size_type>(std::distance(first, last));
+        auto pos = entities.size() + reserved.fetch_add(len, std::memory_order_relaxed);
+        ENTT_ASSERT(pos + len <= static_cast<size_type>(entity_traits::to_entity(null)), "No entities available");
+
+        for(; first != last; ++first, ++pos) {
+            *first = entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), {});
         }
+    }
 
-        const auto length = entities.size();
-        entities.resize(length + std::distance(first, last), null);
+    /**
+     * @brief Reserves an identifier for an entity to create later on.
+     *
+     * @sa reserve_entities
+     *
+     * @return A reserved identifier.
+     */
+    [[nodiscard]] entity_type reserve_entity() {
+        entity_type entt;
+        reserve_entities(&entt, &entt + 1u);
+        return entt;
+    }
 
-        for(auto pos = length; first != last; ++first, ++pos) {
-            *first = entities[pos] = generate_identifier(pos);
+    /**
+     * @brief Turns all reserved identifiers into valid entities.
+     *
+     * This function is meant to be invoked at a sync point, after all threads
+     * have stopped reserving identifiers.
+     */
+    void materialize() {
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        ENTT_ASSERT(!locked, "Entities cannot be created while the registry is frozen");
+        const auto from = entities.size();
+        const auto len = reserved.exchange(0u, std::memory_order_relaxed);
+        entities.reserve(from + len);
+
+        for(auto pos = from, last = from + len; pos < last; ++pos) {
+            entities.emplace(entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), {}));
         }
     }
 
+    /**
+     * @brief Returns the number of identifiers reserved and not yet
+     * materialized.
+     * @return Number of identifiers reserved and not yet materialized.
+     */
+    [[nodiscard]] size_type reserved_entities() const ENTT_NOEXCEPT {
+        return reserved.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Creates a new entity from a prefab.
+     *
+     * @sa instantiate(const basic_prefab<entity_type> &, It, It)
+     *
+     * @param source A prefab to use to initialize the entity.
+     * @return A valid identifier.
+     */
+    entity_type instantiate(const basic_prefab<entity_type> &source) {
+        const auto entity = create();
+        source.assign(*this, &entity, &entity + 1u);
+        return entity;
+    }
+
+    /**
+     * @brief Assigns each element in a range an identifier and the components
+     * of a prefab.
+     *
+     * Entities are created first, then each component of the prefab is
+     * assigned to all of them at once. Construction signals are emitted as
+     * if the components were inserted in bulk.
+     *
+     * @tparam It Type of forward iterator.
+     * @param source A prefab to use to initialize the entities.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void instantiate(const basic_prefab<entity_type> &source, It first, It last) {
+        const auto from = entities.in_use();
+        create(std::move(first), std::move(last));
+        // new identifiers are packed at the end of those in use, listeners are free to create entities in the meantime
+        const std::vector<entity_type, allocator_type> created{entities.data() + from, entities.data() + entities.in_use(), get_allocator()};
+        source.assign(*this, created.data(), created.data() + created.size());
+    }
+
     /**
      * @brief Assigns identifiers to an empty registry.
      *
      * This function is intended for use in conjunction with `data`, `size` and
-     * `destroyed`.<br/>
-     * Don't try to inject ranges of randomly generated entities nor the _wrong_
-     * head for the list of destroyed entities. There is no guarantee that a
-     * registry will continue to work properly in this case.
+     * `alive`.<br/>
+     * Don't try to inject ranges of randomly generated entities nor a _wrong_
+     * number of entities in use. There is no guarantee that a registry will
+     * continue to work properly in this case.
      *
      * @warning
      * There must be no entities still alive for this to work properly.
@@ -611,13 +1127,15 @@ public:
      * @tparam It Type of input iterator.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
-     * @param destroyed The head of the list of destroyed entities.
+     * @param count The number of entities in use at the beginning of the range.
      */
     template<typename It>
-    void assign(It first, It last, const entity_type destroyed) {
+    void assign(It first, It last, const size_type count) {
         ENTT_ASSERT(!alive(), "Entities still alive");
-        entities.assign(first, last);
-        free_list = destroyed;
+        ENTT_ASSERT(!reserved.load(std::memory_order_relaxed), "Reserved identifiers not materialized");
+        entities.clear();
+        entities.push(first, last);
+        entities.in_use(count);
     }
 
     /**
@@ -698,6 +1216,7 @@ public:
      * @return The version actually assigned to the entity.
      */
     version_type destroy(const entity_type entity, const version_type version) {
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
         ENTT_ASSERT(valid(entity), "Invalid entity");
 
         for(size_type pos = pools.size(); pos; --pos) {
@@ -710,6 +1229,11 @@ public:
     /**
      * @brief Destroys all entities in a range and releases their identifiers.
      *
+     * The range is partitioned per pool first, then each pool is visited once
+     * for all the entities it contains rather than once per entity. Pools that
+     * only contain entities from the range are cleared in one go, unless they
+     * use the in-place deletion policy.
+     *
      * @sa destroy
      *
      * @tparam It Type of input iterator.
@@ -718,11 +1242,91 @@ public:
      */
     template<typename It>
     void destroy(It first, It last) {
-        for(; first != last; ++first) {
-            destroy(*first, entity_traits::to_version(*first) + 1u);
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        // the range often comes from one of the pools, it's copied aside before changing them
+        const std::vector<entity_type> range(first, last);
+        std::vector<entity_type> partition{};
+        partition.reserve(range.size());
+
+        ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }), "Invalid entity");
+
+        for(size_type pos = pools.size(); pos; --pos) {
+            auto &cpool = *pools.begin()[pos - 1u].second;
+            partition.clear();
+            std::copy_if(range.cbegin(), range.cend(), std::back_inserter(partition), [&cpool](const auto entity) { return cpool.contains(entity); });
+
+            if(partition.size() == cpool.size() && cpool.policy() == deletion_policy::swap_and_pop) {
+                cpool.clear();
+            } else {
+                cpool.erase(partition.data(), partition.data() + partition.size());
+            }
+        }
+
+        for(const auto entity: range) {
+            release_entity(entity, entity_traits::to_version(entity) + 1u);
         }
     }
 
+    /**
+     * @brief Copies a range of entities and their components to another
+     * registry.
+     *
+     * Entities are created all at once in the target registry and components
+     * are copied pool by pool, after reserving enough space for all of them.
+     * Pools are matched by name and they are accessed through their opaque
+     * interface, that is, the target registry must already contain the storage
+     * for all the components to copy. The identifiers of the new entities are
+     * returned in the same order as the original ones.
+     *
+     * @warning
+     * Attempting to use an invalid entity, to copy components that aren't copy
+     * constructible or for which the target registry doesn't offer a storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam OutIt Type of output iterator.
+     * @param other The registry to copy the entities to.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param out An output iterator for the identifiers of the new entities.
+     * @return The output iterator past the last identifier written.
+     */
+    template<typename It, typename OutIt>
+    OutIt copy_to(basic_registry &other, It first, It last, OutIt out) const {
+        return transfer(other, std::vector<entity_type>(first, last), std::move(out), false);
+    }
+
+    /**
+     * @brief Moves a range of entities and their components to another
+     * registry.
+     *
+     * Similar to `copy_to`, except for the fact that components are moved
+     * rather than copied and the original entities are destroyed afterwards.
+     *
+     * @sa copy_to
+     *
+     * @warning
+     * Attempting to use an invalid entity, to move components that aren't move
+     * constructible or for which the target registry doesn't offer a storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam OutIt Type of output iterator.
+     * @param other The registry to move the entities to.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param out An output iterator for the identifiers of the new entities.
+     * @return The output iterator past the last identifier written.
+     */
+    template<typename It, typename OutIt>
+    OutIt move_to(basic_registry &other, It first, It last, OutIt out) {
+        // the range often comes from one of the pools, it's copied aside before changing them
+        const std::vector<entity_type> range(first, last);
+        out = transfer(other, range, std::move(out), true);
+        destroy(range.cbegin(), range.cend());
+        return out;
+    }
+
     /**
      * @brief Assigns the given component to an entity.
      *
@@ -740,6 +1344,7 @@ public:
      */
     template<typename Component, typename... Args>
     decltype(auto) emplace(const entity_type entity, Args &&...args) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(valid(entity), "Invalid entity");
         return assure<Component>().emplace(entity, std::forward<Args>(args)...);
     }
@@ -757,10 +1362,38 @@ public:
      */
     template<typename Component, typename It>
     void insert(It first, It last, const Component &value = {}) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }), "Invalid entity");
         assure<Component>().insert(first, last, value);
     }
 
+    /**
+     * @brief Assigns each entity in a range the given component and constructs
+     * the components in parallel.
+     *
+     * Entities are assigned and memory is allocated up-front on the calling
+     * thread, then components are copy constructed in chunks aligned to the
+     * page size by means of the given executor. Signals are published on the
+     * calling thread afterwards.<br/>
+     * The executor has the same requirements of the one accepted by the
+     * `par_each` member function of the views.
+     *
+     * @sa insert
+     *
+     * @tparam Component Type of component to create.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the component to assign.
+     */
+    template<typename Component, typename Exec, typename It>
+    void par_insert(Exec &&executor, It first, It last, const Component &value = {}) {
+        ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }), "Invalid entity");
+        assure<Component>().par_insert(std::forward<Exec>(executor), first, last, value);
+    }
+
     /**
      * @brief Assigns each entity in a range the given components.
      *
@@ -775,6 +1408,7 @@ public:
      */
     template<typename Component, typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<std::decay_t<typename std::iterator_traits<CIt>::value_type>, Component>>>
     void insert(EIt first, EIt last, CIt from) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }), "Invalid entity");
         assure<Component>().insert(first, last, from);
     }
@@ -793,6 +1427,7 @@ public:
      */
     template<typename Component, typename... Args>
     decltype(auto) emplace_or_replace(const entity_type entity, Args &&...args) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(valid(entity), "Invalid entity");
         auto &cpool = assure<Component>();
 
@@ -865,6 +1500,7 @@ public:
      */
     template<typename Component, typename... Other>
     size_type remove(const entity_type entity) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(valid(entity), "Invalid entity");
         return (assure<Component>().remove(entity) + ... + assure<Other>().remove(entity));
     }
@@ -872,6 +1508,9 @@ public:
     /**
      * @brief Removes the given components from all the entities in a range.
      *
+     * Pools are visited once each for the whole range rather than once per
+     * entity.
+     *
      * @sa remove
      *
      * @tparam Component Type of component to remove.
@@ -883,18 +1522,15 @@ public:
      */
     template<typename Component, typename... Other, typename It>
     size_type remove(It first, It last) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         if constexpr(sizeof...(Other) == 0u) {
             ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }), "Invalid entity");
             return assure<Component>().remove(std::move(first), std::move(last));
         } else {
-            size_type count{};
-
-            for(auto cpools = std::forward_as_tuple(assure<Component>(), assure<Other>()...); first != last; ++first) {
-                ENTT_ASSERT(valid(*first), "Invalid entity");
-                count += std::apply([entt = *first](auto &...curr) { return (curr.remove(entt) + ... + 0u); }, cpools);
-            }
-
-            return count;
+            // the range often comes from one of the pools, it's copied aside before changing them
+            const std::vector<entity_type> range(first, last);
+            ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }), "Invalid entity");
+            return (assure<Component>().remove(range.cbegin(), range.cend()) + ... + assure<Other>().remove(range.cbegin(), range.cend()));
         }
     }
 
@@ -911,6 +1547,7 @@ public:
      */
     template<typename Component, typename... Other>
     void erase(const entity_type entity) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         ENTT_ASSERT(valid(entity), "Invalid entity");
         (assure<Component>().erase(entity), (assure<Other>().erase(entity), ...));
     }
@@ -928,6 +1565,7 @@ public:
      */
     template<typename Component, typename... Other, typename It>
     void erase(It first, It last) {
+        ENTT_PROFILE_SCOPE(type_id<Component>().name());
         if constexpr(sizeof...(Other) == 0u) {
             ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }), "Invalid entity");
             assure<Component>().erase(std::move(first), std::move(last));
@@ -1002,14 +1640,14 @@ public:
     template<typename... Component>
     [[nodiscard]] decltype(auto) get([[maybe_unused]] const entity_type entity) const {
         ENTT_ASSERT(valid(entity), "Invalid entity");
-        return view<Component...>().template get<const Component...>(entity);
+        return basic_view<entity_type, get_t<std::add_const_t<Component>...>, exclude_t<>>{assure<std::remove_const_t<Component>>()...}.template get<const Component...>(entity);
     }
 
     /*! @copydoc get */
     template<typename... Component>
     [[nodiscard]] decltype(auto) get([[maybe_unused]] const entity_type entity) {
         ENTT_ASSERT(valid(entity), "Invalid entity");
-        return view<Component...>().template get<Component...>(entity);
+        return basic_view<entity_type, get_t<Component...>, exclude_t<>>{assure<std::remove_const_t<Component>>()...}.template get<Component...>(entity);
     }
 
     /**
@@ -1075,17 +1713,53 @@ public:
      */
     template<typename... Component>
     void clear() {
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
         if constexpr(sizeof...(Component) == 0) {
             for(auto &&curr: pools) {
                 curr.second->clear();
             }
 
-            each([this](const auto entity) { release_entity(entity, entity_traits::to_version(entity) + 1u); });
+            for(auto pos = entities.in_use(); pos; --pos) {
+                const auto entity = entities.data()[pos - 1u];
+                release_entity(entity, entity_traits::to_version(entity) + 1u);
+            }
         } else {
             (assure<Component>().clear(), ...);
         }
     }
 
+    /**
+     * @brief Drops all entities and components at once.
+     *
+     * Pools are cleared in bulk and listeners aren't notified. Identifiers
+     * aren't recycled, they restart from zero instead. Memory isn't released,
+     * so that the next round of entities reuses it.<br/>
+     * This is meant for registries of transient entities that are created and
+     * thrown away on a regular basis, such as per-frame events. Pools, groups
+     * and context variables are kept.
+     *
+     * @warning
+     * Identifiers obtained before a reset are reused afterwards and there is
+     * no way to tell them apart from the new ones. Observers and other tools
+     * that track entities by means of signals aren't informed either.
+     */
+    void reset() {
+        ENTT_PROFILE_SCOPE(type_id<basic_registry>().name());
+        ENTT_ASSERT(!locked, "Entities cannot be released while the registry is frozen");
+        ENTT_ASSERT(!reserved.load(std::memory_order_relaxed), "Reserved identifiers not materialized");
+
+        for(auto &&curr: pools) {
+            curr.second->reset();
+        }
+
+        for(auto &&gdata: groups) {
+            gdata.reset(gdata.group.get());
+        }
+
+        entities.clear();
+        disabled.clear();
+    }
+
     /**
      * @brief Iterates all the entities that are still in use.
      *
@@ -1102,19 +1776,50 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        if(free_list == null) {
-            for(auto pos = entities.size(); pos; --pos) {
-                func(entities[pos - 1]);
-            }
-        } else {
-            for(auto pos = entities.size(); pos; --pos) {
-                if(const auto entity = entities[pos - 1]; entity_traits::to_entity(entity) == (pos - 1)) {
-                    func(entity);
-                }
-            }
+        for(auto [entity]: entities.each()) {
+            func(entity);
         }
     }
 
+    /**
+     * @brief Visits all the pools that contain at least one of the given
+     * entities, one pool at a time.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const id_type, base_type &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * The function receives the identifier of a pool, the pool itself and the
+     * subset of the entities it contains. It's invoked at most once per pool,
+     * so that serialization, copy and destruction run in batch per pool rather
+     * than by probing all pools for each entity.<br/>
+     * Pools smaller than the range are walked in place and their entities are
+     * looked up in the range. The order of the entities in a subset isn't
+     * specified.
+     *
+     * @warning
+     * Creating or destroying pools from within the function object results in
+     * undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid function object.
+     */
+    template<typename It, typename Func>
+    void visit(It first, It last, Func func) {
+        visit_pools(*this, std::move(first), std::move(last), func);
+    }
+
+    /*! @copydoc visit */
+    template<typename It, typename Func>
+    void visit(It first, It last, Func func) const {
+        visit_pools(*this, std::move(first), std::move(last), func);
+    }
+
     /**
      * @brief Checks if an entity has components assigned.
      * @param entity A valid identifier.
@@ -1125,6 +1830,51 @@ public:
         return std::none_of(pools.cbegin(), pools.cend(), [entity](auto &&curr) { return curr.second->contains(entity); });
     }
 
+    /**
+     * @brief Enables or disables an entity.
+     *
+     * Disabled entities keep their components but views and groups returned by
+     * the registry skip them. Toggling an entity takes constant time, it
+     * doesn't touch the pools and doesn't trigger any signal.<br/>
+     * Entities are enabled again when they are released.
+     *
+     * @param entity A valid identifier.
+     * @param value True to enable the entity, false to disable it.
+     * @return True if the state of the entity changed, false otherwise.
+     */
+    bool enable(const entity_type entity, const bool value = true) {
+        ENTT_ASSERT(valid(entity), "Invalid entity");
+        return disabled.enable(entity, value);
+    }
+
+    /**
+     * @brief Disables an entity.
+     * @sa enable
+     * @param entity A valid identifier.
+     * @return True if the state of the entity changed, false otherwise.
+     */
+    bool disable(const entity_type entity) {
+        return enable(entity, false);
+    }
+
+    /**
+     * @brief Checks whether an entity is enabled.
+     * @param entity A valid identifier.
+     * @return True if the entity is enabled, false otherwise.
+     */
+    [[nodiscard]] bool enabled(const entity_type entity) const {
+        ENTT_ASSERT(valid(entity), "Invalid entity");
+        return disabled.enabled(entity);
+    }
+
+    /**
+     * @brief Returns the mask of disabled entities.
+     * @return The mask of disabled entities.
+     */
+    [[nodiscard]] const mask_type &mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
     /**
      * @brief Returns a sink object for the given component.
      *
@@ -1194,6 +1944,55 @@ public:
         return assure<Component>().on_destroy();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * Use this function to receive notifications whenever instances of the
+     * given component are created and assigned to a range of entities.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked **after** assigning the components to the entities
+     * and only once per range.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_bulk_construct() {
+        return assure<Component>().on_bulk_construct();
+    }
+
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * Use this function to receive notifications whenever instances of the
+     * given component are removed from a range of entities and thus
+     * destroyed.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked **before** removing the components from the
+     * entities and only once per range.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_bulk_destroy() {
+        return assure<Component>().on_bulk_destroy();
+    }
+
     /**
      * @brief Returns a view for the given components.
      *
@@ -1209,13 +2008,33 @@ public:
      */
     template<typename Component, typename... Other, typename... Exclude>
     [[nodiscard]] basic_view<entity_type, get_t<std::add_const_t<Component>, std::add_const_t<Other>...>, exclude_t<Exclude...>> view(exclude_t<Exclude...> = {}) const {
-        return {assure<std::remove_const_t<Component>>(), assure<std::remove_const_t<Other>>()..., assure<Exclude>()...};
+        return masked(basic_view<entity_type, get_t<std::add_const_t<Component>, std::add_const_t<Other>...>, exclude_t<Exclude...>>{assure<std::remove_const_t<Component>>(), assure<std::remove_const_t<Other>>()..., assure<Exclude>()...});
     }
 
     /*! @copydoc view */
     template<typename Component, typename... Other, typename... Exclude>
     [[nodiscard]] basic_view<entity_type, get_t<Component, Other...>, exclude_t<Exclude...>> view(exclude_t<Exclude...> = {}) {
-        return {assure<std::remove_const_t<Component>>(), assure<std::remove_const_t<Other>>()..., assure<Exclude>()...};
+        return masked(basic_view<entity_type, get_t<Component, Other...>, exclude_t<Exclude...>>{assure<std::remove_const_t<Component>>(), assure<std::remove_const_t<Other>>()..., assure<Exclude>()...});
+    }
+
+    /**
+     * @brief Returns a view of all the entities still in use.
+     *
+     * This kind of view is driven by the storage of the entities and filters
+     * them with the given components, if any.
+     *
+     * @tparam Exclude Types of components used to filter the view.
+     * @return A newly created view.
+     */
+    template<typename... Exclude>
+    [[nodiscard]] basic_view<entity_type, get_t<>, exclude_t<Exclude...>> view(exclude_t<Exclude...>) const {
+        return masked(basic_view<entity_type, get_t<>, exclude_t<Exclude...>>{entities, assure<Exclude>()...});
+    }
+
+    /*! @copydoc view(exclude_t<Exclude...>) const */
+    template<typename... Exclude>
+    [[nodiscard]] basic_view<entity_type, get_t<>, exclude_t<Exclude...>> view(exclude_t<Exclude...>) {
+        return masked(basic_view<entity_type, get_t<>, exclude_t<Exclude...>>{entities, assure<Exclude>()...});
     }
 
     /**
@@ -1263,12 +2082,36 @@ public:
         if(it != groups.cend()) {
             handler = static_cast<handler_type *>(it->group.get());
         } else {
+            ENTT_ASSERT(!locked, "Groups cannot be created while the registry is frozen");
+
             group_data candidate = {
                 size,
-                {new handler_type{}, [](void *instance) { delete static_cast<handler_type *>(instance); }},
+                {new handler_type{get_allocator()}, [](void *instance) { delete static_cast<handler_type *>(instance); }},
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<std::remove_const_t<Owned>>::value()) || ...); },
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<std::remove_const_t<Get>>::value()) || ...); },
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<Exclude>::value()) || ...); },
+                []([[maybe_unused]] const void *instance) {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        return sizeof(handler_type) + static_cast<const handler_type *>(instance)->current.memory_usage().total();
+                    } else {
+                        return sizeof(handler_type);
+                    }
+                },
+                [](void *instance, basic_registry &owner) { static_cast<handler_type *>(instance)->refresh(owner); },
+                []([[maybe_unused]] void *instance, [[maybe_unused]] const std::size_t cap) {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        static_cast<handler_type *>(instance)->current.reserve(cap);
+                        static_cast<handler_type *>(instance)->current.reserve_sparse(cap);
+                    }
+                },
+                [](void *instance) {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        static_cast<handler_type *>(instance)->current.clear();
+                    } else {
+                        static_cast<handler_type *>(instance)->current = {};
+                        static_cast<handler_type *>(instance)->dirty = false;
+                    }
+                },
             };
 
             handler = static_cast<handler_type *>(candidate.group.get());
@@ -1309,7 +2152,8 @@ public:
             (on_construct<Exclude>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
 
             if constexpr(sizeof...(Owned) == 0) {
-                for(const auto entity: view<Owned..., Get...>(exclude<Exclude...>)) {
+                // disabled entities are part of the group anyway, the mask is applied on iteration
+                for(const auto entity: basic_view<entity_type, get_t<Owned..., Get...>, exclude_t<Exclude...>>{assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()..., assure<Exclude>()...}) {
                     handler->current.emplace(entity);
                 }
             } else {
@@ -1320,7 +2164,11 @@ public:
             }
         }
 
-        return {handler->current, std::get<storage_type<std::remove_const_t<Owned>> &>(cpools)..., std::get<storage_type<std::remove_const_t<Get>> &>(cpools)...};
+        if(policy == group_policy::lazy) {
+            refresh_groups();
+        }
+
+        return masked(basic_group<entity_type, owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>>{handler->current, std::get<storage_type<std::remove_const_t<Owned>> &>(cpools)..., std::get<storage_type<std::remove_const_t<Get>> &>(cpools)...});
     }
 
     /*! @copydoc group */
@@ -1337,7 +2185,8 @@ public:
             return {};
         } else {
             using handler_type = group_handler<exclude_t<std::remove_const_t<Exclude>...>, get_t<std::remove_const_t<Get>...>, std::remove_const_t<Owned>...>;
-            return {static_cast<handler_type *>(it->group.get())->current, assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()...};
+            ENTT_ASSERT(!static_cast<handler_type *>(it->group.get())->dirty, "Group must be arranged first");
+            return masked(basic_group<entity_type, owned_t<std::add_const_t<Owned>...>, get_t<std::add_const_t<Get>...>, exclude_t<Exclude...>>{static_cast<handler_type *>(it->group.get())->current, assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()...});
         }
     }
 
@@ -1353,6 +2202,101 @@ public:
         return group_if_exists<std::add_const_t<Owned>...>(get_t<>{}, exclude<Exclude...>);
     }
 
+    /**
+     * @brief Sets the maintenance policy of owning groups.
+     *
+     * With the lazy policy, owning groups don't arrange their pools as
+     * components are assigned or removed. Instead, they are only marked as
+     * dirty and arranged again in a single pass on the next call to `group`.
+     * This makes bursts of changes (for example, when loading a level) much
+     * cheaper at the price of a full pass on next use.<br/>
+     * Switching back to the eager policy arranges dirty groups immediately.
+     *
+     * @warning
+     * With the lazy policy, a group returned from a previous call to `group`
+     * isn't updated and must be requested again after a change.
+     *
+     * @param value The maintenance policy of owning groups.
+     */
+    void group_maintenance(const group_policy value) {
+        if((policy = value) == group_policy::eager) {
+            refresh_groups();
+        }
+    }
+
+    /**
+     * @brief Returns the maintenance policy of owning groups.
+     * @return The maintenance policy of owning groups.
+     */
+    [[nodiscard]] group_policy group_maintenance() const ENTT_NOEXCEPT {
+        return policy;
+    }
+
+    /**
+     * @brief Sets the order in which released identifiers are recycled.
+     *
+     * By default, the last identifier released is recycled first. Long-running
+     * registries that create and destroy entities all the time can recycle the
+     * lowest identifier first instead. This way, the identifiers in use stay
+     * dense and so do the sparse arrays of all pools.
+     *
+     * @param value The recycling policy to use from now on.
+     */
+    void entity_recycling(const recycle_policy value) {
+        entities.recycling(value);
+    }
+
+    /**
+     * @brief Returns the order in which released identifiers are recycled.
+     * @return The recycling policy in use.
+     */
+    [[nodiscard]] recycle_policy entity_recycling() const ENTT_NOEXCEPT {
+        return entities.recycling();
+    }
+
+    /**
+     * @brief Freezes or unfreezes the structure of a registry.
+     *
+     * While a registry is frozen, pools and groups aren't created and entities
+     * are neither created nor released. Therefore, the structures shared by all
+     * pools are only read and different threads can freely assign and remove
+     * components of different types at the same time, as long as:
+     *
+     * * The pools involved are created before freezing the registry, for
+     *   example by means of `storage`.
+     * * None of the pools involved is observed by a group. Groups arrange or
+     *   track the pools they observe as components are assigned or removed.
+     * * Listeners connected to the pools involved, if any, don't touch pools
+     *   assigned to other threads.
+     * * When the pools involved are tracked by a signature cache, different
+     *   threads don't assign or remove components to or from the same
+     *   entities, since the cache updates a single signature per entity. Its
+     *   signatures must also cover all entities before freezing the registry,
+     *   see `basic_signature_cache::reserve`.
+     *
+     * Accessing the same pool from multiple threads still requires external
+     * synchronization whenever one of them modifies it.
+     *
+     * @warning
+     * Attempting to create pools, groups or entities or to release entities
+     * while a registry is frozen results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in this
+     * case.
+     *
+     * @param value True to freeze the registry, false to unfreeze it.
+     */
+    void freeze(const bool value = true) ENTT_NOEXCEPT {
+        locked = value;
+    }
+
+    /**
+     * @brief Checks whether the structure of a registry is frozen.
+     * @return True if the registry is frozen, false otherwise.
+     */
+    [[nodiscard]] bool frozen() const ENTT_NOEXCEPT {
+        return locked;
+    }
+
     /**
      * @brief Checks whether the given components belong to any group.
      * @tparam Component Types of components in which one is interested.
@@ -1415,6 +2359,7 @@ public:
      */
     template<typename Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
+        static_assert(!pinned_v<Component>, "Pinned storage cannot be sorted");
         ENTT_ASSERT(!owned<Component>(), "Cannot sort owned storage");
         auto &cpool = assure<Component>();
 
@@ -1447,10 +2392,34 @@ public:
      */
     template<typename To, typename From>
     void sort() {
+        static_assert(!pinned_v<To>, "Pinned storage cannot be sorted");
         ENTT_ASSERT(!owned<To>(), "Cannot sort owned storage");
         assure<To>().respect(assure<From>());
     }
 
+    /**
+     * @brief Returns the memory currently allocated by a registry.
+     *
+     * The result accounts for the entities, all the pools and the groups of the
+     * registry. Use the `memory_usage` function of the pools to get a break
+     * down of the memory used by each component type.
+     *
+     * @return The memory currently allocated by the registry.
+     */
+    [[nodiscard]] memory_footprint memory_usage() const {
+        auto usage = entities.memory_usage();
+
+        for(auto &&curr: pools) {
+            usage += curr.second->memory_usage();
+        }
+
+        for(auto &&gdata: groups) {
+            usage.groups += gdata.footprint(gdata.group.get());
+        }
+
+        return usage;
+    }
+
     /**
      * @brief Returns the context object, that is, a general purpose container.
      * @return The context object, that is, a general purpose container.
@@ -1465,11 +2434,16 @@ public:
     }
 
 private:
-    dense_map<id_type, std::unique_ptr<base_type>, identity> pools{};
-    std::vector<group_data> groups{};
-    std::vector<entity_type> entities{};
-    entity_type free_list{tombstone};
+    pool_container_type pools;
+    index_container_type indexed;
+    sequence_container_type sequenced;
+    std::vector<group_data, typename alloc_traits::template rebind_alloc<group_data>> groups;
+    basic_storage<entity_type, entity_type, allocator_type> entities;
+    mask_type disabled;
     context vars;
+    group_policy policy{};
+    bool locked{};
+    std::atomic<size_type> reserved;
 };
 
 } // namespace entt
@@ -0,0 +1,232 @@
+#ifndef ENTT_ENTITY_RELATION_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_RELATION_STORAGE_MIXIN_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/iterator.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Mixin type used to add a reverse index to storage types.
+ *
+ * The target function object returns the entity to which an instance refers,
+ * if any. Its signature must be equivalent to the following form:
+ *
+ * @code{.cpp}
+ * entity_type(const value_type &);
+ * @endcode
+ *
+ * For each target, the storage keeps a packed list of the entities whose
+ * instances refer to it (the _sources_). The index is updated when instances
+ * are created, patched or destroyed, so that the sources of a target are
+ * returned without scanning the whole storage.
+ *
+ * @warning
+ * Modifying instances by means of references isn't detected. Use `patch` to
+ * change the target of an instance.
+ *
+ * @tparam Type The type of the underlying storage.
+ * @tparam Target Type of function object to use to get the target of
+ * instances.
+ */
+template<typename Type, typename Target>
+class relation_storage_mixin: public Type {
+    static_assert(!component_traits<typename Type::value_type>::in_place_delete, "Relation storage does not support in-place delete");
+    static_assert(!ignore_as_empty_v<typename Type::value_type>, "Relation storage requires non-empty types");
+
+    using source_container_type = std::vector<typename Type::entity_type>;
+
+    void link(const typename Type::entity_type entt, const typename Type::entity_type to) {
+        if(to != null) {
+            auto &list = sources_of[to];
+            slot[entt] = list.size();
+            list.push_back(entt);
+        }
+    }
+
+    void unlink(const typename Type::entity_type entt, const typename Type::entity_type from) {
+        if(from != null) {
+            const auto it = sources_of.find(from);
+            auto &list = it->second;
+            const auto pos = slot[entt];
+
+            // sources are swapped and popped, as it happens with storage classes
+            list[pos] = list.back();
+            slot[list[pos]] = pos;
+            list.pop_back();
+            slot.erase(entt);
+
+            if(list.empty()) {
+                sources_of.erase(it);
+            }
+        }
+    }
+
+    void link_range(const std::size_t from) {
+        for(auto pos = from, last = Type::size(); pos < last; ++pos) {
+            link(Type::data()[pos], target(this->rbegin()[pos]));
+        }
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            unlink(*it, target(Type::get(*it)));
+        }
+
+        Type::swap_and_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::pop_n */
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) override {
+        for(auto it = first; it != last; ++it) {
+            unlink(*it, target(Type::get(*it)));
+        }
+
+        Type::pop_n(first, last);
+    }
+
+    /*! @copydoc basic_sparse_set::pop_all */
+    void pop_all() override {
+        sources_of.clear();
+        slot.clear();
+        Type::pop_all();
+    }
+
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        auto it = Type::try_emplace(entt, force_back, value, move);
+        link(entt, target(Type::get(entt)));
+        return it;
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Iterable range of sources. */
+    using iterable = iterable_adaptor<const entity_type *>;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Returns the entities whose instances refer to a given target.
+     *
+     * Sources are returned in no particular order. The range is invalidated
+     * as soon as an instance that refers to the target is created, patched or
+     * destroyed.
+     *
+     * @param to An entity that is the target of a relation, if any.
+     * @return An iterable object to use to visit the sources of the target.
+     */
+    [[nodiscard]] iterable sources(const entity_type to) const {
+        if(const auto it = sources_of.find(to); it != sources_of.cend()) {
+            return {it->second.data(), it->second.data() + it->second.size()};
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Returns the number of entities whose instances refer to a given
+     * target.
+     * @param to An entity that is the target of a relation, if any.
+     * @return The number of sources of the target.
+     */
+    [[nodiscard]] size_type count(const entity_type to) const {
+        const auto it = sources_of.find(to);
+        return (it == sources_of.cend()) ? size_type{} : it->second.size();
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        auto &elem = Type::emplace(entt, std::forward<Args>(args)...);
+        link(entt, target(elem));
+        return elem;
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        const auto from = target(Type::get(entt));
+        auto &elem = Type::patch(entt, std::forward<Func>(func)...);
+
+        if(const auto to = target(elem); to != from) {
+            unlink(entt, from);
+            link(entt, to);
+        }
+
+        return elem;
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        link_range(from);
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        link_range(from);
+    }
+
+private:
+    dense_map<entity_type, source_container_type> sources_of{};
+    dense_map<entity_type, size_type> slot{};
+    Target target{};
+};
+
+} // namespace entt
+
+#endif
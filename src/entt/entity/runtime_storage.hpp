@@ -0,0 +1,494 @@
+#ifndef ENTT_ENTITY_RUNTIME_STORAGE_HPP
+#define ENTT_ENTITY_RUNTIME_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_info.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+namespace entt {
+
+/*! @brief Field of a runtime schema. */
+struct runtime_field {
+    /*! @brief Name of the field. */
+    id_type id;
+    /*! @brief Layout of the field. */
+    const type_layout *layout;
+    /*! @brief Offset of the field within its object, in bytes. */
+    std::size_t offset;
+};
+
+/**
+ * @brief Layout of objects made of fields defined at runtime.
+ *
+ * Schemas describe components that don't exist as C++ types, for example
+ * those defined in data files. Fields are laid out in order of definition and
+ * aligned like the members of a class. Objects are trivially copyable and they
+ * are zero-initialized when default constructed.<br/>
+ * The layout of a schema is meant to be used to create runtime storage. Its
+ * objects are then packed in pages, with no per-object allocations and no
+ * boxing of their fields.
+ *
+ * @warning
+ * Schemas must outlive the storage created from them. Adding fields after
+ * creating a storage or moving the schema results in undefined behavior.
+ */
+class runtime_schema {
+    using container_type = std::vector<runtime_field>;
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = typename container_type::const_iterator;
+    /*! @brief Random access iterator type, fields are read-only. */
+    using iterator = const_iterator;
+
+    /**
+     * @brief Constructs an empty schema.
+     * @param info Type info object to assign to the objects of the schema.
+     */
+    explicit runtime_schema(const type_info &info = type_id<runtime_schema>())
+        : fields{},
+          descriptor{&info, 0u, 1u, nullptr, nullptr, nullptr, nullptr, true} {}
+
+    /**
+     * @brief Appends a field to a schema.
+     * @param id Name of the field.
+     * @param layout Layout of a trivially copyable type.
+     * @return This schema.
+     */
+    runtime_schema &field(const id_type id, const type_layout &layout) {
+        ENTT_ASSERT(layout.trivial, "Fields must be trivially copyable");
+        ENTT_ASSERT(find(id) == nullptr, "Field already exists");
+        const auto last = fields.empty() ? size_type{} : (fields.back().offset + fields.back().layout->size);
+        const auto offset = (last + layout.alignment - 1u) / layout.alignment * layout.alignment;
+        fields.push_back(runtime_field{id, &layout, offset});
+        descriptor.alignment = (std::max)(descriptor.alignment, layout.alignment);
+        descriptor.size = (offset + layout.size + descriptor.alignment - 1u) / descriptor.alignment * descriptor.alignment;
+        return *this;
+    }
+
+    /**
+     * @brief Appends a field of a given type to a schema.
+     * @tparam Type Trivially copyable type of the field.
+     * @param id Name of the field.
+     * @return This schema.
+     */
+    template<typename Type>
+    runtime_schema &field(const id_type id) {
+        static_assert(std::is_trivially_copyable_v<Type> && std::is_copy_constructible_v<Type> && std::is_default_constructible_v<Type>, "Fields must be trivially copyable");
+        return field(id, type_layout_of<Type>());
+    }
+
+    /**
+     * @brief Returns an iterator to the first field of a schema.
+     * @return An iterator to the first field of the schema.
+     */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return fields.cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator past the last field of a schema.
+     * @return An iterator past the last field of the schema.
+     */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return fields.cend();
+    }
+
+    /**
+     * @brief Returns the number of fields of a schema.
+     * @return Number of fields of the schema.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return fields.size();
+    }
+
+    /**
+     * @brief Finds a field by name.
+     * @param id Name of the field to look for.
+     * @return The requested field if any, a null pointer otherwise.
+     */
+    [[nodiscard]] const runtime_field *find(const id_type id) const ENTT_NOEXCEPT {
+        for(auto &&elem: fields) {
+            if(elem.id == id) {
+                return &elem;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns a field of an object, if its type is the given one.
+     * @tparam Type Type of the field.
+     * @param instance An object of the schema.
+     * @param id Name of the field.
+     * @return A pointer to the field if any, a null pointer otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] Type *get(void *instance, const id_type id) const ENTT_NOEXCEPT {
+        const auto *elem = find(id);
+        return (elem && *elem->layout->info == type_id<Type>()) ? reinterpret_cast<Type *>(static_cast<std::byte *>(instance) + elem->offset) : nullptr;
+    }
+
+    /*! @copydoc get */
+    template<typename Type>
+    [[nodiscard]] const Type *get(const void *instance, const id_type id) const ENTT_NOEXCEPT {
+        return get<Type>(const_cast<void *>(instance), id);
+    }
+
+    /**
+     * @brief Returns the layout of the objects of a schema.
+     * @return The layout of the objects of the schema.
+     */
+    [[nodiscard]] const type_layout &layout() const ENTT_NOEXCEPT {
+        return descriptor;
+    }
+
+private:
+    container_type fields;
+    type_layout descriptor;
+};
+
+/**
+ * @brief Storage for objects whose type is only known at runtime.
+ *
+ * Objects are described by a type layout rather than by a type. They're packed
+ * in pages like in any other storage and they're constructed, moved and
+ * destroyed in place through the thunks of the layout. Therefore, plugins and
+ * scripts can create storage for runtime defined components without boxing
+ * their objects.<br/>
+ * Objects are only accessible in their type-erased form, through the API of
+ * the sparse set.
+ *
+ * @warning
+ * Over-aligned types aren't supported.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_runtime_storage: public basic_sparse_set<Entity, Allocator> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, Allocator>;
+    using block_type = std::max_align_t;
+    using block_alloc_traits = typename alloc_traits::template rebind_traits<block_type>;
+    using block_allocator_type = typename alloc_traits::template rebind_alloc<block_type>;
+    using container_type = std::vector<typename block_alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename block_alloc_traits::pointer>>;
+
+    static constexpr std::size_t page_size = ENTT_PACKED_PAGE;
+
+    [[nodiscard]] static std::size_t stride_of(const type_layout &value) ENTT_NOEXCEPT {
+        ENTT_ASSERT(value.alignment != 0u && value.alignment <= alignof(block_type), "Invalid alignment");
+        const auto size = value.size ? value.size : std::size_t{1u};
+        return (size + value.alignment - 1u) / value.alignment * value.alignment;
+    }
+
+    void move_construct(void *elem, void *other) const {
+        if(descriptor->trivial) {
+            std::memcpy(elem, other, descriptor->size);
+        } else {
+            descriptor->move(elem, other);
+        }
+    }
+
+    void destroy_element(void *elem) const {
+        if(!descriptor->trivial) {
+            descriptor->destroy(elem);
+        }
+    }
+
+    [[nodiscard]] std::size_t blocks_per_page() const ENTT_NOEXCEPT {
+        return (page_size * stride + sizeof(block_type) - 1u) / sizeof(block_type);
+    }
+
+    [[nodiscard]] void *element_at(const std::size_t pos) const {
+        return reinterpret_cast<std::byte *>(to_address(pages[pos / page_size])) + fast_mod(pos, page_size) * stride;
+    }
+
+    void *assure_at_least(const std::size_t pos) {
+        if(const auto idx = pos / page_size; !(idx < pages.size())) {
+            auto curr = pages.size();
+            pages.resize(idx + 1u, nullptr);
+
+            ENTT_TRY {
+                for(const auto last = pages.size(); curr < last; ++curr) {
+                    pages[curr] = block_alloc_traits::allocate(page_allocator, blocks_per_page());
+                }
+            }
+            ENTT_CATCH {
+                pages.resize(curr);
+                ENTT_THROW;
+            }
+        }
+
+        return element_at(pos);
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+            if(base_type::at(pos) != tombstone) {
+                destroy_element(element_at(pos));
+            }
+        }
+
+        const auto from = (sz + page_size - 1u) / page_size;
+
+        for(auto pos = from, last = pages.size(); pos < last; ++pos) {
+            block_alloc_traits::deallocate(page_allocator, pages[pos], blocks_per_page());
+        }
+
+        pages.resize(from);
+    }
+
+    template<typename Func>
+    auto emplace_element(const Entity entt, const bool force_back, Func func) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            func(assure_at_least(static_cast<size_type>(it.index())));
+        }
+        ENTT_CATCH {
+            base_type::swap_and_pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+private:
+    const void *get_at(const std::size_t pos) const final {
+        return element_at(pos);
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        // a scratch object is used as a temporary, objects are only known by layout
+        auto *tmp = to_address(scratch);
+        move_construct(tmp, element_at(lhs));
+        destroy_element(element_at(lhs));
+        move_construct(element_at(lhs), element_at(rhs));
+        destroy_element(element_at(rhs));
+        move_construct(element_at(rhs), tmp);
+        destroy_element(tmp);
+    }
+
+    void move_element(const std::size_t from, const std::size_t to) final {
+        auto *elem = assure_at_least(to);
+        move_construct(elem, element_at(from));
+        destroy_element(element_at(from));
+    }
+
+protected:
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            auto *hole = element_at(static_cast<size_type>(first.index()));
+            auto *elem = element_at(base_type::size() - 1u);
+            destroy_element(hole);
+
+            if(hole != elem) {
+                move_construct(hole, elem);
+                destroy_element(elem);
+            }
+
+            base_type::swap_and_pop(first, first + 1u);
+        }
+    }
+
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void in_place_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            base_type::in_place_pop(first, first + 1u);
+            destroy_element(element_at(static_cast<size_type>(first.index())));
+        }
+    }
+
+    /**
+     * @brief Erases a batch of elements from a storage.
+     * @param first A pointer to the first entity to erase.
+     * @param last A pointer past the last entity to erase.
+     */
+    void pop_n(const Entity *first, const Entity *last) override {
+        for(; first != last; ++first) {
+            const auto it = --(base_type::end() - base_type::index(*first));
+            (base_type::policy() != deletion_policy::swap_and_pop) ? basic_runtime_storage::in_place_pop(it, it + 1u) : basic_runtime_storage::swap_and_pop(it, it + 1u);
+        }
+    }
+
+    /*! @brief Erases all elements from a storage at once. */
+    void pop_all() override {
+        const auto length = base_type::size();
+        base_type::pop_all();
+
+        for(size_type pos{}; pos < length; ++pos) {
+            destroy_element(element_at(pos));
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @param move Whether to move from the opaque value rather than copying it.
+     * @return Iterator pointing to the emplaced element.
+     */
+    typename underlying_type::basic_iterator try_emplace(const Entity entt, const bool force_back, const void *value, const bool move) override {
+        if(value && move) {
+            return emplace_element(entt, force_back, [this, value](void *elem) { move_construct(elem, const_cast<void *>(value)); });
+        } else if(value && descriptor->trivial) {
+            return emplace_element(entt, force_back, [this, value](void *elem) { std::memcpy(elem, value, descriptor->size); });
+        } else if(value) {
+            return descriptor->copy ? emplace_element(entt, force_back, [this, value](void *elem) { descriptor->copy(elem, value); }) : base_type::end();
+        } else if(descriptor->construct) {
+            return emplace_element(entt, force_back, [this](void *elem) { descriptor->construct(elem); });
+        } else {
+            return descriptor->trivial ? emplace_element(entt, force_back, [this](void *elem) { std::memset(elem, 0, descriptor->size); }) : base_type::end();
+        }
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty storage for a given type layout.
+     * @param value The layout of the objects assigned to the entities.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_runtime_storage(const type_layout &value, const allocator_type &allocator = {})
+        : base_type{*value.info, deletion_policy::swap_and_pop, allocator},
+          descriptor{&value},
+          stride{stride_of(value)},
+          pages{allocator},
+          page_allocator{allocator},
+          scratch{block_alloc_traits::allocate(page_allocator, (stride + sizeof(block_type) - 1u) / sizeof(block_type))} {
+        ENTT_ASSERT(value.trivial || (value.move && value.destroy), "Objects must be at least movable and destructible");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_runtime_storage(const basic_runtime_storage &) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_runtime_storage() override {
+        shrink_to_size(0u);
+        block_alloc_traits::deallocate(page_allocator, scratch, (stride + sizeof(block_type) - 1u) / sizeof(block_type));
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_runtime_storage &operator=(const basic_runtime_storage &) = delete;
+
+    /**
+     * @brief Returns the layout of the objects of a storage.
+     * @return The layout of the objects assigned to the entities.
+     */
+    [[nodiscard]] const type_layout &layout() const ENTT_NOEXCEPT {
+        return *descriptor;
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT override {
+        return pages.size() * page_size;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Returns the amount of memory used by a storage.
+     * @return The memory footprint of the storage.
+     */
+    [[nodiscard]] memory_footprint memory_usage() const override {
+        auto usage = base_type::memory_usage();
+        usage.payload = pages.capacity() * sizeof(typename container_type::value_type) + pages.size() * blocks_per_page() * sizeof(block_type);
+        return usage;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object in place.
+     *
+     * The function object receives the memory in which to construct the object
+     * and must construct it there. The signature of the function must be
+     * equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(void *);
+     * @endcode
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param entt A valid identifier.
+     * @param func A valid function object.
+     * @return A pointer to the newly created object.
+     */
+    template<typename Func>
+    void *emplace_with(const entity_type entt, Func func) {
+        const auto it = emplace_element(entt, false, std::move(func));
+        return element_at(static_cast<size_type>(it.index()));
+    }
+
+private:
+    const type_layout *descriptor;
+    size_type stride;
+    container_type pages;
+    block_allocator_type page_allocator;
+    typename block_alloc_traits::pointer scratch;
+};
+
+} // namespace entt
+
+#endif
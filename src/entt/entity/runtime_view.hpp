@@ -26,7 +26,7 @@ class runtime_view_iterator final {
 
     [[nodiscard]] bool valid() const {
         return (!tombstone_check || *it != tombstone)
-               && std::all_of(++pools->begin(), pools->end(), [entt = *it](const auto *curr) { return curr->contains(entt); })
+               && std::all_of(pools->begin(), pools->end(), [entt = *it, skip = lead](const auto *curr) { return curr == skip || curr->contains(entt); })
                && std::none_of(filter->cbegin(), filter->cend(), [entt = *it](const auto *curr) { return curr && curr->contains(entt); });
     }
 
@@ -39,18 +39,19 @@ public:
 
     runtime_view_iterator() ENTT_NOEXCEPT = default;
 
-    runtime_view_iterator(const std::vector<const Type *> &cpools, const std::vector<const Type *> &ignore, iterator_type curr) ENTT_NOEXCEPT
+    runtime_view_iterator(const std::vector<const Type *> &cpools, const std::vector<const Type *> &ignore, const Type *candidate, iterator_type curr) ENTT_NOEXCEPT
         : pools{&cpools},
           filter{&ignore},
+          lead{candidate},
           it{curr},
-          tombstone_check{pools->size() == 1u && (*pools)[0u]->policy() == deletion_policy::in_place} {
-        if(it != (*pools)[0]->end() && !valid()) {
+          tombstone_check{pools->size() == 1u && lead->policy() != deletion_policy::swap_and_pop} {
+        if(it != lead->end() && !valid()) {
             ++(*this);
         }
     }
 
     runtime_view_iterator &operator++() {
-        while(++it != (*pools)[0]->end() && !valid()) {}
+        while(++it != lead->end() && !valid()) {}
         return *this;
     }
 
@@ -60,7 +61,7 @@ public:
     }
 
     runtime_view_iterator &operator--() {
-        while(--it != (*pools)[0]->begin() && !valid()) {}
+        while(--it != lead->begin() && !valid()) {}
         return *this;
     }
 
@@ -88,6 +89,7 @@ public:
 private:
     const std::vector<const Type *> *pools;
     const std::vector<const Type *> *filter;
+    const Type *lead;
     iterator_type it;
     bool tombstone_check;
 };
@@ -116,6 +118,9 @@ struct basic_runtime_view;
  * number of entities available for each component and picks up a reference to
  * the smallest set of candidate entities in order to get a performance boost
  * when iterate.<br/>
+ * Pools are otherwise kept in the order in which they are added to the view.
+ * A view can be cleared and reused, so as to avoid allocating memory every
+ * time it's built.<br/>
  * Order of elements during iterations are highly dependent on the order of the
  * underlying data structures. See sparse_set and its specializations for more
  * details.
@@ -161,7 +166,8 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_runtime_view() ENTT_NOEXCEPT
         : pools{},
-          filter{} {}
+          filter{},
+          lead{} {}
 
     /**
      * @brief Appends an opaque storage object to a runtime view.
@@ -169,12 +175,11 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
      * @return This runtime view.
      */
     basic_runtime_view &iterate(const base_type &base) {
-        if(pools.empty() || !(base.size() < pools[0u]->size())) {
-            pools.push_back(&base);
-        } else {
-            pools.push_back(std::exchange(pools[0u], &base));
+        if(!lead || base.size() < lead->size()) {
+            lead = &base;
         }
 
+        pools.push_back(&base);
         return *this;
     }
 
@@ -188,12 +193,24 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
         return *this;
     }
 
+    /**
+     * @brief Removes all storage objects from a runtime view.
+     *
+     * The memory used to store the references to the storage objects isn't
+     * released, so that the view can be built again without allocating.
+     */
+    void clear() ENTT_NOEXCEPT {
+        pools.clear();
+        filter.clear();
+        lead = nullptr;
+    }
+
     /**
      * @brief Estimates the number of entities iterated by the view.
      * @return Estimated number of entities iterated by the view.
      */
     [[nodiscard]] size_type size_hint() const {
-        return pools.empty() ? size_type{} : pools.front()->size();
+        return lead ? lead->size() : size_type{};
     }
 
     /**
@@ -207,7 +224,7 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
      * @return An iterator to the first entity that has the given components.
      */
     [[nodiscard]] iterator begin() const {
-        return pools.empty() ? iterator{} : iterator{pools, filter, pools[0]->begin()};
+        return lead ? iterator{pools, filter, lead, lead->begin()} : iterator{};
     }
 
     /**
@@ -222,7 +239,7 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
      * given components.
      */
     [[nodiscard]] iterator end() const {
-        return pools.empty() ? iterator{} : iterator{pools, filter, pools[0]->end()};
+        return lead ? iterator{pools, filter, lead, lead->end()} : iterator{};
     }
 
     /**
@@ -237,15 +254,20 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
     }
 
     /**
-     * @brief Iterates entities and applies the given function object to them.
+     * @brief Iterates entities and elements and applies the given function
+     * object to them.
      *
-     * The function object is invoked for each entity. It is provided only with
-     * the entity itself. To get the components, users can use the registry with
-     * which the view was built.<br/>
-     * The signature of the function should be equivalent to the following:
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and, optionally, with an array of opaque pointers to the
+     * elements assigned to it, one per storage object and in the same order in
+     * which they were added to the view. Storage objects that don't contain
+     * elements (such as those for empty types) return null pointers.<br/>
+     * The signature of the function should be equivalent to one of the
+     * following:
      *
      * @code{.cpp}
      * void(const entity_type);
+     * void(const entity_type, const void *const *);
      * @endcode
      *
      * @tparam Func Type of the function object to invoke.
@@ -253,14 +275,32 @@ struct basic_runtime_view<basic_sparse_set<Entity, Allocator>> {
      */
     template<typename Func>
     void each(Func func) const {
-        for(const auto entity: *this) {
-            func(entity);
+        if constexpr(std::is_invocable_v<Func, entity_type, const void *const *>) {
+            // most runtime views have a handful of pools, there is no need to allocate
+            const void *buffer[small_size]{};
+            std::vector<const void *> overflow(pools.size() > small_size ? pools.size() : size_type{});
+            const void **elements = overflow.empty() ? buffer : overflow.data();
+
+            for(const auto entity: *this) {
+                for(size_type pos{}, last = pools.size(); pos < last; ++pos) {
+                    elements[pos] = pools[pos]->get(entity);
+                }
+
+                func(entity, static_cast<const void *const *>(elements));
+            }
+        } else {
+            for(const auto entity: *this) {
+                func(entity);
+            }
         }
     }
 
 private:
+    static constexpr size_type small_size = 8u;
+
     std::vector<const base_type *> pools;
     std::vector<const base_type *> filter;
+    const base_type *lead;
 };
 
 } // namespace entt
@@ -0,0 +1,413 @@
+#ifndef ENTT_ENTITY_SEGMENT_HPP
+#define ENTT_ENTITY_SEGMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_info.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+struct segment_header {
+    static constexpr std::size_t block_size = 64u;
+    static constexpr std::size_t classes = std::numeric_limits<std::size_t>::digits;
+    static constexpr std::size_t directory_size = 64u;
+
+    struct entry {
+        id_type id;
+        std::size_t element_size;
+        std::size_t page_size;
+        std::size_t pages;
+        std::size_t page_count;
+        std::size_t packed;
+        std::size_t count;
+    };
+
+    [[nodiscard]] std::byte *base() ENTT_NOEXCEPT {
+        return reinterpret_cast<std::byte *>(this);
+    }
+
+    [[nodiscard]] static std::size_t size_class(const std::size_t bytes) ENTT_NOEXCEPT {
+        std::size_t cls{};
+        for(auto curr = block_size; curr < bytes; curr <<= 1u, ++cls) {}
+        return cls;
+    }
+
+    void *allocate(const std::size_t bytes) {
+        const auto cls = size_class(bytes);
+
+        if(auto &head = free_list[cls]; head) {
+            // freed blocks store the offset of the next one of the same class
+            auto *block = base() + head;
+            std::memcpy(&head, block, sizeof(head));
+            return block;
+        }
+
+        if(const auto length = block_size << cls; length <= (capacity - used)) {
+            auto *block = base() + used;
+            used += length;
+            return block;
+        }
+
+        ENTT_THROW std::bad_alloc{};
+        return nullptr;
+    }
+
+    void deallocate(void *ptr, const std::size_t bytes) ENTT_NOEXCEPT {
+        auto &head = free_list[size_class(bytes)];
+        std::memcpy(ptr, &head, sizeof(head));
+        head = static_cast<std::size_t>(static_cast<std::byte *>(ptr) - base());
+    }
+
+    std::uintptr_t address;
+    std::size_t capacity;
+    std::size_t used;
+    std::size_t free_list[classes];
+    std::size_t entries;
+    entry directory[directory_size];
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Allocator that carves blocks of memory out of a memory segment.
+ *
+ * Blocks are aligned to 64 bytes and their sizes are rounded up to a power of
+ * two. Released blocks are reused for requests of the same size class but
+ * they are never merged nor returned to the segment.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class segment_allocator {
+    static_assert(alignof(Type) <= internal::segment_header::block_size, "Over-aligned types are not supported");
+
+    template<typename>
+    friend class segment_allocator;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Propagates on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Propagates on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /**
+     * @brief Constructs an allocator for a given segment.
+     * @param ref A valid reference to a memory segment.
+     */
+    segment_allocator(const memory_segment &ref) ENTT_NOEXCEPT;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator to convert from.
+     */
+    template<typename Other>
+    segment_allocator(const segment_allocator<Other> &other) ENTT_NOEXCEPT
+        : header{other.header} {}
+
+    /**
+     * @brief Allocates storage for a number of objects.
+     * @param count Number of objects to allocate storage for.
+     * @return A pointer to the beginning of the allocated storage.
+     */
+    [[nodiscard]] value_type *allocate(const std::size_t count) {
+        ENTT_ASSERT(count <= (std::numeric_limits<std::size_t>::max() / sizeof(value_type)), "Numeric limits exceeded");
+        return static_cast<value_type *>(header->allocate(count * sizeof(value_type)));
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated by this allocator.
+     * @param ptr A pointer to the beginning of the allocated storage.
+     * @param count Number of objects the storage was allocated for.
+     */
+    void deallocate(value_type *ptr, const std::size_t count) ENTT_NOEXCEPT {
+        header->deallocate(ptr, count * sizeof(value_type));
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator with which to compare.
+     * @return True if the allocators refer to the same segment, false
+     * otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const segment_allocator<Other> &other) const ENTT_NOEXCEPT {
+        return header == other.header;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator with which to compare.
+     * @return False if the allocators refer to the same segment, true
+     * otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const segment_allocator<Other> &other) const ENTT_NOEXCEPT {
+        return !(*this == other);
+    }
+
+private:
+    internal::segment_header *header;
+};
+
+/**
+ * @brief Memory segment shared with other processes.
+ *
+ * The segment doesn't map any memory. It formats a region provided by the
+ * caller, such as a named shared memory object mapped by the platform API, and
+ * manages it on behalf of storage classes that use a `segment_allocator`.
+ * Therefore, pages, page tables and packed arrays of entities all live within
+ * the region.<br/>
+ * Publishing a storage records where its arrays are, as offsets from the start
+ * of the region. Readers that map the same region at a different address find
+ * them by means of a segment view, without copying nor serializing anything.
+ *
+ * @warning
+ * Readers aren't synchronized with the writer in any way. Modifying or
+ * publishing a storage while another process reads it results in undefined
+ * behavior.
+ */
+class memory_segment {
+    using header_type = internal::segment_header;
+
+    template<typename>
+    friend class segment_allocator;
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Formats a region of memory as a segment.
+     * @param mem A pointer to a region aligned to at least 64 bytes.
+     * @param length Size of the region in bytes.
+     */
+    memory_segment(void *mem, const size_type length)
+        : header{::new(mem) header_type{}} {
+        ENTT_ASSERT(reinterpret_cast<std::uintptr_t>(mem) % header_type::block_size == 0u, "Misaligned segment");
+        ENTT_ASSERT(length >= sizeof(header_type), "Segment too small");
+        header->address = reinterpret_cast<std::uintptr_t>(mem);
+        header->capacity = length;
+        // blocks are aligned relative to the start of the segment
+        header->used = (sizeof(header_type) + header_type::block_size - 1u) / header_type::block_size * header_type::block_size;
+    }
+
+    /**
+     * @brief Returns the number of bytes in use, including the released ones.
+     * @return The number of bytes in use.
+     */
+    [[nodiscard]] size_type used() const ENTT_NOEXCEPT {
+        return header->used;
+    }
+
+    /**
+     * @brief Returns the size of the segment in bytes.
+     * @return The size of the segment in bytes.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return header->capacity;
+    }
+
+    /**
+     * @brief Records where the arrays of a storage are, so that readers find
+     * them.
+     *
+     * Publishing the same identifier again updates the information recorded.
+     * Storage classes must be published again after adding elements, since
+     * their arrays can be reallocated in the meantime.
+     *
+     * @tparam Storage Type of storage to publish.
+     * @param pool A storage that uses an allocator for this segment.
+     * @param id Optional name used to look up the storage.
+     */
+    template<typename Storage>
+    void publish(const Storage &pool, const id_type id = type_hash<typename Storage::value_type>::value()) {
+        using value_type = typename Storage::value_type;
+        static_assert(std::is_trivially_copyable_v<value_type>, "Shared elements must be trivially copyable");
+        static_assert(!ignore_as_empty_v<value_type> && !soa_layout_v<value_type> && !shared_v<value_type>, "Unsupported layout");
+        ENTT_ASSERT(pool.get_allocator() == segment_allocator<value_type>{*this}, "Storage does not belong to the segment");
+
+        auto *elem = header->directory;
+        for(const auto *last = elem + header->entries; elem != last && elem->id != id; ++elem) {}
+
+        if(elem == header->directory + header->entries) {
+            ENTT_ASSERT(header->entries < header_type::directory_size, "Directory is full");
+            ++header->entries;
+        }
+
+        elem->id = id;
+        elem->element_size = sizeof(value_type);
+        elem->page_size = component_traits<value_type>::page_size;
+        elem->pages = offset(pool.raw());
+        elem->page_count = pool.capacity() / component_traits<value_type>::page_size;
+        elem->packed = offset(pool.data());
+        elem->count = pool.size();
+    }
+
+private:
+    [[nodiscard]] size_type offset(const void *ptr) const ENTT_NOEXCEPT {
+        // empty arrays aren't allocated and are published as such
+        return ptr ? static_cast<size_type>(reinterpret_cast<std::uintptr_t>(ptr) - header->address) : size_type{};
+    }
+
+    header_type *header;
+};
+
+template<typename Type>
+segment_allocator<Type>::segment_allocator(const memory_segment &ref) ENTT_NOEXCEPT
+    : header{ref.header} {}
+
+/**
+ * @brief Read-only view of a storage published in a memory segment.
+ *
+ * The view translates the offsets recorded by the writer into addresses of the
+ * region as it's mapped by the reader. It can iterate the elements of the
+ * storage and their entities but it can't modify them in any way.
+ *
+ * @warning
+ * The view refers to the arrays as they were when the storage was published.
+ * Creating a view is cheap and it's best done every time the writer publishes
+ * the storage again.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of elements of the storage.
+ */
+template<typename Entity, typename Type>
+class basic_segment_view {
+    static_assert(std::is_trivially_copyable_v<Type>, "Shared elements must be trivially copyable");
+
+    using header_type = internal::segment_header;
+
+    template<typename Value>
+    [[nodiscard]] const Value *translate(const std::uintptr_t address) const ENTT_NOEXCEPT {
+        return reinterpret_cast<const Value *>(reinterpret_cast<const std::byte *>(header) + (address - header->address));
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Type of elements of the storage. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a view for a storage published in a segment.
+     * @param mem A pointer to the region as it's mapped by the reader.
+     * @param id Optional name used to look up the storage.
+     */
+    basic_segment_view(const void *mem, const id_type id = type_hash<Type>::value()) ENTT_NOEXCEPT
+        : header{static_cast<const header_type *>(mem)},
+          entry{} {
+        for(auto pos = header->entries; pos && !entry; --pos) {
+            if(const auto *elem = header->directory + pos - 1u; elem->id == id) {
+                ENTT_ASSERT(elem->element_size == sizeof(Type), "Unexpected type");
+                entry = elem;
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if a view refers to a published storage.
+     * @return True if the view refers to a published storage, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return entry != nullptr;
+    }
+
+    /**
+     * @brief Returns the number of elements in the storage, tombstones
+     * included.
+     * @return Number of elements in the storage.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return entry ? entry->count : size_type{};
+    }
+
+    /**
+     * @brief Checks whether the storage is empty.
+     * @return True if the storage is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (size() == 0u);
+    }
+
+    /**
+     * @brief Direct access to the packed array of entities.
+     * @return A pointer to the packed array of entities.
+     */
+    [[nodiscard]] const entity_type *data() const ENTT_NOEXCEPT {
+        return empty() ? nullptr : reinterpret_cast<const entity_type *>(reinterpret_cast<const std::byte *>(header) + entry->packed);
+    }
+
+    /**
+     * @brief Returns the element at a given position of the packed array.
+     * @param pos A valid position.
+     * @return The element at the given position.
+     */
+    [[nodiscard]] const value_type &operator[](const size_type pos) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < size(), "Index out of bounds");
+        const auto *pages = reinterpret_cast<const std::uintptr_t *>(reinterpret_cast<const std::byte *>(header) + entry->pages);
+        return translate<value_type>(pages[pos / entry->page_size])[fast_mod(pos, entry->page_size)];
+    }
+
+    /**
+     * @brief Iterates entities and elements and applies the given function
+     * object to them.
+     *
+     * Tombstones are skipped and elements are returned in the same order as
+     * the storage returns them. The signature of the function must be
+     * equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const value_type &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        const auto *entities = data();
+
+        for(auto pos = size(); pos; --pos) {
+            if(const auto entt = entities[pos - 1u]; entt != tombstone) {
+                func(entt, (*this)[pos - 1u]);
+            }
+        }
+    }
+
+private:
+    const header_type *header;
+    const header_type::entry *entry;
+};
+
+} // namespace entt
+
+#endif
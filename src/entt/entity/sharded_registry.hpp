@@ -0,0 +1,307 @@
+#ifndef ENTT_ENTITY_SHARDED_REGISTRY_HPP
+#define ENTT_ENTITY_SHARDED_REGISTRY_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+namespace entt {
+
+/**
+ * @brief Sharded registry.
+ *
+ * A sharded registry is a facade over a fixed number of independent registries
+ * (shards). Entities are identified globally by encoding the shard they belong
+ * to in the high bits of their entity part. Requests are routed to the owning
+ * shard and entities can be migrated from a shard to another along with their
+ * components.
+ *
+ * Shards don't share any data. Therefore, different shards can be used freely
+ * from different threads without synchronization. Migrations touch two shards
+ * at once and must be synchronized by the caller.
+ *
+ * @warning
+ * Global identifiers aren't valid within shards and vice versa. Use the
+ * `local` and `global` member functions to convert between them.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_sharded_registry final {
+    using entity_traits = entt_traits<Entity>;
+    using underlying_type = typename entity_traits::entity_type;
+
+    [[nodiscard]] static constexpr std::size_t bits_for(const std::size_t count) ENTT_NOEXCEPT {
+        std::size_t bits{};
+
+        while((std::size_t{1u} << bits) < count) {
+            ++bits;
+        }
+
+        return bits;
+    }
+
+public:
+    /*! @brief Underlying registry type. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Underlying version type. */
+    using version_type = typename entity_traits::version_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a sharded registry with a given number of shards.
+     * @param count Number of shards, at least one.
+     */
+    explicit basic_sharded_registry(const size_type count)
+        : shards(count),
+          shift{static_cast<underlying_type>(internal::popcount(entity_traits::entity_mask) - bits_for(count))},
+          local_mask{static_cast<underlying_type>(entity_traits::entity_mask >> bits_for(count))} {
+        ENTT_ASSERT(count != 0u, "Invalid number of shards");
+        ENTT_ASSERT(bits_for(count) < internal::popcount(entity_traits::entity_mask), "Too many shards");
+    }
+
+    /**
+     * @brief Returns the number of shards.
+     * @return The number of shards.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return shards.size();
+    }
+
+    /**
+     * @brief Returns the given shard.
+     * @param pos Index of the shard to return.
+     * @return A reference to the requested shard.
+     */
+    [[nodiscard]] registry_type &shard(const size_type pos) {
+        ENTT_ASSERT(pos < shards.size(), "Index out of bounds");
+        return shards[pos];
+    }
+
+    /*! @copydoc shard */
+    [[nodiscard]] const registry_type &shard(const size_type pos) const {
+        ENTT_ASSERT(pos < shards.size(), "Index out of bounds");
+        return shards[pos];
+    }
+
+    /**
+     * @brief Returns the index of the shard that owns an entity.
+     * @param entity A global identifier.
+     * @return The index of the owning shard.
+     */
+    [[nodiscard]] size_type shard_of(const entity_type entity) const ENTT_NOEXCEPT {
+        return static_cast<size_type>(entity_traits::to_entity(entity) >> shift);
+    }
+
+    /**
+     * @brief Converts a global identifier to the one used by its shard.
+     * @param entity A global identifier.
+     * @return The identifier of the entity within its shard.
+     */
+    [[nodiscard]] entity_type local(const entity_type entity) const ENTT_NOEXCEPT {
+        return entity_traits::construct(entity_traits::to_entity(entity) & local_mask, entity_traits::to_version(entity));
+    }
+
+    /**
+     * @brief Converts an identifier used by a shard to a global one.
+     * @param pos Index of the shard to which the entity belongs.
+     * @param entity An identifier within the given shard.
+     * @return The global identifier of the entity.
+     */
+    [[nodiscard]] entity_type global(const size_type pos, const entity_type entity) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(entity_traits::to_entity(entity) < local_mask, "Identifier out of range");
+        return entity_traits::construct(static_cast<underlying_type>(static_cast<underlying_type>(pos) << shift) | entity_traits::to_entity(entity), entity_traits::to_version(entity));
+    }
+
+    /**
+     * @brief Checks if a global identifier refers to a valid entity.
+     * @param entity A global identifier, either valid or not.
+     * @return True if the identifier is valid, false otherwise.
+     */
+    [[nodiscard]] bool valid(const entity_type entity) const {
+        const auto pos = shard_of(entity);
+        return pos < shards.size() && shards[pos].valid(local(entity));
+    }
+
+    /**
+     * @brief Creates a new entity within a given shard.
+     * @param pos Index of the shard in which to create the entity.
+     * @return A valid global identifier.
+     */
+    [[nodiscard]] entity_type create(const size_type pos) {
+        return global(pos, shard(pos).create());
+    }
+
+    /**
+     * @brief Destroys an entity and releases its identifier.
+     * @param entity A valid global identifier.
+     * @return The version of the recycled entity.
+     */
+    version_type destroy(const entity_type entity) {
+        return owner(entity).destroy(local(entity));
+    }
+
+    /**
+     * @brief Assigns the given component to an entity.
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid global identifier.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the newly created component.
+     */
+    template<typename Component, typename... Args>
+    decltype(auto) emplace(const entity_type entity, Args &&...args) {
+        return owner(entity).template emplace<Component>(local(entity), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Assigns or replaces the given component for an entity.
+     * @tparam Component Type of component to assign or replace.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid global identifier.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the newly created component.
+     */
+    template<typename Component, typename... Args>
+    decltype(auto) emplace_or_replace(const entity_type entity, Args &&...args) {
+        return owner(entity).template emplace_or_replace<Component>(local(entity), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Replaces the given component for an entity.
+     * @tparam Component Type of component to replace.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid global identifier.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the component being replaced.
+     */
+    template<typename Component, typename... Args>
+    decltype(auto) replace(const entity_type entity, Args &&...args) {
+        return owner(entity).template replace<Component>(local(entity), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes the given components from an entity, if any.
+     * @tparam Component Types of components to remove.
+     * @param entity A valid global identifier.
+     * @return The number of components actually removed.
+     */
+    template<typename... Component>
+    size_type remove(const entity_type entity) {
+        return owner(entity).template remove<Component...>(local(entity));
+    }
+
+    /**
+     * @brief Checks if an entity has all the given components.
+     * @tparam Component Components for which to perform the check.
+     * @param entity A valid global identifier.
+     * @return True if the entity has all the components, false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool all_of(const entity_type entity) const {
+        return owner(entity).template all_of<Component...>(local(entity));
+    }
+
+    /**
+     * @brief Checks if an entity has at least one of the given components.
+     * @tparam Component Components for which to perform the check.
+     * @param entity A valid global identifier.
+     * @return True if the entity has at least one of the given components,
+     * false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool any_of(const entity_type entity) const {
+        return owner(entity).template any_of<Component...>(local(entity));
+    }
+
+    /**
+     * @brief Returns references to the given components for an entity.
+     * @tparam Component Types of components to get.
+     * @param entity A valid global identifier.
+     * @return References to the components owned by the entity.
+     */
+    template<typename... Component>
+    [[nodiscard]] decltype(auto) get(const entity_type entity) const {
+        return owner(entity).template get<Component...>(local(entity));
+    }
+
+    /*! @copydoc get */
+    template<typename... Component>
+    [[nodiscard]] decltype(auto) get(const entity_type entity) {
+        return owner(entity).template get<Component...>(local(entity));
+    }
+
+    /**
+     * @brief Returns pointers to the given components for an entity.
+     * @tparam Component Types of components to get.
+     * @param entity A valid global identifier.
+     * @return Pointers to the components owned by the entity.
+     */
+    template<typename... Component>
+    [[nodiscard]] auto try_get(const entity_type entity) const {
+        return owner(entity).template try_get<Component...>(local(entity));
+    }
+
+    /*! @copydoc try_get */
+    template<typename... Component>
+    [[nodiscard]] auto try_get(const entity_type entity) {
+        return owner(entity).template try_get<Component...>(local(entity));
+    }
+
+    /**
+     * @brief Moves an entity and its components to another shard.
+     *
+     * Components are moved to the target shard by means of `move_to`, that is,
+     * their storage must already exist in the target shard. The storage for the
+     * given types is created if necessary. The entity is then destroyed in the
+     * source shard.
+     *
+     * @warning
+     * Migrations touch both the source and the target shard and therefore they
+     * must be synchronized by the caller.
+     *
+     * @tparam Component Types of components for which to create the storage.
+     * @param entity A valid global identifier.
+     * @param pos Index of the target shard.
+     * @return The new global identifier of the entity.
+     */
+    template<typename... Component>
+    entity_type migrate(const entity_type entity, const size_type pos) {
+        if(shard_of(entity) != pos) {
+            auto &target = shard(pos);
+            (static_cast<void>(target.template storage<Component>()), ...);
+
+            const auto prev = local(entity);
+            auto curr = entity_type{};
+            owner(entity).move_to(target, &prev, &prev + 1u, &curr);
+            return global(pos, curr);
+        }
+
+        return entity;
+    }
+
+private:
+    [[nodiscard]] registry_type &owner(const entity_type entity) {
+        return shard(shard_of(entity));
+    }
+
+    [[nodiscard]] const registry_type &owner(const entity_type entity) const {
+        return shard(shard_of(entity));
+    }
+
+private:
+    std::vector<registry_type> shards;
+    underlying_type shift;
+    underlying_type local_mask;
+};
+
+} // namespace entt
+
+#endif
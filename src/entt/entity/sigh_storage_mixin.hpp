@@ -1,6 +1,7 @@
 #ifndef ENTT_ENTITY_SIGH_STORAGE_MIXIN_HPP
 #define ENTT_ENTITY_SIGH_STORAGE_MIXIN_HPP
 
+#include <memory>
 #include <utility>
 #include "../config/config.h"
 #include "../core/any.hpp"
@@ -15,24 +16,54 @@ namespace entt {
  * The function type of a listener is equivalent to:
  *
  * @code{.cpp}
- * void(basic_registry<entity_type> &, entity_type);
+ * void(basic_registry<entity_type, allocator_type> &, entity_type);
  * @endcode
  *
- * This applies to all signals made available.
+ * This applies to all signals made available, except for the bulk ones. In
+ * this case, listeners receive a whole range of entities at once instead:
  *
+ * @code{.cpp}
+ * void(basic_registry<entity_type, allocator_type> &, const entity_type *, const entity_type *);
+ * @endcode
+ *
+ * Where `allocator_type` is the allocator type of the underlying sparse set.
+ *
+
  * @tparam Type The type of the underlying storage.
  */
 template<typename Type>
 class sigh_storage_mixin final: public Type {
+    using registry_type = basic_registry<typename Type::entity_type, typename Type::base_type::allocator_type>;
+    using listener_type = void(registry_type &, const typename Type::entity_type);
+    // the first listener of each signal doesn't require an allocation
+    using signal_type = sigh<listener_type, std::allocator<listener_type *>, 1u>;
+    using bulk_listener_type = void(registry_type &, const typename Type::entity_type *, const typename Type::entity_type *);
+    using bulk_signal_type = sigh<bulk_listener_type, std::allocator<bulk_listener_type *>, 1u>;
+
     template<typename Func>
     void notify_destruction(typename Type::basic_iterator first, typename Type::basic_iterator last, Func func) {
+        if(Type::silenced()) {
+            func(std::move(first), std::move(last));
+            return;
+        }
+
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
 
-        for(; first != last; ++first) {
-            const auto entt = *first;
-            destruction.publish(*owner, entt);
-            const auto it = Type::find(entt);
-            func(it, it + 1u);
+        if(!bulk_destruction.empty() && first != last) {
+            // packed arrays are iterated backwards, the range is contiguous in memory though
+            const auto *data = Type::data();
+            bulk_destruction.publish(*owner, data + (last.index() + 1), data + (first.index() + 1));
+        }
+
+        if(destruction.empty()) {
+            func(std::move(first), std::move(last));
+        } else {
+            for(; first != last; ++first) {
+                const auto entt = *first;
+                destruction.publish(*owner, entt);
+                const auto it = Type::find(entt);
+                func(it, it + 1u);
+            }
         }
     }
 
@@ -44,9 +75,27 @@ class sigh_storage_mixin final: public Type {
         notify_destruction(std::move(first), std::move(last), [this](auto... args) { Type::in_place_pop(args...); });
     }
 
-    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value) final {
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) final {
+        if(destruction.empty() && bulk_destruction.empty()) {
+            Type::pop_n(first, last);
+        } else {
+            // listeners are notified one entity at a time
+            Type::base_type::pop_n(first, last);
+        }
+    }
+
+    void pop_all() final {
+        if(destruction.empty() || Type::silenced()) {
+            notify_destruction(Type::base_type::begin(), Type::base_type::end(), [this](auto...) { Type::pop_all(); });
+        } else {
+            in_place_pop(Type::base_type::begin(), Type::base_type::end());
+        }
+    }
+
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) final {
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
-        Type::try_emplace(entt, force_back, value);
+        Type::try_emplace(entt, force_back, value, move);
+        bulk_construction.publish(*owner, &entt, &entt + 1u);
         construction.publish(*owner, entt);
         return Type::find(entt);
     }
@@ -105,6 +154,52 @@ public:
         return sink{destruction};
     }
 
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever one or more instances are created and assigned to entities.<br/>
+     * Ranges of entities are notified at once, single entities are notified
+     * as ranges of one element. Listeners are invoked after the objects have
+     * been assigned to the entities and before the listeners of the
+     * per-entity signal.
+     *
+     * @warning
+     * The range of entities must not be modified and is invalidated as soon as
+     * the storage changes.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_bulk_construct() ENTT_NOEXCEPT {
+        return sink{bulk_construction};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever one or more instances are removed from entities and thus
+     * destroyed.<br/>
+     * Ranges of entities that belong to the storage itself (for example, when
+     * a storage is cleared) are notified at once, all others are notified one
+     * entity at a time. Listeners are invoked before the objects have been
+     * removed from the entities and before the listeners of the per-entity
+     * signal.
+     *
+     * @warning
+     * Listeners must not modify the storage and the range of entities is
+     * invalidated as soon as the storage changes.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_bulk_destroy() ENTT_NOEXCEPT {
+        return sink{bulk_destruction};
+    }
+
     /**
      * @brief Assigns entities to a storage.
      * @tparam Args Types of arguments to use to construct the object.
@@ -116,6 +211,7 @@ public:
     decltype(auto) emplace(const entity_type entt, Args &&...args) {
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
         Type::emplace(entt, std::forward<Args>(args)...);
+        bulk_construction.publish(*owner, &entt, &entt + 1u);
         construction.publish(*owner, entt);
         return this->get(entt);
     }
@@ -148,8 +244,47 @@ public:
     template<typename It, typename... Args>
     void insert(It first, It last, Args &&...args) {
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
+        const auto from = Type::size();
         Type::insert(first, last, std::forward<Args>(args)...);
 
+        if(!bulk_construction.empty()) {
+            // entities are always appended to the packed array on insertion
+            bulk_construction.publish(*owner, Type::data() + from, Type::data() + Type::size());
+        }
+
+        for(auto it = construction.empty() ? last : first; it != last; ++it) {
+            construction.publish(*owner, *it);
+        }
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     *
+     * Signals are published on the calling thread, once all objects have been
+     * constructed.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), first, last, std::forward<Args>(args)...);
+
+        if(!bulk_construction.empty()) {
+            // entities are always appended to the packed array on insertion
+            bulk_construction.publish(*owner, Type::data() + from, Type::data() + Type::size());
+        }
+
         for(auto it = construction.empty() ? last : first; it != last; ++it) {
             construction.publish(*owner, *it);
         }
@@ -160,16 +295,18 @@ public:
      * @param value A variable wrapped in an opaque container.
      */
     void bind(any value) ENTT_NOEXCEPT final {
-        auto *reg = any_cast<basic_registry<entity_type>>(&value);
+        auto *reg = any_cast<registry_type>(&value);
         owner = reg ? reg : owner;
         Type::bind(std::move(value));
     }
 
 private:
-    sigh<void(basic_registry<entity_type> &, const entity_type)> construction{};
-    sigh<void(basic_registry<entity_type> &, const entity_type)> destruction{};
-    sigh<void(basic_registry<entity_type> &, const entity_type)> update{};
-    basic_registry<entity_type> *owner{};
+    signal_type construction{};
+    signal_type destruction{};
+    signal_type update{};
+    bulk_signal_type bulk_construction{};
+    bulk_signal_type bulk_destruction{};
+    registry_type *owner{};
 };
 
 } // namespace entt
@@ -0,0 +1,265 @@
+#ifndef ENTT_ENTITY_SIGNATURE_HPP
+#define ENTT_ENTITY_SIGNATURE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "storage.hpp"
+
+namespace entt {
+
+/**
+ * @brief Signature cache for the entities of a registry.
+ *
+ * A signature cache assigns a bit to each of the tracked components and keeps
+ * a compact bitset per entity, updated by means of the signals of the storage
+ * classes of a registry.<br/>
+ * Testing whether an entity has all the given components requires a single
+ * load and a mask compare rather than a sparse lookup per component. This
+ * makes it a good fit for iterations over many components, where most of the
+ * candidates are discarded.
+ *
+ * @warning
+ * Up to `sizeof(mask_type) * 8` components can be tracked by a single cache.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_signature_cache final {
+    using entity_traits = entt_traits<Entity>;
+    using registry_type = basic_registry<Entity>;
+
+    template<typename Component>
+    using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Component>>::storage_type, Component>;
+
+    struct slot {
+        std::uint64_t bit{};
+        void (*release)(basic_signature_cache &, registry_type &){};
+    };
+
+    template<typename Component>
+    static void set(basic_signature_cache &cache, registry_type &owner, const Entity entt) {
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+
+        if(!(pos < cache.signatures.size())) {
+            ENTT_ASSERT(!owner.frozen(), "Signatures cannot grow while the registry is frozen");
+            cache.signatures.resize(std::max(pos + 1u, owner.size()));
+        }
+
+        cache.signatures[pos] |= cache.bits[type_hash<std::remove_const_t<Component>>::value()].bit;
+    }
+
+    template<typename Component>
+    static void unset(basic_signature_cache &cache, registry_type &, const Entity entt) {
+        cache.signatures[static_cast<std::size_t>(entity_traits::to_entity(entt))] &= ~cache.bits[type_hash<std::remove_const_t<Component>>::value()].bit;
+    }
+
+    template<typename Component>
+    static void release(basic_signature_cache &cache, registry_type &reg) {
+        reg.template on_construct<Component>().disconnect(cache);
+        reg.template on_destroy<Component>().disconnect(cache);
+    }
+
+    template<typename Component>
+    void connect() {
+        if(auto &&elem = bits[type_hash<Component>::value()]; !elem.release) {
+            ENTT_ASSERT(bits.size() <= sizeof(std::uint64_t) * 8u, "Too many components");
+            elem.bit = std::uint64_t{1u} << (bits.size() - 1u);
+            elem.release = &basic_signature_cache::release<Component>;
+
+            const basic_sparse_set<Entity> &base = reg->template storage<Component>();
+
+            for(const auto entt: base) {
+                if(entt != tombstone) {
+                    set<Component>(*this, *reg, entt);
+                }
+            }
+
+            reg->template on_construct<Component>().template connect<&basic_signature_cache::set<Component>>(*this);
+            reg->template on_destroy<Component>().template connect<&basic_signature_cache::unset<Component>>(*this);
+        }
+    }
+
+    template<typename Component>
+    [[nodiscard]] std::uint64_t bit() const {
+        const auto it = bits.find(type_hash<std::remove_const_t<Component>>::value());
+        ENTT_ASSERT(it != bits.cend(), "Component not tracked");
+        return it->second.bit;
+    }
+
+    template<typename Func, typename... Storage>
+    void traverse(Func &func, const std::uint64_t signature, const basic_sparse_set<Entity> &candidates, Storage &...storage) const {
+        for(const auto entt: candidates) {
+            if(entt != tombstone && contains(entt, signature)) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), storage.get_as_tuple(entt)...));
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of the signatures, one bit per tracked component. */
+    using mask_type = std::uint64_t;
+
+    /**
+     * @brief Constructs a cache that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_signature_cache(registry_type &source) ENTT_NOEXCEPT
+        : signatures{},
+          bits{},
+          reg{&source} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_signature_cache(const basic_signature_cache &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_signature_cache(basic_signature_cache &&) = delete;
+
+    /*! @brief Stops tracking all components. */
+    ~basic_signature_cache() {
+        for(auto &&elem: bits) {
+            elem.second.release(*this, *reg);
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This signature cache.
+     */
+    basic_signature_cache &operator=(const basic_signature_cache &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This signature cache.
+     */
+    basic_signature_cache &operator=(basic_signature_cache &&) = delete;
+
+    /**
+     * @brief Starts tracking the given components.
+     *
+     * Entities that already own the given components are recorded as well.
+     *
+     * @tparam Component Types of components to track.
+     * @return A reference to this signature cache.
+     */
+    template<typename... Component>
+    basic_signature_cache &track() {
+        (connect<Component>(), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Makes room for the signatures of all the entities of a registry.
+     *
+     * Signatures are otherwise allocated by the listeners of the cache as
+     * components are assigned. Call this function before freezing a registry,
+     * so that signatures are only updated in place until it's unfrozen.
+     */
+    void reserve() {
+        if(const auto length = static_cast<size_type>(reg->size()); signatures.size() < length) {
+            signatures.resize(length);
+        }
+    }
+
+    /**
+     * @brief Checks if the given components are tracked.
+     * @tparam Component Types of components to check.
+     * @return True if all the components are tracked, false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool tracked() const {
+        return (bits.contains(type_hash<std::remove_const_t<Component>>::value()) && ...);
+    }
+
+    /**
+     * @brief Returns the mask for the given components.
+     * @tparam Component Types of components for which to return the mask.
+     * @return The mask for the given components.
+     */
+    template<typename... Component>
+    [[nodiscard]] mask_type mask() const {
+        return (mask_type{} | ... | bit<Component>());
+    }
+
+    /**
+     * @brief Returns the signature of an entity.
+     * @param entt A valid identifier.
+     * @return The signature of the given entity.
+     */
+    [[nodiscard]] mask_type signature(const entity_type entt) const ENTT_NOEXCEPT {
+        const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
+        return pos < signatures.size() ? signatures[pos] : mask_type{};
+    }
+
+    /**
+     * @brief Checks if an entity matches a given mask.
+     *
+     * @warning
+     * The version of the entity isn't checked.
+     *
+     * @param entt A valid identifier.
+     * @param signature A mask as returned by `mask`.
+     * @return True if the entity has all the components of the mask, false
+     * otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt, const mask_type signature) const ENTT_NOEXCEPT {
+        return (this->signature(entt) & signature) == signature;
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The shortest pool among the given components drives the iteration,
+     * while all the others are tested by means of the signatures.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &...);
+     * @endcode
+     *
+     * Where `Type` are the non-empty components among those given.
+     *
+     * @tparam Component Types of components to iterate.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Component, typename... Other, typename Func>
+    void each(Func func) const {
+        const auto signature = mask<Component, Other...>();
+        auto pools = std::forward_as_tuple(reg->template storage<Component>(), reg->template storage<Other>()...);
+
+        std::apply([this, &func, signature](auto &...storage) {
+            const basic_sparse_set<Entity> *candidates = &std::get<0>(std::forward_as_tuple(storage...));
+            ((candidates = storage.size() < candidates->size() ? &storage : candidates), ...);
+            traverse(func, signature, *candidates, storage...);
+        },
+                   pools);
+    }
+
+private:
+    std::vector<std::uint64_t> signatures;
+    dense_map<id_type, slot, identity> bits;
+    registry_type *reg;
+};
+
+} // namespace entt
+
+#endif
@@ -1,62 +1,1431 @@
 #ifndef ENTT_ENTITY_SNAPSHOT_HPP
 #define ENTT_ENTITY_SNAPSHOT_HPP
 
+#include <algorithm>
 #include <array>
+#include <climits>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
 #include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "registry.hpp"
+#include "sparse_set.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename, typename = void>
+struct has_bulk_write: std::false_type {};
+
+template<typename Archive>
+struct has_bulk_write<Archive, std::void_t<decltype(std::declval<Archive &>().write(std::declval<const void *>(), std::size_t{}))>>
+    : std::true_type {};
+
+template<typename, typename = void>
+struct has_bulk_read: std::false_type {};
+
+template<typename Archive>
+struct has_bulk_read<Archive, std::void_t<decltype(std::declval<Archive &>().read(std::declval<void *>(), std::size_t{}))>>
+    : std::true_type {};
+
+template<typename, typename = void>
+struct has_section: std::false_type {};
+
+template<typename Archive>
+struct has_section<Archive, std::void_t<decltype(std::declval<Archive &>().section(std::declval<const type_info &>()))>>
+    : std::true_type {};
+
+template<typename, typename, typename = void>
+struct has_entity_write: std::false_type {};
+
+template<typename Archive, typename Entity>
+struct has_entity_write<Archive, Entity, std::void_t<decltype(std::declval<Archive &>().write_entities(std::declval<const Entity *>(), std::size_t{}))>>
+    : std::true_type {};
+
+template<typename, typename, typename = void>
+struct has_entity_read: std::false_type {};
+
+template<typename Archive, typename Entity>
+struct has_entity_read<Archive, Entity, std::void_t<decltype(std::declval<Archive &>().read_entities(std::declval<Entity *>(), std::size_t{}))>>
+    : std::true_type {};
+
+template<typename Archive>
+void open_section([[maybe_unused]] Archive &archive, [[maybe_unused]] const type_info &info) {
+    if constexpr(has_section<Archive>::value) {
+        archive.section(info);
+    }
+}
+
+template<typename Archive, typename Entity>
+void write_entities(Archive &archive, const Entity *first, const std::size_t count) {
+    if constexpr(has_entity_write<Archive, Entity>::value) {
+        archive.write_entities(first, count);
+    } else {
+        archive.write(first, count * sizeof(Entity));
+    }
+}
+
+template<typename Archive, typename Entity>
+void read_entities(Archive &archive, Entity *first, const std::size_t count) {
+    if constexpr(has_entity_read<Archive, Entity>::value) {
+        archive.read_entities(first, count);
+    } else {
+        archive.read(first, count * sizeof(Entity));
+    }
+}
+
+// entities sections open with a marker that no length can match, followed by the version of their layout
+inline constexpr std::uint32_t entities_layout = 1u;
+
+template<typename Traits>
+inline constexpr auto entities_marker = (std::numeric_limits<typename Traits::entity_type>::max)();
+
+template<typename Traits, typename Archive>
+void write_entities_header(Archive &archive, const std::size_t length, const std::size_t count) {
+    archive(typename Traits::entity_type{entities_marker<Traits>});
+    archive(typename Traits::entity_type{entities_layout});
+    archive(static_cast<typename Traits::entity_type>(length));
+    archive(static_cast<typename Traits::entity_type>(count));
+}
+
+// returns true for the unversioned layout, where the length counts the head of the free list that follows it
+template<typename Traits, typename Archive>
+[[nodiscard]] bool read_entities_header(Archive &archive, typename Traits::entity_type &length, typename Traits::entity_type &count) {
+    typename Traits::entity_type word{};
+    archive(word);
+
+    if(word == entities_marker<Traits>) {
+        archive(word);
+        ENTT_ASSERT(word == entities_layout, "Unsupported layout");
+        archive(length);
+        archive(count);
+        return false;
+    }
+
+    typename Traits::value_type head{};
+    archive(head);
+    length = word - 1u;
+    count = {};
+    return true;
+}
+
+// moves the entities in use to the front of an unversioned range and returns how many they are
+template<typename Traits>
+[[nodiscard]] std::size_t from_unversioned_layout(std::vector<typename Traits::value_type> &all) {
+    std::vector<typename Traits::value_type> released{};
+    std::size_t count{};
+
+    for(std::size_t pos{}; pos < all.size(); ++pos) {
+        // released slots store the next element of the free list rather than their own identifier
+        if(const auto entt = all[pos]; Traits::to_entity(entt) == pos) {
+            all[count++] = entt;
+        } else {
+            released.push_back(Traits::construct(static_cast<typename Traits::entity_type>(pos), Traits::to_version(entt)));
+        }
+    }
+
+    std::copy(released.cbegin(), released.cend(), all.begin() + count);
+    return count;
+}
+
+template<typename Entity>
+void encode_entities(std::vector<std::byte> &buffer, const Entity *first, const std::size_t count) {
+    using entity_type = typename entt::entt_traits<Entity>::entity_type;
+    using signed_type = std::make_signed_t<entity_type>;
+    entity_type prev{};
+
+    for(const auto last = first + count; first != last; ++first) {
+        const auto curr = entt::entt_traits<Entity>::to_integral(*first);
+        const auto delta = static_cast<signed_type>(curr - prev);
+        // zig-zag encoding, small negative differences take a few bits as well
+        auto value = static_cast<std::uint64_t>(static_cast<entity_type>((static_cast<entity_type>(delta) << 1u) ^ static_cast<entity_type>(delta >> (sizeof(entity_type) * CHAR_BIT - 1u))));
+
+        for(; value >= 0x80u; value >>= 7u) {
+            buffer.push_back(static_cast<std::byte>((value & 0x7Fu) | 0x80u));
+        }
+
+        buffer.push_back(static_cast<std::byte>(value));
+        prev = curr;
+    }
+}
+
+template<typename Entity>
+[[nodiscard]] std::size_t decode_entities(const std::byte *data, const std::size_t length, Entity *first, const std::size_t count) {
+    using entity_type = typename entt::entt_traits<Entity>::entity_type;
+    entity_type prev{};
+    std::size_t offset{};
+
+    for(const auto last = first + count; first != last; ++first) {
+        std::uint64_t value{};
+
+        for(std::size_t shift{};; shift += 7u) {
+            ENTT_ASSERT(offset < length, "Not enough data");
+            const auto byte = std::to_integer<std::uint64_t>(data[offset++]);
+            value |= (byte & 0x7Fu) << shift;
+
+            if(!(byte & 0x80u)) {
+                break;
+            }
+        }
+
+        prev += static_cast<entity_type>((value >> 1u) ^ (~(value & 1u) + 1u));
+        *first = Entity{prev};
+    }
+
+    return offset;
+}
+
+class delta_output_archive {
+public:
+    delta_output_archive(std::vector<std::byte> &ref) ENTT_NOEXCEPT
+        : buffer{&ref} {}
+
+    template<typename... Type>
+    void operator()(const Type &...value) {
+        (write(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    void write(const void *data, const std::size_t length) {
+        const auto *first = static_cast<const std::byte *>(data);
+        buffer->insert(buffer->end(), first, first + length);
+    }
+
+    template<typename Entity>
+    void write_entities(const Entity *first, const std::size_t count) {
+        encode_entities(*buffer, first, count);
+    }
+
+private:
+    std::vector<std::byte> *buffer;
+};
+
+template<typename Entity>
+void release_orphans(basic_registry<Entity> &reg) {
+    // owners are marked while walking the packed arrays, no lookups are required
+    std::vector<bool> owned(reg.size());
+
+    for(auto &&curr: reg.storage()) {
+        for(const auto entt: curr.second) {
+            if(entt != tombstone) {
+                owned[static_cast<std::size_t>(entt::entt_traits<Entity>::to_entity(entt))] = true;
+            }
+        }
+    }
+
+    reg.each([&reg, &owned](const auto entt) {
+        if(!owned[static_cast<std::size_t>(entt::entt_traits<Entity>::to_entity(entt))]) {
+            reg.release(entt);
+        }
+    });
+}
+
+template<typename Type>
+inline constexpr bool bulk_copyable_v = ignore_as_empty_v<Type> || (std::is_trivially_copyable_v<Type> && !component_traits<Type>::in_place_delete && !soa_layout_v<Type>);
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Binary output archive for trivially copyable types.
+ *
+ * Values are appended to a buffer of bytes as they are in memory, without any
+ * kind of conversion. Because of this, snapshots created with this archive are
+ * only meant to be restored on the same platform.<br/>
+ * Snapshots and loaders recognize binary archives and serialize entities and
+ * trivially copyable components one page at a time rather than one by one.
+ * Therefore, objects of this type must be paired with a `binary_input_archive`.
+ */
+class binary_output_archive {
+public:
+    /**
+     * @brief Constructs an archive that writes to a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     */
+    binary_output_archive(std::vector<std::byte> &ref) ENTT_NOEXCEPT
+        : buffer{&ref} {}
+
+    /**
+     * @brief Writes a set of values to the underlying buffer.
+     * @tparam Type Types of values to write.
+     * @param value Values to write.
+     */
+    template<typename... Type>
+    void operator()(const Type &...value) {
+        static_assert((std::is_trivially_copyable_v<Type> && ...), "Types must be trivially copyable");
+        (write(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    /**
+     * @brief Writes a block of bytes to the underlying buffer.
+     * @param data A pointer to the block of bytes to write.
+     * @param length The size of the block of bytes in bytes.
+     */
+    void write(const void *data, const std::size_t length) {
+        const auto *first = static_cast<const std::byte *>(data);
+        buffer->insert(buffer->end(), first, first + length);
+    }
+
+private:
+    std::vector<std::byte> *buffer;
+};
+
+/**
+ * @brief Binary input archive for trivially copyable types.
+ *
+ * Values are read from a range of bytes that isn't owned by the archive, such
+ * as a memory mapped file or the buffer of a `binary_output_archive`.
+ */
+class binary_input_archive {
+public:
+    /**
+     * @brief Constructs an archive that reads from a given range of bytes.
+     * @param data A pointer to the first byte of the range.
+     * @param length The size of the range in bytes.
+     */
+    binary_input_archive(const std::byte *data, const std::size_t length) ENTT_NOEXCEPT
+        : first{data},
+          last{data + length} {}
+
+    /**
+     * @brief Constructs an archive that reads from a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     */
+    binary_input_archive(const std::vector<std::byte> &ref) ENTT_NOEXCEPT
+        : binary_input_archive{ref.data(), ref.size()} {}
+
+    /**
+     * @brief Reads a set of values from the underlying range of bytes.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &...value) {
+        static_assert((std::is_trivially_copyable_v<Type> && ...), "Types must be trivially copyable");
+        (read(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    /**
+     * @brief Reads a block of bytes from the underlying range of bytes.
+     * @param data A pointer to the block of bytes to fill.
+     * @param length The size of the block of bytes in bytes.
+     */
+    void read(void *data, const std::size_t length) {
+        ENTT_ASSERT(length <= size(), "Not enough data");
+        std::memcpy(data, first, length);
+        first += length;
+    }
+
+    /**
+     * @brief Returns the number of bytes still to read.
+     * @return The number of bytes still to read.
+     */
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(last - first);
+    }
+
+private:
+    const std::byte *first;
+    const std::byte *last;
+};
+
+/*! @brief Codec that leaves sections as they are. */
+struct identity_codec {
+    /**
+     * @brief Appends the encoded version of a section to a buffer.
+     * @param data A pointer to the first byte of the section.
+     * @param length The size of the section in bytes.
+     * @param out The buffer to which to append the encoded section.
+     */
+    void compress(const type_info &, const std::byte *data, const std::size_t length, std::vector<std::byte> &out) const {
+        out.insert(out.end(), data, data + length);
+    }
+
+    /**
+     * @brief Appends the decoded version of a section to a buffer.
+     * @param data A pointer to the first byte of the encoded section.
+     * @param length The size of the encoded section in bytes.
+     * @param out The buffer to which to append the decoded section.
+     */
+    void decompress(const type_info &, const std::byte *data, const std::size_t length, std::vector<std::byte> &out) const {
+        out.insert(out.end(), data, data + length);
+    }
+};
+
+/**
+ * @brief Block-oriented output archive that encodes a snapshot one section at
+ * a time.
+ *
+ * Snapshots open a section for the entities and one for each pool. Sections
+ * are passed to the codec along with the type they refer to, so that each pool
+ * can be compressed with a different algorithm if needed. A codec offers the
+ * following member functions:
+ *
+ * @code{.cpp}
+ * void compress(const entt::type_info &type, const std::byte *data, std::size_t length, std::vector<std::byte> &out);
+ * void decompress(const entt::type_info &type, const std::byte *data, std::size_t length, std::vector<std::byte> &out);
+ * @endcode
+ *
+ * Arrays of entities are also delta encoded before they reach the codec, so
+ * that sorted identifiers take little more than a byte each.<br/>
+ * The last section is only written when `flush` is invoked. Objects of this
+ * type must be paired with a `codec_input_archive` that uses the same codec.
+ *
+ * @tparam Codec Type of codec to use.
+ */
+template<typename Codec = identity_codec>
+class codec_output_archive {
+public:
+    /**
+     * @brief Constructs an archive that writes to a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     * @param func The codec to use.
+     */
+    codec_output_archive(std::vector<std::byte> &ref, Codec func = {})
+        : buffer{&ref},
+          codec{std::move(func)},
+          staging{},
+          encoded{},
+          current{} {}
+
+    /**
+     * @brief Opens a new section and writes the previous one, if any.
+     * @param info The type to which the section refers.
+     */
+    void section(const type_info &info) {
+        flush();
+        current = &info;
+    }
+
+    /*! @brief Writes the current section, if any, to the underlying buffer. */
+    void flush() {
+        if(current) {
+            const auto id = current->hash();
+            encoded.clear();
+            codec.compress(*current, staging.data(), staging.size(), encoded);
+
+            const auto length = static_cast<std::uint64_t>(encoded.size());
+            const auto *header = reinterpret_cast<const std::byte *>(&id);
+            buffer->insert(buffer->end(), header, header + sizeof(id));
+            header = reinterpret_cast<const std::byte *>(&length);
+            buffer->insert(buffer->end(), header, header + sizeof(length));
+            buffer->insert(buffer->end(), encoded.cbegin(), encoded.cend());
+
+            staging.clear();
+            current = nullptr;
+        }
+    }
+
+    /**
+     * @brief Writes a set of values to the current section.
+     * @tparam Type Types of values to write.
+     * @param value Values to write.
+     */
+    template<typename... Type>
+    void operator()(const Type &...value) {
+        static_assert((std::is_trivially_copyable_v<Type> && ...), "Types must be trivially copyable");
+        (write(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    /**
+     * @brief Writes a block of bytes to the current section.
+     * @param data A pointer to the block of bytes to write.
+     * @param length The size of the block of bytes in bytes.
+     */
+    void write(const void *data, const std::size_t length) {
+        ENTT_ASSERT(current, "No open section");
+        const auto *first = static_cast<const std::byte *>(data);
+        staging.insert(staging.end(), first, first + length);
+    }
+
+    /**
+     * @brief Delta encodes and writes an array of entities to the current
+     * section.
+     * @tparam Entity A valid entity type (see entt_traits for more details).
+     * @param first A pointer to the first entity to write.
+     * @param count The number of entities to write.
+     */
+    template<typename Entity>
+    void write_entities(const Entity *first, const std::size_t count) {
+        ENTT_ASSERT(current, "No open section");
+        internal::encode_entities(staging, first, count);
+    }
+
+private:
+    std::vector<std::byte> *buffer;
+    Codec codec;
+    std::vector<std::byte> staging;
+    std::vector<std::byte> encoded;
+    const type_info *current;
+};
+
+/**
+ * @brief Block-oriented input archive for snapshots encoded by a
+ * `codec_output_archive`.
+ *
+ * Values are read from a range of bytes that isn't owned by the archive. Each
+ * section is decoded as a whole when it's opened by a loader.
+ *
+ * @tparam Codec Type of codec to use.
+ */
+template<typename Codec = identity_codec>
+class codec_input_archive {
+public:
+    /**
+     * @brief Constructs an archive that reads from a given range of bytes.
+     * @param data A pointer to the first byte of the range.
+     * @param length The size of the range in bytes.
+     * @param func The codec to use.
+     */
+    codec_input_archive(const std::byte *data, const std::size_t length, Codec func = {})
+        : first{data},
+          last{data + length},
+          codec{std::move(func)},
+          staging{},
+          offset{} {}
+
+    /**
+     * @brief Constructs an archive that reads from a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     * @param func The codec to use.
+     */
+    codec_input_archive(const std::vector<std::byte> &ref, Codec func = {})
+        : codec_input_archive{ref.data(), ref.size(), std::move(func)} {}
+
+    /**
+     * @brief Decodes the next section.
+     * @param info The type to which the section is expected to refer.
+     */
+    void section(const type_info &info) {
+        id_type id{};
+        std::uint64_t length{};
+
+        ENTT_ASSERT(sizeof(id) + sizeof(length) <= size(), "Not enough data");
+        std::memcpy(&id, first, sizeof(id));
+        std::memcpy(&length, first + sizeof(id), sizeof(length));
+        first += sizeof(id) + sizeof(length);
+
+        ENTT_ASSERT(id == info.hash(), "Unexpected section");
+        ENTT_ASSERT(length <= size(), "Not enough data");
+
+        staging.clear();
+        offset = 0u;
+        codec.decompress(info, first, static_cast<std::size_t>(length), staging);
+        first += length;
+    }
+
+    /**
+     * @brief Reads a set of values from the current section.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &...value) {
+        static_assert((std::is_trivially_copyable_v<Type> && ...), "Types must be trivially copyable");
+        (read(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    /**
+     * @brief Reads a block of bytes from the current section.
+     * @param data A pointer to the block of bytes to fill.
+     * @param length The size of the block of bytes in bytes.
+     */
+    void read(void *data, const std::size_t length) {
+        ENTT_ASSERT(length <= staging.size() - offset, "Not enough data");
+        std::memcpy(data, staging.data() + offset, length);
+        offset += length;
+    }
+
+    /**
+     * @brief Reads and decodes an array of entities from the current section.
+     * @tparam Entity A valid entity type (see entt_traits for more details).
+     * @param data A pointer to the first entity to fill.
+     * @param count The number of entities to read.
+     */
+    template<typename Entity>
+    void read_entities(Entity *data, const std::size_t count) {
+        offset += internal::decode_entities(staging.data() + offset, staging.size() - offset, data, count);
+    }
+
+    /**
+     * @brief Returns the number of bytes of sections still to decode.
+     * @return The number of bytes of sections still to decode.
+     */
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(last - first);
+    }
+
+private:
+    const std::byte *first;
+    const std::byte *last;
+    Codec codec;
+    std::vector<std::byte> staging;
+    std::size_t offset;
+};
+
+/**
+ * @brief Input archive that streams a range of bytes one chunk at a time.
+ *
+ * Bytes are pulled from a source in chunks of a fixed size rather than being
+ * read all at once. The source is a function object that fills a buffer and
+ * returns the number of bytes written, zero once exhausted:
+ *
+ * @code{.cpp}
+ * std::size_t(std::byte *data, std::size_t length);
+ * @endcode
+ *
+ * When pipelined, the next chunk is requested to the source on another thread
+ * while the current one is consumed, so that reading and decompressing data
+ * overlap with the restoration of a registry. The source is never invoked
+ * concurrently with itself.<br/>
+ * The archive is compatible with the output of a `binary_output_archive`.
+ *
+ * @tparam Source Type of source of bytes.
+ */
+template<typename Source>
+class stream_input_archive {
+    void request() {
+        pending = std::async(std::launch::async, [this, data = back.data(), size = back.size()]() { return source(data, size); });
+    }
+
+    void next() {
+        if(pipelined) {
+            length = pending.valid() ? pending.get() : 0u;
+            std::swap(front, back);
+
+            if(length) {
+                request();
+            }
+        } else {
+            length = source(front.data(), front.size());
+        }
+
+        offset = 0u;
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that streams bytes from a given source.
+     * @param func A valid source of bytes.
+     * @param chunk Size of the chunks to request to the source, in bytes.
+     * @param pipeline Whether to request the next chunk in advance on another
+     * thread.
+     */
+    stream_input_archive(Source func, const std::size_t chunk = 65536u, const bool pipeline = false)
+        : source{std::move(func)},
+          front(chunk),
+          back(pipeline ? chunk : 0u),
+          pending{},
+          offset{},
+          length{},
+          pipelined{pipeline} {
+        ENTT_ASSERT(chunk != 0u, "Invalid chunk size");
+
+        if(pipelined) {
+            request();
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    stream_input_archive(const stream_input_archive &) = delete;
+
+    /*! @brief Waits for the pending request to the source, if any. */
+    ~stream_input_archive() {
+        if(pending.valid()) {
+            pending.wait();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This archive.
+     */
+    stream_input_archive &operator=(const stream_input_archive &) = delete;
+
+    /**
+     * @brief Reads a set of values from the underlying source.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &...value) {
+        static_assert((std::is_trivially_copyable_v<Type> && ...), "Types must be trivially copyable");
+        (read(std::addressof(value), sizeof(Type)), ...);
+    }
+
+    /**
+     * @brief Reads a block of bytes from the underlying source.
+     * @param data A pointer to the block of bytes to fill.
+     * @param count The size of the block of bytes in bytes.
+     */
+    void read(void *data, std::size_t count) {
+        auto *first = static_cast<std::byte *>(data);
+
+        while(count) {
+            if(offset == length) {
+                next();
+                ENTT_ASSERT(length != 0u, "Not enough data");
+            }
+
+            const auto chunk = (std::min)(count, length - offset);
+            std::memcpy(first, front.data() + offset, chunk);
+            offset += chunk;
+            first += chunk;
+            count -= chunk;
+        }
+    }
+
+private:
+    Source source;
+    std::vector<std::byte> front;
+    std::vector<std::byte> back;
+    std::future<std::size_t> pending;
+    std::size_t offset;
+    std::size_t length;
+    bool pipelined;
+};
+
+/**
+ * @brief Linear quantization of floating point values.
+ *
+ * Values within a range are mapped to integers with a given precision, so that
+ * they can be written to a bit archive with as few bits as required. Values
+ * out of range are clamped.
+ */
+class quantizer {
+public:
+    /**
+     * @brief Constructs a quantizer for a given range and precision.
+     * @param lower Lower bound of the range of values.
+     * @param upper Upper bound of the range of values.
+     * @param precision Maximum difference between two consecutive values.
+     */
+    constexpr quantizer(const double lower, const double upper, const double precision) ENTT_NOEXCEPT
+        : min{lower},
+          max{upper},
+          step{precision},
+          length{} {
+        for(auto steps = static_cast<std::uint64_t>((upper - lower) / precision + .5); steps; steps >>= 1u) {
+            ++length;
+        }
+    }
+
+    /**
+     * @brief Returns the number of bits required by a quantized value.
+     * @return The number of bits required by a quantized value.
+     */
+    [[nodiscard]] constexpr std::size_t bits() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+    /**
+     * @brief Quantizes a value.
+     * @param value A value to quantize.
+     * @return The quantized value.
+     */
+    [[nodiscard]] constexpr std::uint64_t encode(const double value) const ENTT_NOEXCEPT {
+        const auto clamped = value < min ? min : (value > max ? max : value);
+        return static_cast<std::uint64_t>((clamped - min) / step + .5);
+    }
+
+    /**
+     * @brief Restores a quantized value.
+     * @param value A quantized value.
+     * @return The value restored, within the range of the quantizer.
+     */
+    [[nodiscard]] constexpr double decode(const std::uint64_t value) const ENTT_NOEXCEPT {
+        const auto restored = min + static_cast<double>(value) * step;
+        return restored > max ? max : restored;
+    }
+
+private:
+    double min;
+    double max;
+    double step;
+    std::size_t length;
+};
+
+/**
+ * @brief Describes how bit archives write and read values of a given type.
+ *
+ * Booleans take a bit, integral and enum types take all their bits and any
+ * other trivially copyable type is written byte by byte.<br/>
+ * Specializations are meant to pack and quantize values, for example by means
+ * of a `quantizer` for floating point data members.
+ *
+ * @tparam Type Type of values to write and read.
+ */
+template<typename Type, typename = void>
+struct replication_traits {
+    static_assert(std::is_trivially_copyable_v<Type>, "Types must be trivially copyable");
+
+    /**
+     * @brief Writes a value to a bit archive.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @param value The value to write.
+     */
+    template<typename Archive>
+    static void write(Archive &archive, const Type &value) {
+        if constexpr(std::is_same_v<Type, bool>) {
+            archive.write_bits(value, 1u);
+        } else if constexpr(std::is_enum_v<Type>) {
+            replication_traits<std::underlying_type_t<Type>>::write(archive, static_cast<std::underlying_type_t<Type>>(value));
+        } else if constexpr(std::is_integral_v<Type>) {
+            archive.write_bits(static_cast<std::make_unsigned_t<Type>>(value), sizeof(Type) * CHAR_BIT);
+        } else {
+            unsigned char bytes[sizeof(Type)];
+            std::memcpy(bytes, std::addressof(value), sizeof(Type));
+
+            for(const auto byte: bytes) {
+                archive.write_bits(byte, CHAR_BIT);
+            }
+        }
+    }
+
+    /**
+     * @brief Reads a value from a bit archive.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @param value The value to fill.
+     */
+    template<typename Archive>
+    static void read(Archive &archive, Type &value) {
+        if constexpr(std::is_same_v<Type, bool>) {
+            value = (archive.read_bits(1u) != 0u);
+        } else if constexpr(std::is_enum_v<Type>) {
+            std::underlying_type_t<Type> underlying{};
+            replication_traits<std::underlying_type_t<Type>>::read(archive, underlying);
+            value = static_cast<Type>(underlying);
+        } else if constexpr(std::is_integral_v<Type>) {
+            value = static_cast<Type>(static_cast<std::make_unsigned_t<Type>>(archive.read_bits(sizeof(Type) * CHAR_BIT)));
+        } else {
+            unsigned char bytes[sizeof(Type)];
+
+            for(auto &byte: bytes) {
+                byte = static_cast<unsigned char>(archive.read_bits(CHAR_BIT));
+            }
+
+            std::memcpy(std::addressof(value), bytes, sizeof(Type));
+        }
+    }
+};
+
+/**
+ * @brief Output archive that packs values as tightly as bits go.
+ *
+ * Values aren't aligned to bytes, each one takes exactly the number of bits
+ * its replication traits write. It's meant for network replication, where
+ * bandwidth matters more than the cost of encoding.<br/>
+ * The archive appends to a buffer of bytes and never allocates otherwise.
+ * Objects of this type must be paired with a `bit_input_archive`.
+ *
+ * @sa replication_traits
+ */
+class bit_output_archive {
+public:
+    /**
+     * @brief Constructs an archive that writes to a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     */
+    bit_output_archive(std::vector<std::byte> &ref) ENTT_NOEXCEPT
+        : buffer{&ref},
+          used{} {}
+
+    /**
+     * @brief Writes a set of values to the underlying buffer.
+     * @tparam Type Types of values to write.
+     * @param value Values to write.
+     */
+    template<typename... Type>
+    void operator()(const Type &...value) {
+        (replication_traits<Type>::write(*this, value), ...);
+    }
+
+    /**
+     * @brief Writes the lowest bits of a value to the underlying buffer.
+     * @param value The value to write.
+     * @param count Number of bits to write, at most 64.
+     */
+    void write_bits(std::uint64_t value, std::size_t count) {
+        ENTT_ASSERT(count <= 64u, "Too many bits");
+
+        while(count) {
+            const auto offset = used % CHAR_BIT;
+            const auto chunk = (std::min)(count, static_cast<std::size_t>(CHAR_BIT) - offset);
+
+            if(!offset) {
+                buffer->push_back(std::byte{});
+            }
+
+            buffer->back() |= static_cast<std::byte>((value & ((1u << chunk) - 1u)) << offset);
+            value >>= chunk;
+            count -= chunk;
+            used += chunk;
+        }
+    }
+
+    /**
+     * @brief Quantizes and writes a value to the underlying buffer.
+     * @param value The value to write.
+     * @param range The quantizer to use.
+     */
+    void quantize(const double value, const quantizer &range) {
+        write_bits(range.encode(value), range.bits());
+    }
+
+    /**
+     * @brief Returns the number of bits written so far.
+     * @return The number of bits written so far.
+     */
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return used;
+    }
+
+private:
+    std::vector<std::byte> *buffer;
+    std::size_t used;
+};
+
+/**
+ * @brief Input archive for values packed by a `bit_output_archive`.
+ *
+ * Values are read from a range of bytes that isn't owned by the archive.
+ *
+ * @sa replication_traits
+ */
+class bit_input_archive {
+public:
+    /**
+     * @brief Constructs an archive that reads from a given range of bytes.
+     * @param data A pointer to the first byte of the range.
+     * @param length The size of the range in bytes.
+     */
+    bit_input_archive(const std::byte *data, const std::size_t length) ENTT_NOEXCEPT
+        : first{data},
+          used{},
+          available{length * CHAR_BIT} {}
+
+    /**
+     * @brief Constructs an archive that reads from a given buffer.
+     * @param ref A valid reference to a buffer of bytes.
+     */
+    bit_input_archive(const std::vector<std::byte> &ref) ENTT_NOEXCEPT
+        : bit_input_archive{ref.data(), ref.size()} {}
+
+    /**
+     * @brief Reads a set of values from the underlying range of bytes.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &...value) {
+        (replication_traits<Type>::read(*this, value), ...);
+    }
+
+    /**
+     * @brief Reads a value from the underlying range of bytes.
+     * @param count Number of bits to read, at most 64.
+     * @return The value read.
+     */
+    [[nodiscard]] std::uint64_t read_bits(const std::size_t count) {
+        ENTT_ASSERT(count <= 64u && count <= size(), "Not enough data");
+        std::uint64_t value{};
+
+        for(std::size_t done{}; done < count;) {
+            const auto offset = used % CHAR_BIT;
+            const auto chunk = (std::min)(count - done, static_cast<std::size_t>(CHAR_BIT) - offset);
+            const auto bits = (std::to_integer<std::uint64_t>(first[used / CHAR_BIT]) >> offset) & ((1u << chunk) - 1u);
+            value |= bits << done;
+            done += chunk;
+            used += chunk;
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Reads and restores a quantized value.
+     * @param range The quantizer used to write the value.
+     * @return The value restored.
+     */
+    [[nodiscard]] double dequantize(const quantizer &range) {
+        return range.decode(read_bits(range.bits()));
+    }
+
+    /**
+     * @brief Returns the number of bits still to read.
+     * @return The number of bits still to read.
+     */
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return available - used;
+    }
+
+private:
+    const std::byte *first;
+    std::size_t used;
+    std::size_t available;
+};
+
 /**
  * @brief Utility class to create snapshots from a registry.
  *
- * A _snapshot_ can be either a dump of the entire registry or a narrower
- * selection of components of interest.<br/>
- * This type can be used in both cases if provided with a correctly configured
- * output archive.
+ * A _snapshot_ can be either a dump of the entire registry or a narrower
+ * selection of components of interest.<br/>
+ * This type can be used in both cases if provided with a correctly configured
+ * output archive.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_snapshot {
+    using entity_traits = entt_traits<Entity>;
+
+    template<typename Component, typename Archive, typename It>
+    void get(Archive &archive, std::size_t sz, It first, It last) const {
+        auto view = reg->template view<std::add_const_t<Component>>();
+        // disabled entities are part of the snapshot as well
+        view.mask(nullptr);
+        internal::open_section(archive, type_id<Component>());
+        archive(typename entity_traits::entity_type(sz));
+
+        if constexpr(internal::has_bulk_write<Archive>::value && internal::bulk_copyable_v<Component>) {
+            // binary archives expect all entities first and then all components
+            for(auto it = first; it != last; ++it) {
+                if(view.contains(*it)) {
+                    archive(*it);
+                }
+            }
+
+            if constexpr(!ignore_as_empty_v<Component>) {
+                for(; first != last; ++first) {
+                    if(view.contains(*first)) {
+                        std::apply(archive, view.get(*first));
+                    }
+                }
+            }
+        } else {
+            while(first != last) {
+                const auto entt = *(first++);
+
+                if(view.contains(entt)) {
+                    std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+                }
+            }
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void dump(Archive &archive) const {
+        auto view = reg->template view<const Component>();
+        // disabled entities are part of the snapshot as well
+        view.mask(nullptr);
+
+        if constexpr(internal::has_bulk_write<Archive>::value && internal::bulk_copyable_v<Component>) {
+            const auto &cpool = view.storage();
+            const auto length = cpool.size();
+
+            internal::open_section(archive, type_id<Component>());
+            archive(typename entity_traits::entity_type(length));
+            internal::write_entities(archive, cpool.data(), length);
+
+            if constexpr(!ignore_as_empty_v<Component>) {
+                constexpr auto page = component_traits<Component>::page_size;
+
+                for(std::size_t pos{}; pos < length; pos += page) {
+                    archive.write(cpool.raw()[pos / page], (std::min)(page, length - pos) * sizeof(Component));
+                }
+            }
+        } else if constexpr(!component_traits<Component>::in_place_delete) {
+            // no tombstones, the size of the view is exact
+            internal::open_section(archive, type_id<Component>());
+            archive(typename entity_traits::entity_type(view.size()));
+
+            for(auto first = view.rbegin(), last = view.rend(); first != last; ++first) {
+                std::apply(archive, std::tuple_cat(std::make_tuple(*first), view.get(*first)));
+            }
+        } else {
+            // tombstones are skipped while walking the packed array, no lookups are required
+            const auto &cpool = reg->template storage<Component>();
+            const auto length = std::count_if(cpool.data(), cpool.data() + cpool.size(), [](const auto entt) { return entt != tombstone; });
+
+            internal::open_section(archive, type_id<Component>());
+            archive(typename entity_traits::entity_type(length));
+
+            for(auto elem: cpool.each()) {
+                if(std::get<0>(elem) != tombstone) {
+                    std::apply(archive, elem);
+                }
+            }
+        }
+    }
+
+    template<typename... Component, typename Archive, typename It, std::size_t... Index>
+    void component(Archive &archive, It first, It last, std::index_sequence<Index...>) const {
+        const auto cpools = std::forward_as_tuple(reg->template storage<Component>()...);
+        std::array<std::size_t, sizeof...(Index)> size{};
+
+        if constexpr(std::is_convertible_v<It, const Entity *>) {
+            // membership is resolved in batches, one pool at a time
+            std::array<bool, 256u> found{};
+
+            for(const Entity *data = first, *end = last; data != end;) {
+                const auto count = (std::min)(static_cast<std::size_t>(end - data), found.size());
+                ((size[Index] += std::get<Index>(cpools).contains_n(data, count, found.data())), ...);
+                data += count;
+            }
+        } else {
+            auto begin = first;
+
+            while(begin != last) {
+                const auto entt = *(begin++);
+                ((std::get<Index>(cpools).contains(entt) ? ++size[Index] : 0u), ...);
+            }
+        }
+
+        (get<Component>(archive, size[Index], first, last), ...);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_snapshot(const basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : reg{&source} {}
+
+    /*! @brief Default move constructor. */
+    basic_snapshot(basic_snapshot &&) ENTT_NOEXCEPT = default;
+
+    /*! @brief Default move assignment operator. @return This snapshot. */
+    basic_snapshot &operator=(basic_snapshot &&) ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Puts aside all the entities from the underlying registry.
+     *
+     * Entities are serialized along with their versions. Destroyed entities are
+     * taken in consideration as well by this function.
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Archive>
+    const basic_snapshot &entities(Archive &archive) const {
+        const auto sz = reg->size();
+
+        internal::open_section(archive, type_id<entity_type>());
+        internal::write_entities_header<entity_traits>(archive, sz, reg->alive());
+
+        if constexpr(internal::has_bulk_write<Archive>::value && std::is_trivially_copyable_v<entity_type>) {
+            internal::write_entities(archive, reg->data(), sz);
+        } else {
+            for(auto first = reg->data(), last = first + sz; first != last; ++first) {
+                archive(*first);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given components.
+     *
+     * Each instance is serialized together with the entity to which it belongs.
+     * Entities are serialized along with their versions.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive>
+    const basic_snapshot &component(Archive &archive) const {
+        if constexpr(sizeof...(Component) == 1u) {
+            (dump<Component>(archive), ...);
+            return *this;
+        } else {
+            (component<Component>(archive), ...);
+            return *this;
+        }
+    }
+
+    /**
+     * @brief Puts aside the given components for the entities in a range.
+     *
+     * Each instance is serialized together with the entity to which it belongs.
+     * Entities are serialized along with their versions.
+ <br/>
+     * Ranges that cover all the entities of the registry (that is, from
+     * `data()` to `data() + size()`) don't require any lookup and the pools
+     * are serialized directly.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @tparam It Type of input iterator.
+     * @param archive A valid reference to an output archive.
+     * @param first An iterator to the first element of the range to serialize.
+     * @param last An iterator past the last element of the range to serialize.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive, typename It>
+    const basic_snapshot &component(Archive &archive, It first, It last) const {
+        if constexpr(std::is_convertible_v<It, const entity_type *>) {
+            if(const entity_type *data = reg->data(); first == data && last == data + reg->size()) {
+                // all entities are in the range, pools are dumped as they are
+                return component<Component...>(archive);
+            }
+        }
+
+        component<Component...>(archive, first, last, std::index_sequence_for<Component...>{});
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given components, one pool per task.
+     *
+     * Each pool is serialized by means of a `binary_output_archive` into a
+     * section of its own, then sections are written to the archive in order.
+     * The result is the same of `component` invoked with a binary archive and
+     * is restored the same way.<br/>
+     * The executor is invoked once with the number of pools and a task to run
+     * for each index in the range `[0, count)`. The signature of the executor
+     * must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed.
+     *
+     * @warning
+     * The registry mustn't be modified while a snapshot is taken and the pools
+     * of the given components must exist already.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Exec Type of the executor to use.
+     * @tparam Archive Type of output archive.
+     * @param executor A valid executor.
+     * @param archive A valid reference to a block-oriented output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Exec, typename Archive>
+    const basic_snapshot &par_component(Exec &&executor, Archive &archive) const {
+        static_assert(internal::has_bulk_write<Archive>::value, "Block-oriented archive required");
+        // archives that encode entities on their own get them delta encoded as codec archives do
+        using section_archive = std::conditional_t<internal::has_entity_write<Archive, entity_type>::value, internal::delta_output_archive, binary_output_archive>;
+        std::array<std::vector<std::byte>, sizeof...(Component)> section{};
+        const std::array<void (basic_snapshot::*)(section_archive &) const, sizeof...(Component)> func{&basic_snapshot::dump<Component, section_archive>...};
+        const std::array<const type_info *, sizeof...(Component)> info{&type_id<Component>()...};
+
+        executor(sizeof...(Component), [this, &section, &func](const std::size_t pos) {
+            section_archive output{section[pos]};
+            (this->*func[pos])(output);
+        });
+
+        for(std::size_t pos{}; pos < section.size(); ++pos) {
+            // sections still go through the archive, that may encode them
+            internal::open_section(archive, *info[pos]);
+            archive.write(section[pos].data(), section[pos].size());
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside all the pools of the registry, whatever their types.
+     *
+     * The number of pools is serialized first. Then, for each pool, its name,
+     * the number of entities and the entities themselves are serialized before
+     * the function is invoked to put aside the elements.<br/>
+     * The function receives the archive, the pool and the range of entities
+     * just serialized, in this order. Elements are meant to be serialized in
+     * the same order as the entities. Since types are only known at runtime,
+     * it's up to the caller to find them (for example, through the `meta`
+     * module by means of `pool.type()`) and to serialize elements as they are
+     * returned by `pool.get(entt)`.
+     *
+     * @tparam Archive Type of output archive.
+     * @tparam Func Type of function to use to serialize the elements.
+     * @param archive A valid reference to an output archive.
+     * @param func A valid function object.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Archive, typename Func>
+    const basic_snapshot &storage(Archive &archive, Func func) const {
+        const auto range = reg->storage();
+        std::vector<entity_type> entities{};
+
+        archive(typename entity_traits::entity_type(std::distance(range.begin(), range.end())));
+
+        for(auto [id, pool]: range) {
+            const entity_type *first = pool.data();
+            const entity_type *last = first + pool.size();
+
+            if(pool.policy() != deletion_policy::swap_and_pop) {
+                // tombstones never reach the archive
+                entities.clear();
+                std::copy_if(first, last, std::back_inserter(entities), [](const auto entt) { return entt != tombstone; });
+                first = entities.data();
+                last = first + entities.size();
+            }
+
+            archive(id);
+            archive(typename entity_traits::entity_type(last - first));
+
+            if constexpr(internal::has_bulk_write<Archive>::value && std::is_trivially_copyable_v<entity_type>) {
+                archive.write(first, static_cast<std::size_t>(last - first) * sizeof(entity_type));
+            } else {
+                std::for_each(first, last, [&archive](const auto entt) { archive(entt); });
+            }
+
+            func(archive, std::as_const(pool), first, last);
+        }
+
+        return *this;
+    }
+
+private:
+    const basic_registry<entity_type> *reg;
+};
+
+/**
+ * @brief Utility class to create delta snapshots from a registry.
+ *
+ * A _delta snapshot_ only contains the changes that occurred to a set of
+ * tracked components since the last checkpoint. Entities to which a component
+ * is assigned or for which it's patched or replaced are serialized along with
+ * their instances, entities from which it's removed are serialized alone.<br/>
+ * Changes are detected by means of the signals of the registry. Therefore,
+ * modifications must go through it to be recorded.
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  */
 template<typename Entity>
-class basic_snapshot {
+class basic_delta_snapshot {
     using entity_traits = entt_traits<Entity>;
 
-    template<typename Component, typename Archive, typename It>
-    void get(Archive &archive, std::size_t sz, It first, It last) const {
-        const auto view = reg->template view<std::add_const_t<Component>>();
-        archive(typename entity_traits::entity_type(sz));
+    struct changes {
+        basic_sparse_set<Entity> updated{};
+        basic_sparse_set<Entity> destroyed{};
+        void (*release)(basic_delta_snapshot &, basic_registry<Entity> &){};
+    };
 
-        while(first != last) {
-            const auto entt = *(first++);
+    template<typename Component>
+    static void updated(basic_delta_snapshot &delta, basic_registry<Entity> &, const Entity entt) {
+        auto &elem = delta.pools[type_hash<Component>::value()];
+        elem.destroyed.remove(entt);
 
-            if(reg->template all_of<Component>(entt)) {
-                std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
-            }
+        if(!elem.updated.contains(entt)) {
+            elem.updated.emplace(entt);
         }
     }
 
-    template<typename... Component, typename Archive, typename It, std::size_t... Index>
-    void component(Archive &archive, It first, It last, std::index_sequence<Index...>) const {
-        std::array<std::size_t, sizeof...(Index)> size{};
-        auto begin = first;
+    template<typename Component>
+    static void destroyed(basic_delta_snapshot &delta, basic_registry<Entity> &, const Entity entt) {
+        auto &elem = delta.pools[type_hash<Component>::value()];
+        elem.updated.remove(entt);
 
-        while(begin != last) {
-            const auto entt = *(begin++);
-            ((reg->template all_of<Component>(entt) ? ++size[Index] : 0u), ...);
+        if(!elem.destroyed.contains(entt)) {
+            elem.destroyed.emplace(entt);
         }
+    }
 
-        (get<Component>(archive, size[Index], first, last), ...);
+    template<typename Component>
+    static void release(basic_delta_snapshot &delta, basic_registry<Entity> &reg) {
+        reg.template on_construct<Component>().disconnect(delta);
+        reg.template on_update<Component>().disconnect(delta);
+        reg.template on_destroy<Component>().disconnect(delta);
+    }
+
+    template<typename Component>
+    void connect() {
+        if(auto &&elem = pools[type_hash<Component>::value()]; !elem.release) {
+            elem.release = &basic_delta_snapshot::release<Component>;
+            reg->template on_construct<Component>().template connect<&basic_delta_snapshot::updated<Component>>(*this);
+            reg->template on_update<Component>().template connect<&basic_delta_snapshot::updated<Component>>(*this);
+            reg->template on_destroy<Component>().template connect<&basic_delta_snapshot::destroyed<Component>>(*this);
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void dump(Archive &archive) const {
+        const auto it = pools.find(type_hash<Component>::value());
+        ENTT_ASSERT(it != pools.cend(), "Component not tracked");
+        const auto &storage = reg->template storage<Component>();
+
+        internal::open_section(archive, type_id<Component>());
+        archive(typename entity_traits::entity_type(it->second.updated.size()));
+
+        for(const auto entt: it->second.updated) {
+            if constexpr(ignore_as_empty_v<Component>) {
+                archive(entt);
+            } else {
+                archive(entt, storage.get(entt));
+            }
+        }
+
+        archive(typename entity_traits::entity_type(it->second.destroyed.size()));
+
+        for(const auto entt: it->second.destroyed) {
+            archive(entt);
+        }
+    }
+
+    template<typename Component, typename Archive, typename It>
+    void dump(Archive &archive, It first, It last) const {
+        const auto it = pools.find(type_hash<Component>::value());
+        ENTT_ASSERT(it != pools.cend(), "Component not tracked");
+        const auto &storage = reg->template storage<Component>();
+        const auto &[updated, destroyed, release] = it->second;
+
+        internal::open_section(archive, type_id<Component>());
+        archive(typename entity_traits::entity_type(std::count_if(first, last, [&updated](const auto entt) { return updated.contains(entt); })));
+
+        for(auto curr = first; curr != last; ++curr) {
+            if(const auto entt = *curr; updated.contains(entt)) {
+                if constexpr(ignore_as_empty_v<Component>) {
+                    archive(entt);
+                } else {
+                    archive(entt, storage.get(entt));
+                }
+            }
+        }
+
+        archive(typename entity_traits::entity_type(std::count_if(first, last, [&destroyed](const auto entt) { return destroyed.contains(entt); })));
+
+        for(auto curr = first; curr != last; ++curr) {
+            if(const auto entt = *curr; destroyed.contains(entt)) {
+                archive(entt);
+            }
+        }
     }
 
 public:
@@ -67,44 +1436,56 @@ public:
      * @brief Constructs an instance that is bound to a given registry.
      * @param source A valid reference to a registry.
      */
-    basic_snapshot(const basic_registry<entity_type> &source) ENTT_NOEXCEPT
-        : reg{&source} {}
+    basic_delta_snapshot(basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : pools{},
+          reg{&source} {}
 
-    /*! @brief Default move constructor. */
-    basic_snapshot(basic_snapshot &&) ENTT_NOEXCEPT = default;
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_delta_snapshot(const basic_delta_snapshot &) = delete;
 
-    /*! @brief Default move assignment operator. @return This snapshot. */
-    basic_snapshot &operator=(basic_snapshot &&) ENTT_NOEXCEPT = default;
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_delta_snapshot(basic_delta_snapshot &&) = delete;
+
+    /*! @brief Stops tracking all components. */
+    ~basic_delta_snapshot() {
+        for(auto &&elem: pools) {
+            elem.second.release(*this, *reg);
+        }
+    }
 
     /**
-     * @brief Puts aside all the entities from the underlying registry.
-     *
-     * Entities are serialized along with their versions. Destroyed entities are
-     * taken in consideration as well by this function.
-     *
-     * @tparam Archive Type of output archive.
-     * @param archive A valid reference to an output archive.
-     * @return An object of this type to continue creating the snapshot.
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This delta snapshot.
      */
-    template<typename Archive>
-    const basic_snapshot &entities(Archive &archive) const {
-        const auto sz = reg->size();
+    basic_delta_snapshot &operator=(const basic_delta_snapshot &) = delete;
 
-        archive(typename entity_traits::entity_type(sz + 1u));
-        archive(reg->released());
-
-        for(auto first = reg->data(), last = first + sz; first != last; ++first) {
-            archive(*first);
-        }
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This delta snapshot.
+     */
+    basic_delta_snapshot &operator=(basic_delta_snapshot &&) = delete;
 
+    /**
+     * @brief Starts tracking changes to the given components.
+     *
+     * Changes that occurred before a component is tracked aren't recorded.
+     *
+     * @tparam Component Types of components to track.
+     * @return A reference to this delta snapshot.
+     */
+    template<typename... Component>
+    basic_delta_snapshot &track() {
+        (connect<Component>(), ...);
         return *this;
     }
 
     /**
-     * @brief Puts aside the given components.
+     * @brief Puts aside the changes to the given components.
      *
-     * Each instance is serialized together with the entity to which it belongs.
-     * Entities are serialized along with their versions.
+     * For each component, the entities for which it was assigned, patched or
+     * replaced are serialized along with their instances first. Then the
+     * entities from which it was removed are serialized alone.<br/>
+     * Components must have been tracked before changes occurred.
      *
      * @tparam Component Types of components to serialize.
      * @tparam Archive Type of output archive.
@@ -112,39 +1493,65 @@ public:
      * @return An object of this type to continue creating the snapshot.
      */
     template<typename... Component, typename Archive>
-    const basic_snapshot &component(Archive &archive) const {
-        if constexpr(sizeof...(Component) == 1u) {
-            const auto view = reg->template view<const Component...>();
-            (component<Component>(archive, view.rbegin(), view.rend()), ...);
-            return *this;
-        } else {
-            (component<Component>(archive), ...);
-            return *this;
-        }
+    const basic_delta_snapshot &component(Archive &archive) const {
+        (dump<Component>(archive), ...);
+        return *this;
     }
 
     /**
-     * @brief Puts aside the given components for the entities in a range.
+     * @brief Puts aside the changes to the given components for the entities
+     * in a range.
      *
-     * Each instance is serialized together with the entity to which it belongs.
-     * Entities are serialized along with their versions.
+     * The range is meant to be the interest set of a client, so that the same
+     * changes are replicated to different clients before the next checkpoint.
+     * The output has the same layout of the one of the function that doesn't
+     * accept a range and is applied the same way.<br/>
+     * Changes are serialized one pool at a time, in the order of the range.
      *
      * @tparam Component Types of components to serialize.
      * @tparam Archive Type of output archive.
-     * @tparam It Type of input iterator.
+     * @tparam It Type of forward iterator.
      * @param archive A valid reference to an output archive.
-     * @param first An iterator to the first element of the range to serialize.
-     * @param last An iterator past the last element of the range to serialize.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
      * @return An object of this type to continue creating the snapshot.
      */
     template<typename... Component, typename Archive, typename It>
-    const basic_snapshot &component(Archive &archive, It first, It last) const {
-        component<Component...>(archive, first, last, std::index_sequence_for<Component...>{});
+    const basic_delta_snapshot &component(Archive &archive, It first, It last) const {
+        (dump<Component>(archive, first, last), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Discards all changes recorded so far.
+     * @return A reference to this delta snapshot.
+     */
+    basic_delta_snapshot &checkpoint() {
+        for(auto &&elem: pools) {
+            elem.second.updated.clear();
+            elem.second.destroyed.clear();
+        }
+
         return *this;
     }
 
+    /**
+     * @brief Checks whether there are changes not discarded yet.
+     * @return True if there are no pending changes, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        for(auto &&elem: pools) {
+            if(!elem.second.updated.empty() || !elem.second.destroyed.empty()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
 private:
-    const basic_registry<entity_type> *reg;
+    dense_map<id_type, changes, identity> pools;
+    basic_registry<entity_type> *reg;
 };
 
 /**
@@ -166,9 +1573,34 @@ class basic_snapshot_loader {
         typename entity_traits::entity_type length{};
         entity_type entt;
 
+        internal::open_section(archive, type_id<Type>());
         archive(length);
 
-        if constexpr(ignore_as_empty_v<Type>) {
+        if constexpr(internal::has_bulk_read<Archive>::value && internal::bulk_copyable_v<Type>) {
+            std::vector<entity_type> entities(length);
+            internal::read_entities(archive, entities.data(), entities.size());
+
+            for(const auto curr: entities) {
+                [[maybe_unused]] const auto entity = reg->valid(curr) ? curr : reg->create(curr);
+                ENTT_ASSERT(entity == curr, "Entity not available for use");
+            }
+
+            if constexpr(ignore_as_empty_v<Type>) {
+                reg->template insert<Type>(entities.cbegin(), entities.cend());
+            } else {
+                // one page at a time, archives never have to provide all the instances at once
+                constexpr auto page = component_traits<Type>::page_size;
+                std::vector<Type> instances((std::min)(page, static_cast<std::size_t>(length)));
+                reg->template storage<Type>().reserve(length);
+
+                for(std::size_t pos{}; pos < length; pos += page) {
+                    const auto count = (std::min)(page, length - pos);
+                    const auto first = entities.cbegin() + static_cast<typename std::vector<entity_type>::difference_type>(pos);
+                    archive.read(instances.data(), count * sizeof(Type));
+                    reg->template insert<Type>(first, first + static_cast<typename std::vector<entity_type>::difference_type>(count), instances.data());
+                }
+            }
+        } else if constexpr(ignore_as_empty_v<Type>) {
             while(length--) {
                 archive(entt);
                 const auto entity = reg->valid(entt) ? entt : reg->create(entt);
@@ -220,15 +1652,25 @@ public:
     template<typename Archive>
     const basic_snapshot_loader &entities(Archive &archive) const {
         typename entity_traits::entity_type length{};
+        typename entity_traits::entity_type count{};
 
-        archive(length);
+        internal::open_section(archive, type_id<entity_type>());
+        const bool unversioned = internal::read_entities_header<entity_traits>(archive, length, count);
         std::vector<entity_type> all(length);
 
-        for(std::size_t pos{}; pos < length; ++pos) {
-            archive(all[pos]);
+        if constexpr(internal::has_bulk_read<Archive>::value && std::is_trivially_copyable_v<entity_type>) {
+            internal::read_entities(archive, all.data(), all.size());
+        } else {
+            for(std::size_t pos{}; pos < length; ++pos) {
+                archive(all[pos]);
+            }
+        }
+
+        if(unversioned) {
+            count = static_cast<typename entity_traits::entity_type>(internal::from_unversioned_layout<entity_traits>(all));
         }
 
-        reg->assign(++all.cbegin(), all.cend(), all[0u]);
+        reg->assign(all.cbegin(), all.cend(), count);
 
         return *this;
     }
@@ -263,12 +1705,7 @@ public:
      * @return A valid loader to continue restoring data.
      */
     const basic_snapshot_loader &orphans() const {
-        reg->each([this](const auto entt) {
-            if(reg->orphan(entt)) {
-                reg->release(entt);
-            }
-        });
-
+        internal::release_orphans(*reg);
         return *this;
     }
 
@@ -296,28 +1733,50 @@ template<typename Entity>
 class basic_continuous_loader {
     using entity_traits = entt_traits<Entity>;
 
+    struct remote_slot {
+        Entity remote{null};
+        Entity local{null};
+        bool dirty{};
+    };
+
+    remote_slot &assure(const Entity entt) {
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+
+        if(!(pos < remloc.size())) {
+            remloc.resize(pos + 1u);
+        }
+
+        auto &slot = remloc[pos];
+
+        if(slot.remote != entt) {
+            // a newer version replaces the old one, its local counterpart is stale
+            if(slot.remote != null && reg->valid(slot.local)) {
+                reg->destroy(slot.local);
+            }
+
+            slot = remote_slot{entt, null, false};
+        }
+
+        return slot;
+    }
+
     void destroy(Entity entt) {
-        if(const auto it = remloc.find(entt); it == remloc.cend()) {
-            const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
-            reg->destroy(local);
+        if(auto &slot = assure(entt); slot.local == null) {
+            slot.local = reg->create();
+            slot.dirty = true;
+            reg->destroy(slot.local);
         }
     }
 
     void restore(Entity entt) {
-        const auto it = remloc.find(entt);
-
-        if(it == remloc.cend()) {
-            const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
-        } else {
-            if(!reg->valid(remloc[entt].first)) {
-                remloc[entt].first = reg->create();
-            }
+        auto &slot = assure(entt);
 
-            // set the dirty flag
-            remloc[entt].second = true;
+        if(!reg->valid(slot.local)) {
+            slot.local = reg->create();
         }
+
+        // set the dirty flag
+        slot.dirty = true;
     }
 
     template<typename Container>
@@ -348,8 +1807,12 @@ class basic_continuous_loader {
         // vector like container
         static_assert(std::is_same_v<typename Container::value_type, entity_type>, "Invalid value type");
 
-        for(auto &&entt: container) {
-            entt = map(entt);
+        if constexpr(std::is_same_v<decltype(container.data()), entity_type *>) {
+            map_n(container.data(), container.size());
+        } else {
+            for(auto &&entt: container) {
+                entt = map(entt);
+            }
         }
     }
 
@@ -365,13 +1828,21 @@ class basic_continuous_loader {
         }
     }
 
+    template<typename Other, typename Type, typename Member>
+    void remap([[maybe_unused]] Other *instances, [[maybe_unused]] const std::size_t length, [[maybe_unused]] Member Type::*member) {
+        // members are updated one at a time for the whole batch
+        if constexpr(std::is_same_v<Other, Type>) {
+            for(std::size_t pos{}; pos < length; ++pos) {
+                update(instances[pos], member);
+            }
+        }
+    }
+
     template<typename Component>
     void remove_if_exists() {
-        for(auto &&ref: remloc) {
-            const auto local = ref.second.first;
-
-            if(reg->valid(local)) {
-                reg->template remove<Component>(local);
+        for(auto &&slot: remloc) {
+            if(slot.remote != null && reg->valid(slot.local)) {
+                reg->template remove<Component>(slot.local);
             }
         }
     }
@@ -381,6 +1852,52 @@ class basic_continuous_loader {
         typename entity_traits::entity_type length{};
         entity_type entt;
 
+        internal::open_section(archive, type_id<Other>());
+        archive(length);
+
+        if constexpr(internal::has_bulk_read<Archive>::value && internal::bulk_copyable_v<Other>) {
+            std::vector<entity_type> entities(length);
+            internal::read_entities(archive, entities.data(), entities.size());
+
+            if constexpr(ignore_as_empty_v<Other>) {
+                for(const auto curr: entities) {
+                    restore(curr);
+                    reg->template emplace_or_replace<Other>(map(curr));
+                }
+            } else {
+                std::vector<Other> instances(length);
+                archive.read(instances.data(), instances.size() * sizeof(Other));
+                (remap(instances.data(), instances.size(), member), ...);
+
+                for(std::size_t pos{}; pos < length; ++pos) {
+                    restore(entities[pos]);
+                    reg->template emplace_or_replace<Other>(map(entities[pos]), std::move(instances[pos]));
+                }
+            }
+        } else if constexpr(ignore_as_empty_v<Other>) {
+            while(length--) {
+                archive(entt);
+                restore(entt);
+                reg->template emplace_or_replace<Other>(map(entt));
+            }
+        } else {
+            Other instance;
+
+            while(length--) {
+                archive(entt, instance);
+                (update(instance, member), ...);
+                restore(entt);
+                reg->template emplace_or_replace<Other>(map(entt), std::move(instance));
+            }
+        }
+    }
+
+    template<typename Other, typename Archive, typename... Type, typename... Member>
+    void assign_delta(Archive &archive, [[maybe_unused]] Member Type::*...member) {
+        typename entity_traits::entity_type length{};
+        entity_type entt;
+
+        internal::open_section(archive, type_id<Other>());
         archive(length);
 
         if constexpr(ignore_as_empty_v<Other>) {
@@ -399,6 +1916,16 @@ class basic_continuous_loader {
                 reg->template emplace_or_replace<Other>(map(entt), std::move(instance));
             }
         }
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+
+            if(const auto local = map(entt); reg->valid(local)) {
+                reg->template remove<Other>(local);
+            }
+        }
     }
 
 public:
@@ -431,16 +1958,34 @@ public:
     template<typename Archive>
     basic_continuous_loader &entities(Archive &archive) {
         typename entity_traits::entity_type length{};
+        typename entity_traits::entity_type count{};
+        std::vector<entity_type> all{};
         entity_type entt{};
 
-        archive(length);
-        // discards the head of the list of destroyed entities
-        archive(entt);
+        internal::open_section(archive, type_id<entity_type>());
+        const bool unversioned = internal::read_entities_header<entity_traits>(archive, length, count);
 
-        for(std::size_t pos{}, last = length - 1u; pos < last; ++pos) {
-            archive(entt);
+        if constexpr(internal::has_entity_read<Archive, entity_type>::value) {
+            // entities are encoded as a whole rather than one at a time
+            all.resize(length);
+            archive.read_entities(all.data(), all.size());
+        }
+
+        for(std::size_t pos{}; pos < length; ++pos) {
+            if constexpr(internal::has_entity_read<Archive, entity_type>::value) {
+                entt = all[pos];
+            } else {
+                archive(entt);
+            }
 
-            if(const auto entity = entity_traits::to_entity(entt); entity == pos) {
+            if(unversioned) {
+                if(entity_traits::to_entity(entt) == pos) {
+                    restore(entt);
+                } else {
+                    // destroyed entities are stored along with the next free slot
+                    destroy(entity_traits::construct(static_cast<typename entity_traits::entity_type>(pos), entity_traits::to_version(entt)));
+                }
+            } else if(pos < count) {
                 restore(entt);
             } else {
                 destroy(entt);
@@ -476,6 +2021,34 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Applies the changes recorded by a delta snapshot.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization. Components are assigned or replaced for the entities
+     * that were updated and removed from those that lost them. Local
+     * counterparts are created for unknown entities as needed.<br/>
+     * Members are updated as if the components were restored with the
+     * `component` member function.
+     *
+     * @warning
+     * Only the entities touched by a delta are marked as in use. Therefore,
+     * the `shrink` member function shouldn't be invoked after applying one.
+     *
+     * @tparam Component Types of components to update.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    basic_continuous_loader &delta(Archive &archive, Member Type::*...member) {
+        (assign_delta<Component>(archive, member...), ...);
+        return *this;
+    }
+
     /**
      * @brief Helps to purge entities that no longer have a conterpart.
      *
@@ -485,21 +2058,15 @@ public:
      * @return A non-const reference to this loader.
      */
     basic_continuous_loader &shrink() {
-        auto it = remloc.begin();
-
-        while(it != remloc.cend()) {
-            const auto local = it->second.first;
-            bool &dirty = it->second.second;
-
-            if(dirty) {
-                dirty = false;
-                ++it;
-            } else {
-                if(reg->valid(local)) {
-                    reg->destroy(local);
+        for(auto &&slot: remloc) {
+            if(slot.dirty) {
+                slot.dirty = false;
+            } else if(slot.remote != null) {
+                if(reg->valid(slot.local)) {
+                    reg->destroy(slot.local);
                 }
 
-                it = remloc.erase(it);
+                slot = remote_slot{};
             }
         }
 
@@ -517,12 +2084,7 @@ public:
      * @return A non-const reference to this loader.
      */
     basic_continuous_loader &orphans() {
-        reg->each([this](const auto entt) {
-            if(reg->orphan(entt)) {
-                reg->release(entt);
-            }
-        });
-
+        internal::release_orphans(*reg);
         return *this;
     }
 
@@ -532,7 +2094,8 @@ public:
      * @return True if `entity` is managed by the loader, false otherwise.
      */
     [[nodiscard]] bool contains(entity_type entt) const ENTT_NOEXCEPT {
-        return (remloc.find(entt) != remloc.cend());
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+        return pos < remloc.size() && remloc[pos].remote == entt && entt != null;
     }
 
     /**
@@ -541,18 +2104,26 @@ public:
      * @return The local identifier if any, the null entity otherwise.
      */
     [[nodiscard]] entity_type map(entity_type entt) const ENTT_NOEXCEPT {
-        const auto it = remloc.find(entt);
-        entity_type other = null;
+        return contains(entt) ? remloc[static_cast<std::size_t>(entity_traits::to_entity(entt))].local : entity_type{null};
+    }
 
-        if(it != remloc.cend()) {
-            other = it->second.first;
+    /**
+     * @brief Replaces a number of identifiers with their local counterparts.
+     *
+     * Identifiers that the loader doesn't know about are replaced with the
+     * null entity, as if they were translated one at a time with `map`.
+     *
+     * @param data A pointer to the first identifier to translate.
+     * @param count The number of identifiers to translate.
+     */
+    void map_n(entity_type *data, const std::size_t count) const ENTT_NOEXCEPT {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            data[pos] = map(data[pos]);
         }
-
-        return other;
     }
 
 private:
-    dense_map<entity_type, std::pair<entity_type, bool>> remloc;
+    std::vector<remote_slot> remloc;
     basic_registry<entity_type> *reg;
 };
 
@@ -1,17 +1,24 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
 #include "../core/algorithm.hpp"
 #include "../core/any.hpp"
 #include "../core/memory.hpp"
 #include "../core/type_info.hpp"
+#include "../core/utility.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 
@@ -142,7 +149,97 @@ enum class deletion_policy : std::uint8_t {
     /*! @brief Swap-and-pop deletion policy. */
     swap_and_pop = 0u,
     /*! @brief In-place deletion policy. */
-    in_place = 1u
+    in_place = 1u,
+    /*! @brief In-place deletion policy, elements are never moved. */
+    pinned = 2u
+};
+
+/*! @brief Sparse set indexing policy. */
+enum class sparse_policy : std::uint8_t {
+    /*! @brief Paged sparse array, indexed by entity. */
+    paged = 0u,
+    /*! @brief Hash table, one slot per contained entity. */
+    hashed = 1u,
+    /**
+     * @brief Paged sparse array of 16-bit positions, for small sets. Sets
+     * switch to a paged sparse array as soon as they outgrow it.
+     */
+    compact = 2u
+};
+
+/*! @brief Memory used by a sparse set or a storage, in bytes if not stated otherwise. */
+struct memory_footprint {
+    /*! @brief Sparse array, pages included. */
+    std::size_t sparse{};
+    /*! @brief Packed array of entities. */
+    std::size_t packed{};
+    /*! @brief Objects assigned to the entities, pages included. */
+    std::size_t payload{};
+    /*! @brief Groups owned by a registry, if any. */
+    std::size_t groups{};
+    /*! @brief Number of tombstones in the packed array. */
+    std::size_t tombstones{};
+
+    /**
+     * @brief Returns the total amount of memory used, in bytes.
+     * @return The total amount of memory used.
+     */
+    [[nodiscard]] constexpr std::size_t total() const ENTT_NOEXCEPT {
+        return sparse + packed + payload + groups;
+    }
+
+    /**
+     * @brief Accumulates the memory used by another object.
+     * @param other The memory used by another object.
+     * @return This object.
+     */
+    constexpr memory_footprint &operator+=(const memory_footprint &other) ENTT_NOEXCEPT {
+        sparse += other.sparse;
+        packed += other.packed;
+        payload += other.payload;
+        groups += other.groups;
+        tombstones += other.tombstones;
+        return *this;
+    }
+};
+
+/**
+ * @brief Operations performed by a sparse set or a storage.
+ *
+ * Counters are only updated if `ENTT_SPARSE_SET_STATISTICS` is defined to a
+ * non-zero value, otherwise they're always zero.
+ */
+struct sparse_set_statistics {
+    /*! @brief Entities assigned to the sparse set. */
+    std::size_t emplaced{};
+    /*! @brief Entities erased from the sparse set. */
+    std::size_t erased{};
+    /*! @brief Elements moved to fill the holes left by swap-and-pop. */
+    std::size_t moved{};
+    /*! @brief Tombstones created by in-place deletion. */
+    std::size_t tombstones{};
+    /*! @brief Compactions and defragmentations of the packed array. */
+    std::size_t compactions{};
+    /*! @brief Pages allocated for the sparse array. */
+    std::size_t pages{};
+    /*! @brief Sort invocations, including those to match other orders. */
+    std::size_t sorts{};
+
+    /**
+     * @brief Accumulates the operations performed by another object.
+     * @param other The operations performed by another object.
+     * @return This object.
+     */
+    constexpr sparse_set_statistics &operator+=(const sparse_set_statistics &other) ENTT_NOEXCEPT {
+        emplaced += other.emplaced;
+        erased += other.erased;
+        moved += other.moved;
+        tombstones += other.tombstones;
+        compactions += other.compactions;
+        pages += other.pages;
+        sorts += other.sorts;
+        return *this;
+    }
 };
 
 /**
@@ -174,47 +271,258 @@ class basic_sparse_set {
     static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
     using sparse_container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
     using packed_container_type = std::vector<Entity, Allocator>;
+    using occupancy_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
     using entity_traits = entt_traits<Entity>;
+    using index_key_type = typename entity_traits::entity_type;
+    using index_container_type = dense_map<index_key_type, Entity, identity, std::equal_to<index_key_type>, typename alloc_traits::template rebind_alloc<std::pair<const index_key_type, Entity>>>;
+    using narrow_type = std::uint16_t;
+    using narrow_container_type = std::vector<typename alloc_traits::template rebind_traits<narrow_type>::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::template rebind_traits<narrow_type>::pointer>>;
+
+    // the largest position is reserved to mark empty slots
+    static constexpr auto narrow_null = (std::numeric_limits<narrow_type>::max)();
 
-    [[nodiscard]] auto sparse_ptr(const Entity entt) const {
+    template<typename Pages>
+    [[nodiscard]] static auto page_ptr(const Pages &pages, const Entity entt) {
         const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
         const auto page = pos / entity_traits::page_size;
-        return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, entity_traits::page_size)) : nullptr;
+        return (page < pages.size() && pages[page]) ? (to_address(pages[page]) + fast_mod(pos, entity_traits::page_size)) : nullptr;
+    }
+
+    template<typename Pages, typename Value>
+    void assure_page(Pages &pages, const std::size_t page, const Value value) {
+        using page_traits = typename alloc_traits::template rebind_traits<Value>;
+
+        if(!(page < pages.size())) {
+            occupancy.resize(page + 1u, 0u);
+            pages.resize(page + 1u, nullptr);
+        }
+
+        if(!pages[page]) {
+            typename page_traits::allocator_type page_allocator{packed.get_allocator()};
+            pages[page] = page_traits::allocate(page_allocator, entity_traits::page_size);
+            std::uninitialized_fill(pages[page], pages[page] + entity_traits::page_size, value);
+            count(&sparse_set_statistics::pages);
+        }
+    }
+
+    template<typename Pages>
+    void release_page(Pages &pages, const std::size_t page) {
+        using page_traits = typename alloc_traits::template rebind_traits<typename std::pointer_traits<typename Pages::value_type>::element_type>;
+        typename page_traits::allocator_type page_allocator{packed.get_allocator()};
+        std::destroy(pages[page], pages[page] + entity_traits::page_size);
+        page_traits::deallocate(page_allocator, pages[page], entity_traits::page_size);
+        pages[page] = nullptr;
+    }
+
+    template<typename Pages>
+    std::size_t trim_pages(Pages &pages, const std::size_t budget) {
+        size_type count{};
+
+        for(size_type step{}, length = pages.size(); step < budget && step < length; ++step, cursor = (cursor + 1u) % length) {
+            if(cursor >= length) {
+                cursor = 0u;
+            }
+
+            if(pages[cursor] != nullptr && occupancy[cursor] == 0u) {
+                release_page(pages, cursor);
+                ++count;
+            }
+        }
+
+        for(; !pages.empty() && pages.back() == nullptr; pages.pop_back()) {
+            occupancy.pop_back();
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] const Entity *sparse_ptr(const Entity entt) const {
+        ENTT_ASSERT(!narrowed(), "Invalid indexing policy");
+
+        if(lookup) {
+            const auto it = lookup->find(entity_traits::to_entity(entt));
+            return (it == lookup->cend()) ? nullptr : &it->second;
+        }
+
+        return page_ptr(sparse, entt);
     }
 
-    [[nodiscard]] auto &sparse_ref(const Entity entt) const {
+    [[nodiscard]] const Entity &sparse_ref(const Entity entt) const {
         ENTT_ASSERT(sparse_ptr(entt), "Invalid element");
+
+        if(lookup) {
+            return lookup->find(entity_traits::to_entity(entt))->second;
+        }
+
         const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
         return sparse[pos / entity_traits::page_size][fast_mod(pos, entity_traits::page_size)];
     }
 
-    [[nodiscard]] auto &assure_at_least(const Entity entt) {
+    [[nodiscard]] Entity &sparse_ref(const Entity entt) {
+        return const_cast<Entity &>(std::as_const(*this).sparse_ref(entt));
+    }
+
+    [[nodiscard]] bool narrowed() const ENTT_NOEXCEPT {
+        return indexing == sparse_policy::compact;
+    }
+
+    [[nodiscard]] const narrow_type *narrow_ptr(const Entity entt) const {
+        const auto *elem = page_ptr(narrow, entt);
+        return (elem && *elem != narrow_null) ? elem : nullptr;
+    }
+
+    [[nodiscard]] narrow_type &narrow_ref(const Entity entt) {
+        ENTT_ASSERT(narrow_ptr(entt), "Invalid element");
         const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
-        const auto page = pos / entity_traits::page_size;
+        return narrow[pos / entity_traits::page_size][fast_mod(pos, entity_traits::page_size)];
+    }
+
+    [[nodiscard]] std::size_t position(const Entity entt) const {
+        return narrowed() ? static_cast<std::size_t>(*page_ptr(narrow, entt)) : static_cast<std::size_t>(entity_traits::to_entity(sparse_ref(entt)));
+    }
+
+    void relink(const Entity entt, const std::size_t pos) {
+        if(narrowed()) {
+            narrow_ref(entt) = static_cast<narrow_type>(pos);
+        } else {
+            sparse_ref(entt) = entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), entity_traits::to_integral(entt));
+        }
+    }
 
-        if(!(page < sparse.size())) {
-            sparse.resize(page + 1u, nullptr);
+    void count([[maybe_unused]] std::size_t sparse_set_statistics::*counter, [[maybe_unused]] const std::size_t amount = 1u) ENTT_NOEXCEPT {
+        if constexpr(ENTT_SPARSE_SET_STATISTICS) {
+            stats.*counter += amount;
         }
+    }
+
+    void modified() ENTT_NOEXCEPT {
+        // sets arranged as this one notice the change through the revision
+        ++revision;
+        arranged = nullptr;
+    }
 
-        if(!sparse[page]) {
-            auto page_allocator{packed.get_allocator()};
-            sparse[page] = alloc_traits::allocate(page_allocator, entity_traits::page_size);
-            std::uninitialized_fill(sparse[page], sparse[page] + entity_traits::page_size, null);
+    [[nodiscard]] auto &assure_at_least(const Entity entt) {
+        if(lookup) {
+            const auto elem = lookup->try_emplace(entity_traits::to_entity(entt), null);
+            ENTT_ASSERT(elem.second, "Slot not available");
+            return elem.first->second;
         }
 
+        const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
+        const auto page = pos / entity_traits::page_size;
+        assure_page(sparse, page, Entity{null});
+
         auto &elem = sparse[page][fast_mod(pos, entity_traits::page_size)];
         ENTT_ASSERT(entity_traits::to_version(elem) == entity_traits::to_version(tombstone), "Slot not available");
+        ++occupancy[page];
+        return elem;
+    }
+
+    [[nodiscard]] narrow_type &assure_narrow(const Entity entt) {
+        const auto pos = static_cast<size_type>(entity_traits::to_entity(entt));
+        const auto page = pos / entity_traits::page_size;
+        assure_page(narrow, page, narrow_null);
+
+        auto &elem = narrow[page][fast_mod(pos, entity_traits::page_size)];
+        ENTT_ASSERT(elem == narrow_null, "Slot not available");
+        ++occupancy[page];
         return elem;
     }
 
+    void widen() {
+        // positions no longer fit the compact index, switch to a paged one
+        ENTT_TRY {
+            sparse.resize(narrow.size(), nullptr);
+
+            for(size_type pos{}, last = packed.size(); pos < last; ++pos) {
+                if(const auto entt = packed[pos]; entt != tombstone) {
+                    const auto curr = static_cast<size_type>(entity_traits::to_entity(entt));
+                    assure_page(sparse, curr / entity_traits::page_size, Entity{null});
+                    sparse[curr / entity_traits::page_size][fast_mod(curr, entity_traits::page_size)] = entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), entity_traits::to_integral(entt));
+                }
+            }
+        }
+        ENTT_CATCH {
+            for(size_type page{}, last = sparse.size(); page < last; ++page) {
+                if(sparse[page] != nullptr) {
+                    release_page(sparse, page);
+                }
+            }
+
+            sparse.clear();
+            ENTT_THROW;
+        }
+
+        for(size_type page{}, last = narrow.size(); page < last; ++page) {
+            if(narrow[page] != nullptr) {
+                release_page(narrow, page);
+            }
+        }
+
+        // occupancy is per entity page and doesn't change with the index
+        narrow.clear();
+        indexing = sparse_policy::paged;
+    }
+
+    void release_sparse_slot(const Entity entt) {
+        if(narrowed()) {
+            narrow_ref(entt) = narrow_null;
+            --occupancy[static_cast<size_type>(entity_traits::to_entity(entt)) / entity_traits::page_size];
+        } else if(lookup) {
+            lookup->erase(entity_traits::to_entity(entt));
+        } else {
+            sparse_ref(entt) = null;
+            --occupancy[static_cast<size_type>(entity_traits::to_entity(entt)) / entity_traits::page_size];
+        }
+    }
+
     void release_sparse_pages() {
-        auto page_allocator{packed.get_allocator()};
+        for(size_type page{}, last = sparse.size(); page < last; ++page) {
+            if(sparse[page] != nullptr) {
+                release_page(sparse, page);
+            }
+        }
 
-        for(auto &&page: sparse) {
-            if(page != nullptr) {
-                std::destroy(page, page + entity_traits::page_size);
-                alloc_traits::deallocate(page_allocator, page, entity_traits::page_size);
-                page = nullptr;
+        for(size_type page{}, last = narrow.size(); page < last; ++page) {
+            if(narrow[page] != nullptr) {
+                release_page(narrow, page);
+            }
+        }
+    }
+
+    template<typename Func>
+    void pipeline(const Entity *first, const std::size_t count, Func func) const {
+        // sparse slots are requested a few entities ahead, so that independent lookups overlap
+        constexpr std::size_t distance = 8u;
+
+        for(std::size_t pos{}, last = lookup ? 0u : (std::min)(count, distance); pos < last; ++pos) {
+            prefetch(first[pos]);
+        }
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            if(const auto next = pos + distance; !lookup && next < count) {
+                prefetch(first[next]);
+            }
+
+            func(pos);
+        }
+    }
+
+    void rearrange(const std::size_t length) {
+        modified();
+
+        // the sparse array still refers to the previous positions of the elements
+        for(std::size_t pos{}; pos < length; ++pos) {
+            auto curr = pos;
+            auto next = position(packed[curr]);
+
+            while(curr != next) {
+                const auto idx = position(packed[next]);
+                const auto entt = packed[curr];
+
+                swap_at(next, idx);
+                relink(entt, curr);
+                curr = std::exchange(next, idx);
             }
         }
     }
@@ -231,19 +539,32 @@ protected:
     /*! @brief Random access iterator type. */
     using basic_iterator = internal::sparse_set_iterator<packed_container_type>;
 
+    /**
+     * @brief Checks whether entities are being erased by a call to `reset`.
+     * @return True if derived classes shouldn't notify removals, false
+     * otherwise.
+     */
+    [[nodiscard]] bool silenced() const ENTT_NOEXCEPT {
+        return muted;
+    }
+
     /**
      * @brief Erases entities from a sparse set.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
     virtual void swap_and_pop(basic_iterator first, basic_iterator last) {
+        modified();
+
         for(; first != last; ++first) {
-            sparse_ref(packed.back()) = entity_traits::combine(static_cast<typename entity_traits::entity_type>(first.index()), entity_traits::to_integral(packed.back()));
+            count(&sparse_set_statistics::erased);
+            count(&sparse_set_statistics::moved, static_cast<std::size_t>(first.index()) != (packed.size() - 1u));
+            relink(packed.back(), static_cast<size_type>(first.index()));
             const auto entt = std::exchange(packed[first.index()], packed.back());
             // unnecessary but it helps to detect nasty bugs
             ENTT_ASSERT((packed.back() = tombstone, true), "");
             // lazy self-assignment guard
-            sparse_ref(entt) = null;
+            release_sparse_slot(entt);
             packed.pop_back();
         }
     }
@@ -254,20 +575,91 @@ protected:
      * @param last An iterator past the last element of the range of entities.
      */
     virtual void in_place_pop(basic_iterator first, basic_iterator last) {
+        modified();
+
         for(; first != last; ++first) {
-            sparse_ref(*first) = null;
+            count(&sparse_set_statistics::erased);
+            count(&sparse_set_statistics::tombstones);
+            release_sparse_slot(*first);
             packed[first.index()] = std::exchange(free_list, entity_traits::combine(static_cast<typename entity_traits::entity_type>(first.index()), entity_traits::reserved));
         }
     }
 
+    /**
+     * @brief Erases a batch of entities from a sparse set.
+     *
+     * Entities aren't required to be contiguous in the packed array. Derived
+     * classes override this function to erase all of them with a single
+     * indirect call rather than one per entity. Those that override either
+     * `swap_and_pop` or `in_place_pop` must override it as well.
+     *
+     * @param first A pointer to the first entity to erase.
+     * @param last A pointer past the last entity to erase.
+     */
+    virtual void pop_n(const Entity *first, const Entity *last) {
+        for(; first != last; ++first) {
+            const auto it = --(end() - index(*first));
+            (mode != deletion_policy::swap_and_pop) ? in_place_pop(it, it + 1u) : swap_and_pop(it, it + 1u);
+        }
+    }
+
+    /**
+     * @brief Erases all entities from a sparse set at once.
+     *
+     * Sparse pages are reset in bulk rather than one slot at a time. The packed
+     * array is left untouched, it's up to the caller to clear it.
+     */
+    virtual void pop_all() {
+        modified();
+
+        if(lookup) {
+            lookup->clear();
+        } else if(narrowed()) {
+            for(std::size_t page{}, last = narrow.size(); page < last; ++page) {
+                if(occupancy[page]) {
+                    std::fill(narrow[page], narrow[page] + entity_traits::page_size, narrow_null);
+                    occupancy[page] = 0u;
+                }
+            }
+        } else {
+            for(std::size_t page{}, last = sparse.size(); page < last; ++page) {
+                if(occupancy[page]) {
+                    std::fill(sparse[page], sparse[page] + entity_traits::page_size, null);
+                    occupancy[page] = 0u;
+                }
+            }
+        }
+    }
+
     /**
      * @brief Assigns an entity to a sparse set.
      * @param entt A valid identifier.
      * @param force_back Force back insertion.
      * @return Iterator pointing to the emplaced element.
      */
-    virtual basic_iterator try_emplace(const Entity entt, const bool force_back, const void * = nullptr) {
+    virtual basic_iterator try_emplace(const Entity entt, const bool force_back, const void * = nullptr, const bool = false) {
         ENTT_ASSERT(!contains(entt), "Set already contains entity");
+        count(&sparse_set_statistics::emplaced);
+        modified();
+
+        if(narrowed() && (free_list == null || force_back) && packed.size() == narrow_null) {
+            widen();
+        }
+
+        if(narrowed()) {
+            const auto pos = (free_list == null || force_back) ? packed.size() : static_cast<size_type>(entity_traits::to_entity(free_list));
+            auto &elem = assure_narrow(entt);
+
+            if(pos == packed.size()) {
+                packed.push_back(entt);
+                elem = static_cast<narrow_type>(pos);
+                return begin();
+            }
+
+            elem = static_cast<narrow_type>(pos);
+            free_list = std::exchange(packed[pos], entt);
+            return --(end() - pos);
+        }
 
         if(auto &elem = assure_at_least(entt); free_list == null || force_back) {
             packed.push_back(entt);
@@ -328,11 +720,34 @@ public:
      * @param allocator The allocator to use (possibly default-constructed).
      */
     explicit basic_sparse_set(const type_info &value, deletion_policy pol = deletion_policy::swap_and_pop, const allocator_type &allocator = {})
+        : basic_sparse_set{value, pol, sparse_policy::paged, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with the given value type, policies
+     * and allocator.
+     * @param value Returned value type, if any.
+     * @param pol Type of deletion policy.
+     * @param index Type of indexing policy.
+     * @param allocator The allocator to use (possibly default-constructed).
+     */
+    basic_sparse_set(const type_info &value, deletion_policy pol, sparse_policy index, const allocator_type &allocator = {})
         : sparse{allocator},
+          narrow{allocator},
           packed{allocator},
+          occupancy{allocator},
+          lookup{},
+          indexing{index},
           info{&value},
           free_list{tombstone},
-          mode{pol} {}
+          mode{pol},
+          stats{},
+          revision{},
+          arranged{},
+          arranged_revision{} {
+        if(index == sparse_policy::hashed) {
+            lookup.emplace(allocator);
+        }
+    }
 
     /**
      * @brief Move constructor.
@@ -340,10 +755,21 @@ public:
      */
     basic_sparse_set(basic_sparse_set &&other) ENTT_NOEXCEPT
         : sparse{std::move(other.sparse)},
+          narrow{std::move(other.narrow)},
           packed{std::move(other.packed)},
+          occupancy{std::move(other.occupancy)},
+          cursor{std::exchange(other.cursor, 0u)},
+          lookup{std::exchange(other.lookup, std::nullopt)},
+          indexing{other.indexing},
           info{other.info},
           free_list{std::exchange(other.free_list, tombstone)},
-          mode{other.mode} {}
+          mode{other.mode},
+          stats{std::exchange(other.stats, sparse_set_statistics{})},
+          revision{other.revision},
+          arranged{other.arranged},
+          arranged_revision{other.arranged_revision} {
+        other.modified();
+    }
 
     /**
      * @brief Allocator-extended move constructor.
@@ -352,11 +778,26 @@ public:
      */
     basic_sparse_set(basic_sparse_set &&other, const allocator_type &allocator) ENTT_NOEXCEPT
         : sparse{std::move(other.sparse), allocator},
+          narrow{std::move(other.narrow), allocator},
           packed{std::move(other.packed), allocator},
+          occupancy{std::move(other.occupancy), allocator},
+          cursor{std::exchange(other.cursor, 0u)},
+          lookup{},
+          indexing{other.indexing},
           info{other.info},
           free_list{std::exchange(other.free_list, tombstone)},
-          mode{other.mode} {
+          mode{other.mode},
+          stats{std::exchange(other.stats, sparse_set_statistics{})},
+          revision{other.revision},
+          arranged{other.arranged},
+          arranged_revision{other.arranged_revision} {
+        other.modified();
         ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.get_allocator() == other.packed.get_allocator(), "Copying a sparse set is not allowed");
+
+        if(other.lookup) {
+            lookup.emplace(std::move(*other.lookup), allocator);
+            other.lookup.reset();
+        }
     }
 
     /*! @brief Default destructor. */
@@ -374,10 +815,20 @@ public:
 
         release_sparse_pages();
         sparse = std::move(other.sparse);
+        narrow = std::move(other.narrow);
         packed = std::move(other.packed);
+        occupancy = std::move(other.occupancy);
+        cursor = std::exchange(other.cursor, 0u);
+        lookup = std::exchange(other.lookup, std::nullopt);
+        indexing = other.indexing;
         info = other.info;
         free_list = std::exchange(other.free_list, tombstone);
         mode = other.mode;
+        stats = std::exchange(other.stats, sparse_set_statistics{});
+        ++revision;
+        arranged = other.arranged;
+        arranged_revision = other.arranged_revision;
+        other.modified();
         return *this;
     }
 
@@ -388,10 +839,20 @@ public:
     void swap(basic_sparse_set &other) {
         using std::swap;
         swap(sparse, other.sparse);
+        swap(narrow, other.narrow);
         swap(packed, other.packed);
+        swap(occupancy, other.occupancy);
+        swap(cursor, other.cursor);
+        swap(lookup, other.lookup);
+        swap(indexing, other.indexing);
         swap(info, other.info);
         swap(free_list, other.free_list);
         swap(mode, other.mode);
+        swap(stats, other.stats);
+        swap(arranged, other.arranged);
+        swap(arranged_revision, other.arranged_revision);
+        ++revision;
+        ++other.revision;
     }
 
     /**
@@ -410,6 +871,18 @@ public:
         return mode;
     }
 
+    /**
+     * @brief Returns the indexing policy of a sparse set.
+     *
+     * Sets with a compact index return `sparse_policy::paged` once they have
+     * outgrown it.
+     *
+     * @return The indexing policy of the sparse set.
+     */
+    [[nodiscard]] sparse_policy index_policy() const ENTT_NOEXCEPT {
+        return indexing;
+    }
+
     /**
      * @brief Increases the capacity of a sparse set.
      *
@@ -422,6 +895,27 @@ public:
         packed.reserve(cap);
     }
 
+    /**
+     * @brief Allocates in advance the sparse slots for a range of identifiers.
+     *
+     * Pages of the sparse array are allocated for all the identifiers in the
+     * range `[0, cap)`, so that assigning them later doesn't allocate pages
+     * one at a time. Sets that use hashed lookups reserve room for `cap`
+     * identifiers instead.<br/>
+     * Pages allocated in advance are unused, therefore `trim` releases them.
+     *
+     * @param cap Number of identifiers to allocate slots for.
+     */
+    void reserve_sparse(const size_type cap) {
+        if(lookup) {
+            lookup->reserve(cap);
+        } else {
+            for(size_type page{}, length = (cap + entity_traits::page_size - 1u) / entity_traits::page_size; page < length; ++page) {
+                narrowed() ? assure_page(narrow, page, narrow_null) : assure_page(sparse, page, Entity{null});
+            }
+        }
+    }
+
     /**
      * @brief Returns the number of elements that a sparse set has currently
      * allocated space for.
@@ -436,6 +930,81 @@ public:
         packed.shrink_to_fit();
     }
 
+    /**
+     * @brief Releases the pages of the sparse array that are no longer in use.
+     * @return The number of pages released.
+     */
+    size_type trim() {
+        return trim(occupancy.size());
+    }
+
+    /**
+     * @brief Releases the pages of the sparse array that are no longer in use,
+     * visiting up to a given number of pages.
+     *
+     * Consecutive calls resume from where the previous one left off. This
+     * makes it possible to spread the cost of reclaiming memory over time, for
+     * example by trimming a few pages per frame.
+     *
+     * @param budget Maximum number of pages to visit.
+     * @return The number of pages released.
+     */
+    size_type trim(const size_type budget) {
+        return narrowed() ? trim_pages(narrow, budget) : trim_pages(sparse, budget);
+    }
+
+    /**
+     * @brief Returns the memory currently allocated by a sparse set.
+     *
+     * Unused capacity is accounted for as well, since it contributes to the
+     * memory footprint of the sparse set.<br/>
+     * Counting tombstones requires walking the list of free slots. Therefore,
+     * the cost of this function is linear in the number of tombstones.
+     *
+     * @return The memory currently allocated by the sparse set.
+     */
+    [[nodiscard]] virtual memory_footprint memory_usage() const {
+        memory_footprint usage{};
+        usage.sparse = sparse.capacity() * sizeof(typename sparse_container_type::value_type) + narrow.capacity() * sizeof(typename narrow_container_type::value_type) + occupancy.capacity() * sizeof(typename occupancy_container_type::value_type);
+        usage.packed = packed.capacity() * sizeof(typename packed_container_type::value_type);
+
+        for(auto &&page: sparse) {
+            usage.sparse += (page != nullptr) * entity_traits::page_size * sizeof(Entity);
+        }
+
+        for(auto &&page: narrow) {
+            usage.sparse += (page != nullptr) * entity_traits::page_size * sizeof(narrow_type);
+        }
+
+        if(lookup) {
+            // approximated, buckets plus one node per element
+            usage.sparse += lookup->bucket_count() * sizeof(size_type) + lookup->size() * (sizeof(typename index_container_type::value_type) + sizeof(size_type));
+        }
+
+        for(auto curr = free_list; curr != null; curr = packed[static_cast<size_type>(entity_traits::to_entity(curr))]) {
+            ++usage.tombstones;
+        }
+
+        return usage;
+    }
+
+    /**
+     * @brief Returns the operations performed by a sparse set so far.
+     *
+     * Counters are only updated if `ENTT_SPARSE_SET_STATISTICS` is defined to a
+     * non-zero value.
+     *
+     * @return The operations performed by the sparse set so far.
+     */
+    [[nodiscard]] const sparse_set_statistics &statistics() const ENTT_NOEXCEPT {
+        return stats;
+    }
+
+    /*! @brief Resets the operation counters of a sparse set. */
+    void reset_statistics() ENTT_NOEXCEPT {
+        stats = {};
+    }
+
     /**
      * @brief Returns the extent of a sparse set.
      *
@@ -447,7 +1016,7 @@ public:
      * @return Extent of the sparse set.
      */
     [[nodiscard]] size_type extent() const ENTT_NOEXCEPT {
-        return sparse.size() * entity_traits::page_size;
+        return (sparse.size() + narrow.size()) * entity_traits::page_size;
     }
 
     /**
@@ -572,12 +1141,69 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
+        if(narrowed()) {
+            // positions don't carry versions, the packed array has the last word
+            const auto elem = narrow_ptr(entt);
+            return elem && packed[*elem] == entt;
+        }
+
         const auto elem = sparse_ptr(entt);
         constexpr auto cap = entity_traits::to_entity(null);
         // testing versions permits to avoid accessing the packed array
         return elem && (((~cap & entity_traits::to_integral(entt)) ^ entity_traits::to_integral(*elem)) < cap);
     }
 
+    /**
+     * @brief Checks if a sparse set contains a batch of entities.
+     *
+     * Sparse slots are prefetched a few entities ahead of the one being
+     * tested. Therefore, the loads of independent lookups overlap rather than
+     * being served one at a time.
+     *
+     * @param first A pointer to the first entity to look for.
+     * @param count Number of entities to look for.
+     * @param out A pointer to an array of at least `count` elements where to
+     * store the results.
+     * @return The number of entities contained in the sparse set.
+     */
+    size_type contains_n(const entity_type *first, const size_type count, bool *out) const ENTT_NOEXCEPT {
+        size_type found{};
+        pipeline(first, count, [this, first, out, &found](const auto pos) { found += (out[pos] = contains(first[pos])); });
+        return found;
+    }
+
+    /**
+     * @brief Returns the positions of a batch of entities in a sparse set.
+     *
+     * @sa contains_n
+     *
+     * @warning
+     * Attempting to get the position of an entity that doesn't belong to the
+     * sparse set results in undefined behavior.
+     *
+     * @param first A pointer to the first entity to look for.
+     * @param count Number of entities to look for.
+     * @param out A pointer to an array of at least `count` elements where to
+     * store the positions.
+     */
+    void index_n(const entity_type *first, const size_type count, size_type *out) const ENTT_NOEXCEPT {
+        pipeline(first, count, [this, first, out](const auto pos) { out[pos] = index(first[pos]); });
+    }
+
+    /**
+     * @brief Hints the processor to load the sparse slot of an entity.
+     *
+     * It has no effect if the compiler doesn't support prefetching or the
+     * sparse page for the given entity doesn't exist.
+     *
+     * @param entt A valid identifier.
+     */
+    void prefetch(const entity_type entt) const ENTT_NOEXCEPT {
+        if(const void *elem = narrowed() ? static_cast<const void *>(page_ptr(narrow, entt)) : sparse_ptr(entt); elem) {
+            ENTT_PREFETCH(elem);
+        }
+    }
+
     /**
      * @brief Returns the contained version for an identifier.
      * @param entt A valid identifier.
@@ -585,8 +1211,14 @@ public:
      * version otherwise.
      */
     [[nodiscard]] version_type current(const entity_type entt) const ENTT_NOEXCEPT {
-        const auto elem = sparse_ptr(entt);
         constexpr auto fallback = entity_traits::to_version(tombstone);
+
+        if(narrowed()) {
+            const auto elem = narrow_ptr(entt);
+            return elem ? entity_traits::to_version(packed[*elem]) : fallback;
+        }
+
+        const auto elem = sparse_ptr(entt);
         return elem ? entity_traits::to_version(*elem) : fallback;
     }
 
@@ -602,7 +1234,7 @@ public:
      */
     [[nodiscard]] size_type index(const entity_type entt) const ENTT_NOEXCEPT {
         ENTT_ASSERT(contains(entt), "Set does not contain entity");
-        return static_cast<size_type>(entity_traits::to_entity(sparse_ref(entt)));
+        return position(entt);
     }
 
     /**
@@ -659,6 +1291,23 @@ public:
         return try_emplace(entt, false, value);
     }
 
+    /**
+     * @brief Assigns an entity to a sparse set and moves an opaque value to it.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * The opaque value is left in a valid but unspecified state.
+     *
+     * @param entt A valid identifier.
+     * @param value Opaque value to forward to mixins, if any.
+     * @return Iterator pointing to the emplaced element in case of success, the
+     * `end()` iterator otherwise.
+     */
+    iterator move_emplace(const entity_type entt, void *value) {
+        return try_emplace(entt, false, value, true);
+    }
+
     /**
      * @brief Bump the version number of an entity.
      *
@@ -669,6 +1318,13 @@ public:
      * @param entt A valid identifier.
      */
     void bump(const entity_type entt) {
+        modified();
+
+        if(narrowed()) {
+            packed[narrow_ref(entt)] = entt;
+            return;
+        }
+
         auto &entity = sparse_ref(entt);
         entity = entity_traits::combine(entity_traits::to_integral(entity), entity_traits::to_integral(entt));
         packed[static_cast<size_type>(entity_traits::to_entity(entity))] = entt;
@@ -707,7 +1363,7 @@ public:
      */
     void erase(const entity_type entt) {
         const auto it = --(end() - index(entt));
-        (mode == deletion_policy::in_place) ? in_place_pop(it, it + 1u) : swap_and_pop(it, it + 1u);
+        (mode != deletion_policy::swap_and_pop) ? in_place_pop(it, it + 1u) : swap_and_pop(it, it + 1u);
     }
 
     /**
@@ -722,7 +1378,9 @@ public:
     template<typename It>
     void erase(It first, It last) {
         if constexpr(std::is_same_v<It, basic_iterator>) {
-            (mode == deletion_policy::in_place) ? in_place_pop(first, last) : swap_and_pop(first, last);
+            (mode != deletion_policy::swap_and_pop) ? in_place_pop(first, last) : swap_and_pop(first, last);
+        } else if constexpr(std::is_convertible_v<It, const entity_type *>) {
+            pop_n(first, last);
         } else {
             for(; first != last; ++first) {
                 erase(*first);
@@ -741,6 +1399,13 @@ public:
 
     /**
      * @brief Removes entities from a sparse set if they exist.
+     *
+     * When the deletion policy is swap-and-pop, the positions of the entities
+     * are collected and sorted first. Entities are then erased from the back to
+     * the front of the packed array in a single pass, so that elements moved to
+     * fill the holes always come from a shrinking tail rather than from random
+     * pages. Duplicates in the range are ignored.
+     *
      * @tparam It Type of input iterator.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
@@ -748,17 +1413,57 @@ public:
      */
     template<typename It>
     size_type remove(It first, It last) {
-        size_type count{};
+        if(mode != deletion_policy::swap_and_pop) {
+            size_type count{};
 
-        for(; first != last; ++first) {
-            count += remove(*first);
+            for(; first != last; ++first) {
+                count += remove(*first);
+            }
+
+            return count;
         }
 
-        return count;
+        // the range may come from the set itself, positions are collected before erasing
+        std::vector<size_type> pos{};
+
+        if constexpr(std::is_convertible_v<It, const entity_type *>) {
+            const entity_type *data = first;
+            pipeline(data, static_cast<size_type>(last - first), [this, data, &pos](const auto curr) {
+                if(contains(data[curr])) {
+                    pos.push_back(index(data[curr]));
+                }
+            });
+        } else {
+            for(; first != last; ++first) {
+                if(contains(*first)) {
+                    pos.push_back(index(*first));
+                }
+            }
+        }
+
+        std::sort(pos.begin(), pos.end(), std::greater<size_type>{});
+        pos.erase(std::unique(pos.begin(), pos.end()), pos.end());
+
+        for(const auto curr: pos) {
+            const auto it = --(end() - curr);
+            swap_and_pop(it, it + 1u);
+        }
+
+        return pos.size();
     }
 
-    /*! @brief Removes all tombstones from the packed array of a sparse set. */
+    /**
+     * @brief Removes all tombstones from the packed array of a sparse set.
+     *
+     * Pinned sets are never compacted, this function does nothing for them.
+     */
     void compact() {
+        if(mode == deletion_policy::pinned) {
+            return;
+        }
+
+        count(&sparse_set_statistics::compactions, free_list != null);
+        modified();
         size_type from = packed.size();
         for(; from && packed[from - 1u] == tombstone; --from) {}
 
@@ -770,8 +1475,7 @@ public:
                 using std::swap;
                 swap(packed[from], packed[to]);
 
-                const auto entity = static_cast<typename entity_traits::entity_type>(to);
-                sparse_ref(packed[to]) = entity_traits::combine(entity, entity_traits::to_integral(packed[to]));
+                relink(packed[to], to);
                 *it = entity_traits::combine(static_cast<typename entity_traits::entity_type>(from), entity_traits::reserved);
                 for(; from && packed[from - 1u] == tombstone; --from) {}
             }
@@ -781,6 +1485,80 @@ public:
         packed.resize(from);
     }
 
+    /**
+     * @brief Removes tombstones from the packed array of a sparse set while
+     * preserving the relative order of its elements.
+     *
+     * Differently from `compact`, elements are shifted towards the beginning
+     * of the packed array rather than moved from the back. Therefore, any
+     * meaningful order (for example, the one imposed by a sort) is preserved
+     * and holes are removed one slice at a time.<br/>
+     * At most `budget` elements are moved during a call. The slots freed in
+     * the meantime are returned to the free list, so that the sparse set is
+     * in a consistent state between two calls.<br/>
+     * Pinned sets are never defragmented.
+     *
+     * @param budget Maximum number of elements to move.
+     * @return True if no tombstones are left, false otherwise.
+     */
+    bool defragment(const size_type budget) {
+        if(free_list == null || mode == deletion_policy::pinned) {
+            return free_list == null;
+        }
+
+        count(&sparse_set_statistics::compactions);
+        modified();
+        size_type from = packed.size();
+
+        for(auto curr = free_list; curr != null; curr = packed[static_cast<size_type>(entity_traits::to_entity(curr))]) {
+            from = (std::min)(from, static_cast<size_type>(entity_traits::to_entity(curr)));
+        }
+
+        size_type last = from;
+
+        for(size_type moves{}; last < packed.size() && (moves < budget || packed[last] == tombstone); ++last) {
+            moves += (packed[last] != tombstone);
+        }
+
+        // slots before last are either filled or returned to the free list
+        for(auto *it = &free_list; *it != null;) {
+            if(auto &next = packed[static_cast<size_type>(entity_traits::to_entity(*it))]; static_cast<size_type>(entity_traits::to_entity(*it)) < last) {
+                *it = next;
+            } else {
+                it = std::addressof(next);
+            }
+        }
+
+        auto to = from;
+
+        for(auto pos = from; pos < last; ++pos) {
+            if(packed[pos] != tombstone) {
+                move_element(pos, to);
+                packed[to] = packed[pos];
+                relink(packed[to], to);
+                ++to;
+            }
+        }
+
+        if(last == packed.size()) {
+            packed.resize(to);
+        } else {
+            for(auto pos = last; pos > to; --pos) {
+                packed[pos - 1u] = std::exchange(free_list, entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos - 1u), entity_traits::reserved));
+            }
+        }
+
+        return free_list == null;
+    }
+
+    /**
+     * @brief Removes all tombstones from the packed array of a sparse set
+     * while preserving the relative order of its elements.
+     */
+    void defragment() {
+        defragment(packed.size());
+    }
+
     /**
      * @brief Swaps two entities in a sparse set.
      *
@@ -796,6 +1574,18 @@ public:
      */
     void swap_elements(const entity_type lhs, const entity_type rhs) {
         ENTT_ASSERT(contains(lhs) && contains(rhs), "Set does not contain entities");
+        ENTT_ASSERT(mode != deletion_policy::pinned, "Elements of pinned sets cannot be moved");
+        modified();
+
+        if(narrowed()) {
+            auto &entt = narrow_ref(lhs);
+            auto &other = narrow_ref(rhs);
+
+            swap_at(entt, other);
+            std::swap(packed[entt], packed[other]);
+            std::swap(entt, other);
+            return;
+        }
 
         auto &entt = sparse_ref(lhs);
         auto &other = sparse_ref(rhs);
@@ -846,23 +1636,39 @@ public:
     void sort_n(const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
         ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
         ENTT_ASSERT(free_list == null, "Partial sorting with tombstones is not supported");
+        ENTT_ASSERT(mode != deletion_policy::pinned, "Pinned sets cannot be sorted");
+        count(&sparse_set_statistics::sorts);
 
         algo(packed.rend() - length, packed.rend(), std::move(compare), std::forward<Args>(args)...);
+        rearrange(length);
+    }
 
-        for(size_type pos{}; pos < length; ++pos) {
-            auto curr = pos;
-            auto next = index(packed[curr]);
-
-            while(curr != next) {
-                const auto idx = index(packed[next]);
-                const auto entt = packed[curr];
+    /**
+     * @brief Sort the first elements so as to match the given order.
+     *
+     * The range must contain exactly the entities in the first positions of
+     * the sparse set, in the order in which they are expected to be returned
+     * when iterating the sparse set. This is useful to apply the permutation
+     * that results from sorting a set to other sets that contain the same
+     * entities in the same positions.
+     *
+     * @warning
+     * Attempting to use a range that isn't a permutation of the first elements
+     * of the sparse set results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void sort_as(It first, It last) {
+        const auto length = static_cast<size_type>(std::distance(first, last));
 
-                swap_at(next, idx);
-                const auto entity = static_cast<typename entity_traits::entity_type>(curr);
-                sparse_ref(entt) = entity_traits::combine(entity, entity_traits::to_integral(packed[curr]));
-                curr = std::exchange(next, idx);
-            }
-        }
+        ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
+        ENTT_ASSERT(mode != deletion_policy::pinned, "Pinned sets cannot be sorted");
+        count(&sparse_set_statistics::sorts);
+        std::copy(first, last, packed.rend() - static_cast<typename packed_container_type::difference_type>(length));
+        rearrange(length);
     }
 
     /**
@@ -883,6 +1689,59 @@ public:
         sort_n(packed.size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Restores the order of a sorted sparse set after some of its
+     * elements changed.
+     *
+     * Only the given entities are sorted. They are then merged with all the
+     * other elements, that are expected to be already sorted according to the
+     * same comparison function. This is much cheaper than sorting the whole
+     * sparse set when only a few elements changed since the last sort.<br/>
+     * Entities can be listed more than once. The comparison function object is
+     * the same accepted by `sort`.
+     *
+     * @warning
+     * Attempting to use entities that don't belong to the sparse set results
+     * in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Compare Type of comparison function object.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param compare A valid comparison function object.
+     */
+    template<typename It, typename Compare>
+    void resort(It first, It last, Compare compare) {
+        ENTT_ASSERT(free_list == null, "Partial sorting with tombstones is not supported");
+
+        std::vector<bool> changed(packed.size());
+        packed_container_type dirty{packed.get_allocator()};
+
+        for(; first != last; ++first) {
+            if(const auto pos = index(*first); !changed[pos]) {
+                changed[pos] = true;
+                dirty.push_back(*first);
+            }
+        }
+
+        if(!dirty.empty()) {
+            packed_container_type order{packed.get_allocator()};
+            order.reserve(packed.size());
+
+            for(auto pos = packed.size(); pos; --pos) {
+                if(!changed[pos - 1u]) {
+                    order.push_back(packed[pos - 1u]);
+                }
+            }
+
+            const auto mid = static_cast<typename packed_container_type::difference_type>(order.size());
+            std::sort(dirty.begin(), dirty.end(), compare);
+            order.insert(order.end(), dirty.begin(), dirty.end());
+            std::inplace_merge(order.begin(), order.begin() + mid, order.end(), std::move(compare));
+            sort_as(order.begin(), order.end());
+        }
+    }
+
     /**
      * @brief Sort entities according to their order in another sparse set.
      *
@@ -899,7 +1758,9 @@ public:
      * @param other The sparse sets that imposes the order of the entities.
      */
     void respect(const basic_sparse_set &other) {
+        ENTT_ASSERT(mode != deletion_policy::pinned, "Pinned sets cannot be sorted");
         compact();
+        count(&sparse_set_statistics::sorts);
 
         const auto to = other.end();
         auto from = other.begin();
@@ -914,12 +1775,34 @@ public:
                 --pos;
             }
         }
+
+        arranged = &other;
+        arranged_revision = other.revision;
+    }
+
+    /**
+     * @brief Checks if a sparse set is still arranged as another one.
+     *
+     * A sparse set is arranged as another one after a call to `respect` and
+     * until either of them changes. In the meantime, the entities they have in
+     * common come first when iterating the sparse set and they are returned in
+     * the same order in which they are returned by the other set.
+     *
+     * @param other A valid sparse set.
+     * @return True if the sparse set is arranged as the given one, false
+     * otherwise.
+     */
+    [[nodiscard]] bool arranged_as(const basic_sparse_set &other) const ENTT_NOEXCEPT {
+        return arranged == &other && arranged_revision == other.revision;
     }
 
     /*! @brief Clears a sparse set. */
     void clear() {
+        modified();
+
         if(const auto last = end(); free_list == null) {
-            in_place_pop(begin(), last);
+            count(&sparse_set_statistics::erased, packed.size());
+            pop_all();
         } else {
             for(auto &&entity: *this) {
                 // tombstone filter on itself
@@ -933,6 +1816,18 @@ public:
         packed.clear();
     }
 
+    /**
+     * @brief Clears a sparse set without notifying the removals, if any.
+     *
+     * Derived classes still release their elements and update their internal
+     * state but listeners, if any, aren't invoked.
+     */
+    void reset() {
+        const auto prev = std::exchange(muted, true);
+        clear();
+        muted = prev;
+    }
+
     /**
      * @brief Returned value type, if any.
      * @return Returned value type, if any.
@@ -946,10 +1841,20 @@ public:
 
 private:
     sparse_container_type sparse;
+    narrow_container_type narrow;
     packed_container_type packed;
+    occupancy_container_type occupancy;
+    size_type cursor{};
+    std::optional<index_container_type> lookup;
+    sparse_policy indexing;
     const type_info *info;
     entity_type free_list;
     deletion_policy mode;
+    sparse_set_statistics stats;
+    size_type revision;
+    const basic_sparse_set *arranged;
+    size_type arranged_revision;
+    bool muted{};
 };
 
 } // namespace entt
@@ -0,0 +1,273 @@
+#ifndef ENTT_ENTITY_SPATIAL_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_SPATIAL_STORAGE_MIXIN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/algorithm.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Mixin type used to add a uniform grid to storage types.
+ *
+ * The locator is a function object that returns the cell of an instance as a
+ * pair of signed integral values. Its signature must be equivalent to the
+ * following form:
+ *
+ * @code{.cpp}
+ * std::pair<std::int32_t, std::int32_t>(const value_type &);
+ * @endcode
+ *
+ * The storage is sorted by cell on demand, so that the instances that belong
+ * to the same cell are tightly packed in memory. Therefore, range queries only
+ * visit the instances of the cells in the range and always access them
+ * sequentially.<br/>
+ * Creating, patching or destroying instances invalidates the arrangement. The
+ * storage is sorted again on the next query, the cheaper the fewer the changes.
+ *
+ * @warning
+ * Modifying instances by means of references or sorting the storage in any
+ * other way isn't detected. Use `patch` or `invalidate` in these cases.
+ *
+ * @warning
+ * Storage classes that are owned by a group cannot be arranged by cell.
+ *
+ * @tparam Type The type of the underlying storage.
+ * @tparam Locator Type of function object to use to get the cell of instances.
+ */
+template<typename Type, typename Locator>
+class spatial_storage_mixin: public Type {
+    static_assert(!component_traits<typename Type::value_type>::in_place_delete, "Spatial storage does not support in-place delete");
+    static_assert(!ignore_as_empty_v<typename Type::value_type>, "Spatial storage requires non-empty types");
+
+    using key_type = std::uint64_t;
+
+    struct range {
+        key_type key;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    [[nodiscard]] static key_type to_key(const std::int32_t x, const std::int32_t y) ENTT_NOEXCEPT {
+        // flipping the sign bit preserves the order of signed values
+        constexpr auto bias = std::uint32_t{1u} << 31u;
+        return (key_type{static_cast<std::uint32_t>(y) ^ bias} << 32u) | key_type{static_cast<std::uint32_t>(x) ^ bias};
+    }
+
+    [[nodiscard]] key_type key_of(const typename Type::value_type &elem) const {
+        const auto [x, y] = locator(elem);
+        return to_key(x, y);
+    }
+
+    void mark() ENTT_NOEXCEPT {
+        ++changes;
+    }
+
+    void arrange() {
+        const auto compare = [this](const auto lhs, const auto rhs) { return key_of(this->get(lhs)) < key_of(this->get(rhs)); };
+
+        // a few changes since the last arrangement are best handled by an insertion sort
+        if(grid.empty() || changes > (Type::size() / 8u)) {
+            Type::sort(compare);
+        } else {
+            Type::sort(compare, insertion_sort{});
+        }
+
+        grid.clear();
+
+        // entities are sorted in reverse order in the packed array
+        for(auto last = Type::size(); last;) {
+            const auto key = key_of(this->rbegin()[last - 1u]);
+            auto first = last - 1u;
+
+            for(; first && key_of(this->rbegin()[first - 1u]) == key; --first) {}
+
+            grid.push_back(range{key, first, last});
+            last = first;
+        }
+
+        changes = {};
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        mark();
+        Type::swap_and_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::pop_n */
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) override {
+        mark();
+        Type::pop_n(first, last);
+    }
+
+    /*! @copydoc basic_sparse_set::pop_all */
+    void pop_all() override {
+        mark();
+        Type::pop_all();
+    }
+
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        mark();
+        return Type::try_emplace(entt, force_back, value, move);
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of cells, as returned by the locator. */
+    using cell_type = std::pair<std::int32_t, std::int32_t>;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Checks whether a storage is arranged by cell.
+     * @return True if the storage is arranged by cell, false otherwise.
+     */
+    [[nodiscard]] bool arranged() const ENTT_NOEXCEPT {
+        return !changes && !(grid.empty() && Type::size());
+    }
+
+    /*! @brief Forces the storage to be arranged again on next query. */
+    void invalidate() ENTT_NOEXCEPT {
+        mark();
+    }
+
+    /**
+     * @brief Arranges the storage by cell if required.
+     * @return Number of non-empty cells.
+     */
+    size_type refresh() {
+        if(!arranged()) {
+            arrange();
+        }
+
+        return grid.size();
+    }
+
+    /**
+     * @brief Iterates the instances that belong to a range of cells and
+     * applies the given function object to them.
+     *
+     * The storage is arranged first if required. The range is inclusive on
+     * both ends and the instances are returned cell by cell, row by row.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type, value_type &);
+     * @endcode
+     *
+     * @warning
+     * Creating or destroying instances from within the function object
+     * results in undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param min The cell with the lowest coordinates of the range.
+     * @param max The cell with the highest coordinates of the range.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void query_aabb(const cell_type min, const cell_type max, Func func) {
+        refresh();
+
+        for(auto row = min.second; row <= max.second; ++row) {
+            const auto to = to_key(max.first, row);
+            auto it = std::lower_bound(grid.cbegin(), grid.cend(), to_key(min.first, row), [](const auto &elem, const auto key) { return elem.key < key; });
+
+            for(; it != grid.cend() && !(to < it->key); ++it) {
+                for(auto pos = it->last; pos > it->first; --pos) {
+                    func(Type::data()[pos - 1u], this->rbegin()[pos - 1u]);
+                }
+            }
+
+            if(row == max.second) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        mark();
+        return Type::emplace(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        mark();
+        return Type::patch(entt, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        changes += Type::size() - from;
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        changes += Type::size() - from;
+    }
+
+private:
+    std::vector<range> grid{};
+    size_type changes{};
+    Locator locator{};
+};
+
+} // namespace entt
+
+#endif
@@ -1,23 +1,35 @@
 #ifndef ENTT_ENTITY_STORAGE_HPP
 #define ENTT_ENTITY_STORAGE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/iterator.hpp"
 #include "../core/memory.hpp"
 #include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
 #include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "sigh_storage_mixin.hpp"
 #include "sparse_set.hpp"
+#include "tick_storage_mixin.hpp"
+#include "trace_storage_mixin.hpp"
 
 namespace entt {
 
@@ -34,7 +46,7 @@ class storage_iterator final {
 
     using container_type = std::remove_const_t<Container>;
     using alloc_traits = std::allocator_traits<typename container_type::allocator_type>;
-    using comp_traits = component_traits<typename container_type::value_type>;
+    using comp_traits = component_traits<std::remove_const_t<typename std::pointer_traits<typename container_type::value_type>::element_type>>;
 
     using iterator_traits = std::iterator_traits<std::conditional_t<
         std::is_const_v<Container>,
@@ -160,7 +172,7 @@ class extended_storage_iterator final {
 
 public:
     using difference_type = typename std::iterator_traits<It>::difference_type;
-    using value_type = decltype(std::tuple_cat(std::make_tuple(*std::declval<It>()), std::forward_as_tuple(*std::declval<Other>()...)));
+    using value_type = decltype(std::tuple_cat(std::make_tuple(*std::declval<It>()), std::declval<std::tuple<decltype(*std::declval<Other>())...>>()));
     using pointer = input_iterator_pointer<value_type>;
     using reference = value_type;
     using iterator_category = std::input_iterator_tag;
@@ -183,6 +195,10 @@ public:
         return ++(*this), orig;
     }
 
+    extended_storage_iterator &operator+=(const difference_type value) ENTT_NOEXCEPT {
+        return (std::get<It>(it) += value), ((std::get<Other>(it) += value), ...), *this;
+    }
+
     [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
         return operator*();
     }
@@ -208,160 +224,3007 @@ template<typename... CLhs, typename... CRhs>
     return !(lhs == rhs);
 }
 
-} // namespace internal
+template<typename Entity, typename Page, std::size_t PageSize>
+class storage_chunk_iterator final {
+    template<typename, typename, std::size_t>
+    friend class storage_chunk_iterator;
 
-/**
- * Internal details not to be documented.
- * @endcond
- */
+public:
+    using value_type = std::tuple<const Entity *, Page, std::size_t>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
 
-/**
- * @brief Basic storage implementation.
- *
- * Internal data structures arrange elements to maximize performance. There are
- * no guarantees that objects are returned in the insertion order when iterate
- * a storage. Do not make assumption on the order in any case.
- *
- * @warning
- * Empty types aren't explicitly instantiated. Therefore, many of the functions
- * normally available for non-empty types will not be available for empty ones.
- *
- * @tparam Entity A valid entity type (see entt_traits for more details).
- * @tparam Type Type of objects assigned to the entities.
- * @tparam Allocator Type of allocator used to manage memory and elements.
- */
-template<typename Entity, typename Type, typename Allocator, typename>
-class basic_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
-    static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The type must be at least move constructible/assignable");
+    storage_chunk_iterator() ENTT_NOEXCEPT = default;
+
+    storage_chunk_iterator(const Entity *entt, const Page *page, const std::size_t sz, const difference_type idx) ENTT_NOEXCEPT
+        : entities{entt},
+          pages{page},
+          length{sz},
+          offset{idx} {}
+
+    template<typename Other, typename = std::enable_if_t<!std::is_same_v<Page, Other> && std::is_convertible_v<Other, Page>>>
+    storage_chunk_iterator(const storage_chunk_iterator<Entity, Other, PageSize> &other) ENTT_NOEXCEPT
+        : entities{other.entities},
+          pages{other.pages},
+          length{other.length},
+          offset{other.offset} {}
+
+    storage_chunk_iterator &operator++() ENTT_NOEXCEPT {
+        return ++offset, *this;
+    }
+
+    storage_chunk_iterator operator++(int) ENTT_NOEXCEPT {
+        storage_chunk_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    storage_chunk_iterator &operator--() ENTT_NOEXCEPT {
+        return --offset, *this;
+    }
+
+    storage_chunk_iterator operator--(int) ENTT_NOEXCEPT {
+        storage_chunk_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    storage_chunk_iterator &operator+=(const difference_type value) ENTT_NOEXCEPT {
+        offset += value;
+        return *this;
+    }
+
+    storage_chunk_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+        storage_chunk_iterator copy = *this;
+        return (copy += value);
+    }
+
+    storage_chunk_iterator &operator-=(const difference_type value) ENTT_NOEXCEPT {
+        return (*this += -value);
+    }
+
+    storage_chunk_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+        const auto pos = static_cast<std::size_t>(offset + value);
+        const auto from = pos * PageSize;
+        return {entities + from, pages[pos], (std::min)(PageSize, length - from)};
+    }
+
+    [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+        return operator[](0);
+    }
+
+    [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
+        return operator*();
+    }
+
+    [[nodiscard]] difference_type index() const ENTT_NOEXCEPT {
+        return offset;
+    }
+
+private:
+    const Entity *entities{};
+    const Page *pages{};
+    std::size_t length{};
+    difference_type offset{};
+};
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] std::ptrdiff_t operator-(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() - rhs.index();
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator==(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() == rhs.index();
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator!=(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return !(lhs == rhs);
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator<(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() < rhs.index();
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator>(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return rhs < lhs;
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator<=(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return !(lhs > rhs);
+}
+
+template<typename Entity, typename PLhs, typename PRhs, std::size_t PageSize>
+[[nodiscard]] bool operator>=(const storage_chunk_iterator<Entity, PLhs, PageSize> &lhs, const storage_chunk_iterator<Entity, PRhs, PageSize> &rhs) ENTT_NOEXCEPT {
+    return !(lhs < rhs);
+}
+
+template<typename>
+struct soa_member;
+
+template<typename Class, typename Member>
+struct soa_member<Member Class::*> {
+    using type = Member;
+};
+
+template<auto Member>
+using soa_member_t = typename soa_member<decltype(Member)>::type;
 
+template<typename Type, typename Allocator, typename = typename component_traits<Type>::soa_members>
+class soa_pages;
+
+template<typename Type, typename Allocator, auto... Member>
+class soa_pages<Type, Allocator, value_list<Member...>> {
     using alloc_traits = std::allocator_traits<Allocator>;
-    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
-    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
-    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
     using comp_traits = component_traits<Type>;
 
-    [[nodiscard]] auto &element_at(const std::size_t pos) const {
-        return packed.first()[pos / comp_traits::page_size][fast_mod(pos, comp_traits::page_size)];
+    template<auto Candidate>
+    using member_alloc_traits = typename alloc_traits::template rebind_traits<soa_member_t<Candidate>>;
+
+    template<auto Candidate>
+    using container_type = std::vector<typename member_alloc_traits<Candidate>::pointer, typename alloc_traits::template rebind_alloc<typename member_alloc_traits<Candidate>::pointer>>;
+
+    template<auto Candidate, std::size_t... Index>
+    [[nodiscard]] static constexpr std::size_t index_of(std::index_sequence<Index...>) ENTT_NOEXCEPT {
+        static_assert((std::is_same_v<value_list<Candidate>, value_list<Member>> + ...) == 1u, "Invalid data member");
+        return ((std::is_same_v<value_list<Candidate>, value_list<Member>> * Index) + ...);
     }
 
-    auto assure_at_least(const std::size_t pos) {
-        auto &&container = packed.first();
-        const auto idx = pos / comp_traits::page_size;
+    template<auto Candidate>
+    [[nodiscard]] const auto &container() const ENTT_NOEXCEPT {
+        return std::get<index_of<Candidate>(std::index_sequence_for<decltype(Member)...>{})>(packed.first());
+    }
 
-        if(!(idx < container.size())) {
-            auto curr = container.size();
-            container.resize(idx + 1u, nullptr);
+    template<auto Candidate>
+    [[nodiscard]] auto &container() ENTT_NOEXCEPT {
+        return std::get<index_of<Candidate>(std::index_sequence_for<decltype(Member)...>{})>(packed.first());
+    }
+
+    template<auto Candidate>
+    void assure_page(const std::size_t idx) {
+        if(auto &&elem = container<Candidate>(); !(idx < elem.size())) {
+            typename member_alloc_traits<Candidate>::allocator_type allocator{packed.second()};
+            auto curr = elem.size();
+            elem.resize(idx + 1u, nullptr);
 
             ENTT_TRY {
-                for(const auto last = container.size(); curr < last; ++curr) {
-                    container[curr] = alloc_traits::allocate(packed.second(), comp_traits::page_size);
+                for(const auto last = elem.size(); curr < last; ++curr) {
+                    elem[curr] = member_alloc_traits<Candidate>::allocate(allocator, comp_traits::page_size);
                 }
             }
             ENTT_CATCH {
-                container.resize(curr);
+                elem.resize(curr);
                 ENTT_THROW;
             }
         }
+    }
 
-        return container[idx] + fast_mod(pos, comp_traits::page_size);
+    template<auto Candidate>
+    void release_pages(const std::size_t from) {
+        typename member_alloc_traits<Candidate>::allocator_type allocator{packed.second()};
+        auto &&elem = container<Candidate>();
+
+        for(auto pos = from, last = elem.size(); pos < last; ++pos) {
+            member_alloc_traits<Candidate>::deallocate(allocator, elem[pos], comp_traits::page_size);
+        }
+
+        elem.resize(from);
     }
 
-    template<typename... Args>
-    auto emplace_element(const Entity entt, const bool force_back, Args &&...args) {
-        const auto it = base_type::try_emplace(entt, force_back);
+    template<auto Candidate, typename Arg>
+    void construct_member(const std::size_t pos, Arg &&arg) {
+        typename member_alloc_traits<Candidate>::allocator_type allocator{packed.second()};
+        entt::uninitialized_construct_using_allocator(std::addressof(element_at<Candidate>(pos)), allocator, std::forward<Arg>(arg));
+    }
+
+    template<auto Candidate>
+    void replace_member(const std::size_t to, const std::size_t from) {
+        auto &elem = element_at<Candidate>(from);
+        // destroying on exit allows reentrant destructors
+        [[maybe_unused]] auto unused = std::exchange(element_at<Candidate>(to), std::move(elem));
+        std::destroy_at(std::addressof(elem));
+    }
+
+public:
+    using value_type = Type;
+    using size_type = std::size_t;
+
+    soa_pages(const Allocator &allocator)
+        : packed{std::tuple<container_type<Member>...>{container_type<Member>{allocator}...}, allocator} {}
+
+    soa_pages(soa_pages &&other) ENTT_NOEXCEPT = default;
+
+    soa_pages(soa_pages &&other, const Allocator &allocator) ENTT_NOEXCEPT
+        : packed{std::tuple<container_type<Member>...>{container_type<Member>{std::move(other.template container<Member>()), allocator}...}, allocator} {}
+
+    soa_pages &operator=(soa_pages &&other) ENTT_NOEXCEPT {
+        packed.first() = std::move(other.packed.first());
+        propagate_on_container_move_assignment(packed.second(), other.packed.second());
+        return *this;
+    }
+
+    void swap(soa_pages &other) {
+        using std::swap;
+        propagate_on_container_swap(packed.second(), other.packed.second());
+        swap(packed.first(), other.packed.first());
+    }
+
+    [[nodiscard]] const Allocator &allocator() const ENTT_NOEXCEPT {
+        return packed.second();
+    }
+
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return std::get<0>(packed.first()).size() * comp_traits::page_size;
+    }
+
+    [[nodiscard]] size_type footprint() const ENTT_NOEXCEPT {
+        return ((container<Member>().capacity() * sizeof(typename container_type<Member>::value_type) + container<Member>().size() * comp_traits::page_size * sizeof(soa_member_t<Member>)) + ...);
+    }
+
+    template<auto Candidate>
+    [[nodiscard]] auto raw() const ENTT_NOEXCEPT {
+        return container<Candidate>().data();
+    }
+
+    template<auto Candidate>
+    [[nodiscard]] auto &element_at(const std::size_t pos) const ENTT_NOEXCEPT {
+        return container<Candidate>()[pos / comp_traits::page_size][fast_mod(pos, comp_traits::page_size)];
+    }
+
+    void assure_at_least(const std::size_t pos) {
+        const auto idx = pos / comp_traits::page_size;
+        (assure_page<Member>(idx), ...);
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        const auto from = (sz + comp_traits::page_size - 1u) / comp_traits::page_size;
+        (release_pages<Member>(from), ...);
+    }
+
+    template<typename Arg>
+    void construct(const std::size_t pos, Arg &&value) {
+        std::size_t count{};
 
         ENTT_TRY {
-            auto elem = assure_at_least(static_cast<size_type>(it.index()));
-            entt::uninitialized_construct_using_allocator(to_address(elem), packed.second(), std::forward<Args>(args)...);
+            ((construct_member<Member>(pos, std::forward<Arg>(value).*Member), ++count), ...);
         }
         ENTT_CATCH {
-            if constexpr(comp_traits::in_place_delete) {
-                base_type::in_place_pop(it, it + 1u);
-            } else {
-                base_type::swap_and_pop(it, it + 1u);
-            }
-
+            std::size_t curr{};
+            ((curr++ < count ? std::destroy_at(std::addressof(element_at<Member>(pos))) : void()), ...);
             ENTT_THROW;
         }
+    }
 
-        return it;
+    void destroy(const std::size_t pos) {
+        (std::destroy_at(std::addressof(element_at<Member>(pos))), ...);
     }
 
-    void shrink_to_size(const std::size_t sz) {
-        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
-            if constexpr(comp_traits::in_place_delete) {
-                if(base_type::at(pos) != tombstone) {
-                    std::destroy_at(std::addressof(element_at(pos)));
-                }
-            } else {
-                std::destroy_at(std::addressof(element_at(pos)));
-            }
-        }
+    [[nodiscard]] value_type get(const std::size_t pos) const {
+        return value_type{element_at<Member>(pos)...};
+    }
 
-        auto &&container = packed.first();
-        auto page_allocator{packed.second()};
-        const auto from = (sz + comp_traits::page_size - 1u) / comp_traits::page_size;
+    template<typename Arg>
+    void assign(const std::size_t pos, Arg &&value) {
+        ((element_at<Member>(pos) = std::forward<Arg>(value).*Member), ...);
+    }
 
-        for(auto pos = from, last = container.size(); pos < last; ++pos) {
-            alloc_traits::deallocate(page_allocator, container[pos], comp_traits::page_size);
-        }
+    void move(const std::size_t from, const std::size_t to) {
+        construct(to, get(from));
+        destroy(from);
+    }
 
-        container.resize(from);
+    void replace(const std::size_t to, const std::size_t from) {
+        (replace_member<Member>(to, from), ...);
+    }
+
+    void swap(const std::size_t lhs, const std::size_t rhs) {
+        using std::swap;
+        (swap(element_at<Member>(lhs), element_at<Member>(rhs)), ...);
     }
 
 private:
-    const void *get_at(const std::size_t pos) const final {
-        return std::addressof(element_at(pos));
+    compressed_pair<std::tuple<container_type<Member>...>, Allocator> packed;
+};
+
+template<typename Pages>
+class soa_reference final {
+    friend soa_reference<const Pages>;
+
+    using value_type = typename std::remove_const_t<Pages>::value_type;
+
+public:
+    soa_reference(Pages *ref, const std::size_t idx) ENTT_NOEXCEPT
+        : pages{ref},
+          pos{idx} {}
+
+    template<bool Const = std::is_const_v<Pages>, typename = std::enable_if_t<Const>>
+    soa_reference(const soa_reference<std::remove_const_t<Pages>> &other) ENTT_NOEXCEPT
+        : pages{other.pages},
+          pos{other.pos} {}
+
+    soa_reference(const soa_reference &) ENTT_NOEXCEPT = default;
+
+    soa_reference &operator=(const soa_reference &other) {
+        return (*this = static_cast<value_type>(other));
     }
 
-    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
-        using std::swap;
-        swap(element_at(lhs), element_at(rhs));
+    soa_reference &operator=(const value_type &value) {
+        pages->assign(pos, value);
+        return *this;
     }
 
-    void move_element(const std::size_t from, const std::size_t to) final {
-        auto &elem = element_at(from);
-        entt::uninitialized_construct_using_allocator(to_address(assure_at_least(to)), packed.second(), std::move(elem));
-        std::destroy_at(std::addressof(elem));
+    soa_reference &operator=(value_type &&value) {
+        pages->assign(pos, std::move(value));
+        return *this;
     }
 
-protected:
-    /**
-     * @brief Erases elements from a storage.
-     * @param first An iterator to the first element to erase.
-     * @param last An iterator past the last element to erase.
-     */
-    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
-        for(; first != last; ++first) {
-            auto &elem = element_at(base_type::size() - 1u);
-            // destroying on exit allows reentrant destructors
-            [[maybe_unused]] auto unused = std::exchange(element_at(static_cast<size_type>(first.index())), std::move(elem));
-            std::destroy_at(std::addressof(elem));
-            base_type::swap_and_pop(first, first + 1u);
-        }
+    template<auto Member>
+    [[nodiscard]] constness_as_t<soa_member_t<Member>, Pages> &get() const ENTT_NOEXCEPT {
+        return pages->template element_at<Member>(pos);
+    }
+
+    [[nodiscard]] operator value_type() const {
+        return pages->get(pos);
+    }
+
+private:
+    Pages *pages;
+    std::size_t pos;
+};
+
+template<typename Pages>
+class soa_storage_iterator final {
+    friend soa_storage_iterator<const Pages>;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename std::remove_const_t<Pages>::value_type;
+    using reference = soa_reference<Pages>;
+    using pointer = input_iterator_pointer<reference>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    soa_storage_iterator() ENTT_NOEXCEPT = default;
+
+    soa_storage_iterator(Pages *ref, difference_type idx) ENTT_NOEXCEPT
+        : pages{ref},
+          offset{idx} {}
+
+    template<bool Const = std::is_const_v<Pages>, typename = std::enable_if_t<Const>>
+    soa_storage_iterator(const soa_storage_iterator<std::remove_const_t<Pages>> &other) ENTT_NOEXCEPT
+        : pages{other.pages},
+          offset{other.offset} {}
+
+    soa_storage_iterator &operator++() ENTT_NOEXCEPT {
+        return --offset, *this;
+    }
+
+    soa_storage_iterator operator++(int) ENTT_NOEXCEPT {
+        soa_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    soa_storage_iterator &operator--() ENTT_NOEXCEPT {
+        return ++offset, *this;
     }
 
+    soa_storage_iterator operator--(int) ENTT_NOEXCEPT {
+        soa_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    soa_storage_iterator &operator+=(const difference_type value) ENTT_NOEXCEPT {
+        offset -= value;
+        return *this;
+    }
+
+    soa_storage_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+        soa_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    soa_storage_iterator &operator-=(const difference_type value) ENTT_NOEXCEPT {
+        return (*this += -value);
+    }
+
+    soa_storage_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+        return {pages, static_cast<std::size_t>(index() - value)};
+    }
+
+    [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
+        return operator*();
+    }
+
+    [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+        return operator[](0);
+    }
+
+    [[nodiscard]] difference_type index() const ENTT_NOEXCEPT {
+        return offset - 1;
+    }
+
+private:
+    Pages *pages{};
+    difference_type offset{};
+};
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] std::ptrdiff_t operator-(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return rhs.index() - lhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator==(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() == rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator!=(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs == rhs);
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator<(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() > rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator>(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() < rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator<=(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs > rhs);
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator>=(const soa_storage_iterator<PLhs> &lhs, const soa_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs < rhs);
+}
+
+template<typename Type, typename Allocator>
+class shared_pages {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using comp_traits = component_traits<Type>;
+    using index_type = std::uint32_t;
+
+    struct slot_type {
+        std::size_t hash{};
+        std::size_t count{};
+        index_type next{};
+    };
+
+    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    using index_container_type = std::vector<index_type, typename alloc_traits::template rebind_alloc<index_type>>;
+    using slot_container_type = std::vector<slot_type, typename alloc_traits::template rebind_alloc<slot_type>>;
+    using lookup_type = dense_map<std::size_t, index_type, identity, std::equal_to<std::size_t>, typename alloc_traits::template rebind_alloc<std::pair<const std::size_t, index_type>>>;
+
+    static constexpr auto null_slot = (std::numeric_limits<index_type>::max)();
+
+    [[nodiscard]] auto &element_at(const std::size_t idx) const ENTT_NOEXCEPT {
+        return pages.first()[idx / comp_traits::page_size][fast_mod(idx, comp_traits::page_size)];
+    }
+
+    template<typename Arg>
+    [[nodiscard]] index_type acquire(Arg &&value) {
+        const auto hash = std::hash<Type>{}(value);
+        const auto it = lookup.find(hash);
+        const auto head = (it == lookup.end()) ? null_slot : it->second;
+
+        for(auto curr = head; curr != null_slot; curr = slots[curr].next) {
+            if(element_at(curr) == value) {
+                ++slots[curr].count;
+                return curr;
+            }
+        }
+
+        if(free_list == null_slot) {
+            ENTT_ASSERT(slots.size() < null_slot, "No more shared instances available");
+            const auto idx = slots.size();
+
+            if(const auto page = idx / comp_traits::page_size; !(page < pages.first().size())) {
+                pages.first().push_back(nullptr);
+                pages.first().back() = alloc_traits::allocate(pages.second(), comp_traits::page_size);
+            }
+
+            slots.emplace_back().next = std::exchange(free_list, static_cast<index_type>(idx));
+        }
+
+        // the slot stays in the free list until the instance is fully linked
+        const auto idx = free_list;
+        entt::uninitialized_construct_using_allocator(std::addressof(element_at(idx)), pages.second(), std::forward<Arg>(value));
+
+        ENTT_TRY {
+            lookup.insert_or_assign(hash, idx);
+        }
+        ENTT_CATCH {
+            std::destroy_at(std::addressof(element_at(idx)));
+            ENTT_THROW;
+        }
+
+        free_list = std::exchange(slots[idx], slot_type{hash, 1u, head}).next;
+        ++instances;
+        return idx;
+    }
+
+    void release(const index_type idx) {
+        if(auto &slot = slots[idx]; --slot.count == 0u) {
+            if(const auto it = lookup.find(slot.hash); it->second == idx) {
+                slot.next == null_slot ? void(lookup.erase(it)) : void(it->second = slot.next);
+            } else {
+                auto prev = it->second;
+
+                while(slots[prev].next != idx) {
+                    prev = slots[prev].next;
+                }
+
+                slots[prev].next = slot.next;
+            }
+
+            slot.next = std::exchange(free_list, idx);
+            --instances;
+            std::destroy_at(std::addressof(element_at(idx)));
+        }
+    }
+
+    void release_all() {
+        for(std::size_t idx{}, last = slots.size(); idx < last; ++idx) {
+            if(slots[idx].count != 0u) {
+                std::destroy_at(std::addressof(element_at(idx)));
+            }
+        }
+
+        for(auto &&page: pages.first()) {
+            alloc_traits::deallocate(pages.second(), page, comp_traits::page_size);
+        }
+
+        pages.first().clear();
+        slots.clear();
+        lookup.clear();
+        free_list = null_slot;
+        instances = {};
+    }
+
+public:
+    using value_type = Type;
+    using size_type = std::size_t;
+
+    shared_pages(const Allocator &allocator)
+        : pages{allocator, allocator},
+          refs{allocator},
+          slots{allocator},
+          lookup{allocator} {}
+
+    shared_pages(shared_pages &&other) ENTT_NOEXCEPT
+        : pages{std::move(other.pages)},
+          refs{std::move(other.refs)},
+          slots{std::move(other.slots)},
+          lookup{std::move(other.lookup)},
+          free_list{std::exchange(other.free_list, null_slot)},
+          instances{std::exchange(other.instances, size_type{})} {}
+
+    shared_pages(shared_pages &&other, const Allocator &allocator) ENTT_NOEXCEPT
+        : pages{container_type{std::move(other.pages.first()), allocator}, allocator},
+          refs{std::move(other.refs), allocator},
+          slots{std::move(other.slots), allocator},
+          lookup{std::move(other.lookup), allocator},
+          free_list{std::exchange(other.free_list, null_slot)},
+          instances{std::exchange(other.instances, size_type{})} {}
+
+    ~shared_pages() {
+        release_all();
+    }
+
+    shared_pages &operator=(shared_pages &&other) ENTT_NOEXCEPT {
+        release_all();
+        pages.first() = std::move(other.pages.first());
+        propagate_on_container_move_assignment(pages.second(), other.pages.second());
+        refs = std::move(other.refs);
+        slots = std::move(other.slots);
+        lookup = std::move(other.lookup);
+        free_list = std::exchange(other.free_list, null_slot);
+        instances = std::exchange(other.instances, size_type{});
+        return *this;
+    }
+
+    void swap(shared_pages &other) {
+        using std::swap;
+        propagate_on_container_swap(pages.second(), other.pages.second());
+        swap(pages.first(), other.pages.first());
+        swap(refs, other.refs);
+        swap(slots, other.slots);
+        swap(lookup, other.lookup);
+        swap(free_list, other.free_list);
+        swap(instances, other.instances);
+    }
+
+    [[nodiscard]] const Allocator &allocator() const ENTT_NOEXCEPT {
+        return pages.second();
+    }
+
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return refs.capacity();
+    }
+
+    [[nodiscard]] size_type distinct() const ENTT_NOEXCEPT {
+        return instances;
+    }
+
+    [[nodiscard]] size_type footprint() const ENTT_NOEXCEPT {
+        return refs.capacity() * sizeof(index_type) + slots.capacity() * sizeof(slot_type) + pages.first().capacity() * sizeof(typename container_type::value_type) + pages.first().size() * comp_traits::page_size * sizeof(Type);
+    }
+
+    [[nodiscard]] const value_type &operator[](const std::size_t pos) const ENTT_NOEXCEPT {
+        return element_at(refs[pos]);
+    }
+
+    void reserve(const std::size_t cap) {
+        refs.reserve(cap);
+    }
+
+    void shrink_to_fit() {
+        refs.shrink_to_fit();
+
+        if(refs.empty()) {
+            release_all();
+        }
+    }
+
+    template<typename Arg>
+    void push_back(Arg &&value) {
+        const auto idx = acquire(std::forward<Arg>(value));
+
+        ENTT_TRY {
+            refs.push_back(idx);
+        }
+        ENTT_CATCH {
+            release(idx);
+            ENTT_THROW;
+        }
+    }
+
+    template<typename Arg>
+    void assign(const std::size_t pos, Arg &&value) {
+        release(std::exchange(refs[pos], acquire(std::forward<Arg>(value))));
+    }
+
+    void pop(const std::size_t pos) {
+        release(std::exchange(refs[pos], refs.back()));
+        refs.pop_back();
+    }
+
+    void clear() {
+        refs.clear();
+        release_all();
+    }
+
+    void swap(const std::size_t lhs, const std::size_t rhs) {
+        std::swap(refs[lhs], refs[rhs]);
+    }
+
+private:
+    compressed_pair<container_type, Allocator> pages;
+    index_container_type refs;
+    slot_container_type slots;
+    lookup_type lookup;
+    index_type free_list{null_slot};
+    size_type instances{};
+};
+
+template<typename Pages>
+class shared_storage_iterator final {
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename Pages::value_type;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+    using iterator_category = std::random_access_iterator_tag;
+
+    shared_storage_iterator() ENTT_NOEXCEPT = default;
+
+    shared_storage_iterator(const Pages *ref, difference_type idx) ENTT_NOEXCEPT
+        : pages{ref},
+          offset{idx} {}
+
+    shared_storage_iterator &operator++() ENTT_NOEXCEPT {
+        return --offset, *this;
+    }
+
+    shared_storage_iterator operator++(int) ENTT_NOEXCEPT {
+        shared_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    shared_storage_iterator &operator--() ENTT_NOEXCEPT {
+        return ++offset, *this;
+    }
+
+    shared_storage_iterator operator--(int) ENTT_NOEXCEPT {
+        shared_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    shared_storage_iterator &operator+=(const difference_type value) ENTT_NOEXCEPT {
+        offset -= value;
+        return *this;
+    }
+
+    shared_storage_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+        shared_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    shared_storage_iterator &operator-=(const difference_type value) ENTT_NOEXCEPT {
+        return (*this += -value);
+    }
+
+    shared_storage_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+        return (*pages)[static_cast<std::size_t>(index() - value)];
+    }
+
+    [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
+        return std::addressof(operator[](0));
+    }
+
+    [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+        return operator[](0);
+    }
+
+    [[nodiscard]] difference_type index() const ENTT_NOEXCEPT {
+        return offset - 1;
+    }
+
+private:
+    const Pages *pages{};
+    difference_type offset{};
+};
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] std::ptrdiff_t operator-(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return rhs.index() - lhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator==(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() == rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator!=(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs == rhs);
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator<(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() > rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator>(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.index() < rhs.index();
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator<=(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs > rhs);
+}
+
+template<typename PLhs, typename PRhs>
+[[nodiscard]] bool operator>=(const shared_storage_iterator<PLhs> &lhs, const shared_storage_iterator<PRhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs < rhs);
+}
+
+template<typename Exec, typename Task>
+void dispatch_pages(Exec &executor, const std::size_t page, const std::size_t count, const Task &task) {
+    if constexpr(std::is_invocable_v<Exec &, std::size_t, const Task &, std::size_t>) {
+        executor(count, task, page);
+    } else {
+        executor(count, task);
+    }
+}
+
+template<typename Entity, typename Type, typename Allocator>
+struct frozen_pages {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    using entity_container_type = std::vector<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using flag_container_type = std::vector<bool, typename alloc_traits::template rebind_alloc<bool>>;
+
+    frozen_pages(const Allocator &allocator)
+        : pages{allocator},
+          entities{allocator},
+          shared{allocator},
+          released{},
+          page_allocator{allocator} {}
+
+    frozen_pages(const frozen_pages &) = delete;
+    frozen_pages &operator=(const frozen_pages &) = delete;
+
+    ~frozen_pages() {
+        constexpr auto page_size = component_traits<Type>::page_size;
+
+        // pages still shared belong to the storage, all the others were left to the frame
+        for(std::size_t idx{}, last = pages.size(); idx < last; ++idx) {
+            if(!shared[idx]) {
+                for(auto pos = idx * page_size, end = (std::min)(entities.size(), pos + page_size); pos < end; ++pos) {
+                    if(entities[pos] != tombstone) {
+                        std::destroy_at(to_address(pages[idx]) + (pos - idx * page_size));
+                    }
+                }
+
+                alloc_traits::deallocate(page_allocator, pages[idx], page_size);
+            }
+        }
+    }
+
+    container_type pages;
+    entity_container_type entities;
+    flag_container_type shared;
+    std::size_t pending{};
+    std::atomic<bool> released;
+    Allocator page_allocator;
+};
+
+[[nodiscard]] inline std::size_t storage_first_bit(std::uint64_t value) ENTT_NOEXCEPT {
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+    std::size_t count{};
+    for(; !(value & 1u); value >>= 1u, ++count) {}
+    return count;
+#endif
+}
+
+template<typename Type>
+[[nodiscard]] constexpr sparse_policy sparse_policy_of() ENTT_NOEXCEPT {
+    static_assert(!(hashed_index_v<Type> && compact_index_v<Type>), "Hashed and compact indexes are mutually exclusive");
+
+    if constexpr(compact_index_v<Type>) {
+        return sparse_policy::compact;
+    } else {
+        return sparse_policy{hashed_index_v<Type>};
+    }
+}
+
+template<typename Type>
+[[nodiscard]] constexpr deletion_policy deletion_policy_of() ENTT_NOEXCEPT {
+    if constexpr(pinned_v<Type>) {
+        return deletion_policy::pinned;
+    } else {
+        return deletion_policy{component_traits<Type>::in_place_delete};
+    }
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Read-only frame of a storage that uses copy-on-write pages.
+ *
+ * A frozen storage shares its pages with the storage it comes from. The latter
+ * clones a page the first time it writes to it after a freeze, so that the
+ * content of a frozen storage never changes. Therefore, a frozen storage can be
+ * iterated from a thread while the original storage is modified from another
+ * thread without any synchronization.<br/>
+ * The original storage stops cloning pages as soon as the frozen storage is
+ * released or destroyed.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Type, typename Allocator>
+class basic_frozen_storage final {
+    using frame_type = internal::frozen_pages<Entity, Type, Allocator>;
+    using container_type = typename frame_type::container_type;
+    using entity_iterator = internal::sparse_set_iterator<typename frame_type::entity_container_type>;
+
+public:
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::storage_iterator<const container_type>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<entity_iterator, const_iterator>>;
+
+    /*! @brief Default constructor. */
+    basic_frozen_storage() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs a frozen storage from the frame of a storage.
+     * @param ref The frame shared with the original storage.
+     */
+    explicit basic_frozen_storage(std::shared_ptr<frame_type> ref) ENTT_NOEXCEPT
+        : frame{std::move(ref)} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_frozen_storage(const basic_frozen_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_frozen_storage(basic_frozen_storage &&other) ENTT_NOEXCEPT
+        : frame{std::move(other.frame)} {}
+
+    /*! @brief Releases the frame, if any. */
+    ~basic_frozen_storage() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This frozen storage.
+     */
+    basic_frozen_storage &operator=(const basic_frozen_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This frozen storage.
+     */
+    basic_frozen_storage &operator=(basic_frozen_storage &&other) ENTT_NOEXCEPT {
+        release();
+        frame = std::move(other.frame);
+        return *this;
+    }
+
+    /**
+     * @brief Releases the frame and lets the original storage stop cloning
+     * pages.
+     */
+    void release() ENTT_NOEXCEPT {
+        if(frame) {
+            frame->released.store(true, std::memory_order_release);
+            frame.reset();
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements in a frozen storage.
+     * @return Number of elements.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return frame ? frame->entities.size() : size_type{};
+    }
+
+    /**
+     * @brief Checks whether a frozen storage is empty.
+     * @return True if the frozen storage is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !size();
+    }
+
+    /**
+     * @brief Direct access to the array of entities.
+     * @return A pointer to the array of entities.
+     */
+    [[nodiscard]] const entity_type *data() const ENTT_NOEXCEPT {
+        return frame ? frame->entities.data() : nullptr;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return frame ? const_iterator{&frame->pages, static_cast<typename const_iterator::difference_type>(size())} : const_iterator{};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return frame ? const_iterator{&frame->pages, {}} : const_iterator{};
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a frozen storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a reference to its component.
+     *
+     * @return An iterable object to use to _visit_ the frozen storage.
+     */
+    [[nodiscard]] const_iterable each() const ENTT_NOEXCEPT {
+        if(frame) {
+            const auto length = static_cast<typename entity_iterator::difference_type>(size());
+            return {internal::extended_storage_iterator{entity_iterator{frame->entities, length}, begin()}, internal::extended_storage_iterator{entity_iterator{frame->entities, {}}, end()}};
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Checks if a frozen storage refers to a frame.
+     * @return True if the frozen storage refers to a frame, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return static_cast<bool>(frame);
+    }
+
+private:
+    std::shared_ptr<frame_type> frame;
+};
+
+/**
+ * @brief Basic storage implementation.
+ *
+ * Internal data structures arrange elements to maximize performance. There are
+ * no guarantees that objects are returned in the insertion order when iterate
+ * a storage. Do not make assumption on the order in any case.
+ *
+ * @warning
+ * Empty types aren't explicitly instantiated. Therefore, many of the functions
+ * normally available for non-empty types will not be available for empty ones.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Type, typename Allocator, typename>
+class basic_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The type must be at least move constructible/assignable");
+    static_assert(!copy_on_write_v<Type> || std::is_copy_constructible_v<Type>, "Copy-on-write pages require copy constructible types");
+    static_assert(!pinned_v<Type> || (component_traits<Type>::in_place_delete && !copy_on_write_v<Type>), "Pinned elements require in-place delete and cannot be copied on write");
+    static_assert(page_alignment_v<Type> == 0u || (component_traits<Type>::page_size * sizeof(Type)) % page_alignment_v<Type> == 0u, "Page size must be a multiple of the page alignment");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    using dirty_container_type = std::vector<bool, typename alloc_traits::template rebind_alloc<bool>>;
+    using frame_type = internal::frozen_pages<Entity, Type, Allocator>;
+    using comp_traits = component_traits<Type>;
+
+    [[nodiscard]] auto &element_at(const std::size_t pos) const {
+        return packed.first()[pos / comp_traits::page_size][fast_mod(pos, comp_traits::page_size)];
+    }
+
+    auto assure_at_least(const std::size_t pos) {
+        auto &&container = packed.first();
+        const auto idx = pos / comp_traits::page_size;
+
+        if(!(idx < container.size())) {
+            if constexpr(dirty_pages_v<Type>) {
+                // pages never uploaded are dirty, marking them later doesn't allocate
+                touched.resize(idx + 1u, true);
+            }
+
+            auto curr = container.size();
+            container.resize(idx + 1u, nullptr);
+
+            ENTT_TRY {
+                for(const auto last = container.size(); curr < last; ++curr) {
+                    container[curr] = alloc_traits::allocate(packed.second(), comp_traits::page_size);
+                    ENTT_ASSERT(!page_alignment_v<Type> || (reinterpret_cast<std::uintptr_t>(to_address(container[curr])) % page_alignment_v<Type>) == 0u, "Misaligned page, allocator not suitable");
+                }
+            }
+            ENTT_CATCH {
+                container.resize(curr);
+                ENTT_THROW;
+            }
+        }
+
+        return container[idx] + fast_mod(pos, comp_traits::page_size);
+    }
+
+    void mark_pages([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) ENTT_NOEXCEPT {
+        if constexpr(dirty_pages_v<Type>) {
+            for(auto idx = from / comp_traits::page_size, last = (to + comp_traits::page_size - 1u) / comp_traits::page_size; idx < last; ++idx) {
+                touched[idx] = true;
+            }
+        }
+    }
+
+    template<typename... Args>
+    auto emplace_element(const Entity entt, const bool force_back, Args &&...args) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            unshare(static_cast<size_type>(it.index()), true);
+            auto elem = assure_at_least(static_cast<size_type>(it.index()));
+            entt::uninitialized_construct_using_allocator(to_address(elem), packed.second(), std::forward<Args>(args)...);
+            mark_pages(static_cast<size_type>(it.index()), static_cast<size_type>(it.index()) + 1u);
+        }
+        ENTT_CATCH {
+            if constexpr(comp_traits::in_place_delete) {
+                base_type::in_place_pop(it, it + 1u);
+            } else {
+                base_type::swap_and_pop(it, it + 1u);
+            }
+
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    template<typename It, typename Func>
+    void fill_elements(It first, It last, Func fill) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            // geometric growth, repeated batches must not reallocate every time
+            if(const auto required = base_type::size() + static_cast<size_type>(std::distance(first, last)); required > base_type::capacity()) {
+                basic_storage::reserve((std::max)(required, base_type::capacity() * 2u));
+            }
+        }
+
+        // elements are filled one page at a time, trivially copyable types don't need constructors
+        for(auto pos = base_type::size(); first != last; pos = base_type::size()) {
+            unshare(pos);
+            auto elem = assure_at_least(pos);
+
+            ENTT_TRY {
+                for(auto curr = fast_mod(pos, comp_traits::page_size); first != last && curr < comp_traits::page_size; ++first, ++curr) {
+                    base_type::try_emplace(*first, true);
+                }
+            }
+            ENTT_CATCH {
+                fill(to_address(elem), base_type::size() - pos);
+                mark_pages(pos, base_type::size());
+                ENTT_THROW;
+            }
+
+            fill(to_address(elem), base_type::size() - pos);
+            mark_pages(pos, base_type::size());
+        }
+    }
+
+    template<typename It>
+    void copy_elements(It first, It last, const Type *from) {
+        fill_elements(std::move(first), std::move(last), [&from](Type *elem, const size_type count) {
+            std::memcpy(static_cast<void *>(elem), from, count * sizeof(Type));
+            from += count;
+        });
+    }
+
+    void unshare([[maybe_unused]] const std::size_t pos, [[maybe_unused]] const bool skip = false) {
+        if constexpr(copy_on_write_v<Type>) {
+            if(const auto idx = pos / comp_traits::page_size; is_shared(idx)) {
+                const auto first = idx * comp_traits::page_size;
+                const auto last = (std::min)(base_type::size(), first + comp_traits::page_size);
+                const auto live = [this, pos, skip](const auto curr) { return !(skip && curr == pos) && base_type::at(curr) != tombstone; };
+                auto &&container = packed.first();
+                auto page = alloc_traits::allocate(packed.second(), comp_traits::page_size);
+                auto curr = first;
+
+                ENTT_TRY {
+                    for(; curr < last; ++curr) {
+                        if(live(curr)) {
+                            entt::uninitialized_construct_using_allocator(to_address(page) + (curr - first), packed.second(), std::as_const(element_at(curr)));
+                        }
+                    }
+                }
+                ENTT_CATCH {
+                    for(auto elem = first; elem < curr; ++elem) {
+                        if(live(elem)) {
+                            std::destroy_at(to_address(page) + (elem - first));
+                        }
+                    }
+
+                    alloc_traits::deallocate(packed.second(), page, comp_traits::page_size);
+                    ENTT_THROW;
+                }
+
+                // the original page is left untouched to the frame
+                container[idx] = page;
+                leave(idx);
+            }
+        }
+    }
+
+    void unshare_all() {
+        if constexpr(copy_on_write_v<Type>) {
+            for(std::size_t idx{}; frozen && idx < frozen->shared.size(); ++idx) {
+                unshare(idx * comp_traits::page_size);
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_shared(const std::size_t idx) {
+        if(frozen && frozen->released.load(std::memory_order_acquire)) {
+            frozen.reset();
+        }
+
+        return frozen && idx < frozen->shared.size() && frozen->shared[idx];
+    }
+
+    void leave(const std::size_t idx) {
+        frozen->shared[idx] = false;
+
+        if(--frozen->pending == 0u) {
+            frozen.reset();
+        }
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        auto &&container = packed.first();
+        const auto from = (sz + comp_traits::page_size - 1u) / comp_traits::page_size;
+
+        if constexpr(copy_on_write_v<Type>) {
+            if(sz < base_type::size()) {
+                unshare(sz);
+            }
+
+            // shared pages are left to the frame rather than released
+            for(auto idx = from; idx < container.size(); ++idx) {
+                if(is_shared(idx)) {
+                    container[idx] = nullptr;
+                    leave(idx);
+                }
+            }
+        }
+
+        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+            if constexpr(copy_on_write_v<Type>) {
+                if(!container[pos / comp_traits::page_size]) {
+                    continue;
+                }
+            }
+
+            if constexpr(comp_traits::in_place_delete) {
+                if(base_type::at(pos) != tombstone) {
+                    std::destroy_at(std::addressof(element_at(pos)));
+                }
+            } else {
+                std::destroy_at(std::addressof(element_at(pos)));
+            }
+        }
+
+        auto page_allocator{packed.second()};
+
+        for(auto pos = from, last = container.size(); pos < last; ++pos) {
+            if(container[pos]) {
+                alloc_traits::deallocate(page_allocator, container[pos], comp_traits::page_size);
+            }
+        }
+
+        container.resize(from);
+
+        if constexpr(dirty_pages_v<Type>) {
+            touched.resize(from);
+        }
+    }
+
+private:
+    const void *get_at(const std::size_t pos) const final {
+        return std::addressof(element_at(pos));
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        using std::swap;
+        unshare(lhs);
+        unshare(rhs);
+        swap(element_at(lhs), element_at(rhs));
+        mark_pages(lhs, lhs + 1u);
+        mark_pages(rhs, rhs + 1u);
+    }
+
+    void move_element(const std::size_t from, const std::size_t to) final {
+        unshare(from);
+        unshare(to);
+        auto &elem = element_at(from);
+
+        if constexpr(trivially_relocatable_v<Type>) {
+            std::memcpy(static_cast<void *>(to_address(assure_at_least(to))), std::addressof(elem), sizeof(Type));
+        } else {
+            entt::uninitialized_construct_using_allocator(to_address(assure_at_least(to)), packed.second(), std::move(elem));
+            std::destroy_at(std::addressof(elem));
+        }
+
+        mark_pages(to, to + 1u);
+    }
+
+    void relocate_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) {
+        for(; first != last; ++first) {
+            const auto pos = static_cast<size_type>(first.index());
+            unshare(pos);
+            unshare(base_type::size() - 1u);
+
+            auto *hole = std::addressof(element_at(pos));
+            auto *elem = std::addressof(element_at(base_type::size() - 1u));
+            alignas(Type) std::byte buffer[sizeof(Type)];
+
+            // destroying on exit allows reentrant destructors
+            std::memcpy(buffer, static_cast<void *>(hole), sizeof(Type));
+
+            if(hole != elem) {
+                std::memcpy(static_cast<void *>(hole), elem, sizeof(Type));
+            }
+
+            mark_pages(pos, pos + 1u);
+            base_type::swap_and_pop(first, first + 1u);
+            std::destroy_at(std::launder(reinterpret_cast<Type *>(buffer)));
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        if constexpr(trivially_relocatable_v<Type>) {
+            // elements are moved bitwise and never moved-from
+            relocate_and_pop(first, last);
+        } else {
+            for(; first != last; ++first) {
+                unshare(static_cast<size_type>(first.index()));
+                unshare(base_type::size() - 1u);
+                auto &elem = element_at(base_type::size() - 1u);
+                // destroying on exit allows reentrant destructors
+                [[maybe_unused]] auto unused = std::exchange(element_at(static_cast<size_type>(first.index())), std::move(elem));
+                std::destroy_at(std::addressof(elem));
+                mark_pages(static_cast<size_type>(first.index()), static_cast<size_type>(first.index()) + 1u);
+                base_type::swap_and_pop(first, first + 1u);
+            }
+        }
+    }
+
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void in_place_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            unshare(static_cast<size_type>(first.index()));
+            base_type::in_place_pop(first, first + 1u);
+            std::destroy_at(std::addressof(element_at(static_cast<size_type>(first.index()))));
+            mark_pages(static_cast<size_type>(first.index()), static_cast<size_type>(first.index()) + 1u);
+        }
+    }
+
+    /**
+     * @brief Erases a batch of elements from a storage.
+     * @param first A pointer to the first entity to erase.
+     * @param last A pointer past the last entity to erase.
+     */
+    void pop_n(const Entity *first, const Entity *last) override {
+        for(; first != last; ++first) {
+            const auto it = --(base_type::end() - base_type::index(*first));
+            (base_type::policy() != deletion_policy::swap_and_pop) ? basic_storage::in_place_pop(it, it + 1u) : basic_storage::swap_and_pop(it, it + 1u);
+        }
+    }
+
+    /*! @brief Erases all elements from a storage at once. */
+    void pop_all() override {
+        if constexpr(copy_on_write_v<Type>) {
+            // shared pages belong to frozen frames, elements are released one at a time
+            basic_storage::in_place_pop(base_type::begin(), base_type::end());
+        } else {
+            const auto length = base_type::size();
+            base_type::pop_all();
+
+            if constexpr(!std::is_trivially_destructible_v<value_type>) {
+                for(size_type pos{}; pos < length; ++pos) {
+                    std::destroy_at(std::addressof(element_at(pos)));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @param move Whether to move from the opaque value rather than copying it.
+     * @return Iterator pointing to the emplaced element.
+     */
+    typename underlying_type::basic_iterator try_emplace([[maybe_unused]] const Entity entt, const bool force_back, const void *value, const bool move) override {
+        if(value && move) {
+            if constexpr(std::is_move_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, std::move(*static_cast<value_type *>(const_cast<void *>(value))));
+            } else {
+                return base_type::end();
+            }
+        } else if(value) {
+            if constexpr(std::is_copy_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, *static_cast<const value_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<value_type>) {
+                return emplace_element(entt, force_back);
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Pointer type to contained elements. */
+    using pointer = typename container_type::pointer;
+    /*! @brief Constant pointer type to contained elements. */
+    using const_pointer = typename alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::storage_iterator<container_type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::storage_iterator<const container_type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Iterable storage proxy over contiguous pages. */
+    using chunk_iterable = iterable_adaptor<internal::storage_chunk_iterator<entity_type, typename alloc_traits::pointer, comp_traits::page_size>>;
+    /*! @brief Constant iterable storage proxy over contiguous pages. */
+    using const_chunk_iterable = iterable_adaptor<internal::storage_chunk_iterator<entity_type, typename alloc_traits::const_pointer, comp_traits::page_size>>;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<value_type>(), internal::deletion_policy_of<Type>(), internal::sparse_policy_of<Type>(), allocator},
+          packed{container_type{allocator}, allocator},
+          touched{allocator} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) ENTT_NOEXCEPT
+        : base_type{std::move(other)},
+          packed{std::move(other.packed)},
+          touched{std::move(other.touched)},
+          frozen{std::move(other.frozen)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator) ENTT_NOEXCEPT
+        : base_type{std::move(other), allocator},
+          packed{container_type{std::move(other.packed.first()), allocator}, allocator},
+          touched{std::move(other.touched), allocator},
+          frozen{std::move(other.frozen)} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.second() == other.packed.second(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.second() == other.packed.second(), "Copying a storage is not allowed");
+
+        shrink_to_size(0u);
+        base_type::operator=(std::move(other));
+        packed.first() = std::move(other.packed.first());
+        touched = std::move(other.touched);
+        frozen = std::move(other.frozen);
+        propagate_on_container_move_assignment(packed.second(), other.packed.second());
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) {
+        using std::swap;
+        underlying_type::swap(other);
+        propagate_on_container_swap(packed.second(), other.packed.second());
+        swap(packed.first(), other.packed.first());
+        swap(touched, other.touched);
+        swap(frozen, other.frozen);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{packed.second()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT override {
+        return packed.first().size() * comp_traits::page_size;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Returns the number of pages allocated past the ones in use.
+     * @return The number of spare pages of the storage.
+     */
+    [[nodiscard]] size_type spare_pages() const ENTT_NOEXCEPT {
+        return packed.first().size() - (base_type::size() + comp_traits::page_size - 1u) / comp_traits::page_size;
+    }
+
+    /**
+     * @brief Makes sure that a given number of spare pages are ready for use.
+     *
+     * Creating an element that doesn't fit the pages in use allocates a new
+     * page on the spot. Keeping a few spare pages and replenishing them from a
+     * maintenance step (for example, once per frame) moves this cost out of
+     * the hot path.<br/>
+     * Spare pages count towards the capacity of the storage, therefore they
+     * are released by `shrink_to_fit`.
+     *
+     * @param count Number of spare pages to keep.
+     * @return The number of pages allocated.
+     */
+    size_type replenish(const size_type count) {
+        const auto spare = spare_pages();
+
+        if(spare < count) {
+            basic_storage::reserve(capacity() + (count - spare) * comp_traits::page_size);
+            return count - spare;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Returns the memory currently allocated by a storage.
+     * @return The memory currently allocated by the storage.
+     */
+    [[nodiscard]] memory_footprint memory_usage() const override {
+        auto usage = base_type::memory_usage();
+        usage.payload = packed.first().capacity() * sizeof(typename container_type::value_type) + packed.first().size() * comp_traits::page_size * sizeof(value_type);
+        return usage;
+    }
+
+    /**
+     * @brief Direct access to the array of objects.
+     * @return A pointer to the array of objects.
+     */
+    [[nodiscard]] const_pointer raw() const ENTT_NOEXCEPT {
+        return packed.first().data();
+    }
+
+    /*! @copydoc raw */
+    [[nodiscard]] pointer raw() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        unshare_all();
+        return packed.first().data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the internal array.
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+        return const_iterator{&packed.first(), pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+        unshare_all();
+        return iterator{&packed.first(), pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the internal array. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return const_iterator{&packed.first(), {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        unshare_all();
+        return iterator{&packed.first(), {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the reversed
+     * internal array. If the storage is empty, the returned iterator will be
+     * equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the reversed internal array. Attempting to dereference the returned
+     * iterator results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const ENTT_NOEXCEPT {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity.
+     */
+    [[nodiscard]] const value_type &get(const entity_type entt) const ENTT_NOEXCEPT {
+        return element_at(base_type::index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] value_type &get(const entity_type entt) ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        if constexpr(copy_on_write_v<Type>) {
+            unshare(base_type::index(entt));
+        }
+
+        return const_cast<value_type &>(std::as_const(*this).get(entt));
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> get_as_tuple(const entity_type entt) const ENTT_NOEXCEPT {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<value_type &> get_as_tuple(const entity_type entt) ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    value_type &emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type>) {
+            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+            return element_at(static_cast<size_type>(it.index()));
+        } else {
+            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
+            return element_at(static_cast<size_type>(it.index()));
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the updated instance.
+     */
+    template<typename... Func>
+    value_type &patch(const entity_type entt, Func &&...func) {
+        const auto idx = base_type::index(entt);
+        unshare(idx);
+        auto &elem = element_at(idx);
+        (std::forward<Func>(func)(elem), ...);
+        mark_pages(idx, idx + 1u);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename It>
+    void insert(It first, It last, const value_type &value = {}) {
+        if constexpr(std::is_trivially_copyable_v<value_type>) {
+            fill_elements(std::move(first), std::move(last), [&value](Type *elem, const size_type count) {
+                std::uninitialized_fill_n(elem, count, value);
+            });
+        } else {
+            for(; first != last; ++first) {
+                emplace_element(*first, true, value);
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * Trivially copyable objects provided as a contiguous block of memory are
+     * copied one page at a time rather than constructed in place one by one.
+     *
+     * @sa construct
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     */
+    template<typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<std::decay_t<typename std::iterator_traits<CIt>::value_type>, value_type>>>
+    void insert(EIt first, EIt last, CIt from) {
+        if constexpr(std::is_trivially_copyable_v<value_type> && std::is_pointer_v<CIt>) {
+            copy_elements(first, last, from);
+        } else if constexpr(std::is_trivially_copyable_v<value_type> && (std::is_same_v<CIt, typename std::vector<value_type>::iterator> || std::is_same_v<CIt, typename std::vector<value_type>::const_iterator>)) {
+            // contiguous memory, even though the iterator isn't a pointer
+            copy_elements(first, last, first == last ? nullptr : std::addressof(*from));
+        } else {
+            for(; first != last; ++first, ++from) {
+                emplace_element(*first, true, *from);
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects in parallel from a given instance.
+     *
+     * Entities are assigned and pages are allocated up-front on the calling
+     * thread. Then, objects are copy constructed in chunks aligned to the page
+     * size, so that objects constructed by different tasks never share a
+     * page.<br/>
+     * The executor is invoked once with the number of chunks and a task to
+     * run for each index in the range `[0, count)`. The signature of the
+     * executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed.
+     *
+     * Executors that also accept the index of the page of the first chunk as
+     * a third argument receive it, so that they can run each task on the
+     * threads closest to the memory it touches:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task, std::size_t page);
+     * @endcode
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename Exec, typename It>
+    void par_insert(Exec &&executor, It first, It last, const value_type &value = {}) {
+        static_assert(std::is_nothrow_copy_constructible_v<value_type>, "Parallel construction requires a non-throwing copy constructor");
+        const auto from = base_type::size();
+        unshare(from);
+
+        ENTT_TRY {
+            for(; first != last; ++first) {
+                base_type::try_emplace(*first, true);
+            }
+
+            if(from != base_type::size()) {
+                assure_at_least(base_type::size() - 1u);
+            }
+        }
+        ENTT_CATCH {
+            base_type::swap_and_pop(base_type::begin(), base_type::begin() + static_cast<typename base_type::iterator::difference_type>(base_type::size() - from));
+            ENTT_THROW;
+        }
+
+        if(const auto length = base_type::size(); from != length) {
+            const auto offset = from / comp_traits::page_size;
+            const auto task = [this, from, length, offset, &value](const std::size_t chunk) {
+                for(auto pos = (std::max)(from, (offset + chunk) * comp_traits::page_size), end = (std::min)(length, (offset + chunk + 1u) * comp_traits::page_size); pos < end; ++pos) {
+                    entt::uninitialized_construct_using_allocator(std::addressof(element_at(pos)), packed.second(), value);
+                }
+            };
+
+            internal::dispatch_pages(executor, offset, (length - 1u) / comp_traits::page_size - offset + 1u, task);
+            mark_pages(from, length);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a reference to its component.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        // a non-const iteration is a write iteration
+        mark_pages(0u, base_type::size());
+        return {internal::extended_storage_iterator{base_type::begin(), begin()}, internal::extended_storage_iterator{base_type::end(), end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const ENTT_NOEXCEPT {
+        return {internal::extended_storage_iterator{base_type::cbegin(), cbegin()}, internal::extended_storage_iterator{base_type::cend(), cend()}};
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage one page
+     * at a time.
+     *
+     * The iterable object returns a tuple that contains a pointer to the
+     * entities of a page, a pointer to their objects and the number of
+     * elements in the page. Both arrays are contiguous in memory.<br/>
+     * Pages are returned in the order in which they are laid out in memory,
+     * that is, the order of the elements is reversed with respect to the one
+     * of a plain iteration.
+     *
+     * @warning
+     * Tombstones are returned as well for storage classes that support
+     * in-place deletion. Objects assigned to tombstones aren't valid.
+     *
+     * @return An iterable object to use to _visit_ the storage page by page.
+     */
+    [[nodiscard]] chunk_iterable chunks() ENTT_NOEXCEPT_IF(!copy_on_write_v<Type>) {
+        const auto length = base_type::size();
+        unshare_all();
+        mark_pages(0u, length);
+        const auto last = static_cast<typename chunk_iterable::iterator::difference_type>((length + comp_traits::page_size - 1u) / comp_traits::page_size);
+        return {{base_type::data(), packed.first().data(), length, {}}, {base_type::data(), packed.first().data(), length, last}};
+    }
+
+    /*! @copydoc chunks */
+    [[nodiscard]] const_chunk_iterable chunks() const ENTT_NOEXCEPT {
+        const auto length = base_type::size();
+        const auto last = static_cast<typename const_chunk_iterable::iterator::difference_type>((length + comp_traits::page_size - 1u) / comp_traits::page_size);
+        const typename alloc_traits::const_pointer *pages = packed.first().data();
+        return {{base_type::data(), pages, length, {}}, {base_type::data(), pages, length, last}};
+    }
+
+    /**
+     * @brief Freezes a storage and returns a read-only frame of it.
+     *
+     * The frame shares the pages of the storage rather than copying them, only
+     * the array of entities is copied. From now on, the storage clones a page
+     * the first time it writes to it, until the frame is released.<br/>
+     * A frame can be iterated from a thread while the storage is modified from
+     * another thread. Freezing a storage again while the previous frame is
+     * still in use clones all the pages still shared with the latter.
+     *
+     * @warning
+     * Only writes made through the typed interface of the storage are detected.
+     * Objects modified through the opaque pointers returned by the base class
+     * aren't cloned in advance.
+     *
+     * @return A read-only frame of the storage.
+     */
+    [[nodiscard]] basic_frozen_storage<Entity, Type, Allocator> freeze() {
+        static_assert(copy_on_write_v<Type>, "Copy-on-write pages not enabled for the given type");
+        unshare_all();
+
+        const auto count = (base_type::size() + comp_traits::page_size - 1u) / comp_traits::page_size;
+        auto frame = std::allocate_shared<frame_type>(packed.second(), packed.second());
+
+        frame->entities.assign(base_type::data(), base_type::data() + base_type::size());
+        frame->pages.assign(packed.first().cbegin(), packed.first().cbegin() + static_cast<typename container_type::difference_type>(count));
+        frame->shared.assign(count, true);
+        frame->pending = count;
+
+        if(count) {
+            frozen = frame;
+        }
+
+        return basic_frozen_storage<Entity, Type, Allocator>{std::move(frame)};
+    }
+
+    /**
+     * @brief Returns a handle to the object assigned to an entity.
+     *
+     * Objects of pinned storage classes never move. Therefore, handles remain
+     * valid until the objects are destroyed and they can be turned back into
+     * objects without any lookup.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A handle to the object assigned to the entity.
+     */
+    [[nodiscard]] size_type pin(const entity_type entt) const {
+        static_assert(pinned_v<Type>, "Pinned elements not enabled for the given type");
+        return base_type::index(entt);
+    }
+
+    /**
+     * @brief Returns the object to which a handle refers, if any.
+     * @param pos A handle returned by `pin`.
+     * @param entt The entity to which the object was assigned.
+     * @return A pointer to the object if the entity still owns it, a null
+     * pointer otherwise.
+     */
+    [[nodiscard]] const value_type *pinned(const size_type pos, const entity_type entt) const ENTT_NOEXCEPT {
+        static_assert(pinned_v<Type>, "Pinned elements not enabled for the given type");
+        return (pos < base_type::size() && base_type::data()[pos] == entt) ? std::addressof(element_at(pos)) : nullptr;
+    }
+
+    /*! @copydoc pinned */
+    [[nodiscard]] value_type *pinned(const size_type pos, const entity_type entt) ENTT_NOEXCEPT {
+        return const_cast<value_type *>(std::as_const(*this).pinned(pos, entt));
+    }
+
+    /**
+     * @brief Checks if a page was written since it was last cleaned.
+     *
+     * Pages are marked as dirty when their objects are created, patched,
+     * moved or destroyed and when the storage is iterated through a non-const
+     * `each` or `chunks` call. Newly allocated pages are dirty too.
+     *
+     * @warning
+     * Objects modified through references obtained otherwise (as an example,
+     * those returned by a view) aren't detected. Use `patch` or `touch_page`
+     * to record these changes.
+     *
+     * @param page Index of the page to check.
+     * @return True if the page is dirty, false otherwise.
+     */
+    [[nodiscard]] bool dirty_page(const size_type page) const ENTT_NOEXCEPT {
+        static_assert(dirty_pages_v<Type>, "Dirty pages not enabled for the given type");
+        return page < touched.size() && touched[page];
+    }
+
+    /**
+     * @brief Marks as dirty the page that contains the object of an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void touch_page(const entity_type entt) {
+        static_assert(dirty_pages_v<Type>, "Dirty pages not enabled for the given type");
+        const auto idx = base_type::index(entt);
+        mark_pages(idx, idx + 1u);
+    }
+
+    /**
+     * @brief Visits the dirty pages of a storage and cleans them.
+     *
+     * The function object is invoked for each dirty page that contains at
+     * least an element, in the order in which pages are laid out in memory.
+     * Its signature must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(size_type page, const entity_type *entities, const value_type *objects, size_type count);
+     * @endcode
+     *
+     * Elements of a page are those at positions `[page * page_size, page *
+     * page_size + count)` within the storage. Both arrays are contiguous in
+     * memory.
+     *
+     * @warning
+     * Tombstones are returned as well for storage classes that support
+     * in-place deletion. Objects assigned to tombstones aren't valid.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void clean_pages(Func func) {
+        static_assert(dirty_pages_v<Type>, "Dirty pages not enabled for the given type");
+        const auto length = base_type::size();
+
+        for(size_type page{}, last = touched.size(); page < last; ++page) {
+            if(const auto from = page * comp_traits::page_size; touched[page] && from < length) {
+                func(page, base_type::data() + from, typename alloc_traits::const_pointer{packed.first()[page]}, (std::min)(comp_traits::page_size, length - from));
+            }
+
+            touched[page] = false;
+        }
+    }
+
+private:
+    compressed_pair<container_type, allocator_type> packed;
+    dirty_container_type touched;
+    std::shared_ptr<frame_type> frozen;
+};
+
+/*! @copydoc basic_storage */
+template<typename Entity, typename Type, typename Allocator>
+class basic_storage<Entity, Type, Allocator, std::enable_if_t<ignore_as_empty_v<Type>>>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using comp_traits = component_traits<Type>;
+
+protected:
+    /**
+     * @brief Erases a batch of elements from a storage.
+     * @param first A pointer to the first entity to erase.
+     * @param last A pointer past the last entity to erase.
+     */
+    void pop_n(const Entity *first, const Entity *last) override {
+        for(; first != last; ++first) {
+            const auto it = --(underlying_type::end() - underlying_type::index(*first));
+            (underlying_type::policy() != deletion_policy::swap_and_pop) ? underlying_type::in_place_pop(it, it + 1u) : underlying_type::swap_and_pop(it, it + 1u);
+        }
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<value_type>(), internal::deletion_policy_of<Type>(), internal::sparse_policy_of<Type>(), allocator} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator) ENTT_NOEXCEPT
+        : base_type{std::move(other), allocator} {}
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity, that is `void`.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void get([[maybe_unused]] const entity_type entt) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
+    }
+
+    /**
+     * @brief Returns an empty tuple.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return Returns an empty tuple.
+     */
+    [[nodiscard]] std::tuple<> get_as_tuple([[maybe_unused]] const entity_type entt) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
+        return std::tuple{};
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     */
+    template<typename... Args>
+    void emplace(const entity_type entt, Args &&...) {
+        base_type::try_emplace(entt, false);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     */
+    template<typename... Func>
+    void patch([[maybe_unused]] const entity_type entt, Func &&...func) {
+        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
+        (std::forward<Func>(func)(), ...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of optional arguments.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...) {
+        for(; first != last; ++first) {
+            base_type::try_emplace(*first, true);
+        }
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     *
+     * There are no objects to construct for empty types, therefore the
+     * executor is never invoked.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of optional arguments.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&, It first, It last, Args &&...) {
+        insert(std::move(first), std::move(last));
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() ENTT_NOEXCEPT {
+        return {internal::extended_storage_iterator{base_type::begin()}, internal::extended_storage_iterator{base_type::end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const ENTT_NOEXCEPT {
+        return {internal::extended_storage_iterator{base_type::cbegin()}, internal::extended_storage_iterator{base_type::cend()}};
+    }
+};
+
+/**
+ * @copybrief basic_storage
+ *
+ * Components that list their data members in `component_traits::soa_members`
+ * are laid out as a structure of arrays, that is, each data member has its own
+ * array of pages. Therefore, kernels that only touch some of the data members
+ * of a component don't pull the others in cache.<br/>
+ * Data members must be listed in declaration order and all of them must be
+ * listed, since objects are rebuilt from their members by means of aggregate
+ * initialization.
+ *
+ * @note
+ * There is no actual object of type `Type` in a storage of this kind. Instead,
+ * functions like `get` or `each` return proxy objects that give access to the
+ * data members of an element and are implicitly convertible to `Type`.<br/>
+ * For the same reason, opaque pointers to the elements aren't available from
+ * the base class.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Type, typename Allocator>
+class basic_storage<Entity, Type, Allocator, std::enable_if_t<!ignore_as_empty_v<Type> && soa_layout_v<Type> && !shared_v<Type>>>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    static_assert(std::is_aggregate_v<Type>, "The type must be an aggregate");
+    static_assert(!dirty_pages_v<Type>, "Dirty pages require the default layout");
+    static_assert(!pinned_v<Type>, "Pinned elements require the default layout");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using container_type = internal::soa_pages<Type, Allocator>;
+    using comp_traits = component_traits<Type>;
+
+    template<typename Arg>
+    auto emplace_element(const Entity entt, const bool force_back, Arg &&value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            const auto pos = static_cast<size_type>(it.index());
+            packed.assure_at_least(pos);
+            packed.construct(pos, std::forward<Arg>(value));
+        }
+        ENTT_CATCH {
+            if constexpr(comp_traits::in_place_delete) {
+                base_type::in_place_pop(it, it + 1u);
+            } else {
+                base_type::swap_and_pop(it, it + 1u);
+            }
+
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+            if constexpr(comp_traits::in_place_delete) {
+                if(base_type::at(pos) != tombstone) {
+                    packed.destroy(pos);
+                }
+            } else {
+                packed.destroy(pos);
+            }
+        }
+
+        packed.shrink_to_size(sz);
+    }
+
+private:
+    const void *get_at(const std::size_t) const final {
+        return nullptr;
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        packed.swap(lhs, rhs);
+    }
+
+    void move_element(const std::size_t from, const std::size_t to) final {
+        packed.assure_at_least(to);
+        packed.move(from, to);
+    }
+
+protected:
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            packed.replace(static_cast<size_type>(first.index()), base_type::size() - 1u);
+            base_type::swap_and_pop(first, first + 1u);
+        }
+    }
+
+    /**
+     * @brief Erases elements from a storage.
+     * @param first An iterator to the first element to erase.
+     * @param last An iterator past the last element to erase.
+     */
+    void in_place_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            base_type::in_place_pop(first, first + 1u);
+            packed.destroy(static_cast<size_type>(first.index()));
+        }
+    }
+
+    /*! @brief Erases all elements from a storage at once. */
+    void pop_all() override {
+        const auto length = base_type::size();
+        base_type::pop_all();
+
+        for(size_type pos{}; pos < length; ++pos) {
+            packed.destroy(pos);
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @param move Whether to move from the opaque value rather than copying it.
+     * @return Iterator pointing to the emplaced element.
+     */
+    typename underlying_type::basic_iterator try_emplace([[maybe_unused]] const Entity entt, const bool force_back, const void *value, const bool move) override {
+        if(value && move) {
+            if constexpr(std::is_move_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, std::move(*static_cast<value_type *>(const_cast<void *>(value))));
+            } else {
+                return base_type::end();
+            }
+        } else if(value) {
+            if constexpr(std::is_copy_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, *static_cast<const value_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, value_type{});
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Proxy type to contained elements. */
+    using reference = internal::soa_reference<container_type>;
+    /*! @brief Constant proxy type to contained elements. */
+    using const_reference = internal::soa_reference<const container_type>;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::soa_storage_iterator<container_type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::soa_storage_iterator<const container_type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<value_type>(), internal::deletion_policy_of<Type>(), internal::sparse_policy_of<Type>(), allocator},
+          packed{allocator} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) ENTT_NOEXCEPT
+        : base_type{std::move(other)},
+          packed{std::move(other.packed)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator) ENTT_NOEXCEPT
+        : base_type{std::move(other), allocator},
+          packed{std::move(other.packed), allocator} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.allocator() == other.packed.allocator(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.allocator() == other.packed.allocator(), "Copying a storage is not allowed");
+
+        shrink_to_size(0u);
+        base_type::operator=(std::move(other));
+        packed = std::move(other.packed);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) {
+        underlying_type::swap(other);
+        packed.swap(other.packed);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{packed.allocator()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            packed.assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT override {
+        return packed.capacity();
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Returns the memory currently allocated by a storage.
+     * @return The memory currently allocated by the storage.
+     */
+    [[nodiscard]] memory_footprint memory_usage() const override {
+        auto usage = base_type::memory_usage();
+        usage.payload = packed.footprint();
+        return usage;
+    }
+
+    /**
+     * @brief Direct access to the array of pages of a data member.
+     *
+     * Each page contains `component_traits<Type>::page_size` elements and the
+     * elements are in the same order as the entities returned by `data`.
+     *
+     * @tparam Member Data member of which to return the array of pages.
+     * @return A pointer to the array of pages of the given data member.
+     */
+    template<auto Member>
+    [[nodiscard]] auto raw() const ENTT_NOEXCEPT {
+        using page_type = typename alloc_traits::template rebind_traits<internal::soa_member_t<Member>>::const_pointer;
+        return static_cast<const page_type *>(packed.template raw<Member>());
+    }
+
+    /*! @copydoc raw */
+    template<auto Member>
+    [[nodiscard]] auto raw() ENTT_NOEXCEPT {
+        return std::as_const(packed).template raw<Member>();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the internal array.
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+        return const_iterator{&packed, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+        return iterator{&packed, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the internal array. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return const_iterator{&packed, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return iterator{&packed, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the reversed
+     * internal array. If the storage is empty, the returned iterator will be
+     * equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the reversed internal array. Attempting to dereference the returned
+     * iterator results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const ENTT_NOEXCEPT {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a proxy to the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A proxy to the object assigned to the entity.
+     */
+    [[nodiscard]] const_reference get(const entity_type entt) const ENTT_NOEXCEPT {
+        return {&packed, base_type::index(entt)};
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] reference get(const entity_type entt) ENTT_NOEXCEPT {
+        return {&packed, base_type::index(entt)};
+    }
+
+    /**
+     * @brief Returns a proxy to the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return A proxy to the object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const_reference> get_as_tuple(const entity_type entt) const ENTT_NOEXCEPT {
+        return std::make_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<reference> get_as_tuple(const entity_type entt) ENTT_NOEXCEPT {
+        return std::make_tuple(get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A proxy to the newly created object.
+     */
+    template<typename... Args>
+    reference emplace(const entity_type entt, Args &&...args) {
+        const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+        return {&packed, static_cast<size_type>(it.index())};
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     *
+     * Function objects are invoked on a temporary copy of the instance that is
+     * written back to the storage afterwards.
+     *
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A proxy to the updated instance.
+     */
+    template<typename... Func>
+    reference patch(const entity_type entt, Func &&...func) {
+        const auto idx = base_type::index(entt);
+        auto elem = packed.get(idx);
+        (std::forward<Func>(func)(elem), ...);
+        packed.assign(idx, std::move(elem));
+        return {&packed, idx};
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename It>
+    void insert(It first, It last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     */
+    template<typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<std::decay_t<typename std::iterator_traits<CIt>::value_type>, value_type>>>
+    void insert(EIt first, EIt last, CIt from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects in parallel from a given instance.
+     *
+     * Entities are assigned and pages are allocated up-front on the calling
+     * thread. Then, objects are copy constructed in chunks aligned to the page
+     * size, so that objects constructed by different tasks never share a
+     * page.<br/>
+     * The executor is invoked once with the number of chunks and a task to
+     * run for each index in the range `[0, count)`. The signature of the
+     * executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed.
+     *
+     * Executors that also accept the index of the page of the first chunk as
+     * a third argument receive it, so that they can run each task on the
+     * threads closest to the memory it touches:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task, std::size_t page);
+     * @endcode
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename Exec, typename It>
+    void par_insert(Exec &&executor, It first, It last, const value_type &value = {}) {
+        static_assert(std::is_nothrow_copy_constructible_v<value_type>, "Parallel construction requires a non-throwing copy constructor");
+        const auto from = base_type::size();
+
+        ENTT_TRY {
+            for(; first != last; ++first) {
+                base_type::try_emplace(*first, true);
+            }
+
+            if(from != base_type::size()) {
+                packed.assure_at_least(base_type::size() - 1u);
+            }
+        }
+        ENTT_CATCH {
+            base_type::swap_and_pop(base_type::begin(), base_type::begin() + static_cast<typename base_type::iterator::difference_type>(base_type::size() - from));
+            ENTT_THROW;
+        }
+
+        if(const auto length = base_type::size(); from != length) {
+            const auto offset = from / comp_traits::page_size;
+            const auto task = [this, from, length, offset, &value](const std::size_t chunk) {
+                for(auto pos = (std::max)(from, (offset + chunk) * comp_traits::page_size), end = (std::min)(length, (offset + chunk + 1u) * comp_traits::page_size); pos < end; ++pos) {
+                    packed.construct(pos, value);
+                }
+            };
+
+            internal::dispatch_pages(executor, offset, (length - 1u) / comp_traits::page_size - offset + 1u, task);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a proxy to its component.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() ENTT_NOEXCEPT {
+        return {internal::extended_storage_iterator{base_type::begin(), begin()}, internal::extended_storage_iterator{base_type::end(), end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const ENTT_NOEXCEPT {
+        return {internal::extended_storage_iterator{base_type::cbegin(), cbegin()}, internal::extended_storage_iterator{base_type::cend(), cend()}};
+    }
+
+private:
+    container_type packed;
+};
+
+/**
+ * @copybrief basic_storage
+ *
+ * Components that set `component_traits::shared` are stored once for all the
+ * entities to which equal instances are assigned. Each entity only keeps the
+ * index of its instance, while instances are looked up by hash when they are
+ * assigned or patched and destroyed as soon as no entity refers to them.<br/>
+ * Types must be hashable by means of `std::hash` and comparable by means of
+ * `operator==`.
+ *
+ * @note
+ * Instances are immutable once assigned, since other entities may refer to the
+ * same objects. Therefore, functions like `get` or `each` return constant
+ * references and `patch` assigns a modified copy of the instance.<br/>
+ * References to the instances remain valid as long as an entity refers to
+ * them.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Type, typename Allocator>
+class basic_storage<Entity, Type, Allocator, std::enable_if_t<!ignore_as_empty_v<Type> && shared_v<Type>>>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    static_assert(!component_traits<Type>::in_place_delete, "Shared elements do not support in-place delete");
+    static_assert(!soa_layout_v<Type> && !dirty_pages_v<Type> && !copy_on_write_v<Type>, "Shared elements require the default layout");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using container_type = internal::shared_pages<Type, Allocator>;
+
+    template<typename Arg>
+    auto emplace_element(const Entity entt, const bool force_back, Arg &&value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            packed.push_back(std::forward<Arg>(value));
+        }
+        ENTT_CATCH {
+            base_type::swap_and_pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+private:
+    const void *get_at(const std::size_t pos) const final {
+        return std::addressof(packed[pos]);
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        packed.swap(lhs, rhs);
+    }
+
+protected:
     /**
      * @brief Erases elements from a storage.
      * @param first An iterator to the first element to erase.
      * @param last An iterator past the last element to erase.
      */
-    void in_place_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
         for(; first != last; ++first) {
-            base_type::in_place_pop(first, first + 1u);
-            std::destroy_at(std::addressof(element_at(static_cast<size_type>(first.index()))));
+            packed.pop(static_cast<size_type>(first.index()));
+            base_type::swap_and_pop(first, first + 1u);
         }
     }
 
+    /*! @brief Erases all elements from a storage at once. */
+    void pop_all() override {
+        base_type::pop_all();
+        packed.clear();
+    }
+
     /**
      * @brief Assigns an entity to a storage.
      * @param entt A valid identifier.
      * @param value Optional opaque value.
      * @param force_back Force back insertion.
+     * @param move Whether to move from the opaque value rather than copying it.
      * @return Iterator pointing to the emplaced element.
      */
-    typename underlying_type::basic_iterator try_emplace([[maybe_unused]] const Entity entt, const bool force_back, const void *value) override {
-        if(value) {
+    typename underlying_type::basic_iterator try_emplace([[maybe_unused]] const Entity entt, const bool force_back, const void *value, const bool move) override {
+        if(value && move) {
+            if constexpr(std::is_move_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, std::move(*static_cast<value_type *>(const_cast<void *>(value))));
+            } else {
+                return base_type::end();
+            }
+        } else if(value) {
             if constexpr(std::is_copy_constructible_v<value_type>) {
                 return emplace_element(entt, force_back, *static_cast<const value_type *>(value));
             } else {
@@ -369,7 +3232,7 @@ protected:
             }
         } else {
             if constexpr(std::is_default_constructible_v<value_type>) {
-                return emplace_element(entt, force_back);
+                return emplace_element(entt, force_back, value_type{});
             } else {
                 return base_type::end();
             }
@@ -387,18 +3250,18 @@ public:
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
-    /*! @brief Pointer type to contained elements. */
-    using pointer = typename container_type::pointer;
-    /*! @brief Constant pointer type to contained elements. */
-    using const_pointer = typename alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
-    /*! @brief Random access iterator type. */
-    using iterator = internal::storage_iterator<container_type>;
+    /*! @brief Constant reference type to contained elements. */
+    using reference = const value_type &;
+    /*! @brief Constant reference type to contained elements. */
+    using const_reference = const value_type &;
     /*! @brief Constant random access iterator type. */
-    using const_iterator = internal::storage_iterator<const container_type>;
-    /*! @brief Reverse iterator type. */
+    using iterator = internal::shared_storage_iterator<container_type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = iterator;
+    /*! @brief Constant reverse iterator type. */
     using reverse_iterator = std::reverse_iterator<iterator>;
     /*! @brief Constant reverse iterator type. */
-    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = reverse_iterator;
     /*! @brief Extended iterable storage proxy. */
     using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
     /*! @brief Constant extended iterable storage proxy. */
@@ -413,8 +3276,8 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<value_type>(), deletion_policy{comp_traits::in_place_delete}, allocator},
-          packed{container_type{allocator}, allocator} {}
+        : base_type{type_id<value_type>(), deletion_policy::swap_and_pop, internal::sparse_policy_of<Type>(), allocator},
+          packed{allocator} {}
 
     /**
      * @brief Move constructor.
@@ -431,13 +3294,8 @@ public:
      */
     basic_storage(basic_storage &&other, const allocator_type &allocator) ENTT_NOEXCEPT
         : base_type{std::move(other), allocator},
-          packed{container_type{std::move(other.packed.first()), allocator}, allocator} {
-        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.second() == other.packed.second(), "Copying a storage is not allowed");
-    }
-
-    /*! @brief Default destructor. */
-    ~basic_storage() override {
-        shrink_to_size(0u);
+          packed{std::move(other.packed), allocator} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.allocator() == other.packed.allocator(), "Copying a storage is not allowed");
     }
 
     /**
@@ -446,12 +3304,10 @@ public:
      * @return This storage.
      */
     basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT {
-        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.second() == other.packed.second(), "Copying a storage is not allowed");
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.allocator() == other.packed.allocator(), "Copying a storage is not allowed");
 
-        shrink_to_size(0u);
         base_type::operator=(std::move(other));
-        packed.first() = std::move(other.packed.first());
-        propagate_on_container_move_assignment(packed.second(), other.packed.second());
+        packed = std::move(other.packed);
         return *this;
     }
 
@@ -460,10 +3316,8 @@ public:
      * @param other Storage to exchange the content with.
      */
     void swap(basic_storage &other) {
-        using std::swap;
         underlying_type::swap(other);
-        propagate_on_container_swap(packed.second(), other.packed.second());
-        swap(packed.first(), other.packed.first());
+        packed.swap(other.packed);
     }
 
     /**
@@ -471,7 +3325,7 @@ public:
      * @return The associated allocator.
      */
     [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
-        return allocator_type{packed.second()};
+        return allocator_type{packed.allocator()};
     }
 
     /**
@@ -483,10 +3337,8 @@ public:
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) override {
-        if(cap != 0u) {
-            base_type::reserve(cap);
-            assure_at_least(cap - 1u);
-        }
+        base_type::reserve(cap);
+        packed.reserve(cap);
     }
 
     /**
@@ -495,26 +3347,31 @@ public:
      * @return Capacity of the storage.
      */
     [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT override {
-        return packed.first().size() * comp_traits::page_size;
+        return packed.capacity();
     }
 
     /*! @brief Requests the removal of unused capacity. */
     void shrink_to_fit() override {
         base_type::shrink_to_fit();
-        shrink_to_size(base_type::size());
+        packed.shrink_to_fit();
     }
 
     /**
-     * @brief Direct access to the array of objects.
-     * @return A pointer to the array of objects.
+     * @brief Returns the memory currently allocated by a storage.
+     * @return The memory currently allocated by the storage.
      */
-    [[nodiscard]] const_pointer raw() const ENTT_NOEXCEPT {
-        return packed.first().data();
+    [[nodiscard]] memory_footprint memory_usage() const override {
+        auto usage = base_type::memory_usage();
+        usage.payload = packed.footprint();
+        return usage;
     }
 
-    /*! @copydoc raw */
-    [[nodiscard]] pointer raw() ENTT_NOEXCEPT {
-        return packed.first().data();
+    /**
+     * @brief Returns the number of distinct instances in a storage.
+     * @return Number of distinct instances in the storage.
+     */
+    [[nodiscard]] size_type distinct() const ENTT_NOEXCEPT {
+        return packed.distinct();
     }
 
     /**
@@ -527,7 +3384,7 @@ public:
      */
     [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
         const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
-        return const_iterator{&packed.first(), pos};
+        return const_iterator{&packed, pos};
     }
 
     /*! @copydoc cbegin */
@@ -535,12 +3392,6 @@ public:
         return cbegin();
     }
 
-    /*! @copydoc begin */
-    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
-        const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
-        return iterator{&packed.first(), pos};
-    }
-
     /**
      * @brief Returns an iterator to the end.
      *
@@ -552,7 +3403,7 @@ public:
      * internal array.
      */
     [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
-        return const_iterator{&packed.first(), {}};
+        return const_iterator{&packed, {}};
     }
 
     /*! @copydoc cend */
@@ -560,11 +3411,6 @@ public:
         return cend();
     }
 
-    /*! @copydoc end */
-    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
-        return iterator{&packed.first(), {}};
-    }
-
     /**
      * @brief Returns a reverse iterator to the beginning.
      *
@@ -583,11 +3429,6 @@ public:
         return crbegin();
     }
 
-    /*! @copydoc rbegin */
-    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
-        return std::make_reverse_iterator(end());
-    }
-
     /**
      * @brief Returns a reverse iterator to the end.
      *
@@ -607,11 +3448,6 @@ public:
         return crend();
     }
 
-    /*! @copydoc rend */
-    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
-        return std::make_reverse_iterator(begin());
-    }
-
     /**
      * @brief Returns the object assigned to an entity.
      *
@@ -623,12 +3459,7 @@ public:
      * @return The object assigned to the entity.
      */
     [[nodiscard]] const value_type &get(const entity_type entt) const ENTT_NOEXCEPT {
-        return element_at(base_type::index(entt));
-    }
-
-    /*! @copydoc get */
-    [[nodiscard]] value_type &get(const entity_type entt) ENTT_NOEXCEPT {
-        return const_cast<value_type &>(std::as_const(*this).get(entt));
+        return packed[base_type::index(entt)];
     }
 
     /**
@@ -640,14 +3471,12 @@ public:
         return std::forward_as_tuple(get(entt));
     }
 
-    /*! @copydoc get_as_tuple */
-    [[nodiscard]] std::tuple<value_type &> get_as_tuple(const entity_type entt) ENTT_NOEXCEPT {
-        return std::forward_as_tuple(get(entt));
-    }
-
     /**
      * @brief Assigns an entity to a storage and constructs its object.
      *
+     * The object is shared with all the entities to which an equal instance
+     * is assigned, if any.
+     *
      * @warning
      * Attempting to use an entity that already belongs to the storage results
      * in undefined behavior.
@@ -655,32 +3484,38 @@ public:
      * @tparam Args Types of arguments to use to construct the object.
      * @param entt A valid identifier.
      * @param args Parameters to use to construct an object for the entity.
-     * @return A reference to the newly created object.
+     * @return The object assigned to the entity.
      */
     template<typename... Args>
-    value_type &emplace(const entity_type entt, Args &&...args) {
+    const value_type &emplace(const entity_type entt, Args &&...args) {
         if constexpr(std::is_aggregate_v<value_type>) {
             const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
-            return element_at(static_cast<size_type>(it.index()));
+            return packed[static_cast<size_type>(it.index())];
         } else {
-            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
-            return element_at(static_cast<size_type>(it.index()));
+            const auto it = emplace_element(entt, false, Type(std::forward<Args>(args)...));
+            return packed[static_cast<size_type>(it.index())];
         }
     }
 
     /**
-     * @brief Updates the instance assigned to a given entity in-place.
+     * @brief Updates the instance assigned to a given entity.
+     *
+     * Function objects are invoked on a copy of the instance. The entity is
+     * then assigned the instance that is equal to the modified copy, which is
+     * created if it doesn't exist yet.
+     *
      * @tparam Func Types of the function objects to invoke.
      * @param entt A valid identifier.
      * @param func Valid function objects.
-     * @return A reference to the updated instance.
+     * @return The updated instance.
      */
     template<typename... Func>
-    value_type &patch(const entity_type entt, Func &&...func) {
+    const value_type &patch(const entity_type entt, Func &&...func) {
         const auto idx = base_type::index(entt);
-        auto &elem = element_at(idx);
+        auto elem = packed[idx];
         (std::forward<Func>(func)(elem), ...);
-        return elem;
+        packed.assign(idx, std::move(elem));
+        return packed[idx];
     }
 
     /**
@@ -726,7 +3561,7 @@ public:
      * @brief Returns an iterable object to use to _visit_ a storage.
      *
      * The iterable object returns a tuple that contains the current entity and
-     * a reference to its component.
+     * a constant reference to its component.
      *
      * @return An iterable object to use to _visit_ the storage.
      */
@@ -740,17 +3575,117 @@ public:
     }
 
 private:
-    compressed_pair<container_type, allocator_type> packed;
+    container_type packed;
 };
 
-/*! @copydoc basic_storage */
-template<typename Entity, typename Type, typename Allocator>
-class basic_storage<Entity, Type, Allocator, std::enable_if_t<ignore_as_empty_v<Type>>>
-    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+/*! @brief Order in which released identifiers are recycled. */
+enum class recycle_policy : std::uint8_t {
+    /*! @brief The last identifier released is recycled first. */
+    last_released = 0u,
+    /*! @brief The identifier with the lowest entity part is recycled first. */
+    lowest_id = 1u
+};
+
+/**
+ * @brief Storage for entity identifiers.
+ *
+ * The packed array contains the identifiers in use first and released ones
+ * after them. Releasing an identifier moves it past the last element in use
+ * and updates its version, so that it can be recycled later on.<br/>
+ * Therefore, both creation and destruction take constant time and iterating
+ * the storage only visits identifiers in use.
+ *
+ * By default, the last identifier released is recycled first. Over time, the
+ * identifiers in use spread across the whole range and so do the sparse pages
+ * of all pools. With the lowest identifier policy instead, released ones are
+ * also tracked in a bitmap with a summary word every 64 words, so that the
+ * identifiers in use are kept as dense as possible at the price of a short
+ * scan on creation.
+ *
+ * @warning
+ * Since released identifiers are kept in the packed array, functions like
+ * `contains` or `size` of the base class also take them into account. Use
+ * `in_use` to know how many elements are actually in use.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_storage<Entity, Entity, Allocator>
+    : public basic_sparse_set<Entity, Allocator> {
     using alloc_traits = std::allocator_traits<Allocator>;
-    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
-    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
-    using comp_traits = component_traits<Type>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, Allocator>;
+    using entity_traits = entt_traits<Entity>;
+
+    using word_type = std::uint64_t;
+
+    static constexpr std::size_t word_size = std::numeric_limits<word_type>::digits;
+
+    [[nodiscard]] auto entity_at(const std::size_t pos) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < entity_traits::to_entity(null), "Invalid element");
+        return entity_traits::combine(static_cast<typename entity_traits::entity_type>(pos), {});
+    }
+
+    void mark(const Entity entt, const bool value) {
+        if(policy == recycle_policy::lowest_id) {
+            const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+            const auto word = pos / word_size;
+            const auto bit = word_type{1u} << (pos % word_size);
+
+            if(!(word < released.size())) {
+                released.resize(word + 1u, word_type{});
+                summary.resize(word / word_size + 1u, word_type{});
+            }
+
+            released[word] = value ? (released[word] | bit) : (released[word] & ~bit);
+            const auto flag = word_type{1u} << (word % word_size);
+            summary[word / word_size] = released[word] ? (summary[word / word_size] | flag) : (summary[word / word_size] & ~flag);
+        }
+    }
+
+    void rebuild() {
+        released.clear();
+        summary.clear();
+
+        for(auto pos = length, last = base_type::size(); pos < last; ++pos) {
+            mark(base_type::data()[pos], true);
+        }
+    }
+
+    [[nodiscard]] Entity lowest() const ENTT_NOEXCEPT {
+        std::size_t block{};
+        for(; !summary[block]; ++block) {}
+        const auto word = block * word_size + internal::storage_first_bit(summary[block]);
+        const auto entity = static_cast<typename entity_traits::entity_type>(word * word_size + internal::storage_first_bit(released[word]));
+        return entity_traits::construct(entity, base_type::current(entity_traits::construct(entity, {})));
+    }
+
+protected:
+    /**
+     * @brief Releases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void swap_and_pop(typename underlying_type::basic_iterator first, typename underlying_type::basic_iterator last) override {
+        for(; first != last; ++first) {
+            const auto entt = *first;
+            ENTT_ASSERT(base_type::index(entt) < length, "Invalid entity");
+            base_type::swap_elements(entt, base_type::data()[--length]);
+            const auto version = static_cast<typename entity_traits::version_type>(entity_traits::to_version(entt) + 1u);
+            base_type::bump(entity_traits::construct(entity_traits::to_entity(entt), version + (version == entity_traits::to_version(tombstone))));
+            mark(entt, true);
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param hint A valid identifier.
+     * @return Iterator pointing to the emplaced element.
+     */
+    typename underlying_type::basic_iterator try_emplace(const Entity hint, const bool, const void *, const bool) override {
+        return base_type::find(emplace(hint));
+    }
 
 public:
     /*! @brief Base type. */
@@ -758,7 +3693,7 @@ public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
     /*! @brief Type of the objects assigned to entities. */
-    using value_type = Type;
+    using value_type = Entity;
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
@@ -777,13 +3712,22 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<value_type>(), deletion_policy{comp_traits::in_place_delete}, allocator} {}
+        : base_type{type_id<value_type>(), deletion_policy::swap_and_pop, allocator},
+          length{},
+          policy{},
+          released{allocator},
+          summary{allocator} {}
 
     /**
      * @brief Move constructor.
      * @param other The instance to move from.
      */
-    basic_storage(basic_storage &&other) ENTT_NOEXCEPT = default;
+    basic_storage(basic_storage &&other) ENTT_NOEXCEPT
+        : base_type{std::move(other)},
+          length{std::exchange(other.length, size_type{})},
+          policy{other.policy},
+          released{std::move(other.released)},
+          summary{std::move(other.summary)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -791,14 +3735,38 @@ public:
      * @param allocator The allocator to use.
      */
     basic_storage(basic_storage &&other, const allocator_type &allocator) ENTT_NOEXCEPT
-        : base_type{std::move(other), allocator} {}
+        : base_type{std::move(other), allocator},
+          length{std::exchange(other.length, size_type{})},
+          policy{other.policy},
+          released{std::move(other.released), allocator},
+          summary{std::move(other.summary), allocator} {}
 
     /**
      * @brief Move assignment operator.
      * @param other The instance to move from.
      * @return This storage.
      */
-    basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT = default;
+    basic_storage &operator=(basic_storage &&other) ENTT_NOEXCEPT {
+        base_type::operator=(std::move(other));
+        length = std::exchange(other.length, size_type{});
+        policy = other.policy;
+        released = std::move(other.released);
+        summary = std::move(other.summary);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) {
+        using std::swap;
+        base_type::swap(other);
+        swap(length, other.length);
+        swap(policy, other.policy);
+        swap(released, other.released);
+        swap(summary, other.summary);
+    }
 
     /**
      * @brief Returns the associated allocator.
@@ -809,100 +3777,201 @@ public:
     }
 
     /**
-     * @brief Returns the object assigned to an entity, that is `void`.
-     *
-     * @warning
-     * Attempting to use an entity that doesn't belong to the storage results in
-     * undefined behavior.
-     *
-     * @param entt A valid identifier.
+     * @brief Returns the number of elements considered still in use.
+     * @return The number of elements considered still in use.
      */
-    void get([[maybe_unused]] const entity_type entt) const ENTT_NOEXCEPT {
-        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
+    [[nodiscard]] size_type in_use() const ENTT_NOEXCEPT {
+        return length;
     }
 
     /**
-     * @brief Returns an empty tuple.
-     *
-     * @warning
-     * Attempting to use an entity that doesn't belong to the storage results in
-     * undefined behavior.
-     *
-     * @param entt A valid identifier.
-     * @return Returns an empty tuple.
+     * @brief Checks if an identifier refers to an element still in use.
+     * @param entt An identifier, either valid or not.
+     * @return True if the identifier is in use, false otherwise.
      */
-    [[nodiscard]] std::tuple<> get_as_tuple([[maybe_unused]] const entity_type entt) const ENTT_NOEXCEPT {
-        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
-        return std::tuple{};
+    [[nodiscard]] bool alive(const entity_type entt) const ENTT_NOEXCEPT {
+        return base_type::contains(entt) && (base_type::index(entt) < length);
     }
 
     /**
-     * @brief Assigns an entity to a storage and constructs its object.
+     * @brief Creates a new identifier or recycles a released one.
+     * @return A valid identifier.
+     */
+    entity_type emplace() {
+        if(length == base_type::size()) {
+            base_type::try_emplace(entity_at(length), true);
+        } else if(policy == recycle_policy::lowest_id) {
+            const auto entt = lowest();
+            base_type::swap_elements(entt, base_type::data()[length]);
+            mark(entt, false);
+        }
+
+        return base_type::data()[length++];
+    }
+
+    /**
+     * @brief Creates a new identifier or recycles a released one.
      *
-     * @warning
-     * Attempting to use an entity that already belongs to the storage results
-     * in undefined behavior.
+     * If the requested identifier isn't in use, the suggested one is used.
+     * Otherwise, a new identifier is returned.
      *
-     * @tparam Args Types of arguments to use to construct the object.
-     * @param entt A valid identifier.
+     * @param hint Required identifier.
+     * @return A valid identifier.
      */
-    template<typename... Args>
-    void emplace(const entity_type entt, Args &&...) {
-        base_type::try_emplace(entt, false);
+    entity_type emplace(const entity_type hint) {
+        if(hint == null || hint == tombstone) {
+            return emplace();
+        } else if(const auto pos = static_cast<size_type>(entity_traits::to_entity(hint)); !(pos < base_type::size())) {
+            const auto from = base_type::size();
+            base_type::try_emplace(hint, true);
+
+            // identifiers in between are released ones, the closest to the hint is recycled first
+            for(auto next = pos; next > from; --next) {
+                base_type::try_emplace(entity_at(next - 1u), true);
+                mark(entity_at(next - 1u), true);
+            }
+        } else if(const auto curr = entity_traits::construct(entity_traits::to_entity(hint), base_type::current(hint)); base_type::index(curr) < length) {
+            return emplace();
+        } else {
+            base_type::bump(hint);
+            mark(hint, false);
+        }
+
+        base_type::swap_elements(hint, base_type::data()[length++]);
+        return hint;
     }
 
     /**
-     * @brief Updates the instance assigned to a given entity in-place.
-     * @tparam Func Types of the function objects to invoke.
-     * @param entt A valid identifier.
-     * @param func Valid function objects.
+     * @brief Assigns each element in a range an identifier.
+     * @tparam It Type of mutable forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
      */
-    template<typename... Func>
-    void patch([[maybe_unused]] const entity_type entt, Func &&...func) {
-        ENTT_ASSERT(base_type::contains(entt), "Storage does not contain entity");
-        (std::forward<Func>(func)(), ...);
+    template<typename It>
+    void insert(It first, It last) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            // released identifiers are recycled first, geometric growth is preserved for small batches
+            if(const auto required = length + static_cast<size_type>(std::distance(first, last)); required > base_type::capacity()) {
+                base_type::reserve((std::max)(required, base_type::capacity() * 2u));
+            }
+        }
+
+        for(; first != last; ++first) {
+            *first = emplace();
+        }
     }
 
     /**
-     * @brief Assigns entities to a storage.
+     * @brief Appends identifiers as they are, past the last element in use.
+     *
+     * This function is intended for use in conjunction with `in_use`, mainly
+     * to restore the contents of a storage.
+     *
+     * @warning
+     * Attempting to push an identifier that already belongs to the storage
+     * results in undefined behavior.
+     *
      * @tparam It Type of input iterator.
-     * @tparam Args Types of optional arguments.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
-    template<typename It, typename... Args>
-    void insert(It first, It last, Args &&...) {
+    template<typename It>
+    void push(It first, It last) {
         for(; first != last; ++first) {
             base_type::try_emplace(*first, true);
+            mark(*first, true);
+        }
+    }
+
+    /**
+     * @brief Sets the number of elements considered still in use.
+     * @param len The number of elements considered still in use.
+     */
+    void in_use(const size_type len) ENTT_NOEXCEPT {
+        ENTT_ASSERT(!(len > base_type::size()), "Invalid length");
+        length = len;
+
+        if(policy == recycle_policy::lowest_id) {
+            rebuild();
+        }
+    }
+
+    /*! @brief Clears a storage, released identifiers included. */
+    void clear() {
+        base_type::clear();
+        length = {};
+        released.clear();
+        summary.clear();
+    }
+
+    /**
+     * @brief Sets the order in which released identifiers are recycled.
+     * @param value The recycling policy to use from now on.
+     */
+    void recycling(const recycle_policy value) {
+        if(std::exchange(policy, value) != value) {
+            rebuild();
         }
     }
 
+    /**
+     * @brief Returns the order in which released identifiers are recycled.
+     * @return The recycling policy in use.
+     */
+    [[nodiscard]] recycle_policy recycling() const ENTT_NOEXCEPT {
+        return policy;
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a storage.
      *
      * The iterable object returns a tuple that contains the current entity.
+     * Only identifiers still in use are returned.
      *
      * @return An iterable object to use to _visit_ the storage.
      */
     [[nodiscard]] iterable each() ENTT_NOEXCEPT {
-        return {internal::extended_storage_iterator{base_type::begin()}, internal::extended_storage_iterator{base_type::end()}};
+        const auto offset = static_cast<typename base_type::iterator::difference_type>(length);
+        return {internal::extended_storage_iterator{base_type::end() - offset}, internal::extended_storage_iterator{base_type::end()}};
     }
 
     /*! @copydoc each */
     [[nodiscard]] const_iterable each() const ENTT_NOEXCEPT {
-        return {internal::extended_storage_iterator{base_type::cbegin()}, internal::extended_storage_iterator{base_type::cend()}};
+        const auto offset = static_cast<typename base_type::iterator::difference_type>(length);
+        return {internal::extended_storage_iterator{base_type::cend() - offset}, internal::extended_storage_iterator{base_type::cend()}};
     }
+
+private:
+    size_type length;
+    recycle_policy policy;
+    std::vector<word_type, typename alloc_traits::template rebind_alloc<word_type>> released;
+    std::vector<word_type, typename alloc_traits::template rebind_alloc<word_type>> summary;
 };
 
 /**
  * @brief Provides a common way to access certain properties of storage types.
+ *
+ * Components that opt-out of signals by means of their traits get a plain
+ * storage, so that they don't pay for the signal support at all. Components
+ * that opt-in for change ticks get their storage wrapped in a tick mixin, those
+ * that opt-in for traces get it wrapped in a trace mixin.
+ * Components that require aligned pages get an aligned allocator.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Type of objects managed by the storage class.
  */
 template<typename Entity, typename Type, typename = void>
 struct storage_traits {
+private:
+    static constexpr auto alignment = (std::max)(page_alignment_v<Type>, alignof(Type));
+    using allocator_type = std::conditional_t<(page_alignment_v<Type> > alignof(Type)), aligned_allocator<Type, alignment>, std::allocator<Type>>;
+    using underlying_type = basic_storage<Entity, Type, allocator_type>;
+    using tick_type = std::conditional_t<change_ticks_v<Type>, tick_storage_mixin<underlying_type>, underlying_type>;
+    using base_type = std::conditional_t<trace_operations_v<Type>, trace_storage_mixin<tick_type>, tick_type>;
+
+public:
     /*! @brief Resulting type after component-to-storage conversion. */
-    using storage_type = sigh_storage_mixin<basic_storage<Entity, Type>>;
+    using storage_type = std::conditional_t<emit_signals_v<Type>, sigh_storage_mixin<base_type>, base_type>;
 };
 
 } // namespace entt
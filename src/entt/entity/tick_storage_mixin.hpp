@@ -0,0 +1,231 @@
+#ifndef ENTT_ENTITY_TICK_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_TICK_STORAGE_MIXIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/any.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Clock shared by all the storage classes that track changes.
+ *
+ * The clock is stored in the context of a registry and is created on first
+ * use. It's up to the users to advance it, for example once per frame.
+ */
+struct change_clock {
+    /*! @brief Type used to stamp changes. */
+    using tick_type = std::uint32_t;
+
+    /*! @brief Current tick, zero is reserved for _never changed_. */
+    tick_type tick{1u};
+};
+
+/**
+ * @brief Mixin type used to add change tracking to storage types.
+ *
+ * Every time an instance is created, patched or explicitly touched, the
+ * current tick of the change clock of the registry is recorded for its entity.
+ * Ticks are stored in a separate array indexed by entity and are only read
+ * when queried, therefore change detection doesn't involve any signal.
+ *
+ * @warning
+ * Elements modified by means of references (as an example, those returned by
+ * a view) aren't detected. Use `patch` or `touch` to record these changes.
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+class tick_storage_mixin: public Type {
+    using entity_traits = entt_traits<typename Type::entity_type>;
+    using registry_type = basic_registry<typename Type::entity_type, typename Type::base_type::allocator_type>;
+
+    void stamp(const typename Type::entity_type entt) {
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+
+        if(!(pos < ticks.size())) {
+            ticks.resize(pos + 1u);
+        }
+
+        ticks[pos] = clock ? clock->tick : tick_type{};
+    }
+
+    void stamp(const std::size_t from) {
+        for(auto pos = from, last = Type::size(); pos < last; ++pos) {
+            stamp(Type::data()[pos]);
+        }
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        const auto it = Type::try_emplace(entt, force_back, value, move);
+        stamp(entt);
+        return it;
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Type used to stamp changes. */
+    using tick_type = typename change_clock::tick_type;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Returns the tick of the last change to the instance of an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The tick of the last change, zero if unknown.
+     */
+    [[nodiscard]] tick_type last_changed(const entity_type entt) const {
+        ENTT_ASSERT(Type::contains(entt), "Storage does not contain entity");
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+        return pos < ticks.size() ? ticks[pos] : tick_type{};
+    }
+
+    /**
+     * @brief Checks if the instance of an entity changed after a given tick.
+     * @param entt A valid identifier.
+     * @param tick A tick of the change clock.
+     * @return True if the storage contains the entity and its instance changed
+     * after the given tick, false otherwise.
+     */
+    [[nodiscard]] bool changed_since(const entity_type entt, const tick_type tick) const {
+        return Type::contains(entt) && (last_changed(entt) > tick);
+    }
+
+    /**
+     * @brief Restores the order of a sorted storage after some of its
+     * instances changed.
+     *
+     * Only the instances that changed after the given tick are sorted and then
+     * merged with all the others, that are expected to be already sorted
+     * according to the same comparison function.
+     *
+     * @sa basic_sparse_set::resort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @param tick A tick of the change clock, usually that of the last sort.
+     * @param compare A valid comparison function object.
+     */
+    template<typename Compare>
+    void resort_since(const tick_type tick, Compare compare) {
+        std::vector<entity_type> dirty{};
+
+        for(auto entt: static_cast<const typename Type::base_type &>(*this)) {
+            if(last_changed(entt) > tick) {
+                dirty.push_back(entt);
+            }
+        }
+
+        Type::resort(dirty.begin(), dirty.end(), std::move(compare));
+    }
+
+    /**
+     * @brief Records a change to the instance of an entity.
+     * @param entt A valid identifier.
+     */
+    void touch(const entity_type entt) {
+        ENTT_ASSERT(Type::contains(entt), "Storage does not contain entity");
+        stamp(entt);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        Type::emplace(entt, std::forward<Args>(args)...);
+        stamp(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        Type::patch(entt, std::forward<Func>(func)...);
+        stamp(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        // entities are always appended to the packed array on insertion
+        stamp(from);
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        stamp(from);
+    }
+
+    /**
+     * @brief Forwards variables to mixins, if any.
+     * @param value A variable wrapped in an opaque container.
+     */
+    void bind(any value) ENTT_NOEXCEPT override {
+        if(auto *reg = any_cast<registry_type>(&value); reg) {
+            clock = &reg->ctx().template emplace<change_clock>();
+        }
+
+        Type::bind(std::move(value));
+    }
+
+private:
+    std::vector<tick_type> ticks{};
+    const change_clock *clock{};
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,391 @@
+#ifndef ENTT_ENTITY_TRACE_STORAGE_MIXIN_HPP
+#define ENTT_ENTITY_TRACE_STORAGE_MIXIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/any.hpp"
+#include "../core/fwd.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @brief Operations recorded in a trace. */
+enum class trace_operation : std::uint8_t {
+    /*! @brief An entity was assigned to a pool. */
+    emplace,
+    /*! @brief An entity was removed from a pool. */
+    erase,
+    /*! @brief A pool was cleared at once. */
+    clear
+};
+
+/**
+ * @brief Compact binary trace of the operations performed on the pools of a
+ * registry.
+ *
+ * Each record takes a byte for the operation, followed by the name of the pool
+ * and the entity involved, if any. Records are appended one after the other
+ * with no padding, so that a trace can be saved and loaded as a plain array of
+ * bytes.<br/>
+ * A trace is filled by the pools that are wrapped in a `trace_storage_mixin`
+ * and is replayed against any registry, regardless of how its pools are
+ * configured.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_operation_trace {
+    using entity_traits = entt_traits<Entity>;
+    using integral_type = typename entity_traits::entity_type;
+
+    static constexpr std::size_t record_size = sizeof(trace_operation) + sizeof(id_type) + sizeof(integral_type);
+
+    template<typename Registry>
+    [[nodiscard]] Entity map(Registry &reg, std::vector<std::pair<Entity, Entity>> &remap, const Entity entt) const {
+        const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt));
+
+        if(!(pos < remap.size())) {
+            remap.resize(pos + 1u, std::pair<Entity, Entity>{null, null});
+        }
+
+        if(auto &elem = remap[pos]; elem.first != entt) {
+            // identifiers are recycled with a new version once destroyed
+            if(elem.second != null && reg.valid(elem.second)) {
+                reg.destroy(elem.second);
+            }
+
+            elem = std::make_pair(entt, reg.create());
+        }
+
+        return remap[pos].second;
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_operation_trace() = default;
+
+    /**
+     * @brief Constructs a trace from an array of bytes.
+     * @param data A pointer to the first byte of a trace.
+     * @param length Number of bytes of the trace.
+     */
+    basic_operation_trace(const std::byte *data, const size_type length)
+        : records(data, data + length) {
+        ENTT_ASSERT(length % record_size == 0u, "Invalid trace");
+    }
+
+    /**
+     * @brief Appends a record to a trace.
+     * @param op The operation performed.
+     * @param id Name of the pool involved.
+     * @param entt The entity involved, if any.
+     */
+    void record(const trace_operation op, const id_type id, const entity_type entt = null) {
+        const auto value = entity_traits::to_integral(entt);
+        const auto pos = records.size();
+        records.resize(pos + record_size);
+        std::memcpy(&records[pos], &op, sizeof(op));
+        std::memcpy(&records[pos + sizeof(op)], &id, sizeof(id));
+        std::memcpy(&records[pos + sizeof(op) + sizeof(id)], &value, sizeof(value));
+    }
+
+    /**
+     * @brief Returns the number of records in a trace.
+     * @return Number of records in the trace.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return records.size() / record_size;
+    }
+
+    /**
+     * @brief Checks whether a trace is empty.
+     * @return True if the trace is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return records.empty();
+    }
+
+    /**
+     * @brief Returns the size of a trace in bytes.
+     * @return Size of the trace in bytes.
+     */
+    [[nodiscard]] size_type size_bytes() const ENTT_NOEXCEPT {
+        return records.size();
+    }
+
+    /**
+     * @brief Direct access to the bytes of a trace.
+     * @return A pointer to the first byte of the trace.
+     */
+    [[nodiscard]] const std::byte *data() const ENTT_NOEXCEPT {
+        return records.data();
+    }
+
+    /*! @brief Discards all the records of a trace. */
+    void clear() ENTT_NOEXCEPT {
+        records.clear();
+    }
+
+    /**
+     * @brief Iterates the records of a trace and applies the given function
+     * object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const trace_operation, const id_type, const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(size_type pos{}, last = records.size(); pos < last; pos += record_size) {
+            trace_operation op{};
+            id_type id{};
+            integral_type value{};
+            std::memcpy(&op, &records[pos], sizeof(op));
+            std::memcpy(&id, &records[pos + sizeof(op)], sizeof(id));
+            std::memcpy(&value, &records[pos + sizeof(op) + sizeof(id)], sizeof(value));
+            func(op, id, entity_traits::combine(value, value));
+        }
+    }
+
+    /**
+     * @brief Replays a trace against a registry.
+     *
+     * Recorded entities are mapped to entities created on first use, those
+     * that are recycled with a new version are destroyed and created again.
+     * Elements are default constructed by means of the type-erased interface
+     * of the pools.<br/>
+     * The function object returns the pool to use for a given name, if any.
+     * Records for which it returns a null pointer are ignored. Its signature
+     * must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * basic_sparse_set<entity_type> *(const id_type);
+     * @endcode
+     *
+     * @tparam Registry Type of registry to use to replay the trace.
+     * @tparam Func Type of the function object to invoke.
+     * @param reg A valid reference to a registry.
+     * @param func A valid function object.
+     */
+    template<typename Registry, typename Func>
+    void replay(Registry &reg, Func func) const {
+        std::vector<std::pair<Entity, Entity>> remap{};
+
+        each([this, &reg, &remap, &func](const trace_operation op, const id_type id, const entity_type entt) {
+            if(auto *pool = func(id); pool) {
+                switch(op) {
+                case trace_operation::emplace:
+                    if(const auto other = map(reg, remap, entt); !pool->contains(other)) {
+                        pool->emplace(other);
+                    }
+                    break;
+                case trace_operation::erase:
+                    if(const auto pos = static_cast<std::size_t>(entity_traits::to_entity(entt)); pos < remap.size() && remap[pos].first == entt) {
+                        pool->remove(remap[pos].second);
+                    }
+                    break;
+                case trace_operation::clear:
+                    pool->clear();
+                    break;
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Replays a trace against a registry.
+     *
+     * Records are replayed against the pools of the registry with the same
+     * names, those that refer to pools that don't exist are ignored. This way,
+     * a registry only gets the pools it's configured for.
+     *
+     * @tparam Registry Type of registry to use to replay the trace.
+     * @param reg A valid reference to a registry.
+     */
+    template<typename Registry>
+    void replay(Registry &reg) const {
+        replay(reg, [&reg](const id_type id) {
+            const auto it = reg.storage(id);
+            return (it == reg.storage().end()) ? nullptr : &it->second;
+        });
+    }
+
+private:
+    std::vector<std::byte> records{};
+};
+
+/**
+ * @brief Mixin type used to record the operations performed on storage types.
+ *
+ * Creation and destruction of instances are appended to the operation trace
+ * stored in the context of the registry, that is created on first use. Pools
+ * are recorded by the name of their types and instances by entity, their
+ * values aren't part of the trace.
+ *
+ * @warning
+ * Storage classes that aren't bound to a registry don't record anything.
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+class trace_storage_mixin: public Type {
+    using registry_type = basic_registry<typename Type::entity_type, typename Type::base_type::allocator_type>;
+    using trace_type = basic_operation_trace<typename Type::entity_type>;
+
+    void record(const trace_operation op, const typename Type::entity_type entt) {
+        if(trace && entt != tombstone) {
+            trace->record(op, Type::type().hash(), entt);
+        }
+    }
+
+    template<typename It>
+    void record(const trace_operation op, It first, It last) {
+        for(; trace && first != last; ++first) {
+            record(op, *first);
+        }
+    }
+
+    void record(const std::size_t from) {
+        for(auto pos = from, last = Type::size(); pos < last; ++pos) {
+            record(trace_operation::emplace, Type::data()[pos]);
+        }
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        record(trace_operation::erase, first, last);
+        Type::swap_and_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::in_place_pop */
+    void in_place_pop(typename Type::basic_iterator first, typename Type::basic_iterator last) override {
+        record(trace_operation::erase, first, last);
+        Type::in_place_pop(std::move(first), std::move(last));
+    }
+
+    /*! @copydoc basic_sparse_set::pop_n */
+    void pop_n(const typename Type::entity_type *first, const typename Type::entity_type *last) override {
+        if(trace) {
+            // entities are recorded one at a time by the functions above
+            Type::base_type::pop_n(first, last);
+        } else {
+            Type::pop_n(first, last);
+        }
+    }
+
+    /*! @copydoc basic_sparse_set::pop_all */
+    void pop_all() override {
+        if(trace) {
+            trace->record(trace_operation::clear, Type::type().hash());
+        }
+
+        Type::pop_all();
+    }
+
+    /*! @copydoc basic_sparse_set::try_emplace */
+    typename Type::basic_iterator try_emplace(const typename Type::entity_type entt, const bool force_back, const void *value, const bool move) override {
+        const auto it = Type::try_emplace(entt, force_back, value, move);
+
+        if(it != Type::base_type::end()) {
+            record(trace_operation::emplace, entt);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+
+    /*! @brief Inherited constructors. */
+    using Type::Type;
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        Type::emplace(entt, std::forward<Args>(args)...);
+        record(trace_operation::emplace, entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::insert(std::move(first), std::move(last), std::forward<Args>(args)...);
+        // entities are always appended to the packed array on insertion
+        record(from);
+    }
+
+    /**
+     * @brief Assigns entities to a storage and constructs their objects in
+     * parallel.
+     * @tparam Exec Type of the executor to use.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects assigned
+     * to the entities.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects assigned to the
+     * entities.
+     */
+    template<typename Exec, typename It, typename... Args>
+    void par_insert(Exec &&executor, It first, It last, Args &&...args) {
+        const auto from = Type::size();
+        Type::par_insert(std::forward<Exec>(executor), std::move(first), std::move(last), std::forward<Args>(args)...);
+        record(from);
+    }
+
+    /**
+     * @brief Forwards variables to mixins, if any.
+     * @param value A variable wrapped in an opaque container.
+     */
+    void bind(any value) ENTT_NOEXCEPT override {
+        if(auto *reg = any_cast<registry_type>(&value); reg) {
+            trace = &reg->ctx().template emplace<trace_type>();
+        }
+
+        Type::bind(std::move(value));
+    }
+
+private:
+    trace_type *trace{};
+};
+
+} // namespace entt
+
+#endif
@@ -4,14 +4,17 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
 #include "../core/iterator.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "component.hpp"
 #include "entity.hpp"
+#include "entity_mask.hpp"
 #include "fwd.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -26,14 +29,50 @@ namespace entt {
 
 namespace internal {
 
-template<typename Type, std::size_t Component, std::size_t Exclude>
+template<typename Type>
+inline constexpr std::size_t chunk_size_v = ignore_as_empty_v<Type> ? std::size_t{ENTT_PACKED_PAGE} : component_traits<Type>::page_size;
+
+template<typename Type>
+void prefetch_element(const Type &pool, const typename Type::entity_type entt) ENTT_NOEXCEPT {
+    if constexpr(!ignore_as_empty_v<typename Type::value_type>) {
+        if(pool.contains(entt)) {
+            ENTT_PREFETCH(std::addressof(pool.get(entt)));
+        }
+    }
+}
+
+template<typename Type>
+[[nodiscard]] bool arranged_match(const Type &pool, std::size_t &pos, const typename Type::entity_type entt) ENTT_NOEXCEPT {
+    if(const auto length = pool.size(); pos < length && pool.data()[length - pos - 1u] == entt) {
+        ++pos;
+        return true;
+    }
+
+    return false;
+}
+
+template<typename Type, std::size_t Component, std::size_t Exclude, typename It = typename Type::iterator>
 class view_iterator final {
-    using iterator_type = typename Type::iterator;
+    using iterator_type = It;
+    using mask_type = basic_entity_mask<typename Type::entity_type, typename Type::allocator_type>;
+
+    void prefetch() const ENTT_NOEXCEPT {
+        if constexpr(ENTT_VIEW_PREFETCH != 0 && std::is_same_v<iterator_type, typename Type::iterator>) {
+            constexpr typename std::iterator_traits<iterator_type>::difference_type distance = ENTT_VIEW_PREFETCH;
+
+            if(it.index() >= distance) {
+                const auto entt = it[distance];
+                std::apply([entt](const auto *...curr) { (curr->prefetch(entt), ...); }, pools);
+                std::apply([entt](const auto *...curr) { (curr->prefetch(entt), ...); }, filter);
+            }
+        }
+    }
 
     [[nodiscard]] bool valid() const ENTT_NOEXCEPT {
         return ((Component != 0u) || (*it != tombstone))
                && std::apply([entt = *it](const auto *...curr) { return (curr->contains(entt) && ...); }, pools)
-               && std::apply([entt = *it](const auto *...curr) { return (!curr->contains(entt) && ...); }, filter);
+               && std::apply([entt = *it](const auto *...curr) { return (!curr->contains(entt) && ...); }, filter)
+               && (!disabled || disabled->enabled(*it));
     }
 
 public:
@@ -41,22 +80,23 @@ public:
     using value_type = typename std::iterator_traits<iterator_type>::value_type;
     using pointer = typename std::iterator_traits<iterator_type>::pointer;
     using reference = typename std::iterator_traits<iterator_type>::reference;
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
 
     view_iterator() ENTT_NOEXCEPT = default;
 
-    view_iterator(iterator_type curr, iterator_type to, std::array<const Type *, Component> all_of, std::array<const Type *, Exclude> none_of) ENTT_NOEXCEPT
+    view_iterator(iterator_type curr, iterator_type to, std::array<const Type *, Component> all_of, std::array<const Type *, Exclude> none_of, const mask_type *mask = nullptr) ENTT_NOEXCEPT
         : it{curr},
           last{to},
           pools{all_of},
-          filter{none_of} {
+          filter{none_of},
+          disabled{mask} {
         if(it != last && !valid()) {
             ++(*this);
         }
     }
 
     view_iterator &operator++() ENTT_NOEXCEPT {
-        while(++it != last && !valid()) {}
+        while(++it != last && (prefetch(), !valid())) {}
         return *this;
     }
 
@@ -65,6 +105,16 @@ public:
         return ++(*this), orig;
     }
 
+    view_iterator &operator--() ENTT_NOEXCEPT {
+        while(--it, !valid()) {}
+        return *this;
+    }
+
+    view_iterator operator--(int) ENTT_NOEXCEPT {
+        view_iterator orig = *this;
+        return operator--(), orig;
+    }
+
     [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
         return &*it;
     }
@@ -73,23 +123,24 @@ public:
         return *operator->();
     }
 
-    template<typename LhsType, auto... LhsArgs, typename RhsType, auto... RhsArgs>
-    friend bool operator==(const view_iterator<LhsType, LhsArgs...> &, const view_iterator<RhsType, RhsArgs...> &) ENTT_NOEXCEPT;
+    template<typename LhsType, std::size_t LhsComp, std::size_t LhsExcl, typename LhsIt, typename RhsType, std::size_t RhsComp, std::size_t RhsExcl, typename RhsIt>
+    friend bool operator==(const view_iterator<LhsType, LhsComp, LhsExcl, LhsIt> &, const view_iterator<RhsType, RhsComp, RhsExcl, RhsIt> &) ENTT_NOEXCEPT;
 
 private:
     iterator_type it;
     iterator_type last;
     std::array<const Type *, Component> pools;
     std::array<const Type *, Exclude> filter;
+    const mask_type *disabled;
 };
 
-template<typename LhsType, auto... LhsArgs, typename RhsType, auto... RhsArgs>
-[[nodiscard]] bool operator==(const view_iterator<LhsType, LhsArgs...> &lhs, const view_iterator<RhsType, RhsArgs...> &rhs) ENTT_NOEXCEPT {
+template<typename LhsType, std::size_t LhsComp, std::size_t LhsExcl, typename LhsIt, typename RhsType, std::size_t RhsComp, std::size_t RhsExcl, typename RhsIt>
+[[nodiscard]] bool operator==(const view_iterator<LhsType, LhsComp, LhsExcl, LhsIt> &lhs, const view_iterator<RhsType, RhsComp, RhsExcl, RhsIt> &rhs) ENTT_NOEXCEPT {
     return lhs.it == rhs.it;
 }
 
-template<typename LhsType, auto... LhsArgs, typename RhsType, auto... RhsArgs>
-[[nodiscard]] bool operator!=(const view_iterator<LhsType, LhsArgs...> &lhs, const view_iterator<RhsType, RhsArgs...> &rhs) ENTT_NOEXCEPT {
+template<typename LhsType, std::size_t LhsComp, std::size_t LhsExcl, typename LhsIt, typename RhsType, std::size_t RhsComp, std::size_t RhsExcl, typename RhsIt>
+[[nodiscard]] bool operator!=(const view_iterator<LhsType, LhsComp, LhsExcl, LhsIt> &lhs, const view_iterator<RhsType, RhsComp, RhsExcl, RhsIt> &rhs) ENTT_NOEXCEPT {
     return !(lhs == rhs);
 }
 
@@ -149,6 +200,34 @@ template<typename... Lhs, typename... Rhs>
  * @endcond
  */
 
+/*! @brief Statistics collected while a pool leads the iterations of a view. */
+struct view_statistics {
+    /*! @brief Number of iterations. */
+    std::size_t runs{};
+    /*! @brief Entities returned by the leading pool. */
+    std::size_t visited{};
+    /*! @brief Lookups performed in all other pools, excluded ones included. */
+    std::size_t probes{};
+    /*! @brief Entities passed to the function object. */
+    std::size_t matched{};
+
+    /**
+     * @brief Returns the fraction of visited entities that were matched.
+     * @return The hit rate of the leading pool.
+     */
+    [[nodiscard]] double hit_rate() const ENTT_NOEXCEPT {
+        return visited ? static_cast<double>(matched) / static_cast<double>(visited) : 0.;
+    }
+
+    /**
+     * @brief Returns the average cost of an iteration.
+     * @return Entities visited plus lookups performed per iteration.
+     */
+    [[nodiscard]] double cost() const ENTT_NOEXCEPT {
+        return runs ? static_cast<double>(visited + probes) / static_cast<double>(runs) : 0.;
+    }
+};
+
 /**
  * @brief View implementation.
  *
@@ -207,28 +286,185 @@ class basic_view<Entity, get_t<Component...>, exclude_t<Exclude...>> {
         }
     }
 
+    template<typename Type>
+    [[nodiscard]] static bool probe(const Type &cpool, const Entity entt, [[maybe_unused]] view_statistics *sample) ENTT_NOEXCEPT {
+        if constexpr(ENTT_VIEW_STATISTICS != 0) {
+            if(sample) {
+                ++sample->probes;
+            }
+        }
+
+        return cpool.contains(entt);
+    }
+
+    static void sample_count([[maybe_unused]] std::size_t view_statistics::*counter, [[maybe_unused]] view_statistics *sample) ENTT_NOEXCEPT {
+        if constexpr(ENTT_VIEW_STATISTICS != 0) {
+            if(sample) {
+                ++(sample->*counter);
+            }
+        }
+    }
+
+    template<std::size_t Comp, typename Func, typename... Args, std::size_t... Index>
+    void each_if(Func &func, const std::tuple<Entity, Args...> &curr, std::index_sequence<Index...>, view_statistics *sample = nullptr) const {
+        const auto entt = std::get<0>(curr);
+        sample_count(&view_statistics::visited, sample);
+
+        if(((sizeof...(Component) != 1u) || (entt != tombstone))
+           && ((Comp == Index || probe(*std::get<Index>(pools), entt, sample)) && ...)
+           && std::apply([entt, sample](const auto *...cpool) { return (!probe(*cpool, entt, sample) && ...); }, filter)
+           && (!disabled || disabled->enabled(entt))) {
+            sample_count(&view_statistics::matched, sample);
+
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Comp, Index>(curr)...));
+            } else {
+                std::apply(func, std::tuple_cat(dispatch_get<Comp, Index>(curr)...));
+            }
+        }
+    }
+
+    template<std::size_t Comp, std::size_t... Index>
+    void prefetch(const std::size_t from, const std::size_t pos, std::index_sequence<Index...>) const ENTT_NOEXCEPT {
+        constexpr std::size_t distance = ENTT_VIEW_PREFETCH;
+        const auto *data = std::get<Comp>(pools)->data();
+
+        // sparse slots are requested first, elements are located later on when their slots are likely in cache
+        if(pos > from + 2u * distance) {
+            const auto entt = data[pos - 1u - 2u * distance];
+            ((Comp == Index ? void() : std::get<Index>(pools)->prefetch(entt)), ...);
+            std::apply([entt](const auto *...cpool) { (cpool->prefetch(entt), ...); }, filter);
+        }
+
+        if(pos > from + distance) {
+            const auto entt = data[pos - 1u - distance];
+            ((Comp == Index ? void() : internal::prefetch_element(*std::get<Index>(pools), entt)), ...);
+        }
+    }
+
+    template<std::size_t Other>
+    [[nodiscard]] auto arranged_get(const std::size_t pos) const {
+        if constexpr(ignore_as_empty_v<std::remove_const_t<type_list_element_t<Other, type_list<Component...>>>>) {
+            return std::make_tuple();
+        } else {
+            return std::forward_as_tuple(std::get<Other>(pools)->begin()[static_cast<typename iterator::difference_type>(pos)]);
+        }
+    }
+
     template<std::size_t Comp, typename Func, std::size_t... Index>
-    void each(Func func, std::index_sequence<Index...>) const {
-        for(const auto curr: std::get<Comp>(pools)->each()) {
-            const auto entt = std::get<0>(curr);
+    void each_arranged(Func &func, std::index_sequence<Index...>, view_statistics *sample) const {
+        const auto *lead = std::get<Comp>(pools);
+        std::array<std::size_t, sizeof...(Component)> next{};
+
+        // common entities come first and in the same order in all pools, a merge replaces the sparse lookups
+        for(std::size_t pos{}, last = lead->size(); pos < last; ++pos) {
+            const auto entt = lead->data()[last - pos - 1u];
+            bool found = true;
+
+            sample_count(&view_statistics::visited, sample);
+            ((found = (Comp == Index || internal::arranged_match(*std::get<Index>(pools), next[Index], entt)) && found), ...);
+
+            if(found && std::apply([entt, sample](const auto *...cpool) { return (!probe(*cpool, entt, sample) && ...); }, filter) && (!disabled || disabled->enabled(entt))) {
+                sample_count(&view_statistics::matched, sample);
 
-            if(((sizeof...(Component) != 1u) || (entt != tombstone))
-               && ((Comp == Index || std::get<Index>(pools)->contains(entt)) && ...)
-               && std::apply([entt](const auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
                 if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                    std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Comp, Index>(curr)...));
+                    std::apply(func, std::tuple_cat(std::make_tuple(entt), arranged_get<Index>(Comp == Index ? pos : (next[Index] - 1u))...));
                 } else {
-                    std::apply(func, std::tuple_cat(dispatch_get<Comp, Index>(curr)...));
+                    std::apply(func, std::tuple_cat(arranged_get<Index>(Comp == Index ? pos : (next[Index] - 1u))...));
                 }
             }
         }
     }
 
+    template<std::size_t Comp, typename Func, std::size_t... Index>
+    void each(Func func, std::index_sequence<Index...> seq) const {
+        view_statistics *sample = nullptr;
+
+        if constexpr(ENTT_VIEW_STATISTICS != 0) {
+            sample = &sampled[Comp];
+            ++sample->runs;
+        }
+
+        if(sizeof...(Component) != 1u && ((Comp == Index || std::get<Index>(pools)->arranged_as(*std::get<Comp>(pools))) && ...)) {
+            each_arranged<Comp>(func, seq, sample);
+        } else if constexpr(ENTT_VIEW_PREFETCH != 0) {
+            each_chunk<Comp>(func, 0u, std::get<Comp>(pools)->size(), seq, sample);
+        } else {
+            for(const auto curr: std::get<Comp>(pools)->each()) {
+                each_if<Comp>(func, curr, seq, sample);
+            }
+        }
+    }
+
+    template<std::size_t Comp, typename Func, std::size_t... Index>
+    void each_chunk(Func &func, const std::size_t from, const std::size_t to, std::index_sequence<Index...> seq, view_statistics *sample = nullptr) const {
+        auto *cpool = std::get<Comp>(pools);
+
+        // same order as the sequential iteration, from the back of the packed array
+        for(auto pos = to; pos > from; --pos) {
+            const auto entt = cpool->data()[pos - 1u];
+
+            if constexpr(ENTT_VIEW_PREFETCH != 0) {
+                prefetch<Comp>(from, pos, seq);
+            }
+
+            if constexpr(ignore_as_empty_v<std::remove_const_t<type_list_element_t<Comp, type_list<Component...>>>>) {
+                each_if<Comp>(func, std::make_tuple(entt), seq, sample);
+            } else {
+                const auto offset = static_cast<typename iterator::difference_type>(cpool->size() - pos);
+                each_if<Comp>(func, std::tuple_cat(std::make_tuple(entt), std::forward_as_tuple(cpool->begin()[offset])), seq, sample);
+            }
+        }
+    }
+
+    template<std::size_t... Index>
+    void adapt(std::index_sequence<Index...>) ENTT_NOEXCEPT {
+        const base_type *candidate[]{std::get<Index>(pools)...};
+
+        if constexpr(ENTT_VIEW_STATISTICS != 0) {
+            std::size_t best{};
+
+            for(std::size_t pos{}; pos < sizeof...(Index); ++pos) {
+                // pools that never led an iteration are given a chance first
+                if(!sampled[pos].runs) {
+                    best = pos;
+                    break;
+                }
+
+                if(sampled[pos].cost() < sampled[best].cost()) {
+                    best = pos;
+                }
+            }
+
+            view = candidate[best];
+        } else {
+            view = *std::min_element(std::begin(candidate), std::end(candidate), [](auto *lhs, auto *rhs) { return lhs->size() < rhs->size(); });
+        }
+    }
+
     template<typename Func, std::size_t... Index>
     void pick_and_each(Func func, std::index_sequence<Index...> seq) const {
         ((std::get<Index>(pools) == view ? each<Index>(std::move(func), seq) : void()), ...);
     }
 
+    template<std::size_t Comp, typename Exec, typename Func, std::size_t... Index>
+    void par_each(Exec &executor, Func &func, std::index_sequence<Index...> seq) const {
+        constexpr auto page = internal::chunk_size_v<std::remove_const_t<type_list_element_t<Comp, type_list<Component...>>>>;
+
+        if(const auto length = std::get<Comp>(pools)->size(); length) {
+            const auto task = [this, length, &func, seq](const std::size_t chunk) {
+                each_chunk<Comp>(func, chunk * page, (std::min)(length, (chunk + 1u) * page), seq);
+            };
+
+            internal::dispatch_pages(executor, 0u, (length + page - 1u) / page, task);
+        }
+    }
+
+    template<typename Exec, typename Func, std::size_t... Index>
+    void pick_and_par_each(Exec &executor, Func &func, std::index_sequence<Index...> seq) const {
+        ((std::get<Index>(pools) == view ? par_each<Index>(executor, func, seq) : void()), ...);
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -238,14 +474,20 @@ public:
     using base_type = std::common_type_t<typename storage_type<Component>::base_type...>;
     /*! @brief Bidirectional iterator type. */
     using iterator = internal::view_iterator<base_type, sizeof...(Component) - 1u, sizeof...(Exclude)>;
+    /*! @brief Reversed iterator type. */
+    using reverse_iterator = internal::view_iterator<base_type, sizeof...(Component) - 1u, sizeof...(Exclude), typename base_type::reverse_iterator>;
     /*! @brief Iterable view type. */
     using iterable = iterable_adaptor<internal::extended_view_iterator<iterator, storage_type<Component>...>>;
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<Entity, typename base_type::allocator_type>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_view() ENTT_NOEXCEPT
         : pools{},
           filter{},
-          view{} {}
+          view{},
+          disabled{},
+          sampled{} {}
 
     /**
      * @brief Constructs a multi-type view from a set of storage classes.
@@ -255,7 +497,9 @@ public:
     basic_view(storage_type<Component> &...component, const storage_type<Exclude> &...epool) ENTT_NOEXCEPT
         : pools{&component...},
           filter{&epool...},
-          view{std::min<const base_type *>({&component...}, [](auto *lhs, auto *rhs) { return lhs->size() < rhs->size(); })} {}
+          view{std::min<const base_type *>({&component...}, [](auto *lhs, auto *rhs) { return lhs->size() < rhs->size(); })},
+          disabled{},
+          sampled{} {}
 
     /**
      * @brief Creates a new view driven by a given component in its iterations.
@@ -289,6 +533,75 @@ public:
         return *view;
     }
 
+    /**
+     * @brief Returns the mask of disabled entities of a view, if any.
+     * @return The mask of disabled entities, a null pointer if none.
+     */
+    [[nodiscard]] const mask_type *mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
+    /**
+     * @brief Sets the mask of disabled entities of a view.
+     *
+     * Entities disabled in the mask aren't part of the view. The mask is
+     * consulted during iterations, it's never copied.
+     *
+     * @param other A mask of disabled entities, a null pointer to disable none.
+     */
+    void mask(const mask_type *other) ENTT_NOEXCEPT {
+        disabled = other;
+    }
+
+    /**
+     * @brief Returns the statistics collected by `each` while a given
+     * component led the iterations.
+     *
+     * Statistics are only collected when `ENTT_VIEW_STATISTICS` is enabled.
+     * They are kept by the view itself. Therefore, long-lived views accumulate
+     * them across frames.
+     *
+     * @tparam Comp Type of component that led the iterations.
+     * @return The statistics collected for the given component.
+     */
+    template<typename Comp>
+    [[nodiscard]] view_statistics statistics() const ENTT_NOEXCEPT {
+        return statistics<type_list_index_v<Comp, type_list<Component...>>>();
+    }
+
+    /**
+     * @brief Returns the statistics collected by `each` while a given
+     * component led the iterations.
+     * @tparam Comp Index of the component that led the iterations.
+     * @return The statistics collected for the given component.
+     */
+    template<std::size_t Comp>
+    [[nodiscard]] view_statistics statistics() const ENTT_NOEXCEPT {
+        if constexpr(ENTT_VIEW_STATISTICS != 0) {
+            return sampled[Comp];
+        } else {
+            return {};
+        }
+    }
+
+    /*! @brief Discards all the statistics collected so far. */
+    void reset_statistics() ENTT_NOEXCEPT {
+        sampled = {};
+    }
+
+    /**
+     * @brief Elects the leading storage on the basis of the statistics
+     * collected so far.
+     *
+     * Storage classes that never led an iteration are elected first, one at a
+     * time. Once all of them were sampled, the one with the lowest average
+     * cost (entities visited plus lookups performed) leads the iterations.<br/>
+     * When statistics are disabled, the smallest storage is elected instead.
+     */
+    void adapt() ENTT_NOEXCEPT {
+        adapt(std::index_sequence_for<Component...>{});
+    }
+
     /**
      * @brief Returns the storage for a given component type.
      * @tparam Comp Type of component of which to return the storage.
@@ -326,7 +639,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-        return iterator{view->begin(), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter};
+        return iterator{view->begin(), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter, disabled};
     }
 
     /**
@@ -339,7 +652,34 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-        return iterator{view->end(), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter};
+        return iterator{view->end(), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter, disabled};
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the reversed view.
+     *
+     * The returned iterator points to the first entity of the reversed view. If
+     * the view is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first entity of the reversed view.
+     */
+    [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return reverse_iterator{view->rbegin(), view->rend(), pools_to_array(std::index_sequence_for<Component...>{}), filter, disabled};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the reversed
+     * view.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the reversed view. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity of the
+     * reversed view.
+     */
+    [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
+        return reverse_iterator{view->rend(), view->rend(), pools_to_array(std::index_sequence_for<Component...>{}), filter, disabled};
     }
 
     /**
@@ -358,9 +698,8 @@ public:
      * otherwise.
      */
     [[nodiscard]] entity_type back() const ENTT_NOEXCEPT {
-        auto it = view->rbegin();
-        for(const auto last = view->rend(); it != last && !contains(*it); ++it) {}
-        return it == view->rend() ? null : *it;
+        const auto it = rbegin();
+        return it != rend() ? *it : null;
     }
 
     /**
@@ -370,7 +709,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const ENTT_NOEXCEPT {
-        return contains(entt) ? iterator{view->find(entt), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter} : end();
+        return contains(entt) ? iterator{view->find(entt), view->end(), pools_to_array(std::index_sequence_for<Component...>{}), filter, disabled} : end();
     }
 
     /**
@@ -397,7 +736,8 @@ public:
      */
     [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
         return std::apply([entt](const auto *...curr) { return (curr->contains(entt) && ...); }, pools)
-               && std::apply([entt](const auto *...curr) { return (!curr->contains(entt) && ...); }, filter);
+               && std::apply([entt](const auto *...curr) { return (!curr->contains(entt) && ...); }, filter)
+               && (!disabled || disabled->enabled(entt));
     }
 
     /**
@@ -467,9 +807,79 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
+        ENTT_PROFILE_SCOPE(type_id<basic_view>().name());
         pick_and_each(std::move(func), std::index_sequence_for<Component...>{});
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The packed array of the leading storage is split in chunks aligned to
+     * the page size of its component, so that elements of the leading pool
+     * that are processed by different tasks never share a page.<br/>
+     * The executor is invoked once with the number of chunks and a task to
+     * run for each index in the range `[0, count)`. The signature of the
+     * executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed. The function object has the same
+     * signature of the one accepted by `each` and is shared among all tasks.
+     *
+     * Executors that also accept the index of the page of the first chunk as
+     * a third argument receive it, so that they can run each task on the
+     * threads closest to the memory it touches:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task, std::size_t page);
+     * @endcode
+     *
+     * @warning
+     * Assigning or removing the iterated components while the tasks are
+     * running results in undefined behavior.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec &&executor, Func func) const {
+        pick_and_par_each(executor, func, std::index_sequence_for<Component...>{});
+    }
+
+    /**
+     * @brief Iterates the entities of a range that belong to the view and
+     * applies the given function object to them.
+     *
+     * Entities that aren't part of the view are skipped. Ranges of this kind
+     * are usually returned by storage classes that index their elements, as an
+     * example the sources of a relation. The function object is the same that
+     * is accepted by `each`.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid function object.
+     */
+    template<typename It, typename Func>
+    void each(It first, It last, Func func) const {
+        for(; first != last; ++first) {
+            if(const entity_type entt = *first; contains(entt)) {
+                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                    std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                } else {
+                    std::apply(func, get(entt));
+                }
+            }
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -483,6 +893,30 @@ public:
         return {internal::extended_view_iterator{begin(), pools}, internal::extended_view_iterator{end(), pools}};
     }
 
+    /**
+     * @brief Returns an iterable object to use to _visit_ a part of a view.
+     *
+     * The range is expressed in terms of positions within the leading storage,
+     * in the same order in which the view is iterated. Therefore, the ranges
+     * `[0, n)` and `[n, size_hint())` cover the whole view without overlapping
+     * and can be visited independently, as an example from different threads.
+     * <br/>
+     * The number of entities in a range isn't known in advance. The length of
+     * the range is the best estimate available for load balancing.
+     *
+     * @param first Position of the first element of the range.
+     * @param last Position past the last element of the range.
+     * @return An iterable object to use to _visit_ the given part of the view.
+     */
+    [[nodiscard]] iterable range(const size_type first, const size_type last) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(first <= last && last <= size_hint(), "Invalid range");
+        using difference_type = typename base_type::iterator::difference_type;
+        const auto from = view->begin() + static_cast<difference_type>(first);
+        const auto to = view->begin() + static_cast<difference_type>(last);
+        const auto other = pools_to_array(std::index_sequence_for<Component...>{});
+        return {internal::extended_view_iterator{iterator{from, to, other, filter, disabled}, pools}, internal::extended_view_iterator{iterator{to, to, other, filter, disabled}, pools}};
+    }
+
     /**
      * @brief Combines two views in a _more specific_ one (friend function).
      * @tparam Get Component list of the view to combine with.
@@ -493,17 +927,231 @@ public:
     template<typename... Get, typename... Excl>
     [[nodiscard]] auto operator|(const basic_view<Entity, get_t<Get...>, exclude_t<Excl...>> &other) const ENTT_NOEXCEPT {
         using view_type = basic_view<Entity, get_t<Component..., Get...>, exclude_t<Exclude..., Excl...>>;
-        return std::make_from_tuple<view_type>(std::tuple_cat(
+        auto elem = std::make_from_tuple<view_type>(std::tuple_cat(
             std::apply([](auto *...curr) { return std::forward_as_tuple(*curr...); }, pools),
             std::apply([](auto *...curr) { return std::forward_as_tuple(*curr...); }, other.pools),
             std::apply([](const auto *...curr) { return std::forward_as_tuple(static_cast<const storage_type<Exclude> &>(*curr)...); }, filter),
             std::apply([](const auto *...curr) { return std::forward_as_tuple(static_cast<const storage_type<Excl> &>(*curr)...); }, other.filter)));
+        elem.mask(disabled ? disabled : other.disabled);
+        return elem;
     }
 
 private:
     std::tuple<storage_type<Component> *...> pools;
     std::array<const base_type *, sizeof...(Exclude)> filter;
     const base_type *view;
+    const mask_type *disabled;
+    mutable std::array<view_statistics, ENTT_VIEW_STATISTICS ? sizeof...(Component) : 0u> sampled;
+};
+
+/**
+ * @brief Entity-only view specialization.
+ *
+ * Views of this kind iterate the entities still in use in a registry, filtered
+ * by the given components if any. They are driven by the storage of the
+ * entities and never visit released identifiers.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New entities are created.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is assigned to the entity to which the iterator points).
+ * * The entity currently pointed is destroyed.
+ *
+ * In all other cases, modifying the pools iterated by the view in any way
+ * invalidates all the iterators and using them results in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Exclude Types of components used to filter the view.
+ */
+template<typename Entity, typename... Exclude>
+class basic_view<Entity, get_t<>, exclude_t<Exclude...>> {
+    template<typename Comp>
+    using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Comp>>::storage_type, Comp>;
+
+    using entity_storage_type = basic_storage<Entity, Entity>;
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Common type among all storage types. */
+    using base_type = typename entity_storage_type::base_type;
+    /*! @brief Bidirectional iterator type. */
+    using iterator = internal::view_iterator<base_type, 0u, sizeof...(Exclude)>;
+    /*! @brief Iterable view type. */
+    using iterable = iterable_adaptor<internal::extended_view_iterator<iterator>>;
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<Entity, typename base_type::allocator_type>;
+
+    /*! @brief Default constructor to use to create empty, invalid views. */
+    basic_view() ENTT_NOEXCEPT
+        : entities{},
+          filter{},
+          disabled{} {}
+
+    /**
+     * @brief Constructs an entity-only view from a set of storage classes.
+     * @param ref The storage for the entities to iterate.
+     * @param epool The storage for the types used to filter the view.
+     */
+    basic_view(const entity_storage_type &ref, const storage_type<Exclude> &...epool) ENTT_NOEXCEPT
+        : entities{&ref},
+          filter{&epool...},
+          disabled{} {}
+
+    /**
+     * @brief Returns the storage for the entities.
+     * @return The storage for the entities.
+     */
+    [[nodiscard]] const entity_storage_type &storage() const ENTT_NOEXCEPT {
+        return *entities;
+    }
+
+    /**
+     * @brief Returns the mask of disabled entities of a view, if any.
+     * @return The mask of disabled entities, a null pointer if none.
+     */
+    [[nodiscard]] const mask_type *mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
+    /**
+     * @brief Sets the mask of disabled entities of a view.
+     *
+     * Entities disabled in the mask aren't part of the view. The mask is
+     * consulted during iterations, it's never copied.
+     *
+     * @param other A mask of disabled entities, a null pointer to disable none.
+     */
+    void mask(const mask_type *other) ENTT_NOEXCEPT {
+        disabled = other;
+    }
+
+    /**
+     * @brief Estimates the number of entities iterated by the view.
+     * @return Estimated number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type size_hint() const ENTT_NOEXCEPT {
+        return entities->in_use();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the view.
+     *
+     * The returned iterator points to the first entity of the view. If the view
+     * is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the view.
+     */
+    [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+        const auto offset = static_cast<typename base_type::iterator::difference_type>(entities->in_use());
+        return iterator{entities->end() - offset, entities->end(), {}, filter, disabled};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the view.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the view. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity of the view.
+     */
+    [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+        return iterator{entities->end(), entities->end(), {}, filter, disabled};
+    }
+
+    /**
+     * @brief Returns the first entity of the view, if any.
+     * @return The first entity of the view if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type front() const ENTT_NOEXCEPT {
+        const auto it = begin();
+        return it != end() ? *it : null;
+    }
+
+    /**
+     * @brief Returns the last entity of the view, if any.
+     * @return The last entity of the view if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type back() const ENTT_NOEXCEPT {
+        for(size_type pos{}, last = entities->in_use(); pos < last; ++pos) {
+            if(const auto entt = entities->data()[pos]; contains(entt)) {
+                return entt;
+            }
+        }
+
+        return null;
+    }
+
+    /**
+     * @brief Finds an entity.
+     * @param entt A valid identifier.
+     * @return An iterator to the given entity if it's found, past the end
+     * iterator otherwise.
+     */
+    [[nodiscard]] iterator find(const entity_type entt) const ENTT_NOEXCEPT {
+        return contains(entt) ? iterator{entities->find(entt), entities->end(), {}, filter, disabled} : end();
+    }
+
+    /**
+     * @brief Checks if a view is properly initialized.
+     * @return True if the view is properly initialized, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return entities != nullptr;
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
+        return entities->alive(entt) && std::apply([entt](const auto *...curr) { return (!curr->contains(entt) && ...); }, filter) && (!disabled || disabled->enabled(entt));
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        ENTT_PROFILE_SCOPE(type_id<basic_view>().name());
+        for(const auto entt: *this) {
+            func(entt);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a view.
+     *
+     * The iterable object returns a tuple that contains the current entity.
+     *
+     * @return An iterable object to use to _visit_ the view.
+     */
+    [[nodiscard]] iterable each() const ENTT_NOEXCEPT {
+        return {internal::extended_view_iterator{begin(), std::tuple<>{}}, internal::extended_view_iterator{end(), std::tuple<>{}}};
+    }
+
+private:
+    const entity_storage_type *entities;
+    std::array<const base_type *, sizeof...(Exclude)> filter;
+    const mask_type *disabled;
 };
 
 /**
@@ -548,12 +1196,15 @@ public:
     using reverse_iterator = typename base_type::reverse_iterator;
     /*! @brief Iterable view type. */
     using iterable = decltype(std::declval<storage_type>().each());
+    /*! @brief Type of mask of disabled entities. */
+    using mask_type = basic_entity_mask<Entity, typename base_type::allocator_type>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_view() ENTT_NOEXCEPT
         : pools{},
           filter{},
-          view{} {}
+          view{},
+          disabled{} {}
 
     /**
      * @brief Constructs a single-type view from a storage class.
@@ -562,7 +1213,8 @@ public:
     basic_view(storage_type &ref) ENTT_NOEXCEPT
         : pools{&ref},
           filter{},
-          view{&ref} {}
+          view{&ref},
+          disabled{} {}
 
     /**
      * @brief Returns the leading storage of a view.
@@ -572,6 +1224,27 @@ public:
         return *view;
     }
 
+    /**
+     * @brief Returns the mask of disabled entities of a view, if any.
+     * @return The mask of disabled entities, a null pointer if none.
+     */
+    [[nodiscard]] const mask_type *mask() const ENTT_NOEXCEPT {
+        return disabled;
+    }
+
+    /**
+     * @brief Sets the mask of disabled entities of a view.
+     *
+     * Entities disabled in the mask aren't part of the view. Single component
+     * views only consult the mask in `contains`, `each` and `par_each`, their
+     * iterators return all the entities of the underlying storage.
+     *
+     * @param other A mask of disabled entities, a null pointer to disable none.
+     */
+    void mask(const mask_type *other) ENTT_NOEXCEPT {
+        disabled = other;
+    }
+
     /**
      * @brief Returns the storage for a given component type.
      * @tparam Comp Type of component of which to return the storage.
@@ -721,7 +1394,7 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const ENTT_NOEXCEPT {
-        return view->contains(entt);
+        return view->contains(entt) && (!disabled || disabled->enabled(entt));
     }
 
     /**
@@ -774,11 +1447,25 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        if constexpr(is_applicable_v<Func, decltype(*each().begin())>) {
+        ENTT_PROFILE_SCOPE(type_id<basic_view>().name());
+        if(disabled && !disabled->empty()) {
+            // the fast paths don't look at the entities, disabled ones are filtered out separately
+            for(const auto pack: each()) {
+                if(disabled->enabled(std::get<0>(pack))) {
+                    if constexpr(is_applicable_v<Func, decltype(pack)>) {
+                        std::apply(func, pack);
+                    } else if constexpr(std::tuple_size_v<decltype(pack)> == 1u) {
+                        func();
+                    } else {
+                        func(std::get<1>(pack));
+                    }
+                }
+            }
+        } else if constexpr(is_applicable_v<Func, decltype(*each().begin())>) {
             for(const auto pack: each()) {
                 std::apply(func, pack);
             }
-        } else if constexpr(std::is_invocable_v<Func, Component &>) {
+        } else if constexpr(std::is_invocable_v<Func, decltype(*std::get<0>(pools)->begin())>) {
             for(auto &&component: *std::get<0>(pools)) {
                 func(component);
             }
@@ -793,6 +1480,75 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * @sa basic_view<Entity, get_t<Component...>, exclude_t<Exclude...>>::par_each
+     *
+     * @tparam Exec Type of the executor to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec &&executor, Func func) const {
+        constexpr auto page = internal::chunk_size_v<std::remove_const_t<Component>>;
+
+        if(const auto length = size(); length) {
+            const auto task = [this, length, &func](const size_type chunk) {
+                auto *cpool = std::get<0>(pools);
+
+                for(auto pos = (std::min)(length, (chunk + 1u) * page), from = chunk * page; pos > from; --pos) {
+                    if(disabled && !disabled->enabled(cpool->data()[pos - 1u])) {
+                        continue;
+                    }
+
+                    if constexpr(ignore_as_empty_v<std::remove_const_t<Component>>) {
+                        if constexpr(std::is_invocable_v<Func, Entity>) {
+                            func(cpool->data()[pos - 1u]);
+                        } else {
+                            func();
+                        }
+                    } else {
+                        auto &&elem = cpool->begin()[static_cast<typename iterator::difference_type>(length - pos)];
+
+                        if constexpr(std::is_invocable_v<Func, Entity, decltype(elem)>) {
+                            func(cpool->data()[pos - 1u], elem);
+                        } else {
+                            func(elem);
+                        }
+                    }
+                }
+            };
+
+            internal::dispatch_pages(executor, 0u, (length + page - 1u) / page, task);
+        }
+    }
+
+    /**
+     * @brief Iterates the entities of a range that belong to the view and
+     * applies the given function object to them.
+     * @sa basic_view<Entity, get_t<Component...>, exclude_t<Exclude...>>::each
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid function object.
+     */
+    template<typename It, typename Func>
+    void each(It first, It last, Func func) const {
+        for(; first != last; ++first) {
+            if(const entity_type entt = *first; contains(entt)) {
+                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                    std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                } else {
+                    std::apply(func, get(entt));
+                }
+            }
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -806,6 +1562,23 @@ public:
         return std::get<0>(pools)->each();
     }
 
+    /**
+     * @brief Returns an iterable object to use to _visit_ a part of a view.
+     * @sa basic_view<Entity, get_t<Component...>, exclude_t<Exclude...>>::range
+     * @param first Position of the first element of the range.
+     * @param last Position past the last element of the range.
+     * @return An iterable object to use to _visit_ the given part of the view.
+     */
+    [[nodiscard]] iterable range(const size_type first, const size_type last) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(first <= last && last <= size(), "Invalid range");
+        using difference_type = typename iterator::difference_type;
+        auto from = each().begin();
+        auto to = from;
+        from += static_cast<difference_type>(first);
+        to += static_cast<difference_type>(last);
+        return {from, to};
+    }
+
     /**
      * @brief Combines two views in a _more specific_ one (friend function).
      * @tparam Get Component list of the view to combine with.
@@ -816,16 +1589,19 @@ public:
     template<typename... Get, typename... Excl>
     [[nodiscard]] auto operator|(const basic_view<Entity, get_t<Get...>, exclude_t<Excl...>> &other) const ENTT_NOEXCEPT {
         using view_type = basic_view<Entity, get_t<Component, Get...>, exclude_t<Excl...>>;
-        return std::make_from_tuple<view_type>(std::tuple_cat(
+        auto elem = std::make_from_tuple<view_type>(std::tuple_cat(
             std::forward_as_tuple(*std::get<0>(pools)),
             std::apply([](auto *...curr) { return std::forward_as_tuple(*curr...); }, other.pools),
             std::apply([](const auto *...curr) { return std::forward_as_tuple(static_cast<const typename view_type::template storage_type<Excl> &>(*curr)...); }, other.filter)));
+        elem.mask(disabled ? disabled : other.disabled);
+        return elem;
     }
 
 private:
     std::tuple<storage_type *> pools;
     std::array<const base_type *, 0u> filter;
     const base_type *view;
+    const mask_type *disabled;
 };
 
 /**
@@ -1,8 +1,17 @@
 #include "config/config.h"
 #include "config/macro.h"
 #include "config/version.h"
+#include "container/concurrent_dense_map.hpp"
+#include "container/control_group.hpp"
+#include "container/dense_flat_map.hpp"
+#include "container/dense_flat_set.hpp"
 #include "container/dense_map.hpp"
 #include "container/dense_set.hpp"
+#include "container/flat_map.hpp"
+#include "container/flat_set.hpp"
+#include "container/perfect_map.hpp"
+#include "container/string_pool.hpp"
+#include "container/small_vector.hpp"
 #include "core/algorithm.hpp"
 #include "core/any.hpp"
 #include "core/attribute.h"
@@ -18,19 +27,35 @@
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/cached_view.hpp"
+#include "entity/command_buffer.hpp"
 #include "entity/component.hpp"
 #include "entity/entity.hpp"
+#include "entity/entity_mask.hpp"
+#include "entity/flags_storage_mixin.hpp"
+#include "entity/graph_executor.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
+#include "entity/hierarchy_storage_mixin.hpp"
+#include "entity/lazy_group.hpp"
 #include "entity/observer.hpp"
 #include "entity/organizer.hpp"
+#include "entity/prefab.hpp"
 #include "entity/registry.hpp"
+#include "entity/relation_storage_mixin.hpp"
+#include "entity/runtime_storage.hpp"
 #include "entity/runtime_view.hpp"
+#include "entity/segment.hpp"
+#include "entity/sharded_registry.hpp"
 #include "entity/sigh_storage_mixin.hpp"
+#include "entity/signature.hpp"
 #include "entity/snapshot.hpp"
 #include "entity/sparse_set.hpp"
+#include "entity/spatial_storage_mixin.hpp"
 #include "entity/storage.hpp"
+#include "entity/tick_storage_mixin.hpp"
+#include "entity/trace_storage_mixin.hpp"
 #include "entity/utility.hpp"
 #include "entity/view.hpp"
 #include "locator/locator.hpp"
@@ -49,12 +74,18 @@
 #include "meta/utility.hpp"
 #include "platform/android-ndk-r17.hpp"
 #include "poly/poly.hpp"
+#include "poly/poly_vector.hpp"
+#include "process/coroutine.hpp"
 #include "process/process.hpp"
 #include "process/scheduler.hpp"
+#include "process/timer_wheel.hpp"
 #include "resource/cache.hpp"
 #include "resource/handle.hpp"
 #include "resource/loader.hpp"
 #include "signal/delegate.hpp"
 #include "signal/dispatcher.hpp"
 #include "signal/emitter.hpp"
+#include "signal/event_awaiter.hpp"
+#include "signal/event_trace.hpp"
+#include "signal/inline_delegate.hpp"
 #include "signal/sigh.hpp"
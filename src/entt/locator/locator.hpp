@@ -104,9 +104,74 @@ struct locator final {
         service.reset();
     }
 
+    /**
+     * @brief Checks whether a service locator contains a value for the calling
+     * thread.
+     * @return True if the calling thread set its own service, false otherwise.
+     */
+    [[nodiscard]] static bool has_local() ENTT_NOEXCEPT {
+        return (local_service != nullptr);
+    }
+
+    /**
+     * @brief Returns a reference to the service of the calling thread, if any.
+     *
+     * Threads that didn't set their own service get the one shared by all
+     * threads instead.
+     *
+     * @warning
+     * Invoking this function can result in undefined behavior if neither
+     * service has been set yet.
+     *
+     * @return A reference to the service currently set for the calling thread.
+     */
+    [[nodiscard]] static Service &local() ENTT_NOEXCEPT {
+        return local_service ? *local_service : value();
+    }
+
+    /**
+     * @brief Sets or replaces the service of the calling thread.
+     * @tparam Impl Service type.
+     * @tparam Args Types of arguments to use to construct the service.
+     * @param args Parameters to use to construct the service.
+     * @return A reference to a valid service.
+     */
+    template<typename Impl = Service, typename... Args>
+    static Service &emplace_local(Args &&...args) {
+        local_owner = std::make_shared<Impl>(std::forward<Args>(args)...);
+        local_service = local_owner.get();
+        return *local_service;
+    }
+
+    /**
+     * @brief Sets or replaces the service of the calling thread using a given
+     * allocator.
+     * @tparam Impl Service type.
+     * @tparam Allocator Type of allocator used to manage memory and elements.
+     * @tparam Args Types of arguments to use to construct the service.
+     * @param alloc The allocator to use.
+     * @param args Parameters to use to construct the service.
+     * @return A reference to a valid service.
+     */
+    template<typename Impl = Service, typename Allocator, typename... Args>
+    static Service &allocate_emplace_local(Allocator alloc, Args &&...args) {
+        local_owner = std::allocate_shared<Impl>(alloc, std::forward<Args>(args)...);
+        local_service = local_owner.get();
+        return *local_service;
+    }
+
+    /*! @brief Resets the service of the calling thread. */
+    static void reset_local() ENTT_NOEXCEPT {
+        local_service = nullptr;
+        local_owner.reset();
+    }
+
 private:
     // std::shared_ptr because of its type erased allocator which is pretty useful here
     inline static std::shared_ptr<Service> service = nullptr;
+    // trivial thread local pointers don't pay for lazy initialization on access
+    inline static thread_local Service *local_service = nullptr;
+    inline static thread_local std::shared_ptr<Service> local_owner = nullptr;
 };
 
 } // namespace entt
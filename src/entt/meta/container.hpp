@@ -34,16 +34,30 @@ struct is_key_only_meta_associative_container: std::true_type {};
 template<typename Type>
 struct is_key_only_meta_associative_container<Type, std::void_t<typename Type::mapped_type>>: std::false_type {};
 
+template<typename, typename = void>
+struct is_contiguous_sequence_container: std::false_type {};
+
+template<typename Type>
+struct is_contiguous_sequence_container<Type, std::enable_if_t<std::is_same_v<decltype(std::declval<const Type &>().data()), const typename Type::value_type *>>>: std::true_type {};
+
 template<typename Type>
 struct basic_meta_sequence_container_traits {
     using iterator = meta_sequence_container::iterator;
     using size_type = std::size_t;
 
-    [[nodiscard]] static size_type size(const any &container) ENTT_NOEXCEPT {
+    [[nodiscard]] static size_type size(const meta_any_storage &container) ENTT_NOEXCEPT {
         return any_cast<const Type &>(container).size();
     }
 
-    [[nodiscard]] static bool resize([[maybe_unused]] any &container, [[maybe_unused]] size_type sz) {
+    [[nodiscard]] static const void *data([[maybe_unused]] const meta_any_storage &container) ENTT_NOEXCEPT {
+        if constexpr(is_contiguous_sequence_container<Type>::value) {
+            return any_cast<const Type &>(container).data();
+        } else {
+            return nullptr;
+        }
+    }
+
+    [[nodiscard]] static bool resize([[maybe_unused]] meta_any_storage &container, [[maybe_unused]] size_type sz) {
         if constexpr(is_dynamic_sequence_container<Type>::value) {
             if(auto *const cont = any_cast<Type>(&container); cont) {
                 cont->resize(sz);
@@ -54,7 +68,7 @@ struct basic_meta_sequence_container_traits {
         return false;
     }
 
-    [[nodiscard]] static iterator iter(any &container, const bool as_end) {
+    [[nodiscard]] static iterator iter(meta_any_storage &container, const bool as_end) {
         using std::begin;
 
         if(auto *const cont = any_cast<Type>(&container); cont) {
@@ -65,7 +79,7 @@ struct basic_meta_sequence_container_traits {
         return iterator{begin(as_const), static_cast<typename iterator::difference_type>(as_end * as_const.size())};
     }
 
-    [[nodiscard]] static iterator insert([[maybe_unused]] any &container, [[maybe_unused]] const std::ptrdiff_t offset, [[maybe_unused]] meta_any &value) {
+    [[nodiscard]] static iterator insert([[maybe_unused]] meta_any_storage &container, [[maybe_unused]] const std::ptrdiff_t offset, [[maybe_unused]] meta_any &value) {
         if constexpr(is_dynamic_sequence_container<Type>::value) {
             if(auto *const cont = any_cast<Type>(&container); cont) {
                 // this abomination is necessary because only on macos value_type and const_reference are different types for std::vector<bool>
@@ -81,7 +95,7 @@ struct basic_meta_sequence_container_traits {
         return {};
     }
 
-    [[nodiscard]] static iterator erase([[maybe_unused]] any &container, [[maybe_unused]] const std::ptrdiff_t offset) {
+    [[nodiscard]] static iterator erase([[maybe_unused]] meta_any_storage &container, [[maybe_unused]] const std::ptrdiff_t offset) {
         if constexpr(is_dynamic_sequence_container<Type>::value) {
             if(auto *const cont = any_cast<Type>(&container); cont) {
                 using std::begin;
@@ -101,11 +115,11 @@ struct basic_meta_associative_container_traits {
 
     static constexpr auto key_only = is_key_only_meta_associative_container<Type>::value;
 
-    [[nodiscard]] static size_type size(const any &container) ENTT_NOEXCEPT {
+    [[nodiscard]] static size_type size(const meta_any_storage &container) ENTT_NOEXCEPT {
         return any_cast<const Type &>(container).size();
     }
 
-    [[nodiscard]] static bool clear(any &container) {
+    [[nodiscard]] static bool clear(meta_any_storage &container) {
         if(auto *const cont = any_cast<Type>(&container); cont) {
             cont->clear();
             return true;
@@ -114,7 +128,7 @@ struct basic_meta_associative_container_traits {
         return false;
     }
 
-    [[nodiscard]] static iterator iter(any &container, const bool as_end) {
+    [[nodiscard]] static iterator iter(meta_any_storage &container, const bool as_end) {
         using std::begin;
         using std::end;
 
@@ -126,7 +140,7 @@ struct basic_meta_associative_container_traits {
         return iterator{std::integral_constant<bool, key_only>{}, as_end ? end(as_const) : begin(as_const)};
     }
 
-    [[nodiscard]] static bool insert(any &container, meta_any &key, [[maybe_unused]] meta_any &value) {
+    [[nodiscard]] static bool insert(meta_any_storage &container, meta_any &key, [[maybe_unused]] meta_any &value) {
         auto *const cont = any_cast<Type>(&container);
 
         if constexpr(is_key_only_meta_associative_container<Type>::value) {
@@ -138,13 +152,13 @@ struct basic_meta_associative_container_traits {
         }
     }
 
-    [[nodiscard]] static bool erase(any &container, meta_any &key) {
+    [[nodiscard]] static bool erase(meta_any_storage &container, meta_any &key) {
         auto *const cont = any_cast<Type>(&container);
         return cont && key.allow_cast<const typename Type::key_type &>()
                && (cont->erase(key.cast<const typename Type::key_type &>()) != cont->size());
     }
 
-    [[nodiscard]] static iterator find(any &container, meta_any &key) {
+    [[nodiscard]] static iterator find(meta_any_storage &container, meta_any &key) {
         if(key.allow_cast<const typename Type::key_type &>()) {
             if(auto *const cont = any_cast<Type>(&container); cont) {
                 return iterator{std::integral_constant<bool, key_only>{}, cont->find(key.cast<const typename Type::key_type &>())};
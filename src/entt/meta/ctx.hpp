@@ -1,8 +1,17 @@
 #ifndef ENTT_META_CTX_HPP
 #define ENTT_META_CTX_HPP
 
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../container/concurrent_dense_map.hpp"
+#include "../container/dense_map.hpp"
 #include "../core/attribute.h"
+#include "../core/fwd.hpp"
+#include "../core/utility.hpp"
 
 namespace entt {
 
@@ -14,20 +23,98 @@ namespace entt {
 namespace internal {
 
 struct meta_type_node;
+struct meta_base_node;
+struct meta_conv_node;
+
+struct meta_conv_path {
+    const meta_base_node *base;
+    const meta_conv_node *conv;
+    bool helper;
+};
+
+struct meta_func_node;
+
+struct meta_overload {
+    const meta_func_node *func;
+    std::vector<id_type> args;
+};
+
+struct meta_cast_hash {
+    template<typename Type>
+    [[nodiscard]] std::size_t operator()(const std::pair<const meta_type_node *, Type> &key) const ENTT_NOEXCEPT {
+        const auto seed = std::hash<const meta_type_node *>{}(key.first);
+        return seed ^ (static_cast<std::size_t>(key.second) + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+    }
+};
+
+struct meta_lazy_entry {
+    id_type id;
+    id_type info;
+    void (*func)();
+};
 
 struct ENTT_API meta_context {
     // we could use the lines below but VS2017 returns with an ICE if combined with ENTT_API despite the code being valid C++
-    //     inline static meta_type_node *local = nullptr;
-    //     inline static meta_type_node **global = &local;
+    //     inline static meta_context local{};
+    //     inline static meta_context *global = &local;
 
-    [[nodiscard]] static meta_type_node *&local() ENTT_NOEXCEPT {
-        static meta_type_node *chain = nullptr;
-        return chain;
+    [[nodiscard]] static meta_context &local() ENTT_NOEXCEPT {
+        static meta_context context{};
+        return context;
     }
 
-    [[nodiscard]] static meta_type_node **&global() ENTT_NOEXCEPT {
-        static meta_type_node **chain = &local();
-        return chain;
+    [[nodiscard]] static meta_context *&global() ENTT_NOEXCEPT {
+        static meta_context *context = &local();
+        return context;
+    }
+
+    meta_type_node *chain{};
+    // sealed contexts are read-only and their caches are never invalidated
+    bool sealed{};
+    // types are staged on their own nodes and published under the lock
+    std::mutex mutex{};
+    dense_map<id_type, meta_type_node *, identity> id{};
+    dense_map<id_type, meta_type_node *, identity> info{};
+    // paths are found on first use and dropped whenever a base or a conversion is linked or reset
+    concurrent_dense_map<std::pair<const meta_type_node *, id_type>, const meta_base_node *, meta_cast_hash> cast{};
+    concurrent_dense_map<std::pair<const meta_type_node *, id_type>, meta_conv_path, meta_cast_hash> conv{};
+    // overloads are keyed by a digest of the identifier and the argument types, the latter are then compared
+    concurrent_dense_map<std::pair<const meta_type_node *, std::size_t>, meta_overload, meta_cast_hash> overload{};
+    // registration functions are invoked and dropped on first lookup, either by identifier or by type
+    dense_map<id_type, meta_lazy_entry, identity> lazy_id{};
+    dense_map<id_type, meta_lazy_entry, identity> lazy_info{};
+
+    bool materialize(dense_map<id_type, meta_lazy_entry, identity> meta_context::*index, const id_type key) {
+        void (*func)() = nullptr;
+
+        if(!(this->*index).empty()) {
+            std::lock_guard guard{mutex};
+
+            if(const auto it = (this->*index).find(key); it != (this->*index).end()) {
+                const auto entry = it->second;
+                lazy_id.erase(entry.id);
+                lazy_info.erase(entry.info);
+                func = entry.func;
+            }
+        }
+
+        if(func) {
+            // the lock is released first, since the function registers types in turn
+            func();
+        }
+
+        return (func != nullptr);
+    }
+
+    void invalidate() {
+        ENTT_ASSERT(!sealed, "Meta context is sealed");
+        std::lock_guard guard{mutex};
+        cast.clear();
+        cast.reclaim();
+        conv.clear();
+        conv.reclaim();
+        overload.clear();
+        overload.reclaim();
     }
 };
 
@@ -48,8 +135,16 @@ struct meta_ctx {
         internal::meta_context::global() = other.ctx;
     }
 
+    /**
+     * @brief Checks whether the current context is sealed.
+     * @return True if the current context is sealed, false otherwise.
+     */
+    [[nodiscard]] static bool sealed() ENTT_NOEXCEPT {
+        return internal::meta_context::global()->sealed;
+    }
+
 private:
-    internal::meta_type_node **ctx{&internal::meta_context::local()};
+    internal::meta_context *ctx{&internal::meta_context::local()};
 };
 
 } // namespace entt
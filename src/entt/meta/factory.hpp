@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -142,6 +144,7 @@ class meta_factory<Type> {
         if(meta_range<internal::meta_base_node *, internal::meta_base_node> range{owner->base}; std::find(range.cbegin(), range.cend(), &node) == range.cend()) {
             node.next = owner->base;
             owner->base = &node;
+            internal::meta_context::global()->invalidate();
         }
     }
 
@@ -149,6 +152,7 @@ class meta_factory<Type> {
         if(meta_range<internal::meta_conv_node *, internal::meta_conv_node> range{owner->conv}; std::find(range.cbegin(), range.cend(), &node) == range.cend()) {
             node.next = owner->conv;
             owner->conv = &node;
+            internal::meta_context::global()->invalidate();
         }
     }
 
@@ -162,12 +166,16 @@ class meta_factory<Type> {
     void link_data_if_required(const id_type id, internal::meta_data_node &node) ENTT_NOEXCEPT {
         meta_range<internal::meta_data_node *, internal::meta_data_node> range{owner->data};
         ENTT_ASSERT(std::find_if(range.cbegin(), range.cend(), [id, &node](const auto *curr) { return curr != &node && curr->id == id; }) == range.cend(), "Duplicate identifier");
-        node.id = id;
 
         if(std::find(range.cbegin(), range.cend(), &node) == range.cend()) {
             node.next = owner->data;
             owner->data = &node;
+        } else {
+            owner->data_index.erase(node.id);
         }
+
+        node.id = id;
+        owner->data_index.insert_or_assign(id, &node);
     }
 
     void link_func_if_required(const id_type id, internal::meta_func_node &node) ENTT_NOEXCEPT {
@@ -177,6 +185,15 @@ class meta_factory<Type> {
             node.next = owner->func;
             owner->func = &node;
         }
+
+        internal::meta_context::global()->invalidate();
+
+        // overloads share the identifier and the lookup returns the first one in the list
+        owner->func_index.clear();
+
+        for(auto *curr = owner->func; curr; curr = curr->next) {
+            owner->func_index.emplace(curr->id, curr);
+        }
     }
 
     template<typename Setter, auto Getter, typename Policy, std::size_t... Index>
@@ -214,15 +231,21 @@ public:
      * @return An extended meta factory for the given type.
      */
     auto type(const id_type id = type_hash<Type>::value()) ENTT_NOEXCEPT {
-        meta_range<internal::meta_type_node *, internal::meta_type_node> range{*internal::meta_context::global()};
-        ENTT_ASSERT(std::find_if(range.cbegin(), range.cend(), [id, this](const auto *curr) { return curr != owner && curr->id == id; }) == range.cend(), "Duplicate identifier");
-        owner->id = id;
-
-        if(std::find(range.cbegin(), range.cend(), owner) == range.cend()) {
-            owner->next = *internal::meta_context::global();
-            *internal::meta_context::global() = owner;
+        auto *context = internal::meta_context::global();
+        std::lock_guard guard{context->mutex};
+        ENTT_ASSERT([&]() { const auto it = context->id.find(id); return it == context->id.cend() || it->second == owner; }(), "Duplicate identifier");
+
+        if(const auto it = context->info.find(owner->info->hash()); it == context->info.cend() || it->second != owner) {
+            owner->next = context->chain;
+            context->chain = owner;
+            context->info.insert_or_assign(owner->info->hash(), owner);
+        } else {
+            context->id.erase(owner->id);
         }
 
+        owner->id = id;
+        context->id.insert_or_assign(id, owner);
+
         return meta_factory<Type, Type>{&owner->prop};
     }
 
@@ -414,7 +437,16 @@ public:
                 internal::meta_node<std::remove_const_t<data_type>>::resolve(),
                 &meta_arg<type_list<std::remove_const_t<data_type>>>,
                 &meta_setter<Type, Data>,
-                &meta_getter<Type, Data, Policy>
+                &meta_getter<Type, Data, Policy>,
+                (std::is_array_v<data_type> || std::is_same_v<Policy, as_void_t>) ? nullptr : +[](const type_info &info, const void *instance) ENTT_NOEXCEPT -> const void * {
+                    if constexpr(!std::is_array_v<data_type>) {
+                        if(info == type_id<Type>()) {
+                            return std::addressof(static_cast<const Type *>(instance)->*Data);
+                        }
+                    }
+
+                    return nullptr;
+                }
                 // tricks clang-format
             };
 
@@ -553,7 +585,12 @@ public:
             descriptor::args_type::size,
             internal::meta_node<std::conditional_t<std::is_same_v<Policy, as_void_t>, void, std::remove_const_t<std::remove_reference_t<typename descriptor::return_type>>>>::resolve(),
             &meta_arg<typename descriptor::args_type>,
-            &meta_invoke<Type, Candidate, Policy>
+            +[](meta_handle instance, meta_any *const args, meta_any *const ret) {
+                return internal::meta_invoke<Type, Policy>(std::move(instance), Candidate, args, std::make_index_sequence<descriptor::args_type::size>{}, ret);
+            },
+            +[](const type_info &info, meta_any *const args, void *(*next)(void *), void *range) {
+                return internal::meta_invoke_n<Type>(info, args, next, range, Candidate, std::make_index_sequence<descriptor::args_type::size>{});
+            }
             // tricks clang-format
         };
 
@@ -578,11 +615,47 @@ private:
  */
 template<typename Type>
 [[nodiscard]] auto meta() ENTT_NOEXCEPT {
+    ENTT_ASSERT(!internal::meta_context::global()->sealed, "Meta context is sealed");
     auto *const node = internal::meta_node<Type>::resolve();
     // extended meta factory to allow assigning properties to opaque meta types
     return meta_factory<Type, Type>{&node->prop};
 }
 
+/**
+ * @brief Binds a registration function to a type, to invoke on first lookup.
+ *
+ * Types registered lazily are reflected only when they're looked up for the
+ * first time, either by identifier or by type. Therefore, the cost of their
+ * registration is paid only for the types actually used.<br/>
+ * The function is invoked at most once and is expected to reflect the type
+ * with the given identifier:
+ *
+ * @code{.cpp}
+ * entt::meta_lazy<my_type>("my_type"_hs, []() {
+ *     entt::meta<my_type>().type("my_type"_hs).data<&my_type::value>("value"_hs);
+ * });
+ * @endcode
+ *
+ * @warning
+ * Lazy types aren't visited when iterating all meta types until they're
+ * registered. The same applies to meta objects obtained without going through
+ * a lookup, such as the type of a meta any.
+ *
+ * @tparam Type Type to reflect.
+ * @param id Unique identifier.
+ * @param func A valid registration function.
+ */
+template<typename Type>
+void meta_lazy(const id_type id, void (*func)()) {
+    auto *context = internal::meta_context::global();
+    ENTT_ASSERT(!context->sealed, "Meta context is sealed");
+    const internal::meta_lazy_entry entry{id, type_id<std::remove_const_t<std::remove_reference_t<Type>>>().hash(), func};
+
+    std::lock_guard guard{context->mutex};
+    context->lazy_id.insert_or_assign(entry.id, entry);
+    context->lazy_info.insert_or_assign(entry.info, entry);
+}
+
 /**
  * @brief Resets a type and all its parts.
  *
@@ -604,22 +677,49 @@ inline void meta_reset(const id_type id) ENTT_NOEXCEPT {
         }
     };
 
-    for(auto **it = internal::meta_context::global(); *it; it = &(*it)->next) {
-        if(auto *node = *it; node->id == id) {
-            clear_chain(&node->prop);
-            clear_chain(&node->base);
-            clear_chain(&node->conv);
-            clear_chain(&node->ctor);
-            clear_chain(&node->data, &internal::meta_data_node::prop);
-            clear_chain(&node->func, &internal::meta_func_node::prop);
+    auto *context = internal::meta_context::global();
+    ENTT_ASSERT(!context->sealed, "Meta context is sealed");
 
-            node->id = {};
-            node->dtor = nullptr;
-            *it = std::exchange(node->next, nullptr);
+    {
+        std::lock_guard guard{context->mutex};
 
-            break;
+        if(context->id.find(id) == context->id.cend()) {
+            return;
+        }
+
+        for(auto **it = &context->chain; *it; it = &(*it)->next) {
+            if(auto *node = *it; node->id == id) {
+                context->id.erase(node->id);
+                context->info.erase(node->info->hash());
+
+                for(auto *curr = node->data; curr; curr = curr->next) {
+                    curr->prop_index.clear();
+                }
+
+                for(auto *curr = node->func; curr; curr = curr->next) {
+                    curr->prop_index.clear();
+                }
+
+                node->prop_index.clear();
+                clear_chain(&node->prop);
+                clear_chain(&node->base);
+                clear_chain(&node->conv);
+                clear_chain(&node->ctor);
+                clear_chain(&node->data, &internal::meta_data_node::prop);
+                clear_chain(&node->func, &internal::meta_func_node::prop);
+                node->data_index.clear();
+                node->func_index.clear();
+
+                node->id = {};
+                node->dtor = nullptr;
+                *it = std::exchange(node->next, nullptr);
+
+                break;
+            }
         }
     }
+
+    context->invalidate();
 }
 
 /**
@@ -640,11 +740,56 @@ void meta_reset() ENTT_NOEXCEPT {
  * @sa meta_reset
  */
 inline void meta_reset() ENTT_NOEXCEPT {
-    while(*internal::meta_context::global()) {
-        meta_reset((*internal::meta_context::global())->id);
+    internal::meta_context::global()->sealed = false;
+    internal::meta_context::global()->lazy_id.clear();
+    internal::meta_context::global()->lazy_info.clear();
+
+    while(internal::meta_context::global()->chain) {
+        meta_reset(internal::meta_context::global()->chain->id);
     }
 }
 
+/**
+ * @brief Seals the current context.
+ *
+ * A sealed context is read-only. Attempting to register or reset types results
+ * in undefined behavior until the context is reset as a whole. On the other
+ * hand, its lookup tables are compacted and never invalidated, so that it can
+ * be safely shared between threads and modules as is. Properties are also
+ * sorted, so that looking them up by key doesn't walk lists anymore.<br/>
+ * Types registered lazily and not yet looked up are registered first.
+ *
+ * @sa meta_reset
+ */
+inline void meta_seal() ENTT_NOEXCEPT {
+    auto *context = internal::meta_context::global();
+
+    while(!context->lazy_id.empty()) {
+        context->materialize(&internal::meta_context::lazy_id, context->lazy_id.begin()->first);
+    }
+
+    std::lock_guard guard{context->mutex};
+
+    context->id.rehash(0u);
+    context->info.rehash(0u);
+
+    for(auto *curr = context->chain; curr; curr = curr->next) {
+        curr->data_index.rehash(0u);
+        curr->func_index.rehash(0u);
+        internal::meta_prop_reindex(curr->prop, curr->prop_index);
+
+        for(auto *elem = curr->data; elem; elem = elem->next) {
+            internal::meta_prop_reindex(elem->prop, elem->prop_index);
+        }
+
+        for(auto *elem = curr->func; elem; elem = elem->next) {
+            internal::meta_prop_reindex(elem->prop, elem->prop_index);
+        }
+    }
+
+    context->sealed = true;
+}
+
 } // namespace entt
 
 #endif
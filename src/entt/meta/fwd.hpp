@@ -1,6 +1,9 @@
 #ifndef ENTT_META_FWD_HPP
 #define ENTT_META_FWD_HPP
 
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+
 namespace entt {
 
 class meta_sequence_container;
@@ -19,6 +22,9 @@ struct meta_func;
 
 class meta_type;
 
+/*! @brief Alias declaration for the storage of the meta system. */
+using meta_any_storage = basic_any<ENTT_META_ANY_SIZE>;
+
 } // namespace entt
 
 #endif
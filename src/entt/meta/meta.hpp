@@ -1,7 +1,9 @@
 #ifndef ENTT_META_META_HPP
 #define ENTT_META_META_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -9,6 +11,7 @@
 #include "../config/config.h"
 #include "../core/any.hpp"
 #include "../core/fwd.hpp"
+#include "../core/hashed_string.hpp"
 #include "../core/iterator.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
@@ -25,6 +28,28 @@ namespace entt {
 class meta_any;
 class meta_type;
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename, typename = void>
+struct has_meta_sequence_container_data: std::false_type {};
+
+template<typename Type>
+struct has_meta_sequence_container_data<Type, std::void_t<decltype(&meta_sequence_container_traits<Type>::data)>>: std::true_type {};
+
+[[nodiscard]] inline const meta_prop_node *meta_find_prop(const meta_prop_node *curr, const meta_prop_index &index, const meta_any &key);
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /*! @brief Proxy object for sequence containers. */
 class meta_sequence_container {
     class meta_iterator;
@@ -44,17 +69,23 @@ public:
      * @param instance The container to wrap.
      */
     template<typename Type>
-    meta_sequence_container(std::in_place_type_t<Type>, any instance) ENTT_NOEXCEPT
+    meta_sequence_container(std::in_place_type_t<Type>, meta_any_storage instance) ENTT_NOEXCEPT
         : value_type_node{internal::meta_node<std::remove_const_t<std::remove_reference_t<typename Type::value_type>>>::resolve()},
           size_fn{&meta_sequence_container_traits<Type>::size},
           resize_fn{&meta_sequence_container_traits<Type>::resize},
           iter_fn{&meta_sequence_container_traits<Type>::iter},
           insert_fn{&meta_sequence_container_traits<Type>::insert},
           erase_fn{&meta_sequence_container_traits<Type>::erase},
-          storage{std::move(instance)} {}
+          storage{std::move(instance)} {
+        if constexpr(internal::has_meta_sequence_container_data<Type>::value) {
+            data_fn = &meta_sequence_container_traits<Type>::data;
+        }
+    }
 
     [[nodiscard]] inline meta_type value_type() const ENTT_NOEXCEPT;
     [[nodiscard]] inline size_type size() const ENTT_NOEXCEPT;
+    [[nodiscard]] inline const void *data() const ENTT_NOEXCEPT;
+    [[nodiscard]] inline void *data() ENTT_NOEXCEPT;
     inline bool resize(const size_type);
     inline bool clear();
     [[nodiscard]] inline iterator begin();
@@ -66,12 +97,13 @@ public:
 
 private:
     internal::meta_type_node *value_type_node = nullptr;
-    size_type (*size_fn)(const any &) ENTT_NOEXCEPT = nullptr;
-    bool (*resize_fn)(any &, size_type) = nullptr;
-    iterator (*iter_fn)(any &, const bool) = nullptr;
-    iterator (*insert_fn)(any &, const std::ptrdiff_t, meta_any &) = nullptr;
-    iterator (*erase_fn)(any &, const std::ptrdiff_t) = nullptr;
-    any storage{};
+    size_type (*size_fn)(const meta_any_storage &) ENTT_NOEXCEPT = nullptr;
+    bool (*resize_fn)(meta_any_storage &, size_type) = nullptr;
+    iterator (*iter_fn)(meta_any_storage &, const bool) = nullptr;
+    iterator (*insert_fn)(meta_any_storage &, const std::ptrdiff_t, meta_any &) = nullptr;
+    iterator (*erase_fn)(meta_any_storage &, const std::ptrdiff_t) = nullptr;
+    const void *(*data_fn)(const meta_any_storage &) ENTT_NOEXCEPT = nullptr;
+    meta_any_storage storage{};
 };
 
 /*! @brief Proxy object for associative containers. */
@@ -93,7 +125,7 @@ public:
      * @param instance The container to wrap.
      */
     template<typename Type>
-    meta_associative_container(std::in_place_type_t<Type>, any instance) ENTT_NOEXCEPT
+    meta_associative_container(std::in_place_type_t<Type>, meta_any_storage instance) ENTT_NOEXCEPT
         : key_only_container{meta_associative_container_traits<Type>::key_only},
           key_type_node{internal::meta_node<std::remove_const_t<std::remove_reference_t<typename Type::key_type>>>::resolve()},
           mapped_type_node{nullptr},
@@ -128,13 +160,13 @@ private:
     internal::meta_type_node *key_type_node = nullptr;
     internal::meta_type_node *mapped_type_node = nullptr;
     internal::meta_type_node *value_type_node = nullptr;
-    size_type (*size_fn)(const any &) ENTT_NOEXCEPT = nullptr;
-    bool (*clear_fn)(any &) = nullptr;
-    iterator (*iter_fn)(any &, const bool) = nullptr;
-    bool (*insert_fn)(any &, meta_any &, meta_any &) = nullptr;
-    bool (*erase_fn)(any &, meta_any &) = nullptr;
-    iterator (*find_fn)(any &, meta_any &) = nullptr;
-    any storage{};
+    size_type (*size_fn)(const meta_any_storage &) ENTT_NOEXCEPT = nullptr;
+    bool (*clear_fn)(meta_any_storage &) = nullptr;
+    iterator (*iter_fn)(meta_any_storage &, const bool) = nullptr;
+    bool (*insert_fn)(meta_any_storage &, meta_any &, meta_any &) = nullptr;
+    bool (*erase_fn)(meta_any_storage &, meta_any &) = nullptr;
+    iterator (*find_fn)(meta_any_storage &, meta_any &) = nullptr;
+    meta_any_storage storage{};
 };
 
 /*! @brief Opaque wrapper for values of any type. */
@@ -145,10 +177,10 @@ class meta_any {
         assoc
     };
 
-    using vtable_type = void(const operation, const any &, void *);
+    using vtable_type = void(const operation, const meta_any_storage &, void *);
 
     template<typename Type>
-    static void basic_vtable([[maybe_unused]] const operation op, [[maybe_unused]] const any &value, [[maybe_unused]] void *other) {
+    static void basic_vtable([[maybe_unused]] const operation op, [[maybe_unused]] const meta_any_storage &value, [[maybe_unused]] void *other) {
         static_assert(std::is_same_v<std::remove_reference_t<std::remove_const_t<Type>>, Type>, "Invalid type");
 
         if constexpr(!std::is_void_v<Type>) {
@@ -172,12 +204,12 @@ class meta_any {
                 break;
             case operation::seq:
                 if constexpr(is_complete_v<meta_sequence_container_traits<Type>>) {
-                    *static_cast<meta_sequence_container *>(other) = {std::in_place_type<Type>, std::move(const_cast<any &>(value))};
+                    *static_cast<meta_sequence_container *>(other) = {std::in_place_type<Type>, std::move(const_cast<meta_any_storage &>(value))};
                 }
                 break;
             case operation::assoc:
                 if constexpr(is_complete_v<meta_associative_container_traits<Type>>) {
-                    *static_cast<meta_associative_container *>(other) = {std::in_place_type<Type>, std::move(const_cast<any &>(value))};
+                    *static_cast<meta_associative_container *>(other) = {std::in_place_type<Type>, std::move(const_cast<meta_any_storage &>(value))};
                 }
                 break;
             }
@@ -190,7 +222,7 @@ class meta_any {
         }
     }
 
-    meta_any(const meta_any &other, any ref) ENTT_NOEXCEPT
+    meta_any(const meta_any &other, meta_any_storage ref) ENTT_NOEXCEPT
         : storage{std::move(ref)},
           node{storage ? other.node : nullptr},
           vtable{storage ? other.vtable : &basic_vtable<void>} {}
@@ -214,6 +246,21 @@ public:
           node{internal::meta_node<std::remove_const_t<std::remove_reference_t<Type>>>::resolve()},
           vtable{&basic_vtable<std::remove_const_t<std::remove_reference_t<Type>>>} {}
 
+    /**
+     * @brief Constructs a wrapper by directly initializing the new object and
+     * using a given allocator for it, if required.
+     * @tparam Allocator Type of allocator used to manage the object.
+     * @tparam Type Type of object to use to initialize the wrapper.
+     * @tparam Args Types of arguments to use to construct the new instance.
+     * @param allocator The allocator to use.
+     * @param args Parameters to use to construct the instance.
+     */
+    template<typename Allocator, typename Type, typename... Args>
+    meta_any(std::allocator_arg_t, const Allocator &allocator, std::in_place_type_t<Type>, Args &&...args)
+        : storage{std::allocator_arg, allocator, std::in_place_type<Type>, std::forward<Args>(args)...},
+          node{internal::meta_node<std::remove_const_t<std::remove_reference_t<Type>>>::resolve()},
+          vtable{&basic_vtable<std::remove_const_t<std::remove_reference_t<Type>>>} {}
+
     /**
      * @brief Constructs a wrapper from a given value.
      * @tparam Type Type of object to use to initialize the wrapper.
@@ -346,12 +393,9 @@ public:
         if(const auto &info = type_id<Type>(); node && *node->info == info) {
             return any_cast<Type>(&storage);
         } else if(node) {
-            for(auto *it = node->base; it; it = it->next) {
-                const auto as_const = it->cast(as_ref());
-
-                if(const Type *base = as_const.template try_cast<Type>(); base) {
-                    return base;
-                }
+            if(const auto *base = internal::find_cast_path(node, info); base) {
+                const auto as_const = base->cast(as_ref());
+                return as_const.template try_cast<Type>();
             }
         }
 
@@ -364,10 +408,8 @@ public:
         if(const auto &info = type_id<Type>(); node && *node->info == info) {
             return any_cast<Type>(&storage);
         } else if(node) {
-            for(auto *it = node->base; it; it = it->next) {
-                if(Type *base = it->cast(as_ref()).template try_cast<Type>(); base) {
-                    return base;
-                }
+            if(const auto *base = internal::find_cast_path(node, info); base) {
+                return base->cast(as_ref()).template try_cast<Type>();
             }
         }
 
@@ -456,7 +498,7 @@ public:
                 return true;
             }
 
-            return (static_cast<constness_as_t<any, std::remove_reference_t<const Type>> &>(storage).data() != nullptr);
+            return (static_cast<constness_as_t<meta_any_storage, std::remove_reference_t<const Type>> &>(storage).data() != nullptr);
         }
 
         return false;
@@ -490,7 +532,7 @@ public:
      * @return A sequence container proxy for the underlying object.
      */
     [[nodiscard]] meta_sequence_container as_sequence_container() ENTT_NOEXCEPT {
-        any detached = storage.as_ref();
+        meta_any_storage detached = storage.as_ref();
         meta_sequence_container proxy;
         vtable(operation::seq, detached, &proxy);
         return proxy;
@@ -498,7 +540,7 @@ public:
 
     /*! @copydoc as_sequence_container */
     [[nodiscard]] meta_sequence_container as_sequence_container() const ENTT_NOEXCEPT {
-        any detached = storage.as_ref();
+        meta_any_storage detached = storage.as_ref();
         meta_sequence_container proxy;
         vtable(operation::seq, detached, &proxy);
         return proxy;
@@ -509,7 +551,7 @@ public:
      * @return An associative container proxy for the underlying object.
      */
     [[nodiscard]] meta_associative_container as_associative_container() ENTT_NOEXCEPT {
-        any detached = storage.as_ref();
+        meta_any_storage detached = storage.as_ref();
         meta_associative_container proxy;
         vtable(operation::assoc, detached, &proxy);
         return proxy;
@@ -517,7 +559,7 @@ public:
 
     /*! @copydoc as_associative_container */
     [[nodiscard]] meta_associative_container as_associative_container() const ENTT_NOEXCEPT {
-        any detached = storage.as_ref();
+        meta_any_storage detached = storage.as_ref();
         meta_associative_container proxy;
         vtable(operation::assoc, detached, &proxy);
         return proxy;
@@ -563,7 +605,7 @@ public:
     }
 
 private:
-    any storage;
+    meta_any_storage storage;
     internal::meta_type_node *node;
     vtable_type *vtable;
 };
@@ -784,6 +826,42 @@ struct meta_data {
         return node->get(std::move(instance));
     }
 
+    /**
+     * @brief Gets the values of a given variable for a range of instances.
+     *
+     * The elements of the range must be of the parent type of the data
+     * member and the values are converted to the given type.<br/>
+     * Members registered directly and whose type is exactly the requested one
+     * are read in place, without wrapping either the instances or the values.
+     * All other variables go through the type-erased getter, one element at a
+     * time.
+     *
+     * @tparam Type Type of values to return.
+     * @tparam It Type of input iterator.
+     * @tparam Out Type of output iterator.
+     * @param first An iterator to the first element of the range of instances.
+     * @param last An iterator past the last element of the range of instances.
+     * @param out An output iterator to which to assign the values.
+     * @return An iterator past the last value assigned.
+     */
+    template<typename Type, typename It, typename Out>
+    Out get_n(It first, It last, Out out) const {
+        using value_type = std::remove_const_t<std::remove_reference_t<decltype(*first)>>;
+        static_assert(std::is_same_v<std::remove_cv_t<Type>, Type>, "Invalid value type");
+
+        if(first != last && node->field && type_id<Type>() == *node->type->info && node->field(type_id<value_type>(), std::addressof(*first))) {
+            for(; first != last; ++first, ++out) {
+                *out = *static_cast<const Type *>(node->field(type_id<value_type>(), std::addressof(*first)));
+            }
+        } else {
+            for(; first != last; ++first, ++out) {
+                *out = get(*first).template cast<Type>();
+            }
+        }
+
+        return out;
+    }
+
     /**
      * @brief Returns the type accepted by the i-th setter.
      * @param index Index of the setter of which to return the accepted type.
@@ -805,13 +883,7 @@ struct meta_data {
      * @return The registered meta property for the given key, if any.
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
-        for(auto curr: prop()) {
-            if(curr.key() == key) {
-                return curr;
-            }
-        }
-
-        return nullptr;
+        return internal::meta_find_prop(node->prop, node->prop_index, key);
     }
 
     /**
@@ -894,7 +966,7 @@ struct meta_func {
      * @return A wrapper containing the returned value, if any.
      */
     meta_any invoke(meta_handle instance, meta_any *const args, const size_type sz) const {
-        return sz == arity() ? node->invoke(std::move(instance), args) : meta_any{};
+        return sz == arity() ? node->invoke(std::move(instance), args, nullptr) : meta_any{};
     }
 
     /**
@@ -913,6 +985,91 @@ struct meta_func {
         return invoke(std::move(instance), arguments, sizeof...(Args));
     }
 
+    /**
+     * @brief Invokes the underlying function for a range of instances.
+     *
+     * The elements of the range must be of the parent type of the member
+     * function and the returned values are discarded.<br/>
+     * Arguments are converted only once for all the instances when the
+     * elements are non-const objects of exactly the parent type. Instances are
+     * then passed to the function in place, without wrapping them. All other
+     * elements go through the type-erased invoke, one element at a time.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @param first An iterator to the first element of the range of instances.
+     * @param last An iterator past the last element of the range of instances.
+     * @param args Parameters to use to invoke the function.
+     * @return The number of instances for which the function was invoked.
+     */
+    template<typename It, typename... Args>
+    size_type invoke_n(It first, It last, Args &&...args) const {
+        using reference = decltype(*first);
+
+        struct range_type {
+            It first;
+            It last;
+            size_type count;
+        };
+
+        if(sizeof...(Args) != arity()) {
+            return 0u;
+        }
+
+        meta_any arguments[sizeof...(Args) + 1u]{std::forward<Args>(args)...};
+        size_type count{};
+
+        if constexpr(std::is_lvalue_reference_v<reference> && !std::is_const_v<std::remove_reference_t<reference>>) {
+            range_type range{first, last, 0u};
+
+            auto next = +[](void *value) -> void * {
+                auto &curr = *static_cast<range_type *>(value);
+
+                if(curr.first == curr.last) {
+                    return nullptr;
+                }
+
+                void *instance = std::addressof(*curr.first);
+                ++curr.first;
+                ++curr.count;
+                return instance;
+            };
+
+            if(first != last && node->invoke_n && node->invoke_n(type_id<std::remove_reference_t<reference>>(), arguments, next, &range)) {
+                return range.count;
+            }
+        }
+
+        for(; first != last; ++first) {
+            count += static_cast<bool>(invoke(*first, arguments, sizeof...(Args)));
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Invokes the underlying function by reference and stores the
+     * returned value in a given object, if any.
+     *
+     * Arguments aren't copied. Instead, the function receives references to
+     * the given objects. The returned value is assigned directly to the given
+     * object when their types match, otherwise it's converted if possible.<br/>
+     * Nothing is allocated along the way in the first case.
+     *
+     * @tparam Type Type of object in which to store the returned value.
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @param ret An object in which to store the returned value.
+     * @param instance An opaque instance of the underlying type.
+     * @param args Parameters to use to invoke the function.
+     * @return True in case of success, false otherwise.
+     */
+    template<typename Type, typename... Args>
+    bool invoke_into(Type &ret, meta_handle instance, Args &&...args) const {
+        meta_any arguments[sizeof...(Args) + 1u]{meta_handle{args}->as_ref()...};
+        meta_handle result{ret};
+        return (sizeof...(Args) == arity()) && static_cast<bool>(node->invoke(std::move(instance), arguments, result.operator->()));
+    }
+
     /*! @copydoc meta_data::prop */
     [[nodiscard]] meta_range<meta_prop> prop() const ENTT_NOEXCEPT {
         return node->prop;
@@ -924,13 +1081,7 @@ struct meta_func {
      * @return The registered meta property for the given key, if any.
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
-        for(auto curr: prop()) {
-            if(curr.key() == key) {
-                return curr;
-            }
-        }
-
-        return nullptr;
+        return internal::meta_find_prop(node->prop, node->prop_index, key);
     }
 
     /**
@@ -947,8 +1098,8 @@ private:
 
 /*! @brief Opaque wrapper for types. */
 class meta_type {
-    template<auto Member, typename Pred>
-    [[nodiscard]] std::decay_t<decltype(std::declval<internal::meta_type_node>().*Member)> lookup(meta_any *const args, const typename internal::meta_type_node::size_type sz, Pred pred) const {
+    template<auto Member, typename Pred, typename Func>
+    [[nodiscard]] std::decay_t<decltype(std::declval<internal::meta_type_node>().*Member)> lookup(Func arg, const typename internal::meta_type_node::size_type sz, Pred pred) const {
         std::decay_t<decltype(node->*Member)> candidate{};
         size_type extent{sz + 1u};
         bool ambiguous{};
@@ -958,8 +1109,8 @@ class meta_type {
                 size_type direct{};
                 size_type ext{};
 
-                for(size_type next{}; next < sz && next == (direct + ext) && args[next]; ++next) {
-                    const auto type = args[next].type();
+                for(size_type next{}; next < sz && next == (direct + ext) && arg(next); ++next) {
+                    const auto type = arg(next);
                     const auto other = curr->arg(next);
 
                     if(const auto &info = other.info(); info == type.info()) {
@@ -986,6 +1137,47 @@ class meta_type {
         return (candidate && !ambiguous) ? candidate : decltype(candidate){};
     }
 
+    template<typename Func>
+    [[nodiscard]] const internal::meta_func_node *overload(const id_type id, Func arg, const typename internal::meta_type_node::size_type sz) const {
+        auto hash_of = [&arg](const size_type pos) {
+            const auto type = arg(pos);
+            return type ? type.info().hash() : id_type{};
+        };
+
+        std::size_t digest = static_cast<std::size_t>(id);
+
+        for(size_type pos{}; pos < sz; ++pos) {
+            digest ^= static_cast<std::size_t>(hash_of(pos)) + 0x9e3779b9u + (digest << 6u) + (digest >> 2u);
+        }
+
+        auto &cache = internal::meta_context::global()->overload;
+        const std::pair<const internal::meta_type_node *, std::size_t> key{node, digest};
+
+        if(const auto *cached = cache.try_get(key); cached && cached->args.size() == (sz + 1u) && cached->args[0u] == id) {
+            size_type pos{};
+            for(; pos < sz && cached->args[pos + 1u] == hash_of(pos); ++pos) {}
+
+            if(pos == sz) {
+                return cached->func;
+            }
+        }
+
+        const auto *candidate = lookup<&internal::meta_type_node::func>(arg, sz, [id](const auto *curr) { return curr->id == id; });
+
+        for(auto it = base().begin(), last = base().end(); it != last && !candidate; ++it) {
+            candidate = it->lookup<&internal::meta_type_node::func>(arg, sz, [id](const auto *curr) { return curr->id == id; });
+        }
+
+        internal::meta_overload entry{candidate, {id}};
+
+        for(size_type pos{}; pos < sz; ++pos) {
+            entry.args.push_back(hash_of(pos));
+        }
+
+        cache.insert_or_assign(key, std::move(entry));
+        return candidate;
+    }
+
 public:
     /*! @brief Node type. */
     using node_type = internal::meta_type_node;
@@ -1029,6 +1221,20 @@ public:
         return node->size_of;
     }
 
+    /**
+     * @brief Returns the memory layout of the underlying type, if any.
+     *
+     * Layouts are available for all the types that are at least movable and
+     * destructible. They allow to create and manage objects of the underlying
+     * type in raw memory, for example in the storage of a registry.
+     *
+     * @return The layout of the underlying type if any, a null pointer
+     * otherwise.
+     */
+    [[nodiscard]] const type_layout *layout() const ENTT_NOEXCEPT {
+        return node->layout;
+    }
+
     /**
      * @brief Checks whether a type refers to an arithmetic type or not.
      * @return True if the underlying type is an arithmetic type, false
@@ -1192,6 +1398,25 @@ public:
         return internal::find_by<&node_type::func>(id, node);
     }
 
+    /**
+     * @brief Lookup function for registered meta functions that accept a given
+     * list of arguments.
+     *
+     * Overload resolution is the same as for `invoke`, so that the returned
+     * function can be invoked in place of the latter with arguments of the
+     * given types.
+     *
+     * @tparam Args Types of arguments with which to invoke the function.
+     * @param id Unique identifier.
+     * @return The registered meta function for the given identifier and
+     * arguments, if any.
+     */
+    template<typename... Args>
+    [[nodiscard]] meta_func func(const id_type id) const {
+        const meta_type args[sizeof...(Args) + 1u]{internal::meta_node<std::remove_const_t<std::remove_reference_t<Args>>>::resolve()...};
+        return overload(id, [&args](const size_type pos) { return args[pos]; }, sizeof...(Args));
+    }
+
     /**
      * @brief Creates an instance of the underlying type, if possible.
      *
@@ -1204,7 +1429,7 @@ public:
      * @return A wrapper containing the new instance, if any.
      */
     [[nodiscard]] meta_any construct(meta_any *const args, const size_type sz) const {
-        const auto *candidate = lookup<&node_type::ctor>(args, sz, [](const auto *) { return true; });
+        const auto *candidate = lookup<&node_type::ctor>([args](const size_type pos) { return args[pos] ? args[pos].type() : meta_type{}; }, sz, [](const auto *) { return true; });
         return candidate ? candidate->invoke(args) : ((!sz && node->default_constructor) ? node->default_constructor() : meta_any{});
     }
 
@@ -1238,13 +1463,8 @@ public:
      * @return A wrapper containing the returned value, if any.
      */
     meta_any invoke(const id_type id, meta_handle instance, meta_any *const args, const size_type sz) const {
-        const auto *candidate = lookup<&node_type::func>(args, sz, [id](const auto *curr) { return curr->id == id; });
-
-        for(auto it = base().begin(), last = base().end(); it != last && !candidate; ++it) {
-            candidate = it->lookup<&node_type::func>(args, sz, [id](const auto *curr) { return curr->id == id; });
-        }
-
-        return candidate ? candidate->invoke(std::move(instance), args) : meta_any{};
+        const auto *candidate = overload(id, [args](const size_type pos) { return args[pos] ? args[pos].type() : meta_type{}; }, sz);
+        return candidate ? candidate->invoke(std::move(instance), args, nullptr) : meta_any{};
     }
 
     /**
@@ -1316,7 +1536,17 @@ public:
      * @return The registered meta property for the given key, if any.
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
-        return internal::find_by<&internal::meta_type_node::prop>(key, node);
+        if(const auto *curr = internal::meta_find_prop(node->prop, node->prop_index, key); curr) {
+            return curr;
+        }
+
+        for(auto *curr = node->base; curr; curr = curr->next) {
+            if(auto elem = meta_type{curr->type}.prop(key.as_ref()); elem) {
+                return elem;
+            }
+        }
+
+        return nullptr;
     }
 
     /**
@@ -1354,6 +1584,68 @@ private:
     return node;
 }
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+[[nodiscard]] inline std::size_t meta_prop_digest(const meta_any &key) {
+    if(!key) {
+        return {};
+    }
+
+    const auto type = key.type();
+    auto digest = static_cast<std::size_t>(type.info().hash());
+
+    // equal keys must share the digest, values are mixed in only when comparing them is cheap
+    if(const auto *str = key.try_cast<const hashed_string>(); str) {
+        digest ^= std::hash<id_type>{}(str->value()) + 0x9e3779b9u + (digest << 6u) + (digest >> 2u);
+    } else if(type.is_arithmetic() || type.is_enum()) {
+        digest ^= std::hash<double>{}(key.allow_cast<double>().cast<double>()) + 0x9e3779b9u + (digest << 6u) + (digest >> 2u);
+    }
+
+    return digest;
+}
+
+[[nodiscard]] inline const meta_prop_node *meta_find_prop(const meta_prop_node *curr, const meta_prop_index &index, const meta_any &key) {
+    if(index.empty()) {
+        for(; curr && !(curr->id == key); curr = curr->next) {}
+        return curr;
+    }
+
+    const auto digest = meta_prop_digest(key);
+    auto it = std::lower_bound(index.cbegin(), index.cend(), digest, [](const auto &elem, const auto value) { return elem.first < value; });
+
+    for(; it != index.cend() && it->first == digest; ++it) {
+        if(it->second->id == key) {
+            return it->second;
+        }
+    }
+
+    return nullptr;
+}
+
+inline void meta_prop_reindex(const meta_prop_node *curr, meta_prop_index &index) {
+    index.clear();
+
+    for(; curr; curr = curr->next) {
+        index.emplace_back(meta_prop_digest(curr->id), curr);
+    }
+
+    // stable, so that the first of two equal keys is still found first
+    std::stable_sort(index.begin(), index.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+    index.shrink_to_fit();
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 template<typename... Args>
 meta_any meta_any::invoke(const id_type id, Args &&...args) const {
     return type().invoke(id, *this, std::forward<Args>(args)...);
@@ -1381,27 +1673,18 @@ bool meta_any::set(const id_type id, Type &&value) {
     if(const auto &info = type.info(); node && *node->info == info) {
         return as_ref();
     } else if(node) {
-        for(auto *it = node->conv; it; it = it->next) {
-            if(*it->type->info == info) {
-                return it->conv(*this);
-            }
-        }
-
-        if(node->conversion_helper && (type.is_arithmetic() || type.is_enum())) {
+        if(const auto path = internal::find_conv_path(node, info, type.is_arithmetic() || type.is_enum()); path.conv) {
+            return path.conv->conv(*this);
+        } else if(path.helper) {
             // exploits the fact that arithmetic types and enums are also default constructible
             auto other = type.construct();
             ENTT_ASSERT(other.node->conversion_helper, "Conversion helper not found");
             const auto value = node->conversion_helper(nullptr, storage.data());
             other.node->conversion_helper(other.storage.data(), &value);
             return other;
-        }
-
-        for(auto *it = node->base; it; it = it->next) {
-            const auto as_const = it->cast(as_ref());
-
-            if(auto other = as_const.allow_cast(type); other) {
-                return other;
-            }
+        } else if(path.base) {
+            const auto as_const = path.base->cast(as_ref());
+            return as_const.allow_cast(type);
         }
     }
 
@@ -1611,6 +1894,32 @@ private:
     return size_fn(storage);
 }
 
+/**
+ * @brief Direct access to the elements of a container, if contiguous.
+ *
+ * Elements are laid out one after the other and are as large as the meta value
+ * type of the container reports. Therefore, they can be read in bulk rather
+ * than through meta iterators.
+ *
+ * @return A pointer to the first element of the container if it's contiguous,
+ * a null pointer otherwise.
+ */
+[[nodiscard]] inline const void *meta_sequence_container::data() const ENTT_NOEXCEPT {
+    return data_fn ? data_fn(storage) : nullptr;
+}
+
+/**
+ * @copybrief data
+ *
+ * Containers wrapped by const reference return a null pointer.
+ *
+ * @return A pointer to the first element of the container if it's contiguous
+ * and modifiable, a null pointer otherwise.
+ */
+[[nodiscard]] inline void *meta_sequence_container::data() ENTT_NOEXCEPT {
+    return storage.data() ? const_cast<void *>(std::as_const(*this).data()) : nullptr;
+}
+
 /**
  * @brief Resizes a container to contain a given number of elements.
  * @param sz The new size of the container.
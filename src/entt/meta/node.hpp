@@ -4,12 +4,16 @@
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
 #include "../core/attribute.h"
 #include "../core/enum.hpp"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
+#include "ctx.hpp"
 #include "type_traits.hpp"
 
 namespace entt {
@@ -48,6 +52,9 @@ struct meta_prop_node {
     meta_any &value;
 };
 
+// properties are sorted by a digest of their keys when contexts are sealed
+using meta_prop_index = std::vector<std::pair<std::size_t, const meta_prop_node *>>;
+
 struct meta_base_node {
     meta_base_node *next;
     meta_type_node *const type;
@@ -79,6 +86,8 @@ struct meta_data_node {
     meta_type (*const arg)(const size_type) ENTT_NOEXCEPT;
     bool (*const set)(meta_handle, meta_any);
     meta_any (*const get)(meta_handle);
+    const void *(*const field)(const type_info &, const void *) ENTT_NOEXCEPT{nullptr};
+    meta_prop_index prop_index{};
 };
 
 struct meta_func_node {
@@ -90,7 +99,9 @@ struct meta_func_node {
     const size_type arity;
     meta_type_node *const ret;
     meta_type (*const arg)(const size_type) ENTT_NOEXCEPT;
-    meta_any (*const invoke)(meta_handle, meta_any *const);
+    meta_any (*const invoke)(meta_handle, meta_any *const, meta_any *const);
+    bool (*const invoke_n)(const type_info &, meta_any *const, void *(*)(void *), void *){nullptr};
+    meta_prop_index prop_index{};
 };
 
 struct meta_template_node {
@@ -108,6 +119,7 @@ struct meta_type_node {
     meta_type_node *next;
     meta_prop_node *prop;
     const size_type size_of;
+    const type_layout *const layout;
     meta_any (*const default_constructor)();
     double (*const conversion_helper)(void *, const void *);
     const meta_template_node *const templ;
@@ -117,6 +129,9 @@ struct meta_type_node {
     meta_data_node *data{nullptr};
     meta_func_node *func{nullptr};
     void (*dtor)(void *){nullptr};
+    dense_map<id_type, meta_data_node *, identity> data_index{};
+    dense_map<id_type, meta_func_node *, identity> func_index{};
+    meta_prop_index prop_index{};
 };
 
 template<typename... Args>
@@ -134,6 +149,14 @@ class ENTT_API meta_node {
         }
     }
 
+    [[nodiscard]] static const type_layout *meta_layout() ENTT_NOEXCEPT {
+        if constexpr(std::is_object_v<Type> && std::is_move_constructible_v<Type> && std::is_destructible_v<Type>) {
+            return &type_layout_of<Type>();
+        } else {
+            return nullptr;
+        }
+    }
+
     [[nodiscard]] static auto *meta_conversion_helper() ENTT_NOEXCEPT {
         if constexpr(std::is_arithmetic_v<Type>) {
             return +[](void *bin, const void *value) {
@@ -180,6 +203,7 @@ public:
             nullptr,
             nullptr,
             size_of_v<Type>,
+            meta_layout(),
             meta_default_constructor(),
             meta_conversion_helper(),
             meta_template_info()
@@ -198,18 +222,28 @@ template<typename... Args>
 
 template<auto Member, typename Type>
 [[nodiscard]] static std::decay_t<decltype(std::declval<internal::meta_type_node>().*Member)> find_by(const Type &info_or_id, const internal::meta_type_node *node) ENTT_NOEXCEPT {
-    for(auto *curr = node->*Member; curr; curr = curr->next) {
-        if constexpr(std::is_same_v<Type, type_info>) {
-            if(*curr->type->info == info_or_id) {
-                return curr;
-            }
-        } else if constexpr(std::is_same_v<decltype(curr), meta_base_node *>) {
-            if(curr->type->id == info_or_id) {
-                return curr;
-            }
-        } else {
-            if(curr->id == info_or_id) {
-                return curr;
+    if constexpr(std::is_same_v<decltype(Member), meta_data_node *meta_type_node::*>) {
+        if(const auto it = node->data_index.find(info_or_id); it != node->data_index.cend()) {
+            return it->second;
+        }
+    } else if constexpr(std::is_same_v<decltype(Member), meta_func_node *meta_type_node::*>) {
+        if(const auto it = node->func_index.find(info_or_id); it != node->func_index.cend()) {
+            return it->second;
+        }
+    } else {
+        for(auto *curr = node->*Member; curr; curr = curr->next) {
+            if constexpr(std::is_same_v<Type, type_info>) {
+                if(*curr->type->info == info_or_id) {
+                    return curr;
+                }
+            } else if constexpr(std::is_same_v<decltype(curr), meta_base_node *>) {
+                if(curr->type->id == info_or_id) {
+                    return curr;
+                }
+            } else {
+                if(curr->id == info_or_id) {
+                    return curr;
+                }
             }
         }
     }
@@ -223,6 +257,62 @@ template<auto Member, typename Type>
     return nullptr;
 }
 
+[[nodiscard]] inline const meta_base_node *find_cast_path(const meta_type_node *from, const type_info &to) {
+    if(!from->base) {
+        return nullptr;
+    }
+
+    auto &cache = meta_context::global()->cast;
+    const std::pair<const meta_type_node *, id_type> key{from, to.hash()};
+
+    if(const auto *path = cache.try_get(key); path) {
+        return *path;
+    }
+
+    const meta_base_node *path = nullptr;
+
+    for(auto *curr = from->base; curr && !path; curr = curr->next) {
+        if(*curr->type->info == to || find_cast_path(curr->type, to)) {
+            path = curr;
+        }
+    }
+
+    cache.insert(std::make_pair(key, path));
+    return path;
+}
+
+[[nodiscard]] inline meta_conv_path find_conv_path(const meta_type_node *from, const type_info &to, const bool arithmetic) {
+    if(!from->base && !from->conv) {
+        return {nullptr, nullptr, from->conversion_helper && arithmetic};
+    }
+
+    auto &cache = meta_context::global()->conv;
+    const std::pair<const meta_type_node *, id_type> key{from, to.hash()};
+
+    if(const auto *path = cache.try_get(key); path) {
+        return *path;
+    }
+
+    meta_conv_path path{};
+
+    for(auto *curr = from->conv; curr && !path.conv; curr = curr->next) {
+        if(*curr->type->info == to) {
+            path.conv = curr;
+        }
+    }
+
+    path.helper = !path.conv && from->conversion_helper && arithmetic;
+
+    for(auto *curr = from->base; curr && !(path.conv || path.helper || path.base); curr = curr->next) {
+        if(const auto other = find_conv_path(curr->type, to, arithmetic); *curr->type->info == to || other.base || other.conv || other.helper) {
+            path.base = curr;
+        }
+    }
+
+    cache.insert(std::make_pair(key, path));
+    return path;
+}
+
 } // namespace internal
 
 /**
@@ -1,7 +1,7 @@
 #ifndef ENTT_META_RESOLVE_HPP
 #define ENTT_META_RESOLVE_HPP
 
-#include <algorithm>
+#include <type_traits>
 #include "../core/type_info.hpp"
 #include "ctx.hpp"
 #include "meta.hpp"
@@ -17,7 +17,9 @@ namespace entt {
  */
 template<typename Type>
 [[nodiscard]] meta_type resolve() ENTT_NOEXCEPT {
-    return internal::meta_node<std::remove_const_t<std::remove_reference_t<Type>>>::resolve();
+    using type = std::remove_const_t<std::remove_reference_t<Type>>;
+    internal::meta_context::global()->materialize(&internal::meta_context::lazy_info, type_id<type>().hash());
+    return internal::meta_node<type>::resolve();
 }
 
 /**
@@ -25,7 +27,7 @@ template<typename Type>
  * @return An iterable range to use to visit all meta types.
  */
 [[nodiscard]] inline meta_range<meta_type> resolve() ENTT_NOEXCEPT {
-    return *internal::meta_context::global();
+    return internal::meta_context::global()->chain;
 }
 
 /**
@@ -34,13 +36,13 @@ template<typename Type>
  * @return The meta type associated with the given identifier, if any.
  */
 [[nodiscard]] inline meta_type resolve(const id_type id) ENTT_NOEXCEPT {
-    for(auto &&curr: resolve()) {
-        if(curr.id() == id) {
-            return curr;
-        }
+    auto *context = internal::meta_context::global();
+
+    if(const auto it = context->id.find(id); it != context->id.cend()) {
+        return it->second;
     }
 
-    return {};
+    return context->materialize(&internal::meta_context::lazy_id, id) ? resolve(id) : meta_type{};
 }
 
 /**
@@ -49,13 +51,13 @@ template<typename Type>
  * @return The meta type associated with the given type info object, if any.
  */
 [[nodiscard]] inline meta_type resolve(const type_info &info) ENTT_NOEXCEPT {
-    for(auto &&curr: resolve()) {
-        if(curr.info() == info) {
-            return curr;
-        }
+    auto *context = internal::meta_context::global();
+
+    if(const auto it = context->info.find(info.hash()); it != context->info.cend()) {
+        return it->second;
     }
 
-    return {};
+    return context->materialize(&internal::meta_context::lazy_info, info.hash()) ? resolve(info) : meta_type{};
 }
 
 } // namespace entt
@@ -3,9 +3,11 @@
 
 #include <cstddef>
 #include <functional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "meta.hpp"
 #include "node.hpp"
@@ -273,36 +275,73 @@ template<typename Type, auto Data, typename Policy = as_is_t>
 namespace internal {
 
 template<typename Type, typename Policy, typename Candidate, typename... Args>
-[[nodiscard]] meta_any meta_invoke_with_args(Candidate &&candidate, Args &&...args) {
-    if constexpr(std::is_same_v<std::invoke_result_t<decltype(candidate), Args...>, void>) {
+[[nodiscard]] meta_any meta_invoke_with_args([[maybe_unused]] meta_any *const ret, Candidate &&candidate, Args &&...args) {
+    using result_type = std::invoke_result_t<decltype(candidate), Args...>;
+
+    if constexpr(std::is_same_v<result_type, void>) {
         std::invoke(candidate, args...);
         return meta_any{std::in_place_type<void>};
+    } else if(ret) {
+        if constexpr(std::is_same_v<Policy, as_void_t>) {
+            std::invoke(candidate, args...);
+            return meta_any{std::in_place_type<void>};
+        } else {
+            // the returned value is assigned in place whenever possible, so as not to box it
+            if constexpr(std::is_assignable_v<std::remove_cv_t<std::remove_reference_t<result_type>> &, result_type>) {
+                if(auto *slot = ret->try_cast<std::remove_cv_t<std::remove_reference_t<result_type>>>(); slot) {
+                    *slot = std::invoke(candidate, args...);
+                    return meta_any{std::in_place_type<void>};
+                }
+            }
+
+            return ret->assign(meta_dispatch<Policy>(std::invoke(candidate, args...))) ? meta_any{std::in_place_type<void>} : meta_any{};
+        }
     } else {
         return meta_dispatch<Policy>(std::invoke(candidate, args...));
     }
 }
 
 template<typename Type, typename Policy, typename Candidate, std::size_t... Index>
-[[nodiscard]] meta_any meta_invoke([[maybe_unused]] meta_handle instance, Candidate &&candidate, [[maybe_unused]] meta_any *args, std::index_sequence<Index...>) {
+[[nodiscard]] meta_any meta_invoke([[maybe_unused]] meta_handle instance, Candidate &&candidate, [[maybe_unused]] meta_any *args, std::index_sequence<Index...>, [[maybe_unused]] meta_any *const ret = nullptr) {
     using descriptor = meta_function_helper_t<Type, std::remove_reference_t<Candidate>>;
 
     if constexpr(std::is_invocable_v<std::remove_reference_t<Candidate>, const Type &, type_list_element_t<Index, typename descriptor::args_type>...>) {
         if(const auto *const clazz = instance->try_cast<const Type>(); clazz && ((args + Index)->allow_cast<type_list_element_t<Index, typename descriptor::args_type>>() && ...)) {
-            return meta_invoke_with_args<Type, Policy>(std::forward<Candidate>(candidate), *clazz, (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
+            return meta_invoke_with_args<Type, Policy>(ret, std::forward<Candidate>(candidate), *clazz, (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
         }
     } else if constexpr(std::is_invocable_v<std::remove_reference_t<Candidate>, Type &, type_list_element_t<Index, typename descriptor::args_type>...>) {
         if(auto *const clazz = instance->try_cast<Type>(); clazz && ((args + Index)->allow_cast<type_list_element_t<Index, typename descriptor::args_type>>() && ...)) {
-            return meta_invoke_with_args<Type, Policy>(std::forward<Candidate>(candidate), *clazz, (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
+            return meta_invoke_with_args<Type, Policy>(ret, std::forward<Candidate>(candidate), *clazz, (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
         }
     } else {
         if(((args + Index)->allow_cast<type_list_element_t<Index, typename descriptor::args_type>>() && ...)) {
-            return meta_invoke_with_args<Type, Policy>(std::forward<Candidate>(candidate), (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
+            return meta_invoke_with_args<Type, Policy>(ret, std::forward<Candidate>(candidate), (args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...);
         }
     }
 
     return meta_any{};
 }
 
+template<typename Type, typename Candidate, std::size_t... Index>
+[[nodiscard]] bool meta_invoke_n([[maybe_unused]] const type_info &info, [[maybe_unused]] meta_any *const args, [[maybe_unused]] void *(*next)(void *), [[maybe_unused]] void *range, [[maybe_unused]] Candidate &&candidate, std::index_sequence<Index...>) {
+    using descriptor = meta_function_helper_t<Type, std::remove_reference_t<Candidate>>;
+
+    if constexpr(!descriptor::is_static && ((std::is_reference_v<type_list_element_t<Index, typename descriptor::args_type>> || std::is_copy_constructible_v<type_list_element_t<Index, typename descriptor::args_type>>)&&...)) {
+        if(info == type_id<Type>() && ((args + Index)->allow_cast<type_list_element_t<Index, typename descriptor::args_type>>() && ...)) {
+            // arguments are converted once and shared by all instances
+            std::tuple<decltype((args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>())...> params{(args + Index)->cast<type_list_element_t<Index, typename descriptor::args_type>>()...};
+
+            for(auto *instance = next(range); instance; instance = next(range)) {
+                std::invoke(candidate, *static_cast<Type *>(instance), std::get<Index>(params)...);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 template<typename Type, typename... Args, std::size_t... Index>
 [[nodiscard]] meta_any meta_construct(meta_any *const args, std::index_sequence<Index...>) {
     if(((args + Index)->allow_cast<Args>() && ...)) {
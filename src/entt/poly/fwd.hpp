@@ -16,6 +16,16 @@ class basic_poly;
 template<typename Concept>
 using poly = basic_poly<Concept>;
 
+template<typename, std::size_t Len = sizeof(double[2]), std::size_t = alignof(typename std::aligned_storage_t<Len + !Len>)>
+class basic_poly_vector;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Concept Concept descriptor.
+ */
+template<typename Concept>
+using poly_vector = basic_poly_vector<Concept>;
+
 } // namespace entt
 
 #endif
@@ -98,10 +98,11 @@ class poly_vtable {
 
     using vtable_type = decltype(make_vtable(Concept{}));
     static constexpr bool is_mono_v = std::tuple_size_v<vtable_type> == 1u;
+    static constexpr bool is_inline_v = std::tuple_size_v<vtable_type> <= ENTT_POLY_INLINE_VTABLE;
 
 public:
     /*! @brief Virtual table type. */
-    using type = std::conditional_t<is_mono_v, std::tuple_element_t<0u, vtable_type>, const vtable_type *>;
+    using type = std::conditional_t<is_mono_v, std::tuple_element_t<0u, vtable_type>, std::conditional_t<is_inline_v, vtable_type, const vtable_type *>>;
 
     /**
      * @brief Returns a static virtual table for a specific concept and type.
@@ -115,6 +116,8 @@ public:
 
         if constexpr(is_mono_v) {
             return std::get<0>(vtable);
+        } else if constexpr(is_inline_v) {
+            return vtable;
         } else {
             return &vtable;
         }
@@ -141,6 +144,8 @@ struct poly_base {
 
         if constexpr(std::is_function_v<std::remove_pointer_t<decltype(poly.vtable)>>) {
             return poly.vtable(poly.storage, std::forward<Args>(args)...);
+        } else if constexpr(!std::is_pointer_v<decltype(poly.vtable)>) {
+            return std::get<Member>(poly.vtable)(poly.storage, std::forward<Args>(args)...);
         } else {
             return std::get<Member>(*poly.vtable)(poly.storage, std::forward<Args>(args)...);
         }
@@ -154,6 +159,8 @@ struct poly_base {
         if constexpr(std::is_function_v<std::remove_pointer_t<decltype(poly.vtable)>>) {
             static_assert(Member == 0u, "Unknown member");
             return poly.vtable(poly.storage, std::forward<Args>(args)...);
+        } else if constexpr(!std::is_pointer_v<decltype(poly.vtable)>) {
+            return std::get<Member>(poly.vtable)(poly.storage, std::forward<Args>(args)...);
         } else {
             return std::get<Member>(*poly.vtable)(poly.storage, std::forward<Args>(args)...);
         }
@@ -216,6 +223,24 @@ public:
         : storage{std::in_place_type<Type>, std::forward<Args>(args)...},
           vtable{poly_vtable<Concept, Len, Align>::template instance<std::remove_const_t<std::remove_reference_t<Type>>>()} {}
 
+    /**
+     * @brief Constructs a poly by directly initializing the new object and
+     * using a given allocator for it, if required.
+     *
+     * The allocator is only used for objects that don't fit the internal
+     * storage. In this case, it's also used for all copies of the poly.
+     *
+     * @tparam Allocator Type of allocator used to manage the object.
+     * @tparam Type Type of object to use to initialize the poly.
+     * @tparam Args Types of arguments to use to construct the new instance.
+     * @param allocator The allocator to use.
+     * @param args Parameters to use to construct the instance.
+     */
+    template<typename Allocator, typename Type, typename... Args>
+    basic_poly(std::allocator_arg_t, const Allocator &allocator, std::in_place_type_t<Type>, Args &&...args)
+        : storage{std::allocator_arg, allocator, std::in_place_type<Type>, std::forward<Args>(args)...},
+          vtable{poly_vtable<Concept, Len, Align>::template instance<std::remove_const_t<std::remove_reference_t<Type>>>()} {}
+
     /**
      * @brief Constructs a poly from a given value.
      * @tparam Type Type of object to use to initialize the poly.
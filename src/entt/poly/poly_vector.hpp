@@ -0,0 +1,210 @@
+#ifndef ENTT_POLY_POLY_VECTOR_HPP
+#define ENTT_POLY_POLY_VECTOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/any.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "fwd.hpp"
+#include "poly.hpp"
+
+namespace entt {
+
+/**
+ * @brief Sequence of poly objects grouped by concrete type.
+ *
+ * Elements aren't stored as poly objects. Instead, they're packed in an array
+ * per concrete type and each array shares a single virtual table. Therefore,
+ * iterating the elements visits contiguous memory and jumps to the same
+ * functions over and over for all the elements of a type.<br/>
+ * Elements are returned as poly objects that refer to them. It's also possible
+ * to visit the elements of a given type directly, with no indirections at all.
+ *
+ * @warning
+ * Creating elements of a type invalidates the references to the other elements
+ * of the same type.
+ *
+ * @tparam Concept Concept descriptor.
+ * @tparam Len Size of the storage reserved for the small buffer optimization.
+ * @tparam Align Optional alignment requirement.
+ */
+template<typename Concept, std::size_t Len, std::size_t Align>
+class basic_poly_vector {
+    using poly_type = basic_poly<Concept, Len, Align>;
+
+    struct group_type {
+        basic_any<0u> elements;
+        std::size_t stride;
+        void *(*data)(const basic_any<0u> &);
+        std::size_t (*size)(const basic_any<0u> &);
+        poly_type (*ref)(void *);
+        poly_type (*cref)(const void *);
+    };
+
+    using container_type = dense_map<id_type, group_type, identity>;
+
+    template<typename Type>
+    [[nodiscard]] group_type &assure() {
+        auto &&group = groups[type_hash<Type>::value()];
+
+        if(!group.elements) {
+            group.elements.template emplace<std::vector<Type>>();
+            group.stride = sizeof(Type);
+            group.data = [](const basic_any<0u> &elem) -> void * { return const_cast<Type *>(any_cast<const std::vector<Type> &>(elem).data()); };
+            group.size = [](const basic_any<0u> &elem) { return any_cast<const std::vector<Type> &>(elem).size(); };
+            group.ref = [](void *elem) { return poly_type{std::in_place_type<Type &>, *static_cast<Type *>(elem)}; };
+            group.cref = [](const void *elem) { return poly_type{std::in_place_type<const Type &>, *static_cast<const Type *>(elem)}; };
+        }
+
+        return group;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of poly objects returned to refer to elements. */
+    using value_type = poly_type;
+
+    /**
+     * @brief Creates a new element of a given type at the end of its group.
+     * @tparam Type Type of element to create.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to construct the element.
+     * @return A reference to the newly created element.
+     */
+    template<typename Type, typename... Args>
+    Type &emplace(Args &&...args) {
+        static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Type differs from its decayed form");
+        auto &&container = any_cast<std::vector<Type> &>(assure<Type>().elements);
+
+        if constexpr(std::is_aggregate_v<Type>) {
+            return container.emplace_back(Type{std::forward<Args>(args)...});
+        } else {
+            return container.emplace_back(std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Iterates all the elements, one group at a time, and applies the
+     * given function object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(value_type);
+     * @endcode
+     *
+     * Elements are passed as poly objects that refer to them.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        for(auto &&elem: groups) {
+            auto &group = elem.second;
+            auto *curr = static_cast<std::byte *>(group.data(group.elements));
+
+            for(auto last = curr + group.size(group.elements) * group.stride; curr != last; curr += group.stride) {
+                func(group.ref(curr));
+            }
+        }
+    }
+
+    /*! @copydoc each */
+    template<typename Func>
+    void each(Func func) const {
+        for(auto &&elem: groups) {
+            const auto &group = elem.second;
+            const auto *curr = static_cast<const std::byte *>(group.data(group.elements));
+
+            for(auto last = curr + group.size(group.elements) * group.stride; curr != last; curr += group.stride) {
+                func(group.cref(curr));
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates the elements of a given type and applies the given
+     * function object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(Type &);
+     * @endcode
+     *
+     * @tparam Type Type of elements to iterate.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Type, typename Func>
+    void each(Func func) {
+        if(const auto it = groups.find(type_hash<Type>::value()); it != groups.end()) {
+            for(auto &&elem: any_cast<std::vector<Type> &>(it->second.elements)) {
+                func(elem);
+            }
+        }
+    }
+
+    /*! @copydoc each */
+    template<typename Type, typename Func>
+    void each(Func func) const {
+        if(const auto it = groups.find(type_hash<Type>::value()); it != groups.cend()) {
+            for(auto &&elem: any_cast<const std::vector<Type> &>(it->second.elements)) {
+                func(elem);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements of a given type.
+     * @tparam Type Type of elements to count.
+     * @return Number of elements of the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] size_type size() const {
+        const auto it = groups.find(type_hash<Type>::value());
+        return (it == groups.cend()) ? size_type{} : it->second.size(it->second.elements);
+    }
+
+    /**
+     * @brief Returns the number of elements in a sequence.
+     * @return Number of elements in the sequence.
+     */
+    [[nodiscard]] size_type size() const {
+        size_type count{};
+
+        for(auto &&elem: groups) {
+            count += elem.second.size(elem.second.elements);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Checks whether a sequence is empty.
+     * @return True if the sequence is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const {
+        return (size() == 0u);
+    }
+
+    /*! @brief Clears a sequence. */
+    void clear() {
+        groups.clear();
+    }
+
+private:
+    container_type groups{};
+};
+
+} // namespace entt
+
+#endif
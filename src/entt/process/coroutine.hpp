@@ -0,0 +1,282 @@
+#ifndef ENTT_PROCESS_COROUTINE_HPP
+#define ENTT_PROCESS_COROUTINE_HPP
+
+#include "../config/config.h"
+
+#if defined(__cpp_impl_coroutine)
+#    include <coroutine>
+#    include <optional>
+#    include <utility>
+#    include "../signal/delegate.hpp"
+#    include "../signal/fwd.hpp"
+#    include "process.hpp"
+
+namespace entt {
+
+/**
+ * @brief Process driven by a coroutine.
+ *
+ * A coroutine that returns a process of this type can be attached to a
+ * scheduler like any other process. Its body runs until the first suspension
+ * point the first time the process is updated, then it's resumed once per
+ * tick or as soon as the awaited condition is satisfied.<br/>
+ * The process succeeds when the coroutine completes and it can only fail
+ * because of an explicit abort. The coroutine frame is allocated once, when
+ * the coroutine is invoked, and released along with the process.
+ *
+ * @warning
+ * Exceptions that escape the coroutine propagate from the tick that resumed
+ * it and leave the process in an unspecified state.
+ *
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Delta>
+class coroutine_process: public process<coroutine_process<Delta>, Delta> {
+public:
+    /*! @brief Promise type of the underlying coroutine. */
+    struct promise_type {
+        /**
+         * @brief Returns the process bound to the coroutine.
+         * @return The process bound to the coroutine.
+         */
+        [[nodiscard]] coroutine_process get_return_object() ENTT_NOEXCEPT {
+            return coroutine_process{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        /**
+         * @brief The body of the coroutine runs only on the first update.
+         * @return An awaitable that always suspends the coroutine.
+         */
+        [[nodiscard]] std::suspend_always initial_suspend() const ENTT_NOEXCEPT {
+            return {};
+        }
+
+        /**
+         * @brief The frame is kept alive until the process is destroyed.
+         * @return An awaitable that always suspends the coroutine.
+         */
+        [[nodiscard]] std::suspend_always final_suspend() const ENTT_NOEXCEPT {
+            return {};
+        }
+
+        /*! @brief Completes the coroutine. */
+        void return_void() const ENTT_NOEXCEPT {}
+
+        /*! @brief Propagates exceptions to the caller of the tick. */
+        void unhandled_exception() const {
+            ENTT_THROW;
+        }
+        /*! @brief Condition to satisfy before resuming the coroutine, if any. */
+        delegate<bool(Delta)> ready{};
+    };
+
+    /**
+     * @brief Constructs a process from a coroutine handle.
+     * @param ref A valid coroutine handle.
+     */
+    explicit coroutine_process(std::coroutine_handle<promise_type> ref) ENTT_NOEXCEPT
+        : handle{ref} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    coroutine_process(const coroutine_process &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    coroutine_process(coroutine_process &&other) ENTT_NOEXCEPT
+        : handle{std::exchange(other.handle, nullptr)} {}
+
+    /*! @brief Destroys the coroutine frame, if any. */
+    ~coroutine_process() override {
+        if(handle) {
+            handle.destroy();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This process.
+     */
+    coroutine_process &operator=(const coroutine_process &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This process.
+     */
+    coroutine_process &operator=(coroutine_process &&) = delete;
+
+    /**
+     * @brief Resumes the coroutine if the awaited condition is satisfied.
+     * @param delta Elapsed time.
+     */
+    void update(const Delta delta, void *) {
+        ENTT_ASSERT(handle, "Invalid coroutine");
+        auto &promise = handle.promise();
+
+        // coroutines can also be resumed inline and run to completion between ticks
+        if(handle.done()) {
+            this->succeed();
+        } else if(!promise.ready || promise.ready(delta)) {
+            promise.ready.reset();
+            handle.resume();
+
+            if(handle.done()) {
+                this->succeed();
+            }
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+/*! @brief Suspends a coroutine process until the next tick. */
+struct next_tick {
+    /**
+     * @brief A coroutine is always suspended.
+     * @return False.
+     */
+    [[nodiscard]] bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /*! @brief The coroutine is resumed on the next tick. */
+    void await_suspend(std::coroutine_handle<>) const ENTT_NOEXCEPT {}
+
+    /*! @brief Nothing to return. */
+    void await_resume() const ENTT_NOEXCEPT {}
+};
+
+/**
+ * @brief Suspends a coroutine process for a given amount of time.
+ *
+ * The coroutine is resumed during the first tick for which the accumulated
+ * elapsed time reaches the given delay.
+ *
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Delta>
+class delay {
+    [[nodiscard]] bool elapsed(const Delta delta) ENTT_NOEXCEPT {
+        if(delta < remaining) {
+            remaining -= delta;
+            return false;
+        }
+
+        return true;
+    }
+
+public:
+    /**
+     * @brief Constructs an awaitable for the given amount of time.
+     * @param time Amount of time to wait for.
+     */
+    delay(const Delta time) ENTT_NOEXCEPT
+        : remaining{time} {}
+
+    /**
+     * @brief A coroutine is always suspended.
+     * @return False.
+     */
+    [[nodiscard]] bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /**
+     * @brief Registers the delay with the suspended coroutine.
+     * @param curr A valid coroutine handle.
+     */
+    void await_suspend(std::coroutine_handle<typename coroutine_process<Delta>::promise_type> curr) ENTT_NOEXCEPT {
+        curr.promise().ready.template connect<&delay::elapsed>(*this);
+    }
+
+    /*! @brief Nothing to return. */
+    void await_resume() const ENTT_NOEXCEPT {}
+
+private:
+    Delta remaining;
+};
+
+/**
+ * @brief Suspends a coroutine process until an event is received.
+ *
+ * The coroutine is resumed on the first tick after the event is published by
+ * the dispatcher, either immediately or through its queues. The awaitable
+ * returns a copy of the event.
+ *
+ * @tparam Type Type of event to wait for.
+ * @tparam Dispatcher Type of dispatcher that publishes the event.
+ */
+template<typename Type, typename Dispatcher = dispatcher>
+class wait_event {
+    void receive(const Type &event) {
+        if(!value) {
+            value.emplace(event);
+        }
+    }
+
+    [[nodiscard]] bool received() const ENTT_NOEXCEPT {
+        return value.has_value();
+    }
+
+public:
+    /**
+     * @brief Constructs an awaitable for the given dispatcher.
+     * @param ref A valid reference to a dispatcher.
+     */
+    wait_event(Dispatcher &ref) ENTT_NOEXCEPT
+        : owner{&ref},
+          value{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    wait_event(const wait_event &) = delete;
+
+    /*! @brief Stops listening for events. */
+    ~wait_event() {
+        owner->template sink<Type>().disconnect(*this);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This awaitable.
+     */
+    wait_event &operator=(const wait_event &) = delete;
+
+    /**
+     * @brief A coroutine is always suspended.
+     * @return False.
+     */
+    [[nodiscard]] bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /**
+     * @brief Starts listening for events on behalf of the suspended coroutine.
+     * @tparam Promise Promise type of the coroutine.
+     * @param curr A valid coroutine handle.
+     */
+    template<typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> curr) {
+        owner->template sink<Type>().template connect<&wait_event::receive>(*this);
+        curr.promise().ready.template connect<&wait_event::received>(*this);
+    }
+
+    /**
+     * @brief Returns the event received.
+     * @return A copy of the event received.
+     */
+    [[nodiscard]] Type await_resume() {
+        return std::move(*value);
+    }
+
+private:
+    Dispatcher *owner;
+    std::optional<Type> value;
+};
+
+} // namespace entt
+
+#endif
+
+#endif
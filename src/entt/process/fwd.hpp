@@ -0,0 +1,19 @@
+#ifndef ENTT_PROCESS_FWD_HPP
+#define ENTT_PROCESS_FWD_HPP
+
+#include <memory>
+
+namespace entt {
+
+template<typename, typename>
+class process;
+
+template<typename, typename = std::allocator<void>>
+class scheduler;
+
+template<typename Type, typename = std::allocator<Type>>
+class timer_wheel;
+
+} // namespace entt
+
+#endif
@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
+#include "fwd.hpp"
 
 namespace entt {
 
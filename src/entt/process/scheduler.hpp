@@ -2,16 +2,61 @@
 #define ENTT_PROCESS_SCHEDULER_HPP
 
 #include <algorithm>
-#include <iterator>
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
+#include "fwd.hpp"
 #include "process.hpp"
+#include "timer_wheel.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename, typename = void>
+struct thread_safe_process: std::false_type {};
+
+template<typename Type>
+struct thread_safe_process<Type, std::enable_if_t<Type::thread_safe>>
+    : std::true_type {};
+
+template<typename, typename = void>
+struct process_resources {
+    [[nodiscard]] static const type_info *value() ENTT_NOEXCEPT {
+        return nullptr;
+    }
+};
+
+template<typename Type>
+struct process_resources<Type, std::void_t<typename Type::resources>> {
+    [[nodiscard]] static const type_info *value() ENTT_NOEXCEPT {
+        return &type_id<typename Type::resources>();
+    }
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Cooperative scheduler for processes.
  *
@@ -34,58 +79,311 @@ namespace entt {
  * In order to invoke all scheduled processes, call the `update` member function
  * passing it the elapsed time to forward to the tasks.
  *
+ * Processes are packed by type, both in memory and in the list of running
+ * processes. Therefore, processes of the same type are ticked in a row and
+ * without indirect calls, while the order of execution across types isn't
+ * specified.
+ *
  * @sa process
  *
  * @tparam Delta Type to use to provide elapsed time.
+ * @tparam Allocator Type of allocator used to manage memory and processes.
  */
-template<typename Delta>
+template<typename Delta, typename Allocator>
 class scheduler {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    struct alignas(alignof(std::max_align_t)) block {
+        std::byte data[alignof(std::max_align_t)];
+    };
+
+    using block_allocator = typename alloc_traits::template rebind_alloc<block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+    static constexpr std::size_t page_size = 64u;
+
+    struct slab {
+        using page_container_type = std::vector<block *, typename alloc_traits::template rebind_alloc<block *>>;
+        using free_list_type = std::vector<void *, typename alloc_traits::template rebind_alloc<void *>>;
+
+        template<typename Alloc>
+        slab(const std::size_t length, const Alloc &alloc)
+            : pages{alloc},
+              available{alloc},
+              count{length},
+              live{} {}
+
+        page_container_type pages;
+        free_list_type available;
+        std::size_t count;
+        std::size_t live;
+    };
+
     struct process_handler {
-        using instance_type = std::unique_ptr<void, void (*)(void *)>;
-        using update_fn_type = bool(scheduler &, std::size_t, Delta, void *);
-        using abort_fn_type = void(scheduler &, std::size_t, bool);
-        using next_type = std::unique_ptr<process_handler>;
+        using tick_fn_type = void(void *, Delta, void *);
+        using settle_fn_type = bool(scheduler &, std::size_t, std::size_t);
+        using abort_fn_type = void(void *, bool);
+        using destroy_fn_type = void(scheduler &, std::size_t, void *);
 
-        instance_type instance;
-        update_fn_type *update;
+        void *instance;
+        tick_fn_type *tick;
+        settle_fn_type *settle;
         abort_fn_type *abort;
-        next_type next;
+        destroy_fn_type *destroy;
+        process_handler *next;
+        std::size_t pool;
+        bool ticked;
+        Delta stamp;
     };
 
+    using container_type = std::vector<process_handler, typename alloc_traits::template rebind_alloc<process_handler>>;
+    using timer_wheel_type = timer_wheel<process_handler, typename alloc_traits::template rebind_alloc<process_handler>>;
+
+    struct pool_data {
+        using run_fn_type = void(scheduler &, std::size_t, Delta, void *, bool);
+
+        template<typename Alloc>
+        pool_data(const type_info &type, const type_info *req, run_fn_type *fn, const std::size_t length, const bool thread_safe, const Alloc &alloc)
+            : info{&type},
+              resources{req},
+              run{fn},
+              handlers{alloc},
+              memory{length, alloc},
+              limit{},
+              concurrent{thread_safe} {}
+
+        const type_info *info;
+        const type_info *resources;
+        run_fn_type *run;
+        container_type handlers;
+        slab memory;
+        std::size_t limit;
+        bool concurrent;
+    };
+
+    using pool_container_type = std::vector<pool_data, typename alloc_traits::template rebind_alloc<pool_data>>;
+
     struct continuation {
-        continuation(process_handler *ref) ENTT_NOEXCEPT
-            : handler{ref} {}
+        continuation(scheduler &ref, process_handler *curr) ENTT_NOEXCEPT
+            : owner{&ref},
+              handler{curr} {}
 
         template<typename Proc, typename... Args>
         continuation then(Args &&...args) {
-            static_assert(std::is_base_of_v<process<Proc, Delta>, Proc>, "Invalid process type");
-            auto proc = typename process_handler::instance_type{new Proc{std::forward<Args>(args)...}, &scheduler::deleter<Proc>};
-            handler->next.reset(new process_handler{std::move(proc), &scheduler::update<Proc>, &scheduler::abort<Proc>, nullptr});
-            handler = handler->next.get();
+            auto *next = static_cast<process_handler *>(owner->allocate(owner->nodes));
+            ENTT_TRY {
+                handler->next = ::new(next) process_handler{owner->template spawn<Proc>(std::forward<Args>(args)...)};
+            }
+            ENTT_CATCH {
+                owner->deallocate(owner->nodes, next);
+                ENTT_THROW;
+            }
+            handler = handler->next;
             return *this;
         }
 
         template<typename Func>
         continuation then(Func &&func) {
-            return then<process_adaptor<std::decay_t<Func>, Delta>>(std::forward<Func>(func));
+            if constexpr(std::is_base_of_v<process<std::decay_t<Func>, Delta>, std::decay_t<Func>>) {
+                return then<std::decay_t<Func>, Func>(std::forward<Func>(func));
+            } else {
+                return then<process_adaptor<std::decay_t<Func>, Delta>>(std::forward<Func>(func));
+            }
         }
 
     private:
+        scheduler *owner;
         process_handler *handler;
     };
 
+    [[nodiscard]] static constexpr std::size_t blocks_for(const std::size_t size) ENTT_NOEXCEPT {
+        return (size + sizeof(block) - 1u) / sizeof(block);
+    }
+
+    [[nodiscard]] void *allocate(slab &from) {
+        // elements are allocated a page at a time, so that processes of the same type are packed together
+        if(from.available.empty()) {
+            auto *page = std::addressof(*block_traits::allocate(allocator, from.count * page_size));
+            from.pages.push_back(page);
+
+            for(auto pos = page_size; pos; --pos) {
+                from.available.push_back(page + (pos - 1u) * from.count);
+            }
+        }
+
+        auto *elem = from.available.back();
+        from.available.pop_back();
+        ++from.live;
+        return elem;
+    }
+
+    void deallocate(slab &from, void *elem) {
+        from.available.push_back(elem);
+        --from.live;
+    }
+
+    void shrink(slab &from) {
+        if(!from.live) {
+            for(auto *page: from.pages) {
+                block_traits::deallocate(allocator, page, from.count * page_size);
+            }
+
+            from.pages.clear();
+            from.available.clear();
+        }
+    }
+
+    template<typename Proc>
+    [[nodiscard]] std::size_t assure() {
+        const auto &info = type_id<Proc>();
+
+        if(const auto it = lookup.find(info.hash()); it != lookup.cend()) {
+            return it->second;
+        }
+
+        pools.emplace_back(info, internal::process_resources<Proc>::value(), &scheduler::run<Proc>, blocks_for(sizeof(Proc)), internal::thread_safe_process<Proc>::value, allocator);
+        lookup.emplace(info.hash(), pools.size() - 1u);
+        return pools.size() - 1u;
+    }
+
+    template<typename Proc, typename... Args>
+    [[nodiscard]] process_handler spawn(Args &&...args) {
+        static_assert(std::is_base_of_v<process<Proc, Delta>, Proc>, "Invalid process type");
+        static_assert(alignof(Proc) <= alignof(block), "Over-aligned processes aren't supported");
+        const auto idx = assure<Proc>();
+        auto *elem = allocate(pools[idx].memory);
+
+        ENTT_TRY {
+            ::new(elem) Proc{std::forward<Args>(args)...};
+        }
+        ENTT_CATCH {
+            deallocate(pools[idx].memory, elem);
+            ENTT_THROW;
+        }
+
+        return process_handler{elem, &scheduler::tick<Proc>, &scheduler::settle<Proc>, &scheduler::abort<Proc>, &scheduler::destroy<Proc>, nullptr, idx, false, elapsed};
+    }
+
+    void release(process_handler &handler) {
+        handler.destroy(*this, handler.pool, handler.instance);
+
+        for(auto *next = handler.next; next;) {
+            auto *curr = std::exchange(next, next->next);
+            curr->destroy(*this, curr->pool, curr->instance);
+            deallocate(nodes, curr);
+        }
+    }
+
+    void release_all() {
+        clear();
+        shrink_to_fit();
+    }
+
+    void remove(const std::size_t idx, const std::size_t pos) {
+        auto &&handlers = pools[idx].handlers;
+        release(handlers[pos]);
+        handlers[pos] = handlers.back();
+        handlers.pop_back();
+    }
+
+    void join(process_handler handler) {
+        const auto idx = handler.pool;
+        handler.stamp = elapsed;
+        pools[idx].handlers.push_back(handler);
+
+        // forces the process to exit the uninitialized state
+        const auto pos = pools[idx].handlers.size() - 1u;
+        handler.tick(handler.instance, {}, nullptr);
+
+        if(handler.settle(*this, idx, pos)) {
+            remove(idx, pos);
+        }
+    }
+
+    void advance(const Delta delta) {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            elapsed += delta;
+        }
+
+        // a full update ends the current round, if any
+        round_pool = round_pos = {};
+
+        for(auto &&pool: pools) {
+            pool.limit = pool.handlers.size();
+        }
+    }
+
+    [[nodiscard]] static typename timer_wheel_type::time_type ticks_for(const Delta delay) {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            if(!(delay > Delta{})) {
+                return {};
+            }
+
+            // deferred processes never wake up early, partial ticks are rounded up
+            const auto ticks = static_cast<typename timer_wheel_type::time_type>(delay);
+            return ticks + (static_cast<Delta>(ticks) < delay);
+        } else {
+            return {};
+        }
+    }
+
+    void wake(const Delta delta) {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            if(!timers.empty() && delta > Delta{}) {
+                // partial ticks are accumulated for floating point types
+                residual += delta;
+                const auto ticks = static_cast<typename timer_wheel_type::time_type>(residual);
+                residual -= static_cast<Delta>(ticks);
+
+                timers.advance(ticks, [this](process_handler &handler) {
+                    join(handler);
+                });
+            }
+        }
+    }
+
+    [[nodiscard]] bool seek() ENTT_NOEXCEPT {
+        // pools are visited back to front during a round, exhausted ones are skipped
+        for(; round_pool && !round_pos; round_pos = (--round_pool) ? pools[round_pool - 1u].handlers.size() : size_type{}) {}
+        return round_pos != 0u;
+    }
+
     template<typename Proc>
-    [[nodiscard]] static bool update(scheduler &owner, std::size_t pos, const Delta delta, void *data) {
-        auto *process = static_cast<Proc *>(owner.handlers[pos].instance.get());
-        process->tick(delta, data);
+    static void run(scheduler &owner, const std::size_t idx, const Delta delta, void *data, const bool skip) {
+        // processes of the same type are ticked in a row with direct calls
+        for(auto pos = owner.pools[idx].limit; pos; --pos) {
+            const auto curr = pos - 1u;
+
+            if(auto &&handler = owner.pools[idx].handlers[curr]; !std::exchange(handler.ticked, false) && !skip) {
+                static_cast<Proc *>(handler.instance)->tick(delta, data);
+            }
+
+            owner.pools[idx].handlers[curr].stamp = owner.elapsed;
+
+            if(settle<Proc>(owner, idx, curr)) {
+                owner.remove(idx, curr);
+            }
+        }
+    }
+
+    template<typename Proc>
+    static void tick(void *instance, const Delta delta, void *data) {
+        static_cast<Proc *>(instance)->tick(delta, data);
+    }
+
+    template<typename Proc>
+    [[nodiscard]] static bool settle(scheduler &owner, const std::size_t idx, const std::size_t pos) {
+        auto &&handler = owner.pools[idx].handlers[pos];
+        auto *process = static_cast<Proc *>(handler.instance);
 
         if(process->rejected()) {
             return true;
         } else if(process->finished()) {
-            if(auto &&handler = owner.handlers[pos]; handler.next) {
-                handler = std::move(*handler.next);
-                // forces the process to exit the uninitialized state
-                return handler.update(owner, pos, {}, nullptr);
+            // children join the pool of their type, the parent is removed by the caller
+            if(auto *next = std::exchange(handler.next, nullptr); next) {
+                const auto child = *next;
+                owner.deallocate(owner.nodes, next);
+                owner.join(child);
             }
 
             return true;
@@ -95,34 +393,119 @@ class scheduler {
     }
 
     template<typename Proc>
-    static void abort(scheduler &owner, std::size_t pos, const bool immediately) {
-        static_cast<Proc *>(owner.handlers[pos].instance.get())->abort(immediately);
+    static void abort(void *instance, const bool immediately) {
+        static_cast<Proc *>(instance)->abort(immediately);
     }
 
     template<typename Proc>
-    static void deleter(void *proc) {
-        delete static_cast<Proc *>(proc);
+    static void destroy(scheduler &owner, const std::size_t idx, void *elem) {
+        static_cast<Proc *>(elem)->~Proc();
+        owner.deallocate(owner.pools[idx].memory, elem);
     }
 
 public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
 
     /*! @brief Default constructor. */
-    scheduler() = default;
+    scheduler()
+        : scheduler{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a scheduler with a given allocator.
+     * @param alloc Allocator to use for processes and internal data.
+     */
+    explicit scheduler(const allocator_type &alloc)
+        : pools{alloc},
+          lookup{alloc},
+          nodes{blocks_for(sizeof(process_handler)), alloc},
+          timers{alloc},
+          pending{alloc},
+          allocator{alloc},
+          residual{},
+          elapsed{},
+          round_pool{},
+          round_pos{} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    scheduler(scheduler &&other) ENTT_NOEXCEPT
+        : pools{std::move(other.pools)},
+          lookup{std::move(other.lookup)},
+          nodes{std::move(other.nodes)},
+          timers{std::move(other.timers)},
+          pending{std::move(other.pending)},
+          allocator{std::move(other.allocator)},
+          residual{std::move(other.residual)},
+          elapsed{std::move(other.elapsed)},
+          round_pool{std::exchange(other.round_pool, size_type{})},
+          round_pos{std::exchange(other.round_pos, size_type{})} {
+        other.pools.clear();
+        other.lookup.clear();
+        other.nodes.pages.clear();
+        other.nodes.available.clear();
+        other.nodes.live = {};
+        other.timers.clear();
+    }
+
+    /*! @brief Discards all processes and releases all memory. */
+    ~scheduler() {
+        release_all();
+    }
 
-    /*! @brief Default move constructor. */
-    scheduler(scheduler &&) = default;
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This scheduler.
+     */
+    scheduler &operator=(scheduler &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            release_all();
+            pools = std::move(other.pools);
+            lookup = std::move(other.lookup);
+            nodes = std::move(other.nodes);
+            timers = std::move(other.timers);
+            pending = std::move(other.pending);
+            allocator = std::move(other.allocator);
+            residual = std::move(other.residual);
+            elapsed = std::move(other.elapsed);
+            round_pool = std::exchange(other.round_pool, size_type{});
+            round_pos = std::exchange(other.round_pos, size_type{});
+            other.pools.clear();
+            other.lookup.clear();
+            other.nodes.pages.clear();
+            other.nodes.available.clear();
+            other.nodes.live = {};
+            other.timers.clear();
+        }
+
+        return *this;
+    }
 
-    /*! @brief Default move assignment operator. @return This scheduler. */
-    scheduler &operator=(scheduler &&) = default;
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{allocator};
+    }
 
     /**
-     * @brief Number of processes currently scheduled.
+     * @brief Number of processes currently scheduled, deferred ones included.
      * @return Number of processes currently scheduled.
      */
     [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
-        return handlers.size();
+        size_type length = timers.size();
+
+        for(auto &&pool: pools) {
+            length += pool.handlers.size();
+        }
+
+        return length;
     }
 
     /**
@@ -130,17 +513,46 @@ public:
      * @return True if there are scheduled processes, false otherwise.
      */
     [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
-        return handlers.empty();
+        return timers.empty() && std::all_of(pools.cbegin(), pools.cend(), [](auto &&pool) { return pool.handlers.empty(); });
     }
 
     /**
-     * @brief Discards all scheduled processes.
+     * @brief Discards all scheduled processes, deferred ones included.
      *
      * Processes aren't aborted. They are discarded along with their children
      * and never executed again.
      */
     void clear() {
-        handlers.clear();
+        for(auto &&pool: pools) {
+            for(auto &&handler: pool.handlers) {
+                release(handler);
+            }
+
+            pool.handlers.clear();
+        }
+
+        timers.each([this](auto, process_handler &handler) {
+            release(handler);
+        });
+
+        timers.clear();
+        round_pool = round_pos = {};
+    }
+
+    /**
+     * @brief Releases the memory kept aside for terminated processes.
+     *
+     * Processes are allocated in pages, one set of pages per type of process,
+     * and memory is recycled internally, so that scheduling a process rarely
+     * requires an allocation. This function returns to the allocator the pages
+     * of the types of processes that have no instances left.
+     */
+    void shrink_to_fit() {
+        for(auto &&pool: pools) {
+            shrink(pool.memory);
+        }
+
+        shrink(nodes);
     }
 
     /**
@@ -170,12 +582,12 @@ public:
      */
     template<typename Proc, typename... Args>
     auto attach(Args &&...args) {
-        static_assert(std::is_base_of_v<process<Proc, Delta>, Proc>, "Invalid process type");
-        auto proc = typename process_handler::instance_type{new Proc{std::forward<Args>(args)...}, &scheduler::deleter<Proc>};
-        auto &&ref = handlers.emplace_back(process_handler{std::move(proc), &scheduler::update<Proc>, &scheduler::abort<Proc>, nullptr});
+        auto handler = spawn<Proc>(std::forward<Args>(args)...);
+        auto &&handlers = pools[handler.pool].handlers;
+        handlers.push_back(handler);
         // forces the process to exit the uninitialized state
-        ref.update(*this, handlers.size() - 1u, {}, nullptr);
-        return continuation{&handlers.back()};
+        handler.tick(handler.instance, {}, nullptr);
+        return continuation{*this, &handlers.back()};
     }
 
     /**
@@ -223,6 +635,9 @@ public:
      * .then<my_process>(arguments...);
      * @endcode
      *
+     * Instances of processes, such as those returned by coroutines, are
+     * scheduled as they are rather than wrapped in an adaptor.
+     *
      * @sa process_adaptor
      *
      * @tparam Func Type of process to schedule.
@@ -231,14 +646,67 @@ public:
      */
     template<typename Func>
     auto attach(Func &&func) {
-        using Proc = process_adaptor<std::decay_t<Func>, Delta>;
-        return attach<Proc>(std::forward<Func>(func));
+        if constexpr(std::is_base_of_v<process<std::decay_t<Func>, Delta>, std::decay_t<Func>>) {
+            return attach<std::decay_t<Func>, Func>(std::forward<Func>(func));
+        } else {
+            using Proc = process_adaptor<std::decay_t<Func>, Delta>;
+            return attach<Proc>(std::forward<Func>(func));
+        }
+    }
+
+    /**
+     * @brief Schedules a process to wake up after the given time.
+     *
+     * The process is created immediately but it joins the running queue of the
+     * scheduler only once the given time has elapsed, at the end of the update
+     * during which this happens. It's ticked for the first time during the
+     * next update.<br/>
+     * Deferred processes are kept in a hierarchical timing wheel with a tick
+     * for each unit of time. Updating the scheduler only touches the deferred
+     * processes to wake up, no matter how many are pending. Partial units of
+     * time are rounded up.
+     *
+     * @sa attach
+     *
+     * @tparam Proc Type of process to schedule.
+     * @tparam Args Types of arguments to use to initialize the process.
+     * @param delay Time after which to wake up the process.
+     * @param args Parameters to use to initialize the process.
+     * @return An opaque object to use to concatenate processes.
+     */
+    template<typename Proc, typename... Args>
+    auto defer(const Delta delay, Args &&...args) {
+        static_assert(std::is_arithmetic_v<Delta>, "Deferred processes require arithmetic types");
+        const auto timer = timers.schedule(ticks_for(delay), spawn<Proc>(std::forward<Args>(args)...));
+        return continuation{*this, &timers.get(timer)};
+    }
+
+    /**
+     * @brief Schedules a process to wake up after the given time.
+     *
+     * @sa attach
+     * @sa defer
+     *
+     * @tparam Func Type of process to schedule.
+     * @param delay Time after which to wake up the process.
+     * @param func Either a lambda or a functor to use as a process.
+     * @return An opaque object to use to concatenate processes.
+     */
+    template<typename Func>
+    auto defer(const Delta delay, Func &&func) {
+        if constexpr(std::is_base_of_v<process<std::decay_t<Func>, Delta>, std::decay_t<Func>>) {
+            return defer<std::decay_t<Func>, Func>(delay, std::forward<Func>(func));
+        } else {
+            using Proc = process_adaptor<std::decay_t<Func>, Delta>;
+            return defer<Proc>(delay, std::forward<Func>(func));
+        }
     }
 
     /**
      * @brief Updates all scheduled processes.
      *
-     * All scheduled processes are executed in no specific order.<br/>
+     * All scheduled processes are executed in no specific order, except for
+     * those already ticked by means of `tick` since the last update.<br/>
      * If a process terminates with success, it's replaced with its child, if
      * any. Otherwise, if a process terminates with an error, it's removed along
      * with its child.
@@ -247,12 +715,182 @@ public:
      * @param data Optional data.
      */
     void update(const Delta delta, void *data = nullptr) {
-        for(auto pos = handlers.size(); pos; --pos) {
-            const auto curr = pos - 1u;
+        ENTT_PROFILE_SCOPE(type_id<scheduler>().name());
+        advance(delta);
+
+        for(size_type idx{}; idx < pools.size(); ++idx) {
+            pools[idx].run(*this, idx, delta, data, false);
+        }
+
+        wake(delta);
+    }
+
+    /**
+     * @brief Updates scheduled processes until the given deadline.
+     *
+     * Processes are ticked in rounds. Each update resumes the current round
+     * from where the previous one left off and stops as soon as the deadline
+     * expires, so that a frame with lots of processes doesn't result in a
+     * spike. At least one process is ticked, if any. Processes attached in the
+     * meantime are ticked either during the current round or the next one,
+     * depending on whether their type was already visited.<br/>
+     * Each process receives the time elapsed since it was last ticked rather
+     * than the time elapsed since the last update. Therefore, no time is lost
+     * when a process is ticked with a delay.
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the deadline.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     * @param deadline Point in time after which no more processes are ticked.
+     * @return The number of processes still to tick in the current round.
+     */
+    template<typename Clock, typename Duration>
+    size_type update(const Delta delta, void *data, const std::chrono::time_point<Clock, Duration> &deadline) {
+        static_assert(std::is_arithmetic_v<Delta>, "Budgeted updates require arithmetic types");
+        ENTT_PROFILE_SCOPE(type_id<scheduler>().name());
+        elapsed += delta;
+
+        if(!seek()) {
+            round_pool = pools.size();
+            round_pos = pools.empty() ? size_type{} : pools.back().handlers.size();
+        }
+
+        for(bool first = true; seek() && (first || Clock::now() < deadline); first = false) {
+            const auto idx = round_pool - 1u;
+            const auto curr = --round_pos;
+
+            if(auto &&handler = pools[idx].handlers[curr]; !std::exchange(handler.ticked, false)) {
+                handler.tick(handler.instance, static_cast<Delta>(elapsed - handler.stamp), data);
+            }
+
+            pools[idx].handlers[curr].stamp = elapsed;
 
-            if(const auto dead = handlers[curr].update(*this, curr, delta, data); dead) {
-                std::swap(handlers[curr], handlers.back());
-                handlers.pop_back();
+            // processes past the cursor were already ticked during this round
+            if(pools[idx].handlers[curr].settle(*this, idx, curr)) {
+                remove(idx, curr);
+            }
+        }
+
+        wake(delta);
+
+        size_type remaining = round_pos;
+
+        for(size_type idx{}; idx + 1u < round_pool; ++idx) {
+            remaining += pools[idx].handlers.size();
+        }
+
+        return remaining;
+    }
+
+    /**
+     * @brief Updates all scheduled processes, part of them in parallel.
+     *
+     * Processes that declare themselves as thread-safe are ticked by means of
+     * the given executor first:
+     *
+     * @code{.cpp}
+     * struct my_process: entt::process<my_process, std::uint32_t> {
+     *     static constexpr auto thread_safe = true;
+     *     // ...
+     * };
+     * @endcode
+     *
+     * All other processes are ticked sequentially afterwards on the calling
+     * thread. Continuations, removals and the initialization of children
+     * always happen on the calling thread, once all processes are ticked.
+     * Processes already ticked by means of `tick` are skipped.<br/>
+     * The executor is invoked once with the number of thread-safe processes and
+     * a task to run for each index in the range `[0, count)`. The signature of
+     * the executor must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, const Task &task);
+     * @endcode
+     *
+     * The executor is free to run tasks concurrently but it mustn't return
+     * before all of them have completed.
+     *
+     * @warning
+     * Thread-safe processes mustn't attach processes to or abort processes of
+     * the scheduler that ticks them.
+     *
+     * @tparam Exec Type of the executor to use.
+     * @param executor A valid executor.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    template<typename Exec>
+    void par_update(Exec &&executor, const Delta delta, void *data = nullptr) {
+        advance(delta);
+        pending.clear();
+
+        for(size_type idx{}, last = pools.size(); idx < last; ++idx) {
+            if(pools[idx].concurrent) {
+                for(size_type pos{}, end = pools[idx].handlers.size(); pos < end; ++pos) {
+                    if(!pools[idx].handlers[pos].ticked) {
+                        pending.emplace_back(idx, pos);
+                    }
+                }
+            }
+        }
+
+        if(!pending.empty()) {
+            const auto task = [this, delta, data](const std::size_t index) {
+                auto &&handler = pools[pending[index].first].handlers[pending[index].second];
+                handler.tick(handler.instance, delta, data);
+            };
+
+            executor(pending.size(), std::as_const(task));
+        }
+
+        for(size_type idx{}; idx < pools.size(); ++idx) {
+            pools[idx].run(*this, idx, delta, data, pools[idx].concurrent);
+        }
+
+        wake(delta);
+    }
+
+    /**
+     * @brief Ticks the processes that declare the given resources.
+     *
+     * Processes can declare the resources they access in the same form used
+     * by the organizer, that is, const types are read-only while all other
+     * types are accessed in read-write mode:
+     *
+     * @code{.cpp}
+     * struct my_process: entt::process<my_process, std::uint32_t> {
+     *     using resources = entt::type_list<position, const velocity>;
+     *     // ...
+     * };
+     * @endcode
+     *
+     * Only the processes that declare exactly the given list, in the same
+     * order, are ticked. They are skipped during the next update, which still
+     * takes care of continuations and removals.<br/>
+     * This function doesn't modify the list of processes. Therefore, it can be
+     * invoked concurrently for different lists of resources, for example from
+     * the vertices of a task graph that declare the same requirements.
+     *
+     * @warning
+     * Processes ticked this way mustn't attach processes to or abort processes
+     * of the scheduler that ticks them.
+     *
+     * @tparam Req Resources declared by the processes to tick.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    template<typename... Req>
+    void tick(const Delta delta, void *data = nullptr) {
+        ENTT_PROFILE_SCOPE(type_id<type_list<Req...>>().name());
+        const auto &info = type_id<type_list<Req...>>();
+
+        for(auto &&pool: pools) {
+            if(pool.resources && *pool.resources == info) {
+                for(auto &&handler: pool.handlers) {
+                    handler.tick(handler.instance, delta, data);
+                    handler.ticked = true;
+                }
             }
         }
     }
@@ -263,19 +901,37 @@ public:
      * Unless an immediate operation is requested, the abort is scheduled for
      * the next tick. Processes won't be executed anymore in any case.<br/>
      * Once a process is fully aborted and thus finished, it's discarded along
-     * with its child, if any.
+     * with its child, if any.<br/>
+     * Deferred processes that haven't woken up yet are discarded immediately.
      *
      * @param immediately Requests an immediate operation.
      */
     void abort(const bool immediately = false) {
-        for(auto pos = handlers.size(); pos; --pos) {
-            const auto curr = pos - 1u;
-            handlers[curr].abort(*this, curr, immediately);
+        timers.each([this](auto, process_handler &handler) {
+            release(handler);
+        });
+
+        timers.clear();
+
+        for(size_type idx{}; idx < pools.size(); ++idx) {
+            for(auto pos = pools[idx].handlers.size(); pos; --pos) {
+                auto &&handler = pools[idx].handlers[pos - 1u];
+                handler.abort(handler.instance, immediately);
+            }
         }
     }
 
 private:
-    std::vector<process_handler> handlers{};
+    pool_container_type pools;
+    dense_map<id_type, size_type, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, size_type>>> lookup;
+    slab nodes;
+    timer_wheel_type timers;
+    std::vector<std::pair<size_type, size_type>, typename alloc_traits::template rebind_alloc<std::pair<size_type, size_type>>> pending;
+    block_allocator allocator;
+    Delta residual;
+    Delta elapsed;
+    size_type round_pool;
+    size_type round_pos;
 };
 
 } // namespace entt
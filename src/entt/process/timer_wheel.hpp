@@ -0,0 +1,434 @@
+#ifndef ENTT_PROCESS_TIMER_WHEEL_HPP
+#define ENTT_PROCESS_TIMER_WHEEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+[[nodiscard]] inline std::size_t wheel_first_slot(std::uint64_t value) ENTT_NOEXCEPT {
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+    std::size_t count{};
+    for(; !(value & 1u); value >>= 1u, ++count) {}
+    return count;
+#endif
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Hierarchical timing wheel.
+ *
+ * A timing wheel keeps values that expire at some point in the future and
+ * returns them once their time has come. Time is measured in ticks.<br/>
+ * Timers are spread over a few levels of 64 slots each, so that the further
+ * a timer is in the future, the coarser the slot in which it's stored. As time
+ * goes by, slots are moved to the lower levels until their timers expire.
+ * Scheduling and cancelling a timer take constant time, while advancing the
+ * wheel only touches the slots that contain expired timers or timers that are
+ * to be moved, no matter how many timers are pending.
+ *
+ * @tparam Type Type of values to store in the wheel.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Allocator>
+class timer_wheel {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+
+    static constexpr std::size_t slot_bits = 6u;
+    static constexpr std::size_t slots = std::size_t{1u} << slot_bits;
+    static constexpr std::size_t levels = (std::numeric_limits<std::uint64_t>::digits + slot_bits - 1u) / slot_bits;
+    static constexpr std::uint32_t null = (std::numeric_limits<std::uint32_t>::max)();
+    // the last list is used for the timers that are being expired or moved
+    static constexpr std::uint32_t pending = levels * slots;
+
+    struct node {
+        Type value;
+        std::uint64_t deadline;
+        std::uint32_t prev;
+        std::uint32_t next;
+        std::uint32_t list;
+        std::uint32_t version;
+    };
+
+    using container_type = std::vector<node, typename alloc_traits::template rebind_alloc<node>>;
+
+    template<typename... Args>
+    [[nodiscard]] static Type make(Args &&...args) {
+        if constexpr(std::is_aggregate_v<Type>) {
+            return Type{std::forward<Args>(args)...};
+        } else {
+            return Type(std::forward<Args>(args)...);
+        }
+    }
+
+    void link(const std::uint32_t pos, const std::uint32_t list) {
+        auto &elem = nodes[pos];
+        elem.prev = null;
+        elem.next = std::exchange(heads[list], pos);
+        elem.list = list;
+
+        if(elem.next != null) {
+            nodes[elem.next].prev = pos;
+        }
+
+        if(list != pending) {
+            occupied[list / slots] |= std::uint64_t{1u} << (list % slots);
+        }
+    }
+
+    void unlink(const std::uint32_t pos) {
+        auto &elem = nodes[pos];
+
+        if(elem.prev == null) {
+            heads[elem.list] = elem.next;
+        } else {
+            nodes[elem.prev].next = elem.next;
+        }
+
+        if(elem.next != null) {
+            nodes[elem.next].prev = elem.prev;
+        }
+
+        if(elem.list != pending && heads[elem.list] == null) {
+            occupied[elem.list / slots] &= ~(std::uint64_t{1u} << (elem.list % slots));
+        }
+
+        elem.list = null;
+    }
+
+    void place(const std::uint32_t pos) {
+        const auto deadline = nodes[pos].deadline;
+        std::size_t level{};
+
+        // timers go to the level of the highest group of bits that differs from the current time
+        for(auto diff = (deadline ^ now) >> slot_bits; diff; diff >>= slot_bits) {
+            ++level;
+        }
+
+        link(pos, static_cast<std::uint32_t>(level * slots + ((deadline >> (level * slot_bits)) & (slots - 1u))));
+    }
+
+    void release(const std::uint32_t pos) {
+        auto &elem = nodes[pos];
+        ++elem.version;
+        elem.next = std::exchange(available, pos);
+    }
+
+    [[nodiscard]] static constexpr std::uint32_t index_of(const std::uint64_t timer) ENTT_NOEXCEPT {
+        return static_cast<std::uint32_t>(timer);
+    }
+
+    [[nodiscard]] static constexpr std::uint32_t version_of(const std::uint64_t timer) ENTT_NOEXCEPT {
+        return static_cast<std::uint32_t>(timer >> std::numeric_limits<std::uint32_t>::digits);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Type of values stored in the wheel. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type used to measure time, in ticks. */
+    using time_type = std::uint64_t;
+    /*! @brief Opaque identifier of a timer. */
+    using timer_type = std::uint64_t;
+
+    /*! @brief Default constructor. */
+    timer_wheel()
+        : timer_wheel{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty wheel with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit timer_wheel(const allocator_type &allocator)
+        : nodes{allocator},
+          heads{},
+          occupied{},
+          available{null},
+          count{},
+          now{} {
+        heads.fill(null);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{nodes.get_allocator()};
+    }
+
+    /**
+     * @brief Returns the current time of a wheel.
+     * @return The current time, in ticks.
+     */
+    [[nodiscard]] time_type time() const ENTT_NOEXCEPT {
+        return now;
+    }
+
+    /**
+     * @brief Returns the number of pending timers.
+     * @return Number of pending timers.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether a wheel has pending timers.
+     * @return True if there are no pending timers, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !count;
+    }
+
+    /**
+     * @brief Schedules a value to expire after the given number of ticks.
+     *
+     * A delay of zero ticks is the same as a delay of one tick, that is, the
+     * value expires the next time the wheel is advanced.
+     *
+     * @tparam Args Types of arguments to use to construct the value.
+     * @param delay Number of ticks after which the value expires.
+     * @param args Parameters to use to construct the value.
+     * @return The identifier of the newly created timer.
+     */
+    template<typename... Args>
+    timer_type schedule(const time_type delay, Args &&...args) {
+        const auto deadline = (delay < (std::numeric_limits<time_type>::max)() - now) ? (now + (delay ? delay : time_type{1u})) : (std::numeric_limits<time_type>::max)();
+        auto pos = available;
+
+        if(pos == null) {
+            ENTT_ASSERT(nodes.size() < null, "No timers available");
+            pos = static_cast<std::uint32_t>(nodes.size());
+            nodes.push_back(node{make(std::forward<Args>(args)...), deadline, null, null, null, 0u});
+        } else {
+            available = nodes[pos].next;
+            nodes[pos].value = make(std::forward<Args>(args)...);
+            nodes[pos].deadline = deadline;
+        }
+
+        place(pos);
+        ++count;
+
+        return (static_cast<timer_type>(nodes[pos].version) << std::numeric_limits<std::uint32_t>::digits) | pos;
+    }
+
+    /**
+     * @brief Checks whether a timer is still pending.
+     * @param timer The identifier of a timer.
+     * @return True if the timer is still pending, false otherwise.
+     */
+    [[nodiscard]] bool contains(const timer_type timer) const ENTT_NOEXCEPT {
+        const auto pos = index_of(timer);
+        return pos < nodes.size() && nodes[pos].version == version_of(timer) && nodes[pos].list != null;
+    }
+
+    /**
+     * @brief Returns the value of a pending timer.
+     *
+     * @warning
+     * Attempting to get the value of a timer that isn't pending results in
+     * undefined behavior.
+     *
+     * @param timer The identifier of a timer.
+     * @return A reference to the value of the timer.
+     */
+    [[nodiscard]] value_type &get(const timer_type timer) ENTT_NOEXCEPT {
+        ENTT_ASSERT(contains(timer), "Invalid timer");
+        return nodes[index_of(timer)].value;
+    }
+
+    /**
+     * @brief Returns the number of ticks before a timer expires.
+     *
+     * @warning
+     * Attempting to use a timer that isn't pending results in undefined
+     * behavior.
+     *
+     * @param timer The identifier of a timer.
+     * @return The number of ticks before the timer expires.
+     */
+    [[nodiscard]] time_type remaining(const timer_type timer) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(contains(timer), "Invalid timer");
+        return nodes[index_of(timer)].deadline - now;
+    }
+
+    /**
+     * @brief Cancels a pending timer and returns its value.
+     *
+     * @warning
+     * Attempting to cancel a timer that isn't pending results in undefined
+     * behavior.
+     *
+     * @param timer The identifier of a timer.
+     * @return The value of the timer.
+     */
+    value_type cancel(const timer_type timer) {
+        ENTT_ASSERT(contains(timer), "Invalid timer");
+        const auto pos = index_of(timer);
+        unlink(pos);
+        --count;
+        value_type elem = std::move(nodes[pos].value);
+        release(pos);
+        return elem;
+    }
+
+    /**
+     * @brief Advances a wheel and returns the values of the expired timers.
+     *
+     * Only the slots that contain timers to expire or to move to a lower level
+     * are visited, therefore the cost of this function doesn't depend on the
+     * number of pending timers nor on the number of ticks.<br/>
+     * Values are moved out of the wheel before the function object is invoked.
+     * Timers expire in order of deadline, those with the same deadline are
+     * returned in no particular order. The signature of the function must be
+     * equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(value_type &);
+     * @endcode
+     *
+     * The function object is free to schedule and cancel timers.
+     *
+     * @warning
+     * Advancing a wheel from within the function object results in undefined
+     * behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param ticks Number of ticks by which to advance the wheel.
+     * @param func A valid function object.
+     * @return The number of expired timers.
+     */
+    template<typename Func>
+    size_type advance(const time_type ticks, Func func) {
+        const auto target = (ticks < (std::numeric_limits<time_type>::max)() - now) ? (now + ticks) : (std::numeric_limits<time_type>::max)();
+        size_type expired{};
+
+        for(std::size_t level{}; level < levels;) {
+            if(!occupied[level]) {
+                ++level;
+                continue;
+            }
+
+            // all the slots in use are past the current one, the first of the lowest level is the next to visit
+            const auto slot = internal::wheel_first_slot(occupied[level]);
+            const auto span = (level + 1u) * slot_bits;
+            const auto next = (span < std::numeric_limits<time_type>::digits ? ((now >> span) << span) : time_type{}) | (static_cast<time_type>(slot) << (level * slot_bits));
+
+            if(next > target) {
+                break;
+            }
+
+            now = next;
+
+            for(auto list = static_cast<std::uint32_t>(level * slots + slot); heads[list] != null;) {
+                const auto pos = heads[list];
+                unlink(pos);
+                link(pos, pending);
+            }
+
+            while(heads[pending] != null) {
+                const auto pos = heads[pending];
+                unlink(pos);
+
+                if(nodes[pos].deadline == now) {
+                    value_type elem = std::move(nodes[pos].value);
+                    release(pos);
+                    --count;
+                    ++expired;
+                    func(elem);
+                } else {
+                    place(pos);
+                }
+            }
+
+            level = {};
+        }
+
+        now = target;
+        return expired;
+    }
+
+    /**
+     * @brief Advances a wheel and discards the values of the expired timers.
+     * @param ticks Number of ticks by which to advance the wheel.
+     * @return The number of expired timers.
+     */
+    size_type advance(const time_type ticks) {
+        return advance(ticks, [](auto &&) {});
+    }
+
+    /**
+     * @brief Visits the values of all pending timers.
+     *
+     * Values are returned in no particular order. The signature of the
+     * function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const timer_type, value_type &);
+     * @endcode
+     *
+     * @warning
+     * Scheduling or cancelling timers from within the function object results
+     * in undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        for(std::size_t pos{}, last = nodes.size(); pos < last; ++pos) {
+            if(auto &elem = nodes[pos]; elem.list != null) {
+                func((static_cast<timer_type>(elem.version) << std::numeric_limits<std::uint32_t>::digits) | pos, elem.value);
+            }
+        }
+    }
+
+    /*! @brief Discards all pending timers. The current time is preserved. */
+    void clear() {
+        nodes.clear();
+        heads.fill(null);
+        occupied.fill(0u);
+        available = null;
+        count = {};
+    }
+
+private:
+    container_type nodes;
+    std::array<std::uint32_t, levels * slots + 1u> heads;
+    std::array<std::uint64_t, levels> occupied;
+    std::uint32_t available;
+    size_type count;
+    time_type now;
+};
+
+} // namespace entt
+
+#endif
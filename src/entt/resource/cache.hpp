@@ -1,18 +1,47 @@
 #ifndef ENTT_RESOURCE_CACHE_HPP
 #define ENTT_RESOURCE_CACHE_HPP
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../container/dense_set.hpp"
 #include "../core/fwd.hpp"
 #include "../core/utility.hpp"
+#include "../signal/sigh.hpp"
 #include "fwd.hpp"
 #include "handle.hpp"
 #include "loader.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename, typename, typename = void>
+struct has_resource_cost: std::false_type {};
+
+template<typename Loader, typename Resource>
+struct has_resource_cost<Loader, Resource, std::void_t<decltype(std::declval<const Loader &>().cost(std::declval<const Resource &>()))>>
+    : std::true_type {};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Simple cache for resources of a given type.
  *
@@ -22,19 +51,112 @@ namespace entt {
  * large sized applications.
  *
  * @tparam Resource Type of resources managed by a cache.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Resource>
+template<typename Resource, typename Allocator>
 class resource_cache {
     static_assert(std::is_same_v<Resource, std::remove_const_t<std::remove_reference_t<Resource>>>, "Invalid resource type");
 
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Resource>, "Invalid value type");
+
+    using ready_type = std::tuple<id_type, resource_handle<Resource>, std::size_t>;
+    using ready_container_type = std::vector<ready_type, typename alloc_traits::template rebind_alloc<ready_type>>;
+
+    struct async_state {
+        async_state(const Allocator &allocator)
+            : mutex{},
+              ready{allocator} {}
+
+        std::mutex mutex;
+        ready_container_type ready;
+    };
+
+    struct usage_info {
+        std::size_t cost;
+        bool referenced;
+    };
+
+    using resource_container_type = dense_map<id_type, resource_handle<Resource>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, resource_handle<Resource>>>>;
+    using pending_container_type = dense_set<id_type, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<id_type>>;
+    using usage_container_type = dense_map<id_type, usage_info, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, usage_info>>>;
+    using signal_type = sigh<void(const id_type, resource_handle<Resource>), typename alloc_traits::template rebind_alloc<void (*)(const id_type, resource_handle<Resource>)>>;
+
+    template<typename Loader>
+    [[nodiscard]] static std::size_t cost_of([[maybe_unused]] const resource_handle<Resource> &res) {
+        if constexpr(internal::has_resource_cost<Loader, Resource>::value) {
+            return res ? static_cast<std::size_t>(Loader{}.cost(*res)) : 0u;
+        } else {
+            return sizeof(Resource);
+        }
+    }
+
+    void track(const id_type id, const std::size_t cost) {
+        untrack(id);
+        usage.emplace(id, usage_info{cost, true});
+        total += cost;
+        evict();
+    }
+
+    void untrack(const id_type id) {
+        if(auto it = usage.find(id); it != usage.end()) {
+            total -= it->second.cost;
+            usage.erase(it);
+        }
+    }
+
+    void touch(const id_type id) const {
+        if(auto it = usage.find(id); it != usage.end()) {
+            it->second.referenced = true;
+        }
+    }
+
+    void evict() {
+        // clock sweep, resources that are referenced get a second chance and those that are in use are never evicted
+        for(std::size_t step{}, last = 2u * resources.size(); limit && total > limit && step < last && !resources.empty(); ++step) {
+            hand %= resources.size();
+            const auto it = resources.begin() + static_cast<std::ptrdiff_t>(hand);
+            auto &info = usage.find(it->first)->second;
+
+            if(it->second.use_count() != 1) {
+                ++hand;
+            } else if(info.referenced) {
+                info.referenced = false;
+                ++hand;
+            } else {
+                untrack(it->first);
+                resources.erase(it);
+            }
+        }
+    }
+
 public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
     /*! @brief Type of resources managed by a cache. */
     using resource_type = Resource;
 
     /*! @brief Default constructor. */
-    resource_cache() = default;
+    resource_cache()
+        : resource_cache{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty cache with a given allocator.
+     *
+     * The allocator is used for the bookkeeping of the cache, including the
+     * state shared with asynchronous requests. Resources are created by the
+     * loaders instead.
+     *
+     * @param allocator The allocator to use.
+     */
+    explicit resource_cache(const allocator_type &allocator)
+        : resources{allocator},
+          pending{allocator},
+          loaded{allocator},
+          async{},
+          usage{allocator} {}
 
     /*! @brief Default move constructor. */
     resource_cache(resource_cache &&) = default;
@@ -42,6 +164,14 @@ public:
     /*! @brief Default move assignment operator. @return This cache. */
     resource_cache &operator=(resource_cache &&) = default;
 
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{resources.get_allocator()};
+    }
+
     /**
      * @brief Number of resources managed by a cache.
      * @return Number of resources currently stored.
@@ -66,6 +196,40 @@ public:
      */
     void clear() ENTT_NOEXCEPT {
         resources.clear();
+        usage.clear();
+        total = {};
+    }
+
+    /**
+     * @brief Sets the budget of a cache.
+     *
+     * Whenever the overall cost of the resources exceeds the budget, the cache
+     * discards those that weren't recently accessed and that aren't in use
+     * elsewhere (that is, they're only referenced by the cache itself).<br/>
+     * The cost of a resource is returned by the `cost` member function of the
+     * loader if available, it's the size of the resource type otherwise.
+     *
+     * @param value The new budget of the cache, 0 means unlimited.
+     */
+    void budget(const size_type value) {
+        limit = value;
+        evict();
+    }
+
+    /**
+     * @brief Returns the budget of a cache.
+     * @return The budget of the cache, 0 means unlimited.
+     */
+    [[nodiscard]] size_type budget() const ENTT_NOEXCEPT {
+        return limit;
+    }
+
+    /**
+     * @brief Returns the overall cost of the resources in a cache.
+     * @return The overall cost of the resources in the cache.
+     */
+    [[nodiscard]] size_type footprint() const ENTT_NOEXCEPT {
+        return total;
     }
 
     /**
@@ -94,15 +258,201 @@ public:
     resource_handle<resource_type> load(const id_type id, Args &&...args) {
         if(auto it = resources.find(id); it == resources.cend()) {
             if(auto handle = temp<Loader>(std::forward<Args>(args)...); handle) {
-                return (resources[id] = std::move(handle));
+                resources[id] = handle;
+                track(id, cost_of<Loader>(handle));
+                return handle;
             }
         } else {
+            touch(id);
             return it->second;
         }
 
         return {};
     }
 
+    /**
+     * @brief Loads the resources that correspond to a range of identifiers.
+     *
+     * Equivalent to invoking `load` for each identifier in the range, with the
+     * identifier itself as the first argument for the loader followed by the
+     * arguments provided, if any. However, space is reserved at once for all
+     * the resources and duplicates are loaded only once.
+     *
+     * @tparam Loader Type of loader to use to load the resources if required.
+     * @tparam It Type of input iterator.
+     * @tparam Out Type of output iterator.
+     * @tparam Args Types of arguments to use to load the resources if required.
+     * @param first An iterator to the first element of the range of identifiers.
+     * @param last An iterator past the last element of the range of identifiers.
+     * @param out An output iterator to which to assign the handles, in the same
+     * order as the identifiers.
+     * @param args Arguments to use to load the resources if required.
+     * @return An iterator past the last handle assigned.
+     */
+    template<typename Loader, typename It, typename Out, typename... Args>
+    Out load_n(It first, It last, Out out, const Args &...args) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            resources.reserve(resources.size() + static_cast<size_type>(std::distance(first, last)));
+        }
+
+        for(; first != last; ++first, ++out) {
+            const id_type id = *first;
+
+            if(auto it = resources.find(id); it != resources.end()) {
+                touch(id);
+                *out = it->second;
+            } else if(auto handle = temp<Loader>(id, args...); handle) {
+                resources.emplace(id, handle);
+                track(id, cost_of<Loader>(handle));
+                *out = std::move(handle);
+            } else {
+                *out = resource_handle<resource_type>{};
+            }
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Loads the resource that corresponds to a given identifier on a
+     * user provided executor.
+     *
+     * The executor is invoked with a function object that takes no arguments
+     * and that is meant to be run at some point, likely on another thread. It
+     * invokes the loader and stores the resource aside, to be published by the
+     * next call to `update`.<br/>
+     * Arguments are copied into the function object and then forwarded to the
+     * loader in order to construct properly the requested resource.
+     *
+     * @note
+     * If the identifier is already present in the cache or a request for it is
+     * still pending, this function does nothing and the arguments are simply
+     * discarded.
+     *
+     * @tparam Loader Type of loader to use to load the resource if required.
+     * @tparam Executor Type of executor to use to run the loader.
+     * @tparam Args Types of arguments to use to load the resource if required.
+     * @param id Unique resource identifier.
+     * @param executor A valid executor.
+     * @param args Arguments to use to load the resource if required.
+     * @return True if a request is submitted to the executor, false otherwise.
+     */
+    template<typename Loader, typename Executor, typename... Args>
+    bool async_load(const id_type id, Executor &&executor, Args &&...args) {
+        if(contains(id) || pending.contains(id)) {
+            return false;
+        }
+
+        if(!async) {
+            async = std::allocate_shared<async_state>(get_allocator(), get_allocator());
+        }
+
+        pending.insert(id);
+
+        std::forward<Executor>(executor)([state = async, id, params = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            auto handle = std::apply([](auto &&...curr) { return Loader{}.get(std::forward<decltype(curr)>(curr)...); }, std::move(params));
+            const auto cost = cost_of<Loader>(handle);
+            std::lock_guard guard{state->mutex};
+            state->ready.emplace_back(id, std::move(handle), cost);
+        });
+
+        return true;
+    }
+
+    /**
+     * @brief Publishes the resources loaded asynchronously so far.
+     *
+     * Resources are stored aside and listeners are notified for each request
+     * completed since the last call, whether it succeeded or not. In the latter
+     * case, they receive an invalid handle.<br/>
+     * Resources loaded synchronously in the meantime take precedence over those
+     * loaded asynchronously.
+     *
+     * @return The number of completed requests.
+     */
+    size_type update() {
+        ready_container_type ready{get_allocator()};
+
+        if(async) {
+            std::lock_guard guard{async->mutex};
+            ready.swap(async->ready);
+        }
+
+        for(auto &&[id, handle, cost]: ready) {
+            pending.erase(id);
+
+            if(auto it = resources.find(id); it != resources.end()) {
+                handle = it->second;
+            } else if(handle) {
+                resources.emplace(id, handle);
+                track(id, cost);
+            }
+
+            loaded.publish(id, handle);
+        }
+
+        return ready.size();
+    }
+
+    /**
+     * @brief Feeds a resource with a chunk of data.
+     *
+     * The resource must be already in the cache, usually because it was loaded
+     * in a partially ready state. Arguments are forwarded directly to the
+     * loader, that consumes them in place. This way, data can come from memory
+     * mapped files or from a staging buffer filled by chunked reads, without
+     * ever copying it into temporary containers.<br/>
+     * Listeners connected to `on_load` are notified once the resource is
+     * complete.
+     *
+     * @tparam Loader Type of loader to use to feed the resource.
+     * @tparam Args Types of arguments to use to feed the resource.
+     * @param id Unique resource identifier.
+     * @param args Arguments to use to feed the resource.
+     * @return True if the resource is complete, false otherwise.
+     */
+    template<typename Loader, typename... Args>
+    bool stream(const id_type id, Args &&...args) {
+        const auto it = resources.find(id);
+        ENTT_ASSERT(it != resources.end(), "Resource not available");
+
+        if(Loader{}.put(*it->second, std::forward<Args>(args)...)) {
+            loaded.publish(id, it->second);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Checks if a request for a given identifier is still pending.
+     * @param id Unique resource identifier.
+     * @return True if the request is still pending, false otherwise.
+     */
+    [[nodiscard]] bool is_pending(const id_type id) const {
+        return pending.contains(id);
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever an asynchronous request is completed and published or a
+     * streamed resource is complete.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(const entt::id_type, entt::resource_handle<resource_type>);
+     * @endcode
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_load() ENTT_NOEXCEPT {
+        return sink{loaded};
+    }
+
     /**
      * @brief Reloads a resource or loads it for the first time if not present.
      *
@@ -163,6 +513,7 @@ public:
      */
     [[nodiscard]] resource_handle<const resource_type> handle(const id_type id) const {
         if(auto it = resources.find(id); it != resources.cend()) {
+            touch(id);
             return it->second;
         }
 
@@ -172,6 +523,7 @@ public:
     /*! @copydoc handle */
     [[nodiscard]] resource_handle<resource_type> handle(const id_type id) {
         if(auto it = resources.find(id); it != resources.end()) {
+            touch(id);
             return it->second;
         }
 
@@ -197,6 +549,7 @@ public:
      */
     void discard(const id_type id) {
         if(auto it = resources.find(id); it != resources.end()) {
+            untrack(id);
             resources.erase(it);
         }
     }
@@ -272,7 +625,14 @@ public:
     }
 
 private:
-    dense_map<id_type, resource_handle<resource_type>, identity> resources;
+    resource_container_type resources;
+    pending_container_type pending;
+    signal_type loaded;
+    std::shared_ptr<async_state> async;
+    mutable usage_container_type usage;
+    size_type total{};
+    size_type limit{};
+    size_type hand{};
 };
 
 } // namespace entt
@@ -1,12 +1,14 @@
 #ifndef ENTT_RESOURCE_FWD_HPP
 #define ENTT_RESOURCE_FWD_HPP
 
+#include <memory>
+
 namespace entt {
 
-template<typename>
+template<typename Type, typename = std::allocator<Type>>
 class resource_cache;
 
-template<typename>
+template<typename, bool = true>
 class resource_handle;
 
 template<typename, typename>
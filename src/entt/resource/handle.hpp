@@ -9,6 +9,208 @@
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+struct resource_block {
+    resource_block(void (*fn)(resource_block *) ENTT_NOEXCEPT) ENTT_NOEXCEPT
+        : count{1},
+          release{fn} {}
+
+    long count;
+    void (*const release)(resource_block *) ENTT_NOEXCEPT;
+};
+
+template<typename Type>
+struct resource_shared_block final: resource_block {
+    resource_shared_block(std::shared_ptr<Type> res) ENTT_NOEXCEPT
+        : resource_block{[](resource_block *block) ENTT_NOEXCEPT { delete static_cast<resource_shared_block *>(block); }},
+          resource{std::move(res)} {}
+
+    std::shared_ptr<Type> resource;
+};
+
+template<typename Type, typename Allocator>
+struct resource_inline_block final: resource_block {
+    using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<resource_inline_block>;
+
+    template<typename... Args>
+    resource_inline_block(const Allocator &alloc, Args &&...args)
+        : resource_block{[](resource_block *block) ENTT_NOEXCEPT {
+              auto *self = static_cast<resource_inline_block *>(block);
+              typename alloc_traits::allocator_type other{self->allocator};
+              alloc_traits::destroy(other, self);
+              alloc_traits::deallocate(other, self, 1u);
+          }},
+          allocator{alloc},
+          resource{std::forward<Args>(args)...} {}
+
+    Allocator allocator;
+    Type resource;
+};
+
+template<typename, bool>
+class resource_owner;
+
+template<typename Type>
+class resource_owner<Type, true> {
+    template<typename, bool>
+    friend class resource_owner;
+
+public:
+    resource_owner() ENTT_NOEXCEPT = default;
+
+    resource_owner(std::shared_ptr<Type> res) ENTT_NOEXCEPT
+        : ptr{std::move(res)} {}
+
+    template<typename Other>
+    resource_owner(const resource_owner<Other, true> &other, Type *res) ENTT_NOEXCEPT
+        : ptr{other.ptr, res} {}
+
+    template<typename Other>
+    resource_owner(const resource_owner<Other, true> &other) ENTT_NOEXCEPT
+        : ptr{other.ptr} {}
+
+    template<typename Other>
+    resource_owner(resource_owner<Other, true> &&other) ENTT_NOEXCEPT
+        : ptr{std::move(other.ptr)} {}
+
+    template<typename Allocator, typename... Args>
+    [[nodiscard]] static resource_owner allocate(const Allocator &allocator, Args &&...args) {
+        return resource_owner{std::allocate_shared<std::remove_const_t<Type>>(allocator, std::forward<Args>(args)...)};
+    }
+
+    [[nodiscard]] Type *get() const ENTT_NOEXCEPT {
+        return ptr.get();
+    }
+
+    [[nodiscard]] long use_count() const ENTT_NOEXCEPT {
+        return ptr.use_count();
+    }
+
+private:
+    std::shared_ptr<Type> ptr;
+};
+
+template<typename Type>
+class resource_owner<Type, false> {
+    template<typename, bool>
+    friend class resource_owner;
+
+    resource_owner(Type *res, resource_block *other) ENTT_NOEXCEPT
+        : resource{res},
+          block{other} {
+        if(block) {
+            ++block->count;
+        }
+    }
+
+    void release() ENTT_NOEXCEPT {
+        if(block && --block->count == 0) {
+            block->release(block);
+        }
+    }
+
+public:
+    resource_owner() ENTT_NOEXCEPT = default;
+
+    resource_owner(std::shared_ptr<Type> res)
+        : resource{res.get()},
+          block{res ? new resource_shared_block<Type>{std::move(res)} : nullptr} {}
+
+    template<typename Other>
+    resource_owner(const resource_owner<Other, true> &other)
+        : resource_owner{std::shared_ptr<Type>{other.ptr}} {}
+
+    resource_owner(const resource_owner &other) ENTT_NOEXCEPT
+        : resource_owner{other.resource, other.block} {}
+
+    resource_owner(resource_owner &&other) ENTT_NOEXCEPT
+        : resource{std::exchange(other.resource, nullptr)},
+          block{std::exchange(other.block, nullptr)} {}
+
+    template<typename Other>
+    resource_owner(const resource_owner<Other, false> &other, Type *res) ENTT_NOEXCEPT
+        : resource_owner{res, other.block} {}
+
+    template<typename Other>
+    resource_owner(const resource_owner<Other, false> &other) ENTT_NOEXCEPT
+        : resource_owner{other.resource, other.block} {}
+
+    template<typename Other>
+    resource_owner(resource_owner<Other, false> &&other) ENTT_NOEXCEPT
+        : resource{std::exchange(other.resource, nullptr)},
+          block{std::exchange(other.block, nullptr)} {}
+
+    ~resource_owner() {
+        release();
+    }
+
+    resource_owner &operator=(const resource_owner &other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            *this = resource_owner{other};
+        }
+
+        return *this;
+    }
+
+    resource_owner &operator=(resource_owner &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            release();
+            resource = std::exchange(other.resource, nullptr);
+            block = std::exchange(other.block, nullptr);
+        }
+
+        return *this;
+    }
+
+    template<typename Allocator, typename... Args>
+    [[nodiscard]] static resource_owner allocate(const Allocator &allocator, Args &&...args) {
+        // the resource and its counter share the same allocation
+        using block_type = resource_inline_block<std::remove_const_t<Type>, Allocator>;
+        using alloc_traits = typename block_type::alloc_traits;
+
+        typename alloc_traits::allocator_type alloc{allocator};
+        auto *elem = alloc_traits::allocate(alloc, 1u);
+
+        ENTT_TRY {
+            alloc_traits::construct(alloc, elem, allocator, std::forward<Args>(args)...);
+        }
+        ENTT_CATCH {
+            alloc_traits::deallocate(alloc, elem, 1u);
+            ENTT_THROW;
+        }
+
+        resource_owner owner{};
+        owner.resource = &elem->resource;
+        owner.block = elem;
+        return owner;
+    }
+
+    [[nodiscard]] Type *get() const ENTT_NOEXCEPT {
+        return resource;
+    }
+
+    [[nodiscard]] long use_count() const ENTT_NOEXCEPT {
+        return block ? block->count : 0;
+    }
+
+private:
+    Type *resource{};
+    resource_block *block{};
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Shared resource handle.
  *
@@ -19,14 +221,26 @@ namespace entt {
  * As a rule of thumb, resources should never be copied nor moved. Handles are
  * the way to go to keep references to them.
  *
+ * By default, handles rely on shared pointers and their counters are atomic.
+ * Handles with a local counter count references on their own instead, without
+ * atomic operations. Copying them is as cheap as an increment but they can't
+ * be shared between threads. The counting policy is part of the type of a
+ * handle, so that handles of both kinds can be used side by side.
+ *
  * @tparam Resource Type of resource managed by a handle.
+ * @tparam Atomic True to use an atomic counter, false otherwise.
  */
-template<typename Resource>
+template<typename Resource, bool Atomic>
 class resource_handle {
     /*! @brief Resource handles are friends with each other. */
-    template<typename>
+    template<typename, bool>
     friend class resource_handle;
 
+    using owner_type = internal::resource_owner<Resource, Atomic>;
+
+    resource_handle(owner_type other) ENTT_NOEXCEPT
+        : owner{std::move(other)} {}
+
 public:
     /*! @brief Value type. */
     using value_type = Resource;
@@ -34,7 +248,7 @@ public:
     using reference = value_type &;
     /*! @brief Pointer type. */
     using pointer = value_type *;
-    /*! @brief Unsigned integer type. */
+    /*! @brief Signed integer type. */
     using size_type = long;
 
     /*! @brief Default constructor. */
@@ -42,10 +256,27 @@ public:
 
     /**
      * @brief Creates a handle from a shared pointer, namely a resource.
+     *
+     * Handles with a local counter allocate a control block that keeps the
+     * shared pointer alive. Prefer `allocate_resource` for them when possible.
+     *
      * @param res A pointer to a properly initialized resource.
      */
-    resource_handle(std::shared_ptr<value_type> res) ENTT_NOEXCEPT
-        : resource{std::move(res)} {}
+    resource_handle(std::shared_ptr<value_type> res) ENTT_NOEXCEPT_IF(Atomic)
+        : owner{std::move(res)} {}
+
+    /**
+     * @brief Creates a handle with a local counter that shares ownership of
+     * the resource with a handle with an atomic counter.
+     *
+     * Copies of the handle created don't touch the atomic counter.
+     *
+     * @tparam Other Type of resource managed by the received handle.
+     * @param other The handle to share ownership with.
+     */
+    template<typename Other, bool Local = !Atomic, typename = std::enable_if_t<Local && (std::is_same_v<value_type, Other> || std::is_base_of_v<value_type, Other>)>>
+    explicit resource_handle(const resource_handle<Other, true> &other)
+        : owner{other.owner} {}
 
     /**
      * @brief Copy constructor.
@@ -66,8 +297,8 @@ public:
      * @param res Unrelated and unmanaged resources.
      */
     template<typename Other>
-    resource_handle(const resource_handle<Other> &other, value_type &res) ENTT_NOEXCEPT
-        : resource{other.resource, std::addressof(res)} {}
+    resource_handle(const resource_handle<Other, Atomic> &other, value_type &res) ENTT_NOEXCEPT
+        : owner{other.owner, std::addressof(res)} {}
 
     /**
      * @brief Copy constructs a handle which shares ownership of the resource.
@@ -75,8 +306,8 @@ public:
      * @param other The handle to copy from.
      */
     template<typename Other, typename = std::enable_if_t<!std::is_same_v<value_type, Other> && std::is_base_of_v<value_type, Other>>>
-    resource_handle(const resource_handle<Other> &other) ENTT_NOEXCEPT
-        : resource{other.resource} {}
+    resource_handle(const resource_handle<Other, Atomic> &other) ENTT_NOEXCEPT
+        : owner{other.owner} {}
 
     /**
      * @brief Move constructs a handle which takes ownership of the resource.
@@ -84,8 +315,8 @@ public:
      * @param other The handle to move from.
      */
     template<typename Other, typename = std::enable_if_t<!std::is_same_v<value_type, Other> && std::is_base_of_v<value_type, Other>>>
-    resource_handle(resource_handle<Other> &&other) ENTT_NOEXCEPT
-        : resource{std::move(other.resource)} {}
+    resource_handle(resource_handle<Other, Atomic> &&other) ENTT_NOEXCEPT
+        : owner{std::move(other.owner)} {}
 
     /**
      * @brief Copy assignment operator.
@@ -109,8 +340,8 @@ public:
      */
     template<typename Other>
     std::enable_if_t<!std::is_same_v<value_type, Other> && std::is_base_of_v<value_type, Other>, resource_handle &>
-    operator=(const resource_handle<Other> &other) ENTT_NOEXCEPT {
-        resource = other.resource;
+    operator=(const resource_handle<Other, Atomic> &other) ENTT_NOEXCEPT {
+        owner = owner_type{other.owner};
         return *this;
     }
 
@@ -122,8 +353,8 @@ public:
      */
     template<typename Other>
     std::enable_if_t<!std::is_same_v<value_type, Other> && std::is_base_of_v<value_type, Other>, resource_handle &>
-    operator=(resource_handle<Other> &&other) ENTT_NOEXCEPT {
-        resource = std::move(other.resource);
+    operator=(resource_handle<Other, Atomic> &&other) ENTT_NOEXCEPT {
+        owner = owner_type{std::move(other.owner)};
         return *this;
     }
 
@@ -136,7 +367,7 @@ public:
      * @return A reference to the managed resource.
      */
     [[nodiscard]] reference get() const ENTT_NOEXCEPT {
-        return *resource;
+        return *owner.get();
     }
 
     /*! @copydoc get */
@@ -159,7 +390,7 @@ public:
      * contains no resource at all.
      */
     [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
-        return resource.get();
+        return owner.get();
     }
 
     /**
@@ -167,39 +398,85 @@ public:
      * @return True if the handle contains a resource, false otherwise.
      */
     [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
-        return static_cast<bool>(resource);
+        return (owner.get() != nullptr);
     }
 
     /**
      * @brief Returns the number of handles pointing the same resource.
+     *
+     * A handle with a local counter created from a shared pointer or another
+     * handle counts as a single reference for its source.
+     *
      * @return The number of handles pointing the same resource.
      */
     [[nodiscard]] size_type use_count() const ENTT_NOEXCEPT {
-        return resource.use_count();
+        return owner.use_count();
     }
 
 private:
-    std::shared_ptr<value_type> resource;
+    owner_type owner;
+
+    template<typename Type, bool Shared, typename Allocator, typename... Args>
+    friend resource_handle<Type, Shared> allocate_resource(const Allocator &, Args &&...);
 };
 
 /**
  * @brief Compares two handles.
  * @tparam Res Type of resource managed by the first handle.
+ * @tparam Lhs Counting policy of the first handle.
  * @tparam Other Type of resource managed by the second handle.
+ * @tparam Rhs Counting policy of the second handle.
  * @param lhs A valid handle.
  * @param rhs A valid handle.
  * @return True if both handles refer to the same resource, false otherwise.
  */
-template<typename Res, typename Other>
-[[nodiscard]] bool operator==(const resource_handle<Res> &lhs, const resource_handle<Other> &rhs) ENTT_NOEXCEPT {
+template<typename Res, bool Lhs, typename Other, bool Rhs>
+[[nodiscard]] bool operator==(const resource_handle<Res, Lhs> &lhs, const resource_handle<Other, Rhs> &rhs) ENTT_NOEXCEPT {
     return lhs.operator->() == rhs.operator->();
 }
 
-template<typename ILhs, typename IRhs>
-[[nodiscard]] bool operator!=(const resource_handle<ILhs> &lhs, const resource_handle<IRhs> &rhs) ENTT_NOEXCEPT {
+template<typename ILhs, bool Lhs, typename IRhs, bool Rhs>
+[[nodiscard]] bool operator!=(const resource_handle<ILhs, Lhs> &lhs, const resource_handle<IRhs, Rhs> &rhs) ENTT_NOEXCEPT {
     return !(lhs == rhs);
 }
 
+/**
+ * @brief Creates a resource and a handle for it.
+ *
+ * The resource and its reference counter share the same allocation, obtained
+ * from the given allocator.
+ *
+ * @tparam Type Type of resource to create.
+ * @tparam Atomic True to create a handle with an atomic counter, false
+ * otherwise.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Args Types of arguments to use to construct the resource.
+ * @param allocator The allocator to use.
+ * @param args Parameters to use to construct the resource.
+ * @return A handle for the resource just created.
+ */
+template<typename Type, bool Atomic = true, typename Allocator, typename... Args>
+[[nodiscard]] resource_handle<Type, Atomic> allocate_resource(const Allocator &allocator, Args &&...args) {
+    return resource_handle<Type, Atomic>{internal::resource_owner<Type, Atomic>::allocate(allocator, std::forward<Args>(args)...)};
+}
+
+/**
+ * @brief Creates a resource and a handle for it.
+ *
+ * @sa allocate_resource
+ *
+ * @tparam Type Type of resource to create.
+ * @tparam Atomic True to create a handle with an atomic counter, false
+ * otherwise.
+ * @tparam Args Types of arguments to use to construct the resource.
+ * @param args Parameters to use to construct the resource.
+ * @return A handle for the resource just created.
+ */
+template<typename Type, bool Atomic = true, typename... Args>
+[[nodiscard]] resource_handle<Type, Atomic> make_resource(Args &&...args) {
+    return allocate_resource<Type, Atomic>(std::allocator<std::remove_const_t<Type>>{}, std::forward<Args>(args)...);
+}
+
 } // namespace entt
 
 #endif
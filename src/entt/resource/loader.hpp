@@ -29,6 +29,18 @@ namespace entt {
  * In general, resource loaders should not have a state or retain data of any
  * type. They should let the cache manage their resources instead.
  *
+ * Loaders that support streaming also expose a public, const member function
+ * named `stream` that accepts a resource along with a variable number of
+ * arguments (as an example, a view on a chunk of data). It feeds the resource
+ * in place and returns true once the resource is complete:
+ *
+ * @code{.cpp}
+ * bool stream(my_resource &res, const std::byte *data, std::size_t length) const {
+ *     // consume the chunk of data without copying it
+ *     return res.complete();
+ * }
+ * @endcode
+ *
  * @note
  * Base class and CRTP idiom aren't strictly required with the current
  * implementation. One could argue that a cache can easily work with loaders of
@@ -41,7 +53,7 @@ namespace entt {
 template<typename Loader, typename Resource>
 class resource_loader {
     /*! @brief Resource loaders are friends of their caches. */
-    template<typename Other>
+    template<typename, typename>
     friend class resource_cache;
 
     /**
@@ -54,6 +66,18 @@ class resource_loader {
     [[nodiscard]] resource_handle<Resource> get(Args &&...args) const {
         return static_cast<const Loader *>(this)->load(std::forward<Args>(args)...);
     }
+
+    /**
+     * @brief Feeds a resource with a chunk of data.
+     * @tparam Args Types of arguments for the loader.
+     * @param res The resource to feed.
+     * @param args Arguments for the loader.
+     * @return True if the resource is complete, false otherwise.
+     */
+    template<typename... Args>
+    [[nodiscard]] bool put(Resource &res, Args &&...args) const {
+        return static_cast<const Loader *>(this)->stream(res, std::forward<Args>(args)...);
+    }
 };
 
 } // namespace entt
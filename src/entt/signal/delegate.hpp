@@ -259,6 +259,17 @@ public:
         return instance;
     }
 
+    /**
+     * @brief Returns the function connected to a delegate, if any.
+     *
+     * The payload is expected as the first argument when invoking the target.
+     *
+     * @return A pointer to the underlying function.
+     */
+    [[nodiscard]] function_type *target() const ENTT_NOEXCEPT {
+        return fn;
+    }
+
     /**
      * @brief Triggers a delegate.
      *
@@ -2,8 +2,16 @@
 #define ENTT_SIGNAL_DISPATCHER_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -12,12 +20,40 @@
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
+#include "event_awaiter.hpp"
+#include "event_trace.hpp"
 #include "fwd.hpp"
 #include "sigh.hpp"
 
 namespace entt {
 
+/*! @brief Dispatcher queue overflow policy. */
+enum class overflow_policy : std::uint8_t {
+    /*! @brief The queue grows to make room for the event. */
+    grow = 0u,
+    /*! @brief The oldest event is discarded to make room for the new one. */
+    discard_oldest = 1u,
+    /*! @brief The new event is discarded. */
+    discard_newest = 2u
+};
+
+/**
+ * @brief Extracts a key from events of the given type.
+ *
+ * Primary template isn't defined on purpose. Specializing it for an event type
+ * makes events of that type _coalescing_: an event enqueued while another one
+ * with the same key is still pending replaces the latter rather than being
+ * queued. Specializations must be visible before the event type is used with a
+ * dispatcher and offer a const call operator that accepts an event and returns
+ * its key.
+ *
+ * @tparam Event Type of event.
+ */
+template<typename Event>
+struct event_key;
+
 /**
  * @cond TURN_OFF_DOXYGEN
  * Internal details not to be documented.
@@ -27,35 +63,389 @@ namespace internal {
 
 struct basic_dispatcher_handler {
     virtual ~basic_dispatcher_handler() = default;
-    virtual void publish() = 0;
+    virtual std::size_t publish(const std::size_t) = 0;
     virtual void disconnect(void *) = 0;
     virtual void clear() ENTT_NOEXCEPT = 0;
     virtual std::size_t size() const ENTT_NOEXCEPT = 0;
+
+    int priority{};
 };
 
+[[nodiscard]] inline std::uint64_t next_event_queue_id() ENTT_NOEXCEPT {
+    static std::atomic<std::uint64_t> value{};
+    return value.fetch_add(1u, std::memory_order_relaxed) + 1u;
+}
+
 template<typename Event, typename Allocator>
+class concurrent_event_queue final {
+    using container_type = std::vector<Event, typename std::allocator_traits<Allocator>::template rebind_alloc<Event>>;
+
+    // one pair of buffers per producer thread, producers never contend with each other
+    struct producer_node {
+        producer_node(const std::thread::id id, const Allocator &allocator)
+            : owner{id},
+              buffer{allocator},
+              spare{allocator} {}
+
+        const std::thread::id owner;
+        // the owner only shares the lock with the consumer while the buffers are swapped
+        std::mutex mutex{};
+        container_type buffer;
+        container_type spare;
+        std::atomic<std::size_t> count{};
+        producer_node *next{};
+    };
+
+    using producer_traits = typename std::allocator_traits<Allocator>::template rebind_traits<producer_node>;
+
+    // the buffers of this thread for all the queues of this type, identifiers are never reused
+    [[nodiscard]] static dense_map<std::uint64_t, producer_node *> &thread_cache() {
+        static thread_local dense_map<std::uint64_t, producer_node *> cache{};
+        return cache;
+    }
+
+    [[nodiscard]] producer_node &local() {
+        auto &slot = thread_cache()[uid];
+
+        if(!slot) {
+            const auto id = std::this_thread::get_id();
+            auto *elem = packed.first().load(std::memory_order_acquire);
+
+            for(; elem && elem->owner != id; elem = elem->next) {}
+
+            if(!elem) {
+                typename producer_traits::allocator_type allocator{packed.second()};
+                elem = producer_traits::allocate(allocator, 1u);
+                producer_traits::construct(allocator, elem, id, packed.second());
+                elem->next = packed.first().load(std::memory_order_relaxed);
+                while(!packed.first().compare_exchange_weak(elem->next, elem, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+
+            slot = elem;
+        }
+
+        return *slot;
+    }
+
+    template<typename Func>
+    void deliver(producer_node &producer, Func &func) {
+        auto &events = producer.spare;
+        std::size_t pos{};
+
+        ENTT_TRY {
+            for(const auto last = events.size(); pos < last; ++pos) {
+                func(std::move(events[pos]));
+            }
+        }
+        ENTT_CATCH {
+            // the failing event is dropped along with those delivered, the others are kept for the next drain
+            events.erase(events.begin(), events.begin() + pos + 1u);
+            producer.count.fetch_sub(pos + 1u, std::memory_order_relaxed);
+            ENTT_THROW;
+        }
+
+        producer.count.fetch_sub(events.size(), std::memory_order_relaxed);
+        events.clear();
+    }
+
+    template<typename Func>
+    void drain(producer_node &producer, Func &func) {
+        // leftovers of a drain interrupted by an exception come first
+        deliver(producer, func);
+
+        {
+            std::lock_guard guard{producer.mutex};
+            // buffers keep their capacity, memory is only allocated when a buffer is full
+            producer.spare.swap(producer.buffer);
+        }
+
+        deliver(producer, func);
+    }
+
+public:
+    concurrent_event_queue(const Allocator &allocator)
+        : packed{nullptr, allocator},
+          uid{next_event_queue_id()} {}
+
+    concurrent_event_queue(const concurrent_event_queue &) = delete;
+    concurrent_event_queue &operator=(const concurrent_event_queue &) = delete;
+
+    ~concurrent_event_queue() {
+        typename producer_traits::allocator_type allocator{packed.second()};
+        auto *curr = packed.first().load(std::memory_order_acquire);
+
+        clear();
+        // entries of other threads are stale but harmless, they're never looked up again
+        thread_cache().erase(uid);
+
+        while(curr) {
+            auto *next = curr->next;
+            producer_traits::destroy(allocator, curr);
+            producer_traits::deallocate(allocator, curr, 1u);
+            curr = next;
+        }
+    }
+
+    void push(Event event) {
+        auto &producer = local();
+        std::lock_guard guard{producer.mutex};
+        producer.buffer.push_back(std::move(event));
+        producer.count.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    template<typename Func>
+    void consume(Func func) {
+        for(auto *curr = packed.first().load(std::memory_order_acquire); curr; curr = curr->next) {
+            drain(*curr, func);
+        }
+    }
+
+    void clear() {
+        consume([](Event &&) {});
+    }
+
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        std::size_t length{};
+
+        for(auto *curr = packed.first().load(std::memory_order_acquire); curr; curr = curr->next) {
+            length += curr->count.load(std::memory_order_relaxed);
+        }
+
+        return length;
+    }
+
+private:
+    compressed_pair<std::atomic<producer_node *>, Allocator> packed;
+    const std::uint64_t uid;
+};
+
+template<typename Event, typename Allocator>
+struct sequential_event_queue final {
+    sequential_event_queue(const Allocator &) {}
+
+    template<typename Func>
+    void consume(Func) {}
+
+    void clear() {}
+
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return 0u;
+    }
+};
+
+template<typename Event, typename Allocator>
+class event_ring final {
+    using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<Event>;
+    using pointer = typename alloc_traits::pointer;
+
+    [[nodiscard]] pointer slot(const std::size_t pos) const ENTT_NOEXCEPT {
+        return packed.first() + ((head + pos) % length);
+    }
+
+public:
+    event_ring(const Allocator &allocator)
+        : packed{nullptr, allocator} {}
+
+    event_ring(const event_ring &) = delete;
+    event_ring &operator=(const event_ring &) = delete;
+
+    ~event_ring() {
+        clear();
+
+        if(length) {
+            alloc_traits::deallocate(packed.second(), packed.first(), length);
+        }
+    }
+
+    void reserve(const std::size_t cap) {
+        if(cap > length) {
+            auto &allocator = packed.second();
+            const auto mem = alloc_traits::allocate(allocator, cap);
+            std::size_t pos{};
+
+            ENTT_TRY {
+                for(; pos < count; ++pos) {
+                    alloc_traits::construct(allocator, std::addressof(mem[pos]), std::move_if_noexcept(*slot(pos)));
+                }
+            }
+            ENTT_CATCH {
+                for(std::size_t next{}; next < pos; ++next) {
+                    alloc_traits::destroy(allocator, std::addressof(mem[next]));
+                }
+
+                alloc_traits::deallocate(allocator, mem, cap);
+                ENTT_THROW;
+            }
+
+            if(length) {
+                for(pos = {}; pos < count; ++pos) {
+                    alloc_traits::destroy(allocator, std::addressof(*slot(pos)));
+                }
+
+                alloc_traits::deallocate(allocator, packed.first(), length);
+            }
+
+            packed.first() = mem;
+            length = cap;
+            head = {};
+        }
+    }
+
+    template<typename... Args>
+    void emplace_back(Args &&...args) {
+        ENTT_ASSERT(count < length, "Ring is full");
+        alloc_traits::construct(packed.second(), std::addressof(*slot(count)), std::forward<Args>(args)...);
+        ++count;
+    }
+
+    [[nodiscard]] Event &operator[](const std::size_t pos) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < count, "Index out of bounds");
+        return *slot(pos);
+    }
+
+    [[nodiscard]] Event &front() const ENTT_NOEXCEPT {
+        ENTT_ASSERT(count, "Ring is empty");
+        return *slot(0u);
+    }
+
+    void pop_front() {
+        ENTT_ASSERT(count, "Ring is empty");
+        alloc_traits::destroy(packed.second(), std::addressof(*slot(0u)));
+        head = (head + 1u) % length;
+        --count;
+    }
+
+    void clear() {
+        while(count) {
+            pop_front();
+        }
+
+        head = {};
+    }
+
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    [[nodiscard]] std::size_t capacity() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+private:
+    compressed_pair<pointer, typename alloc_traits::allocator_type> packed;
+    std::size_t length{};
+    std::size_t head{};
+    std::size_t count{};
+};
+
+template<typename Event, typename Allocator, typename = void>
+struct event_index {
+    event_index(const Allocator &) {}
+};
+
+template<typename Event, typename Allocator>
+struct event_index<Event, Allocator, std::enable_if_t<is_complete_v<event_key<Event>>>> {
+    using key_type = std::remove_const_t<std::remove_reference_t<std::invoke_result_t<event_key<Event>, const Event &>>>;
+    using container_type = dense_map<key_type, std::size_t, std::hash<key_type>, std::equal_to<key_type>, typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const key_type, std::size_t>>>;
+
+    event_index(const Allocator &allocator)
+        : positions{allocator} {}
+
+    container_type positions;
+};
+
+template<typename Event, typename Allocator, bool Concurrent>
 class dispatcher_handler final: public basic_dispatcher_handler {
     static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
 
     using alloc_traits = std::allocator_traits<Allocator>;
     using signal_type = sigh<void(Event &), typename alloc_traits::template rebind_alloc<void (*)(Event &)>>;
-    using container_type = std::vector<Event, typename alloc_traits::template rebind_alloc<Event>>;
+    using container_type = event_ring<Event, Allocator>;
+    using queue_type = std::conditional_t<Concurrent, concurrent_event_queue<Event, Allocator>, sequential_event_queue<Event, Allocator>>;
+
+    static constexpr bool coalesce = is_complete_v<event_key<Event>>;
+    static_assert(!coalesce || std::is_move_assignable_v<Event>, "Coalesced events must be move assignable");
+
+    void pop_front() {
+        events.pop_front();
+        ++popped;
+    }
+
+    template<typename... Args>
+    bool push_back(Args &&...args) {
+        if(events.size() == events.capacity()) {
+            switch(policy) {
+            case overflow_policy::grow:
+                events.reserve(events.capacity() ? (events.capacity() * 2u) : 1u);
+                break;
+            case overflow_policy::discard_oldest:
+                if(!events.size()) {
+                    return false;
+                }
+
+                pop_front();
+                // the oldest events are the first ones still to be delivered, if any
+                in_flight -= (in_flight != 0u);
+                break;
+            case overflow_policy::discard_newest:
+                return false;
+            }
+        }
+
+        events.emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    template<typename... Args>
+    void push(Args &&...args) {
+        if constexpr(coalesce) {
+            if constexpr(sizeof...(Args) == 1u && (std::is_same_v<std::remove_const_t<std::remove_reference_t<Args>>, Event> && ...)) {
+                auto key = event_key<Event>{}(std::as_const(args)...);
+
+                // positions are absolute, those of events delivered or discarded in the meantime are stale
+                if(const auto it = index.positions.find(key); it != index.positions.end() && it->second >= popped) {
+                    ((events[it->second - popped] = std::forward<Args>(args)), ...);
+                } else if(push_back(std::forward<Args>(args)...)) {
+                    index.positions.insert_or_assign(std::move(key), popped + events.size() - 1u);
+                }
+            } else {
+                push(Event(std::forward<Args>(args)...));
+            }
+        } else {
+            push_back(std::forward<Args>(args)...);
+        }
+    }
 
 public:
     using allocator_type = Allocator;
 
     dispatcher_handler(const allocator_type &allocator)
         : signal{allocator},
-          events{allocator} {}
+          waiters{},
+          events{allocator},
+          pending{allocator},
+          index{allocator} {}
 
-    void publish() override {
-        const auto length = events.size();
+    std::size_t publish(const std::size_t max) override {
+        ENTT_PROFILE_SCOPE(type_id<Event>().name());
+        pending.consume([this](Event &&event) { push(std::move(event)); });
+        std::size_t length{};
 
-        for(std::size_t pos{}; pos < length; ++pos) {
-            signal.publish(events[pos]);
+        // events leave the queue before delivery, listeners can enqueue others without invalidating them
+        for(in_flight = (std::min)(events.size(), max); in_flight; --in_flight, ++length) {
+            Event event(std::move(events.front()));
+            pop_front();
+            signal.publish(event);
+            waiters.publish(event);
         }
 
-        events.erase(events.cbegin(), events.cbegin() + length);
+        if constexpr(coalesce) {
+            if(!events.size()) {
+                index.positions.clear();
+            }
+        }
+
+        return length;
     }
 
     void disconnect(void *instance) override {
@@ -63,7 +453,19 @@ public:
     }
 
     void clear() ENTT_NOEXCEPT override {
+        pending.clear();
+        popped += events.size();
         events.clear();
+        in_flight = {};
+
+        if constexpr(coalesce) {
+            index.positions.clear();
+        }
+    }
+
+    void reserve(const std::size_t cap, const overflow_policy value) {
+        events.reserve(cap);
+        policy = value;
     }
 
     [[nodiscard]] auto bucket() ENTT_NOEXCEPT {
@@ -73,26 +475,49 @@ public:
 
     void trigger(Event event) {
         signal.publish(event);
+        waiters.publish(event);
+    }
+
+    [[nodiscard]] event_awaiter<Event> next() ENTT_NOEXCEPT {
+        return event_awaiter<Event>{waiters};
     }
 
     template<typename... Args>
     void enqueue(Args &&...args) {
-        if constexpr(std::is_aggregate_v<Event>) {
-            events.push_back(Event{std::forward<Args>(args)...});
+        if constexpr(Concurrent) {
+            if constexpr(std::is_aggregate_v<Event>) {
+                pending.push(Event{std::forward<Args>(args)...});
+            } else {
+                pending.push(Event(std::forward<Args>(args)...));
+            }
+        } else if constexpr(std::is_aggregate_v<Event>) {
+            push(Event{std::forward<Args>(args)...});
         } else {
-            events.emplace_back(std::forward<Args>(args)...);
+            push(std::forward<Args>(args)...);
         }
     }
 
     std::size_t size() const ENTT_NOEXCEPT override {
-        return events.size();
+        return events.size() + pending.size();
+    }
+
+    std::size_t capacity() const ENTT_NOEXCEPT {
+        return events.capacity();
     }
 
 private:
     signal_type signal;
+    event_waiter<Event> waiters;
     container_type events;
+    queue_type pending;
+    event_index<Event, Allocator> index;
+    std::size_t popped{};
+    std::size_t in_flight{};
+    overflow_policy policy{overflow_policy::grow};
 };
 
+struct dispatcher_no_mutex {};
+
 } // namespace internal
 
 /**
@@ -112,12 +537,20 @@ private:
  * The dispatcher creates instances of the `sigh` class internally. Refer to the
  * documentation of the latter for more details.
  *
+ * When `Concurrent` is true, events can be enqueued from multiple threads at
+ * once without any external synchronization. Each thread pushes events to its
+ * own lock-free list, registered on first use, and all lists are moved to the
+ * queue of their type by the next call to `update`.<br/>
+ * All other functions aren't thread-safe and must be invoked from a single
+ * thread, the one that delivers the events.
+ *
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Concurrent True to make enqueuing events thread-safe.
  */
-template<typename Allocator>
+template<typename Allocator, bool Concurrent>
 class basic_dispatcher {
     template<typename Event>
-    using handler_type = internal::dispatcher_handler<Event, Allocator>;
+    using handler_type = internal::dispatcher_handler<Event, Allocator, Concurrent>;
 
     using key_type = id_type;
     // std::shared_ptr because of its type erased allocator which is pretty useful here
@@ -128,7 +561,7 @@ class basic_dispatcher {
     using container_type = dense_map<id_type, mapped_type, identity, std::equal_to<id_type>, container_allocator>;
 
     template<typename Event>
-    [[nodiscard]] handler_type<Event> &assure(const id_type id) {
+    [[nodiscard]] handler_type<Event> &emplace_handler(const id_type id) {
         auto &&ptr = pools.first()[id];
 
         if(!ptr) {
@@ -139,8 +572,23 @@ class basic_dispatcher {
         return static_cast<handler_type<Event> &>(*ptr);
     }
 
+    template<typename Event>
+    [[nodiscard]] handler_type<Event> &assure(const id_type id) {
+        if constexpr(Concurrent) {
+            if(auto *cpool = const_cast<handler_type<Event> *>(std::as_const(*this).template assure<Event>(id)); cpool) {
+                return *cpool;
+            }
+
+            std::unique_lock lock{mutex};
+            return emplace_handler<Event>(id);
+        } else {
+            return emplace_handler<Event>(id);
+        }
+    }
+
     template<typename Event>
     [[nodiscard]] const handler_type<Event> *assure(const id_type id) const {
+        [[maybe_unused]] const auto lock = shared_lock();
         auto &container = pools.first();
 
         if(const auto it = container.find(id); it != container.end()) {
@@ -150,6 +598,31 @@ class basic_dispatcher {
         return nullptr;
     }
 
+    [[nodiscard]] auto shared_lock() const {
+        if constexpr(Concurrent) {
+            return std::shared_lock{mutex};
+        } else {
+            return internal::dispatcher_no_mutex{};
+        }
+    }
+
+    [[nodiscard]] auto handlers() const {
+        std::vector<internal::basic_dispatcher_handler *, typename alloc_traits::template rebind_alloc<internal::basic_dispatcher_handler *>> elems{pools.second()};
+
+        {
+            // listeners can enqueue events of new types, the map is locked only to take a snapshot
+            [[maybe_unused]] const auto lock = shared_lock();
+            elems.reserve(pools.first().size());
+
+            for(auto &&cpool: pools.first()) {
+                elems.push_back(cpool.second.get());
+            }
+        }
+
+        std::stable_sort(elems.begin(), elems.end(), [](const auto *lhs, const auto *rhs) { return lhs->priority > rhs->priority; });
+        return elems;
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -172,7 +645,9 @@ public:
      * @param other The instance to move from.
      */
     basic_dispatcher(basic_dispatcher &&other) ENTT_NOEXCEPT
-        : pools{std::move(other.pools)} {}
+        : pools{std::move(other.pools)},
+          prioritized{other.prioritized},
+          recorder{other.recorder} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -180,7 +655,9 @@ public:
      * @param allocator The allocator to use.
      */
     basic_dispatcher(basic_dispatcher &&other, const allocator_type &allocator) ENTT_NOEXCEPT
-        : pools{container_type{std::move(other.pools.first()), allocator}, allocator} {}
+        : pools{container_type{std::move(other.pools.first()), allocator}, allocator},
+          prioritized{other.prioritized},
+          recorder{other.recorder} {}
 
     /**
      * @brief Move assignment operator.
@@ -189,6 +666,8 @@ public:
      */
     basic_dispatcher &operator=(basic_dispatcher &&other) ENTT_NOEXCEPT {
         pools = std::move(other.pools);
+        prioritized = other.prioritized;
+        recorder = other.recorder;
         return *this;
     }
 
@@ -199,6 +678,8 @@ public:
     void swap(basic_dispatcher &other) {
         using std::swap;
         swap(pools, other.pools);
+        swap(prioritized, other.prioritized);
+        swap(recorder, other.recorder);
     }
 
     /**
@@ -221,11 +702,43 @@ public:
         return cpool ? cpool->size() : 0u;
     }
 
+    /**
+     * @brief Returns the number of events a queue has currently allocated
+     * space for.
+     * @tparam Event Type of event for which to return the capacity.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return Capacity of the queue for the given type.
+     */
+    template<typename Event>
+    size_type capacity(const id_type id = type_hash<Event>::value()) const ENTT_NOEXCEPT {
+        const auto *cpool = assure<Event>(id);
+        return cpool ? cpool->capacity() : 0u;
+    }
+
+    /**
+     * @brief Allocates enough memory upfront to accommodate the given number
+     * of events and sets the policy to use when a queue is full.
+     *
+     * Queues are ring buffers that never shrink. With the default policy, a
+     * full queue doubles its capacity. Otherwise, the capacity is fixed and
+     * either the oldest or the newest event is discarded on overflow.
+     *
+     * @tparam Event Type of event for which to reserve space.
+     * @param cap Desired capacity.
+     * @param policy Policy to use when the queue is full.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Event>
+    void reserve(const size_type cap, const overflow_policy policy = overflow_policy::grow, const id_type id = type_hash<Event>::value()) {
+        assure<Event>(id).reserve(cap, policy);
+    }
+
     /**
      * @brief Returns the total number of pending events.
      * @return The total number of pending events.
      */
     size_type size() const ENTT_NOEXCEPT {
+        [[maybe_unused]] const auto lock = shared_lock();
         size_type count{};
 
         for(auto &&cpool: pools.first()) {
@@ -258,6 +771,24 @@ public:
         return assure<Event>(id).bucket();
     }
 
+    /**
+     * @brief Returns an awaitable for the next event of a given type.
+     *
+     * A coroutine that awaits the returned object is resumed inline as soon
+     * as the next event of the given type is either triggered or delivered,
+     * after the listeners. No listener is connected for this purpose.
+     *
+     * @sa event_awaiter
+     *
+     * @tparam Event Type of event to wait for.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return An awaitable that returns a copy of the event.
+     */
+    template<typename Event>
+    [[nodiscard]] event_awaiter<Event> next(const id_type id = type_hash<Event>::value()) {
+        return assure<Event>(id).next();
+    }
+
     /**
      * @brief Triggers an immediate event of a given type.
      * @tparam Event Type of event to trigger.
@@ -276,6 +807,10 @@ public:
      */
     template<typename Event>
     void trigger(const id_type id, Event &&event = {}) {
+        if(recorder) {
+            recorder->record(dispatch_kind::trigger, id, std::as_const(event));
+        }
+
         assure<std::decay_t<Event>>(id).trigger(std::forward<Event>(event));
     }
 
@@ -309,6 +844,18 @@ public:
      */
     template<typename Event, typename... Args>
     void enqueue_hint(const id_type id, Args &&...args) {
+        if constexpr(std::is_trivially_copyable_v<Event>) {
+            if(recorder) {
+                if constexpr(std::is_aggregate_v<Event>) {
+                    enqueue_hint(id, Event{std::forward<Args>(args)...});
+                } else {
+                    enqueue_hint(id, Event(std::forward<Args>(args)...));
+                }
+
+                return;
+            }
+        }
+
         assure<Event>(id).enqueue(std::forward<Args>(args)...);
     }
 
@@ -320,6 +867,10 @@ public:
      */
     template<typename Event>
     void enqueue_hint(const id_type id, Event &&event) {
+        if(recorder) {
+            recorder->record(dispatch_kind::enqueue, id, std::as_const(event));
+        }
+
         assure<std::decay_t<Event>>(id).enqueue(std::forward<Event>(event));
     }
 
@@ -364,6 +915,53 @@ public:
         }
     }
 
+    /**
+     * @brief Starts or stops recording events.
+     *
+     * Trivially copyable events are recorded in the given trace when they're
+     * triggered or enqueued, before they reach their queues. All the other
+     * events are never recorded.
+     *
+     * @warning
+     * Recording isn't thread-safe, not even for concurrent dispatchers.<br/>
+     * Lifetime of a trace must overcome that of the recording.
+     *
+     * @param trace A trace in which to record events, a null pointer to stop
+     * recording.
+     */
+    void record(event_trace *trace) ENTT_NOEXCEPT {
+        recorder = trace;
+    }
+
+    /**
+     * @brief Sets the priority of a queue.
+     *
+     * Queues with a higher priority are updated first. All queues have a
+     * priority of 0 by default, queues with the same priority are updated in
+     * no particular order.
+     *
+     * @tparam Event Type of event for which to set the priority.
+     * @param value Priority of the queue.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Event>
+    void prioritize(const int value, const id_type id = type_hash<Event>::value()) {
+        assure<Event>(id).priority = value;
+        prioritized = true;
+    }
+
+    /**
+     * @brief Returns the priority of a queue.
+     * @tparam Event Type of event for which to return the priority.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return The priority of the queue.
+     */
+    template<typename Event>
+    [[nodiscard]] int priority(const id_type id = type_hash<Event>::value()) const ENTT_NOEXCEPT {
+        const auto *cpool = assure<Event>(id);
+        return cpool ? cpool->priority : 0;
+    }
+
     /**
      * @brief Delivers all the pending events of a given queue.
      * @tparam Event Type of event to send.
@@ -371,18 +969,286 @@ public:
      */
     template<typename Event>
     void update(const id_type id = type_hash<Event>::value()) {
-        assure<Event>(id).publish();
+        assure<Event>(id).publish((std::numeric_limits<size_type>::max)());
     }
 
     /*! @brief Delivers all the pending events. */
     void update() const {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->publish();
+        ENTT_PROFILE_SCOPE(type_id<basic_dispatcher>().name());
+        if(Concurrent || prioritized) {
+            for(auto *cpool: handlers()) {
+                cpool->publish((std::numeric_limits<size_type>::max)());
+            }
+        } else {
+            for(auto &&cpool: pools.first()) {
+                cpool.second->publish((std::numeric_limits<size_type>::max)());
+            }
         }
     }
 
+    /**
+     * @brief Delivers at most the given number of pending events, in order of
+     * priority of their queues.
+     *
+     * Events that aren't delivered stay in their queues and are the first to
+     * be delivered on the next update.
+     *
+     * @param count Maximum number of events to deliver.
+     * @return The number of events actually delivered.
+     */
+    size_type update(const size_type count) const {
+        size_type length{};
+
+        for(auto *cpool: handlers()) {
+            length += cpool->publish(count - length);
+        }
+
+        return length;
+    }
+
+    /**
+     * @brief Delivers pending events in order of priority of their queues
+     * until the given deadline.
+     *
+     * Events that aren't delivered stay in their queues and are the first to
+     * be delivered on the next update. At least one event is delivered, if
+     * any.
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the deadline.
+     * @param deadline Point in time after which no more events are delivered.
+     * @return The number of events actually delivered.
+     */
+    template<typename Clock, typename Duration>
+    size_type update(const std::chrono::time_point<Clock, Duration> &deadline) const {
+        size_type length{};
+
+        for(auto *cpool: handlers()) {
+            for(size_type last{}; (length == 0u || Clock::now() < deadline) && (last = cpool->publish(1u)); length += last) {}
+        }
+
+        return length;
+    }
+
 private:
     compressed_pair<container_type, allocator_type> pools;
+    bool prioritized{};
+    event_trace *recorder{};
+    mutable std::conditional_t<Concurrent, std::shared_mutex, internal::dispatcher_no_mutex> mutex{};
+};
+
+/**
+ * @brief Dispatcher for a set of event types known at compile-time.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a type list.
+ */
+template<typename, typename, bool>
+class basic_static_dispatcher;
+
+/**
+ * @brief Dispatcher for a set of event types known at compile-time.
+ *
+ * Same as `basic_dispatcher`, except for the fact that queues are created
+ * upfront and stored by value, one per event type. Queues are therefore found
+ * at compile-time rather than through a lookup and there are no virtual calls
+ * in between. On the other side, only the given event types are accepted and
+ * named queues aren't available.
+ *
+ * @tparam Event Types of events managed by the dispatcher.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Concurrent True to make enqueuing events thread-safe.
+ */
+template<typename... Event, typename Allocator, bool Concurrent>
+class basic_static_dispatcher<type_list<Event...>, Allocator, Concurrent> {
+    static_assert(std::is_same_v<type_list<Event...>, type_list_unique_t<type_list<Event...>>>, "Duplicate event types");
+
+    template<typename Type>
+    using handler_type = internal::dispatcher_handler<Type, Allocator, Concurrent>;
+
+    template<typename Type>
+    [[nodiscard]] handler_type<Type> &assure() ENTT_NOEXCEPT {
+        static_assert(type_list_contains_v<type_list<Event...>, Type>, "Unknown event type");
+        return std::get<handler_type<Type>>(pools.first());
+    }
+
+    template<typename Type>
+    [[nodiscard]] const handler_type<Type> &assure() const ENTT_NOEXCEPT {
+        static_assert(type_list_contains_v<type_list<Event...>, Type>, "Unknown event type");
+        return std::get<handler_type<Type>>(pools.first());
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_static_dispatcher()
+        : basic_static_dispatcher{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a dispatcher with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_static_dispatcher(const allocator_type &allocator)
+        : pools{std::piecewise_construct, std::forward_as_tuple(static_cast<std::conditional_t<true, const allocator_type &, Event>>(allocator)...), std::forward_as_tuple(allocator)} {}
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return pools.second();
+    }
+
+    /**
+     * @brief Returns the number of pending events for a given type.
+     * @tparam Type Type of event for which to return the count.
+     * @return The number of pending events for the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return assure<Type>().size();
+    }
+
+    /**
+     * @brief Returns the total number of pending events.
+     * @return The total number of pending events.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return (assure<Event>().size() + ... + size_type{});
+    }
+
+    /**
+     * @brief Returns the number of events a queue has currently allocated
+     * space for.
+     * @tparam Type Type of event for which to return the capacity.
+     * @return Capacity of the queue for the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return assure<Type>().capacity();
+    }
+
+    /**
+     * @copybrief basic_dispatcher::reserve
+     * @tparam Type Type of event for which to reserve space.
+     * @param cap Desired capacity.
+     * @param policy Policy to use when the queue is full.
+     */
+    template<typename Type>
+    void reserve(const size_type cap, const overflow_policy policy = overflow_policy::grow) {
+        assure<Type>().reserve(cap, policy);
+    }
+
+    /**
+     * @brief Returns a sink object for the given event.
+     * @sa basic_dispatcher::sink
+     * @tparam Type Type of event of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto sink() ENTT_NOEXCEPT {
+        return assure<Type>().bucket();
+    }
+
+    /**
+     * @brief Returns an awaitable for the next event of a given type.
+     * @sa basic_dispatcher::next
+     * @tparam Type Type of event to wait for.
+     * @return An awaitable that returns a copy of the event.
+     */
+    template<typename Type>
+    [[nodiscard]] event_awaiter<Type> next() ENTT_NOEXCEPT {
+        return assure<Type>().next();
+    }
+
+    /**
+     * @brief Triggers an immediate event of a given type.
+     * @tparam Type Type of event to trigger.
+     * @param event An instance of the given type of event.
+     */
+    template<typename Type>
+    void trigger(Type &&event = {}) {
+        assure<std::decay_t<Type>>().trigger(std::forward<Type>(event));
+    }
+
+    /**
+     * @brief Enqueues an event of the given type.
+     * @tparam Type Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Arguments to use to construct the event.
+     */
+    template<typename Type, typename... Args>
+    void enqueue(Args &&...args) {
+        assure<Type>().enqueue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Enqueues an event of the given type.
+     * @tparam Type Type of event to enqueue.
+     * @param event An instance of the given type of event.
+     */
+    template<typename Type>
+    void enqueue(Type &&event) {
+        assure<std::decay_t<Type>>().enqueue(std::forward<Type>(event));
+    }
+
+    /**
+     * @brief Utility function to disconnect everything related to a given value
+     * or instance from a dispatcher.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type &value_or_instance) {
+        disconnect(&value_or_instance);
+    }
+
+    /**
+     * @brief Utility function to disconnect everything related to a given value
+     * or instance from a dispatcher.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type *value_or_instance) {
+        (assure<Event>().disconnect(value_or_instance), ...);
+    }
+
+    /**
+     * @brief Discards all the events stored so far in a given queue.
+     * @tparam Type Type of event to discard.
+     */
+    template<typename Type>
+    void clear() ENTT_NOEXCEPT {
+        assure<Type>().clear();
+    }
+
+    /*! @brief Discards all the events queued so far. */
+    void clear() ENTT_NOEXCEPT {
+        (assure<Event>().clear(), ...);
+    }
+
+    /**
+     * @brief Delivers all the pending events of a given queue.
+     * @tparam Type Type of event to send.
+     */
+    template<typename Type>
+    void update() {
+        assure<Type>().publish((std::numeric_limits<size_type>::max)());
+    }
+
+    /*! @brief Delivers all the pending events. */
+    void update() {
+        ENTT_PROFILE_SCOPE(type_id<basic_static_dispatcher>().name());
+        (assure<Event>().publish((std::numeric_limits<size_type>::max)()), ...);
+    }
+
+private:
+    compressed_pair<std::tuple<handler_type<Event>...>, allocator_type> pools;
 };
 
 } // namespace entt
@@ -2,141 +2,291 @@
 #define ENTT_SIGNAL_EMITTER_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
-#include <iterator>
-#include <list>
+#include <limits>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
+#include "event_awaiter.hpp"
 #include "fwd.hpp"
+#include "inline_delegate.hpp"
 
 namespace entt {
 
 /**
- * @brief General purpose event emitter.
- *
- * The emitter class template follows the CRTP idiom. To create a custom emitter
- * type, derived classes must inherit directly from the base class as:
- *
- * @code{.cpp}
- * struct my_emitter: emitter<my_emitter> {
- *     // ...
- * }
- * @endcode
- *
- * Pools for the type of events are created internally on the fly. It's not
- * required to specify in advance the full list of accepted types.<br/>
- * Moreover, whenever an event is published, an emitter provides the listeners
- * with a reference to itself along with a reference to the event. Therefore
- * listeners have an handy way to work with it without incurring in the need of
- * capturing a reference to the emitter.
- *
- * @tparam Derived Actual type of emitter that extends the class template.
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
  */
-template<typename Derived>
-class emitter {
-    struct basic_pool {
-        virtual ~basic_pool() = default;
-        virtual bool empty() const ENTT_NOEXCEPT = 0;
-        virtual void clear() ENTT_NOEXCEPT = 0;
+
+namespace internal {
+
+struct basic_emitter_pool {
+    virtual ~basic_emitter_pool() = default;
+    virtual bool empty() const ENTT_NOEXCEPT = 0;
+    virtual void clear() ENTT_NOEXCEPT = 0;
+    virtual void update(void *) = 0;
+    virtual std::size_t size() const ENTT_NOEXCEPT = 0;
+};
+
+template<typename Derived, typename Event, typename Allocator>
+class emitter_pool final: public basic_emitter_pool {
+    static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
+
+    static constexpr auto null = (std::numeric_limits<std::size_t>::max)();
+
+public:
+    using listener_type = inline_delegate<void(Event &, Derived &)>;
+
+    struct connection_type {
+        std::size_t slot{null};
+        std::size_t version{};
     };
 
-    template<typename Event>
-    struct pool_handler final: basic_pool {
-        static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
+private:
+    struct element_type {
+        listener_type listener;
+        std::size_t slot;
+        bool once;
+        bool alive;
+    };
+
+    // index of the listener when in use, next free slot otherwise
+    struct slot_type {
+        std::size_t index;
+        std::size_t version;
+    };
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using element_container = std::vector<element_type, typename alloc_traits::template rebind_alloc<element_type>>;
+    using slot_container = std::vector<slot_type, typename alloc_traits::template rebind_alloc<slot_type>>;
+    using event_container = std::vector<Event, typename alloc_traits::template rebind_alloc<Event>>;
+
+    [[nodiscard]] element_type &element(const std::size_t pos) ENTT_NOEXCEPT {
+        return pos < listeners.size() ? listeners[pos] : pending[pos - listeners.size()];
+    }
 
-        using listener_type = std::function<void(Event &, Derived &)>;
-        using element_type = std::pair<bool, listener_type>;
-        using container_type = std::list<element_type>;
-        using connection_type = typename container_type::iterator;
+    void release(element_type &elem) ENTT_NOEXCEPT {
+        auto &curr = slots[elem.slot];
+        curr.index = std::exchange(available, elem.slot);
+        ++curr.version;
+        elem.alive = false;
+        --live;
+    }
 
-        [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
-            auto pred = [](auto &&element) { return element.first; };
+    void remove(const std::size_t pos) {
+        // elements past the given position are all alive
+        if(const auto last = listeners.size() - 1u; pos != last) {
+            listeners[pos] = std::move(listeners[last]);
+            slots[listeners[pos].slot].index = pos;
+        }
+
+        listeners.pop_back();
+    }
 
-            return std::all_of(once_list.cbegin(), once_list.cend(), pred)
-                   && std::all_of(on_list.cbegin(), on_list.cend(), pred);
+    void compact() {
+        // listeners connected while publishing don't invalidate those being invoked
+        for(auto &&elem: pending) {
+            listeners.push_back(std::move(elem));
         }
 
-        void clear() ENTT_NOEXCEPT override {
-            if(publishing) {
-                for(auto &&element: once_list) {
-                    element.first = true;
-                }
-
-                for(auto &&element: on_list) {
-                    element.first = true;
-                }
-            } else {
-                once_list.clear();
-                on_list.clear();
+        pending.clear();
+
+        for(auto pos = listeners.size(); pos; --pos) {
+            if(!listeners[pos - 1u].alive) {
+                remove(pos - 1u);
             }
         }
+    }
+
+public:
+    emitter_pool(const Allocator &allocator)
+        : listeners{allocator},
+          pending{allocator},
+          slots{allocator},
+          queued{allocator},
+          spare{allocator},
+          waiters{} {}
+
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
+        return !live;
+    }
+
+    void clear() ENTT_NOEXCEPT override {
+        for(auto &&elem: listeners) {
+            elem.alive ? release(elem) : void();
+        }
 
-        connection_type once(listener_type listener) {
-            return once_list.emplace(once_list.cend(), false, std::move(listener));
+        for(auto &&elem: pending) {
+            elem.alive ? release(elem) : void();
         }
 
-        connection_type on(listener_type listener) {
-            return on_list.emplace(on_list.cend(), false, std::move(listener));
+        if(!publishing) {
+            listeners.clear();
+            pending.clear();
         }
+    }
 
-        void erase(connection_type conn) {
-            conn->first = true;
+    connection_type connect(listener_type listener, const bool once) {
+        const bool reuse = (available != null);
+        const auto slot = reuse ? available : slots.size();
+        const auto pos = listeners.size() + pending.size();
 
-            if(!publishing) {
-                auto pred = [](auto &&element) { return element.first; };
-                once_list.remove_if(pred);
-                on_list.remove_if(pred);
-            }
+        if(!reuse) {
+            slots.push_back(slot_type{null, {}});
         }
 
-        void publish(Event &event, Derived &ref) {
-            container_type swap_list;
-            once_list.swap(swap_list);
+        (publishing ? pending : listeners).push_back(element_type{std::move(listener), slot, once, true});
+        available = reuse ? slots[slot].index : available;
+        slots[slot].index = pos;
+        ++live;
+
+        return {slot, slots[slot].version};
+    }
 
-            publishing = true;
+    void erase(const connection_type conn) {
+        if(conn.slot < slots.size() && slots[conn.slot].version == conn.version) {
+            const auto pos = slots[conn.slot].index;
+            release(element(pos));
 
-            for(auto &&element: on_list) {
-                element.first ? void() : element.second(event, ref);
+            if(!publishing) {
+                remove(pos);
             }
+        }
+    }
+
+    void publish(Event &event, Derived &ref) {
+        ++publishing;
 
-            for(auto &&element: swap_list) {
-                element.first ? void() : element.second(event, ref);
+        // listeners don't move until the outermost publish returns
+        for(std::size_t pos{}, last = listeners.size(); pos < last; ++pos) {
+            if(auto &elem = listeners[pos]; elem.alive) {
+                elem.once ? release(elem) : void();
+                elem.listener(event, ref);
             }
+        }
 
-            publishing = false;
+        if(--publishing == 0u) {
+            compact();
+        }
+
+        waiters.publish(event);
+    }
+
+    [[nodiscard]] event_awaiter<Event> next() ENTT_NOEXCEPT {
+        return event_awaiter<Event>{waiters};
+    }
 
-            on_list.remove_if([](auto &&element) { return element.first; });
+    template<typename... Args>
+    void enqueue(Args &&...args) {
+        queued.push_back(Event{std::forward<Args>(args)...});
+    }
+
+    void update(void *ref) override {
+        // the buffer of the previous update is reused, nested updates only cost an allocation
+        auto events = std::move(spare);
+        events.clear();
+        events.swap(queued);
+
+        for(auto &&event: events) {
+            publish(event, *static_cast<Derived *>(ref));
         }
 
-    private:
-        bool publishing{false};
-        container_type once_list{};
-        container_type on_list{};
-    };
+        events.clear();
+        spare = std::move(events);
+    }
+
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT override {
+        return queued.size();
+    }
+
+private:
+    element_container listeners;
+    element_container pending;
+    slot_container slots;
+    event_container queued;
+    event_container spare;
+    event_waiter<Event> waiters;
+    std::size_t available{null};
+    std::size_t live{};
+    std::size_t publishing{};
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief General purpose event emitter.
+ *
+ * The emitter class template follows the CRTP idiom. To create a custom emitter
+ * type, derived classes must inherit directly from the base class as:
+ *
+ * @code{.cpp}
+ * struct my_emitter: emitter<my_emitter> {
+ *     // ...
+ * }
+ * @endcode
+ *
+ * Pools for the type of events are created internally on the fly. It's not
+ * required to specify in advance the full list of accepted types.<br/>
+ * Moreover, whenever an event is published, an emitter provides the listeners
+ * with a reference to itself along with a reference to the event. Therefore
+ * listeners have an handy way to work with it without incurring in the need of
+ * capturing a reference to the emitter.
+ *
+ * Listeners are stored contiguously and connections are handles to stable
+ * slots. Therefore, connecting and disconnecting listeners is done in constant
+ * time and without allocations in the average case.
+ *
+ * @tparam Derived Actual type of emitter that extends the class template.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Derived, typename Allocator>
+class emitter {
+    using basic_pool = internal::basic_emitter_pool;
+
+    template<typename Event>
+    using pool_handler = internal::emitter_pool<Derived, Event, Allocator>;
 
     template<typename Event>
     [[nodiscard]] pool_handler<Event> *assure() {
-        if(auto &&ptr = pools[type_hash<Event>::value()]; !ptr) {
-            auto *cpool = new pool_handler<Event>{};
-            ptr.reset(cpool);
-            return cpool;
-        } else {
-            return static_cast<pool_handler<Event> *>(ptr.get());
+        auto &&ptr = pools.first()[type_hash<Event>::value()];
+
+        if(!ptr) {
+            const auto &allocator = pools.second();
+            ptr = std::allocate_shared<pool_handler<Event>>(allocator, allocator);
         }
+
+        return static_cast<pool_handler<Event> *>(ptr.get());
     }
 
     template<typename Event>
     [[nodiscard]] const pool_handler<Event> *assure() const {
-        const auto it = pools.find(type_hash<Event>::value());
-        return (it == pools.cend()) ? nullptr : static_cast<const pool_handler<Event> *>(it->second.get());
+        const auto it = pools.first().find(type_hash<Event>::value());
+        return (it == pools.first().cend()) ? nullptr : static_cast<const pool_handler<Event> *>(it->second.get());
     }
 
+    using key_type = id_type;
+    // std::shared_ptr because of its type erased allocator which is pretty useful here
+    using mapped_type = std::shared_ptr<basic_pool>;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const key_type, mapped_type>>;
+    using container_type = dense_map<key_type, mapped_type, identity, std::equal_to<key_type>, container_allocator>;
+
 public:
     /** @brief Type of listeners accepted for the given event. */
     template<typename Event>
@@ -167,20 +317,48 @@ public:
             : pool_handler<Event>::connection_type{std::move(conn)} {}
     };
 
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
     /*! @brief Default constructor. */
-    emitter() = default;
+    emitter()
+        : emitter{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an emitter with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit emitter(const allocator_type &allocator)
+        : pools{allocator, allocator} {}
 
     /*! @brief Default destructor. */
     virtual ~emitter() ENTT_NOEXCEPT {
-        static_assert(std::is_base_of_v<emitter<Derived>, Derived>, "Incorrect use of the class template");
+        static_assert(std::is_base_of_v<emitter<Derived, Allocator>, Derived>, "Incorrect use of the class template");
     }
 
+    /*! @brief Default copy constructor, deleted on purpose. */
+    emitter(const emitter &) = delete;
+
     /*! @brief Default move constructor. */
     emitter(emitter &&) = default;
 
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This emitter.
+     */
+    emitter &operator=(const emitter &) = delete;
+
     /*! @brief Default move assignment operator. @return This emitter. */
     emitter &operator=(emitter &&) = default;
 
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return pools.second();
+    }
+
     /**
      * @brief Emits the given event.
      *
@@ -198,6 +376,54 @@ public:
         assure<Event>()->publish(instance, *static_cast<Derived *>(this));
     }
 
+    /**
+     * @brief Enqueues an event of the given type.
+     *
+     * Events are stored aside until the next call to `update` and then
+     * delivered in order of arrival. The event type must either have a proper
+     * constructor for the arguments provided or be an aggregate type.
+     *
+     * @tparam Event Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Parameters to use to initialize the event.
+     */
+    template<typename Event, typename... Args>
+    void enqueue(Args &&...args) {
+        assure<Event>()->enqueue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Delivers all the pending events of the given type.
+     *
+     * Events enqueued by listeners in the meantime are delivered on the next
+     * update.
+     *
+     * @tparam Event Type of events to deliver.
+     */
+    template<typename Event>
+    void update() {
+        assure<Event>()->update(static_cast<Derived *>(this));
+    }
+
+    /*! @brief Delivers all the pending events. */
+    void update() {
+        // listeners can enqueue events of new types, pools are only appended to the map
+        for(std::size_t pos{}, last = pools.first().size(); pos < last; ++pos) {
+            (pools.first().begin() + static_cast<std::ptrdiff_t>(pos))->second->update(static_cast<Derived *>(this));
+        }
+    }
+
+    /**
+     * @brief Returns the number of pending events of the given type.
+     * @tparam Event Type of events for which to return the count.
+     * @return The number of pending events of the given type.
+     */
+    template<typename Event>
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        const auto *cpool = assure<Event>();
+        return cpool ? cpool->size() : 0u;
+    }
+
     /**
      * @brief Registers a long-lived listener with the event emitter.
      *
@@ -220,7 +446,7 @@ public:
      */
     template<typename Event>
     connection<Event> on(listener<Event> instance) {
-        return assure<Event>()->on(std::move(instance));
+        return assure<Event>()->connect(std::move(instance), false);
     }
 
     /**
@@ -245,14 +471,31 @@ public:
      */
     template<typename Event>
     connection<Event> once(listener<Event> instance) {
-        return assure<Event>()->once(std::move(instance));
+        return assure<Event>()->connect(std::move(instance), true);
+    }
+
+    /**
+     * @brief Returns an awaitable for the next event of a given type.
+     *
+     * A coroutine that awaits the returned object is resumed inline as soon
+     * as the next event of the given type is published, after the listeners.
+     * No listener is registered for this purpose.
+     *
+     * @sa event_awaiter
+     *
+     * @tparam Event Type of event to wait for.
+     * @return An awaitable that returns a copy of the event.
+     */
+    template<typename Event>
+    [[nodiscard]] event_awaiter<Event> next() {
+        return assure<Event>()->next();
     }
 
     /**
      * @brief Disconnects a listener from the event emitter.
      *
-     * Do not use twice the same connection to disconnect a listener, it results
-     * in undefined behavior. Once used, discard the connection object.
+     * Connections of listeners already disconnected are ignored. The same
+     * applies to default constructed connections.
      *
      * @tparam Event Type of event of the connection.
      * @param conn A valid connection.
@@ -266,7 +509,7 @@ public:
      * @brief Disconnects all the listeners for the given event type.
      *
      * All the connections previously returned for the given event are
-     * invalidated. Using them results in undefined behavior.
+     * invalidated.
      *
      * @tparam Event Type of event to reset.
      */
@@ -278,11 +521,10 @@ public:
     /**
      * @brief Disconnects all the listeners.
      *
-     * All the connections previously returned are invalidated. Using them
-     * results in undefined behavior.
+     * All the connections previously returned are invalidated.
      */
     void clear() ENTT_NOEXCEPT {
-        for(auto &&cpool: pools) {
+        for(auto &&cpool: pools.first()) {
             cpool.second->clear();
         }
     }
@@ -303,13 +545,252 @@ public:
      * @return True if there are no listeners registered, false otherwise.
      */
     [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
-        return std::all_of(pools.cbegin(), pools.cend(), [](auto &&cpool) {
+        return std::all_of(pools.first().cbegin(), pools.first().cend(), [](auto &&cpool) {
             return cpool.second->empty();
         });
     }
 
 private:
-    dense_map<id_type, std::unique_ptr<basic_pool>, identity> pools{};
+    compressed_pair<container_type, allocator_type> pools;
+};
+
+/**
+ * @brief Event emitter for a set of event types known at compile-time.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a type list.
+ */
+template<typename, typename, typename>
+class static_emitter;
+
+/**
+ * @brief Event emitter for a set of event types known at compile-time.
+ *
+ * Same as `emitter`, except for the fact that pools are created upfront and
+ * stored by value, one per event type. Pools are therefore found at
+ * compile-time rather than through a lookup. On the other side, only the given
+ * event types are accepted:
+ *
+ * @code{.cpp}
+ * struct my_emitter: static_emitter<my_emitter, type_list<my_event>> {
+ *     // ...
+ * }
+ * @endcode
+ *
+ * @tparam Derived Actual type of emitter that extends the class template.
+ * @tparam Event Types of events managed by the emitter.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Derived, typename... Event, typename Allocator>
+class static_emitter<Derived, type_list<Event...>, Allocator> {
+    static_assert(std::is_same_v<type_list<Event...>, type_list_unique_t<type_list<Event...>>>, "Duplicate event types");
+
+    template<typename Type>
+    using pool_handler = internal::emitter_pool<Derived, Type, Allocator>;
+
+    template<typename Type>
+    [[nodiscard]] pool_handler<Type> &assure() ENTT_NOEXCEPT {
+        static_assert(type_list_contains_v<type_list<Event...>, Type>, "Unknown event type");
+        return std::get<pool_handler<Type>>(pools.first());
+    }
+
+    template<typename Type>
+    [[nodiscard]] const pool_handler<Type> &assure() const ENTT_NOEXCEPT {
+        static_assert(type_list_contains_v<type_list<Event...>, Type>, "Unknown event type");
+        return std::get<pool_handler<Type>>(pools.first());
+    }
+
+public:
+    /** @brief Type of listeners accepted for the given event. */
+    template<typename Type>
+    using listener = typename pool_handler<Type>::listener_type;
+
+    /**
+     * @brief Generic connection type for events.
+     * @tparam Type Type of event for which the connection is created.
+     */
+    template<typename Type>
+    struct connection: private pool_handler<Type>::connection_type {
+        /** @brief Event emitters are friend classes of connections. */
+        friend class static_emitter;
+
+        /*! @brief Default constructor. */
+        connection() ENTT_NOEXCEPT = default;
+
+        /**
+         * @brief Creates a connection that wraps its underlying instance.
+         * @param conn A connection object to wrap.
+         */
+        connection(typename pool_handler<Type>::connection_type conn)
+            : pool_handler<Type>::connection_type{std::move(conn)} {}
+    };
+
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+    /*! @brief Default constructor. */
+    static_emitter()
+        : static_emitter{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an emitter with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit static_emitter(const allocator_type &allocator)
+        : pools{std::piecewise_construct, std::forward_as_tuple(static_cast<std::conditional_t<true, const allocator_type &, Event>>(allocator)...), std::forward_as_tuple(allocator)} {}
+
+    /*! @brief Default destructor. */
+    virtual ~static_emitter() ENTT_NOEXCEPT {
+        static_assert(std::is_base_of_v<static_emitter<Derived, type_list<Event...>, Allocator>, Derived>, "Incorrect use of the class template");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    static_emitter(const static_emitter &) = delete;
+
+    /*! @brief Default move constructor. */
+    static_emitter(static_emitter &&) = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This emitter.
+     */
+    static_emitter &operator=(const static_emitter &) = delete;
+
+    /*! @brief Default move assignment operator. @return This emitter. */
+    static_emitter &operator=(static_emitter &&) = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return pools.second();
+    }
+
+    /**
+     * @copybrief emitter::publish
+     * @tparam Type Type of event to publish.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Parameters to use to initialize the event.
+     */
+    template<typename Type, typename... Args>
+    void publish(Args &&...args) {
+        Type instance{std::forward<Args>(args)...};
+        assure<Type>().publish(instance, *static_cast<Derived *>(this));
+    }
+
+    /**
+     * @copybrief emitter::enqueue
+     * @tparam Type Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Parameters to use to initialize the event.
+     */
+    template<typename Type, typename... Args>
+    void enqueue(Args &&...args) {
+        assure<Type>().enqueue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Delivers all the pending events of the given type.
+     * @tparam Type Type of events to deliver.
+     */
+    template<typename Type>
+    void update() {
+        assure<Type>().update(static_cast<Derived *>(this));
+    }
+
+    /*! @brief Delivers all the pending events. */
+    void update() {
+        (assure<Event>().update(static_cast<Derived *>(this)), ...);
+    }
+
+    /**
+     * @copybrief emitter::size
+     * @tparam Type Type of events for which to return the count.
+     * @return The number of pending events of the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return assure<Type>().size();
+    }
+
+    /**
+     * @copybrief emitter::on
+     * @tparam Type Type of event to which to connect the listener.
+     * @param instance The listener to register.
+     * @return Connection object that can be used to disconnect the listener.
+     */
+    template<typename Type>
+    connection<Type> on(listener<Type> instance) {
+        return assure<Type>().connect(std::move(instance), false);
+    }
+
+    /**
+     * @copybrief emitter::once
+     * @tparam Type Type of event to which to connect the listener.
+     * @param instance The listener to register.
+     * @return Connection object that can be used to disconnect the listener.
+     */
+    template<typename Type>
+    connection<Type> once(listener<Type> instance) {
+        return assure<Type>().connect(std::move(instance), true);
+    }
+
+    /**
+     * @brief Returns an awaitable for the next event of a given type.
+     * @sa emitter::next
+     * @tparam Type Type of event to wait for.
+     * @return An awaitable that returns a copy of the event.
+     */
+    template<typename Type>
+    [[nodiscard]] event_awaiter<Type> next() ENTT_NOEXCEPT {
+        return assure<Type>().next();
+    }
+
+    /**
+     * @copybrief emitter::erase
+     * @tparam Type Type of event of the connection.
+     * @param conn A valid connection.
+     */
+    template<typename Type>
+    void erase(connection<Type> conn) {
+        assure<Type>().erase(std::move(conn));
+    }
+
+    /**
+     * @brief Disconnects all the listeners for the given event type.
+     * @tparam Type Type of event to reset.
+     */
+    template<typename Type>
+    void clear() ENTT_NOEXCEPT {
+        assure<Type>().clear();
+    }
+
+    /*! @brief Disconnects all the listeners. */
+    void clear() ENTT_NOEXCEPT {
+        (assure<Event>().clear(), ...);
+    }
+
+    /**
+     * @brief Checks if there are listeners registered for the specific event.
+     * @tparam Type Type of event to test.
+     * @return True if there are no listeners registered, false otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return assure<Type>().empty();
+    }
+
+    /**
+     * @brief Checks if there are listeners registered with the event emitter.
+     * @return True if there are no listeners registered, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (assure<Event>().empty() && ...);
+    }
+
+private:
+    compressed_pair<std::tuple<pool_handler<Event>...>, allocator_type> pools;
 };
 
 } // namespace entt
@@ -0,0 +1,220 @@
+#ifndef ENTT_SIGNAL_EVENT_AWAITER_HPP
+#define ENTT_SIGNAL_EVENT_AWAITER_HPP
+
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Event>
+struct event_waiter {
+    using notify_fn_type = void(event_waiter &, Event &);
+
+    event_waiter() ENTT_NOEXCEPT
+        : prev{this},
+          next{this},
+          notify{} {}
+
+    event_waiter(const event_waiter &) = delete;
+
+    // a moved waiter takes the place of the other one within its list, if any
+    event_waiter(event_waiter &&other) ENTT_NOEXCEPT
+        : event_waiter{} {
+        take(other);
+    }
+
+    ~event_waiter() {
+        unlink();
+    }
+
+    event_waiter &operator=(const event_waiter &) = delete;
+
+    event_waiter &operator=(event_waiter &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            unlink();
+            take(other);
+        }
+
+        return *this;
+    }
+
+    void link(event_waiter &elem) ENTT_NOEXCEPT {
+        // waiters are appended and notified in order of arrival
+        elem.prev = prev;
+        elem.next = this;
+        prev->next = &elem;
+        prev = &elem;
+    }
+
+    void unlink() ENTT_NOEXCEPT {
+        prev->next = next;
+        next->prev = prev;
+        prev = next = this;
+    }
+
+    [[nodiscard]] bool linked() const ENTT_NOEXCEPT {
+        return next != this;
+    }
+
+    void publish(Event &event) {
+        if(linked()) {
+            // waiters registered while notifying others wait for the next event
+            event_waiter batch{};
+            batch.take(*this);
+
+            while(batch.linked()) {
+                auto &curr = *batch.next;
+                curr.unlink();
+                curr.notify(curr, event);
+            }
+        }
+    }
+
+    event_waiter *prev;
+    event_waiter *next;
+    notify_fn_type *notify;
+
+private:
+    void take(event_waiter &other) ENTT_NOEXCEPT {
+        notify = other.notify;
+
+        if(other.linked()) {
+            prev = std::exchange(other.prev, &other);
+            next = std::exchange(other.next, &other);
+            prev->next = next->prev = this;
+        }
+    }
+};
+
+template<typename, typename = void>
+struct awaitable_promise_ready: std::false_type {};
+
+template<typename Handle>
+struct awaitable_promise_ready<Handle, std::void_t<decltype(std::declval<Handle &>().promise().ready)>>
+    : std::true_type {};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Awaitable that suspends a coroutine until the next event of a type.
+ *
+ * The awaitable doesn't connect a listener to the signal it waits on. Instead,
+ * it links itself to an intrusive list of waiters and the suspended coroutine
+ * is resumed inline as soon as the event is published, after the listeners.
+ * Therefore, waiting for an event never requires an allocation.<br/>
+ * The awaitable returns a copy of the event received.
+ *
+ * Any coroutine type is supported, since the handle of the suspended coroutine
+ * is erased and resumed directly. Coroutines whose promise offers a `ready`
+ * delegate, such as coroutine processes, are also kept from being resumed by
+ * others while waiting. The awaitable unlinks itself when destroyed, so that
+ * destroying a suspended coroutine is safe at any time.
+ *
+ * @warning
+ * Awaiting an event after the object that publishes it has been destroyed
+ * results in undefined behavior.
+ *
+ * @tparam Event Type of event to wait for.
+ */
+template<typename Event>
+class event_awaiter: private internal::event_waiter<Event> {
+    using waiter_type = internal::event_waiter<Event>;
+
+public:
+    /**
+     * @brief Constructs an awaitable for a given list of waiters.
+     * @param ref A valid reference to a list of waiters.
+     */
+    explicit event_awaiter(waiter_type &ref) ENTT_NOEXCEPT
+        : waiter_type{},
+          list{&ref},
+          frame{},
+          received{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    event_awaiter(const event_awaiter &) = delete;
+
+    /*! @brief Default move constructor. */
+    event_awaiter(event_awaiter &&) = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This awaitable.
+     */
+    event_awaiter &operator=(const event_awaiter &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This awaitable.
+     */
+    event_awaiter &operator=(event_awaiter &&) = delete;
+
+    /**
+     * @brief A coroutine is always suspended.
+     * @return False.
+     */
+    [[nodiscard]] bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /**
+     * @brief Links the suspended coroutine to the list of waiters.
+     * @tparam Handle Type of coroutine handle.
+     * @param curr A valid coroutine handle.
+     */
+    template<typename Handle>
+    void await_suspend(Handle curr) ENTT_NOEXCEPT {
+        frame = curr.address();
+
+        this->notify = [](waiter_type &elem, Event &event) {
+            auto &self = static_cast<event_awaiter &>(elem);
+            auto coro = Handle::from_address(self.frame);
+            self.received = &event;
+
+            if constexpr(internal::awaitable_promise_ready<Handle>::value) {
+                coro.promise().ready.reset();
+            }
+
+            coro.resume();
+        };
+
+        if constexpr(internal::awaitable_promise_ready<Handle>::value) {
+            // the coroutine is resumed inline by the event, never when polled
+            curr.promise().ready.connect([](const void *, auto...) { return false; });
+        }
+
+        list->link(*this);
+    }
+
+    /**
+     * @brief Returns the event received.
+     * @return A copy of the event received.
+     */
+    [[nodiscard]] Event await_resume() const {
+        ENTT_ASSERT(received, "No event received");
+        return *received;
+    }
+
+private:
+    waiter_type *list;
+    void *frame;
+    Event *received;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef ENTT_SIGNAL_EVENT_TRACE_HPP
+#define ENTT_SIGNAL_EVENT_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @brief Ways in which an event is handed to a dispatcher. */
+enum class dispatch_kind : std::uint8_t {
+    /*! @brief The event was triggered. */
+    trigger = 0u,
+    /*! @brief The event was enqueued. */
+    enqueue = 1u
+};
+
+/**
+ * @brief Ring buffer of events handed to a dispatcher.
+ *
+ * Each record stores the name of the queue, how the event was handed to the
+ * dispatcher and a binary copy of the event. Records have a fixed size, so
+ * that recording an event never allocates. Once the buffer is full, the oldest
+ * records are overwritten by the new ones.<br/>
+ * Only trivially copyable events fit a trace. All the others are never
+ * recorded, as are those that are larger than the payload of a record.
+ */
+class event_trace {
+    struct header_type {
+        id_type id;
+        dispatch_kind kind;
+        std::uint32_t size;
+    };
+
+    [[nodiscard]] std::byte *slot(const std::size_t pos) ENTT_NOEXCEPT {
+        return records.data() + ((head + pos) % length) * stride;
+    }
+
+    [[nodiscard]] const std::byte *slot(const std::size_t pos) const ENTT_NOEXCEPT {
+        return records.data() + ((head + pos) % length) * stride;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a trace with room for a given number of records.
+     * @param cap Maximum number of records in the trace.
+     * @param payload Maximum size in bytes of the recorded events.
+     */
+    explicit event_trace(const size_type cap, const size_type payload = 64u)
+        : records(cap * (sizeof(header_type) + payload)),
+          stride{sizeof(header_type) + payload},
+          length{cap} {
+        ENTT_ASSERT(cap != 0u, "Invalid capacity");
+    }
+
+    /**
+     * @brief Records an event.
+     * @tparam Event Type of event to record.
+     * @param kind How the event was handed to the dispatcher.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @param event The event to record.
+     * @return True if the event is recorded, false otherwise.
+     */
+    template<typename Event>
+    bool record(const dispatch_kind kind, const id_type id, const Event &event) {
+        if constexpr(std::is_trivially_copyable_v<Event>) {
+            if(sizeof(Event) <= (stride - sizeof(header_type))) {
+                if(count == length) {
+                    head = (head + 1u) % length;
+                    --count;
+                }
+
+                const header_type header{id, kind, static_cast<std::uint32_t>(sizeof(Event))};
+                auto *elem = slot(count++);
+                std::memcpy(elem, &header, sizeof(header));
+                std::memcpy(elem + sizeof(header), &event, sizeof(Event));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Returns the number of records in a trace.
+     * @return Number of records in the trace.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Returns the maximum number of records in a trace.
+     * @return Maximum number of records in the trace.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+    /**
+     * @brief Checks whether a trace is empty.
+     * @return True if the trace is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (count == 0u);
+    }
+
+    /*! @brief Discards all the records of a trace. */
+    void clear() ENTT_NOEXCEPT {
+        head = count = {};
+    }
+
+    /**
+     * @brief Iterates the records of a trace from the oldest to the newest and
+     * applies the given function object to them.
+     *
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const dispatch_kind, const id_type, const void *, const size_type);
+     * @endcode
+     *
+     * The payload isn't guaranteed to be suitably aligned for the event type.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(size_type pos{}; pos < count; ++pos) {
+            header_type header{};
+            const auto *elem = slot(pos);
+            std::memcpy(&header, elem, sizeof(header));
+            func(header.kind, header.id, static_cast<const void *>(elem + sizeof(header)), static_cast<size_type>(header.size));
+        }
+    }
+
+private:
+    std::vector<std::byte> records;
+    size_type stride;
+    size_type length;
+    size_type head{};
+    size_type count{};
+};
+
+/**
+ * @brief Feeds the events of a trace back to a dispatcher.
+ *
+ * Events are rebuilt from their binary copies and either triggered or enqueued
+ * again, as they were originally. Only the events of the types bound to the
+ * replayer are fed back, so that the cost of the listeners of a given type is
+ * measured in isolation if required.
+ *
+ * @tparam Dispatcher Type of dispatcher to feed.
+ */
+template<typename Dispatcher>
+class event_replayer {
+    using function_type = void(Dispatcher &, const dispatch_kind, const id_type, const void *);
+
+    template<typename Event>
+    static void feed(Dispatcher &target, const dispatch_kind kind, const id_type id, const void *payload) {
+        Event event;
+        std::memcpy(&event, payload, sizeof(Event));
+
+        if(kind == dispatch_kind::trigger) {
+            target.trigger(id, event);
+        } else {
+            target.enqueue_hint(id, event);
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Binds an event type to a queue, so that its events are fed back.
+     * @tparam Event Type of event to bind.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return This replayer.
+     */
+    template<typename Event>
+    event_replayer &bind(const id_type id = type_hash<Event>::value()) {
+        static_assert(std::is_trivially_copyable_v<Event> && std::is_default_constructible_v<Event>, "Events must be trivially copyable and default constructible");
+        thunks.insert_or_assign(id, std::make_pair(&feed<Event>, sizeof(Event)));
+        return *this;
+    }
+
+    /**
+     * @brief Feeds the events of a trace back to a dispatcher.
+     *
+     * Enqueued events are delivered by the next update of the dispatcher, as
+     * usual.
+     *
+     * @warning
+     * Feeding a trace back to a dispatcher that is recording in the same trace
+     * results in undefined behavior.
+     *
+     * @param trace A trace of events.
+     * @param target A valid reference to a dispatcher.
+     * @return The number of events actually fed back.
+     */
+    size_type replay(const event_trace &trace, Dispatcher &target) const {
+        size_type length{};
+
+        trace.each([this, &target, &length](const dispatch_kind kind, const id_type id, const void *payload, const size_type size) {
+            if(const auto it = thunks.find(id); it != thunks.cend()) {
+                ENTT_ASSERT(it->second.second == size, "Unexpected event type");
+                it->second.first(target, kind, id, payload);
+                ++length;
+            }
+        });
+
+        return length;
+    }
+
+private:
+    dense_map<id_type, std::pair<function_type *, size_type>, identity> thunks{};
+};
+
+} // namespace entt
+
+#endif
@@ -1,19 +1,38 @@
 #ifndef ENTT_SIGNAL_FWD_HPP
 #define ENTT_SIGNAL_FWD_HPP
 
+#include <cstddef>
 #include <memory>
+#include "../core/type_traits.hpp"
 
 namespace entt {
 
 template<typename>
 class delegate;
 
-template<typename = std::allocator<char>>
-class basic_dispatcher;
+template<typename, std::size_t = 3u * sizeof(void *)>
+class inline_delegate;
+
+template<typename>
+class event_awaiter;
+
+class event_trace;
 
 template<typename>
+class event_replayer;
+
+template<typename = std::allocator<char>, bool = false>
+class basic_dispatcher;
+
+template<typename, typename = std::allocator<char>, bool = false>
+class basic_static_dispatcher;
+
+template<typename, typename = std::allocator<char>>
 class emitter;
 
+template<typename, typename, typename = std::allocator<char>>
+class static_emitter;
+
 class connection;
 
 struct scoped_connection;
@@ -21,12 +40,25 @@ struct scoped_connection;
 template<typename>
 class sink;
 
-template<typename Type, typename = std::allocator<Type *>>
+template<typename Type, typename = std::allocator<Type *>, std::size_t = 0u>
 class sigh;
 
+template<typename Type, typename = std::allocator<Type *>>
+class concurrent_sigh;
+
 /*! @brief Alias declaration for the most common use case. */
 using dispatcher = basic_dispatcher<>;
 
+/*! @brief Alias declaration for a dispatcher with thread-safe queues. */
+using concurrent_dispatcher = basic_dispatcher<std::allocator<char>, true>;
+
+/**
+ * @brief Alias declaration for a dispatcher with a fixed set of event types.
+ * @tparam Event Types of events managed by the dispatcher.
+ */
+template<typename... Event>
+using static_dispatcher = basic_static_dispatcher<type_list<Event...>>;
+
 } // namespace entt
 
 #endif
@@ -0,0 +1,269 @@
+#ifndef ENTT_SIGNAL_INLINE_DELEGATE_HPP
+#define ENTT_SIGNAL_INLINE_DELEGATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Basic owning delegate implementation.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ */
+template<typename, std::size_t>
+class inline_delegate;
+
+/**
+ * @brief Owning delegate with inline storage for small callables.
+ *
+ * Unlike delegates, an inline delegate owns the callable it wraps. Callables
+ * that fit the inline buffer and are nothrow move constructible (for example,
+ * lambdas that capture a couple of pointers or references) are stored within
+ * the delegate itself and don't require allocations. Larger callables are
+ * allocated on the heap instead.<br/>
+ * Copying an inline delegate copies the underlying callable. Non-copyable
+ * callables result in empty delegates when copied.
+ *
+ * Inline delegates have a stable invocation operator, therefore they can also
+ * be connected to signals as bound members to host the captures of listeners
+ * without allocating dedicated objects for them.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the storage reserved for callables.
+ */
+template<typename Ret, typename... Args, std::size_t Len>
+class inline_delegate<Ret(Args...), Len> {
+    enum class operation : std::uint8_t {
+        copy,
+        move,
+        destroy
+    };
+
+    using storage_type = std::aligned_storage_t<(Len < sizeof(void *)) ? sizeof(void *) : Len, alignof(std::max_align_t)>;
+    using invoke_fn_type = Ret(const inline_delegate &, Args...);
+    using manage_fn_type = void(const operation, inline_delegate &, inline_delegate &);
+
+    template<typename Type>
+    static constexpr bool in_situ = alignof(Type) <= alignof(storage_type) && sizeof(Type) <= sizeof(storage_type) && std::is_nothrow_move_constructible_v<Type>;
+
+    template<typename Type>
+    [[nodiscard]] static Type *element(const inline_delegate &value) ENTT_NOEXCEPT {
+        auto *storage = const_cast<storage_type *>(&value.storage);
+
+        if constexpr(in_situ<Type>) {
+            return std::launder(reinterpret_cast<Type *>(storage));
+        } else {
+            return *std::launder(reinterpret_cast<Type **>(storage));
+        }
+    }
+
+    template<typename Type>
+    static Ret invoke(const inline_delegate &value, Args... args) {
+        return static_cast<Ret>(std::invoke(*element<Type>(value), std::forward<Args>(args)...));
+    }
+
+    template<typename Type>
+    static void manage(const operation op, inline_delegate &value, [[maybe_unused]] inline_delegate &other) {
+        switch(op) {
+        case operation::copy:
+            if constexpr(std::is_copy_constructible_v<Type>) {
+                other.initialize<Type>(*element<Type>(value));
+            }
+            break;
+        case operation::move:
+            if constexpr(in_situ<Type>) {
+                ::new(&other.storage) Type(std::move(*element<Type>(value)));
+                element<Type>(value)->~Type();
+            } else {
+                // heap allocated callables are stolen rather than moved
+                ::new(&other.storage) Type *{element<Type>(value)};
+            }
+            other.fn = value.fn;
+            other.manager = value.manager;
+            break;
+        case operation::destroy:
+            if constexpr(in_situ<Type>) {
+                element<Type>(value)->~Type();
+            } else {
+                delete element<Type>(value);
+            }
+            break;
+        }
+    }
+
+    template<typename Type, typename... Params>
+    void initialize(Params &&...params) {
+        if constexpr(in_situ<Type>) {
+            ::new(&storage) Type(std::forward<Params>(params)...);
+        } else {
+            ::new(&storage) Type *{new Type(std::forward<Params>(params)...)};
+        }
+
+        fn = &invoke<Type>;
+        manager = &manage<Type>;
+    }
+
+    void steal(inline_delegate &other) ENTT_NOEXCEPT {
+        if(other.manager) {
+            other.manager(operation::move, other, *this);
+            other.fn = nullptr;
+            other.manager = nullptr;
+        }
+    }
+
+public:
+    /*! @brief Function type of the delegate. */
+    using type = Ret(Args...);
+    /*! @brief Return type of the delegate. */
+    using result_type = Ret;
+
+    /**
+     * @brief Checks whether a callable is stored within the delegate itself.
+     * @tparam Type Type of callable to check.
+     */
+    template<typename Type>
+    static constexpr bool is_inline_v = in_situ<std::decay_t<Type>>;
+
+    /*! @brief Default constructor. */
+    inline_delegate() ENTT_NOEXCEPT
+        : storage{},
+          fn{nullptr},
+          manager{nullptr} {}
+
+    /**
+     * @brief Constructs a delegate from a given callable.
+     * @tparam Func Type of callable to wrap.
+     * @param func A valid callable object.
+     */
+    template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, inline_delegate> && std::is_invocable_r_v<Ret, std::decay_t<Func> &, Args...>>>
+    inline_delegate(Func &&func)
+        : inline_delegate{} {
+        initialize<std::decay_t<Func>>(std::forward<Func>(func));
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    inline_delegate(const inline_delegate &other)
+        : inline_delegate{} {
+        if(other.manager) {
+            other.manager(operation::copy, const_cast<inline_delegate &>(other), *this);
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    inline_delegate(inline_delegate &&other) ENTT_NOEXCEPT
+        : inline_delegate{} {
+        steal(other);
+    }
+
+    /*! @brief Frees the internal storage, whatever it means. */
+    ~inline_delegate() {
+        reset();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This delegate.
+     */
+    inline_delegate &operator=(const inline_delegate &other) {
+        if(this != &other) {
+            reset();
+
+            if(other.manager) {
+                other.manager(operation::copy, const_cast<inline_delegate &>(other), *this);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This delegate.
+     */
+    inline_delegate &operator=(inline_delegate &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            reset();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the callable of a delegate.
+     * @tparam Func Type of callable to wrap.
+     * @param func A valid callable object.
+     * @return This delegate.
+     */
+    template<typename Func>
+    std::enable_if_t<!std::is_same_v<std::decay_t<Func>, inline_delegate> && std::is_invocable_r_v<Ret, std::decay_t<Func> &, Args...>, inline_delegate &>
+    operator=(Func &&func) {
+        reset();
+        initialize<std::decay_t<Func>>(std::forward<Func>(func));
+        return *this;
+    }
+
+    /**
+     * @brief Resets a delegate.
+     *
+     * After a reset, a delegate cannot be invoked anymore.
+     */
+    void reset() ENTT_NOEXCEPT {
+        if(manager) {
+            manager(operation::destroy, *this, *this);
+            fn = nullptr;
+            manager = nullptr;
+        }
+    }
+
+    /**
+     * @brief Triggers a delegate.
+     *
+     * The delegate invokes the underlying callable and returns the result.
+     *
+     * @warning
+     * Attempting to trigger an invalid delegate results in undefined
+     * behavior.
+     *
+     * @param args Arguments to use to invoke the underlying callable.
+     * @return The value returned by the underlying callable.
+     */
+    Ret operator()(Args... args) const {
+        ENTT_ASSERT(static_cast<bool>(*this), "Uninitialized delegate");
+        return fn(*this, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether a delegate actually stores a callable.
+     * @return False if the delegate is empty, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return !(fn == nullptr);
+    }
+
+private:
+    storage_type storage;
+    invoke_fn_type *fn;
+    manage_fn_type *manager;
+};
+
+} // namespace entt
+
+#endif
@@ -2,17 +2,213 @@
 #define ENTT_SIGNAL_SIGH_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/type_info.hpp"
 #include "delegate.hpp"
 #include "fwd.hpp"
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Type, std::size_t Len, typename Allocator>
+class inline_vector {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    static_assert(std::is_trivially_copyable_v<Type>, "Invalid value type");
+
+    [[nodiscard]] bool is_local() const ENTT_NOEXCEPT {
+        return first == local.data();
+    }
+
+    void release() {
+        if(!is_local()) {
+            alloc_traits::deallocate(allocator, first, capacity);
+            first = local.data();
+            capacity = Len;
+        }
+    }
+
+    void reserve(const std::size_t req) {
+        if(req > capacity) {
+            const auto next = (std::max)(req, capacity * 2u);
+            auto *mem = alloc_traits::allocate(allocator, next);
+            std::uninitialized_copy(first, first + length, mem);
+            release();
+            first = mem;
+            capacity = next;
+        }
+    }
+
+    void steal(inline_vector &other) ENTT_NOEXCEPT {
+        if(other.is_local()) {
+            std::copy(other.first, other.first + other.length, first);
+        } else {
+            first = std::exchange(other.first, other.local.data());
+            capacity = std::exchange(other.capacity, Len);
+        }
+
+        length = std::exchange(other.length, 0u);
+    }
+
+public:
+    using allocator_type = Allocator;
+    using value_type = Type;
+    using size_type = std::size_t;
+    using iterator = Type *;
+    using const_iterator = const Type *;
+
+    inline_vector()
+        : inline_vector{allocator_type{}} {}
+
+    explicit inline_vector(const allocator_type &alloc)
+        : local{},
+          allocator{alloc},
+          first{local.data()},
+          length{},
+          capacity{Len} {}
+
+    inline_vector(const inline_vector &other)
+        : inline_vector{other, alloc_traits::select_on_container_copy_construction(other.allocator)} {}
+
+    inline_vector(const inline_vector &other, const allocator_type &alloc)
+        : inline_vector{alloc} {
+        reserve(other.length);
+        std::copy(other.first, other.first + other.length, first);
+        length = other.length;
+    }
+
+    inline_vector(inline_vector &&other) ENTT_NOEXCEPT
+        : inline_vector{other.allocator} {
+        steal(other);
+    }
+
+    inline_vector(inline_vector &&other, const allocator_type &alloc)
+        : inline_vector{alloc} {
+        if(alloc_traits::is_always_equal::value || allocator == other.allocator) {
+            steal(other);
+        } else {
+            *this = std::as_const(other);
+            other.clear();
+        }
+    }
+
+    ~inline_vector() {
+        release();
+    }
+
+    inline_vector &operator=(const inline_vector &other) {
+        if(this != &other) {
+            length = 0u;
+            reserve(other.length);
+            std::copy(other.first, other.first + other.length, first);
+            length = other.length;
+        }
+
+        return *this;
+    }
+
+    inline_vector &operator=(inline_vector &&other) ENTT_NOEXCEPT {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || allocator == other.allocator, "Moving between different allocators is not allowed");
+
+        if(this != &other) {
+            release();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        return first;
+    }
+
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        return first;
+    }
+
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return first + length;
+    }
+
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return first + length;
+    }
+
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (length == 0u);
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        length = 0u;
+    }
+
+    iterator insert(const_iterator pos, const value_type &value) {
+        const auto idx = static_cast<size_type>(pos - first);
+        // the value is copied in advance, it could refer to an element
+        const value_type elem = value;
+        reserve(length + 1u);
+        std::copy_backward(first + idx, first + length, first + length + 1u);
+        first[idx] = elem;
+        ++length;
+        return first + idx;
+    }
+
+    iterator erase(const_iterator from, const_iterator to) ENTT_NOEXCEPT {
+        const auto idx = static_cast<size_type>(from - first);
+        const auto last = static_cast<size_type>(to - first);
+        std::copy(first + last, first + length, first + idx);
+        length -= (last - idx);
+        return first + idx;
+    }
+
+private:
+    std::array<Type, Len> local;
+    allocator_type allocator;
+    Type *first;
+    size_type length;
+    size_type capacity;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Sink class.
  *
@@ -32,8 +228,9 @@ class sink;
  *
  * @tparam Type A valid function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Len Number of listeners stored in place before allocating.
  */
-template<typename Type, typename Allocator>
+template<typename Type, typename Allocator, std::size_t Len>
 class sigh;
 
 /**
@@ -48,18 +245,24 @@ class sigh;
  * * Creating signals to use later to notify a bunch of listeners.
  * * Collecting results from a set of functions like in a voting system.
  *
+ * The first `Len` listeners are stored within the signal handler itself, the
+ * allocator is used only when there are more listeners than that. Signals
+ * with a small, known number of listeners don't allocate at all this way.
+ *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Len Number of listeners stored in place before allocating.
  */
-template<typename Ret, typename... Args, typename Allocator>
-class sigh<Ret(Args...), Allocator> {
+template<typename Ret, typename... Args, typename Allocator, std::size_t Len>
+class sigh<Ret(Args...), Allocator, Len> {
     /*! @brief A sink is allowed to modify a signal. */
-    friend class sink<sigh<Ret(Args...), Allocator>>;
+    friend class sink<sigh<Ret(Args...), Allocator, Len>>;
 
     using alloc_traits = std::allocator_traits<Allocator>;
     static_assert(std::is_same_v<typename alloc_traits::value_type, Ret (*)(Args...)>, "Invalid value type");
-    using container_type = std::vector<delegate<Ret(Args...)>, typename alloc_traits::template rebind_alloc<delegate<Ret(Args...)>>>;
+    using delegate_allocator = typename alloc_traits::template rebind_alloc<delegate<Ret(Args...)>>;
+    using container_type = std::conditional_t<Len == 0u, std::vector<delegate<Ret(Args...)>, delegate_allocator>, internal::inline_vector<delegate<Ret(Args...)>, Len, delegate_allocator>>;
 
 public:
     /*! @brief Allocator type. */
@@ -67,7 +270,7 @@ public:
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
     /*! @brief Sink type. */
-    using sink_type = sink<sigh<Ret(Args...), Allocator>>;
+    using sink_type = sink<sigh<Ret(Args...), Allocator, Len>>;
 
     /*! @brief Default constructor. */
     sigh()
@@ -178,8 +381,14 @@ public:
      * @param args Arguments to use to invoke listeners.
      */
     void publish(Args... args) const {
-        for(auto &&call: std::as_const(calls)) {
-            call(args...);
+        ENTT_PROFILE_SCOPE(type_id<sigh>().name());
+        // runs of listeners bound to the same function share the target, the indirect call is well predicted
+        for(auto first = calls.cbegin(), last = calls.cend(); first != last;) {
+            auto *target = first->target();
+
+            do {
+                target(first->data(), args...);
+            } while(++first != last && first->target() == target);
         }
     }
 
@@ -218,6 +427,61 @@ public:
         }
     }
 
+    /**
+     * @brief Combines the return values of the listeners.
+     *
+     * Results are folded one at a time by means of the given binary operation,
+     * without any intermediate storage.
+     *
+     * @tparam Type Type of the accumulated value.
+     * @tparam Op Type of binary operation to use.
+     * @param init Initial value of the accumulator.
+     * @param op A valid binary operation.
+     * @param args Arguments to use to invoke listeners.
+     * @return The accumulated value.
+     */
+    template<typename Type, typename Op>
+    [[nodiscard]] Type reduce(Type init, Op op, Args... args) const {
+        static_assert(!std::is_void_v<Ret>, "Invalid return type");
+
+        for(auto first = calls.cbegin(), last = calls.cend(); first != last;) {
+            auto *target = first->target();
+
+            do {
+                init = op(std::move(init), target(first->data(), args...));
+            } while(++first != last && first->target() == target);
+        }
+
+        return init;
+    }
+
+    /**
+     * @brief Writes the return values of the listeners to an output range.
+     *
+     * The range must be large enough to contain a value for each listener
+     * currently connected to the signal.
+     *
+     * @tparam It Type of output iterator.
+     * @param out An output iterator.
+     * @param args Arguments to use to invoke listeners.
+     * @return An iterator past the last value written.
+     */
+    template<typename It>
+    It gather(It out, Args... args) const {
+        static_assert(!std::is_void_v<Ret>, "Invalid return type");
+
+        for(auto first = calls.cbegin(), last = calls.cend(); first != last;) {
+            auto *target = first->target();
+
+            do {
+                *out = target(first->data(), args...);
+                ++out;
+            } while(++first != last && first->target() == target);
+        }
+
+        return out;
+    }
+
 private:
     container_type calls;
 };
@@ -358,10 +622,11 @@ private:
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Len Number of listeners stored in place before allocating.
  */
-template<typename Ret, typename... Args, typename Allocator>
-class sink<sigh<Ret(Args...), Allocator>> {
-    using signal_type = sigh<Ret(Args...), Allocator>;
+template<typename Ret, typename... Args, typename Allocator, std::size_t Len>
+class sink<sigh<Ret(Args...), Allocator, Len>> {
+    using signal_type = sigh<Ret(Args...), Allocator, Len>;
     using difference_type = typename std::iterator_traits<typename decltype(signal_type::calls)::iterator>::difference_type;
 
     template<auto Candidate, typename Type>
@@ -374,12 +639,28 @@ class sink<sigh<Ret(Args...), Allocator>> {
         sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
     }
 
+    void insert(delegate<Ret(Args...)> call) {
+        auto &calls = signal->calls;
+        auto pos = calls.end() - offset;
+
+        if(!offset) {
+            // listeners bound to the same function are kept together, they're invoked in a row
+            using reverse_iterator = std::reverse_iterator<decltype(pos)>;
+
+            if(const auto it = std::find_if(reverse_iterator{calls.end()}, reverse_iterator{calls.begin()}, [target = call.target()](const auto &elem) { return elem.target() == target; }); it.base() != calls.begin()) {
+                pos = it.base();
+            }
+        }
+
+        calls.insert(pos, std::move(call));
+    }
+
 public:
     /**
      * @brief Constructs a sink that is allowed to modify a given signal.
      * @param ref A valid reference to a signal object.
      */
-    sink(sigh<Ret(Args...), Allocator> &ref) ENTT_NOEXCEPT
+    sink(sigh<Ret(Args...), Allocator, Len> &ref) ENTT_NOEXCEPT
         : offset{},
           signal{&ref} {}
 
@@ -491,7 +772,7 @@ public:
 
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>();
-        signal->calls.insert(signal->calls.end() - offset, std::move(call));
+        insert(std::move(call));
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate>>();
@@ -521,7 +802,7 @@ public:
 
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>(value_or_instance);
-        signal->calls.insert(signal->calls.end() - offset, std::move(call));
+        insert(std::move(call));
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate, Type>>(value_or_instance);
@@ -600,9 +881,449 @@ private:
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Len Number of listeners stored in place before allocating.
+ */
+template<typename Ret, typename... Args, typename Allocator, std::size_t Len>
+sink(sigh<Ret(Args...), Allocator, Len> &) -> sink<sigh<Ret(Args...), Allocator, Len>>;
+
+/**
+ * @brief Thread-safe signal handler.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ *
+ * @tparam Type A valid function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Allocator>
+class concurrent_sigh;
+
+/**
+ * @brief Thread-safe signal handler.
+ *
+ * Listeners are stored in immutable snapshots. Publishing reads the current
+ * snapshot without locks, while connecting or disconnecting a listener copies
+ * it, applies the change and swaps the new one in. Therefore, a signal can be
+ * published from multiple threads while listeners are connected or
+ * disconnected on others.<br/>
+ * Replaced snapshots are released once no publisher can still refer to them.
+ *
+ * Listeners connected or disconnected during a publish are taken into account
+ * from the next one.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Ret, typename... Args, typename Allocator>
+class concurrent_sigh<Ret(Args...), Allocator> {
+    /*! @brief A sink is allowed to modify a signal. */
+    friend class sink<concurrent_sigh<Ret(Args...), Allocator>>;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Ret (*)(Args...)>, "Invalid value type");
+    using delegate_allocator = typename alloc_traits::template rebind_alloc<delegate<Ret(Args...)>>;
+    using container_type = std::vector<delegate<Ret(Args...)>, delegate_allocator>;
+
+    struct snapshot {
+        snapshot(const delegate_allocator &allocator)
+            : calls{allocator} {}
+
+        container_type calls;
+        std::size_t epoch{};
+        snapshot *next{};
+    };
+
+    using snapshot_allocator = typename alloc_traits::template rebind_alloc<snapshot>;
+    using snapshot_traits = std::allocator_traits<snapshot_allocator>;
+
+    struct reader {
+        ~reader() {
+            count.fetch_sub(1u);
+        }
+
+        std::atomic<std::size_t> &count;
+    };
+
+    template<typename Func>
+    void read(Func func) const {
+        auto &count = readers[epoch.load() & 1u];
+        count.fetch_add(1u);
+        const reader guard{count};
+
+        if(const auto *curr = current.first().load(); curr) {
+            func(curr->calls);
+        }
+    }
+
+    void destroy(snapshot *elem) {
+        snapshot_allocator allocator{current.second()};
+        snapshot_traits::destroy(allocator, elem);
+        snapshot_traits::deallocate(allocator, elem, 1u);
+    }
+
+    void reclaim() {
+        // the epoch moves forward only when readers from the previous one with the same parity are gone
+        for(auto next = epoch.load() + 1u; retired && readers[next & 1u].load() == 0u && next <= retired->epoch + 2u; ++next) {
+            epoch.store(next);
+        }
+
+        // snapshots retired two epochs ago aren't visible to any reader
+        for(auto **elem = &retired; *elem;) {
+            if(auto *curr = *elem; curr->epoch + 2u <= epoch.load()) {
+                *elem = curr->next;
+                destroy(curr);
+            } else {
+                elem = &curr->next;
+            }
+        }
+    }
+
+    template<typename Func>
+    void modify(Func func) {
+        std::lock_guard lock{mutex};
+        snapshot_allocator allocator{current.second()};
+        auto *curr = current.first().load();
+        auto *elem = snapshot_traits::allocate(allocator, 1u);
+
+        ENTT_TRY {
+            snapshot_traits::construct(allocator, elem, delegate_allocator{allocator});
+        }
+        ENTT_CATCH {
+            snapshot_traits::deallocate(allocator, elem, 1u);
+            ENTT_THROW;
+        }
+
+        ENTT_TRY {
+            if(curr) {
+                elem->calls = curr->calls;
+            }
+
+            if(!func(elem->calls)) {
+                destroy(elem);
+                return;
+            }
+        }
+        ENTT_CATCH {
+            destroy(elem);
+            ENTT_THROW;
+        }
+
+        if(elem->calls.empty()) {
+            destroy(elem);
+            elem = nullptr;
+        }
+
+        if(curr = current.first().exchange(elem); curr) {
+            curr->epoch = epoch.load();
+            curr->next = std::exchange(retired, curr);
+        }
+
+        reclaim();
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Sink type. */
+    using sink_type = sink<concurrent_sigh<Ret(Args...), Allocator>>;
+
+    /*! @brief Default constructor. */
+    concurrent_sigh()
+        : concurrent_sigh{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a signal handler with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit concurrent_sigh(const allocator_type &allocator)
+        : current{nullptr, allocator},
+          readers{},
+          epoch{},
+          retired{},
+          mutex{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    concurrent_sigh(const concurrent_sigh &) = delete;
+
+    /*! @brief Releases all the snapshots. */
+    ~concurrent_sigh() {
+        if(auto *curr = current.first().load(); curr) {
+            destroy(curr);
+        }
+
+        while(retired) {
+            destroy(std::exchange(retired, retired->next));
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This signal handler.
+     */
+    concurrent_sigh &operator=(const concurrent_sigh &) = delete;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return current.second();
+    }
+
+    /**
+     * @brief Instance type when it comes to connecting member functions.
+     * @tparam Class Type of class to which the member function belongs.
+     */
+    template<typename Class>
+    using instance_type = Class *;
+
+    /**
+     * @brief Number of listeners connected to the signal.
+     * @return Number of listeners currently connected.
+     */
+    [[nodiscard]] size_type size() const {
+        size_type len{};
+        read([&len](const auto &calls) { len = calls.size(); });
+        return len;
+    }
+
+    /**
+     * @brief Returns false if at least a listener is connected to the signal.
+     * @return True if the signal has no listeners connected, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return (current.first().load() == nullptr);
+    }
+
+    /**
+     * @brief Triggers a signal.
+     *
+     * All the listeners are notified. Order isn't guaranteed.
+     *
+     * @param args Arguments to use to invoke listeners.
+     */
+    void publish(Args... args) const {
+        ENTT_PROFILE_SCOPE(type_id<concurrent_sigh>().name());
+        read([&args...](const auto &calls) {
+            for(auto &&call: calls) {
+                call(args...);
+            }
+        });
+    }
+
+    /**
+     * @brief Collects return values from the listeners.
+     *
+     * @sa sigh::collect
+     *
+     * @tparam Func Type of collector to use, if any.
+     * @param func A valid function object.
+     * @param args Arguments to use to invoke listeners.
+     */
+    template<typename Func>
+    void collect(Func func, Args... args) const {
+        read([&func, &args...](const auto &calls) {
+            for(auto &&call: calls) {
+                if constexpr(std::is_void_v<Ret>) {
+                    if constexpr(std::is_invocable_r_v<bool, Func>) {
+                        call(args...);
+                        if(func()) { break; }
+                    } else {
+                        call(args...);
+                        func();
+                    }
+                } else {
+                    if constexpr(std::is_invocable_r_v<bool, Func, Ret>) {
+                        if(func(call(args...))) { break; }
+                    } else {
+                        func(call(args...));
+                    }
+                }
+            }
+        });
+    }
+
+private:
+    compressed_pair<std::atomic<snapshot *>, allocator_type> current;
+    mutable std::array<std::atomic<size_type>, 2u> readers;
+    std::atomic<size_type> epoch;
+    snapshot *retired;
+    std::mutex mutex;
+};
+
+/**
+ * @brief Sink class for thread-safe signal handlers.
+ *
+ * Listeners can be connected and disconnected while the signal is published
+ * on other threads. Multiple sinks can modify the same signal concurrently.
+ *
+ * @warning
+ * Lifetime of a sink must not overcome that of the signal to which it refers.
+ * In any other case, attempting to use a sink results in undefined behavior.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Ret, typename... Args, typename Allocator>
+class sink<concurrent_sigh<Ret(Args...), Allocator>> {
+    using signal_type = concurrent_sigh<Ret(Args...), Allocator>;
+
+    template<auto Candidate, typename Type>
+    static void release(Type value_or_instance, void *signal) {
+        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>(value_or_instance);
+    }
+
+    template<auto Candidate>
+    static void release(void *signal) {
+        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
+    }
+
+    template<typename Predicate>
+    void erase(Predicate predicate) {
+        signal->modify([&predicate](auto &calls) {
+            const auto it = std::remove_if(calls.begin(), calls.end(), predicate);
+            const bool changed = (it != calls.end());
+            calls.erase(it, calls.end());
+            return changed;
+        });
+    }
+
+    void insert(delegate<Ret(Args...)> call) {
+        signal->modify([&call](auto &calls) {
+            calls.erase(std::remove(calls.begin(), calls.end(), call), calls.end());
+            calls.push_back(std::move(call));
+            return true;
+        });
+    }
+
+public:
+    /**
+     * @brief Constructs a sink that is allowed to modify a given signal.
+     * @param ref A valid reference to a signal object.
+     */
+    sink(concurrent_sigh<Ret(Args...), Allocator> &ref) ENTT_NOEXCEPT
+        : signal{&ref} {}
+
+    /**
+     * @brief Returns false if at least a listener is connected to the sink.
+     * @return True if the sink has no listeners connected, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return signal->empty();
+    }
+
+    /**
+     * @brief Connects a free function or an unbound member to a signal.
+     * @tparam Candidate Function or member to connect to the signal.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate>
+    connection connect() {
+        delegate<Ret(Args...)> call{};
+        call.template connect<Candidate>();
+        insert(std::move(call));
+
+        delegate<void(void *)> conn{};
+        conn.template connect<&release<Candidate>>();
+        return {std::move(conn), signal};
+    }
+
+    /**
+     * @brief Connects a free function with payload or a bound member to a
+     * signal.
+     *
+     * @sa sink<sigh<Ret(Args...), Allocator, Len>>::connect
+     *
+     * @tparam Candidate Function or member to connect to the signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate, typename Type>
+    connection connect(Type &&value_or_instance) {
+        delegate<Ret(Args...)> call{};
+        call.template connect<Candidate>(value_or_instance);
+        insert(std::move(call));
+
+        delegate<void(void *)> conn{};
+        conn.template connect<&release<Candidate, Type>>(value_or_instance);
+        return {std::move(conn), signal};
+    }
+
+    /**
+     * @brief Disconnects a free function or an unbound member from a signal.
+     * @tparam Candidate Function or member to disconnect from the signal.
+     */
+    template<auto Candidate>
+    void disconnect() {
+        delegate<Ret(Args...)> call{};
+        call.template connect<Candidate>();
+        erase([&call](const auto &elem) { return elem == call; });
+    }
+
+    /**
+     * @brief Disconnects a free function with payload or a bound member from a
+     * signal.
+     * @tparam Candidate Function or member to disconnect from the signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    void disconnect(Type &&value_or_instance) {
+        delegate<Ret(Args...)> call{};
+        call.template connect<Candidate>(value_or_instance);
+        erase([&call](const auto &elem) { return elem == call; });
+    }
+
+    /**
+     * @brief Disconnects free functions with payload or bound members from a
+     * signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type &value_or_instance) {
+        disconnect(&value_or_instance);
+    }
+
+    /**
+     * @brief Disconnects free functions with payload or bound members from a
+     * signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid pointer that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type *value_or_instance) {
+        if(value_or_instance) {
+            erase([value_or_instance](const auto &elem) { return elem.data() == value_or_instance; });
+        }
+    }
+
+    /*! @brief Disconnects all the listeners from a signal. */
+    void disconnect() {
+        erase([](const auto &) { return true; });
+    }
+
+private:
+    signal_type *signal;
+};
+
+/**
+ * @brief Deduction guide.
+ *
+ * It allows to deduce the signal handler type of a sink directly from the
+ * thread-safe signal it refers to.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
 template<typename Ret, typename... Args, typename Allocator>
-sink(sigh<Ret(Args...), Allocator> &) -> sink<sigh<Ret(Args...), Allocator>>;
+sink(concurrent_sigh<Ret(Args...), Allocator> &) -> sink<concurrent_sigh<Ret(Args...), Allocator>>;
 
 } // namespace entt
 
@@ -5,6 +5,7 @@
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/signature.hpp>
 
 struct position {
     std::uint64_t x;
@@ -482,6 +483,27 @@ TEST(Benchmark, IterateTwoComponentsRuntime1M) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponentsRuntime1MElements) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, runtime view, opaque elements" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.emplace<position>(entity);
+        registry.emplace<velocity>(entity);
+    }
+
+    entt::runtime_view view{};
+    view.iterate(registry.storage<position>())
+        .iterate(registry.storage<velocity>());
+
+    generic(view, [](entt::entity, const void *const *elements) {
+        const_cast<position *>(static_cast<const position *>(elements[0u]))->x = {};
+        const_cast<velocity *>(static_cast<const velocity *>(elements[1u]))->x = {};
+    });
+}
+
 TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
     entt::registry registry;
 
@@ -793,6 +815,33 @@ TEST(Benchmark, IterateFiveComponents1MHalf) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponents1MHalfSignatureCache) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+
+    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, signature cache" << std::endl;
+
+    cache.track<position, velocity, comp<0>, comp<1>, comp<2>>();
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.emplace<velocity>(entity);
+        registry.emplace<comp<0>>(entity);
+        registry.emplace<comp<1>>(entity);
+        registry.emplace<comp<2>>(entity);
+
+        if(i % 2) {
+            registry.emplace<position>(entity);
+        }
+    }
+
+    timer timer;
+    cache.each<position, velocity, comp<0>, comp<1>, comp<2>>([](const auto, auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+    timer.elapsed();
+}
+
 TEST(Benchmark, IterateFiveComponents1MOne) {
     entt::registry registry;
 
@@ -0,0 +1,128 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/trace_storage_mixin.hpp>
+
+// a trace is recorded once and replayed against registries configured in different ways
+
+struct recorded {
+    static constexpr auto trace_operations = true;
+};
+
+struct swap_and_pop {};
+
+struct in_place {
+    static constexpr auto in_place_delete = true;
+};
+
+struct small_pages {
+    static constexpr auto page_size = 128u;
+};
+
+struct grouped {};
+
+template<std::size_t Size, typename Config>
+struct component: Config {
+    std::uint8_t data[Size];
+};
+
+using position = component<16u, recorded>;
+using velocity = component<8u, recorded>;
+using health = component<4u, recorded>;
+using tag = component<1u, recorded>;
+
+template<typename Config>
+void assure_pools(entt::registry &registry, std::array<entt::sparse_set *, 4u> &pools) {
+    pools = {&registry.storage<component<16u, Config>>(), &registry.storage<component<8u, Config>>(), &registry.storage<component<4u, Config>>(), &registry.storage<component<1u, Config>>()};
+}
+
+// frames spawn and kill entities and toggle tags on the survivors, as a game loop would do
+const entt::operation_trace &workload() {
+    static const entt::operation_trace trace = []() {
+        std::mt19937 engine{42u};
+        std::vector<entt::entity> alive{};
+        entt::registry registry;
+
+        for(std::size_t frame{}; frame < 256u; ++frame) {
+            for(std::size_t spawn{}; spawn < 64u; ++spawn) {
+                const auto entity = alive.emplace_back(registry.create());
+                registry.emplace<position>(entity);
+
+                if(engine() % 2u) {
+                    registry.emplace<velocity>(entity);
+                }
+
+                if(engine() % 4u) {
+                    registry.emplace<health>(entity);
+                }
+            }
+
+            for(std::size_t toggle{}; toggle < 64u; ++toggle) {
+                const auto entity = alive[engine() % alive.size()];
+
+                if(registry.all_of<tag>(entity)) {
+                    registry.remove<tag>(entity);
+                } else {
+                    registry.emplace<tag>(entity);
+                }
+            }
+
+            for(std::size_t kill{}; kill < 48u; ++kill) {
+                const auto pos = engine() % alive.size();
+                registry.destroy(alive[pos]);
+                alive[pos] = alive.back();
+                alive.pop_back();
+            }
+        }
+
+        return registry.ctx().at<entt::operation_trace>();
+    }();
+
+    return trace;
+}
+
+template<typename Config>
+static void Replay(benchmark::State &state) {
+    const auto &trace = workload();
+
+    for(auto _: state) {
+        state.PauseTiming();
+        std::array<entt::sparse_set *, 4u> pools{};
+        entt::registry registry;
+        assure_pools<Config>(registry, pools);
+
+        if constexpr(std::is_same_v<Config, grouped>) {
+            static_cast<void>(registry.group<component<16u, Config>, component<8u, Config>>());
+        }
+
+        state.ResumeTiming();
+
+        trace.replay(registry, [&pools](const entt::id_type id) -> entt::sparse_set * {
+            const std::array<entt::id_type, 4u> ids{entt::type_hash<position>::value(), entt::type_hash<velocity>::value(), entt::type_hash<health>::value(), entt::type_hash<tag>::value()};
+
+            for(std::size_t pos{}; pos < ids.size(); ++pos) {
+                if(ids[pos] == id) {
+                    return pools[pos];
+                }
+            }
+
+            return nullptr;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * trace.size()));
+    state.counters["records"] = static_cast<double>(trace.size());
+}
+
+BENCHMARK_TEMPLATE(Replay, swap_and_pop)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(Replay, in_place)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(Replay, small_pages)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(Replay, grouped)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,320 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sharded_registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+// strong scaling: fixed amount of work split among threads, ideally the time is divided by the number of threads
+// weak scaling: fixed amount of work per thread, ideally the time doesn't change with the number of threads
+// speedup and efficiency are relative to the single thread run of the same case, run it too when filtering
+
+enum class scaling {
+    strong,
+    weak
+};
+
+template<std::size_t Size>
+struct component {
+    std::uint64_t data[Size];
+};
+
+using position = component<2u>;
+using velocity = component<1u>;
+
+struct event {
+    std::uint64_t value;
+};
+
+struct listener {
+    void receive(const event &elem) {
+        value += elem.value;
+    }
+
+    std::uint64_t value{};
+};
+
+// workers are created once, so that spawning threads doesn't affect the measures
+class thread_pool {
+    using function_type = void(const void *, const std::size_t);
+
+    void run() {
+        for(auto chunk = next.fetch_add(1u); chunk < count; chunk = next.fetch_add(1u)) {
+            invoke(job, chunk);
+        }
+
+        if(pending.fetch_sub(1u) == 1u) {
+            std::lock_guard lock{mutex};
+            done.notify_one();
+        }
+    }
+
+    void work() {
+        for(std::size_t seen{};;) {
+            {
+                std::unique_lock lock{mutex};
+                wake.wait(lock, [this, seen]() { return stop || generation != seen; });
+
+                if(stop) {
+                    return;
+                }
+
+                seen = generation;
+            }
+
+            run();
+        }
+    }
+
+public:
+    explicit thread_pool(const std::size_t threads) {
+        for(std::size_t pos = 1u; pos < threads; ++pos) {
+            workers.emplace_back(&thread_pool::work, this);
+        }
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+
+        wake.notify_all();
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return workers.size() + 1u;
+    }
+
+    template<typename Task>
+    void operator()(const std::size_t length, const Task &task) {
+        {
+            std::lock_guard lock{mutex};
+            job = &task;
+            invoke = [](const void *elem, const std::size_t chunk) { (*static_cast<const Task *>(elem))(chunk); };
+            count = length;
+            next = 0u;
+            pending = size();
+            ++generation;
+        }
+
+        wake.notify_all();
+        // the calling thread takes part in the work
+        run();
+
+        std::unique_lock lock{mutex};
+        done.wait(lock, [this]() { return pending.load() == 0u; });
+    }
+
+private:
+    std::vector<std::thread> workers{};
+    std::mutex mutex{};
+    std::condition_variable wake{};
+    std::condition_variable done{};
+    const void *job{};
+    function_type *invoke{};
+    std::size_t count{};
+    std::size_t generation{};
+    std::atomic<std::size_t> next{};
+    std::atomic<std::size_t> pending{};
+    bool stop{};
+};
+
+void thread_counts(benchmark::internal::Benchmark *bench) {
+    bench->RangeMultiplier(2)->Range(1, 64)->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+[[nodiscard]] std::size_t workload(const scaling mode, const std::size_t threads, const std::size_t base) {
+    return (mode == scaling::weak) ? (base * threads) : base;
+}
+
+template<typename Setup, typename Func>
+void measure(benchmark::State &state, const char *name, const scaling mode, const std::size_t items, Setup setup, Func func) {
+    static std::map<std::string, double> reference{};
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    double total{};
+
+    for(auto _: state) {
+        setup();
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        state.SetIterationTime(elapsed);
+        total += elapsed;
+    }
+
+    const auto time = total / static_cast<double>(state.iterations());
+    auto &baseline = reference[std::string{name} + (mode == scaling::weak ? "/weak" : "/strong")];
+    baseline = (threads == 1u) ? time : baseline;
+
+    if(baseline != 0.) {
+        // with weak scaling, threads do more work in the same time
+        const auto speedup = (baseline / time) * ((mode == scaling::weak) ? static_cast<double>(threads) : 1.);
+        state.counters["speedup"] = speedup;
+        state.counters["efficiency"] = speedup / static_cast<double>(threads);
+    }
+
+    state.counters["threads"] = static_cast<double>(threads);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * items));
+}
+
+template<scaling Mode>
+static void ViewIteration(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto count = workload(Mode, threads, 1u << 20u);
+    std::vector<entt::entity> entities(count);
+    thread_pool pool{threads};
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    measure(
+        state, "ViewIteration", Mode, count, []() {}, [&]() {
+            registry.view<position, const velocity>().par_each(pool, [](auto &pos, const auto &vel) {
+                pos.data[0u] += vel.data[0u];
+            });
+
+            benchmark::ClobberMemory();
+        });
+}
+
+BENCHMARK_TEMPLATE(ViewIteration, scaling::strong)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(ViewIteration, scaling::weak)->Apply(thread_counts);
+
+// group sorting is sequential, shards (one per thread) are sorted concurrently instead
+template<scaling Mode>
+static void GroupSort(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto count = workload(Mode, threads, 1u << 18u);
+    entt::sharded_registry registry{threads};
+    thread_pool pool{threads};
+
+    for(std::size_t pos{}; pos < threads; ++pos) {
+        auto &shard = registry.shard(pos);
+        std::vector<entt::entity> entities(count / threads);
+        static_cast<void>(shard.group<position, velocity>());
+        shard.create(entities.begin(), entities.end());
+        shard.insert<position>(entities.begin(), entities.end());
+        shard.insert<velocity>(entities.begin(), entities.end());
+    }
+
+    std::uint64_t seed{};
+
+    measure(
+        state, "GroupSort", Mode, count, [&]() {
+            for(std::size_t pos{}; pos < threads; ++pos) {
+                registry.shard(pos).view<position>().each([&seed](auto &elem) { elem.data[0u] = (seed = seed * 6364136223846793005u + 1442695040888963407u); });
+            }
+        },
+        [&]() {
+            pool(threads, [&registry](const std::size_t pos) {
+                registry.shard(pos).group<position, velocity>().sort<position>([](const auto &lhs, const auto &rhs) { return lhs.data[0u] < rhs.data[0u]; });
+            });
+        });
+}
+
+BENCHMARK_TEMPLATE(GroupSort, scaling::strong)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(GroupSort, scaling::weak)->Apply(thread_counts);
+
+// registries aren't thread-safe, shards (one per thread) create and destroy entities concurrently instead
+template<scaling Mode>
+static void BulkCreateDestroy(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto count = workload(Mode, threads, 1u << 20u);
+    std::vector<std::vector<entt::entity>> entities(threads, std::vector<entt::entity>(count / threads));
+    entt::sharded_registry registry{threads};
+    thread_pool pool{threads};
+
+    measure(
+        state, "BulkCreateDestroy", Mode, count, []() {}, [&]() {
+            pool(threads, [&registry, &entities](const std::size_t pos) {
+                auto &shard = registry.shard(pos);
+                shard.create(entities[pos].begin(), entities[pos].end());
+                shard.insert<position>(entities[pos].begin(), entities[pos].end());
+                shard.destroy(entities[pos].begin(), entities[pos].end());
+            });
+        });
+}
+
+BENCHMARK_TEMPLATE(BulkCreateDestroy, scaling::strong)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(BulkCreateDestroy, scaling::weak)->Apply(thread_counts);
+
+// pools are serialized concurrently, there is no gain with more threads than pools
+template<scaling Mode>
+static void SnapshotSave(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto count = workload(Mode, threads, 1u << 16u);
+    std::vector<entt::entity> entities(count);
+    thread_pool pool{threads};
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<component<1u>>(entities.begin(), entities.end());
+    registry.insert<component<2u>>(entities.begin(), entities.end());
+    registry.insert<component<3u>>(entities.begin(), entities.end());
+    registry.insert<component<4u>>(entities.begin(), entities.end());
+    registry.insert<component<5u>>(entities.begin(), entities.end());
+    registry.insert<component<6u>>(entities.begin(), entities.end());
+    registry.insert<component<7u>>(entities.begin(), entities.end());
+    registry.insert<component<8u>>(entities.begin(), entities.end());
+
+    std::vector<std::byte> buffer{};
+
+    measure(
+        state, "SnapshotSave", Mode, count, [&buffer]() { buffer.clear(); }, [&]() {
+            entt::binary_output_archive archive{buffer};
+            entt::snapshot{registry}.par_component<component<1u>, component<2u>, component<3u>, component<4u>, component<5u>, component<6u>, component<7u>, component<8u>>(pool, archive);
+            benchmark::DoNotOptimize(buffer.data());
+        });
+}
+
+BENCHMARK_TEMPLATE(SnapshotSave, scaling::strong)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(SnapshotSave, scaling::weak)->Apply(thread_counts);
+
+// producers enqueue concurrently, events are then delivered by a single thread as usual
+template<scaling Mode>
+static void DispatcherEnqueue(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto count = workload(Mode, threads, 1u << 18u);
+    entt::concurrent_dispatcher dispatcher{};
+    thread_pool pool{threads};
+    listener instance{};
+
+    dispatcher.sink<event>().connect<&listener::receive>(instance);
+
+    measure(
+        state, "DispatcherEnqueue", Mode, count, []() {}, [&]() {
+            pool(threads, [&dispatcher, length = count / threads](const std::size_t) {
+                for(std::size_t pos{}; pos < length; ++pos) {
+                    dispatcher.enqueue<event>(pos);
+                }
+            });
+
+            dispatcher.update();
+        });
+
+    benchmark::DoNotOptimize(instance.value);
+}
+
+BENCHMARK_TEMPLATE(DispatcherEnqueue, scaling::strong)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(DispatcherEnqueue, scaling::weak)->Apply(thread_counts);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,430 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <entt/container/dense_flat_map.hpp>
+#include <entt/container/dense_map.hpp>
+#include <entt/container/flat_map.hpp>
+#include <entt/core/any.hpp>
+#include <entt/core/hashed_string.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/event_trace.hpp>
+#include <entt/signal/sigh.hpp>
+
+struct event {
+    std::uint64_t value;
+};
+
+struct bulky_event {
+    std::uint64_t value;
+    std::uint64_t payload[7u];
+};
+
+struct listener {
+    void receive(const event &elem) {
+        value += elem.value;
+    }
+
+    void receive_bulky(const bulky_event &elem) {
+        value += elem.value;
+    }
+
+    void receive_value(const std::uint64_t elem) {
+        value += elem;
+    }
+
+    std::uint64_t value{};
+};
+
+struct test_emitter: entt::emitter<test_emitter> {};
+
+struct reflected {
+    [[nodiscard]] std::uint64_t get() const {
+        return value;
+    }
+
+    void set(const std::uint64_t elem) {
+        value = elem;
+    }
+
+    std::uint64_t value{};
+};
+
+void listener_counts(benchmark::internal::Benchmark *bench) {
+    bench->RangeMultiplier(4)->Range(1, 256);
+}
+
+static void SighPublish(benchmark::State &state) {
+    std::vector<listener> listeners(static_cast<std::size_t>(state.range(0)));
+    entt::sigh<void(std::uint64_t)> sigh;
+    entt::sink sink{sigh};
+
+    for(auto &&instance: listeners) {
+        sink.connect<&listener::receive_value>(instance);
+    }
+
+    for(auto _: state) {
+        sigh.publish(1u);
+    }
+
+    benchmark::DoNotOptimize(listeners.data());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * listeners.size()));
+}
+
+BENCHMARK(SighPublish)->Apply(listener_counts);
+
+static void DispatcherTrigger(benchmark::State &state) {
+    std::vector<listener> listeners(static_cast<std::size_t>(state.range(0)));
+    entt::dispatcher dispatcher;
+
+    for(auto &&instance: listeners) {
+        dispatcher.sink<event>().connect<&listener::receive>(instance);
+    }
+
+    for(auto _: state) {
+        dispatcher.trigger(event{1u});
+    }
+
+    benchmark::DoNotOptimize(listeners.data());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * listeners.size()));
+}
+
+BENCHMARK(DispatcherTrigger)->Apply(listener_counts);
+
+static void DispatcherEnqueueUpdate(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    entt::dispatcher dispatcher;
+    listener instance{};
+
+    dispatcher.sink<event>().connect<&listener::receive>(instance);
+
+    for(auto _: state) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            dispatcher.enqueue<event>(pos);
+        }
+
+        dispatcher.update<event>();
+    }
+
+    benchmark::DoNotOptimize(instance.value);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(DispatcherEnqueueUpdate)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+// only the events of the bound types are fed back, the others are skipped
+template<typename... Bound>
+static void DispatcherReplay(benchmark::State &state) {
+    entt::event_trace trace{1u << 14u};
+    entt::dispatcher dispatcher;
+    listener instance{};
+
+    dispatcher.sink<event>().connect<&listener::receive>(instance);
+    dispatcher.sink<bulky_event>().connect<&listener::receive_bulky>(instance);
+    dispatcher.record(&trace);
+
+    for(std::uint64_t pos{}; pos < trace.capacity(); ++pos) {
+        if(pos % 4u) {
+            dispatcher.enqueue(event{pos});
+        } else {
+            dispatcher.trigger(bulky_event{pos, {}});
+        }
+    }
+
+    dispatcher.record(nullptr);
+    dispatcher.clear();
+
+    entt::event_replayer<entt::dispatcher> replayer{};
+    (replayer.template bind<Bound>(), ...);
+    std::size_t count{};
+
+    for(auto _: state) {
+        count = replayer.replay(trace, dispatcher);
+        dispatcher.update();
+    }
+
+    benchmark::DoNotOptimize(instance.value);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(DispatcherReplay, event, bulky_event);
+BENCHMARK_TEMPLATE(DispatcherReplay, event);
+BENCHMARK_TEMPLATE(DispatcherReplay, bulky_event);
+
+static void EmitterPublish(benchmark::State &state) {
+    test_emitter emitter;
+    std::uint64_t value{};
+
+    for(auto pos = state.range(0); pos; --pos) {
+        emitter.on<event>([&value](const event &elem, test_emitter &) { value += elem.value; });
+    }
+
+    for(auto _: state) {
+        emitter.publish<event>(1u);
+    }
+
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+}
+
+BENCHMARK(EmitterPublish)->Apply(listener_counts);
+
+static void setup_meta() {
+    using namespace entt::literals;
+
+    static const auto once = []() {
+        entt::meta<reflected>()
+            .type("reflected"_hs)
+            .ctor<>()
+            .func<&reflected::get>("get"_hs)
+            .func<&reflected::set>("set"_hs);
+
+        return true;
+    }();
+
+    static_cast<void>(once);
+}
+
+static void MetaTypeInvoke(benchmark::State &state) {
+    using namespace entt::literals;
+
+    setup_meta();
+    const auto type = entt::resolve<reflected>();
+    reflected instance{};
+
+    for(auto _: state) {
+        type.invoke("set"_hs, instance, std::uint64_t{42u});
+        benchmark::DoNotOptimize(type.invoke("get"_hs, instance));
+    }
+}
+
+BENCHMARK(MetaTypeInvoke);
+
+static void MetaFuncInvoke(benchmark::State &state) {
+    using namespace entt::literals;
+
+    setup_meta();
+    const auto func = entt::resolve<reflected>().func("get"_hs);
+    reflected instance{};
+
+    for(auto _: state) {
+        benchmark::DoNotOptimize(func.invoke(instance));
+    }
+}
+
+BENCHMARK(MetaFuncInvoke);
+
+static void MetaAnyConstruct(benchmark::State &state) {
+    setup_meta();
+    const auto type = entt::resolve<reflected>();
+
+    for(auto _: state) {
+        benchmark::DoNotOptimize(type.construct());
+        benchmark::DoNotOptimize(entt::meta_any{std::uint64_t{42u}});
+    }
+}
+
+BENCHMARK(MetaAnyConstruct);
+
+template<typename Type>
+static void AnyCopy(benchmark::State &state) {
+    const entt::any value{Type{}};
+
+    for(auto _: state) {
+        entt::any other{value};
+        benchmark::DoNotOptimize(other.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(AnyCopy, std::uint64_t);
+BENCHMARK_TEMPLATE(AnyCopy, std::array<std::uint64_t, 8u>);
+BENCHMARK_TEMPLATE(AnyCopy, std::string);
+
+template<typename Type>
+static void AnyMove(benchmark::State &state) {
+    entt::any value{Type{}};
+
+    for(auto _: state) {
+        entt::any other{std::move(value)};
+        value = std::move(other);
+        benchmark::DoNotOptimize(value.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(AnyMove, std::uint64_t);
+BENCHMARK_TEMPLATE(AnyMove, std::array<std::uint64_t, 8u>);
+BENCHMARK_TEMPLATE(AnyMove, std::string);
+
+struct fnv1a_hash {
+    entt::id_type operator()(const std::string &str) const {
+        return entt::hashed_string::value(str.data(), str.size());
+    }
+};
+
+template<typename Hash>
+static void StringHash(benchmark::State &state) {
+    const std::string str(static_cast<std::size_t>(state.range(0)), 'a');
+    const Hash hash{};
+
+    for(auto _: state) {
+        benchmark::DoNotOptimize(hash(str));
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * str.size()));
+}
+
+BENCHMARK_TEMPLATE(StringHash, fnv1a_hash)->RangeMultiplier(4)->Range(8, 1 << 10);
+BENCHMARK_TEMPLATE(StringHash, entt::runtime_hash)->RangeMultiplier(4)->Range(8, 1 << 10);
+
+template<typename Map>
+static void MapInsert(benchmark::State &state) {
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+
+    for(auto _: state) {
+        Map map{};
+
+        for(std::uint64_t pos{}; pos < count; ++pos) {
+            map.emplace(pos * 2654435761u, pos);
+        }
+
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(MapInsert, entt::dense_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapInsert, entt::dense_flat_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapInsert, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+template<typename Map>
+static void MapInsertRange(benchmark::State &state) {
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> range{};
+
+    for(std::uint64_t pos{}; pos < count; ++pos) {
+        range.emplace_back(pos * 2654435761u, pos);
+    }
+
+    for(auto _: state) {
+        Map map{};
+        map.insert(range.begin(), range.end());
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(MapInsertRange, entt::dense_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapInsertRange, entt::dense_flat_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapInsertRange, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+template<typename Map>
+static void SmallMapLookup(benchmark::State &state) {
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    std::vector<Map> maps(1024u);
+
+    for(auto &&map: maps) {
+        for(std::uint64_t pos{}; pos < count; ++pos) {
+            map.emplace(pos * 2654435761u, pos);
+        }
+    }
+
+    for(auto _: state) {
+        std::uint64_t found{};
+
+        for(auto &&map: maps) {
+            for(std::uint64_t pos{}; pos < count; ++pos) {
+                found += map.find(pos * 2654435761u)->second;
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count * maps.size()));
+}
+
+BENCHMARK_TEMPLATE(SmallMapLookup, entt::flat_map<std::uint64_t, std::uint64_t, 16u>)->RangeMultiplier(2)->Range(2, 16);
+BENCHMARK_TEMPLATE(SmallMapLookup, entt::dense_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(2)->Range(2, 16);
+
+template<typename Map>
+static void MapLookup(benchmark::State &state) {
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    Map map{};
+
+    for(std::uint64_t pos{}; pos < count; ++pos) {
+        map.emplace(pos * 2654435761u, pos);
+    }
+
+    for(auto _: state) {
+        std::uint64_t found{};
+
+        for(std::uint64_t pos{}; pos < count; ++pos) {
+            found += map.find(pos * 2654435761u)->second;
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(MapLookup, entt::dense_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapLookup, entt::dense_flat_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(MapLookup, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+template<typename Map>
+static void MapLookupAligned(benchmark::State &state) {
+    // keys with a poor distribution of the low bits, as it happens with pointers
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    Map map{};
+
+    for(std::uint64_t pos{}; pos < count; ++pos) {
+        map.emplace(pos * 4096u, pos);
+    }
+
+    for(auto _: state) {
+        std::uint64_t found{};
+
+        for(std::uint64_t pos{}; pos < count; ++pos) {
+            found += map.find(pos * 4096u)->second;
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(MapLookupAligned, entt::dense_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 12);
+BENCHMARK_TEMPLATE(MapLookupAligned, entt::dense_flat_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 12);
+BENCHMARK_TEMPLATE(MapLookupAligned, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(16, 1 << 12);
+
+static void SchedulerUpdate(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    entt::scheduler<std::uint64_t> scheduler;
+    std::uint64_t value{};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        scheduler.attach([&value](const std::uint64_t delta, void *, auto, auto) { value += delta; });
+    }
+
+    for(auto _: state) {
+        scheduler.update(1u);
+    }
+
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(SchedulerUpdate)->RangeMultiplier(8)->Range(8, 1 << 15);
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <entt/entity/registry.hpp>
+
+// run with --benchmark_format=json or --benchmark_out=<file> to track regressions
+
+template<std::size_t Size>
+struct component {
+    std::uint8_t data[Size];
+};
+
+using position = component<16u>;
+using velocity = component<8u>;
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t next{}; next < threads; ++next) {
+            workers.emplace_back([&task, count, next, step = threads]() {
+                for(auto chunk = next; chunk < count; chunk += step) {
+                    task(chunk);
+                }
+            });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t threads;
+};
+
+void per_entity(benchmark::State &state, const std::size_t count, const entt::registry &registry) {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    state.counters["time/entity"] = benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    state.counters["bytes/entity"] = static_cast<double>(registry.memory_usage().total()) / static_cast<double>(count);
+}
+
+void entity_counts(benchmark::internal::Benchmark *bench) {
+    bench->RangeMultiplier(8)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMicrosecond);
+}
+
+static void Create(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    for(auto _: state) {
+        state.PauseTiming();
+        registry = entt::registry{};
+        state.ResumeTiming();
+
+        registry.create(entities.begin(), entities.end());
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK(Create)->Apply(entity_counts);
+
+template<typename Component>
+static void Insert(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+
+    for(auto _: state) {
+        state.PauseTiming();
+        registry.clear<Component>();
+        state.ResumeTiming();
+
+        registry.insert<Component>(entities.begin(), entities.end());
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK_TEMPLATE(Insert, component<4u>)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(Insert, component<64u>)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(Insert, component<256u>)->Apply(entity_counts);
+
+template<typename Component>
+static void IterateSingleComponent(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<Component>(entities.begin(), entities.end());
+
+    for(auto _: state) {
+        registry.view<Component>().each([](auto &elem) {
+            ++elem.data[0u];
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK_TEMPLATE(IterateSingleComponent, component<4u>)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(IterateSingleComponent, component<64u>)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(IterateSingleComponent, component<256u>)->Apply(entity_counts);
+
+static void IterateTwoComponentsFragmented(benchmark::State &state) {
+    // second argument: percentage of entities that miss the second component
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto holes = static_cast<std::size_t>(state.range(1));
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        if((pos * 37u) % 100u < holes) {
+            registry.remove<velocity>(entities[pos]);
+        }
+    }
+
+    for(auto _: state) {
+        registry.view<position, velocity>().each([](auto &pos, const auto &vel) {
+            pos.data[0u] += vel.data[0u];
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK(IterateTwoComponentsFragmented)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 24, 8), {0, 25, 50, 90}})->Unit(benchmark::kMicrosecond);
+
+static void ParallelIterateTwoComponents(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const thread_executor executor{static_cast<std::size_t>(state.range(1))};
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    for(auto _: state) {
+        registry.view<position, const velocity>().par_each(executor, [](auto &pos, const auto &vel) {
+            pos.data[0u] += vel.data[0u];
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK(ParallelIterateTwoComponents)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {1, 2, 4, 8}})->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void Destroy(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<entt::entity> entities(count);
+    entt::registry registry;
+
+    for(auto _: state) {
+        state.PauseTiming();
+        registry.create(entities.begin(), entities.end());
+        registry.insert<position>(entities.begin(), entities.end());
+        state.ResumeTiming();
+
+        registry.destroy(entities.begin(), entities.end());
+        benchmark::ClobberMemory();
+    }
+
+    per_entity(state, count, registry);
+}
+
+BENCHMARK(Destroy)->Apply(entity_counts);
+
+BENCHMARK_MAIN();
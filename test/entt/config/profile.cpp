@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+std::vector<std::string> zones{};
+
+#define ENTT_PROFILE_SCOPE(name) zones.emplace_back(name)
+
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/sigh.hpp>
+
+struct event {};
+
+void listener(event &) {}
+
+TEST(Profile, Registry) {
+    entt::registry registry;
+    zones.clear();
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.view<int>().each([](int &) {});
+    registry.remove<int>(entity);
+
+    ASSERT_EQ(zones.front(), entt::type_id<entt::registry>().name());
+    ASSERT_EQ(zones.back(), entt::type_id<int>().name());
+    ASSERT_NE(std::find(zones.cbegin(), zones.cend(), entt::type_id<decltype(registry.view<int>())>().name()), zones.cend());
+    ASSERT_EQ(std::count(zones.cbegin(), zones.cend(), entt::type_id<int>().name()), 2u);
+}
+
+TEST(Profile, Signal) {
+    entt::dispatcher dispatcher;
+    dispatcher.sink<event>().connect<&listener>();
+    dispatcher.enqueue<event>();
+    zones.clear();
+
+    dispatcher.update();
+
+    ASSERT_EQ(zones.size(), 3u);
+    ASSERT_EQ(zones[0u], entt::type_id<entt::dispatcher>().name());
+    ASSERT_EQ(zones[1u], entt::type_id<event>().name());
+    ASSERT_EQ(zones[2u], entt::type_id<entt::sigh<void(event &)>>().name());
+}
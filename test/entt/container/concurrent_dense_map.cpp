@@ -0,0 +1,139 @@
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/container/concurrent_dense_map.hpp>
+
+TEST(ConcurrentDenseMap, Functionalities) {
+    entt::concurrent_dense_map<int, int> map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_EQ(map.try_get(1), nullptr);
+
+    map.insert(std::make_pair(1, 2));
+    map.insert(std::make_pair(1, 3));
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_TRUE(map.contains(1));
+    ASSERT_NE(map.try_get(1), nullptr);
+    ASSERT_EQ(*map.try_get(1), 2);
+
+    map.insert_or_assign(1, 3);
+    map.insert_or_assign(4, 5);
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(*map.try_get(1), 3);
+    ASSERT_EQ(*map.try_get(4), 5);
+
+    map.erase(1);
+
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_TRUE(map.contains(4));
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(4));
+}
+
+TEST(ConcurrentDenseMap, Snapshot) {
+    entt::concurrent_dense_map<int, int> map;
+    map.insert_or_assign(1, 2);
+
+    const auto &snapshot = map.snapshot();
+    const auto *value = map.try_get(1);
+
+    map.insert_or_assign(1, 3);
+    map.insert_or_assign(4, 5);
+
+    ASSERT_NE(&snapshot, &map.snapshot());
+    ASSERT_EQ(snapshot.size(), 1u);
+    ASSERT_EQ(snapshot.at(1), 2);
+    ASSERT_EQ(*value, 2);
+
+    ASSERT_EQ(map.snapshot().size(), 2u);
+    ASSERT_EQ(map.snapshot().at(1), 3);
+}
+
+TEST(ConcurrentDenseMap, Update) {
+    entt::concurrent_dense_map<int, int> map;
+    const auto *snapshot = &map.snapshot();
+
+    map.update([](auto &elem) {
+        for(int next{}; next < 8; ++next) {
+            elem.emplace(next, next * 2);
+        }
+    });
+
+    ASSERT_TRUE(snapshot->empty());
+    ASSERT_EQ(map.size(), 8u);
+
+    for(int next{}; next < 8; ++next) {
+        ASSERT_EQ(*map.try_get(next), next * 2);
+    }
+}
+
+TEST(ConcurrentDenseMap, Reclaim) {
+    entt::concurrent_dense_map<int, int> map;
+
+    for(int next{}; next < 8; ++next) {
+        map.insert_or_assign(next, next);
+    }
+
+    map.reclaim();
+
+    ASSERT_EQ(map.size(), 8u);
+    ASSERT_EQ(*map.try_get(7), 7);
+
+    map.insert_or_assign(8, 8);
+    map.reclaim();
+
+    ASSERT_EQ(map.size(), 9u);
+    ASSERT_EQ(*map.try_get(8), 8);
+}
+
+TEST(ConcurrentDenseMap, ConcurrentReaders) {
+    static constexpr int count = 256;
+    entt::concurrent_dense_map<int, int> map;
+    std::atomic<bool> done{};
+    std::vector<std::thread> readers{};
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        readers.emplace_back([&map, &done]() {
+            while(!done.load()) {
+                const auto &snapshot = map.snapshot();
+
+                for(auto [key, value]: snapshot) {
+                    ASSERT_EQ(value, key * 2);
+                }
+
+                for(int next{}; next < static_cast<int>(snapshot.size()); ++next) {
+                    ASSERT_TRUE(snapshot.contains(next));
+                }
+            }
+        });
+    }
+
+    for(int next{}; next < count; ++next) {
+        map.insert_or_assign(next, next * 2);
+    }
+
+    done = true;
+
+    for(auto &&reader: readers) {
+        reader.join();
+    }
+
+    map.reclaim();
+
+    ASSERT_EQ(map.size(), static_cast<std::size_t>(count));
+}
@@ -0,0 +1,456 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/dense_flat_map.hpp>
+#include <entt/container/dense_map.hpp>
+#include <entt/core/utility.hpp>
+#include "../common/throwing_allocator.hpp"
+
+struct transparent_equal_to {
+    using is_transparent = void;
+
+    template<typename Type, typename Other>
+    constexpr std::enable_if_t<std::is_convertible_v<Other, Type>, bool>
+    operator()(const Type &lhs, const Other &rhs) const {
+        return lhs == static_cast<Type>(rhs);
+    }
+};
+
+struct colliding_hash {
+    std::size_t operator()(const std::size_t) const {
+        return 42u;
+    }
+};
+
+TEST(DenseFlatMap, Functionalities) {
+    entt::dense_flat_map<std::size_t, std::size_t, entt::identity, transparent_equal_to> map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.load_factor(), 0.f);
+    ASSERT_EQ(map.max_load_factor(), .875f);
+    ASSERT_EQ(map.begin(), map.end());
+
+    map.emplace(3u, 42u);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_NE(map.begin(), map.end());
+    ASSERT_EQ(map.begin()->first, 3u);
+    ASSERT_EQ(map.begin()->second, 42u);
+
+    ASSERT_TRUE(map.contains(3u));
+    ASSERT_TRUE(map.contains(3.));
+    ASSERT_FALSE(map.contains(0u));
+    ASSERT_EQ(map.find(3.), map.begin());
+    ASSERT_EQ(std::as_const(map).find(3u), map.cbegin());
+    ASSERT_EQ(map.find(0u), map.end());
+
+    ASSERT_EQ(map.hash_function()(42u), 42u);
+    ASSERT_TRUE(map.key_eq()(42u, 42u));
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_FALSE(map.contains(3u));
+}
+
+TEST(DenseFlatMap, Constructors) {
+    static constexpr std::size_t minimum_bucket_count = entt::internal::flat_index<std::allocator<int>>::minimum_capacity;
+    using allocator_type = std::allocator<std::pair<const int, int>>;
+    allocator_type allocator{};
+
+    entt::dense_flat_map<int, int> map;
+
+    ASSERT_EQ(map.bucket_count(), minimum_bucket_count);
+
+    map = entt::dense_flat_map<int, int>{allocator};
+    map = entt::dense_flat_map<int, int>{2u * minimum_bucket_count, allocator};
+    map = entt::dense_flat_map<int, int>{4u * minimum_bucket_count, std::hash<int>(), allocator};
+
+    ASSERT_EQ(map.bucket_count(), 4u * minimum_bucket_count);
+
+    map.emplace(3, 42);
+
+    entt::dense_flat_map<int, int> temp{map, allocator};
+    entt::dense_flat_map<int, int> other{std::move(temp), allocator};
+
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(other.at(3), 42);
+    ASSERT_EQ(other.bucket_count(), 4u * minimum_bucket_count);
+}
+
+TEST(DenseFlatMap, CopyMove) {
+    entt::dense_flat_map<std::size_t, std::size_t> map;
+    map.emplace(3u, 42u);
+
+    entt::dense_flat_map<std::size_t, std::size_t> other{map};
+
+    ASSERT_TRUE(map.contains(3u));
+    ASSERT_TRUE(other.contains(3u));
+
+    map.emplace(1u, 99u);
+    other = map;
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.at(1u), 99u);
+
+    entt::dense_flat_map<std::size_t, std::size_t> moved{std::move(other)};
+
+    ASSERT_EQ(moved.size(), 2u);
+    ASSERT_EQ(moved.at(3u), 42u);
+
+    map.clear();
+    map = std::move(moved);
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.at(1u), 99u);
+}
+
+TEST(DenseFlatMap, Insert) {
+    entt::dense_flat_map<int, int> map;
+    typename entt::dense_flat_map<int, int>::iterator it;
+    bool result;
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 2));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->first, 1);
+    ASSERT_EQ(it->second, 2);
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 3));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it, --map.end());
+    ASSERT_EQ(it->second, 2);
+
+    std::pair<const int, int> value{3, 4};
+    std::tie(it, result) = map.insert(value);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.find(3)->second, 4);
+
+    std::pair<int, int> range[2u]{std::make_pair(5, 6), std::make_pair(7, 8)};
+    map.insert(std::begin(range), std::end(range));
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(map.at(5), 6);
+    ASSERT_EQ(map.at(7), 8);
+}
+
+TEST(DenseFlatMap, InsertRehash) {
+    // more elements than a single group of control slots can contain
+    static constexpr std::size_t count = 1024u;
+    entt::dense_flat_map<std::size_t, std::size_t, entt::identity> map;
+    const auto minimum_bucket_count = map.bucket_count();
+
+    for(std::size_t next{}; next < count; ++next) {
+        ASSERT_TRUE(map.insert(std::make_pair(next, next)).second);
+        ASSERT_LE(map.load_factor(), map.max_load_factor());
+    }
+
+    ASSERT_EQ(map.size(), count);
+    ASSERT_GT(map.bucket_count(), minimum_bucket_count);
+
+    for(std::size_t next{}; next < count; ++next) {
+        ASSERT_TRUE(map.contains(next));
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    ASSERT_FALSE(map.contains(count));
+}
+
+TEST(DenseFlatMap, Collisions) {
+    entt::dense_flat_map<std::size_t, std::size_t, colliding_hash> map;
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        ASSERT_TRUE(map.emplace(next, next).second);
+    }
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    for(std::size_t next{}; next < 64u; next += 2u) {
+        ASSERT_EQ(map.erase(next), 1u);
+    }
+
+    ASSERT_EQ(map.size(), 32u);
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        ASSERT_EQ(map.contains(next), (next % 2u) == 1u);
+    }
+}
+
+TEST(DenseFlatMap, InsertOrAssign) {
+    entt::dense_flat_map<int, int> map;
+
+    auto [it, result] = map.insert_or_assign(1, 2);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, 2);
+
+    std::tie(it, result) = map.insert_or_assign(1, 3);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(it->second, 3);
+
+    const int key = 5;
+    std::tie(it, result) = map.insert_or_assign(key, 6);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(map.at(5), 6);
+}
+
+TEST(DenseFlatMap, Emplace) {
+    entt::dense_flat_map<int, int> map;
+
+    ASSERT_TRUE(map.emplace().second);
+    ASSERT_TRUE(map.contains(0));
+    ASSERT_TRUE(map.emplace(std::make_pair(1, 2)).second);
+    ASSERT_TRUE(map.emplace(3, 4).second);
+    ASSERT_TRUE(map.emplace(std::piecewise_construct, std::make_tuple(5), std::make_tuple(6)).second);
+    ASSERT_FALSE(map.emplace(std::piecewise_construct, std::make_tuple(5), std::make_tuple(7)).second);
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(map.at(1), 2);
+    ASSERT_EQ(map.at(3), 4);
+    ASSERT_EQ(map.at(5), 6);
+
+    for(int next{7}; next < 128; ++next) {
+        ASSERT_TRUE(map.emplace(std::piecewise_construct, std::make_tuple(next), std::make_tuple(next)).second);
+    }
+
+    for(int next{7}; next < 128; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+}
+
+TEST(DenseFlatMap, TryEmplace) {
+    entt::dense_flat_map<int, std::unique_ptr<int>> map;
+
+    ASSERT_TRUE(map.try_emplace(1, std::make_unique<int>(2)).second);
+    ASSERT_FALSE(map.try_emplace(1, std::make_unique<int>(3)).second);
+    ASSERT_EQ(*map.at(1), 2);
+
+    const int key = 4;
+
+    ASSERT_TRUE(map.try_emplace(key).second);
+    ASSERT_EQ(map.at(key), nullptr);
+}
+
+TEST(DenseFlatMap, Erase) {
+    entt::dense_flat_map<std::size_t, std::size_t> map;
+
+    for(std::size_t next{}; next < 6u; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.erase(42u), 0u);
+    ASSERT_EQ(map.erase(0u), 1u);
+    ASSERT_EQ(map.size(), 5u);
+
+    // the last element is moved in place of the erased one
+    ASSERT_EQ(map.begin()->first, 5u);
+    ASSERT_EQ(map.at(5u), 5u);
+
+    auto it = map.erase(map.begin() + 1u);
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(it, map.begin() + 1u);
+
+    it = map.erase(map.begin(), map.begin() + 2u);
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(it, map.begin());
+
+    for(auto &&elem: map) {
+        ASSERT_EQ(map.find(elem.first)->second, elem.second);
+    }
+
+    map.erase(map.cbegin(), map.cend());
+
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(DenseFlatMap, EraseReuse) {
+    // repeated insertions and deletions must not make the table grow
+    entt::dense_flat_map<std::size_t, std::size_t> map;
+    const auto bucket_count = map.bucket_count();
+
+    for(std::size_t next{}; next < 4096u; ++next) {
+        ASSERT_TRUE(map.emplace(next, next).second);
+        ASSERT_TRUE(map.emplace(next + 1u, next).second);
+        ASSERT_EQ(map.erase(next), 1u);
+        ASSERT_EQ(map.erase(next + 1u), 1u);
+    }
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.bucket_count(), bucket_count);
+}
+
+TEST(DenseFlatMap, Swap) {
+    entt::dense_flat_map<int, int> map;
+    entt::dense_flat_map<int, int> other;
+
+    map.emplace(0, 1);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_TRUE(other.empty());
+
+    map.swap(other);
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(other.at(0), 1);
+}
+
+TEST(DenseFlatMap, Indexing) {
+    entt::dense_flat_map<int, int> map;
+    const auto key = 1;
+
+    ASSERT_FALSE(map.contains(key));
+
+    map[key] = 3;
+
+    ASSERT_TRUE(map.contains(key));
+    ASSERT_EQ(map[key], 3);
+    ASSERT_EQ(map[1], 3);
+    ASSERT_EQ(std::as_const(map).at(key), 3);
+}
+
+TEST(DenseFlatMapDeathTest, Indexing) {
+    entt::dense_flat_map<int, int> map;
+
+    ASSERT_DEATH([[maybe_unused]] auto value = map.at(0), "");
+    ASSERT_DEATH([[maybe_unused]] auto value = std::as_const(map).at(42), "");
+}
+
+TEST(DenseFlatMap, FindWithHash) {
+    entt::dense_flat_map<std::size_t, std::size_t, entt::identity, transparent_equal_to> map;
+    const auto &cmap = map;
+
+    map.emplace(3u, 42u);
+    map.prefetch(3u);
+    map.prefetch(99u);
+
+    ASSERT_EQ(map.find(3u, 3u), map.begin());
+    ASSERT_EQ(cmap.find(3u, 3u), cmap.cbegin());
+    ASSERT_EQ(map.find(3., 3u), map.begin());
+    ASSERT_EQ(cmap.find(3., 3u), cmap.cbegin());
+    ASSERT_EQ(map.find(99u, 99u), map.end());
+
+    ASSERT_TRUE(map.contains(3u, 3u));
+    ASSERT_TRUE(map.contains(3., 3u));
+    ASSERT_FALSE(map.contains(99u, 99u));
+}
+
+TEST(DenseFlatMap, Rehash) {
+    entt::dense_flat_map<std::size_t, std::size_t, entt::identity> map;
+    const auto minimum_bucket_count = map.bucket_count();
+
+    for(std::size_t next{}; next < 4u; ++next) {
+        map.emplace(next, next);
+    }
+
+    map.rehash(128u);
+
+    ASSERT_EQ(map.bucket_count(), 128u);
+    ASSERT_EQ(map.size(), 4u);
+
+    for(std::size_t next{}; next < 4u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    map.rehash(0u);
+
+    ASSERT_EQ(map.bucket_count(), minimum_bucket_count);
+
+    for(std::size_t next{}; next < 4u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    map.max_load_factor(.5f);
+
+    ASSERT_EQ(map.max_load_factor(), .5f);
+    ASSERT_LE(map.load_factor(), .5f);
+
+    map.clear();
+
+    ASSERT_EQ(map.bucket_count(), minimum_bucket_count);
+}
+
+TEST(DenseFlatMap, Reserve) {
+    entt::dense_flat_map<int, int> map;
+
+    map.reserve(0u);
+
+    ASSERT_EQ(map.bucket_count(), entt::internal::flat_index<std::allocator<int>>::minimum_capacity);
+
+    map.reserve(1024u);
+
+    ASSERT_EQ(map.bucket_count(), 2048u);
+
+    for(int next{}; next < 1024; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.bucket_count(), 2048u);
+}
+
+TEST(DenseFlatMap, SameAsDenseMap) {
+    entt::dense_flat_map<std::string, std::size_t> map;
+    entt::dense_map<std::string, std::size_t> other;
+
+    for(std::size_t next{}; next < 512u; ++next) {
+        const auto key = std::to_string(next * 7u % 300u);
+        map[key] += next;
+        other[key] += next;
+
+        if(next % 3u == 0u) {
+            const auto victim = std::to_string(next % 100u);
+            ASSERT_EQ(map.erase(victim), other.erase(victim));
+        }
+    }
+
+    ASSERT_EQ(map.size(), other.size());
+
+    for(auto &&elem: other) {
+        ASSERT_EQ(map.at(elem.first), elem.second);
+    }
+}
+
+TEST(DenseFlatMap, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<std::pair<const std::size_t, std::size_t>>;
+    using index_allocator = test::throwing_allocator<std::size_t>;
+    using index_exception = typename index_allocator::exception_type;
+
+    entt::dense_flat_map<std::size_t, std::size_t, std::hash<std::size_t>, std::equal_to<std::size_t>, allocator> map{};
+
+    for(std::size_t next{}; next < map.bucket_count() * map.max_load_factor(); ++next) {
+        map.emplace(next, next);
+    }
+
+    const auto bucket_count = map.bucket_count();
+    const auto size = map.size();
+
+    index_allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW(map.emplace(size, size), index_exception);
+    ASSERT_EQ(map.bucket_count(), bucket_count);
+    ASSERT_EQ(map.size(), size);
+    ASSERT_FALSE(map.contains(size));
+
+    for(std::size_t next{}; next < size; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+}
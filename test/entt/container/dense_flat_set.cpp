@@ -0,0 +1,231 @@
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/dense_flat_set.hpp>
+#include <entt/container/dense_set.hpp>
+#include <entt/core/utility.hpp>
+
+struct transparent_equal_to {
+    using is_transparent = void;
+
+    template<typename Type, typename Other>
+    constexpr std::enable_if_t<std::is_convertible_v<Other, Type>, bool>
+    operator()(const Type &lhs, const Other &rhs) const {
+        return lhs == static_cast<Type>(rhs);
+    }
+};
+
+struct colliding_hash {
+    std::size_t operator()(const std::size_t) const {
+        return 42u;
+    }
+};
+
+TEST(DenseFlatSet, Functionalities) {
+    entt::dense_flat_set<std::size_t, entt::identity, transparent_equal_to> set;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = set.get_allocator());
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.size(), 0u);
+    ASSERT_EQ(set.load_factor(), 0.f);
+    ASSERT_EQ(set.max_load_factor(), .875f);
+    ASSERT_EQ(set.begin(), set.end());
+
+    set.emplace(42u);
+
+    ASSERT_FALSE(set.empty());
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_EQ(*set.begin(), 42u);
+
+    ASSERT_TRUE(set.contains(42u));
+    ASSERT_TRUE(set.contains(42.));
+    ASSERT_FALSE(set.contains(0u));
+    ASSERT_EQ(set.find(42.), set.begin());
+    ASSERT_EQ(std::as_const(set).find(42u), set.cbegin());
+    ASSERT_EQ(set.find(0u), set.end());
+
+    ASSERT_EQ(set.hash_function()(42u), 42u);
+    ASSERT_TRUE(set.key_eq()(42u, 42u));
+
+    set.clear();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(42u));
+}
+
+TEST(DenseFlatSet, Constructors) {
+    entt::dense_flat_set<int> set{64u};
+    set.emplace(3);
+
+    entt::dense_flat_set<int> temp{set, set.get_allocator()};
+    entt::dense_flat_set<int> other{std::move(temp), set.get_allocator()};
+
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_TRUE(other.contains(3));
+    ASSERT_EQ(other.bucket_count(), 64u);
+}
+
+TEST(DenseFlatSet, Insert) {
+    entt::dense_flat_set<int> set;
+    typename entt::dense_flat_set<int>::iterator it;
+    bool result;
+
+    std::tie(it, result) = set.insert(1);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*it, 1);
+
+    std::tie(it, result) = set.insert(1);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it, --set.end());
+
+    int range[2u]{7, 9};
+    set.insert(std::begin(range), std::end(range));
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_TRUE(set.contains(7));
+    ASSERT_TRUE(set.contains(9));
+}
+
+TEST(DenseFlatSet, InsertRehash) {
+    static constexpr std::size_t count = 1024u;
+    entt::dense_flat_set<std::size_t, entt::identity> set;
+
+    for(std::size_t next{}; next < count; ++next) {
+        ASSERT_TRUE(set.insert(next).second);
+        ASSERT_LE(set.load_factor(), set.max_load_factor());
+    }
+
+    for(std::size_t next{}; next < count; ++next) {
+        ASSERT_TRUE(set.contains(next));
+    }
+
+    ASSERT_FALSE(set.contains(count));
+}
+
+TEST(DenseFlatSet, Collisions) {
+    entt::dense_flat_set<std::size_t, colliding_hash> set;
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        ASSERT_TRUE(set.emplace(next).second);
+    }
+
+    for(std::size_t next{}; next < 64u; next += 2u) {
+        ASSERT_EQ(set.erase(next), 1u);
+    }
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        ASSERT_EQ(set.contains(next), (next % 2u) == 1u);
+    }
+}
+
+TEST(DenseFlatSet, Emplace) {
+    entt::dense_flat_set<std::string> set;
+
+    ASSERT_TRUE(set.emplace("foo").second);
+    ASSERT_TRUE(set.emplace(3u, 'a').second);
+    ASSERT_FALSE(set.emplace(std::string{"aaa"}).second);
+    ASSERT_FALSE(set.emplace("foo").second);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_TRUE(set.contains("aaa"));
+}
+
+TEST(DenseFlatSet, Erase) {
+    entt::dense_flat_set<std::size_t> set;
+
+    for(std::size_t next{}; next < 6u; ++next) {
+        set.emplace(next);
+    }
+
+    ASSERT_EQ(set.erase(42u), 0u);
+    ASSERT_EQ(set.erase(0u), 1u);
+    ASSERT_EQ(*set.begin(), 5u);
+
+    auto it = set.erase(set.begin() + 1u);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(it, set.begin() + 1u);
+
+    set.erase(set.cbegin(), set.cend());
+
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(DenseFlatSet, Swap) {
+    entt::dense_flat_set<int> set;
+    entt::dense_flat_set<int> other;
+
+    set.emplace(1);
+    set.swap(other);
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_TRUE(other.contains(1));
+}
+
+TEST(DenseFlatSet, FindWithHash) {
+    entt::dense_flat_set<std::size_t, entt::identity, transparent_equal_to> set;
+    const auto &cset = set;
+
+    set.emplace(3u);
+    set.prefetch(3u);
+    set.prefetch(99u);
+
+    ASSERT_EQ(set.find(3u, 3u), set.begin());
+    ASSERT_EQ(cset.find(3u, 3u), cset.cbegin());
+    ASSERT_EQ(set.find(3., 3u), set.begin());
+    ASSERT_EQ(cset.find(3., 3u), cset.cbegin());
+    ASSERT_EQ(set.find(99u, 99u), set.end());
+
+    ASSERT_TRUE(set.contains(3u, 3u));
+    ASSERT_TRUE(set.contains(3., 3u));
+    ASSERT_FALSE(set.contains(99u, 99u));
+}
+
+TEST(DenseFlatSet, RehashReserve) {
+    entt::dense_flat_set<std::size_t> set;
+    const auto minimum_bucket_count = set.bucket_count();
+
+    set.reserve(1024u);
+
+    ASSERT_EQ(set.bucket_count(), 2048u);
+
+    for(std::size_t next{}; next < 8u; ++next) {
+        set.emplace(next);
+    }
+
+    set.rehash(0u);
+
+    ASSERT_EQ(set.bucket_count(), minimum_bucket_count);
+
+    for(std::size_t next{}; next < 8u; ++next) {
+        ASSERT_TRUE(set.contains(next));
+    }
+}
+
+TEST(DenseFlatSet, SameAsDenseSet) {
+    entt::dense_flat_set<std::size_t> set;
+    entt::dense_set<std::size_t> other;
+
+    for(std::size_t next{}; next < 4096u; ++next) {
+        ASSERT_EQ(set.insert(next * 31u % 1000u).second, other.insert(next * 31u % 1000u).second);
+
+        if(next % 3u == 0u) {
+            ASSERT_EQ(set.erase(next % 500u), other.erase(next % 500u));
+        }
+    }
+
+    ASSERT_EQ(set.size(), other.size());
+
+    for(auto &&elem: other) {
+        ASSERT_TRUE(set.contains(elem));
+    }
+}
@@ -1,10 +1,14 @@
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/container/dense_map.hpp>
 #include <entt/core/iterator.hpp>
@@ -13,6 +17,24 @@
 #include "../common/throwing_allocator.hpp"
 #include "../common/tracked_memory_resource.hpp"
 
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) {
+        std::vector<std::thread> workers{};
+        tasks += count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back([&task, pos]() { task(pos); });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t tasks{};
+};
+
 struct transparent_equal_to {
     using is_transparent = void;
 
@@ -418,6 +440,31 @@ TEST(DenseMap, InsertRehash) {
     }
 }
 
+TEST(DenseMap, InsertRange) {
+    std::vector<std::pair<std::size_t, std::size_t>> range{};
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+
+    for(std::size_t next{}; next < 1024u; ++next) {
+        range.emplace_back(next % 1000u, next);
+    }
+
+    map.insert(range.begin(), range.end());
+
+    ASSERT_EQ(map.size(), 1000u);
+    ASSERT_EQ(map.bucket_count(), 2048u);
+
+    for(std::size_t next{}; next < 1000u; ++next) {
+        ASSERT_EQ(map.bucket(next), next);
+        ASSERT_EQ(map[next], next);
+    }
+
+    map.reserve(8192u);
+    map.insert(range.begin(), range.begin() + 1u);
+
+    ASSERT_EQ(map.size(), 1000u);
+    ASSERT_EQ(map.bucket_count(), 16384u);
+}
+
 TEST(DenseMap, InsertSameBucket) {
     static constexpr std::size_t minimum_bucket_count = 8u;
     entt::dense_map<std::size_t, std::size_t, entt::identity> map;
@@ -788,6 +835,22 @@ TEST(DenseMap, Erase) {
     ASSERT_EQ(map.size(), 0u);
 }
 
+TEST(DenseMap, EraseMovableKey) {
+    entt::dense_map<std::string, int> map;
+
+    map.emplace("foo", 0);
+    map.emplace("bar", 1);
+    map.emplace("quux", 2);
+
+    ASSERT_EQ(map.erase("foo"), 1u);
+    ASSERT_EQ(map.begin()->first, "quux");
+    ASSERT_EQ(map.at("quux"), 2);
+    ASSERT_EQ(map.erase("quux"), 1u);
+    ASSERT_EQ(map.erase("foo"), 0u);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map.at("bar"), 1);
+}
+
 TEST(DenseMap, EraseFromBucket) {
     static constexpr std::size_t minimum_bucket_count = 8u;
     entt::dense_map<std::size_t, std::size_t, entt::identity> map;
@@ -919,6 +982,31 @@ TEST(DenseMapDeathTest, Indexing) {
     ASSERT_DEATH([[maybe_unused]] auto value = map.at(42), "");
 }
 
+TEST(DenseMap, FindWithHash) {
+    entt::dense_map<std::size_t, std::size_t, entt::identity, transparent_equal_to> map;
+    const auto &cmap = map;
+
+    map.emplace(3u, 42u);
+    map.prefetch(3u);
+    map.prefetch(99u);
+
+    ASSERT_EQ(map.find(3u, 3u), map.begin());
+    ASSERT_EQ(cmap.find(3u, 3u), cmap.cbegin());
+    ASSERT_EQ(map.find(3., 3u), map.begin());
+    ASSERT_EQ(cmap.find(3., 3u), cmap.cbegin());
+    ASSERT_EQ(map.find(99u, 99u), map.end());
+
+    ASSERT_TRUE(map.contains(3u, 3u));
+    ASSERT_TRUE(map.contains(3., 3u));
+    ASSERT_FALSE(map.contains(99u, 99u));
+}
+
+TEST(DenseMapDeathTest, FindWithHash) {
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+
+    ASSERT_DEATH([[maybe_unused]] auto it = map.find(3u, 4u), "");
+}
+
 TEST(DenseMap, LocalIterator) {
     using iterator = typename entt::dense_map<std::size_t, std::size_t, entt::identity>::local_iterator;
 
@@ -1171,3 +1259,103 @@ TEST(DenseMap, ValueUsesAllocatorConstruction) {
 }
 
 #endif
+
+TEST(DenseMap, ParEach) {
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+    thread_executor executor{};
+    const auto length = std::size_t{ENTT_PACKED_PAGE} * 3u + 1u;
+
+    map.par_each(executor, [](auto, auto) { FAIL(); });
+
+    ASSERT_EQ(executor.tasks, 0u);
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        map.emplace(pos, 0u);
+    }
+
+    map.par_each(executor, [](const std::size_t key, std::size_t &value) { value = key * 2u; });
+
+    ASSERT_EQ(executor.tasks, 4u);
+
+    std::atomic<std::size_t> count{};
+
+    std::as_const(map).par_each(executor, [&count](const std::size_t key, const std::size_t &value) {
+        ASSERT_EQ(value, key * 2u);
+        count.fetch_add(1u);
+    });
+
+    ASSERT_EQ(executor.tasks, 8u);
+    ASSERT_EQ(count.load(), length);
+}
+
+TEST(DenseMap, EraseIf) {
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+
+    ASSERT_EQ(map.erase_if([](auto, auto) { return true; }), 0u);
+
+    for(std::size_t pos{}; pos < 32u; ++pos) {
+        map.emplace(pos, pos * 2u);
+    }
+
+    const auto buckets = map.bucket_count();
+
+    ASSERT_EQ(map.erase_if([](auto, auto) { return false; }), 0u);
+    ASSERT_EQ(map.size(), 32u);
+
+    ASSERT_EQ(map.erase_if([](const std::size_t key, std::size_t &value) { return (value == key * 2u) && (key % 3u); }), 21u);
+    ASSERT_EQ(map.size(), 11u);
+    ASSERT_EQ(map.bucket_count(), buckets);
+
+    std::size_t expected{};
+
+    for(auto [key, value]: map) {
+        ASSERT_EQ(key, expected);
+        ASSERT_EQ(value, key * 2u);
+        expected += 3u;
+    }
+
+    for(std::size_t pos{}; pos < 32u; ++pos) {
+        ASSERT_EQ(map.contains(pos), !(pos % 3u));
+    }
+
+    map.emplace(1u, 1u);
+
+    ASSERT_TRUE(map.contains(1u));
+    ASSERT_EQ(map.erase_if([](auto, auto) { return true; }), 12u);
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(0u));
+}
+
+TEST(DenseMap, EraseIfThrowing) {
+    struct test_exception {};
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+
+    for(std::size_t pos{}; pos < 32u; ++pos) {
+        map.emplace(pos, pos * 2u);
+    }
+
+    const auto pred = [](const std::size_t key, std::size_t &) {
+        if(key == 20u) {
+            throw test_exception{};
+        }
+
+        return (key % 2u) == 1u;
+    };
+
+    ASSERT_THROW(map.erase_if(pred), test_exception);
+
+    // odd elements before the failing one are gone, all the others are still there
+    ASSERT_EQ(map.size(), 22u);
+
+    for(std::size_t pos{}; pos < 32u; ++pos) {
+        ASSERT_EQ(map.contains(pos), !((pos % 2u) && (pos < 20u)));
+    }
+
+    for(auto [key, value]: map) {
+        ASSERT_EQ(value, key * 2u);
+    }
+
+    ASSERT_EQ(map.erase(21u), 1u);
+    ASSERT_FALSE(map.contains(21u));
+    ASSERT_EQ(map.size(), 21u);
+}
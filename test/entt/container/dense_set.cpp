@@ -1,10 +1,14 @@
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/container/dense_set.hpp>
 #include <entt/core/memory.hpp>
@@ -12,6 +16,24 @@
 #include "../common/throwing_allocator.hpp"
 #include "../common/tracked_memory_resource.hpp"
 
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) {
+        std::vector<std::thread> workers{};
+        tasks += count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back([&task, pos]() { task(pos); });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t tasks{};
+};
+
 struct transparent_equal_to {
     using is_transparent = void;
 
@@ -378,6 +400,30 @@ TEST(DenseSet, InsertRehash) {
     }
 }
 
+TEST(DenseSet, InsertRange) {
+    std::vector<std::size_t> range{};
+    entt::dense_set<std::size_t, entt::identity> set;
+
+    for(std::size_t next{}; next < 1024u; ++next) {
+        range.push_back(next % 1000u);
+    }
+
+    set.insert(range.begin(), range.end());
+
+    ASSERT_EQ(set.size(), 1000u);
+    ASSERT_EQ(set.bucket_count(), 2048u);
+
+    for(std::size_t next{}; next < 1000u; ++next) {
+        ASSERT_EQ(set.bucket(next), next);
+    }
+
+    set.reserve(8192u);
+    set.insert(range.begin(), range.begin() + 1u);
+
+    ASSERT_EQ(set.size(), 1000u);
+    ASSERT_EQ(set.bucket_count(), 16384u);
+}
+
 TEST(DenseSet, InsertSameBucket) {
     static constexpr std::size_t minimum_bucket_count = 8u;
     entt::dense_set<std::size_t, entt::identity> set;
@@ -543,6 +589,22 @@ TEST(DenseSet, Erase) {
     ASSERT_EQ(set.size(), 0u);
 }
 
+TEST(DenseSet, EraseMovableValue) {
+    entt::dense_set<std::string> set;
+
+    set.emplace("foo");
+    set.emplace("bar");
+    set.emplace("quux");
+
+    ASSERT_EQ(set.erase("foo"), 1u);
+    ASSERT_EQ(*set.begin(), "quux");
+    ASSERT_TRUE(set.contains("quux"));
+    ASSERT_EQ(set.erase("quux"), 1u);
+    ASSERT_EQ(set.erase("foo"), 0u);
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_TRUE(set.contains("bar"));
+}
+
 TEST(DenseSet, EraseFromBucket) {
     static constexpr std::size_t minimum_bucket_count = 8u;
     entt::dense_set<std::size_t, entt::identity> set;
@@ -653,6 +715,31 @@ TEST(DenseSet, Swap) {
     ASSERT_TRUE(other.contains(0));
 }
 
+TEST(DenseSet, FindWithHash) {
+    entt::dense_set<std::size_t, entt::identity, transparent_equal_to> set;
+    const auto &cset = set;
+
+    set.emplace(3u);
+    set.prefetch(3u);
+    set.prefetch(99u);
+
+    ASSERT_EQ(set.find(3u, 3u), set.begin());
+    ASSERT_EQ(cset.find(3u, 3u), cset.cbegin());
+    ASSERT_EQ(set.find(3., 3u), set.begin());
+    ASSERT_EQ(cset.find(3., 3u), cset.cbegin());
+    ASSERT_EQ(set.find(99u, 99u), set.end());
+
+    ASSERT_TRUE(set.contains(3u, 3u));
+    ASSERT_TRUE(set.contains(3., 3u));
+    ASSERT_FALSE(set.contains(99u, 99u));
+}
+
+TEST(DenseSetDeathTest, FindWithHash) {
+    entt::dense_set<std::size_t, entt::identity> set;
+
+    ASSERT_DEATH([[maybe_unused]] auto it = set.find(3u, 4u), "");
+}
+
 TEST(DenseSet, LocalIterator) {
     using iterator = typename entt::dense_set<std::size_t, entt::identity>::local_iterator;
 
@@ -868,3 +955,23 @@ TEST(DenseSet, UsesAllocatorConstruction) {
 }
 
 #endif
+
+TEST(DenseSet, ParEach) {
+    entt::dense_set<std::size_t, entt::identity> set;
+    thread_executor executor{};
+    const auto length = std::size_t{ENTT_PACKED_PAGE} * 3u + 1u;
+
+    set.par_each(executor, [](auto) { FAIL(); });
+
+    ASSERT_EQ(executor.tasks, 0u);
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        set.emplace(pos);
+    }
+
+    std::atomic<std::size_t> sum{};
+    set.par_each(executor, [&sum](const std::size_t value) { sum.fetch_add(value); });
+
+    ASSERT_EQ(executor.tasks, 4u);
+    ASSERT_EQ(sum.load(), length * (length - 1u) / 2u);
+}
@@ -0,0 +1,304 @@
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/flat_map.hpp>
+#include "../common/throwing_allocator.hpp"
+
+struct transparent_less {
+    using is_transparent = void;
+
+    template<typename Type, typename Other>
+    constexpr bool operator()(const Type &lhs, const Other &rhs) const {
+        return lhs < rhs;
+    }
+};
+
+TEST(FlatMap, Functionalities) {
+    entt::flat_map<int, int, 4u, transparent_less> map;
+    const auto &cmap = map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+    ASSERT_NO_THROW([[maybe_unused]] auto comp = map.key_comp());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.capacity(), 4u);
+    ASSERT_GT(map.max_size(), 0u);
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(cmap.begin(), cmap.end());
+
+    map.emplace(3, 30);
+    map.emplace(1, 10);
+    map.emplace(2, 20);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map.capacity(), 4u);
+
+    ASSERT_TRUE(map.contains(1));
+    ASSERT_TRUE(map.contains(2.));
+    ASSERT_FALSE(map.contains(4));
+    ASSERT_FALSE(map.contains(0.));
+
+    ASSERT_EQ(map.find(2), map.begin() + 1u);
+    ASSERT_EQ(cmap.find(2.), cmap.begin() + 1u);
+    ASSERT_EQ(map.find(4), map.end());
+    ASSERT_EQ(cmap.find(0.), cmap.end());
+
+    int expected = 1;
+
+    for(auto [key, value]: map) {
+        ASSERT_EQ(key, expected);
+        ASSERT_EQ(value, expected * 10);
+        ++expected;
+    }
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.capacity(), 4u);
+}
+
+TEST(FlatMap, Constructors) {
+    entt::flat_map<int, std::string, 2u> map{std::less<int>{}};
+
+    map.emplace(3, "foo");
+    map.emplace(1, "bar");
+
+    entt::flat_map<int, std::string, 2u> copy{map, map.get_allocator()};
+    entt::flat_map<int, std::string, 2u> other{std::move(copy), map.get_allocator()};
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.at(1), "bar");
+    ASSERT_EQ(other.at(3), "foo");
+
+    map.emplace(2, "quux");
+    other = map;
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_GT(other.capacity(), 2u);
+
+    entt::flat_map<int, std::string, 2u> moved{std::move(other)};
+
+    ASSERT_EQ(moved.size(), 3u);
+    ASSERT_EQ(moved.at(2), "quux");
+
+    other = std::move(moved);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other.begin()->second, "bar");
+}
+
+TEST(FlatMap, Insert) {
+    entt::flat_map<int, int> map;
+    typename entt::flat_map<int, int>::iterator it;
+    bool result;
+
+    std::tie(it, result) = map.insert(std::make_pair(2, 4));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->first, 2);
+    ASSERT_EQ(it->second, 4);
+
+    std::tie(it, result) = map.insert(std::make_pair(2, 5));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, 4);
+
+    const std::pair<const int, int> value{1, 2};
+    std::tie(it, result) = map.insert(value);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it, map.begin());
+
+    std::pair<const int, int> range[2u]{{5, 10}, {0, 0}};
+    map.insert(std::begin(range), std::end(range));
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(map.begin()->first, 0);
+    ASSERT_EQ((--map.end())->first, 5);
+}
+
+TEST(FlatMap, InsertOrAssign) {
+    entt::flat_map<int, int> map;
+
+    ASSERT_TRUE(map.insert_or_assign(1, 2).second);
+    ASSERT_FALSE(map.insert_or_assign(1, 3).second);
+    ASSERT_TRUE(map.insert_or_assign(0, 1).second);
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.at(1), 3);
+    ASSERT_EQ(map.begin()->first, 0);
+}
+
+TEST(FlatMap, Emplace) {
+    entt::flat_map<int, std::string> map;
+
+    ASSERT_TRUE(map.emplace().second);
+    ASSERT_TRUE(map.emplace(std::make_pair(3, "foo")).second);
+    ASSERT_TRUE(map.emplace(1, "bar").second);
+    ASSERT_TRUE(map.emplace(std::piecewise_construct, std::forward_as_tuple(2), std::forward_as_tuple(3u, 'a')).second);
+    ASSERT_FALSE(map.emplace(std::piecewise_construct, std::forward_as_tuple(2), std::forward_as_tuple(3u, 'b')).second);
+    ASSERT_FALSE(map.emplace(3, "quux").second);
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(map[0], "");
+    ASSERT_EQ(map[1], "bar");
+    ASSERT_EQ(map[2], "aaa");
+    ASSERT_EQ(map[3], "foo");
+}
+
+TEST(FlatMap, TryEmplace) {
+    entt::flat_map<int, std::string> map;
+    const int key = 2;
+
+    ASSERT_TRUE(map.try_emplace(key, 3u, 'a').second);
+    ASSERT_TRUE(map.try_emplace(1, "foo").second);
+    ASSERT_FALSE(map.try_emplace(key, "bar").second);
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.at(key), "aaa");
+    ASSERT_EQ(map.begin()->second, "foo");
+}
+
+TEST(FlatMap, Erase) {
+    entt::flat_map<int, int, 4u> map;
+
+    for(int next{}; next < 8; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.erase(42), 0u);
+    ASSERT_EQ(map.erase(0), 1u);
+    ASSERT_EQ(map.begin()->first, 1);
+
+    auto it = map.erase(map.begin() + 1u);
+
+    ASSERT_EQ(map.size(), 6u);
+    ASSERT_EQ(it->first, 3);
+    ASSERT_FALSE(map.contains(2));
+
+    it = map.erase(map.cbegin() + 1u, map.cbegin() + 3u);
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(it->first, 5);
+
+    map.erase(map.cbegin(), map.cend());
+
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(FlatMap, Indexing) {
+    entt::flat_map<int, int> map;
+    const auto key = 1;
+
+    map[key] = 42;
+    map[0] = 3;
+
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.at(key), 42);
+    ASSERT_EQ(std::as_const(map).at(0), 3);
+}
+
+TEST(FlatMapDeathTest, Indexing) {
+    entt::flat_map<int, int> map;
+    const auto &cmap = map;
+
+    ASSERT_DEATH([[maybe_unused]] auto value = cmap.at(42), "");
+    ASSERT_DEATH([[maybe_unused]] auto value = map.at(42), "");
+}
+
+TEST(FlatMap, Swap) {
+    entt::flat_map<int, int, 2u> map;
+    entt::flat_map<int, int, 2u> other;
+
+    map.emplace(0, 1);
+
+    for(int next{}; next < 4; ++next) {
+        other.emplace(next, next);
+    }
+
+    map.swap(other);
+
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(other.at(0), 1);
+
+    other.emplace(1, 2);
+    other.emplace(2, 3);
+    map.swap(other);
+
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(other.size(), 4u);
+    ASSERT_EQ(map.at(2), 3);
+    ASSERT_EQ(other.at(3), 3);
+}
+
+TEST(FlatMap, ReserveShrinkToFit) {
+    entt::flat_map<int, int, 2u> map;
+
+    map.reserve(1u);
+
+    ASSERT_EQ(map.capacity(), 2u);
+
+    map.reserve(8u);
+
+    ASSERT_EQ(map.capacity(), 8u);
+
+    map.emplace(1, 1);
+    map.emplace(0, 0);
+    map.emplace(2, 2);
+    map.shrink_to_fit();
+
+    ASSERT_EQ(map.capacity(), 3u);
+
+    map.erase(2);
+    map.shrink_to_fit();
+
+    ASSERT_EQ(map.capacity(), 2u);
+    ASSERT_EQ(map.at(0), 0);
+    ASSERT_EQ(map.at(1), 1);
+}
+
+TEST(FlatMap, InsertRandomOrder) {
+    entt::flat_map<std::size_t, std::size_t, 8u> map;
+
+    for(std::size_t next{}; next < 256u; ++next) {
+        const auto key = (next * 37u) % 256u;
+        ASSERT_TRUE(map.emplace(key, key * 2u).second);
+    }
+
+    for(std::size_t next{}; next < 256u; ++next) {
+        ASSERT_EQ((map.begin() + next)->first, next);
+        ASSERT_EQ(map.at(next), next * 2u);
+    }
+
+    ASSERT_FALSE(map.contains(256u));
+}
+
+TEST(FlatMap, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<std::pair<const std::size_t, std::size_t>>;
+    using packed_allocator = test::throwing_allocator<entt::internal::flat_map_node<std::size_t, std::size_t>>;
+    using packed_exception = typename packed_allocator::exception_type;
+
+    entt::flat_map<std::size_t, std::size_t, 2u, std::less<std::size_t>, allocator> map{};
+
+    map.emplace(0u, 0u);
+    map.emplace(1u, 1u);
+
+    packed_allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW(map.emplace(2u, 2u), packed_exception);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.capacity(), 2u);
+    ASSERT_FALSE(map.contains(2u));
+
+    ASSERT_TRUE(map.emplace(2u, 2u).second);
+    ASSERT_EQ(map.size(), 3u);
+}
@@ -0,0 +1,214 @@
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/flat_set.hpp>
+#include "../common/throwing_allocator.hpp"
+
+struct transparent_less {
+    using is_transparent = void;
+
+    template<typename Type, typename Other>
+    constexpr bool operator()(const Type &lhs, const Other &rhs) const {
+        return lhs < rhs;
+    }
+};
+
+TEST(FlatSet, Functionalities) {
+    entt::flat_set<int, 4u, transparent_less> set;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = set.get_allocator());
+    ASSERT_NO_THROW([[maybe_unused]] auto comp = set.key_comp());
+    ASSERT_NO_THROW([[maybe_unused]] auto comp = set.value_comp());
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.size(), 0u);
+    ASSERT_EQ(set.capacity(), 4u);
+    ASSERT_GT(set.max_size(), 0u);
+    ASSERT_EQ(set.begin(), set.end());
+
+    set.emplace(3);
+    set.emplace(1);
+    set.emplace(2);
+
+    ASSERT_FALSE(set.empty());
+    ASSERT_EQ(set.size(), 3u);
+
+    ASSERT_TRUE(set.contains(1));
+    ASSERT_TRUE(set.contains(2.));
+    ASSERT_FALSE(set.contains(4));
+    ASSERT_FALSE(set.contains(0.));
+
+    ASSERT_EQ(set.find(2), set.begin() + 1u);
+    ASSERT_EQ(set.find(2.), set.begin() + 1u);
+    ASSERT_EQ(set.find(4), set.end());
+
+    ASSERT_EQ(set.begin()[0u], 1);
+    ASSERT_EQ(set.begin()[1u], 2);
+    ASSERT_EQ(set.begin()[2u], 3);
+
+    set.clear();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.capacity(), 4u);
+}
+
+TEST(FlatSet, Constructors) {
+    entt::flat_set<std::string, 2u> set{std::less<std::string>{}};
+
+    set.emplace("foo");
+    set.emplace("bar");
+
+    entt::flat_set<std::string, 2u> copy{set, set.get_allocator()};
+    entt::flat_set<std::string, 2u> other{std::move(copy), set.get_allocator()};
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(*other.begin(), "bar");
+
+    set.emplace("quux");
+    other = set;
+
+    ASSERT_EQ(other.size(), 3u);
+
+    entt::flat_set<std::string, 2u> moved{std::move(other)};
+
+    ASSERT_EQ(moved.size(), 3u);
+    ASSERT_TRUE(moved.contains("quux"));
+}
+
+TEST(FlatSet, Insert) {
+    entt::flat_set<int> set;
+    typename entt::flat_set<int>::iterator it;
+    bool result;
+
+    std::tie(it, result) = set.insert(2);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*it, 2);
+
+    std::tie(it, result) = set.insert(2);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it, set.begin());
+
+    const int value = 1;
+    std::tie(it, result) = set.insert(value);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it, set.begin());
+
+    int range[2u]{5, 0};
+    set.insert(std::begin(range), std::end(range));
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(*set.begin(), 0);
+    ASSERT_EQ(*(set.end() - 1u), 5);
+}
+
+TEST(FlatSet, Emplace) {
+    entt::flat_set<std::string> set;
+
+    ASSERT_TRUE(set.emplace().second);
+    ASSERT_TRUE(set.emplace("foo").second);
+    ASSERT_TRUE(set.emplace(3u, 'a').second);
+    ASSERT_FALSE(set.emplace(std::string{"aaa"}).second);
+    ASSERT_FALSE(set.emplace("foo").second);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.begin()[0u], "");
+    ASSERT_EQ(set.begin()[1u], "aaa");
+    ASSERT_EQ(set.begin()[2u], "foo");
+}
+
+TEST(FlatSet, Erase) {
+    entt::flat_set<int, 4u> set;
+
+    for(int next{}; next < 8; ++next) {
+        set.emplace(next);
+    }
+
+    ASSERT_EQ(set.erase(42), 0u);
+    ASSERT_EQ(set.erase(0), 1u);
+    ASSERT_EQ(*set.begin(), 1);
+
+    auto it = set.erase(set.begin() + 1u);
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_EQ(*it, 3);
+
+    it = set.erase(set.cbegin() + 1u, set.cbegin() + 3u);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(*it, 5);
+
+    set.erase(set.cbegin(), set.cend());
+
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(FlatSet, Swap) {
+    entt::flat_set<int, 2u> set;
+    entt::flat_set<int, 2u> other;
+
+    set.emplace(0);
+
+    for(int next{}; next < 4; ++next) {
+        other.emplace(next);
+    }
+
+    set.swap(other);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_TRUE(other.contains(0));
+    ASSERT_TRUE(set.contains(3));
+}
+
+TEST(FlatSet, ReserveShrinkToFit) {
+    entt::flat_set<int, 2u> set;
+
+    set.reserve(8u);
+
+    ASSERT_EQ(set.capacity(), 8u);
+
+    set.emplace(1);
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.capacity(), 2u);
+    ASSERT_TRUE(set.contains(1));
+}
+
+TEST(FlatSet, InsertRandomOrder) {
+    entt::flat_set<std::size_t, 8u> set;
+
+    for(std::size_t next{}; next < 256u; ++next) {
+        ASSERT_TRUE(set.insert((next * 37u) % 256u).second);
+    }
+
+    for(std::size_t next{}; next < 256u; ++next) {
+        ASSERT_EQ(set.begin()[next], next);
+        ASSERT_TRUE(set.contains(next));
+    }
+
+    ASSERT_FALSE(set.contains(256u));
+}
+
+TEST(FlatSet, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<std::size_t>;
+    using exception = typename allocator::exception_type;
+
+    entt::flat_set<std::size_t, 2u, std::less<std::size_t>, allocator> set{};
+
+    set.emplace(0u);
+    set.emplace(1u);
+
+    allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW(set.emplace(2u), exception);
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_FALSE(set.contains(2u));
+}
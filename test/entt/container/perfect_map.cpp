@@ -0,0 +1,85 @@
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/perfect_map.hpp>
+#include <entt/core/hashed_string.hpp>
+
+TEST(PerfectMap, Functionalities) {
+    using namespace entt::literals;
+
+    constexpr entt::perfect_map map{std::pair{"foo"_hs, 0}, std::pair{"bar"_hs, 1}, std::pair{"quux"_hs, 2}};
+
+    static_assert(std::is_same_v<decltype(map), const entt::perfect_map<int, 3u>>);
+    static_assert(map.size() == 3u);
+    static_assert(!map.empty());
+    static_assert(map.contains("bar"_hs));
+    static_assert(!map.contains("baz"_hs));
+    static_assert(map.at("quux"_hs) == 2);
+
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map.count("foo"_hs), 1u);
+    ASSERT_EQ(map.count("baz"_hs), 0u);
+    ASSERT_EQ(map.find("baz"_hs), map.end());
+    ASSERT_EQ(map.find("foo"_hs), map.begin());
+    ASSERT_EQ(map.find("bar"_hs)->second, 1);
+    ASSERT_EQ(std::distance(map.begin(), map.end()), 3);
+
+    int value{};
+
+    for(auto [key, elem]: map) {
+        ASSERT_EQ(map.at(key), elem);
+        ASSERT_EQ(elem, value++);
+    }
+}
+
+TEST(PerfectMap, Empty) {
+    constexpr entt::perfect_map<int, 0u> map{};
+
+    static_assert(map.empty());
+
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_FALSE(map.contains(0u));
+    ASSERT_EQ(map.find(42u), map.cend());
+}
+
+TEST(PerfectMap, Duplicates) {
+    const entt::perfect_map map{std::pair{3u, 'a'}, std::pair{1u, 'b'}, std::pair{3u, 'c'}};
+
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map.at(3u), 'a');
+    ASSERT_EQ(map.at(1u), 'b');
+    ASSERT_EQ(map.find(3u), map.begin());
+}
+
+template<std::size_t... Index>
+auto make_map(std::index_sequence<Index...>) {
+    return entt::perfect_map{std::pair{static_cast<entt::id_type>(Index * 7919u), Index}...};
+}
+
+TEST(PerfectMap, Many) {
+    const auto map = make_map(std::make_index_sequence<256u>{});
+
+    for(std::size_t pos{}; pos < map.size(); ++pos) {
+        ASSERT_EQ(map.at(static_cast<entt::id_type>(pos * 7919u)), pos);
+        ASSERT_FALSE(map.contains(static_cast<entt::id_type>(pos * 7919u + 1u)));
+    }
+}
+
+TEST(PerfectMap, NonLiteralType) {
+    struct counter {
+        counter(int value)
+            : count{value} {}
+
+        ~counter() {}
+
+        int count;
+    };
+
+    const entt::perfect_map map{std::pair{1u, counter{1}}, std::pair{2u, counter{2}}};
+
+    ASSERT_EQ(map.at(1u).count, 1);
+    ASSERT_EQ(map.at(2u).count, 2);
+}
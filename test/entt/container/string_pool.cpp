@@ -0,0 +1,152 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/string_pool.hpp>
+#include <entt/core/hashed_string.hpp>
+#include "../common/throwing_allocator.hpp"
+
+TEST(StringPool, Functionalities) {
+    using namespace entt::literals;
+
+    entt::string_pool pool;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = pool.get_allocator());
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_FALSE(pool.contains("foo"_hs));
+
+    std::string str{"foo"};
+    auto [hs, usable] = pool.insert(str);
+
+    ASSERT_TRUE(usable);
+    ASSERT_EQ(hs, "foo"_hs);
+    ASSERT_NE(hs.data(), str.data());
+    ASSERT_STREQ(hs.data(), "foo");
+    ASSERT_EQ(hs.size(), 3u);
+
+    str = "bar";
+
+    ASSERT_STREQ(hs.data(), "foo");
+    ASSERT_FALSE(pool.empty());
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_TRUE(pool.contains("foo"_hs));
+
+    const auto other = pool.insert("foo", 3u);
+
+    ASSERT_TRUE(other.second);
+    ASSERT_EQ(other.first.data(), hs.data());
+    ASSERT_EQ(pool.size(), 1u);
+
+    ASSERT_TRUE(pool.insert(str).second);
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.at("bar"_hs), "bar"_hs);
+    ASSERT_STREQ(pool.at("bar"_hs).data(), "bar");
+    ASSERT_EQ(pool.at("foo"_hs).data(), hs.data());
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.contains("foo"_hs));
+}
+
+TEST(StringPool, Collision) {
+    // a well known pair of strings that collide with 32 bit FNV-1a
+    entt::string_pool pool;
+    const auto lhs = entt::hashed_string::value("costarring", 10u);
+    const auto rhs = entt::hashed_string::value("liquid", 6u);
+
+    if(lhs != rhs) {
+        GTEST_SKIP() << "No collision with this identifier type";
+    }
+
+    ASSERT_TRUE(pool.insert("costarring").second);
+
+    const auto [hs, usable] = pool.insert("liquid");
+
+    ASSERT_FALSE(usable);
+    ASSERT_STREQ(hs.data(), "costarring");
+    ASSERT_EQ(pool.size(), 1u);
+}
+
+TEST(StringPoolDeathTest, At) {
+    using namespace entt::literals;
+
+    entt::string_pool pool;
+
+    ASSERT_DEATH([[maybe_unused]] auto hs = pool.at("foo"_hs), "");
+}
+
+TEST(StringPool, StablePointers) {
+    entt::string_pool pool{8u};
+    const char *ptr[64u]{};
+
+    ASSERT_TRUE(pool.insert(std::string(32u, 'x')).second);
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        const auto str = std::to_string(next);
+        ptr[next] = pool.insert(str).first.data();
+    }
+
+    ASSERT_TRUE(pool.insert(std::string(16u, 'y')).second);
+    ASSERT_EQ(pool.size(), 66u);
+
+    for(std::size_t next{}; next < 64u; ++next) {
+        const auto str = std::to_string(next);
+        const auto hs = pool.at(entt::hashed_string::value(str.data(), str.size()));
+
+        ASSERT_EQ(hs.data(), ptr[next]);
+        ASSERT_STREQ(hs.data(), str.c_str());
+    }
+
+    ASSERT_EQ(std::string_view{pool.at(entt::hashed_string::value(std::string(32u, 'x').c_str())).data()}, std::string(32u, 'x'));
+}
+
+TEST(StringPool, Move) {
+    using namespace entt::literals;
+
+    entt::string_pool pool;
+    const auto *ptr = pool.insert("foo").first.data();
+
+    entt::string_pool other{std::move(pool)};
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(other.at("foo"_hs).data(), ptr);
+
+    pool = std::move(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(pool.at("foo"_hs).data(), ptr);
+
+    ASSERT_TRUE(other.insert("bar").second);
+    ASSERT_TRUE(other.contains("bar"_hs));
+}
+
+TEST(StringPool, WideCharacters) {
+    using namespace entt::literals;
+
+    entt::wstring_pool pool;
+    const auto hs = pool.insert(L"foo").first;
+
+    ASSERT_EQ(hs, L"foo"_hws);
+    ASSERT_EQ(pool.at(L"foo"_hws).data(), hs.data());
+}
+
+TEST(StringPool, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<char>;
+    using exception = typename allocator::exception_type;
+    using namespace entt::literals;
+
+    entt::basic_string_pool<char, allocator> pool{};
+
+    allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW(pool.insert("foo"), exception);
+    ASSERT_TRUE(pool.empty());
+
+    ASSERT_TRUE(pool.insert("foo").second);
+    ASSERT_TRUE(pool.contains("foo"_hs));
+}
@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include <entt/core/utility.hpp>
 
 struct boxed_int {
     int value;
@@ -64,6 +67,36 @@ TEST(Algorithm, InsertionSortEmptyContainer) {
     sort(vec.begin(), vec.end());
 }
 
+TEST(Algorithm, ParallelSort) {
+    std::vector<int> vec{};
+    entt::parallel_sort sort{4u};
+
+    for(int pos{}; pos < 10000; ++pos) {
+        vec.push_back((pos * 7919) % 10007);
+    }
+
+    sort(vec.begin(), vec.end());
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+
+    entt::parallel_sort{}(vec.rbegin(), vec.rend(), std::less<>{});
+
+    ASSERT_TRUE(std::is_sorted(vec.rbegin(), vec.rend()));
+}
+
+TEST(Algorithm, ParallelSortSmallRange) {
+    std::array<int, 5> arr{{4, 1, 3, 2, 0}};
+    std::vector<int> vec{};
+    entt::parallel_sort sort{0u};
+
+    sort(arr.begin(), arr.end());
+    sort(vec.begin(), vec.end());
+
+    for(auto i = 0u; i < (arr.size() - 1u); ++i) {
+        ASSERT_LT(arr[i], arr[i + 1u]);
+    }
+}
+
 TEST(Algorithm, RadixSort) {
     std::array<uint32_t, 5> arr{{4, 1, 3, 2, 0}};
     entt::radix_sort<8, 32> sort;
@@ -90,6 +123,31 @@ TEST(Algorithm, RadixSortBoxedInt) {
     }
 }
 
+TEST(Algorithm, RadixSortScratchBuffer) {
+    std::vector<uint32_t> vec{};
+    std::vector<uint32_t> aux{};
+    entt::radix_sort<8, 32> sort;
+
+    for(uint32_t pos{}; pos < 1024u; ++pos) {
+        vec.push_back((pos * 2654435761u) ^ (pos << 24u));
+    }
+
+    sort(vec.begin(), vec.end(), entt::identity{}, aux);
+
+    ASSERT_EQ(aux.size(), vec.size());
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+
+    // the high byte is the same for all elements, that pass is skipped
+    for(auto &&value: vec) {
+        value = (value & 0xFFFFFFu) | 0xAB000000u;
+    }
+
+    std::reverse(vec.begin(), vec.end());
+    sort(vec.begin(), vec.end(), entt::identity{}, aux);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
+
 TEST(Algorithm, RadixSortEmptyContainer) {
     std::vector<int> vec{};
     entt::radix_sort<8, 32> sort;
@@ -2,6 +2,8 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -9,6 +11,8 @@
 #include <gtest/gtest.h>
 #include <entt/core/any.hpp>
 #include <entt/core/type_info.hpp>
+#include "../common/throwing_allocator.hpp"
+#include "../common/tracked_memory_resource.hpp"
 
 struct empty {
     ~empty() {
@@ -1463,3 +1467,136 @@ TEST_F(Any, DeducedArrayType) {
     ASSERT_EQ(any.type(), entt::type_id<const char *>());
     ASSERT_EQ((std::strcmp("another array of char", entt::any_cast<const char *>(any))), 0);
 }
+
+TEST_F(Any, TriviallyCopyable) {
+    struct trivial {
+        int value;
+    };
+
+    static_assert(std::is_trivially_copyable_v<trivial>);
+
+    entt::any any{trivial{42}};
+    entt::any copy{any};
+    entt::any ref = any.as_ref();
+
+    entt::any_cast<trivial &>(copy).value = 3;
+
+    ASSERT_NE(copy.data(), any.data());
+    ASSERT_EQ(entt::any_cast<trivial &>(any).value, 42);
+    ASSERT_EQ(entt::any_cast<trivial &>(copy).value, 3);
+
+    entt::any move{std::move(copy)};
+    copy = ref;
+
+    ASSERT_TRUE(move.owner());
+    ASSERT_TRUE(copy.owner());
+    ASSERT_EQ(entt::any_cast<trivial &>(move).value, 3);
+    ASSERT_EQ(entt::any_cast<trivial &>(copy).value, 42);
+
+    ref = std::move(move);
+
+    ASSERT_TRUE(ref.owner());
+    ASSERT_EQ(entt::any_cast<trivial &>(ref).value, 3);
+    ASSERT_EQ(ref.type(), entt::type_id<trivial>());
+
+    ref.reset();
+    copy = ref;
+
+    ASSERT_FALSE(ref);
+    ASSERT_FALSE(copy);
+}
+
+TEST_F(Any, Allocator) {
+    std::allocator<int> allocator{};
+    entt::any any{std::allocator_arg, allocator, std::in_place_type<fat>, .1, .2, .3, .4};
+    entt::any in_situ = entt::allocate_any<int>(allocator, 42);
+
+    ASSERT_TRUE(any);
+    ASSERT_TRUE(any.owner());
+    ASSERT_EQ(any.type(), entt::type_id<fat>());
+    ASSERT_EQ(entt::any_cast<fat &>(any), (fat{.1, .2, .3, .4}));
+    ASSERT_EQ(entt::any_cast<int>(in_situ), 42);
+
+    entt::any copy{any};
+    entt::any ref = any.as_ref();
+    entt::any other{std::move(copy)};
+
+    ASSERT_EQ(other, any);
+    ASSERT_NE(other.data(), any.data());
+    ASSERT_EQ(ref.data(), any.data());
+    ASSERT_FALSE(ref.owner());
+
+    entt::any from_ref{ref};
+
+    ASSERT_TRUE(from_ref.owner());
+    ASSERT_EQ(from_ref, any);
+
+    any = entt::allocate_any<std::string>(allocator, 3u, 'a');
+
+    ASSERT_EQ(entt::any_cast<const std::string &>(any), "aaa");
+
+    any.reset();
+
+    ASSERT_FALSE(any);
+    ASSERT_EQ(entt::any_cast<fat &>(other), (fat{.1, .2, .3, .4}));
+}
+
+TEST_F(Any, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<fat>;
+    using node_allocator = test::throwing_allocator<entt::internal::basic_any_node<fat, allocator>>;
+    using exception = typename node_allocator::exception_type;
+
+    entt::any any{};
+    node_allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW(any = entt::allocate_any<fat>(allocator{}, .1, .2, .3, .4), exception);
+    ASSERT_FALSE(any);
+
+    any = entt::allocate_any<fat>(allocator{}, .1, .2, .3, .4);
+    node_allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW([[maybe_unused]] entt::any copy{any}, exception);
+    ASSERT_EQ(entt::any_cast<const fat &>(any), (fat{.1, .2, .3, .4}));
+
+    test::throwing_allocator<int>::trigger_on_allocate = true;
+
+    // objects that fit the internal storage never use the allocator
+    ASSERT_NO_THROW(any = entt::allocate_any<int>(test::throwing_allocator<int>{}, 42));
+    ASSERT_EQ(entt::any_cast<int>(any), 42);
+
+    test::throwing_allocator<int>::trigger_on_allocate = false;
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TEST_F(Any, MemoryResource) {
+    test::tracked_memory_resource memory_resource{};
+    std::pmr::polymorphic_allocator<fat> allocator{&memory_resource};
+
+    entt::any any = entt::allocate_any<fat>(allocator, .1, .2, .3, .4);
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    // polymorphic allocators don't propagate on copy construction
+    entt::any copy{any};
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    entt::any ref{std::allocator_arg, allocator, std::in_place_type<fat &>, entt::any_cast<fat &>(any)};
+    entt::any move{std::move(any)};
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+    ASSERT_EQ(ref.data(), move.data());
+
+    any = move;
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    move.reset();
+    any.reset();
+
+    ASSERT_EQ(memory_resource.do_deallocate_counter(), 1u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+}
+
+#endif
@@ -1,4 +1,6 @@
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -222,3 +224,45 @@ TEST(HashedWString, Constexprness) {
     static_assert(entt::hashed_wstring{L"foo"} > L"bar"_hws);
     static_assert(entt::hashed_wstring{L"foo"} >= L"foo"_hws);
 }
+
+TEST(RuntimeHash, Functionalities) {
+    using hash_type = entt::runtime_hash::hash_type;
+
+    const std::string str{"foobar"};
+    const entt::runtime_hash hash{};
+
+    static_assert(std::is_same_v<decltype(hash(str)), hash_type>);
+
+    ASSERT_EQ(hash(str), hash(str.data(), str.size()));
+    ASSERT_EQ(hash(str), hash(std::string_view{"foobar"}));
+    ASSERT_NE(hash(str), hash(str.data(), str.size(), 42u));
+    ASSERT_NE(hash(str), hash(std::string_view{str.data(), 3u}));
+}
+
+TEST(RuntimeHash, Correctness) {
+    const std::string_view str[]{"", "a", "abc", "Nobody inspects the spammish repetition"};
+    const std::uint64_t expected[]{0xef46db3751d8e999ull, 0xd24ec4f1a98c6e5bull, 0x44bc2cf5ad770999ull, 0xfbcea83c8a378bf1ull};
+
+    for(std::size_t pos{}; pos < std::size(str); ++pos) {
+        ASSERT_EQ(entt::runtime_hash{}(str[pos]), static_cast<entt::id_type>(expected[pos]));
+    }
+}
+
+TEST(RuntimeHash, LongStrings) {
+    const std::string str(1024u, 'a');
+    const entt::runtime_hash hash{};
+
+    ASSERT_EQ(hash(str), hash(std::string(1024u, 'a')));
+
+    for(std::size_t len = 1u; len < 64u; ++len) {
+        ASSERT_NE(hash(str.data(), len), hash(str.data(), len - 1u));
+    }
+}
+
+TEST(RuntimeWHash, Functionalities) {
+    const std::wstring str{L"foobar"};
+    const entt::runtime_whash hash{};
+
+    ASSERT_EQ(hash(str), hash(str.data(), str.size()));
+    ASSERT_NE(hash(str), hash(std::wstring_view{str.data(), 3u}));
+}
@@ -1,5 +1,6 @@
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <tuple>
@@ -70,6 +71,63 @@ TEST(FastMod, Functionalities) {
     ASSERT_EQ(entt::fast_mod(8u, 8u), 0u);
 }
 
+TEST(ElementsPerPage, Functionalities) {
+    // constexpr-ness guaranteed
+    constexpr auto elements_of_small_page = entt::elements_per_page(4u, 16u);
+
+    ASSERT_EQ(elements_of_small_page, 4u);
+    ASSERT_EQ(entt::elements_per_page(16u, 65536u), 4096u);
+    ASSERT_EQ(entt::elements_per_page(24u, 65536u), 2048u);
+    ASSERT_EQ(entt::elements_per_page(128u, 64u), 1u);
+}
+
+TEST(HugePageAllocator, Functionalities) {
+    constexpr auto huge_page_size = entt::huge_page_allocator<int>::huge_page_size;
+    entt::huge_page_allocator<int> allocator{};
+    entt::huge_page_allocator<char> other{allocator};
+
+    ASSERT_TRUE(allocator == other);
+    ASSERT_FALSE(allocator != other);
+
+    auto *small = allocator.allocate(4u);
+    auto *large = allocator.allocate(huge_page_size / sizeof(int));
+
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % huge_page_size, 0u);
+
+    large[0u] = 1;
+    large[huge_page_size / sizeof(int) - 1u] = 2;
+
+    allocator.deallocate(large, huge_page_size / sizeof(int));
+    allocator.deallocate(small, 4u);
+
+    std::vector<int, entt::huge_page_allocator<int>> vec(huge_page_size / sizeof(int), 42);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % huge_page_size, 0u);
+    ASSERT_EQ(vec.back(), 42);
+}
+
+TEST(AlignedAllocator, Functionalities) {
+    entt::aligned_allocator<int, 256u> allocator{};
+    entt::aligned_allocator<char, 64u> other{allocator};
+
+    ASSERT_TRUE(allocator == other);
+    ASSERT_FALSE(allocator != other);
+
+    auto *value = allocator.allocate(3u);
+
+    ASSERT_NE(value, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(value) % 256u, 0u);
+
+    allocator.deallocate(value, 3u);
+
+    std::vector<int, entt::aligned_allocator<int, 256u>> vec(42u, 3);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 256u, 0u);
+    ASSERT_EQ(vec.back(), 3);
+}
+
 TEST(AllocateUnique, Functionalities) {
     test::throwing_allocator<test::throwing_type> allocator{};
     test::throwing_allocator<test::throwing_type>::trigger_on_allocate = true;
@@ -1,3 +1,6 @@
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -21,6 +24,27 @@ TEST(TypeIndex, Functionalities) {
     ASSERT_EQ(static_cast<entt::id_type>(entt::type_index<int>{}), entt::type_index<int>::value());
 }
 
+TEST(TypeIndex, Reserve) {
+    struct first {};
+    struct second {};
+
+    entt::type_index_registry::reserve<first, second, int>();
+
+    ASSERT_EQ(entt::type_index<second>::value(), entt::type_index<first>::value() + 1u);
+    ASSERT_EQ(entt::type_id<first>().index(), entt::type_index<first>::value());
+    ASSERT_EQ(entt::type_id<second>().index(), entt::type_index<second>::value());
+    ASSERT_EQ(entt::type_id<int>().index(), entt::type_index<int>::value());
+}
+
+template<>
+struct entt::static_type_index<double>: entt::type_list_index<double, entt::type_list<char, double>> {};
+
+TEST(StaticTypeIndex, Functionalities) {
+    static_assert(!entt::has_static_type_index_v<int>);
+    static_assert(entt::has_static_type_index_v<double>);
+    static_assert(entt::static_type_index<double>::value == 1u);
+}
+
 TEST(TypeHash, Functionalities) {
     ASSERT_NE(entt::type_hash<int>::value(), entt::type_hash<const int>::value());
     ASSERT_NE(entt::type_hash<int>::value(), entt::type_hash<char>::value());
@@ -104,3 +128,30 @@ TEST(TypeInfo, Order) {
     ASSERT_GT(lhs, rhs);
     ASSERT_GE(lhs, rhs);
 }
+
+TEST(TypeLayout, Functionalities) {
+    const auto &layout = entt::type_layout_of<std::unique_ptr<int>>();
+    alignas(std::unique_ptr<int>) std::byte buffer[2u][sizeof(std::unique_ptr<int>)];
+
+    ASSERT_EQ(&layout, &entt::type_layout_of<std::unique_ptr<int>>());
+    ASSERT_EQ(*layout.info, entt::type_id<std::unique_ptr<int>>());
+    ASSERT_EQ(layout.size, sizeof(std::unique_ptr<int>));
+    ASSERT_EQ(layout.alignment, alignof(std::unique_ptr<int>));
+    ASSERT_EQ(layout.copy, nullptr);
+
+    layout.construct(buffer[0u]);
+    auto *elem = std::launder(reinterpret_cast<std::unique_ptr<int> *>(buffer[0u]));
+
+    ASSERT_EQ(*elem, nullptr);
+
+    elem->reset(new int{42});
+    layout.move(buffer[1u], elem);
+    layout.destroy(elem);
+    elem = std::launder(reinterpret_cast<std::unique_ptr<int> *>(buffer[1u]));
+
+    ASSERT_EQ(**elem, 42);
+
+    layout.destroy(elem);
+
+    ASSERT_NE(entt::type_layout_of<int>().copy, nullptr);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <entt/entity/cached_view.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+TEST(CachedView, Functionalities) {
+    entt::registry registry;
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<int>(e0, 0);
+    registry.emplace<char>(e0, 'a');
+    registry.emplace<int>(e1, 1);
+
+    entt::cached_view<entt::get_t<int, const char>, entt::exclude_t<double>> view{registry};
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+
+    registry.emplace<char>(e1, 'b');
+    registry.emplace<char>(e2, 'c');
+
+    ASSERT_EQ(view.size(), 2u);
+    ASSERT_TRUE(view.contains(e1));
+    ASSERT_FALSE(view.contains(e2));
+
+    registry.emplace<double>(e0, 0.);
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_FALSE(view.contains(e0));
+
+    registry.remove<double>(e0);
+
+    ASSERT_EQ(view.size(), 2u);
+    ASSERT_TRUE(view.contains(e0));
+
+    registry.remove<char>(e1);
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_FALSE(view.contains(e1));
+    ASSERT_EQ(*view.begin(), e0);
+    ASSERT_EQ(view.get<int>(e0), 0);
+    ASSERT_EQ(view.get<const char>(e0), 'a');
+
+    static_assert(std::is_same_v<decltype(view.get<int, const char>(e0)), std::tuple<int &, const char &>>);
+
+    registry.destroy(e0);
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.begin(), view.end());
+}
+
+TEST(CachedView, Each) {
+    entt::registry registry;
+    entt::cached_view<entt::get_t<int, empty_type>> view{registry};
+
+    for(int value{}; value < 4; ++value) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, value);
+
+        if(value % 2) {
+            registry.emplace<empty_type>(entt);
+        }
+    }
+
+    int sum{};
+    view.each([&sum](const auto entt, int &value) { sum += value; value = static_cast<int>(entt::to_integral(entt)); });
+
+    ASSERT_EQ(sum, 4);
+
+    view.each([&registry](int &value) { ASSERT_EQ(registry.get<int>(static_cast<entt::entity>(value)), value); });
+}
+
+TEST(CachedView, Lifetime) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    {
+        entt::cached_view<entt::get_t<int>> view{registry};
+        registry.emplace<int>(entity);
+
+        ASSERT_TRUE(view.contains(entity));
+    }
+
+    ASSERT_TRUE(registry.on_construct<int>().empty());
+    ASSERT_TRUE(registry.on_destroy<int>().empty());
+}
+
+TEST(CachedView, Refresh) {
+    entt::registry registry;
+    entt::cached_view<entt::get_t<int>> view{registry};
+    registry.emplace<int>(registry.create());
+
+    ASSERT_EQ(view.size(), 1u);
+
+    registry.storage<int>().reset();
+
+    ASSERT_EQ(view.size(), 1u);
+
+    view.refresh();
+
+    ASSERT_TRUE(view.empty());
+}
@@ -0,0 +1,263 @@
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct parent_type {
+    entt::entity value;
+};
+
+struct throwing_type {
+    throwing_type(int value)
+        : data{value} {}
+
+    throwing_type(throwing_type &&other)
+        : data{other.data} {
+        if(data == trigger_on_move) {
+            throw std::exception{};
+        }
+    }
+
+    throwing_type &operator=(throwing_type &&other) {
+        throwing_type tmp{std::move(other)};
+        data = tmp.data;
+        return *this;
+    }
+
+    static constexpr auto trigger_on_move = 42;
+
+    int data;
+};
+
+TEST(CommandBuffer, Functionalities) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.size(), 0u);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 0);
+
+    const auto other = buffer.create();
+    buffer.emplace<int>(other, 42);
+    buffer.emplace<char>(other, 'c');
+    buffer.emplace<empty_type>(other);
+    buffer.emplace<int>(entity, 3);
+    buffer.remove<int>(entity);
+    buffer.emplace<std::string>(entity, "foobar");
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_EQ(buffer.size(), 7u);
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_EQ(registry.get<int>(entity), 0);
+
+    buffer.flush(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(registry.alive(), 2u);
+    ASSERT_FALSE(registry.all_of<int>(entity));
+    ASSERT_EQ(registry.get<std::string>(entity), "foobar");
+
+    registry.view<int, char, empty_type>().each([](const int value, const char elem) {
+        ASSERT_EQ(value, 42);
+        ASSERT_EQ(elem, 'c');
+    });
+
+    ASSERT_EQ(registry.view<int>().size(), 1u);
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.alive(), 2u);
+}
+
+TEST(CommandBuffer, Destroy) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    std::array<entt::entity, 3u> entities{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+
+    const auto entity = buffer.create();
+    buffer.emplace<int>(entity);
+    buffer.destroy(entities[0u]);
+    buffer.destroy(entity);
+    buffer.destroy(entities[2u]);
+    buffer.emplace<char>(entities[1u]);
+    buffer.flush(registry);
+
+    ASSERT_FALSE(registry.valid(entities[0u]));
+    ASSERT_TRUE(registry.valid(entities[1u]));
+    ASSERT_FALSE(registry.valid(entities[2u]));
+    ASSERT_EQ(registry.alive(), 1u);
+    ASSERT_EQ(registry.storage<int>().size(), 1u);
+    ASSERT_TRUE((registry.all_of<int, char>(entities[1u])));
+}
+
+TEST(CommandBuffer, Clear) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    auto value = std::make_shared<int>(42);
+
+    buffer.emplace<std::shared_ptr<int>>(buffer.create(), value);
+
+    ASSERT_EQ(value.use_count(), 2);
+
+    buffer.clear();
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(value.use_count(), 1);
+
+    buffer.emplace<std::shared_ptr<int>>(buffer.create(), value);
+
+    {
+        entt::command_buffer other{std::move(buffer)};
+
+        ASSERT_TRUE(buffer.empty());
+        ASSERT_EQ(other.size(), 2u);
+        ASSERT_EQ(value.use_count(), 2);
+
+        buffer = std::move(other);
+    }
+
+    ASSERT_EQ(value.use_count(), 2);
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(value.use_count(), 2);
+    ASSERT_EQ(registry.view<std::shared_ptr<int>>().size(), 1u);
+
+    registry.clear();
+
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(CommandBuffer, LargePayload) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    for(auto pos = 0; pos < 1024; ++pos) {
+        buffer.emplace<std::array<int, 256u>>(buffer.create());
+        buffer.emplace<int>(buffer.create(), pos);
+    }
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.alive(), 2048u);
+    ASSERT_EQ(registry.storage<int>().size(), 1024u);
+    ASSERT_EQ((registry.storage<std::array<int, 256u>>().size()), 1024u);
+
+    for(auto pos = 0; pos < 1024; ++pos) {
+        buffer.emplace<int>(buffer.create(), pos);
+    }
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<int>().size(), 2048u);
+}
+
+TEST(CommandBuffer, PerThread) {
+    constexpr auto count = 4u;
+    entt::registry registry;
+    std::array<entt::command_buffer, count> buffers{};
+    std::array<std::thread, count> threads{};
+
+    for(auto pos = 0u; pos < count; ++pos) {
+        threads[pos] = std::thread{[&buffer = buffers[pos], pos]() {
+            for(auto next = 0u; next < 100u; ++next) {
+                const auto entity = buffer.create();
+                buffer.emplace<unsigned int>(entity, pos);
+            }
+        }};
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    for(auto &&buffer: buffers) {
+        buffer.flush(registry);
+    }
+
+    ASSERT_EQ(registry.alive(), count * 100u);
+
+    std::array<unsigned int, count> found{};
+
+    registry.view<unsigned int>().each([&found](const unsigned int value) {
+        ++found[value];
+    });
+
+    for(auto &&elem: found) {
+        ASSERT_EQ(elem, 100u);
+    }
+}
+
+TEST(CommandBuffer, ReservedEntities) {
+    constexpr auto count = 4u;
+    entt::registry registry;
+    std::array<entt::command_buffer, count> buffers{};
+    std::array<std::thread, count> threads{};
+    std::array<entt::entity, count> parent{};
+
+    static_cast<void>(registry.create());
+
+    for(auto pos = 0u; pos < count; ++pos) {
+        threads[pos] = std::thread{[&registry, &buffer = buffers[pos], &entity = parent[pos], pos]() {
+            entity = registry.reserve_entity();
+            buffer.emplace<unsigned int>(entity, pos);
+
+            for(auto next = 0u; next < 10u; ++next) {
+                buffer.emplace<parent_type>(buffer.create(), entity);
+            }
+        }};
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(registry.reserved_entities(), count);
+
+    for(auto &&buffer: buffers) {
+        buffer.flush(registry);
+    }
+
+    ASSERT_EQ(registry.reserved_entities(), 0u);
+    ASSERT_EQ(registry.alive(), 1u + count * 11u);
+
+    for(auto pos = 0u; pos < count; ++pos) {
+        ASSERT_TRUE(registry.valid(parent[pos]));
+        ASSERT_EQ(registry.get<unsigned int>(parent[pos]), pos);
+    }
+
+    registry.view<parent_type>().each([&registry](const parent_type &elem) {
+        ASSERT_TRUE(registry.valid(elem.value));
+        ASSERT_TRUE(registry.all_of<unsigned int>(elem.value));
+    });
+}
+
+TEST(CommandBuffer, Throw) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    auto value = std::make_shared<int>(42);
+
+    buffer.emplace<throwing_type>(buffer.create(), throwing_type::trigger_on_move - 1);
+    buffer.emplace<throwing_type>(buffer.create(), throwing_type::trigger_on_move);
+    buffer.emplace<std::shared_ptr<int>>(buffer.create(), value);
+
+    ASSERT_EQ(value.use_count(), 2);
+    ASSERT_THROW(buffer.flush(registry), std::exception);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(value.use_count(), 1);
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(registry.storage<throwing_type>().size(), 1u);
+    ASSERT_EQ(registry.storage<std::shared_ptr<int>>().size(), 0u);
+}
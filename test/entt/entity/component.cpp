@@ -8,6 +8,34 @@ struct self_contained {
 
 struct traits_based {};
 
+struct signal_free {
+    static constexpr auto signals = false;
+};
+
+struct hashed {
+    static constexpr auto hashed_index = true;
+};
+
+struct compact {
+    static constexpr auto compact_index = true;
+};
+
+struct aligned_pages {
+    static constexpr auto page_alignment = 64u;
+};
+
+struct tracked {
+    static constexpr auto change_ticks = true;
+};
+
+struct traced {
+    static constexpr auto trace_operations = true;
+};
+
+struct shared_pages {
+    static constexpr auto copy_on_write = true;
+};
+
 template<>
 struct entt::component_traits<traits_based> {
     static constexpr auto in_place_delete = false;
@@ -24,7 +52,13 @@ TEST(Component, DefaultParamsEmpty) {
 
     static_assert(!traits::in_place_delete);
     static_assert(traits::page_size == 0u);
+    static_assert(traits::signals);
+    static_assert(!traits::hashed_index);
     static_assert(entt::ignore_as_empty_v<default_params_empty>);
+    static_assert(!entt::hashed_index_v<default_params_empty>);
+    static_assert(entt::emit_signals_v<default_params_empty>);
+    static_assert(!entt::change_ticks_v<default_params_empty>);
+    static_assert(!entt::copy_on_write_v<default_params_empty>);
 }
 
 TEST(Component, DefaultParamsNonEmpty) {
@@ -50,3 +84,57 @@ TEST(Component, TraitsBased) {
     static_assert(traits::page_size == 8u);
     static_assert(!entt::ignore_as_empty_v<traits_based>);
 }
+
+TEST(Component, SignalFree) {
+    using traits = entt::component_traits<signal_free>;
+
+    static_assert(!traits::signals);
+    static_assert(!entt::emit_signals_v<signal_free>);
+    static_assert(entt::emit_signals_v<traits_based>);
+}
+
+TEST(Component, HashedIndex) {
+    using traits = entt::component_traits<hashed>;
+
+    static_assert(traits::hashed_index);
+    static_assert(entt::hashed_index_v<hashed>);
+    static_assert(!entt::hashed_index_v<traits_based>);
+}
+
+TEST(Component, PageAlignment) {
+    static_assert(entt::component_traits<aligned_pages>::page_alignment == 64u);
+    static_assert(entt::page_alignment_v<aligned_pages> == 64u);
+    static_assert(entt::page_alignment_v<traits_based> == 0u);
+}
+
+TEST(Component, CompactIndex) {
+    using traits = entt::component_traits<compact>;
+
+    static_assert(traits::compact_index);
+    static_assert(entt::compact_index_v<compact>);
+    static_assert(!entt::compact_index_v<hashed>);
+}
+
+TEST(Component, ChangeTicks) {
+    using traits = entt::component_traits<tracked>;
+
+    static_assert(traits::change_ticks);
+    static_assert(entt::change_ticks_v<tracked>);
+    static_assert(!entt::change_ticks_v<traits_based>);
+}
+
+TEST(Component, TraceOperations) {
+    using traits = entt::component_traits<traced>;
+
+    static_assert(traits::trace_operations);
+    static_assert(entt::trace_operations_v<traced>);
+    static_assert(!entt::trace_operations_v<traits_based>);
+}
+
+TEST(Component, CopyOnWrite) {
+    using traits = entt::component_traits<shared_pages>;
+
+    static_assert(traits::copy_on_write);
+    static_assert(entt::copy_on_write_v<shared_pages>);
+    static_assert(!entt::copy_on_write_v<traits_based>);
+}
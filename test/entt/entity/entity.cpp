@@ -31,6 +31,66 @@ TEST(Entity, Traits) {
     ASSERT_EQ(traits_type::combine(entt::null, entt::tombstone), null);
 }
 
+enum class custom_entity : std::uint32_t {};
+
+struct custom_entity_traits {
+    using value_type = custom_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint8_t;
+
+    static constexpr entity_type entity_mask = 0xFFFFFF;
+    static constexpr entity_type version_mask = 0xFF;
+};
+
+template<>
+struct entt::entt_traits<custom_entity>: entt::basic_entt_traits<custom_entity_traits> {};
+
+enum class wide_entity : std::uint64_t {};
+
+struct wide_entity_traits {
+    using value_type = wide_entity;
+    using entity_type = std::uint64_t;
+    using version_type = std::uint32_t;
+
+    static constexpr entity_type entity_mask = 0xFFFFFFFFFF;
+    static constexpr entity_type version_mask = 0xFFFFFF;
+};
+
+template<>
+struct entt::entt_traits<wide_entity>: entt::basic_entt_traits<wide_entity_traits> {};
+
+TEST(Entity, CustomTraits) {
+    using traits_type = entt::entt_traits<custom_entity>;
+    entt::basic_registry<custom_entity> registry{};
+
+    static_assert(traits_type::page_size == ENTT_SPARSE_PAGE);
+    static_assert(entt::entt_traits<wide_entity>::page_size == ENTT_SPARSE_PAGE);
+
+    ASSERT_EQ(entt::to_entity(traits_type::construct(0xABCDEF, 0x12)), 0xABCDEFu);
+    ASSERT_EQ(entt::to_version(traits_type::construct(0xABCDEF, 0x12)), 0x12u);
+    ASSERT_EQ(entt::to_integral(traits_type::construct(0xABCDEF, 0x12)), 0x12ABCDEFu);
+    ASSERT_EQ(entt::to_entity(static_cast<custom_entity>(entt::null)), 0xFFFFFFu);
+    ASSERT_EQ(entt::to_version(static_cast<custom_entity>(entt::tombstone)), 0xFFu);
+
+    ASSERT_EQ(entt::to_entity(entt::entt_traits<wide_entity>::construct(0xFFFFFFFFFF, 3u)), 0xFFFFFFFFFFu);
+    ASSERT_EQ(entt::to_version(entt::entt_traits<wide_entity>::construct(0xFFFFFFFFFF, 3u)), 3u);
+
+    auto entity = registry.create();
+
+    for(auto i = 0; i < 0xFF; ++i) {
+        registry.destroy(entity);
+        entity = registry.create();
+    }
+
+    ASSERT_EQ(entt::to_entity(entity), 0u);
+    ASSERT_EQ(entt::to_version(entity), 0u);
+    ASSERT_FALSE(entity == entt::tombstone);
+
+    registry.emplace<int>(entity, 42);
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+}
+
 TEST(Entity, Null) {
     using traits_type = entt::entt_traits<entt::entity>;
     constexpr entt::entity null = entt::null;
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/enum.hpp>
+#include <entt/entity/flags_storage_mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+
+enum class status : std::uint8_t {
+    none = 0x00,
+    alive = 0x01,
+    visible = 0x02,
+    dirty = 0x80,
+    _entt_enum_as_bitmask
+};
+
+template<>
+struct entt::storage_traits<entt::entity, status> {
+    using storage_type = entt::sigh_storage_mixin<entt::flags_storage_mixin<entt::basic_storage<entt::entity, status>>>;
+};
+
+template<typename Storage>
+std::vector<entt::entity> any_of(Storage &storage, const status mask) {
+    std::vector<entt::entity> result{};
+
+    storage.each_any(mask, [&result, &storage](const entt::entity entity, status &value) {
+        ASSERT_EQ(&storage.get(entity), &value);
+        result.push_back(entity);
+    });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template<typename Storage>
+std::vector<entt::entity> all_of(Storage &storage, const status mask) {
+    std::vector<entt::entity> result{};
+    storage.each_all(mask, [&result](const entt::entity entity, status) { result.push_back(entity); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(FlagsStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<status>();
+
+    ASSERT_TRUE(any_of(storage, status::alive).empty());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<status>(e0, status::alive | status::visible);
+    registry.emplace<status>(e1, status::alive);
+    registry.emplace<status>(e2, status::dirty);
+
+    ASSERT_EQ(any_of(storage, status::alive), (std::vector<entt::entity>{e0, e1}));
+    ASSERT_EQ(any_of(storage, status::visible | status::dirty), (std::vector<entt::entity>{e0, e2}));
+    ASSERT_EQ(all_of(storage, status::alive | status::visible), (std::vector<entt::entity>{e0}));
+    ASSERT_TRUE(any_of(storage, status::none).empty());
+
+    registry.patch<status>(e1, [](auto &value) { value |= status::dirty; });
+
+    ASSERT_EQ(any_of(storage, status::dirty), (std::vector<entt::entity>{e1, e2}));
+
+    storage.get(e2) = status::visible;
+
+    ASSERT_EQ(any_of(storage, status::dirty), (std::vector<entt::entity>{e1, e2}));
+
+    storage.touch(e2);
+
+    ASSERT_EQ(any_of(storage, status::dirty), (std::vector<entt::entity>{e1}));
+    ASSERT_EQ(any_of(storage, status::visible), (std::vector<entt::entity>{e0, e2}));
+
+    registry.erase<status>(e0);
+
+    ASSERT_EQ(any_of(storage, status::alive), (std::vector<entt::entity>{e1}));
+
+    registry.destroy(e1);
+    const auto e3 = registry.create();
+
+    ASSERT_TRUE(any_of(storage, status::alive).empty());
+
+    registry.emplace<status>(e3, status::alive);
+
+    ASSERT_EQ(any_of(storage, status::alive), (std::vector<entt::entity>{e3}));
+
+    registry.clear<status>();
+
+    ASSERT_TRUE(any_of(storage, status::alive | status::visible | status::dirty).empty());
+}
+
+TEST(FlagsStorageMixin, Sort) {
+    entt::registry registry;
+    auto &storage = registry.storage<status>();
+    std::vector<entt::entity> entities(130u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.emplace<status>(entities[pos], (pos % 3u) ? status::alive : status::visible);
+    }
+
+    storage.sort([](const auto lhs, const auto rhs) { return lhs > rhs; });
+
+    std::vector<entt::entity> expected{};
+
+    for(std::size_t pos{}; pos < entities.size(); pos += 3u) {
+        expected.push_back(entities[pos]);
+    }
+
+    ASSERT_EQ(any_of(storage, status::visible), expected);
+    ASSERT_EQ(any_of(storage, status::alive).size(), entities.size() - expected.size());
+}
+
+TEST(FlagsStorageMixin, Insert) {
+    entt::flags_storage_mixin<entt::storage<status>> flags{};
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{64}, entt::entity{200}};
+
+    flags.insert(std::begin(entities), std::end(entities), status::dirty);
+    flags.emplace(entt::entity{1}, status::alive);
+
+    ASSERT_EQ(any_of(flags, status::dirty), (std::vector<entt::entity>{entities[0u], entities[1u], entities[2u]}));
+    ASSERT_EQ(any_of(flags, status::alive), (std::vector<entt::entity>{entt::entity{1}}));
+
+    flags.erase(entt::entity{64});
+
+    ASSERT_EQ(any_of(flags, status::dirty), (std::vector<entt::entity>{entities[0u], entities[2u]}));
+}
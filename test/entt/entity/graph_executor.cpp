@@ -0,0 +1,197 @@
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/entity/graph_executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct tracker {
+    std::atomic<std::size_t> ticket{};
+    std::size_t order[5u]{};
+};
+
+template<std::size_t Index>
+void record(tracker &data) {
+    data.order[Index] = ++data.ticket;
+}
+
+void rw_int(tracker &data, entt::view<entt::get_t<int>> view) {
+    for(auto [entt, value]: view.each()) {
+        value = static_cast<int>(entt::to_integral(entt));
+    }
+
+    record<0u>(data);
+}
+
+void ro_int(tracker &data, entt::view<entt::get_t<const int>> view) {
+    for(auto [entt, value]: view.each()) {
+        ASSERT_EQ(value, static_cast<int>(entt::to_integral(entt)));
+    }
+
+    record<1u>(data);
+}
+
+void ro_int_rw_char(tracker &data, entt::view<entt::get_t<const int, char>>) {
+    record<2u>(data);
+}
+
+void rw_char(tracker &data, entt::view<entt::get_t<char>>) {
+    record<3u>(data);
+}
+
+void ro_double(tracker &data, const double &) {
+    record<4u>(data);
+}
+
+void split_rw_int(entt::view<entt::get_t<int>> view, std::size_t first, std::size_t last) {
+    for(auto [entt, value]: view.range(first, last)) {
+        value *= 2;
+    }
+}
+
+TEST(GraphExecutor, Functionalities) {
+    entt::graph_executor executor{4u};
+
+    ASSERT_EQ(executor.size(), 4u);
+    ASSERT_EQ(entt::graph_executor{0u}.size(), 1u);
+    ASSERT_GE(entt::graph_executor{}.size(), 1u);
+}
+
+TEST(GraphExecutor, Run) {
+    entt::graph_executor executor{4u};
+    entt::organizer organizer;
+    entt::registry registry;
+    tracker data{};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, 0);
+        registry.emplace<char>(entity);
+    }
+
+    organizer.emplace<&rw_int>(data, "t1");
+    organizer.emplace<&ro_int>(data, "t2");
+    organizer.emplace<&ro_int_rw_char>(data, "t3");
+    organizer.emplace<&rw_char>(data, "t4");
+    organizer.emplace<&ro_double>(data, "t5");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_FALSE(registry.ctx().contains<double>());
+
+    for(std::size_t pos{}; pos < 64u; ++pos) {
+        data.ticket = 0u;
+        executor.run(graph, registry);
+
+        ASSERT_EQ(data.ticket, graph.size());
+
+        for(std::size_t vertex{}; vertex < graph.size(); ++vertex) {
+            for(auto child: graph[vertex].children()) {
+                ASSERT_LT(data.order[vertex], data.order[child]);
+            }
+        }
+    }
+
+    ASSERT_TRUE(registry.ctx().contains<double>());
+}
+
+TEST(GraphExecutor, SingleWorker) {
+    entt::graph_executor executor{1u};
+    entt::organizer organizer;
+    entt::registry registry;
+    tracker data{};
+
+    executor.run(organizer.graph(), registry);
+
+    ASSERT_EQ(data.ticket, 0u);
+
+    organizer.emplace<&rw_int>(data);
+    organizer.emplace<&ro_int>(data);
+    executor.run(organizer.graph(), registry);
+
+    ASSERT_EQ(data.ticket, 2u);
+    ASSERT_EQ(data.order[0u], 1u);
+    ASSERT_EQ(data.order[1u], 2u);
+}
+
+TEST(GraphExecutor, Split) {
+    entt::graph_executor executor{4u};
+    entt::organizer organizer;
+    entt::registry registry;
+    tracker data{};
+
+    for(std::size_t pos{}; pos < 1000u; ++pos) {
+        registry.emplace<int>(registry.create());
+    }
+
+    organizer.emplace<&rw_int>(data);
+    organizer.emplace_split<&split_rw_int>(executor.size());
+    organizer.emplace<&rw_int>(data);
+    organizer.emplace_split<&split_rw_int>(executor.size());
+
+    executor.run(organizer.graph(executor.size()), registry);
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        ASSERT_EQ(value, static_cast<int>(entt::to_integral(entt)) * 2);
+    }
+}
+
+struct frame_counter {
+    std::atomic<int> current{};
+    int seen[16u]{};
+};
+
+void next_frame(frame_counter &data, entt::view<entt::get_t<int>> view) {
+    const auto frame = ++data.current;
+
+    for(auto [entt, value]: view.each()) {
+        value = frame;
+    }
+}
+
+void check_frame(frame_counter &data, entt::view<entt::get_t<const int>> view) {
+    const auto frame = data.current.load();
+
+    for(auto [entt, value]: view.each()) {
+        ASSERT_EQ(value, frame);
+    }
+
+    data.seen[frame - 1] = frame;
+}
+
+void tail(entt::view<entt::get_t<const char>>) {}
+
+TEST(GraphExecutor, Pipeline) {
+    entt::graph_executor executor{4u};
+    entt::organizer organizer;
+    entt::registry registry;
+    frame_counter data{};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity);
+        registry.emplace<char>(entity);
+    }
+
+    organizer.emplace<&next_frame>(data);
+    organizer.emplace<&check_frame>(data);
+    organizer.emplace<&tail>();
+
+    const auto graph = organizer.graph(executor.size());
+
+    for(auto pos = 0; pos < 16; ++pos) {
+        executor.submit(graph, registry);
+    }
+
+    executor.wait();
+
+    ASSERT_EQ(data.current, 16);
+
+    for(auto pos = 0; pos < 16; ++pos) {
+        ASSERT_EQ(data.seen[pos], pos + 1);
+    }
+
+    executor.run(graph, registry);
+
+    ASSERT_EQ(data.current, 17);
+}
@@ -5,7 +5,9 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/entity/group.hpp>
 #include <entt/entity/registry.hpp>
 
@@ -19,6 +21,11 @@ bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
     return lhs.value == rhs.value;
 }
 
+struct paged_int {
+    static constexpr auto page_size = 4u;
+    int value;
+};
+
 TEST(NonOwningGroup, Functionalities) {
     entt::registry registry;
     auto group = registry.group(entt::get<int, char>);
@@ -873,6 +880,44 @@ TEST(OwningGroup, Each) {
     }
 }
 
+TEST(OwningGroup, EachChunk) {
+    entt::registry registry;
+    auto group = registry.group<paged_int, char, empty_type>(entt::get<double>);
+
+    for(int next{}; next < 10; ++next) {
+        const auto entity = registry.create();
+        registry.emplace<paged_int>(entity, next);
+        registry.emplace<char>(entity, static_cast<char>(next));
+        registry.emplace<empty_type>(entity);
+        registry.emplace<double>(entity);
+    }
+
+    registry.emplace<paged_int>(registry.create());
+
+    std::vector<std::size_t> counts{};
+    int expected{};
+
+    group.each_chunk([&](const entt::entity *entities, paged_int *ivalue, char *cvalue, const std::size_t count) {
+        counts.push_back(count);
+
+        for(std::size_t pos{}; pos < count; ++pos, ++expected) {
+            ASSERT_EQ(ivalue[pos].value, expected);
+            ASSERT_EQ(cvalue[pos], expected);
+            ASSERT_EQ(&registry.get<paged_int>(entities[pos]), ivalue + pos);
+            ivalue[pos].value *= 2;
+        }
+    });
+
+    ASSERT_EQ(expected, 10);
+    ASSERT_EQ(counts, (std::vector<std::size_t>{4u, 4u, 2u}));
+
+    std::as_const(registry).group_if_exists<const paged_int, const char, const empty_type>(entt::get<const double>).each_chunk([](const entt::entity *, const paged_int *ivalue, const char *, const std::size_t count) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(ivalue[pos].value % 2, 0);
+        }
+    });
+}
+
 TEST(OwningGroup, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<boxed_int, char>();
@@ -920,6 +965,40 @@ TEST(OwningGroup, SortOrdered) {
     ASSERT_FALSE(group.contains(entities[4]));
 }
 
+TEST(OwningGroup, SortByKey) {
+    entt::registry registry;
+    auto group = registry.group<boxed_int, char, double>();
+
+    for(int next{}; next < 16; ++next) {
+        const auto entity = registry.create();
+        const auto value = (next * 7) % 16;
+        registry.emplace<boxed_int>(entity, value);
+        registry.emplace<char>(entity, static_cast<char>(value));
+        registry.emplace<double>(entity, value);
+    }
+
+    registry.emplace<boxed_int>(registry.create(), 99);
+
+    group.sort<boxed_int>([](const boxed_int &elem) { return static_cast<unsigned int>(elem.value); }, entt::radix_sort<8, 32>{});
+
+    int expected{};
+
+    for(auto [entity, ivalue, cvalue, dvalue]: group.each()) {
+        ASSERT_EQ(ivalue.value, expected);
+        ASSERT_EQ(cvalue, expected);
+        ASSERT_EQ(dvalue, expected);
+        ASSERT_EQ(&registry.get<char>(entity), &cvalue);
+        ++expected;
+    }
+
+    ASSERT_EQ(expected, 16);
+
+    group.sort([&registry](const entt::entity entity) { return 15u - static_cast<unsigned int>(registry.get<boxed_int>(entity).value); }, entt::radix_sort<8, 32>{});
+
+    ASSERT_EQ(std::get<0>(group.get<char, double>(group.front())), 15);
+    ASSERT_EQ(std::get<1>(group.get<char, double>(group.back())), 0.);
+}
+
 TEST(OwningGroup, SortReverse) {
     entt::registry registry;
     auto group = registry.group<boxed_int, char>();
@@ -14,6 +14,12 @@ TEST(BasicHandle, Assumptions) {
     static_assert(std::is_trivially_copyable_v<entt::const_handle>);
     static_assert(std::is_trivially_assignable_v<entt::const_handle, entt::const_handle>);
     static_assert(std::is_trivially_destructible_v<entt::const_handle>);
+
+    static_assert(std::is_trivially_copyable_v<entt::handle_view<int, char>>);
+    static_assert(std::is_trivially_assignable_v<entt::handle_view<int, char>, entt::handle_view<int, char>>);
+    static_assert(std::is_trivially_destructible_v<entt::handle_view<int, char>>);
+
+    static_assert(sizeof(entt::handle) == sizeof(entt::const_handle_view<int, char>));
 }
 
 TEST(BasicHandle, DeductionGuide) {
@@ -192,6 +198,37 @@ TEST(BasicHandle, Component) {
     ASSERT_EQ(nullptr, std::get<1>(handle.try_get<int, char, double>()));
 }
 
+TEST(BasicHandle, CachedPools) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    ASSERT_EQ(registry.storage().begin(), registry.storage().end());
+
+    entt::handle_view<int, const char> handle{registry, entity};
+
+    ASSERT_NE(registry.storage(entt::type_id<int>().hash()), registry.storage().end());
+    ASSERT_NE(registry.storage(entt::type_id<char>().hash()), registry.storage().end());
+
+    registry.emplace<char>(entity, 'c');
+    registry.emplace<int>(other, 3);
+
+    ASSERT_FALSE((handle.all_of<int, const char>()));
+    ASSERT_TRUE((handle.any_of<int, const char>()));
+    ASSERT_EQ(handle.try_get<int>(), nullptr);
+    ASSERT_EQ(handle.get<const char>(), 'c');
+
+    static_assert(std::is_same_v<decltype(handle.get<const char>()), const char &>);
+
+    handle.emplace<int>(42);
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(handle.get_or_emplace<int>(0), 42);
+    ASSERT_EQ((handle.get<int, const char>()), std::make_tuple(42, 'c'));
+    ASSERT_EQ(*std::get<0>(handle.try_get<int, const char>()), 42);
+    ASSERT_EQ((entt::handle_view<int>{registry, other}.get<int>()), 3);
+}
+
 TEST(BasicHandle, FromEntity) {
     entt::registry registry;
     const auto entity = registry.create();
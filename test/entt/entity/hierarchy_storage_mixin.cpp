@@ -0,0 +1,193 @@
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/hierarchy_storage_mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+
+struct node {
+    entt::entity parent{entt::null};
+    int local{};
+    int world{};
+};
+
+struct node_parent {
+    entt::entity operator()(const node &elem) const {
+        return elem.parent;
+    }
+};
+
+template<>
+struct entt::storage_traits<entt::entity, node> {
+    using storage_type = entt::sigh_storage_mixin<entt::hierarchy_storage_mixin<entt::basic_storage<entt::entity, node>, node_parent>>;
+};
+
+template<typename Storage>
+std::vector<entt::entity> sweep(Storage &storage) {
+    std::vector<entt::entity> result{};
+
+    storage.traverse([&result, &storage](const entt::entity entity, node &elem, node *parent) {
+        ASSERT_EQ(&storage.get(entity), &elem);
+        ASSERT_EQ(parent, storage.contains(elem.parent) ? &storage.get(elem.parent) : nullptr);
+        elem.world = elem.local + (parent ? parent->world : 0);
+        result.push_back(entity);
+    });
+
+    return result;
+}
+
+// checks that parents come before their children and that subtrees are contiguous, returns the number of roots
+template<typename Storage>
+std::size_t depth_first(Storage &storage) {
+    std::vector<entt::entity> path{};
+    std::size_t roots{};
+
+    storage.traverse([&](const entt::entity entity, node &elem, node *parent) {
+        if(storage.contains(elem.parent)) {
+            // the parent is either the last instance visited or one of its ancestors
+            for(; !path.empty() && path.back() != elem.parent; path.pop_back()) {}
+
+            ASSERT_FALSE(path.empty());
+            ASSERT_EQ(parent, &storage.get(elem.parent));
+        } else {
+            ASSERT_EQ(parent, nullptr);
+            path.clear();
+            ++roots;
+        }
+
+        elem.world = elem.local + (parent ? parent->world : 0);
+        path.push_back(entity);
+    });
+
+    return roots;
+}
+
+TEST(HierarchyStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<node>();
+
+    ASSERT_TRUE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 0u);
+
+    entt::entity entities[5u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    // children are created before their parents on purpose
+    registry.emplace<node>(entities[0u], entities[2u], 1);
+    registry.emplace<node>(entities[1u], entities[0u], 10);
+    registry.emplace<node>(entities[2u], entt::null, 100);
+    registry.emplace<node>(entities[3u], entities[2u], 1000);
+    registry.emplace<node>(entities[4u], entt::null, 10000);
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 5u);
+    ASSERT_TRUE(storage.arranged());
+
+    const auto order = sweep(storage);
+
+    ASSERT_EQ(order, (std::vector<entt::entity>{entities[4u], entities[2u], entities[3u], entities[0u], entities[1u]}));
+    const entt::sparse_set &base = storage;
+    ASSERT_EQ(order, (std::vector<entt::entity>{base.begin(), base.end()}));
+    ASSERT_EQ(storage.get(entities[1u]).world, 111);
+    ASSERT_EQ(storage.get(entities[3u]).world, 1100);
+    ASSERT_EQ(storage.get(entities[4u]).world, 10000);
+
+    registry.patch<node>(entities[0u], [&entities](auto &elem) { elem.parent = entities[4u]; });
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(sweep(storage), (std::vector<entt::entity>{entities[4u], entities[0u], entities[1u], entities[2u], entities[3u]}));
+    ASSERT_EQ(storage.get(entities[1u]).world, 10011);
+
+    registry.destroy(entities[4u]);
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(sweep(storage), (std::vector<entt::entity>{entities[0u], entities[1u], entities[2u], entities[3u]}));
+    ASSERT_EQ(storage.get(entities[0u]).world, 1);
+    ASSERT_EQ(storage.get(entities[1u]).world, 11);
+}
+
+TEST(HierarchyStorageMixin, Cycles) {
+    entt::registry registry;
+    auto &storage = registry.storage<node>();
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<node>(e0, e1);
+    registry.emplace<node>(e1, e0);
+    registry.emplace<node>(e2, entt::null);
+
+    std::vector<entt::entity> order{};
+
+    storage.traverse([&order](const entt::entity entity, node &, node *parent) {
+        // instances that are part of a cycle are treated as roots
+        ASSERT_EQ(parent, nullptr);
+        order.push_back(entity);
+    });
+
+    ASSERT_EQ(order, (std::vector<entt::entity>{e2, e1, e0}));
+}
+
+TEST(HierarchyStorageMixin, BulkRemoval) {
+    entt::registry registry;
+    auto &storage = registry.storage<node>();
+
+    entt::entity entities[9u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    // two trees: 0 -> (1 -> (2, 3), 4 -> 5) and 6 -> 7 -> 8
+    registry.emplace<node>(entities[3u], entities[1u], 1000);
+    registry.emplace<node>(entities[8u], entities[7u], 100000000);
+    registry.emplace<node>(entities[0u], entt::null, 1);
+    registry.emplace<node>(entities[5u], entities[4u], 100000);
+    registry.emplace<node>(entities[2u], entities[1u], 100);
+    registry.emplace<node>(entities[6u], entt::null, 1000000);
+    registry.emplace<node>(entities[1u], entities[0u], 10);
+    registry.emplace<node>(entities[7u], entities[6u], 10000000);
+    registry.emplace<node>(entities[4u], entities[0u], 10000);
+
+    ASSERT_EQ(depth_first(storage), 2u);
+    ASSERT_EQ(storage.get(entities[3u]).world, 1011);
+    ASSERT_EQ(storage.get(entities[8u]).world, 111000000);
+
+    // inner nodes go away at once, their children become roots
+    const entt::entity erased[]{entities[1u], entities[7u]};
+    registry.erase<node>(std::begin(erased), std::end(erased));
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 7u);
+    ASSERT_EQ(depth_first(storage), 5u);
+    ASSERT_EQ(storage.get(entities[2u]).world, 100);
+    ASSERT_EQ(storage.get(entities[3u]).world, 1000);
+    ASSERT_EQ(storage.get(entities[5u]).world, 110001);
+    ASSERT_EQ(storage.get(entities[8u]).world, 100000000);
+
+    // a whole subtree goes away with its root
+    registry.destroy(std::begin(entities) + 4u, std::begin(entities) + 6u);
+    registry.destroy(entities[0u]);
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 4u);
+    ASSERT_EQ(depth_first(storage), 4u);
+
+    registry.patch<node>(entities[3u], [&entities](auto &elem) { elem.parent = entities[2u]; });
+    registry.patch<node>(entities[2u], [&entities](auto &elem) { elem.parent = entities[8u]; });
+
+    ASSERT_EQ(depth_first(storage), 2u);
+    ASSERT_EQ(storage.get(entities[3u]).world, 100001100);
+
+    registry.clear<node>();
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 0u);
+    ASSERT_EQ(depth_first(storage), 0u);
+
+    // stale parents left by the clear are ignored
+    registry.emplace<node>(entities[3u], entities[2u], 1);
+    registry.emplace<node>(entities[6u], entities[3u], 10);
+
+    ASSERT_EQ(depth_first(storage), 1u);
+    ASSERT_EQ(storage.get(entities[6u]).world, 11);
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/entity/lazy_group.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+TEST(LazyGroup, Functionalities) {
+    entt::registry registry;
+    entt::lazy_group<int, char> group{registry};
+
+    ASSERT_FALSE(group.arranged());
+    ASSERT_EQ(group.refresh(), 0u);
+    ASSERT_TRUE(group.arranged());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<char>(e0, 'a');
+    registry.emplace<int>(e1, 1);
+    registry.emplace<char>(e1, 'b');
+    registry.emplace<int>(e2, 2);
+    registry.emplace<char>(e2, 'c');
+
+    ASSERT_FALSE(group.arranged());
+    ASSERT_EQ(group.refresh(), 2u);
+    ASSERT_TRUE(group.arranged());
+
+    const auto &ipool = registry.storage<int>();
+    const auto &cpool = registry.storage<char>();
+
+    for(std::size_t pos{}; pos < group.refresh(); ++pos) {
+        ASSERT_EQ(ipool.data()[pos], cpool.data()[pos]);
+        ASSERT_EQ(ipool.get(ipool.data()[pos]), static_cast<int>(cpool.get(cpool.data()[pos]) - 'a'));
+    }
+
+    std::size_t count{};
+
+    group.each([&count](const entt::entity entity, int &ivalue, char &cvalue) {
+        ASSERT_EQ(ivalue, static_cast<int>(cvalue - 'a'));
+        ASSERT_NE(entity, entt::entity{entt::null});
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+
+    registry.destroy(e1);
+
+    ASSERT_FALSE(group.arranged());
+
+    group.each([&count, e2](const entt::entity entity, int &ivalue, char &) {
+        ASSERT_EQ(entity, e2);
+        ASSERT_EQ(ivalue, 2);
+        --count;
+    });
+
+    ASSERT_EQ(count, 1u);
+
+    group.invalidate();
+
+    ASSERT_FALSE(group.arranged());
+}
+
+TEST(LazyGroup, EmptyType) {
+    entt::registry registry;
+    entt::lazy_group<int, empty_type> group{registry};
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<empty_type>(entity);
+    registry.emplace<int>(registry.create());
+
+    std::size_t count{};
+
+    group.each([&count](int &value) {
+        ASSERT_EQ(value, 42);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(LazyGroup, Overlapping) {
+    entt::registry registry;
+    entt::lazy_group<int, char> lhs{registry};
+    entt::lazy_group<int, double> rhs{registry};
+
+    for(int next{}; next < 8; ++next) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, next);
+        (next % 2) ? registry.emplace<char>(entity) : registry.emplace<double>(entity);
+    }
+
+    ASSERT_EQ(lhs.refresh(), 4u);
+    ASSERT_TRUE(lhs.arranged());
+
+    ASSERT_EQ(rhs.refresh(), 4u);
+    ASSERT_TRUE(rhs.arranged());
+    ASSERT_FALSE(lhs.arranged());
+
+    lhs.each([](int &value, char &) {
+        ASSERT_EQ(value % 2, 1);
+    });
+
+    ASSERT_TRUE(lhs.arranged());
+    ASSERT_FALSE(rhs.arranged());
+
+    rhs.each([](int &value, double &) {
+        ASSERT_EQ(value % 2, 0);
+    });
+
+    ASSERT_TRUE(rhs.arranged());
+}
+
+TEST(LazyGroup, Disconnect) {
+    entt::registry registry;
+
+    {
+        entt::lazy_group<int, char> group{registry};
+        group.refresh();
+
+        ASSERT_FALSE(registry.on_construct<int>().empty());
+        ASSERT_FALSE(registry.on_destroy<char>().empty());
+    }
+
+    ASSERT_TRUE(registry.on_construct<int>().empty());
+    ASSERT_TRUE(registry.on_destroy<char>().empty());
+
+    entt::lazy_group<int, char> group{registry};
+
+    ASSERT_FALSE(group.arranged());
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/entity/observer.hpp>
@@ -369,3 +371,177 @@ TEST(Observer, GroupCornerCase) {
     ASSERT_FALSE(add_observer.empty());
     ASSERT_TRUE(remove_observer.empty());
 }
+
+TEST(Observer, DoubleBuffering) {
+    entt::registry registry;
+    entt::observer observer{registry, entt::collector.update<int>()};
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+    registry.patch<int>(entity);
+    registry.patch<int>(entity);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_TRUE(observer.snapshot().empty());
+
+    observer.swap();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_EQ(observer.snapshot().size(), 1u);
+    ASSERT_TRUE(observer.snapshot().contains(entity));
+
+    registry.patch<int>(other);
+    registry.remove<int>(entity);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.begin(), other);
+    ASSERT_EQ(observer.snapshot().size(), 1u);
+    ASSERT_TRUE(observer.snapshot().contains(entity));
+
+    observer.swap();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_EQ(observer.snapshot().size(), 1u);
+    ASSERT_TRUE(observer.snapshot().contains(other));
+
+    observer.swap();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_TRUE(observer.snapshot().empty());
+
+    registry.patch<int>(other);
+    observer.swap();
+    observer.connect(registry, entt::collector.update<int>());
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_TRUE(observer.snapshot().empty());
+}
+
+TEST(ObserverSet, Functionalities) {
+    entt::registry registry;
+    entt::observer_set set{registry};
+
+    const auto update = set.add(entt::collector.update<int>());
+    const auto group = set.add(entt::collector.group<int, char>(entt::exclude<double>));
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_TRUE(set.empty(update));
+    ASSERT_TRUE(set.empty(group));
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    ASSERT_TRUE(set.empty(update));
+    ASSERT_TRUE(set.empty(group));
+
+    registry.emplace<char>(entity);
+
+    ASSERT_TRUE(set.empty(update));
+    ASSERT_TRUE(set.contains(group, entity));
+
+    registry.patch<int>(entity);
+
+    ASSERT_TRUE(set.contains(update, entity));
+    ASSERT_TRUE(set.contains(group, entity));
+
+    set.each(update, [entity](const entt::entity entt) {
+        ASSERT_EQ(entt, entity);
+    });
+
+    ASSERT_TRUE(set.empty(update));
+    ASSERT_FALSE(set.empty(group));
+
+    registry.emplace<double>(entity);
+
+    ASSERT_TRUE(set.empty(group));
+
+    registry.erase<double>(entity);
+
+    ASSERT_TRUE(set.contains(group, entity));
+
+    std::as_const(set).each(group, [entity](const entt::entity entt) {
+        ASSERT_EQ(entt, entity);
+    });
+
+    ASSERT_FALSE(set.empty(group));
+
+    registry.patch<int>(entity);
+    registry.erase<char>(entity);
+
+    ASSERT_TRUE(set.contains(update, entity));
+    ASSERT_FALSE(set.contains(group, entity));
+
+    registry.destroy(entity);
+
+    ASSERT_TRUE(set.empty(update));
+}
+
+TEST(ObserverSet, Where) {
+    entt::registry registry;
+    entt::observer_set set{registry};
+
+    const auto id = set.add(entt::collector.update<int>().where<char>(entt::exclude<double>).group<float>());
+    const auto other = set.add(entt::collector.update<char>());
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+    registry.patch<int>(entity);
+
+    ASSERT_TRUE(set.contains(id, entity));
+    ASSERT_FALSE(set.contains(other, entity));
+
+    registry.patch<char>(entity);
+    registry.emplace<double>(entity);
+
+    ASSERT_FALSE(set.contains(id, entity));
+    ASSERT_TRUE(set.contains(other, entity));
+
+    set.clear(other);
+
+    ASSERT_TRUE(set.empty(other));
+
+    registry.emplace<float>(entity);
+
+    ASSERT_TRUE(set.contains(id, entity));
+
+    set.clear();
+
+    ASSERT_TRUE(set.empty(id));
+    ASSERT_TRUE(set.empty(other));
+}
+
+TEST(ObserverSet, SameAsObserver) {
+    constexpr auto collector = entt::collector.group<int>(entt::exclude<char>).update<double>().where<int>();
+
+    entt::registry registry;
+    entt::observer observer{registry, collector};
+    entt::observer_set set{registry};
+    const auto id = set.add(collector);
+
+    for(auto pos = 0; pos < 64; ++pos) {
+        const auto entity = registry.create();
+
+        if(pos % 2) { registry.emplace<int>(entity); }
+        if(pos % 3) { registry.emplace<double>(entity); }
+        if(pos % 5) { registry.emplace<char>(entity); }
+        if(pos % 7) { registry.emplace_or_replace<double>(entity); }
+        if(pos % 11) { registry.remove<char>(entity); }
+        if(pos % 13) { registry.remove<int>(entity); }
+    }
+
+    std::size_t count{};
+
+    set.each(id, [&observer, &count](const entt::entity entity) {
+        ASSERT_NE(std::find(observer.begin(), observer.end(), entity), observer.end());
+        ++count;
+    });
+
+    ASSERT_NE(count, 0u);
+    ASSERT_EQ(count, observer.size());
+    ASSERT_TRUE(set.empty(id));
+
+    observer.disconnect();
+}
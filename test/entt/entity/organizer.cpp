@@ -8,6 +8,16 @@ void ro_char_rw_int(entt::view<entt::get_t<int, const char>>) {}
 void ro_char_rw_double(entt::view<entt::get_t<const char>>, double &) {}
 void ro_int_double(entt::view<entt::get_t<const int>>, const double &) {}
 void sync_point(entt::registry &, entt::view<entt::get_t<const int>>) {}
+void rw_int(entt::view<entt::get_t<int>>) {}
+void rw_char(entt::view<entt::get_t<char>>) {}
+void ro_int(entt::view<entt::get_t<const int>>) {}
+void ro_char(entt::view<entt::get_t<const char>>) {}
+
+void split_rw_int(entt::view<entt::get_t<int>> view, std::size_t first, std::size_t last, const double &step) {
+    for(auto [entt, value]: view.range(first, last)) {
+        value += static_cast<int>(step);
+    }
+}
 
 struct clazz {
     void ro_int_char_double(entt::view<entt::get_t<const int, const char>>, const double &) {}
@@ -418,6 +428,141 @@ TEST(Organizer, Dependencies) {
     ASSERT_EQ(*buffer[0u], entt::type_id<char>());
 }
 
+TEST(Organizer, CriticalPath) {
+    entt::organizer organizer;
+
+    organizer.emplace<&rw_int>("rw_int");
+    organizer.emplace<&rw_char>("rw_char");
+    organizer.emplace<&ro_int>("ro_int");
+    organizer.emplace<&ro_char>("ro_char");
+
+    auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 4u);
+
+    ASSERT_EQ(graph[0u].cost(), 1u);
+    ASSERT_EQ(graph[0u].priority(), 2u);
+    ASSERT_EQ(graph[2u].priority(), 1u);
+
+    for(auto &&vertex: graph) {
+        ASSERT_EQ(vertex.worker(), 0u);
+    }
+
+    organizer.cost(1u, 5u);
+    organizer.cost(2u, 10u);
+    graph = organizer.graph(2u);
+
+    ASSERT_EQ(graph[1u].cost(), 5u);
+    ASSERT_EQ(graph[2u].cost(), 10u);
+
+    ASSERT_EQ(graph[0u].priority(), 11u);
+    ASSERT_EQ(graph[1u].priority(), 6u);
+    ASSERT_EQ(graph[2u].priority(), 10u);
+    ASSERT_EQ(graph[3u].priority(), 1u);
+
+    // the heavy chain is kept on the first worker, the rest runs on the second one
+    ASSERT_EQ(graph[0u].worker(), 0u);
+    ASSERT_EQ(graph[1u].worker(), 1u);
+    ASSERT_EQ(graph[2u].worker(), 0u);
+    ASSERT_EQ(graph[3u].worker(), 1u);
+}
+
+TEST(Organizer, Split) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&rw_int>("before");
+    organizer.emplace_split<&split_rw_int>(3u, "split");
+    organizer.emplace<&ro_int>("after");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 5u);
+
+    ASSERT_EQ(graph[0u].chunks(), 0u);
+    ASSERT_EQ(graph[1u].chunks(), 3u);
+    ASSERT_EQ(graph[3u].chunks(), 3u);
+    ASSERT_STREQ(graph[2u].name(), "split");
+
+    // chunks don't depend on each other
+    ASSERT_EQ(graph[0u].children().size(), 3u);
+    ASSERT_EQ(graph[1u].children().size(), 1u);
+    ASSERT_EQ(graph[2u].children().size(), 1u);
+    ASSERT_EQ(graph[3u].children().size(), 1u);
+    ASSERT_EQ(graph[1u].children()[0u], 4u);
+
+    ASSERT_FALSE(graph[1u].top_level());
+    ASSERT_FALSE(graph[4u].top_level());
+
+    for(int next{}; next < 10; ++next) {
+        registry.emplace<int>(registry.create(), next);
+    }
+
+    registry.ctx().emplace<double>(2.);
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+        vertex.callback()(vertex.data(), registry);
+    }
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        ASSERT_EQ(value, static_cast<int>(entt::to_entity(entt)) + 2);
+    }
+}
+
+TEST(Organizer, Incremental) {
+    entt::organizer organizer;
+    entt::organizer other;
+
+    organizer.emplace<&ro_int_double>("before");
+    organizer.emplace<&sync_point>("sync_1");
+
+    ASSERT_EQ(organizer.graph().size(), 2u);
+
+    organizer.emplace<&ro_int_double>("mid_1");
+    organizer.emplace<&ro_int_double>("mid_2");
+
+    ASSERT_EQ(organizer.graph().size(), 4u);
+
+    organizer.emplace<&sync_point>("sync_2");
+    organizer.emplace<&ro_int_double>("after");
+
+    other.emplace<&ro_int_double>("before");
+    other.emplace<&sync_point>("sync_1");
+    other.emplace<&ro_int_double>("mid_1");
+    other.emplace<&ro_int_double>("mid_2");
+    other.emplace<&sync_point>("sync_2");
+    other.emplace<&ro_int_double>("after");
+
+    const auto graph = organizer.graph(2u);
+    const auto expected = other.graph(2u);
+
+    ASSERT_EQ(graph.size(), expected.size());
+
+    for(std::size_t pos{}; pos < graph.size(); ++pos) {
+        ASSERT_STREQ(graph[pos].name(), expected[pos].name());
+        ASSERT_EQ(graph[pos].top_level(), expected[pos].top_level());
+        ASSERT_EQ(graph[pos].children(), expected[pos].children());
+        ASSERT_EQ(graph[pos].priority(), expected[pos].priority());
+        ASSERT_EQ(graph[pos].worker(), expected[pos].worker());
+    }
+
+    ASSERT_EQ(graph[1u].children().size(), 2u);
+    ASSERT_EQ(graph[4u].children().size(), 1u);
+
+    organizer.clear();
+    organizer.emplace<&rw_int>("first");
+    organizer.emplace<&ro_int>("second");
+
+    const auto cleared = organizer.graph();
+
+    ASSERT_EQ(cleared.size(), 2u);
+    ASSERT_TRUE(cleared[0u].top_level());
+    ASSERT_FALSE(cleared[1u].top_level());
+    ASSERT_EQ(cleared[0u].children().size(), 1u);
+    ASSERT_EQ(cleared[0u].children()[0u], 1u);
+}
+
 TEST(Organizer, ToArgsIntegrity) {
     entt::organizer organizer;
     entt::registry registry;
@@ -430,3 +575,50 @@ TEST(Organizer, ToArgsIntegrity) {
 
     ASSERT_EQ(registry.ctx().at<std::size_t>(), 0u);
 }
+
+TEST(StaticOrganizer, Levels) {
+    using organizer_type = entt::static_organizer<&ro_int_rw_char_double, &ro_char_rw_int, &ro_char_rw_double, &ro_int_double, &sync_point, &ro_int, &ro_char>;
+
+    static_assert(organizer_type::size() == 7u);
+    static_assert(organizer_type::depth() == 5u);
+
+    static_assert(organizer_type::level_of(0u) == 0u);
+    static_assert(organizer_type::level_of(1u) == 1u);
+    static_assert(organizer_type::level_of(2u) == 1u);
+    static_assert(organizer_type::level_of(3u) == 2u);
+    static_assert(organizer_type::level_of(4u) == 3u);
+    static_assert(organizer_type::level_of(5u) == 4u);
+    static_assert(organizer_type::level_of(6u) == 4u);
+
+    static_assert(entt::static_organizer<>::size() == 0u);
+    static_assert(entt::static_organizer<>::depth() == 0u);
+}
+
+TEST(StaticOrganizer, Run) {
+    using organizer_type = entt::static_organizer<&to_args_integrity, &rw_int, &ro_int, &ro_char>;
+
+    entt::registry registry;
+    std::size_t invoked{};
+
+    organizer_type::prepare(registry);
+
+    ASSERT_TRUE(registry.ctx().contains<std::size_t>());
+
+    registry.emplace<int>(registry.create());
+    organizer_type::run(registry);
+
+    ASSERT_EQ(registry.ctx().at<std::size_t>(), 1u);
+
+    registry.ctx().at<std::size_t>() = 0u;
+    registry.emplace<int>(registry.create());
+
+    organizer_type::run([&invoked](const std::size_t count, const auto &task) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            task(pos);
+            ++invoked;
+        }
+    }, registry);
+
+    ASSERT_EQ(invoked, 4u);
+    ASSERT_EQ(registry.ctx().at<std::size_t>(), 2u);
+}
@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/prefab.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct aggregate_type {
+    int value;
+    char other;
+};
+
+void listener(std::size_t &counter, entt::registry &, entt::entity) {
+    ++counter;
+}
+
+TEST(Prefab, Functionalities) {
+    entt::prefab prefab{};
+
+    ASSERT_TRUE(prefab.empty());
+    ASSERT_EQ(prefab.size(), 0u);
+    ASSERT_FALSE(prefab.all_of<int>());
+
+    ASSERT_EQ(prefab.emplace<int>(42), 42);
+    ASSERT_EQ(prefab.emplace<aggregate_type>(3, 'c').other, 'c');
+    prefab.emplace<empty_type>();
+
+    ASSERT_FALSE(prefab.empty());
+    ASSERT_EQ(prefab.size(), 3u);
+    ASSERT_TRUE((prefab.all_of<int, aggregate_type, empty_type>()));
+    ASSERT_FALSE((prefab.all_of<int, char>()));
+    ASSERT_EQ(prefab.get<int>(), 42);
+
+    prefab.emplace<int>(1);
+
+    ASSERT_EQ(prefab.size(), 3u);
+    ASSERT_EQ(prefab.get<int>(), 1);
+
+    ASSERT_EQ((prefab.remove<int, char>()), 1u);
+    ASSERT_EQ(prefab.size(), 2u);
+    ASSERT_FALSE(prefab.all_of<int>());
+
+    entt::prefab other{std::move(prefab)};
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.get<aggregate_type>().value, 3);
+
+    other.clear();
+
+    ASSERT_TRUE(other.empty());
+}
+
+TEST(Prefab, Capture) {
+    entt::registry registry;
+    entt::prefab prefab{};
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<empty_type>(entity);
+
+    prefab.capture<int, char, empty_type>(registry, entity);
+
+    ASSERT_EQ(prefab.size(), 2u);
+    ASSERT_TRUE((prefab.all_of<int, empty_type>()));
+    ASSERT_FALSE(prefab.all_of<char>());
+    ASSERT_EQ(prefab.get<int>(), 42);
+}
+
+TEST(Prefab, Instantiate) {
+    entt::registry registry;
+    entt::prefab prefab{};
+    entt::entity entities[3u];
+    std::size_t counter{};
+
+    prefab.emplace<int>(42);
+    prefab.emplace<empty_type>();
+
+    registry.on_construct<int>().connect<&listener>(counter);
+    registry.destroy(registry.create());
+
+    const auto entity = registry.instantiate(prefab);
+
+    ASSERT_EQ(counter, 1u);
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_TRUE(registry.all_of<empty_type>(entity));
+
+    registry.instantiate(prefab, std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(counter, 4u);
+    ASSERT_EQ(registry.storage<int>().size(), 4u);
+    ASSERT_EQ(registry.storage<empty_type>().size(), 4u);
+
+    for(auto entt: entities) {
+        ASSERT_TRUE(registry.valid(entt));
+        ASSERT_EQ(registry.get<int>(entt), 42);
+        ASSERT_TRUE(registry.all_of<empty_type>(entt));
+    }
+
+    registry.get<int>(entities[0u]) = 3;
+
+    ASSERT_EQ(prefab.get<int>(), 42);
+    ASSERT_EQ(registry.get<int>(entities[1u]), 42);
+}
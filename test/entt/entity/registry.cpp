@@ -1,13 +1,17 @@
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/core/hashed_string.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
@@ -39,6 +43,11 @@ struct aggregate {
     int value{};
 };
 
+struct signal_free {
+    static constexpr auto signals = false;
+    int value{};
+};
+
 struct listener {
     template<typename Component>
     static void sort(entt::registry &registry) {
@@ -69,6 +78,59 @@ struct owner {
     const entt::registry *parent{nullptr};
 };
 
+struct arena {
+    std::size_t allocated{};
+    std::size_t deallocated{};
+};
+
+template<typename Type>
+struct arena_allocator {
+    using value_type = Type;
+
+    arena_allocator(arena &ref)
+        : owner{&ref} {}
+
+    template<typename Other>
+    arena_allocator(const arena_allocator<Other> &other)
+        : owner{other.owner} {}
+
+    Type *allocate(const std::size_t count) {
+        owner->allocated += count * sizeof(Type);
+        return std::allocator<Type>{}.allocate(count);
+    }
+
+    void deallocate(Type *ptr, const std::size_t count) {
+        owner->deallocated += count * sizeof(Type);
+        std::allocator<Type>{}.deallocate(ptr, count);
+    }
+
+    template<typename Other>
+    bool operator==(const arena_allocator<Other> &other) const {
+        return owner == other.owner;
+    }
+
+    template<typename Other>
+    bool operator!=(const arena_allocator<Other> &other) const {
+        return owner != other.owner;
+    }
+
+    arena *owner;
+};
+
+enum class scratch_entity : std::uint32_t {};
+
+template<typename Type>
+struct entt::storage_traits<scratch_entity, Type> {
+    using storage_type = entt::sigh_storage_mixin<entt::basic_storage<scratch_entity, Type, arena_allocator<Type>>>;
+};
+
+struct indexed_type {
+    int value;
+};
+
+template<>
+struct entt::static_type_index<indexed_type>: entt::type_list_index<indexed_type, entt::type_list<indexed_type>> {};
+
 TEST(Registry, Context) {
     entt::registry registry;
     auto &ctx = registry.ctx();
@@ -186,6 +248,42 @@ TEST(Registry, ContextAsConstRef) {
     ASSERT_EQ(std::as_const(registry).ctx().at<const int>(), 42);
 }
 
+TEST(Registry, ContextSlots) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    auto &ctx = registry.ctx();
+    const auto &cctx = std::as_const(registry).ctx();
+    char value{'c'};
+
+    auto *elem = &ctx.emplace<int>(42);
+    ctx.emplace<const char &>(std::as_const(value));
+
+    ASSERT_NE(ctx.find<const char>(), nullptr);
+    ASSERT_EQ(ctx.find<char>(), nullptr);
+
+    ASSERT_EQ(cctx.find<char>(), ctx.find<const char>());
+    ASSERT_EQ(ctx.find<int>(), elem);
+
+    for(entt::id_type next{}; next < 128u; ++next) {
+        ctx.emplace_hint<double>(next + 1u, static_cast<double>(next));
+    }
+
+    ASSERT_EQ(&ctx.at<int>(), elem);
+    ASSERT_EQ(&cctx.at<int>(), elem);
+    ASSERT_EQ(ctx.at<double>(42u), 41.);
+    ASSERT_TRUE(ctx.erase<int>());
+
+    ASSERT_FALSE(cctx.contains<int>());
+    ASSERT_EQ(ctx.find<int>(), nullptr);
+
+    ctx.emplace_hint<char>(entt::type_id<int>().hash(), 'c');
+
+    ASSERT_FALSE(cctx.contains<int>());
+    ASSERT_EQ(ctx.find<int>(), nullptr);
+    ASSERT_EQ(ctx.at<char>(entt::type_id<int>().hash()), 'c');
+}
+
 TEST(Registry, Functionalities) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -366,6 +464,57 @@ TEST(Registry, Move) {
     ASSERT_EQ(test.parent, &registry);
 }
 
+TEST(Registry, StaticTypeIndex) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto &cregistry = registry;
+
+    ASSERT_TRUE(cregistry.storage<indexed_type>().empty());
+
+    registry.emplace<indexed_type>(entity, 42);
+
+    ASSERT_EQ(&registry.storage<indexed_type>(), &cregistry.storage<indexed_type>());
+    ASSERT_EQ(&registry.storage<indexed_type>(), &registry.storage(entt::type_id<indexed_type>().hash())->second);
+    ASSERT_EQ(cregistry.get<indexed_type>(entity).value, 42);
+
+    auto &&other = registry.storage<indexed_type>("other"_hs);
+
+    ASSERT_NE(&other, &registry.storage<indexed_type>());
+    ASSERT_TRUE(other.empty());
+
+    entt::registry moved{std::move(registry)};
+
+    ASSERT_TRUE(moved.all_of<indexed_type>(entity));
+    ASSERT_EQ(moved.get<indexed_type>(entity).value, 42);
+}
+
+TEST(Registry, DefaultPoolLookup) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    const auto &cregistry = registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity, 42);
+    registry.storage<int>("other"_hs).emplace(entity, 3);
+
+    ASSERT_EQ(&registry.storage<int>(), &cregistry.storage<int>());
+    ASSERT_EQ(&registry.storage<int>(), &registry.storage(entt::type_id<int>().hash())->second);
+    ASSERT_EQ(&registry.storage<int>("other"_hs), &cregistry.storage<int>("other"_hs));
+    ASSERT_NE(&registry.storage<int>(), &registry.storage<int>("other"_hs));
+
+    ASSERT_EQ(cregistry.get<int>(entity), 42);
+    ASSERT_EQ(cregistry.storage<int>("other"_hs).get(entity), 3);
+
+    entt::registry other{std::move(registry)};
+    registry = {};
+
+    ASSERT_TRUE(cregistry.storage<int>().empty());
+    ASSERT_EQ(other.get<int>(entity), 42);
+}
+
 TEST(Registry, ReplaceAggregate) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -384,6 +533,30 @@ TEST(Registry, EmplaceOrReplaceAggregate) {
     ASSERT_EQ(instance.value, 42);
 }
 
+TEST(Registry, ReserveComponents) {
+    entt::registry registry;
+    auto group = registry.group(entt::get<int, char>);
+
+    registry.reserve<int, char>(ENTT_SPARSE_PAGE + 1u);
+
+    ASSERT_GE(registry.capacity(), ENTT_SPARSE_PAGE + 1u);
+    ASSERT_GE(registry.storage<int>().capacity(), ENTT_SPARSE_PAGE + 1u);
+    ASSERT_GE(registry.storage<char>().capacity(), ENTT_SPARSE_PAGE + 1u);
+    ASSERT_EQ(registry.storage<double>().capacity(), 0u);
+    ASSERT_EQ(registry.storage<int>().extent(), 2 * ENTT_SPARSE_PAGE);
+    ASSERT_EQ(registry.storage<char>().extent(), 2 * ENTT_SPARSE_PAGE);
+    ASSERT_EQ(registry.storage<double>().extent(), 0u);
+    ASSERT_GE(group.handle().capacity(), ENTT_SPARSE_PAGE + 1u);
+    ASSERT_EQ(group.handle().extent(), 2 * ENTT_SPARSE_PAGE);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 3);
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_TRUE(group.contains(entity));
+}
+
 TEST(Registry, Identifiers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -407,6 +580,50 @@ TEST(Registry, Identifiers) {
     ASSERT_EQ(registry.current(invalid), traits_type::to_version(entt::tombstone));
 }
 
+TEST(Registry, ValidN) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    std::vector<entt::entity> entities(70u);
+    std::uint64_t out[2u]{~std::uint64_t{}, ~std::uint64_t{}};
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities[3u]);
+    registry.destroy(entities[65u]);
+    entities.push_back(traits_type::combine(traits_type::to_entity(entities.back()) + 1u, {}));
+    entities.push_back(entt::null);
+
+    ASSERT_EQ(registry.valid_n(entities.begin(), entities.end(), out), 68u);
+    ASSERT_EQ(out[0u], ~std::uint64_t{} & ~(std::uint64_t{1u} << 3u));
+    ASSERT_EQ(out[1u], std::uint64_t{0x3Du});
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(registry.valid(entities[pos]), static_cast<bool>((out[pos / 64u] >> (pos % 64u)) & 1u));
+    }
+
+    ASSERT_EQ(registry.valid_n(entities.begin(), entities.begin(), out), 0u);
+}
+
+TEST(Registry, CurrentN) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(20u);
+    std::vector<entt::registry::version_type> out(entities.size() + 1u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities[7u]);
+    registry.destroy(entities[11u]);
+    entities.push_back(entt::null);
+
+    registry.current_n(entities.begin(), entities.end(), out.data());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(out[pos], registry.current(entities[pos]));
+    }
+
+    ASSERT_NE(out[7u], entt::to_version(entities[7u]));
+    ASSERT_EQ(out[8u], entt::to_version(entities[8u]));
+}
+
 TEST(Registry, Data) {
     entt::registry registry;
 
@@ -419,8 +636,9 @@ TEST(Registry, Data) {
     const auto other = registry.create();
     registry.release(entity);
 
-    ASSERT_NE(*std::as_const(registry).data(), entity);
-    ASSERT_EQ(*(std::as_const(registry).data() + 1u), other);
+    ASSERT_EQ(*std::as_const(registry).data(), other);
+    ASSERT_NE(*(std::as_const(registry).data() + 1u), entity);
+    ASSERT_EQ(registry.current(*(std::as_const(registry).data() + 1u)), registry.current(entity));
 }
 
 TEST(Registry, CreateManyEntitiesAtOnce) {
@@ -640,6 +858,37 @@ TEST(Registry, RangeDestroy) {
     ASSERT_EQ(registry.storage<int>().size(), 0u);
 }
 
+TEST(Registry, DestroyManyWithListener) {
+    entt::registry registry;
+    entt::entity entities[6u];
+    listener listener;
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities) + 3u, std::end(entities));
+    registry.insert<double>(std::begin(entities), std::begin(entities) + 2u);
+
+    registry.on_destroy<int>().connect<&listener::incr<int>>(listener);
+    registry.on_destroy<char>().connect<&listener::incr<char>>(listener);
+
+    const auto view = registry.view<double>();
+    registry.destroy(view.begin(), view.end());
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_FALSE(registry.valid(entities[0u]));
+    ASSERT_FALSE(registry.valid(entities[1u]));
+    ASSERT_EQ(registry.storage<int>().size(), 4u);
+    ASSERT_EQ(registry.storage<char>().size(), 3u);
+    ASSERT_TRUE(registry.storage<double>().empty());
+
+    registry.destroy(std::begin(entities) + 2u, std::end(entities));
+
+    ASSERT_EQ(listener.counter, 9);
+    ASSERT_EQ(registry.alive(), 0u);
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.storage<char>().empty());
+}
+
 TEST(Registry, StableDestroy) {
     entt::registry registry;
     const auto iview = registry.view<int>();
@@ -844,6 +1093,111 @@ TEST(Registry, Orphans) {
     });
 }
 
+TEST(Registry, Reset) {
+    entt::registry registry;
+    entt::entity entities[4u];
+    listener listener;
+
+    registry.on_destroy<int>().connect<&listener::incr<int>>(listener);
+    registry.on_destroy<char>().connect<&listener::incr<char>>(listener);
+
+    const auto group = registry.group<int>(entt::get<char>);
+    const auto view = registry.view<double>(entt::exclude<char>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::begin(entities) + 2u);
+    registry.insert<double>(std::begin(entities) + 2u, std::end(entities));
+    registry.disable(entities[3u]);
+    registry.destroy(entities[0u]);
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(group.size(), 1u);
+
+    const auto capacity = registry.storage<int>().capacity();
+    registry.reset();
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(registry.alive(), 0u);
+    ASSERT_EQ(registry.size(), 0u);
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.storage<char>().empty());
+    ASSERT_TRUE(registry.storage<double>().empty());
+    ASSERT_EQ(registry.storage<int>().capacity(), capacity);
+    ASSERT_EQ(group.size(), 0u);
+    ASSERT_EQ(view.size_hint(), 0u);
+
+    const auto entity = registry.create();
+
+    ASSERT_EQ(entity, entt::entity{0});
+    ASSERT_TRUE(registry.enabled(entity));
+
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(*group.begin(), entity);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(listener.counter, 4);
+    ASSERT_EQ(group.size(), 0u);
+}
+
+TEST(Registry, Visit) {
+    entt::registry registry;
+    entt::entity entities[5u]{};
+    entt::entity other[3u]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.create(std::begin(other), std::end(other));
+
+    registry.emplace<int>(entities[1u]);
+    registry.insert<char>(std::begin(other), std::end(other));
+    registry.emplace<char>(entities[0u]);
+    registry.emplace<char>(entities[3u]);
+    registry.emplace<double>(other[0u]);
+
+    const entt::entity range[3u]{entities[0u], entities[1u], entities[3u]};
+    std::size_t visited{};
+
+    registry.visit(std::begin(range), std::end(range), [&](const entt::id_type id, entt::sparse_set &cpool, const entt::entity *first, const entt::entity *last) {
+        ASSERT_NE(id, entt::type_id<double>().hash());
+        ASSERT_EQ(&cpool, &registry.storage(id)->second);
+
+        if(id == entt::type_id<int>().hash()) {
+            ASSERT_EQ(last - first, 1);
+            ASSERT_EQ(*first, entities[1u]);
+        } else {
+            ASSERT_EQ(id, entt::type_id<char>().hash());
+            ASSERT_EQ(last - first, 2);
+            ASSERT_TRUE(std::find(first, last, entities[0u]) != last);
+            ASSERT_TRUE(std::find(first, last, entities[3u]) != last);
+        }
+
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, 2u);
+
+    std::as_const(registry).visit(std::begin(range), std::end(range), [](auto, const entt::sparse_set &cpool, auto first, auto last) {
+        ASSERT_TRUE(std::all_of(first, last, [&cpool](const auto entt) { return cpool.contains(entt); }));
+        ASSERT_NE(first, last);
+    });
+
+    registry.visit(std::begin(range), std::end(range), [](auto, entt::sparse_set &cpool, auto first, auto last) {
+        cpool.erase(first, last);
+    });
+
+    ASSERT_TRUE(registry.orphan(entities[0u]));
+    ASSERT_TRUE(registry.orphan(entities[1u]));
+    ASSERT_TRUE(registry.orphan(entities[3u]));
+    ASSERT_EQ(registry.storage<char>().size(), 3u);
+    ASSERT_EQ(registry.storage<double>().size(), 1u);
+
+    registry.visit(std::begin(range), std::end(range), [](auto &&...) { FAIL(); });
+}
+
 TEST(Registry, View) {
     entt::registry registry;
     auto mview = registry.view<int, char>();
@@ -1207,6 +1561,219 @@ TEST(Registry, NestedGroups) {
     ASSERT_EQ(g3.size(), 0u);
 }
 
+TEST(Registry, ReserveEntities) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[1u]);
+
+    const auto entity = registry.reserve_entity();
+    entt::entity other[2u];
+    registry.reserve_entities(std::begin(other), std::end(other));
+
+    ASSERT_EQ(entity, entt::entity{3});
+    ASSERT_EQ(other[0u], entt::entity{4});
+    ASSERT_EQ(other[1u], entt::entity{5});
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_EQ(registry.reserved_entities(), 3u);
+    ASSERT_EQ(registry.alive(), 2u);
+
+    registry.materialize();
+
+    ASSERT_EQ(registry.reserved_entities(), 0u);
+    ASSERT_EQ(registry.alive(), 5u);
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other[0u]));
+    ASSERT_TRUE(registry.valid(other[1u]));
+
+    // released identifiers are still recycled first
+    const auto recycled = registry.create();
+
+    ASSERT_EQ(entt::to_entity(recycled), entt::to_entity(entities[1u]));
+    ASSERT_EQ(registry.create(), entt::entity{6});
+
+    std::thread threads[4u]{};
+    entt::entity reserved[4u][16u];
+
+    for(auto pos = 0u; pos < 4u; ++pos) {
+        threads[pos] = std::thread{[&registry, &block = reserved[pos]]() {
+            for(auto &&elem: block) {
+                elem = registry.reserve_entity();
+            }
+        }};
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    registry.materialize();
+
+    std::unordered_set<entt::entity> unique{};
+
+    for(auto &&block: reserved) {
+        for(auto elem: block) {
+            ASSERT_TRUE(registry.valid(elem));
+            unique.insert(elem);
+        }
+    }
+
+    ASSERT_EQ(unique.size(), 64u);
+    ASSERT_EQ(registry.alive(), 71u);
+}
+
+TEST(RegistryDeathTest, ReserveEntities) {
+    entt::registry registry;
+    static_cast<void>(registry.reserve_entity());
+
+    ASSERT_DEATH(static_cast<void>(registry.create()), "");
+    ASSERT_DEATH(registry.reset(), "");
+}
+
+TEST(Registry, EntityRecycling) {
+    entt::registry registry;
+    entt::entity entities[8u];
+
+    ASSERT_EQ(registry.entity_recycling(), entt::recycle_policy::last_released);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.entity_recycling(entt::recycle_policy::lowest_id);
+    registry.destroy(entities[5u]);
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[6u]);
+
+    ASSERT_EQ(registry.entity_recycling(), entt::recycle_policy::lowest_id);
+    ASSERT_EQ(entt::to_entity(registry.create()), 1u);
+    ASSERT_EQ(entt::to_entity(registry.create()), 5u);
+    ASSERT_EQ(entt::to_entity(registry.create()), 6u);
+    ASSERT_EQ(registry.create(), entt::entity{8});
+}
+
+TEST(Registry, Freeze) {
+    entt::registry registry;
+    entt::entity entities[64u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    static_cast<void>(registry.storage<int>());
+    static_cast<void>(registry.storage<char>());
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.freeze();
+
+    ASSERT_TRUE(registry.frozen());
+
+    std::thread first{[&]() {
+        for(auto entity: entities) {
+            registry.emplace<int>(entity, 42);
+        }
+    }};
+
+    std::thread second{[&]() {
+        for(auto entity: entities) {
+            registry.emplace<char>(entity, 'c');
+        }
+
+        registry.erase<char>(std::begin(entities), std::begin(entities) + 32u);
+    }};
+
+    first.join();
+    second.join();
+
+    ASSERT_EQ(registry.storage<int>().size(), 64u);
+    ASSERT_EQ(registry.storage<char>().size(), 32u);
+    ASSERT_EQ(registry.get<int>(entities[7u]), 42);
+    ASSERT_EQ(registry.get<char>(entities[42u]), 'c');
+
+    registry.freeze(false);
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.destroy(entities[0u]);
+
+    ASSERT_FALSE(registry.valid(entities[0u]));
+}
+
+TEST(RegistryDeathTest, Freeze) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.freeze();
+
+    ASSERT_DEATH(static_cast<void>(registry.create()), "");
+    ASSERT_DEATH(registry.destroy(entity), "");
+    ASSERT_DEATH(registry.emplace<int>(entity), "");
+    ASSERT_DEATH(registry.reset(), "");
+    ASSERT_DEATH((registry.group<int>(entt::get<char>)), "");
+}
+
+TEST(Registry, LazyNestedGroups) {
+    entt::registry registry;
+    entt::entity entities[10];
+
+    ASSERT_EQ(registry.group_maintenance(), entt::group_policy::eager);
+
+    registry.group_maintenance(entt::group_policy::lazy);
+
+    ASSERT_EQ(registry.group_maintenance(), entt::group_policy::lazy);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ((registry.group<int>(entt::get<char>, entt::exclude<double>).size()), 10u);
+    const auto stale = registry.group<int>(entt::get<char>);
+
+    ASSERT_EQ(stale.size(), 10u);
+
+    for(auto i = 0u; i < 5u; ++i) {
+        registry.emplace<double>(entities[i * 2]);
+        registry.erase<int>(entities[i * 2 + 1]);
+    }
+
+    // groups aren't arranged until requested again
+    ASSERT_EQ(stale.size(), 10u);
+
+    const auto g1 = registry.group<int>(entt::get<char>, entt::exclude<double>);
+    const auto g2 = registry.group<int>(entt::get<char>);
+
+    ASSERT_EQ(g1.size(), 0u);
+    ASSERT_EQ(g2.size(), 5u);
+
+    for(auto i = 0u; i < 5u; ++i) {
+        registry.emplace<int>(entities[i * 2 + 1]);
+        registry.emplace<float>(entities[i * 2]);
+        registry.erase<double>(entities[i * 2]);
+    }
+
+    const auto g3 = registry.group<int, float>(entt::get<char>, entt::exclude<double>);
+
+    ASSERT_EQ((registry.group<int>(entt::get<char>, entt::exclude<double>).size()), 10u);
+    ASSERT_EQ((registry.group<int>(entt::get<char>).size()), 10u);
+    ASSERT_EQ(g3.size(), 5u);
+
+    for(auto i = 0u; i < 5u; ++i) {
+        ASSERT_TRUE(g1.contains(entities[i * 2 + 1]));
+        ASSERT_TRUE(g1.contains(entities[i * 2]));
+        ASSERT_FALSE(g3.contains(entities[i * 2 + 1]));
+        ASSERT_TRUE(g3.contains(entities[i * 2]));
+    }
+
+    registry.emplace<double>(entities[0u]);
+    registry.group_maintenance(entt::group_policy::eager);
+
+    ASSERT_EQ(g1.size(), 9u);
+    ASSERT_EQ(g2.size(), 10u);
+    ASSERT_EQ(g3.size(), 4u);
+
+    registry.erase<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(g1.size(), 0u);
+    ASSERT_EQ(g2.size(), 0u);
+    ASSERT_EQ(g3.size(), 0u);
+}
+
 TEST(Registry, SortSingle) {
     entt::registry registry;
 
@@ -1227,6 +1794,24 @@ TEST(Registry, SortSingle) {
     }
 }
 
+TEST(Registry, SortParallel) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 10000; ++pos) {
+        registry.emplace<int>(registry.create(), (pos * 7919) % 10007);
+    }
+
+    registry.sort<int>(std::less<int>{}, entt::parallel_sort{4u});
+
+    const auto &storage = registry.storage<int>();
+
+    ASSERT_TRUE(std::is_sorted(storage.begin(), storage.end()));
+
+    for(auto [entity, value]: registry.view<int>().each()) {
+        ASSERT_EQ(registry.get<int>(entity), value);
+    }
+}
+
 TEST(Registry, SortMulti) {
     entt::registry registry;
 
@@ -1414,6 +1999,51 @@ TEST(Registry, SignalWhenDestroying) {
     ASSERT_FALSE(registry.valid(entity));
 }
 
+TEST(Registry, SignalFree) {
+    using storage_type = entt::storage_traits<entt::entity, signal_free>::storage_type;
+    static_assert(std::is_same_v<storage_type, entt::basic_storage<entt::entity, signal_free>>);
+
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<signal_free>(entity, 42);
+    registry.patch<signal_free>(entity, [](auto &elem) { ++elem.value; });
+
+    ASSERT_TRUE(registry.all_of<signal_free>(entity));
+    ASSERT_EQ(registry.get<signal_free>(entity).value, 43);
+
+    registry.destroy(entity);
+
+    ASSERT_TRUE(registry.storage<signal_free>().empty());
+}
+
+TEST(Registry, MemoryUsage) {
+    entt::registry registry;
+
+    ASSERT_EQ(registry.memory_usage().total(), 0u);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+
+    auto usage = registry.memory_usage();
+    auto expected = registry.storage<int>().memory_usage();
+    expected += registry.storage<char>().memory_usage();
+
+    ASSERT_GT(usage.total(), expected.total());
+    ASSERT_EQ(usage.payload, expected.payload);
+    ASSERT_EQ(usage.groups, 0u);
+
+    const auto total = usage.total();
+
+    static_cast<void>(registry.group<int>(entt::get<char>));
+    static_cast<void>(registry.group(entt::get<int, char>));
+    usage = registry.memory_usage();
+
+    ASSERT_NE(usage.groups, 0u);
+    ASSERT_EQ(usage.total(), total + usage.groups);
+}
+
 TEST(Registry, Insert) {
     entt::registry registry;
     entt::entity entities[3u];
@@ -1451,6 +2081,38 @@ TEST(Registry, Insert) {
     ASSERT_EQ(registry.get<float>(entities[2u]), 2.f);
 }
 
+TEST(Registry, ParInsert) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    std::size_t chunks{};
+    listener listener;
+
+    auto executor = [&chunks](const std::size_t count, const auto &task) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            task(pos);
+        }
+
+        chunks += count;
+    };
+
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.par_insert(executor, std::begin(entities), std::end(entities), 42);
+
+    ASSERT_EQ(chunks, 1u);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, entities[2u]);
+
+    for(auto entity: entities) {
+        ASSERT_EQ(registry.get<int>(entity), 42);
+    }
+
+    registry.par_insert<empty_type>(executor, std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(chunks, 1u);
+    ASSERT_TRUE(registry.all_of<empty_type>(entities[1u]));
+}
+
 TEST(Registry, Erase) {
     entt::registry registry;
     const auto iview = registry.view<int>();
@@ -1898,7 +2560,7 @@ TEST(Registry, AssignEntities) {
 
     entt::registry other;
     const auto *data = registry.data();
-    other.assign(data, data + registry.size(), registry.released());
+    other.assign(data, data + registry.size(), registry.alive());
 
     ASSERT_EQ(registry.size(), other.size());
     ASSERT_TRUE(other.valid(entities[0]));
@@ -1908,6 +2570,67 @@ TEST(Registry, AssignEntities) {
     ASSERT_EQ(traits_type::to_entity(other.create()), traits_type::to_integral(entities[1]));
 }
 
+TEST(Registry, CopyTo) {
+    entt::registry registry;
+    entt::registry other;
+    entt::entity entities[3u];
+    entt::entity copies[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[0u], 0);
+    registry.emplace<int>(entities[2u], 2);
+    registry.emplace<char>(entities[1u], 'c');
+    registry.emplace<empty_type>(entities[2u]);
+
+    static_cast<void>(other.storage<int>());
+    static_cast<void>(other.storage<char>());
+    static_cast<void>(other.storage<empty_type>());
+    static_cast<void>(other.create());
+
+    ASSERT_EQ(registry.copy_to(other, std::begin(entities), std::end(entities), std::begin(copies)), std::end(copies));
+
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(other.alive(), 4u);
+    ASSERT_EQ(other.storage<int>().size(), 2u);
+
+    ASSERT_EQ(other.get<int>(copies[0u]), 0);
+    ASSERT_EQ(other.get<char>(copies[1u]), 'c');
+    ASSERT_EQ(other.get<int>(copies[2u]), 2);
+    ASSERT_TRUE(other.all_of<empty_type>(copies[2u]));
+    ASSERT_FALSE((other.any_of<char, empty_type>(copies[0u])));
+
+    ASSERT_EQ(registry.get<int>(entities[2u]), 2);
+    ASSERT_EQ(registry.get<char>(entities[1u]), 'c');
+}
+
+TEST(Registry, MoveTo) {
+    entt::registry registry;
+    entt::registry other;
+    entt::entity entities[2u];
+    entt::entity moved[2u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<std::unique_ptr<int>>(entities[0u], std::make_unique<int>(42));
+    registry.emplace<std::unique_ptr<int>>(entities[1u], std::make_unique<int>(3));
+    registry.emplace<char>(entities[1u], 'c');
+
+    static_cast<void>(other.storage<std::unique_ptr<int>>());
+    static_cast<void>(other.storage<char>());
+
+    const auto &view = registry.view<std::unique_ptr<int>>();
+    registry.move_to(other, view.begin(), view.end(), std::begin(moved));
+
+    ASSERT_TRUE(registry.empty());
+    ASSERT_EQ(registry.storage<std::unique_ptr<int>>().size(), 0u);
+    ASSERT_EQ(registry.storage<char>().size(), 0u);
+
+    ASSERT_EQ(other.alive(), 2u);
+    ASSERT_EQ(*other.get<std::unique_ptr<int>>(moved[0u]), 3);
+    ASSERT_EQ(other.get<char>(moved[0u]), 'c');
+    ASSERT_EQ(*other.get<std::unique_ptr<int>>(moved[1u]), 42);
+    ASSERT_FALSE(other.all_of<char>(moved[1u]));
+}
+
 TEST(Registry, ScramblingPoolsIsAllowed) {
     entt::registry registry;
     registry.on_destroy<int>().connect<&listener::sort<int>>();
@@ -2077,3 +2800,99 @@ TEST(Registry, NoEtoType) {
 
     ASSERT_EQ((std::get<0>(view.get<no_eto_type, int>(entity))), (std::get<0>(cview.get<const no_eto_type, const int>(entity))));
 }
+
+void count_scratch(std::size_t &value, entt::basic_registry<scratch_entity, arena_allocator<scratch_entity>> &, const scratch_entity) {
+    ++value;
+}
+
+TEST(Registry, CustomAllocator) {
+    arena scratch{};
+
+    {
+        entt::basic_registry<scratch_entity, arena_allocator<scratch_entity>> registry{arena_allocator<scratch_entity>{scratch}};
+        std::size_t counter{};
+
+        registry.on_construct<int>().connect<&count_scratch>(counter);
+
+        ASSERT_EQ(registry.get_allocator(), arena_allocator<scratch_entity>{scratch});
+        ASSERT_EQ(registry.storage<int>().get_allocator(), arena_allocator<int>{scratch});
+
+        for(auto pos = 0; pos < 100; ++pos) {
+            const auto entity = registry.create();
+            registry.emplace<int>(entity, pos);
+            registry.emplace<char>(entity, 'c');
+        }
+
+        registry.ctx().emplace<double>(.3);
+
+        ASSERT_EQ(counter, 100u);
+        ASSERT_EQ(registry.view<int>().size(), 100u);
+        ASSERT_EQ((registry.view<int, char>().size_hint()), 100u);
+        ASSERT_NE(scratch.allocated, 0u);
+        ASSERT_NE(scratch.allocated, scratch.deallocated);
+
+        decltype(registry) other{std::move(registry)};
+
+        ASSERT_EQ((other.group<int>(entt::get<char>).size()), 100u);
+        ASSERT_EQ((other.group<>(entt::get<char, double>).size()), 0u);
+    }
+
+    ASSERT_NE(scratch.allocated, 0u);
+    ASSERT_EQ(scratch.allocated, scratch.deallocated);
+}
+
+TEST(Registry, EnableDisable) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 42);
+    registry.insert<char>(std::begin(entities), std::end(entities), 'c');
+
+    ASSERT_TRUE(registry.enabled(entities[1u]));
+    ASSERT_TRUE(registry.mask().empty());
+
+    ASSERT_TRUE(registry.disable(entities[1u]));
+    ASSERT_FALSE(registry.disable(entities[1u]));
+    ASSERT_FALSE(registry.enabled(entities[1u]));
+    ASSERT_EQ(registry.mask().size(), 1u);
+
+    ASSERT_EQ(registry.storage<int>().size(), 3u);
+    ASSERT_EQ(registry.get<int>(entities[1u]), 42);
+    ASSERT_TRUE((registry.all_of<int, char>(entities[1u])));
+
+    auto view = registry.view<int, char>();
+    std::size_t count{};
+
+    ASSERT_EQ(view.mask(), &registry.mask());
+    ASSERT_FALSE(view.contains(entities[1u]));
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+
+    view.each([&count, &entities](const auto entity, int, char) {
+        ASSERT_NE(entity, entities[1u]);
+        ++count;
+    });
+
+    registry.view<int>().each([&count](int) { ++count; });
+    registry.view(entt::exclude<>).each([&count](auto) { ++count; });
+    registry.group<int>(entt::get<char>).each([&count](int, char) { ++count; });
+
+    ASSERT_EQ(count, 8u);
+    ASSERT_FALSE(registry.view<int>().contains(entities[1u]));
+    ASSERT_FALSE((registry.group<int>(entt::get<char>).contains(entities[1u])));
+
+    view.mask(nullptr);
+
+    ASSERT_TRUE(view.contains(entities[1u]));
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+
+    ASSERT_TRUE(registry.enable(entities[1u]));
+    ASSERT_TRUE(registry.enabled(entities[1u]));
+    ASSERT_TRUE(registry.view<int>().contains(entities[1u]));
+
+    registry.disable(entities[2u]);
+    registry.destroy(entities[2u]);
+
+    ASSERT_TRUE(registry.mask().empty());
+    ASSERT_TRUE(registry.enabled(registry.create()));
+}
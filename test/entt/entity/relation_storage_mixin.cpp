@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/relation_storage_mixin.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/view.hpp>
+
+struct child_of {
+    entt::entity parent{entt::null};
+};
+
+struct child_of_target {
+    entt::entity operator()(const child_of &elem) const {
+        return elem.parent;
+    }
+};
+
+template<>
+struct entt::storage_traits<entt::entity, child_of> {
+    using storage_type = entt::sigh_storage_mixin<entt::relation_storage_mixin<entt::basic_storage<entt::entity, child_of>, child_of_target>>;
+};
+
+template<typename Storage>
+std::vector<entt::entity> sources(const Storage &storage, const entt::entity target) {
+    std::vector<entt::entity> result{};
+
+    for(auto entt: storage.sources(target)) {
+        result.push_back(entt);
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(RelationStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<child_of>();
+
+    entt::entity entities[5u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(storage.count(entities[0u]), 0u);
+    ASSERT_TRUE(sources(storage, entities[0u]).empty());
+
+    registry.emplace<child_of>(entities[1u], entities[0u]);
+    registry.emplace<child_of>(entities[2u], entities[0u]);
+    registry.emplace<child_of>(entities[3u], entities[1u]);
+    registry.emplace<child_of>(entities[4u]);
+
+    ASSERT_EQ(storage.count(entities[0u]), 2u);
+    ASSERT_EQ(storage.count(entities[1u]), 1u);
+    ASSERT_EQ(storage.count(entt::entity{entt::null}), 0u);
+    ASSERT_EQ(sources(storage, entities[0u]), (std::vector<entt::entity>{entities[1u], entities[2u]}));
+    ASSERT_EQ(sources(storage, entities[1u]), (std::vector<entt::entity>{entities[3u]}));
+
+    registry.replace<child_of>(entities[2u], entities[1u]);
+
+    ASSERT_EQ(sources(storage, entities[0u]), (std::vector<entt::entity>{entities[1u]}));
+    ASSERT_EQ(sources(storage, entities[1u]), (std::vector<entt::entity>{entities[2u], entities[3u]}));
+
+    registry.patch<child_of>(entities[4u], [&](auto &elem) { elem.parent = entities[0u]; });
+
+    ASSERT_EQ(sources(storage, entities[0u]), (std::vector<entt::entity>{entities[1u], entities[4u]}));
+
+    registry.remove<child_of>(entities[1u]);
+    registry.erase<child_of>(entities[3u]);
+
+    ASSERT_EQ(sources(storage, entities[0u]), (std::vector<entt::entity>{entities[4u]}));
+    ASSERT_EQ(sources(storage, entities[1u]), (std::vector<entt::entity>{entities[2u]}));
+
+    registry.destroy(std::begin(entities) + 2u, std::end(entities));
+
+    ASSERT_EQ(storage.count(entities[0u]), 0u);
+    ASSERT_EQ(storage.count(entities[1u]), 0u);
+
+    registry.insert<child_of>(std::begin(entities), std::begin(entities) + 2u, child_of{entities[0u]});
+
+    ASSERT_EQ(sources(storage, entities[0u]), (std::vector<entt::entity>{entities[0u], entities[1u]}));
+
+    registry.clear<child_of>();
+
+    ASSERT_EQ(storage.count(entities[0u]), 0u);
+}
+
+TEST(RelationStorageMixin, View) {
+    entt::registry registry;
+
+    const auto parent = registry.create();
+    entt::entity entities[4u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto entt: entities) {
+        registry.emplace<child_of>(entt, parent);
+    }
+
+    registry.emplace<int>(entities[1u], 1);
+    registry.emplace<int>(entities[3u], 3);
+
+    const auto range = registry.storage<child_of>().sources(parent);
+    std::vector<entt::entity> visited{};
+    int sum{};
+
+    registry.view<child_of, int>().each(range.begin(), range.end(), [&](const entt::entity entt, const child_of &elem, int value) {
+        ASSERT_EQ(elem.parent, parent);
+        visited.push_back(entt);
+        sum += value;
+    });
+
+    std::sort(visited.begin(), visited.end());
+
+    ASSERT_EQ(visited, (std::vector<entt::entity>{entities[1u], entities[3u]}));
+    ASSERT_EQ(sum, 4);
+
+    std::size_t count{};
+    registry.view<child_of>().each(range.begin(), range.end(), [&](const child_of &elem) {
+        ASSERT_EQ(elem.parent, parent);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 4u);
+}
@@ -0,0 +1,305 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_storage.hpp>
+#include <entt/entity/runtime_view.hpp>
+#include <entt/entity/snapshot.hpp>
+
+struct counted_type {
+    counted_type()
+        : value{std::to_string(++alive)} {}
+
+    counted_type(const counted_type &other)
+        : value{other.value} {
+        ++alive;
+    }
+
+    counted_type(counted_type &&other)
+        : value{std::move(other.value)} {
+        ++alive;
+    }
+
+    ~counted_type() {
+        --alive;
+    }
+
+    inline static int alive = 0;
+    std::string value;
+};
+
+struct move_only_type {
+    move_only_type(int elem)
+        : value{elem} {}
+
+    move_only_type(const move_only_type &) = delete;
+    move_only_type(move_only_type &&) = default;
+
+    int value;
+};
+
+struct RuntimeStorage: ::testing::Test {
+    void SetUp() override {
+        counted_type::alive = 0;
+    }
+};
+
+TEST_F(RuntimeStorage, Functionalities) {
+    const auto &layout = entt::type_layout_of<counted_type>();
+    entt::runtime_storage pool{layout};
+
+    ASSERT_EQ(&pool.layout(), &layout);
+    ASSERT_EQ(pool.type(), entt::type_id<counted_type>());
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_TRUE(pool.empty());
+
+    pool.emplace(entt::entity{3});
+    ASSERT_EQ(counted_type::alive, 1);
+
+    counted_type instance{};
+    instance.value = "copy";
+    pool.emplace(entt::entity{1}, &instance);
+
+    instance.value = "move";
+    pool.move_emplace(entt::entity{42}, &instance);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.capacity(), ENTT_PACKED_PAGE);
+    ASSERT_EQ(counted_type::alive, 4);
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{3}))->value, "1");
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{1}))->value, "copy");
+    ASSERT_EQ(static_cast<const counted_type *>(std::as_const(pool).get(entt::entity{42}))->value, "move");
+    ASSERT_TRUE(instance.value.empty());
+
+    pool.erase(entt::entity{3});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(counted_type::alive, 3);
+    ASSERT_FALSE(pool.contains(entt::entity{3}));
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{42}))->value, "move");
+
+    ASSERT_EQ(pool.index(entt::entity{1}), 1u);
+
+    pool.swap_elements(entt::entity{1}, entt::entity{42});
+
+    ASSERT_EQ(counted_type::alive, 3);
+    ASSERT_EQ(pool.index(entt::entity{1}), 0u);
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{1}))->value, "copy");
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{42}))->value, "move");
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(counted_type::alive, 1);
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST_F(RuntimeStorage, EmplaceWith) {
+    entt::runtime_storage pool{entt::type_layout_of<move_only_type>()};
+
+    ASSERT_EQ(pool.emplace(entt::entity{0}), pool.end());
+    ASSERT_FALSE(pool.contains(entt::entity{0}));
+
+    void *elem = pool.emplace_with(entt::entity{0}, [](void *instance) { ::new(instance) move_only_type{42}; });
+
+    ASSERT_TRUE(pool.contains(entt::entity{0}));
+    ASSERT_EQ(elem, pool.get(entt::entity{0}));
+    ASSERT_EQ(static_cast<move_only_type *>(elem)->value, 42);
+
+    move_only_type other{3};
+
+    ASSERT_EQ(pool.emplace(entt::entity{1}, &other), pool.end());
+    ASSERT_NE(pool.move_emplace(entt::entity{1}, &other), pool.end());
+    ASSERT_EQ(static_cast<move_only_type *>(pool.get(entt::entity{1}))->value, 3);
+}
+
+TEST_F(RuntimeStorage, Pages) {
+    entt::runtime_storage pool{entt::type_layout_of<counted_type>()};
+
+    pool.reserve(ENTT_PACKED_PAGE + 1u);
+
+    ASSERT_EQ(pool.capacity(), 2u * ENTT_PACKED_PAGE);
+    ASSERT_EQ(counted_type::alive, 0);
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE + 1u; ++pos) {
+        pool.emplace(entt::entity{static_cast<entt::id_type>(pos)});
+    }
+
+    ASSERT_EQ(counted_type::alive, ENTT_PACKED_PAGE + 1);
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{ENTT_PACKED_PAGE}))->value, std::to_string(ENTT_PACKED_PAGE + 1));
+    ASSERT_GE(pool.memory_usage().payload, 2u * ENTT_PACKED_PAGE * sizeof(counted_type));
+
+    pool.erase(entt::entity{0});
+
+    ASSERT_EQ(pool.capacity(), 2u * ENTT_PACKED_PAGE);
+    ASSERT_EQ(static_cast<counted_type *>(pool.get(entt::entity{ENTT_PACKED_PAGE}))->value, std::to_string(ENTT_PACKED_PAGE + 1));
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), ENTT_PACKED_PAGE);
+    ASSERT_EQ(counted_type::alive, ENTT_PACKED_PAGE);
+}
+
+TEST_F(RuntimeStorage, Destruction) {
+    {
+        entt::runtime_storage pool{entt::type_layout_of<counted_type>()};
+        pool.emplace(entt::entity{0});
+        pool.emplace(entt::entity{1});
+
+        ASSERT_EQ(counted_type::alive, 2);
+    }
+
+    ASSERT_EQ(counted_type::alive, 0);
+}
+
+TEST_F(RuntimeStorage, Registry) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    const auto entity = registry.create();
+    auto &&pool = registry.storage("counted"_hs, entt::type_layout_of<counted_type>());
+
+    ASSERT_EQ(&pool, &registry.storage("counted"_hs, entt::type_layout_of<counted_type>()));
+    ASSERT_EQ(&pool, &registry.storage("counted"_hs)->second);
+
+    pool.emplace(entity);
+
+    ASSERT_TRUE(pool.contains(entity));
+    ASSERT_EQ(counted_type::alive, 1);
+
+    registry.destroy(entity);
+
+    ASSERT_FALSE(pool.contains(entity));
+    ASSERT_EQ(counted_type::alive, 0);
+}
+
+TEST(RuntimeSchema, Functionalities) {
+    using namespace entt::literals;
+
+    entt::runtime_schema schema{};
+
+    ASSERT_EQ(schema.size(), 0u);
+    ASSERT_EQ(schema.begin(), schema.end());
+    ASSERT_EQ(*schema.layout().info, entt::type_id<entt::runtime_schema>());
+    ASSERT_TRUE(schema.layout().trivial);
+
+    schema.field<char>("c"_hs).field<double>("d"_hs).field<std::uint16_t>("s"_hs);
+
+    ASSERT_EQ(schema.size(), 3u);
+    ASSERT_EQ(schema.find("c"_hs)->offset, 0u);
+    ASSERT_EQ(schema.find("d"_hs)->offset, alignof(double));
+    ASSERT_EQ(schema.find("s"_hs)->offset, alignof(double) + sizeof(double));
+    ASSERT_EQ(schema.find("s"_hs)->layout, &entt::type_layout_of<std::uint16_t>());
+    ASSERT_EQ(schema.find("none"_hs), nullptr);
+
+    ASSERT_EQ(schema.layout().alignment, alignof(double));
+    ASSERT_EQ(schema.layout().size % alignof(double), 0u);
+    ASSERT_GE(schema.layout().size, alignof(double) + sizeof(double) + sizeof(std::uint16_t));
+
+    alignas(double) std::byte buffer[64u]{};
+
+    ASSERT_NE(schema.get<double>(buffer, "d"_hs), nullptr);
+    ASSERT_EQ(schema.get<int>(buffer, "d"_hs), nullptr);
+    ASSERT_EQ(schema.get<double>(buffer, "none"_hs), nullptr);
+
+    *schema.get<double>(buffer, "d"_hs) = 2.;
+
+    ASSERT_EQ(*schema.get<double>(static_cast<const void *>(buffer), "d"_hs), 2.);
+}
+
+TEST(RuntimeSchema, Storage) {
+    using namespace entt::literals;
+
+    entt::runtime_schema schema{};
+    schema.field<int>("hp"_hs).field<float>("speed"_hs);
+
+    entt::registry registry;
+    auto &&pool = registry.storage("modded"_hs, schema.layout());
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<char>(entity);
+    registry.emplace<char>(other);
+    pool.emplace(entity);
+
+    ASSERT_EQ(*schema.get<int>(pool.get(entity), "hp"_hs), 0);
+    ASSERT_EQ(*schema.get<float>(pool.get(entity), "speed"_hs), 0.f);
+
+    *schema.get<int>(pool.get(entity), "hp"_hs) = 42;
+    pool.emplace(other, pool.get(entity));
+    *schema.get<float>(pool.get(other), "speed"_hs) = 3.f;
+
+    ASSERT_EQ(*schema.get<int>(pool.get(other), "hp"_hs), 42);
+
+    pool.erase(entity);
+
+    ASSERT_EQ(*schema.get<float>(pool.get(other), "speed"_hs), 3.f);
+
+    entt::runtime_view view{};
+    view.iterate(registry.storage<char>()).iterate(pool);
+
+    ASSERT_EQ(view.size_hint(), 1u);
+
+    view.each([&](const auto entt) {
+        ASSERT_EQ(entt, other);
+        ASSERT_EQ(*schema.get<int>(pool.get(entt), "hp"_hs), 42);
+    });
+}
+
+TEST(RuntimeSchema, Snapshot) {
+    using namespace entt::literals;
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::runtime_schema schema{};
+    schema.field<int>("hp"_hs).field<double>("mana"_hs);
+
+    entt::registry src;
+    const auto entity = src.create();
+    auto &&pool = src.storage("modded"_hs, schema.layout());
+
+    *schema.get<double>(pool.get(*pool.emplace(entity)), "mana"_hs) = 3.;
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+
+    entt::snapshot{src}.storage(output, [&schema](auto &archive, const auto &curr, auto first, auto last) {
+        for(; first != last; ++first) {
+            archive.write(curr.get(*first), schema.layout().size);
+        }
+    });
+
+    entt::registry dst;
+    entt::binary_input_archive input{buffer};
+    traits_type::entity_type count{};
+
+    input(count);
+
+    ASSERT_EQ(count, 1u);
+
+    entt::id_type id{};
+    traits_type::entity_type length{};
+    entt::entity entt{};
+
+    input(id, length, entt);
+
+    ASSERT_EQ(id, "modded"_hs);
+    ASSERT_EQ(length, 1u);
+    ASSERT_EQ(entt, entity);
+
+    auto &&other = dst.storage(id, schema.layout());
+    std::vector<std::byte> instance(schema.layout().size);
+    input.read(instance.data(), instance.size());
+    other.emplace(dst.create(entt), instance.data());
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(*schema.get<double>(other.get(entt), "mana"_hs), 3.);
+    ASSERT_EQ(*schema.get<int>(other.get(entt), "hp"_hs), 0);
+}
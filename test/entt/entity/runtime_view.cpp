@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
@@ -6,6 +7,8 @@
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
 
+struct empty_type {};
+
 struct stable_type {
     static constexpr auto in_place_delete = true;
     int value;
@@ -158,6 +161,82 @@ TEST(RuntimeView, Each) {
     });
 }
 
+TEST(RuntimeView, EachWithElements) {
+    entt::registry registry;
+    entt::runtime_view view{};
+
+    const auto e0 = registry.create();
+    registry.emplace<int>(e0, 42);
+    registry.emplace<char>(e0, 'c');
+    registry.emplace<empty_type>(e0);
+
+    const auto e1 = registry.create();
+    registry.emplace<char>(e1);
+    registry.emplace<empty_type>(e1);
+
+    view.iterate(registry.storage<char>()).iterate(registry.storage<int>()).iterate(registry.storage<empty_type>());
+
+    ASSERT_EQ(view.size_hint(), 1u);
+
+    view.each([e0](const entt::entity entt, const void *const *elements) {
+        ASSERT_EQ(entt, e0);
+        ASSERT_EQ(*static_cast<const char *>(elements[0u]), 'c');
+        ASSERT_EQ(*static_cast<const int *>(elements[1u]), 42);
+        ASSERT_EQ(elements[2u], nullptr);
+    });
+}
+
+TEST(RuntimeView, EachWithManyElements) {
+    entt::registry registry;
+    entt::runtime_view view{};
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity, 0);
+    registry.emplace<char>(entity, 'c');
+
+    for(auto pos = 0u; pos < 16u; ++pos) {
+        view.iterate(registry.storage<int>()).iterate(registry.storage<char>());
+    }
+
+    std::size_t count{};
+
+    view.each([&count](const entt::entity, const void *const *elements) {
+        for(auto pos = 0u; pos < 32u; pos += 2u) {
+            ASSERT_EQ(*static_cast<const int *>(elements[pos]), 0);
+            ASSERT_EQ(*static_cast<const char *>(elements[pos + 1u]), 'c');
+        }
+
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(RuntimeView, Clear) {
+    entt::registry registry;
+    entt::runtime_view view{};
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    view.iterate(registry.storage<int>()).exclude(registry.storage<int>());
+
+    ASSERT_EQ(view.size_hint(), 1u);
+    ASSERT_FALSE(view.contains(entity));
+
+    view.clear();
+
+    ASSERT_EQ(view.size_hint(), 0u);
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_FALSE(view.contains(entity));
+
+    view.iterate(registry.storage<int>());
+
+    ASSERT_EQ(view.size_hint(), 1u);
+    ASSERT_TRUE(view.contains(entity));
+    ASSERT_EQ(*view.begin(), entity);
+}
+
 TEST(RuntimeView, EachWithHoles) {
     entt::registry registry;
     entt::runtime_view view{};
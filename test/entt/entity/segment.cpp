@@ -0,0 +1,91 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/segment.hpp>
+#include <entt/entity/storage.hpp>
+
+struct transform {
+    float x;
+    float y;
+};
+
+struct alignas(64) block_type {
+    std::byte data[64u];
+};
+
+TEST(Segment, Allocator) {
+    std::vector<block_type> region(128u);
+    entt::memory_segment segment{region.data(), region.size() * sizeof(block_type)};
+    entt::segment_allocator<int> allocator{segment};
+    entt::segment_allocator<char> other{allocator};
+    const auto used = segment.used();
+
+    ASSERT_EQ(segment.capacity(), region.size() * sizeof(block_type));
+    ASSERT_TRUE(allocator == other);
+    ASSERT_FALSE(allocator != other);
+
+    auto *ptr = allocator.allocate(4u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64u, 0u);
+    ASSERT_EQ(segment.used(), used + 64u);
+
+    allocator.deallocate(ptr, 4u);
+
+    ASSERT_EQ(allocator.allocate(16u), ptr);
+    ASSERT_EQ(segment.used(), used + 64u);
+
+    auto *block = other.allocate(65u);
+
+    ASSERT_NE(block, nullptr);
+    ASSERT_EQ(segment.used(), used + 192u);
+
+    other.deallocate(block, 65u);
+
+    ASSERT_EQ(other.allocate(65u), block);
+    ASSERT_EQ(segment.used(), used + 192u);
+}
+
+TEST(Segment, PublishAndView) {
+    std::vector<block_type> region(4096u);
+    entt::memory_segment segment{region.data(), region.size() * sizeof(block_type)};
+    entt::basic_storage<entt::entity, transform, entt::segment_allocator<transform>> pool{segment};
+
+    ASSERT_FALSE(entt::segment_view<transform>{region.data()});
+
+    segment.publish(pool);
+
+    ASSERT_TRUE(entt::segment_view<transform>{region.data()});
+    ASSERT_TRUE(entt::segment_view<transform>{region.data()}.empty());
+
+    for(std::size_t pos{}; pos < 4u * ENTT_PACKED_PAGE; pos += 2u) {
+        pool.emplace(entt::entity(pos), static_cast<float>(pos), static_cast<float>(pos + 1u));
+    }
+
+    pool.erase(entt::entity{4});
+    segment.publish(pool);
+    segment.publish(pool, entt::hashed_string::value("other"));
+
+    // a reader maps the same region at a different address
+    std::vector<block_type> mapping{region};
+    const entt::segment_view<transform> view{mapping.data()};
+
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.size(), pool.size());
+    ASSERT_NE(view.data(), pool.data());
+    ASSERT_EQ(view.data()[ENTT_PACKED_PAGE + 1u], pool.data()[ENTT_PACKED_PAGE + 1u]);
+    ASSERT_EQ(view[ENTT_PACKED_PAGE + 1u].x, pool.get(pool.data()[ENTT_PACKED_PAGE + 1u]).x);
+
+    std::size_t count{};
+
+    view.each([&count](const entt::entity entt, const transform &elem) {
+        ASSERT_EQ(elem.x, static_cast<float>(entt::to_integral(entt)));
+        ASSERT_EQ(elem.y, static_cast<float>(entt::to_integral(entt) + 1u));
+        ++count;
+    });
+
+    ASSERT_EQ(count, pool.size());
+    ASSERT_TRUE((entt::segment_view<transform>{mapping.data(), entt::hashed_string::value("other")}));
+    ASSERT_FALSE((entt::segment_view<transform>{mapping.data(), entt::hashed_string::value("none")}));
+}
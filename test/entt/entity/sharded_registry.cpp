@@ -0,0 +1,104 @@
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sharded_registry.hpp>
+
+struct empty_type {};
+
+TEST(ShardedRegistry, Functionalities) {
+    entt::sharded_registry registry{3u};
+
+    ASSERT_EQ(registry.size(), 3u);
+
+    const auto entity = registry.create(0u);
+    const auto other = registry.create(2u);
+
+    ASSERT_EQ(registry.shard_of(entity), 0u);
+    ASSERT_EQ(registry.shard_of(other), 2u);
+    ASSERT_NE(entity, other);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_FALSE(registry.valid(entt::null));
+
+    ASSERT_TRUE(registry.shard(2u).valid(registry.local(other)));
+    ASSERT_EQ(registry.global(2u, registry.local(other)), other);
+
+    registry.emplace<int>(entity, 42);
+    registry.emplace<int>(other, 3);
+    registry.emplace<char>(other, 'c');
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(registry.get<int>(other), 3);
+    ASSERT_EQ((registry.get<int, char>(other)), std::make_tuple(3, 'c'));
+    ASSERT_EQ(registry.try_get<char>(entity), nullptr);
+    ASSERT_TRUE(registry.all_of<int>(entity));
+    ASSERT_TRUE((registry.any_of<int, char>(other)));
+
+    ASSERT_EQ(registry.shard(0u).storage<int>().size(), 1u);
+    ASSERT_EQ(registry.shard(1u).storage<int>().size(), 0u);
+    ASSERT_EQ(registry.shard(2u).storage<int>().size(), 1u);
+
+    registry.replace<int>(entity, 0);
+    registry.emplace_or_replace<char>(other, 'a');
+
+    ASSERT_EQ(registry.get<int>(entity), 0);
+    ASSERT_EQ(registry.get<char>(other), 'a');
+    ASSERT_EQ(registry.remove<char>(other), 1u);
+    ASSERT_FALSE(registry.all_of<char>(other));
+
+    registry.destroy(entity);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_TRUE(registry.shard(0u).empty());
+}
+
+TEST(ShardedRegistry, Migrate) {
+    entt::sharded_registry registry{4u};
+
+    registry.shard(1u).storage<char>();
+
+    const auto entity = registry.create(0u);
+    registry.emplace<std::unique_ptr<int>>(entity, std::make_unique<int>(42));
+    registry.emplace<empty_type>(entity);
+    registry.emplace<char>(entity, 'c');
+
+    const auto moved = registry.migrate<std::unique_ptr<int>, empty_type>(entity, 1u);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(moved));
+    ASSERT_EQ(registry.shard_of(moved), 1u);
+    ASSERT_TRUE(registry.shard(0u).empty());
+
+    ASSERT_EQ(*registry.get<std::unique_ptr<int>>(moved), 42);
+    ASSERT_TRUE(registry.all_of<empty_type>(moved));
+    ASSERT_EQ(registry.get<char>(moved), 'c');
+
+    ASSERT_EQ(registry.migrate(moved, 1u), moved);
+}
+
+TEST(ShardedRegistry, ConcurrentShards) {
+    entt::sharded_registry registry{2u};
+
+    auto job = [&registry](const std::size_t pos) {
+        for(int next{}; next < 1000; ++next) {
+            registry.emplace<int>(registry.create(pos), next);
+        }
+    };
+
+    std::thread first{job, 0u};
+    std::thread second{job, 1u};
+
+    first.join();
+    second.join();
+
+    ASSERT_EQ(registry.shard(0u).alive(), 1000u);
+    ASSERT_EQ(registry.shard(1u).alive(), 1000u);
+
+    registry.shard(1u).view<int>().each([&registry](const auto entt, const int value) {
+        ASSERT_EQ(registry.get<int>(registry.global(1u, entt)), value);
+    });
+}
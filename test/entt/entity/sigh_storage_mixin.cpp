@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <iterator>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/storage.hpp>
@@ -27,6 +29,20 @@ void listener(counter &counter, entt::registry &, entt::entity) {
     ++counter.value;
 }
 
+struct bulk_counter {
+    void operator()(entt::registry &, const entt::entity *first, const entt::entity *last) {
+        ++calls;
+        entities.insert(entities.end(), first, last);
+    }
+
+    int calls{};
+    std::vector<entt::entity> entities{};
+};
+
+void bulk_listener(bulk_counter &counter, entt::registry &registry, const entt::entity *first, const entt::entity *last) {
+    counter(registry, first, last);
+}
+
 TEST(SighStorageMixin, GenericType) {
     entt::entity entities[2u]{entt::entity{3}, entt::entity{42}};
     entt::sigh_storage_mixin<entt::storage<int>> pool;
@@ -281,3 +297,143 @@ TEST(SighStorageMixin, NonDefaultConstructibleType) {
     ASSERT_EQ(on_destroy.value, 3);
     ASSERT_TRUE(pool.empty());
 }
+
+TEST(SighStorageMixin, BulkSignals) {
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+    entt::sigh_storage_mixin<entt::storage<int>> pool;
+    entt::registry registry{};
+
+    pool.bind(entt::forward_as_any(registry));
+
+    bulk_counter on_construct{};
+    bulk_counter on_destroy{};
+    counter single{};
+
+    pool.on_bulk_construct().connect<&bulk_listener>(on_construct);
+    pool.on_bulk_destroy().connect<&bulk_listener>(on_destroy);
+
+    pool.insert(std::begin(entities), std::end(entities), 3);
+
+    ASSERT_EQ(on_construct.calls, 1);
+    ASSERT_EQ(on_construct.entities.size(), 3u);
+    ASSERT_TRUE(std::equal(std::begin(entities), std::end(entities), on_construct.entities.begin()));
+
+    pool.erase(entities[1u]);
+
+    ASSERT_EQ(on_destroy.calls, 1);
+    ASSERT_EQ(on_destroy.entities.size(), 1u);
+    ASSERT_EQ(on_destroy.entities[0u], entities[1u]);
+
+    pool.emplace(entities[1u], 1);
+
+    ASSERT_EQ(on_construct.calls, 2);
+    ASSERT_EQ(on_construct.entities.size(), 4u);
+    ASSERT_EQ(on_construct.entities.back(), entities[1u]);
+
+    on_destroy = {};
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(on_destroy.calls, 1);
+    ASSERT_EQ(on_destroy.entities.size(), 3u);
+    ASSERT_TRUE(std::is_permutation(std::begin(entities), std::end(entities), on_destroy.entities.begin()));
+
+    pool.on_destroy().connect<&listener>(single);
+    pool.insert(std::begin(entities), std::end(entities));
+    on_destroy = {};
+    pool.erase(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(on_destroy.calls, 3);
+    ASSERT_EQ(on_destroy.entities.size(), 3u);
+    ASSERT_EQ(single.value, 3);
+}
+
+TEST(SighStorageMixin, BulkSignalsRegistry) {
+    entt::registry registry;
+    bulk_counter on_construct{};
+    bulk_counter on_destroy{};
+    std::vector<entt::entity> entities(8u);
+
+    registry.on_bulk_construct<int>().connect<&bulk_listener>(on_construct);
+    registry.on_bulk_destroy<int>().connect<&bulk_listener>(on_destroy);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 42);
+
+    ASSERT_EQ(on_construct.calls, 1);
+    ASSERT_EQ(on_construct.entities, entities);
+
+    registry.clear<int>();
+
+    ASSERT_EQ(on_destroy.calls, 1);
+    ASSERT_EQ(on_destroy.entities.size(), entities.size());
+    ASSERT_TRUE(registry.storage<int>().empty());
+}
+
+TEST(SighStorageMixin, BatchErase) {
+    entt::entity entities[4u]{entt::entity{3}, entt::entity{42}, entt::entity{7}, entt::entity{9}};
+    entt::sigh_storage_mixin<entt::storage<int>> pool;
+    entt::sigh_storage_mixin<entt::storage<stable_type>> stable;
+    entt::registry registry{};
+
+    pool.bind(entt::forward_as_any(registry));
+    stable.bind(entt::forward_as_any(registry));
+    pool.insert(std::begin(entities), std::end(entities), 3);
+    stable.insert(std::begin(entities), std::end(entities));
+
+    pool.erase(entities + 1u, entities + 3u);
+    stable.erase(entities + 1u, entities + 3u);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_TRUE(pool.contains(entities[0u]));
+    ASSERT_TRUE(pool.contains(entities[3u]));
+    ASSERT_EQ(pool.get(entities[3u]), 3);
+    ASSERT_EQ(stable.size(), 4u);
+    ASSERT_FALSE(stable.contains(entities[1u]));
+    ASSERT_FALSE(stable.contains(entities[2u]));
+
+    counter on_destroy{};
+    pool.on_destroy().connect<&listener>(on_destroy);
+    pool.erase(entities, entities + 1u);
+
+    ASSERT_EQ(on_destroy.value, 1);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_TRUE(pool.contains(entities[3u]));
+}
+
+TEST(SighStorageMixin, Reset) {
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
+    entt::sigh_storage_mixin<entt::storage<int>> pool;
+    entt::sigh_storage_mixin<entt::storage<stable_type>> stable;
+    entt::registry registry{};
+
+    counter on_destroy{};
+    bulk_counter on_bulk_destroy{};
+
+    pool.bind(entt::forward_as_any(registry));
+    stable.bind(entt::forward_as_any(registry));
+    pool.on_destroy().connect<&listener>(on_destroy);
+    pool.on_bulk_destroy().connect<&bulk_listener>(on_bulk_destroy);
+    stable.on_destroy().connect<&listener>(on_destroy);
+
+    pool.insert(std::begin(entities), std::end(entities), 3);
+    stable.insert(std::begin(entities), std::end(entities));
+    stable.erase(entities[1u]);
+
+    ASSERT_EQ(on_destroy.value, 1);
+
+    pool.reset();
+    stable.reset();
+
+    ASSERT_EQ(on_destroy.value, 1);
+    ASSERT_EQ(on_bulk_destroy.calls, 0);
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(stable.empty());
+
+    pool.emplace(entities[0u]);
+    pool.clear();
+
+    ASSERT_EQ(on_destroy.value, 2);
+    ASSERT_EQ(on_bulk_destroy.calls, 1);
+}
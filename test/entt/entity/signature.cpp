@@ -0,0 +1,161 @@
+#include <cstddef>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/signature.hpp>
+
+struct empty_type {};
+
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+TEST(SignatureCache, Functionalities) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.emplace<int>(e0);
+
+    ASSERT_FALSE((cache.tracked<int, char>()));
+
+    cache.track<int, char>();
+
+    ASSERT_TRUE((cache.tracked<int, char>()));
+    ASSERT_FALSE(cache.tracked<double>());
+
+    ASSERT_NE(cache.mask<int>(), cache.mask<char>());
+    ASSERT_EQ((cache.mask<int, char>()), cache.mask<int>() | cache.mask<char>());
+    ASSERT_EQ(cache.signature(e0), cache.mask<int>());
+    ASSERT_EQ(cache.signature(e1), 0u);
+
+    registry.emplace<char>(e0);
+    registry.emplace<char>(e1);
+
+    ASSERT_TRUE(cache.contains(e0, cache.mask<int, char>()));
+    ASSERT_FALSE(cache.contains(e1, cache.mask<int, char>()));
+    ASSERT_TRUE(cache.contains(e1, cache.mask<char>()));
+
+    registry.remove<int>(e0);
+
+    ASSERT_EQ(cache.signature(e0), cache.mask<char>());
+
+    registry.destroy(e1);
+
+    ASSERT_EQ(cache.signature(e1), 0u);
+    ASSERT_EQ(cache.signature(entt::entity{42}), 0u);
+}
+
+TEST(SignatureCache, Freeze) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+    entt::entity entities[4u];
+
+    cache.track<int, char>();
+    registry.create(std::begin(entities), std::end(entities));
+    cache.reserve();
+    registry.freeze();
+
+    for(auto entity: entities) {
+        registry.emplace<int>(entity);
+    }
+
+    registry.emplace<char>(entities[3u]);
+
+    ASSERT_EQ(cache.signature(entities[0u]), cache.mask<int>());
+    ASSERT_EQ(cache.signature(entities[3u]), (cache.mask<int, char>()));
+}
+
+TEST(SignatureCacheDeathTest, Freeze) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+
+    cache.track<int>();
+    const auto entity = registry.create();
+    registry.freeze();
+
+    ASSERT_DEATH(registry.emplace<int>(entity), "");
+}
+
+TEST(SignatureCache, Each) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+
+    cache.track<int, char, empty_type>();
+
+    for(std::size_t pos{}; pos < 8u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+
+        if(pos % 2u) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 4u) {
+            registry.emplace<empty_type>(entity);
+        }
+    }
+
+    std::size_t count{};
+
+    cache.each<int, char>([&count](const auto entt, int &ivalue, char &) {
+        ASSERT_EQ(static_cast<std::size_t>(ivalue) % 2u, 1u);
+        ASSERT_EQ(entt::to_integral(entt), static_cast<std::uint32_t>(ivalue));
+        ++count;
+    });
+
+    ASSERT_EQ(count, 4u);
+
+    count = 0u;
+
+    cache.each<empty_type, const int>([&count](const auto, const int &ivalue) {
+        ASSERT_NE(static_cast<std::size_t>(ivalue) % 4u, 0u);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 6u);
+}
+
+TEST(SignatureCache, StableType) {
+    entt::registry registry;
+    entt::signature_cache cache{registry};
+
+    cache.track<stable_type, int>();
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.emplace<stable_type>(e0, 0);
+    registry.emplace<stable_type>(e1, 1);
+    registry.emplace<int>(e0);
+    registry.emplace<int>(e1);
+
+    registry.remove<stable_type>(e0);
+
+    std::size_t count{};
+
+    cache.each<stable_type, int>([&count, e1](const auto entt, auto &&...) {
+        ASSERT_EQ(entt, e1);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(SignatureCache, Disconnect) {
+    entt::registry registry;
+
+    {
+        entt::signature_cache cache{registry};
+        cache.track<int>();
+
+        ASSERT_FALSE(registry.on_construct<int>().empty());
+        ASSERT_FALSE(registry.on_destroy<int>().empty());
+    }
+
+    ASSERT_TRUE(registry.on_construct<int>().empty());
+    ASSERT_TRUE(registry.on_destroy<int>().empty());
+}
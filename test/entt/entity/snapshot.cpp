@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <queue>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -8,6 +10,9 @@
 #include <entt/entity/entity.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/snapshot.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
 
 struct noncopyable_component {
     noncopyable_component()
@@ -79,12 +84,46 @@ struct what_a_component {
     std::vector<entt::entity> quux;
 };
 
+struct stable_component {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+struct entity_component {
+    entt::entity target;
+};
+
 struct map_component {
     std::map<entt::entity, int> keys;
     std::map<int, entt::entity> values;
     std::map<entt::entity, entt::entity> both;
 };
 
+struct replicated_component {
+    float x;
+    float y;
+    bool visible;
+};
+
+template<>
+struct entt::replication_traits<replicated_component> {
+    static constexpr entt::quantizer range{-64., 64., .01};
+
+    template<typename Archive>
+    static void write(Archive &archive, const replicated_component &value) {
+        archive.quantize(value.x, range);
+        archive.quantize(value.y, range);
+        archive(value.visible);
+    }
+
+    template<typename Archive>
+    static void read(Archive &archive, replicated_component &value) {
+        value.x = static_cast<float>(archive.dequantize(range));
+        value.y = static_cast<float>(archive.dequantize(range));
+        archive(value.visible);
+    }
+};
+
 TEST(Snapshot, Dump) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -150,6 +189,561 @@ TEST(Snapshot, Dump) {
     ASSERT_TRUE(registry.storage<another_component>().empty());
 }
 
+TEST(Snapshot, BinaryArchive) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(ENTT_PACKED_PAGE + 3u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities[1u]);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        if(pos != 1u) {
+            registry.emplace<int>(entities[pos], static_cast<int>(pos));
+            registry.emplace<another_component>(entities[pos], static_cast<int>(pos), -static_cast<int>(pos));
+        }
+
+        if(pos % 2u == 0u) {
+            registry.emplace<a_component>(entities[pos]);
+            registry.emplace<stable_component>(entities[pos], static_cast<int>(pos));
+        }
+    }
+
+    registry.destroy(entities[2u]);
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+
+    entt::snapshot{registry}.entities(output).component<int, a_component, another_component, stable_component>(output);
+
+    entt::registry other;
+    entt::binary_input_archive input{buffer};
+
+    entt::snapshot_loader{other}.entities(input).component<int, a_component, another_component, stable_component>(input).orphans();
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(other.alive(), registry.alive());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        const auto entity = entities[pos];
+
+        ASSERT_EQ(other.valid(entity), registry.valid(entity));
+        ASSERT_EQ(other.current(entity), registry.current(entity));
+
+        if(registry.valid(entity)) {
+            ASSERT_EQ(other.get<int>(entity), static_cast<int>(pos));
+            ASSERT_EQ(other.get<another_component>(entity).key, static_cast<int>(pos));
+            ASSERT_EQ(other.get<another_component>(entity).value, -static_cast<int>(pos));
+            ASSERT_EQ((other.all_of<a_component, stable_component>(entity)), pos % 2u == 0u);
+        }
+    }
+
+    ASSERT_EQ(other.get<stable_component>(entities[4u]).value, 4);
+}
+
+TEST(Snapshot, StreamArchive) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(ENTT_PACKED_PAGE * 2u + 3u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.emplace<another_component>(entities[pos], static_cast<int>(pos), -static_cast<int>(pos));
+
+        if(pos % 2u == 0u) {
+            registry.emplace<a_component>(entities[pos]);
+        }
+    }
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+
+    entt::snapshot{registry}.entities(output).component<another_component, a_component>(output);
+
+    for(const bool pipelined: {false, true}) {
+        std::size_t offset{};
+        std::size_t calls{};
+        entt::registry other;
+
+        const auto source = [&](std::byte *data, std::size_t length) {
+            length = (std::min)(length, buffer.size() - offset);
+            std::copy_n(buffer.data() + offset, length, data);
+            offset += length;
+            ++calls;
+            return length;
+        };
+
+        entt::stream_input_archive input{source, 64u, pipelined};
+
+        entt::snapshot_loader{other}.entities(input).component<another_component, a_component>(input);
+
+        ASSERT_EQ(offset, buffer.size());
+        ASSERT_GE(calls, buffer.size() / 64u);
+        ASSERT_EQ(other.alive(), registry.alive());
+        ASSERT_EQ(other.storage<another_component>().capacity(), other.storage<another_component>().size() + ENTT_PACKED_PAGE - 3u);
+
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_EQ(other.get<another_component>(entities[pos]).key, static_cast<int>(pos));
+            ASSERT_EQ(other.get<another_component>(entities[pos]).value, -static_cast<int>(pos));
+            ASSERT_EQ(other.all_of<a_component>(entities[pos]), pos % 2u == 0u);
+        }
+    }
+}
+
+TEST(Snapshot, ParallelComponent) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(ENTT_PACKED_PAGE + 3u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.emplace<int>(entities[pos], static_cast<int>(pos));
+
+        if(pos % 3u == 0u) {
+            registry.emplace<a_component>(entities[pos]);
+            registry.emplace<stable_component>(entities[pos], static_cast<int>(pos));
+        }
+    }
+
+    std::vector<std::byte> buffer{};
+    std::vector<std::byte> expected{};
+    entt::binary_output_archive output{buffer};
+    entt::binary_output_archive other{expected};
+
+    const auto executor = [](std::size_t count, const auto &task) {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    };
+
+    entt::snapshot{registry}.entities(output).par_component<int, a_component, stable_component>(executor, output);
+    entt::snapshot{registry}.entities(other).component<int, a_component, stable_component>(other);
+
+    ASSERT_EQ(buffer, expected);
+
+    entt::registry loaded;
+    entt::binary_input_archive input{buffer};
+    entt::snapshot_loader{loaded}.entities(input).component<int, a_component, stable_component>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(loaded.get<int>(entities[4u]), 4);
+    ASSERT_EQ(loaded.get<stable_component>(entities[3u]).value, 3);
+    ASSERT_EQ(loaded.storage<a_component>().size(), registry.storage<a_component>().size());
+}
+
+TEST(Snapshot, CodecArchive) {
+    struct counting_codec: entt::identity_codec {
+        void compress(const entt::type_info &type, const std::byte *data, const std::size_t length, std::vector<std::byte> &out) {
+            identity_codec::compress(type, data, length, out);
+            types->push_back(type.hash());
+        }
+
+        std::vector<entt::id_type> *types;
+    };
+
+    entt::registry registry;
+    std::vector<entt::entity> entities(ENTT_PACKED_PAGE + 3u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities[1u]);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        if(registry.valid(entities[pos])) {
+            registry.emplace<int>(entities[pos], static_cast<int>(pos));
+        }
+
+        if(pos % 2u == 0u) {
+            registry.emplace<a_component>(entities[pos]);
+            registry.emplace<stable_component>(entities[pos], static_cast<int>(pos));
+        }
+    }
+
+    std::vector<std::byte> plain{};
+    entt::binary_output_archive binary{plain};
+    entt::snapshot{registry}.entities(binary).component<int, a_component, stable_component>(binary);
+
+    std::vector<std::byte> buffer{};
+    std::vector<entt::id_type> types{};
+    entt::codec_output_archive output{buffer, counting_codec{{}, &types}};
+    entt::snapshot{registry}.entities(output).component<int, a_component, stable_component>(output);
+
+    ASSERT_EQ(types.size(), 3u);
+
+    output.flush();
+
+    ASSERT_EQ(types, (std::vector<entt::id_type>{entt::type_hash<entt::entity>::value(), entt::type_hash<int>::value(), entt::type_hash<a_component>::value(), entt::type_hash<stable_component>::value()}));
+    // entities are delta encoded, mostly one byte each rather than four
+    ASSERT_LT(buffer.size() + 2u * entities.size(), plain.size());
+
+    entt::registry other;
+    entt::codec_input_archive input{buffer};
+    entt::snapshot_loader{other}.entities(input).component<int, a_component, stable_component>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(other.alive(), registry.alive());
+    ASSERT_FALSE(other.valid(entities[1u]));
+    ASSERT_EQ(other.current(entities[1u]), registry.current(entities[1u]));
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        if(registry.valid(entities[pos])) {
+            ASSERT_EQ(other.get<int>(entities[pos]), static_cast<int>(pos));
+            ASSERT_EQ((other.all_of<a_component, stable_component>(entities[pos])), pos % 2u == 0u);
+        }
+    }
+
+    const auto executor = [](std::size_t count, const auto &task) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            task(pos);
+        }
+    };
+
+    buffer.clear();
+    output = entt::codec_output_archive{buffer, counting_codec{{}, &types}};
+    entt::snapshot{registry}.entities(output).par_component<int, a_component, stable_component>(executor, output);
+    output.flush();
+
+    entt::registry continuous;
+    entt::continuous_loader loader{continuous};
+    input = entt::codec_input_archive{buffer};
+    loader.entities(input).component<int, a_component, stable_component>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(continuous.get<int>(loader.map(entities[4u])), 4);
+    ASSERT_EQ(continuous.get<stable_component>(loader.map(entities[4u])).value, 4);
+}
+
+TEST(Snapshot, BinaryArchiveRange) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[0u], 0);
+    registry.emplace<int>(entities[2u], 2);
+    registry.emplace<a_component>(entities[1u]);
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+
+    entt::snapshot{registry}.component<int, a_component>(output, std::begin(entities), std::end(entities));
+
+    entt::registry other;
+    entt::binary_input_archive input{buffer.data(), buffer.size()};
+
+    entt::snapshot_loader{other}.component<int, a_component>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(other.get<int>(entities[0u]), 0);
+    ASSERT_EQ(other.get<int>(entities[2u]), 2);
+    ASSERT_TRUE(other.all_of<a_component>(entities[1u]));
+    ASSERT_FALSE(other.all_of<int>(entities[1u]));
+}
+
+TEST(Snapshot, BinaryArchiveFullRange) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[3u]);
+
+    registry.emplace<int>(entities[0u], 0);
+    registry.emplace<int>(entities[2u], 2);
+    registry.emplace<stable_component>(entities[0u], 0);
+    registry.emplace<stable_component>(entities[1u], 1);
+    registry.emplace<stable_component>(entities[2u], 2);
+    registry.erase<stable_component>(entities[1u]);
+
+    std::vector<std::byte> range{};
+    std::vector<std::byte> pools{};
+    entt::binary_output_archive range_output{range};
+    entt::binary_output_archive pools_output{pools};
+
+    entt::snapshot{registry}.entities(range_output).component<int, stable_component>(range_output, registry.data(), registry.data() + registry.size());
+    entt::snapshot{registry}.entities(pools_output).component<int, stable_component>(pools_output);
+
+    ASSERT_EQ(range, pools);
+
+    entt::registry other;
+    entt::binary_input_archive input{range};
+
+    entt::snapshot_loader{other}.entities(input).component<int, stable_component>(input).orphans();
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(other.alive(), 2u);
+    ASSERT_FALSE(other.valid(entities[1u]));
+    ASSERT_EQ(other.get<int>(entities[2u]), 2);
+    ASSERT_EQ(other.get<stable_component>(entities[0u]).value, 0);
+    ASSERT_EQ(other.storage<stable_component>().size(), 2u);
+}
+
+TEST(Snapshot, BinaryArchiveContinuous) {
+    entt::registry src;
+    entt::registry dst;
+    entt::continuous_loader loader{dst};
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+
+    src.emplace<entity_component>(e0, e1);
+    src.emplace<entity_component>(e1, e0);
+    src.emplace<a_component>(e1);
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+    entt::snapshot{src}.entities(output).component<entity_component, a_component>(output);
+
+    static_cast<void>(dst.create());
+
+    entt::binary_input_archive input{buffer};
+    loader.entities(input).component<entity_component, a_component>(input, &entity_component::target);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_TRUE(loader.contains(e0));
+    ASSERT_TRUE(loader.contains(e1));
+    ASSERT_NE(loader.map(e0), e0);
+    ASSERT_EQ(dst.get<entity_component>(loader.map(e0)).target, loader.map(e1));
+    ASSERT_EQ(dst.get<entity_component>(loader.map(e1)).target, loader.map(e0));
+    ASSERT_TRUE(dst.all_of<a_component>(loader.map(e1)));
+}
+
+TEST(Snapshot, Storage) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[0u], 1);
+    registry.emplace<int>(entities[2u], 3);
+    registry.emplace<stable_component>(entities[0u], 4);
+    registry.emplace<stable_component>(entities[1u], 5);
+    registry.remove<stable_component>(entities[0u]);
+
+    entt::meta<int>().type(entt::type_hash<int>::value());
+    entt::meta<stable_component>().type(entt::type_hash<stable_component>::value());
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+
+    entt::snapshot{registry}.storage(output, [](auto &archive, const auto &pool, auto first, auto last) {
+        const auto type = entt::resolve(pool.type());
+        ASSERT_TRUE(type);
+
+        for(; first != last; ++first) {
+            archive.write(pool.get(*first), type.size_of());
+        }
+    });
+
+    entt::binary_input_archive input{buffer};
+    traits_type::entity_type count{};
+    int value{};
+
+    input(count);
+
+    ASSERT_EQ(count, 2u);
+
+    for(traits_type::entity_type pos{}; pos < count; ++pos) {
+        entt::id_type id{};
+        traits_type::entity_type length{};
+        entt::entity entity{};
+
+        input(id, length);
+
+        if(id == entt::type_hash<int>::value()) {
+            ASSERT_EQ(length, 2u);
+            input(entity, entity, value);
+            ASSERT_EQ(value, registry.get<int>(entities[0u]));
+            input(value);
+            ASSERT_EQ(value, registry.get<int>(entities[2u]));
+        } else {
+            ASSERT_EQ(id, entt::type_hash<stable_component>::value());
+            ASSERT_EQ(length, 1u);
+            input(entity, value);
+            ASSERT_EQ(entity, entities[1u]);
+            ASSERT_EQ(value, 5);
+        }
+    }
+
+    ASSERT_EQ(input.size(), 0u);
+
+    entt::meta_reset();
+}
+
+TEST(Snapshot, Delta) {
+    entt::registry src;
+    entt::registry dst;
+    entt::continuous_loader loader{dst};
+    entt::delta_snapshot delta{src};
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+    const auto e2 = src.create();
+
+    src.emplace<int>(e0, 0);
+    delta.track<int, entity_component, a_component>();
+
+    ASSERT_TRUE(delta.empty());
+
+    src.emplace<int>(e1, 1);
+    src.emplace<entity_component>(e1, e0);
+    src.emplace<a_component>(e2);
+
+    ASSERT_FALSE(delta.empty());
+
+    std::vector<std::byte> buffer{};
+    entt::binary_output_archive output{buffer};
+    delta.component<int, entity_component, a_component>(output);
+    delta.checkpoint();
+
+    ASSERT_TRUE(delta.empty());
+
+    entt::binary_input_archive input{buffer};
+    loader.delta<int, entity_component, a_component>(input, &entity_component::target);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_FALSE(loader.contains(e0));
+    ASSERT_TRUE(loader.contains(e1));
+    ASSERT_TRUE(loader.contains(e2));
+    ASSERT_EQ(dst.get<int>(loader.map(e1)), 1);
+    ASSERT_TRUE(dst.all_of<a_component>(loader.map(e2)));
+    ASSERT_EQ(dst.get<entity_component>(loader.map(e1)).target, entt::entity{entt::null});
+
+    src.patch<int>(e1, [](auto &value) { value = 42; });
+    src.replace<entity_component>(e1, e2);
+    src.remove<a_component>(e2);
+    src.emplace<a_component>(e1);
+    src.destroy(e1);
+
+    buffer.clear();
+    delta.component<int, entity_component, a_component>(output);
+    input = entt::binary_input_archive{buffer};
+    loader.delta<int, entity_component, a_component>(input, &entity_component::target);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_TRUE(dst.orphan(loader.map(e1)));
+    ASSERT_FALSE(dst.all_of<a_component>(loader.map(e2)));
+
+    delta.checkpoint();
+    const auto e3 = src.create();
+    src.emplace<int>(e3, 3);
+    src.patch<int>(e0);
+
+    buffer.clear();
+    delta.component<int>(output);
+    input = entt::binary_input_archive{buffer};
+    loader.delta<int>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_TRUE(loader.contains(e0));
+    ASSERT_EQ(dst.get<int>(loader.map(e0)), 0);
+    ASSERT_EQ(dst.get<int>(loader.map(e3)), 3);
+    ASSERT_EQ(dst.storage<int>().size(), 2u);
+}
+
+TEST(Snapshot, BitArchive) {
+    std::vector<std::byte> buffer{};
+    entt::bit_output_archive output{buffer};
+    constexpr entt::quantizer range{-1., 1., .001};
+
+    static_assert(range.bits() == 11u);
+
+    output(true, std::uint8_t{3u}, -2, entt::entity{42});
+    output.write_bits(5u, 3u);
+    output.quantize(.5, range);
+    output.quantize(4., range);
+    output(1.5);
+
+    ASSERT_EQ(output.size(), 1u + 8u + 32u + 32u + 3u + 11u + 11u + 64u);
+    ASSERT_EQ(buffer.size(), (output.size() + 7u) / 8u);
+
+    entt::bit_input_archive input{buffer};
+    bool flag{};
+    std::uint8_t small{};
+    int value{};
+    entt::entity entity{};
+    double other{};
+
+    input(flag, small, value, entity);
+
+    ASSERT_TRUE(flag);
+    ASSERT_EQ(small, 3u);
+    ASSERT_EQ(value, -2);
+    ASSERT_EQ(entity, entt::entity{42});
+    ASSERT_EQ(input.read_bits(3u), 5u);
+    ASSERT_NEAR(input.dequantize(range), .5, .001);
+    ASSERT_EQ(input.dequantize(range), 1.);
+
+    input(other);
+
+    ASSERT_EQ(other, 1.5);
+    ASSERT_LT(input.size(), 8u);
+}
+
+TEST(Snapshot, Replication) {
+    entt::registry src;
+    entt::registry dst;
+    entt::continuous_loader loader{dst};
+    entt::delta_snapshot delta{src};
+
+    delta.track<replicated_component, a_component>();
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+    const auto e2 = src.create();
+
+    src.emplace<replicated_component>(e0, 1.234f, -5.678f, true);
+    src.emplace<replicated_component>(e1, 100.f, 0.f, false);
+    src.emplace<replicated_component>(e2, 0.f, 0.f, false);
+    src.emplace<a_component>(e1);
+
+    const entt::entity interest[]{e1, e0};
+    std::vector<std::byte> buffer{};
+    entt::bit_output_archive output{buffer};
+    delta.component<replicated_component, a_component>(output, std::begin(interest), std::end(interest));
+
+    // two components of 2 x 14 + 1 bits each, much less than their size in memory
+    ASSERT_EQ(output.size(), 32u + 2u * (32u + 29u) + 32u + 32u + 32u + 32u);
+
+    entt::bit_input_archive input{buffer};
+    loader.delta<replicated_component, a_component>(input);
+
+    ASSERT_TRUE(loader.contains(e0));
+    ASSERT_TRUE(loader.contains(e1));
+    ASSERT_FALSE(loader.contains(e2));
+
+    const auto &first = dst.get<replicated_component>(loader.map(e0));
+    const auto &second = dst.get<replicated_component>(loader.map(e1));
+
+    ASSERT_NEAR(first.x, 1.234f, .01f);
+    ASSERT_NEAR(first.y, -5.678f, .01f);
+    ASSERT_TRUE(first.visible);
+    ASSERT_EQ(second.x, 64.f);
+    ASSERT_FALSE(second.visible);
+    ASSERT_TRUE(dst.all_of<a_component>(loader.map(e1)));
+    ASSERT_FALSE(dst.all_of<a_component>(loader.map(e0)));
+}
+
+TEST(Snapshot, DeltaDisconnect) {
+    entt::registry registry;
+
+    {
+        entt::delta_snapshot delta{registry};
+        delta.track<int>().track<int>();
+
+        ASSERT_FALSE(registry.on_construct<int>().empty());
+        ASSERT_FALSE(registry.on_update<int>().empty());
+        ASSERT_FALSE(registry.on_destroy<int>().empty());
+    }
+
+    ASSERT_TRUE(registry.on_construct<int>().empty());
+    ASSERT_TRUE(registry.on_update<int>().empty());
+    ASSERT_TRUE(registry.on_destroy<int>().empty());
+}
+
 TEST(Snapshot, Partial) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -501,6 +1095,58 @@ TEST(Snapshot, Continuous) {
     ASSERT_EQ(dst.storage<a_component>().size(), a_component_cnt);
 }
 
+TEST(Snapshot, ContinuousRemap) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>,
+        std::queue<what_a_component>>;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const entt::entity entities[3u]{src.create(), src.create(), src.create()};
+    src.emplace<what_a_component>(entities[0u], entities[2u]);
+    src.get<what_a_component>(entities[0u]).quux.push_back(entities[1u]);
+
+    entt::snapshot{src}.entities(output).component<what_a_component>(output);
+    loader.entities(input).component<what_a_component>(input, &what_a_component::bar, &what_a_component::quux);
+
+    entt::entity refs[4u]{entities[2u], entities[0u], entt::null, entities[1u]};
+    loader.map_n(refs, 4u);
+
+    ASSERT_EQ(refs[0u], loader.map(entities[2u]));
+    ASSERT_EQ(refs[1u], loader.map(entities[0u]));
+    ASSERT_EQ(refs[2u], static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(refs[3u], loader.map(entities[1u]));
+
+    const auto &instance = dst.get<what_a_component>(loader.map(entities[0u]));
+
+    ASSERT_EQ(instance.bar, refs[0u]);
+    ASSERT_EQ(instance.quux.size(), 1u);
+    ASSERT_EQ(instance.quux[0u], refs[3u]);
+
+    const auto local = loader.map(entities[1u]);
+    src.destroy(entities[1u]);
+    const auto other = src.create();
+
+    ASSERT_EQ(entt::to_entity(other), entt::to_entity(entities[1u]));
+
+    entt::snapshot{src}.entities(output);
+    loader.entities(input);
+
+    ASSERT_FALSE(loader.contains(entities[1u]));
+    ASSERT_TRUE(loader.contains(other));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_TRUE(dst.valid(loader.map(other)));
+}
+
 TEST(Snapshot, MoreOnShrink) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -528,6 +1174,85 @@ TEST(Snapshot, MoreOnShrink) {
     ASSERT_FALSE(dst.valid(entity));
 }
 
+TEST(Snapshot, UnversionedEntities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>>;
+
+    const auto e0 = traits_type::construct(0u, 0u);
+    const auto e1 = traits_type::construct(1u, 1u);
+    const auto e2 = traits_type::construct(2u, 0u);
+
+    // length of the range plus one, head of the free list, slots (released ones point to the next free slot)
+    const auto fill = [&](storage_type &storage) {
+        std::get<std::queue<typename traits_type::entity_type>>(storage).push(4u);
+        std::get<std::queue<entt::entity>>(storage).push(traits_type::construct(1u, 0u));
+        std::get<std::queue<entt::entity>>(storage).push(e0);
+        std::get<std::queue<entt::entity>>(storage).push(traits_type::construct(traits_type::entity_mask, 1u));
+        std::get<std::queue<entt::entity>>(storage).push(e2);
+    };
+
+    entt::registry registry;
+    storage_type storage;
+    input_archive<storage_type> input{storage};
+
+    fill(storage);
+    entt::snapshot_loader{registry}.entities(input);
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_EQ(registry.alive(), 2u);
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(traits_type::construct(1u, 0u)));
+    ASSERT_TRUE(registry.valid(e2));
+    ASSERT_EQ(registry.create(), e1);
+
+    entt::registry other;
+    entt::continuous_loader loader{other};
+
+    fill(storage);
+    loader.entities(input);
+
+    ASSERT_TRUE(loader.contains(e0));
+    ASSERT_TRUE(loader.contains(e1));
+    ASSERT_TRUE(loader.contains(e2));
+    ASSERT_TRUE(other.valid(loader.map(e0)));
+    ASSERT_FALSE(other.valid(loader.map(e1)));
+    ASSERT_TRUE(other.valid(loader.map(e2)));
+}
+
+TEST(Snapshot, ContinuousReleased) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>>;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+    const auto e2 = src.create();
+
+    src.destroy(e0);
+    entt::snapshot{src}.entities(output);
+    loader.entities(input);
+
+    // released identifiers keep their own index rather than that of their slot
+    ASSERT_TRUE(loader.contains(src.create()));
+    ASSERT_TRUE(loader.contains(e1));
+    ASSERT_TRUE(loader.contains(e2));
+    ASSERT_TRUE(dst.valid(loader.map(e1)));
+    ASSERT_TRUE(dst.valid(loader.map(e2)));
+}
+
 TEST(Snapshot, SyncDataMembers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
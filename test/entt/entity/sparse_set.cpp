@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
@@ -124,6 +126,67 @@ TEST(SparseSet, Contains) {
     ASSERT_FALSE(set.contains(traits_type::construct(99, traits_type::to_version(entt::tombstone))));
 }
 
+TEST(SparseSet, Prefetch) {
+    entt::sparse_set set{};
+
+    set.prefetch(entt::entity{42});
+    set.prefetch(entt::null);
+    set.prefetch(entt::tombstone);
+
+    set.emplace(entt::entity{42});
+    set.prefetch(entt::entity{42});
+    set.prefetch(entt::entity{3});
+
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_FALSE(set.contains(entt::entity{3}));
+}
+
+TEST(SparseSet, ContainsN) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::sparse_set set{};
+    std::vector<entt::entity> entities{};
+    bool found[40u]{};
+
+    for(std::size_t pos{}; pos < 40u; ++pos) {
+        entities.push_back(traits_type::construct(static_cast<traits_type::entity_type>(pos * 3u), 0u));
+    }
+
+    ASSERT_EQ(set.contains_n(entities.data(), entities.size(), found), 0u);
+    ASSERT_EQ(std::count(std::begin(found), std::end(found), true), 0);
+
+    for(std::size_t pos{}; pos < entities.size(); pos += 2u) {
+        set.emplace(entities[pos]);
+    }
+
+    entities[4u] = traits_type::construct(traits_type::to_entity(entities[4u]), 1u);
+    entities[6u] = entt::null;
+
+    ASSERT_EQ(set.contains_n(entities.data(), entities.size(), found), 18u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(found[pos], set.contains(entities[pos]));
+    }
+
+    ASSERT_EQ(set.contains_n(entities.data(), 0u, found), 0u);
+}
+
+TEST(SparseSet, IndexN) {
+    entt::sparse_set set{};
+    const entt::entity entities[10u]{entt::entity{9}, entt::entity{1}, entt::entity{42}, entt::entity{3}, entt::entity{7}, entt::entity{1024}, entt::entity{0}, entt::entity{5}, entt::entity{8}, entt::entity{2}};
+    std::size_t index[10u]{};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entt::entity{42});
+    set.emplace(entt::entity{42});
+
+    set.index_n(entities, 10u, index);
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        ASSERT_EQ(index[pos], set.index(entities[pos]));
+    }
+}
+
 TEST(SparseSet, Current) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -609,6 +672,33 @@ TEST(SparseSet, Remove) {
     ASSERT_EQ(set.remove(entt::null), 0u);
 }
 
+TEST(SparseSet, RemoveInBulk) {
+    entt::sparse_set set;
+    std::vector<entt::entity> entities{};
+
+    for(std::size_t pos{}; pos < 64u; ++pos) {
+        entities.push_back(entt::entity{static_cast<std::underlying_type_t<entt::entity>>(pos)});
+    }
+
+    set.insert(entities.begin(), entities.end());
+
+    std::vector<entt::entity> range{entities[3u], entities[60u], entities[3u], entities[17u], entt::entity{99}, entities[63u]};
+
+    ASSERT_EQ(set.remove(range.begin(), range.end()), 4u);
+    ASSERT_EQ(set.size(), 60u);
+
+    for(const auto entity: range) {
+        ASSERT_FALSE(set.contains(entity));
+    }
+
+    for(std::size_t pos{}; pos < set.size(); ++pos) {
+        ASSERT_EQ(set.index(set.data()[pos]), pos);
+    }
+
+    ASSERT_EQ(set.remove(set.begin(), set.end()), 60u);
+    ASSERT_TRUE(set.empty());
+}
+
 TEST(SparseSet, StableRemove) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -780,6 +870,54 @@ TEST(SparseSet, Compact) {
 
     ASSERT_TRUE(set.empty());
 }
+TEST(SparseSet, Defragment) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    entt::entity entities[6u]{entt::entity{3}, entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{9}, entt::entity{1}};
+
+    ASSERT_TRUE(set.defragment(0u));
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entt::entity{3});
+    set.erase(entt::entity{42});
+    set.erase(entt::entity{9});
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_FALSE(set.defragment(1u));
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_EQ(set.index(entt::entity{12}), 0u);
+    ASSERT_EQ(set.index(entt::entity{7}), 3u);
+    ASSERT_EQ(set.index(entt::entity{1}), 5u);
+
+    set.emplace(entt::entity{5});
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_TRUE(set.contains(entt::entity{5}));
+    ASSERT_EQ(set.index(entt::entity{5}), 1u);
+
+    ASSERT_TRUE(set.defragment(2u));
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(set.index(entt::entity{12}), 0u);
+    ASSERT_EQ(set.index(entt::entity{5}), 1u);
+    ASSERT_EQ(set.index(entt::entity{7}), 2u);
+    ASSERT_EQ(set.index(entt::entity{1}), 3u);
+
+    set.erase(entt::entity{12});
+    set.erase(entt::entity{7});
+    set.defragment();
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.index(entt::entity{5}), 0u);
+    ASSERT_EQ(set.index(entt::entity{1}), 1u);
+
+    set.erase(entt::entity{5});
+    set.erase(entt::entity{1});
+    set.defragment();
+
+    ASSERT_TRUE(set.empty());
+}
+
 
 TEST(SparseSet, SwapEntity) {
     using traits_type = entt::entt_traits<entt::entity>;
@@ -1109,6 +1247,68 @@ TEST(SparseSetDeathTest, SortRange) {
     ASSERT_DEATH(set.sort_n(3u, std::less{});, "");
 }
 
+TEST(SparseSet, SortAs) {
+    entt::sparse_set set{};
+    entt::entity entities[5u]{entt::entity{7}, entt::entity{9}, entt::entity{3}, entt::entity{12}, entt::entity{42}};
+    const entt::entity order[3u]{entt::entity{3}, entt::entity{7}, entt::entity{9}};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.sort_as(std::begin(order), std::begin(order));
+
+    ASSERT_TRUE(std::equal(std::rbegin(entities), std::rend(entities), set.begin(), set.end()));
+
+    set.sort_as(std::begin(order), std::end(order));
+
+    ASSERT_EQ(set.data()[0u], entities[1u]);
+    ASSERT_EQ(set.data()[1u], entities[0u]);
+    ASSERT_EQ(set.data()[2u], entities[2u]);
+    ASSERT_EQ(set.data()[3u], entities[3u]);
+    ASSERT_EQ(set.data()[4u], entities[4u]);
+
+    ASSERT_TRUE(std::equal(std::begin(order), std::end(order), set.end() - 3, set.end()));
+
+    for(auto &&entity: entities) {
+        ASSERT_EQ(set.data()[set.index(entity)], entity);
+    }
+}
+
+TEST(SparseSet, Resort) {
+    entt::sparse_set set{};
+    entt::entity entities[6u]{entt::entity{7}, entt::entity{9}, entt::entity{3}, entt::entity{12}, entt::entity{42}, entt::entity{1}};
+    int key[43u]{};
+
+    for(auto entity: entities) {
+        key[entt::to_integral(entity)] = static_cast<int>(entt::to_integral(entity));
+    }
+
+    auto compare = [&key](const entt::entity lhs, const entt::entity rhs) { return key[entt::to_integral(lhs)] < key[entt::to_integral(rhs)]; };
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.sort(compare);
+
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end(), compare));
+
+    key[3] = 50;
+    key[42] = 0;
+    key[9] = 8;
+
+    const entt::entity changed[4u]{entt::entity{3}, entt::entity{42}, entt::entity{9}, entt::entity{3}};
+    set.resort(std::begin(changed), std::end(changed), compare);
+
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end(), compare));
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_EQ(*set.begin(), entt::entity{42});
+    ASSERT_EQ(*(set.end() - 1), entt::entity{3});
+
+    for(auto entity: entities) {
+        ASSERT_EQ(set.data()[set.index(entity)], entity);
+    }
+
+    set.resort(std::begin(changed), std::begin(changed), compare);
+
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end(), compare));
+}
+
 TEST(SparseSet, RespectDisjoint) {
     entt::sparse_set lhs;
     entt::sparse_set rhs;
@@ -1357,3 +1557,377 @@ TEST(SparseSet, ThrowingAllocator) {
 
     ASSERT_TRUE(set.contains(entt::entity{ENTT_SPARSE_PAGE}));
 }
+
+TEST(SparseSet, MemoryUsage) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+
+    ASSERT_EQ(set.memory_usage().total(), 0u);
+    ASSERT_EQ(set.memory_usage().tombstones, 0u);
+
+    set.emplace(entt::entity{0});
+    set.emplace(entt::entity{1});
+    set.emplace(entt::entity{ENTT_SPARSE_PAGE});
+
+    auto usage = set.memory_usage();
+
+    ASSERT_EQ(usage.sparse, 2u * (sizeof(entt::entity *) + sizeof(std::size_t)) + 2u * ENTT_SPARSE_PAGE * sizeof(entt::entity));
+    ASSERT_EQ(usage.packed, set.capacity() * sizeof(entt::entity));
+    ASSERT_EQ(usage.payload, 0u);
+    ASSERT_EQ(usage.groups, 0u);
+    ASSERT_EQ(usage.tombstones, 0u);
+    ASSERT_EQ(usage.total(), usage.sparse + usage.packed);
+
+    set.erase(entt::entity{0});
+    set.erase(entt::entity{ENTT_SPARSE_PAGE});
+
+    ASSERT_EQ(set.memory_usage().tombstones, 2u);
+    ASSERT_EQ(set.memory_usage().total(), usage.total());
+
+    set.compact();
+
+    ASSERT_EQ(set.memory_usage().tombstones, 0u);
+
+    set.clear();
+
+    ASSERT_EQ(set.memory_usage().tombstones, 0u);
+}
+
+TEST(SparseSet, Statistics) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    const entt::entity entities[3u]{entt::entity{0}, entt::entity{1}, entt::entity{ENTT_SPARSE_PAGE}};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entities[0u]);
+    set.compact();
+    set.sort(std::less{});
+
+    entt::sparse_set other{};
+    other.insert(std::begin(entities), std::end(entities));
+    other.erase(entities[0u]);
+
+    auto stats = set.statistics();
+    stats += other.statistics();
+
+    if constexpr(ENTT_SPARSE_SET_STATISTICS) {
+        ASSERT_EQ(stats.emplaced, 6u);
+        ASSERT_EQ(stats.erased, 2u);
+        ASSERT_EQ(stats.moved, 1u);
+        ASSERT_EQ(stats.tombstones, 1u);
+        ASSERT_EQ(stats.compactions, 1u);
+        ASSERT_EQ(stats.pages, 4u);
+        ASSERT_EQ(stats.sorts, 1u);
+    } else {
+        ASSERT_EQ(stats.emplaced, 0u);
+        ASSERT_EQ(stats.erased, 0u);
+        ASSERT_EQ(stats.pages, 0u);
+    }
+
+    set.clear();
+
+    ASSERT_EQ(set.statistics().erased, ENTT_SPARSE_SET_STATISTICS ? 3u : 0u);
+
+    set.reset_statistics();
+
+    ASSERT_EQ(set.statistics().emplaced, 0u);
+    ASSERT_EQ(set.statistics().erased, 0u);
+}
+
+TEST(SparseSet, Trim) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    const entt::entity entities[3u]{entt::entity{0}, entt::entity{ENTT_SPARSE_PAGE}, entt::entity{3 * ENTT_SPARSE_PAGE}};
+
+    set.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(set.extent(), 4 * ENTT_SPARSE_PAGE);
+    ASSERT_EQ(set.trim(), 0u);
+    ASSERT_EQ(set.extent(), 4 * ENTT_SPARSE_PAGE);
+
+    set.erase(entities[1u]);
+
+    ASSERT_EQ(set.trim(), 1u);
+    ASSERT_EQ(set.extent(), 4 * ENTT_SPARSE_PAGE);
+    ASSERT_FALSE(set.contains(entities[1u]));
+    ASSERT_EQ(set.current(entities[1u]), entt::entt_traits<entt::entity>::to_version(entt::tombstone));
+    ASSERT_TRUE(set.contains(entities[0u]));
+    ASSERT_TRUE(set.contains(entities[2u]));
+
+    set.emplace(entities[1u]);
+
+    ASSERT_TRUE(set.contains(entities[1u]));
+
+    set.erase(entities[2u]);
+
+    ASSERT_EQ(set.trim(), 1u);
+    ASSERT_EQ(set.extent(), 2 * ENTT_SPARSE_PAGE);
+
+    set.clear();
+
+    ASSERT_EQ(set.trim(), 2u);
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(set.contains(entities[0u]));
+    ASSERT_TRUE(set.contains(entities[1u]));
+    ASSERT_TRUE(set.contains(entities[2u]));
+}
+
+TEST(SparseSet, TrimWithBudget) {
+    entt::sparse_set set{};
+    const entt::entity entities[4u]{entt::entity{0}, entt::entity{ENTT_SPARSE_PAGE}, entt::entity{2 * ENTT_SPARSE_PAGE}, entt::entity{3 * ENTT_SPARSE_PAGE}};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entities[0u]);
+    set.erase(entities[1u]);
+    set.erase(entities[2u]);
+
+    ASSERT_EQ(set.trim(0u), 0u);
+    ASSERT_EQ(set.trim(1u), 1u);
+    ASSERT_EQ(set.trim(1u), 1u);
+    ASSERT_EQ(set.trim(1u), 1u);
+    ASSERT_EQ(set.trim(1u), 0u);
+    ASSERT_EQ(set.extent(), 4 * ENTT_SPARSE_PAGE);
+    ASSERT_TRUE(set.contains(entities[3u]));
+
+    entt::sparse_set other{std::move(set)};
+    other.erase(entities[3u]);
+
+    ASSERT_EQ(other.trim(8u), 1u);
+    ASSERT_EQ(other.extent(), 0u);
+}
+
+TEST(SparseSet, ReserveSparse) {
+    entt::sparse_set set{};
+    entt::sparse_set hashed{entt::type_id<void>(), entt::deletion_policy::swap_and_pop, entt::sparse_policy::hashed};
+    const auto usage = set.memory_usage().sparse;
+
+    set.reserve_sparse(0u);
+
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.reserve_sparse(ENTT_SPARSE_PAGE + 1u);
+
+    ASSERT_EQ(set.extent(), 2 * ENTT_SPARSE_PAGE);
+    ASSERT_GT(set.memory_usage().sparse, usage + ENTT_SPARSE_PAGE * sizeof(entt::entity));
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(entt::entity{0}));
+
+    set.emplace(entt::entity{ENTT_SPARSE_PAGE});
+    set.reserve_sparse(ENTT_SPARSE_PAGE);
+
+    ASSERT_EQ(set.extent(), 2 * ENTT_SPARSE_PAGE);
+    ASSERT_TRUE(set.contains(entt::entity{ENTT_SPARSE_PAGE}));
+    ASSERT_EQ(set.trim(), 1u);
+    ASSERT_TRUE(set.contains(entt::entity{ENTT_SPARSE_PAGE}));
+
+    hashed.reserve_sparse(42u);
+
+    ASSERT_EQ(hashed.extent(), 0u);
+    ASSERT_TRUE(hashed.empty());
+}
+
+TEST(SparseSet, HashedIndex) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::sparse_set set{entt::type_id<void>(), entt::deletion_policy::swap_and_pop, entt::sparse_policy::hashed};
+    entt::sparse_set paged{};
+    const entt::entity entities[3u]{entt::entity{3}, traits_type::construct(1u << 19u, 2u), entt::entity{42}};
+
+    ASSERT_EQ(set.index_policy(), entt::sparse_policy::hashed);
+    ASSERT_EQ(paged.index_policy(), entt::sparse_policy::paged);
+
+    set.insert(std::begin(entities), std::end(entities));
+    paged.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.extent(), 0u);
+    ASSERT_LT(set.memory_usage().sparse, paged.memory_usage().sparse);
+
+    ASSERT_TRUE(set.contains(entities[1u]));
+    ASSERT_FALSE(set.contains(traits_type::construct(1u << 19u, 0u)));
+    ASSERT_FALSE(set.contains(entt::entity{1u << 18u}));
+    ASSERT_EQ(set.index(entities[0u]), 0u);
+    ASSERT_EQ(set.index(entities[1u]), 1u);
+    ASSERT_EQ(set.index(entities[2u]), 2u);
+    ASSERT_EQ(set.current(entities[1u]), 2u);
+    ASSERT_EQ(set.current(entt::entity{1u << 18u}), traits_type::to_version(entt::tombstone));
+
+    set.erase(entities[0u]);
+
+    ASSERT_FALSE(set.contains(entities[0u]));
+    ASSERT_EQ(set.index(entities[2u]), 0u);
+    ASSERT_EQ(set.index(entities[1u]), 1u);
+
+    set.bump(traits_type::construct(1u << 19u, 7u));
+
+    ASSERT_EQ(set.current(entities[1u]), 7u);
+
+    set.sort([](auto lhs, auto rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+
+    ASSERT_EQ(set.index(entities[2u]), 1u);
+
+    entt::sparse_set other{std::move(set)};
+
+    ASSERT_EQ(other.index_policy(), entt::sparse_policy::hashed);
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_TRUE(other.contains(entities[2u]));
+
+    set = std::move(other);
+    set.clear();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(entities[2u]));
+    ASSERT_EQ(set.trim(), 0u);
+}
+
+TEST(SparseSet, HashedIndexInPlace) {
+    entt::sparse_set set{entt::type_id<void>(), entt::deletion_policy::in_place, entt::sparse_policy::hashed};
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{1u << 19u}, entt::entity{42}};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entities[1u]);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_FALSE(set.contains(entities[1u]));
+
+    set.emplace(entt::entity{7});
+
+    ASSERT_EQ(set.index(entt::entity{7}), 1u);
+
+    set.erase(entt::entity{7});
+    set.compact();
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.index(entities[0u]), 0u);
+    ASSERT_EQ(set.index(entities[2u]), 1u);
+}
+
+TEST(SparseSet, CompactIndex) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::sparse_set set{entt::type_id<void>(), entt::deletion_policy::swap_and_pop, entt::sparse_policy::compact};
+    entt::sparse_set paged{};
+    const entt::entity entities[3u]{entt::entity{3}, traits_type::construct(42u, 2u), entt::entity{ENTT_SPARSE_PAGE}};
+
+    ASSERT_EQ(set.index_policy(), entt::sparse_policy::compact);
+
+    set.insert(std::begin(entities), std::end(entities));
+    paged.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.extent(), paged.extent());
+    ASSERT_LT(set.memory_usage().sparse, paged.memory_usage().sparse);
+
+    ASSERT_TRUE(set.contains(entities[1u]));
+    ASSERT_FALSE(set.contains(traits_type::construct(42u, 0u)));
+    ASSERT_FALSE(set.contains(entt::entity{4}));
+    ASSERT_FALSE(set.contains(entt::entity{1u << 18u}));
+    ASSERT_EQ(set.index(entities[0u]), 0u);
+    ASSERT_EQ(set.index(entities[1u]), 1u);
+    ASSERT_EQ(set.index(entities[2u]), 2u);
+    ASSERT_EQ(set.current(entities[1u]), 2u);
+    ASSERT_EQ(set.current(entt::entity{4}), traits_type::to_version(entt::tombstone));
+
+    set.erase(entities[0u]);
+
+    ASSERT_FALSE(set.contains(entities[0u]));
+    ASSERT_EQ(set.index(entities[2u]), 0u);
+    ASSERT_EQ(set.index(entities[1u]), 1u);
+
+    set.bump(traits_type::construct(42u, 7u));
+
+    ASSERT_EQ(set.current(entities[1u]), 7u);
+    ASSERT_TRUE(set.contains(traits_type::construct(42u, 7u)));
+
+    set.sort([](auto lhs, auto rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+
+    ASSERT_EQ(set.index(entities[2u]), 1u);
+
+    set.swap_elements(entities[2u], traits_type::construct(42u, 7u));
+
+    ASSERT_EQ(set.index(entities[2u]), 0u);
+    ASSERT_EQ(set.data()[0u], entities[2u]);
+
+    entt::sparse_set other{std::move(set)};
+
+    ASSERT_EQ(other.index_policy(), entt::sparse_policy::compact);
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_TRUE(other.contains(entities[2u]));
+
+    set = std::move(other);
+    set.erase(entities[2u]);
+
+    ASSERT_EQ(set.trim(), 1u);
+    ASSERT_EQ(set.extent(), ENTT_SPARSE_PAGE);
+
+    set.clear();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(entities[1u]));
+    ASSERT_EQ(set.trim(), 1u);
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.reserve_sparse(1u);
+
+    ASSERT_EQ(set.extent(), ENTT_SPARSE_PAGE);
+}
+
+TEST(SparseSet, CompactIndexOverflow) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::sparse_set set{entt::type_id<void>(), entt::deletion_policy::in_place, entt::sparse_policy::compact};
+    std::vector<entt::entity> entities(65535u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        entities[pos] = traits_type::construct(static_cast<typename traits_type::entity_type>(pos), 1u);
+    }
+
+    set.insert(entities.begin(), entities.end());
+    set.erase(entities[3u]);
+    set.emplace(entities[3u]);
+
+    ASSERT_EQ(set.index_policy(), entt::sparse_policy::compact);
+    ASSERT_EQ(set.size(), 65535u);
+    ASSERT_EQ(set.index(entities[3u]), 3u);
+
+    set.emplace(entt::entity{65535u});
+
+    ASSERT_EQ(set.index_policy(), entt::sparse_policy::paged);
+    ASSERT_EQ(set.size(), 65536u);
+    ASSERT_TRUE(set.contains(entities[65534u]));
+    ASSERT_FALSE(set.contains(traits_type::construct(65534u, 0u)));
+    ASSERT_EQ(set.index(entities[3u]), 3u);
+    ASSERT_EQ(set.index(entities[65534u]), 65534u);
+    ASSERT_EQ(set.index(entt::entity{65535u}), 65535u);
+
+    set.erase(entities[7u]);
+
+    ASSERT_FALSE(set.contains(entities[7u]));
+
+    set.emplace(entities[7u]);
+
+    ASSERT_EQ(set.size(), 65536u);
+    ASSERT_EQ(set.index(entities[7u]), 7u);
+}
+
+TEST(SparseSet, CompactIndexInPlace) {
+    entt::sparse_set set{entt::type_id<void>(), entt::deletion_policy::in_place, entt::sparse_policy::compact};
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{1u << 19u}, entt::entity{42}};
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.erase(entities[1u]);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_FALSE(set.contains(entities[1u]));
+
+    set.emplace(entt::entity{7});
+
+    ASSERT_EQ(set.index(entt::entity{7}), 1u);
+
+    set.erase(entt::entity{7});
+    set.compact();
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.index(entities[0u]), 0u);
+    ASSERT_EQ(set.index(entities[2u]), 1u);
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/spatial_storage_mixin.hpp>
+#include <entt/entity/storage.hpp>
+
+struct position {
+    float x;
+    float y;
+};
+
+struct grid_locator {
+    std::pair<std::int32_t, std::int32_t> operator()(const position &pos) const {
+        return {static_cast<std::int32_t>(pos.x >= 0.f ? pos.x / 10.f : pos.x / 10.f - 1.f), static_cast<std::int32_t>(pos.y >= 0.f ? pos.y / 10.f : pos.y / 10.f - 1.f)};
+    }
+};
+
+template<>
+struct entt::storage_traits<entt::entity, position> {
+    using storage_type = entt::sigh_storage_mixin<entt::spatial_storage_mixin<entt::basic_storage<entt::entity, position>, grid_locator>>;
+};
+
+template<typename Storage>
+std::vector<entt::entity> query(Storage &storage, const std::pair<std::int32_t, std::int32_t> min, const std::pair<std::int32_t, std::int32_t> max) {
+    std::vector<entt::entity> result{};
+
+    storage.query_aabb(min, max, [&result, &storage](const entt::entity entity, position &pos) {
+        ASSERT_EQ(&storage.get(entity), &pos);
+        result.push_back(entity);
+    });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(SpatialStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<position>();
+
+    ASSERT_TRUE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 0u);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+    const auto e3 = registry.create();
+
+    registry.emplace<position>(e0, 1.f, 1.f);
+    registry.emplace<position>(e1, 15.f, 1.f);
+    registry.emplace<position>(e2, 2.f, 3.f);
+    registry.emplace<position>(e3, -5.f, 25.f);
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(storage.refresh(), 3u);
+    ASSERT_TRUE(storage.arranged());
+
+    ASSERT_EQ(query(storage, {0, 0}, {0, 0}), (std::vector<entt::entity>{e0, e2}));
+    ASSERT_EQ(query(storage, {0, 0}, {1, 0}), (std::vector<entt::entity>{e0, e1, e2}));
+    ASSERT_EQ(query(storage, {-1, 0}, {0, 2}), (std::vector<entt::entity>{e0, e2, e3}));
+    ASSERT_EQ(query(storage, {2, 2}, {5, 5}), (std::vector<entt::entity>{}));
+
+    registry.patch<position>(e1, [](auto &pos) { pos.x = 5.f; });
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(query(storage, {0, 0}, {0, 0}), (std::vector<entt::entity>{e0, e1, e2}));
+
+    registry.erase<position>(e0);
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(query(storage, {0, 0}, {0, 0}), (std::vector<entt::entity>{e1, e2}));
+
+    registry.get<position>(e2).y = 35.f;
+    storage.invalidate();
+
+    ASSERT_EQ(query(storage, {0, 0}, {0, 0}), (std::vector<entt::entity>{e1}));
+    ASSERT_EQ(query(storage, {-1, 2}, {0, 3}), (std::vector<entt::entity>{e2, e3}));
+}
+
+TEST(SpatialStorageMixin, Insert) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(100u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end(), position{50.f, 50.f});
+
+    auto &storage = registry.storage<position>();
+
+    for(std::size_t pos{}; pos < entities.size(); pos += 2u) {
+        registry.replace<position>(entities[pos], static_cast<float>(pos), static_cast<float>(pos));
+    }
+
+    std::size_t count{};
+
+    storage.query_aabb({5, 5}, {5, 5}, [&count](const entt::entity, const position &pos) {
+        ASSERT_GE(pos.x, 50.f);
+        ASSERT_LT(pos.x, 60.f);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 55u);
+
+    registry.view<position>().each([&storage](const entt::entity entity, const position &pos) {
+        const auto [x, y] = grid_locator{}(pos);
+        bool found = false;
+
+        storage.query_aabb({x, y}, {x, y}, [entity, &found](const entt::entity other, const position &) {
+            found = found || (other == entity);
+        });
+
+        ASSERT_TRUE(found);
+    });
+}
+
+TEST(SpatialStorageMixin, EraseRangeAndClear) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(6u);
+    auto &storage = registry.storage<position>();
+
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        // one cell per entity, along the first row
+        registry.emplace<position>(entities[pos], static_cast<float>(pos * 10u + 1u), 1.f);
+    }
+
+    ASSERT_EQ(storage.refresh(), 6u);
+
+    const entt::entity erased[]{entities[1u], entities[3u]};
+    registry.erase<position>(std::begin(erased), std::end(erased));
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(query(storage, {0, 0}, {5, 0}), (std::vector<entt::entity>{entities[0u], entities[2u], entities[4u], entities[5u]}));
+    ASSERT_EQ(query(storage, {1, 0}, {1, 0}), (std::vector<entt::entity>{}));
+    ASSERT_EQ(storage.refresh(), 4u);
+
+    registry.destroy(entities.begin() + 4u, entities.end());
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(query(storage, {0, 0}, {5, 0}), (std::vector<entt::entity>{entities[0u], entities[2u]}));
+    ASSERT_EQ(query(storage, {4, 0}, {5, 0}), (std::vector<entt::entity>{}));
+    ASSERT_EQ(storage.refresh(), 2u);
+
+    registry.clear<position>();
+
+    ASSERT_FALSE(storage.arranged());
+    ASSERT_EQ(query(storage, {0, 0}, {5, 0}), (std::vector<entt::entity>{}));
+    ASSERT_EQ(storage.refresh(), 0u);
+    ASSERT_TRUE(storage.arranged());
+
+    registry.emplace<position>(entities[2u], 41.f, 1.f);
+
+    ASSERT_EQ(query(storage, {0, 0}, {3, 0}), (std::vector<entt::entity>{}));
+    ASSERT_EQ(query(storage, {4, 0}, {4, 0}), (std::vector<entt::entity>{entities[2u]}));
+}
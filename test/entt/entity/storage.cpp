@@ -1,11 +1,14 @@
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/component.hpp>
 #include <entt/entity/storage.hpp>
@@ -75,12 +78,172 @@ struct crete_from_constructor {
     entt::entity child;
 };
 
+struct soa_type {
+    float x;
+    float y;
+    int value;
+};
+
+struct stable_soa_type {
+    int value;
+};
+
+struct hashed_type {
+    static constexpr auto hashed_index = true;
+    int value;
+};
+
+struct compact_type {
+    static constexpr auto compact_index = true;
+    int value;
+};
+
+struct alignas(16) simd_type {
+    static constexpr auto page_alignment = 64u;
+    float value[4u];
+};
+
+struct cow_type {
+    static constexpr auto copy_on_write = true;
+    static constexpr auto page_size = 4u;
+
+    cow_type(int elem)
+        : value{elem} {
+        ++instances;
+    }
+
+    cow_type(const cow_type &other)
+        : value{other.value} {
+        ++instances;
+    }
+
+    cow_type &operator=(const cow_type &) = default;
+
+    ~cow_type() {
+        --instances;
+    }
+
+    inline static int instances{};
+    int value;
+};
+
+struct dirty_type {
+    static constexpr auto dirty_pages = true;
+    static constexpr auto page_size = 4u;
+    int value;
+};
+
+struct shared_type {
+    static constexpr auto shared = true;
+
+    [[nodiscard]] bool operator==(const shared_type &other) const {
+        return mesh == other.mesh && material == other.material;
+    }
+
+    int mesh;
+    int material;
+};
+
+template<>
+struct std::hash<shared_type> {
+    std::size_t operator()(const shared_type &elem) const {
+        // collisions on purpose, the storage must compare instances anyway
+        return static_cast<std::size_t>(elem.mesh);
+    }
+};
+
+struct pinned_type {
+    static constexpr auto pinned = true;
+    int value;
+};
+
+struct relocatable_type {
+    static constexpr auto trivially_relocatable = true;
+
+    relocatable_type(int elem)
+        : value{std::make_unique<int>(elem)} {}
+
+    relocatable_type(relocatable_type &&other)
+        : value{std::move(other.value)} {
+        ++moves;
+    }
+
+    relocatable_type &operator=(relocatable_type &&other) {
+        value = std::move(other.value);
+        return ++moves, *this;
+    }
+
+    ~relocatable_type() {
+        ++destroyed;
+    }
+
+    inline static int moves{};
+    inline static int destroyed{};
+    std::unique_ptr<int> value;
+};
+
+struct stable_relocatable_type: relocatable_type {
+    static constexpr auto in_place_delete = true;
+    using relocatable_type::relocatable_type;
+};
+
+struct stable_cow_type {
+    static constexpr auto copy_on_write = true;
+    static constexpr auto in_place_delete = true;
+    static constexpr auto page_size = 4u;
+    int value;
+};
+
+template<>
+struct entt::component_traits<soa_type> {
+    static constexpr auto in_place_delete = false;
+    static constexpr auto page_size = ENTT_PACKED_PAGE;
+    using soa_members = entt::value_list<&soa_type::x, &soa_type::y, &soa_type::value>;
+};
+
+template<>
+struct entt::component_traits<stable_soa_type> {
+    static constexpr auto in_place_delete = true;
+    static constexpr auto page_size = ENTT_PACKED_PAGE;
+    using soa_members = entt::value_list<&stable_soa_type::value>;
+};
+
 template<>
 struct entt::component_traits<std::unordered_set<char>> {
     static constexpr auto in_place_delete = true;
     static constexpr auto page_size = ENTT_PACKED_PAGE;
 };
 
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) {
+        std::vector<std::thread> workers{};
+        chunks += count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back([&task, pos]() { task(pos); });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t chunks{};
+};
+
+struct page_aware_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task, const std::size_t page) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            pages.push_back(page + pos);
+            task(pos);
+        }
+    }
+
+    std::vector<std::size_t> pages{};
+};
+
 bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
     return lhs.value == rhs.value;
 }
@@ -289,6 +452,132 @@ TEST(Storage, Insert) {
     ASSERT_EQ(pool.get(entities[1u]).value, 42);
 }
 
+TEST(Storage, ParInsert) {
+    entt::storage<int> pool;
+    thread_executor executor{};
+    std::vector<entt::entity> entities{};
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 2u; ++pos) {
+        entities.push_back(entt::entity{static_cast<entt::id_type>(pos + 1u)});
+    }
+
+    pool.par_insert(executor, entities.cbegin(), entities.cend());
+
+    ASSERT_EQ(executor.chunks, 2u);
+    ASSERT_EQ(pool.size(), ENTT_PACKED_PAGE * 2u);
+    ASSERT_EQ(pool.capacity(), ENTT_PACKED_PAGE * 2u);
+
+    pool.erase(entities.cbegin() + ENTT_PACKED_PAGE / 2u, entities.cend());
+    pool.par_insert(executor, entities.cbegin() + ENTT_PACKED_PAGE / 2u, entities.cend(), 42);
+
+    ASSERT_EQ(executor.chunks, 4u);
+    ASSERT_EQ(pool.size(), ENTT_PACKED_PAGE * 2u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(pool.get(entities[pos]), pos < ENTT_PACKED_PAGE / 2u ? 0 : 42);
+    }
+
+    pool.par_insert(executor, entities.cend(), entities.cend());
+
+    ASSERT_EQ(executor.chunks, 4u);
+}
+
+TEST(Storage, ParInsertPageAware) {
+    entt::storage<int> pool;
+    page_aware_executor executor{};
+    std::vector<entt::entity> entities{};
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 3u; ++pos) {
+        entities.push_back(entt::entity{static_cast<entt::id_type>(pos)});
+    }
+
+    pool.par_insert(executor, entities.cbegin(), entities.cbegin() + ENTT_PACKED_PAGE / 2u);
+
+    ASSERT_EQ(executor.pages, (std::vector<std::size_t>{0u}));
+
+    pool.par_insert(executor, entities.cbegin() + ENTT_PACKED_PAGE / 2u, entities.cend(), 42);
+
+    ASSERT_EQ(executor.pages, (std::vector<std::size_t>{0u, 0u, 1u, 2u}));
+    ASSERT_EQ(pool.size(), ENTT_PACKED_PAGE * 3u);
+    ASSERT_EQ(pool.get(entities.back()), 42);
+}
+
+TEST(Storage, ParInsertSoA) {
+    entt::storage<soa_type> pool;
+    thread_executor executor{};
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
+
+    pool.par_insert(executor, std::begin(entities), std::end(entities), soa_type{1.f, 2.f, 3});
+
+    ASSERT_EQ(executor.chunks, 1u);
+    ASSERT_EQ(pool.size(), 3u);
+
+    for(auto entity: entities) {
+        ASSERT_EQ(pool.get(entity).get<&soa_type::x>(), 1.f);
+        ASSERT_EQ(pool.get(entity).get<&soa_type::y>(), 2.f);
+        ASSERT_EQ(pool.get(entity).get<&soa_type::value>(), 3);
+    }
+}
+
+TEST(Storage, InsertContiguousBlock) {
+    entt::storage<int> pool;
+    constexpr auto page_size = entt::component_traits<int>::page_size;
+    std::vector<entt::entity> entities{};
+    std::vector<int> values{};
+
+    pool.emplace(entt::entity{0}, -1);
+
+    for(std::size_t pos{}; pos < page_size * 2u; ++pos) {
+        entities.push_back(entt::entity{static_cast<entt::id_type>(pos + 1u)});
+        values.push_back(static_cast<int>(pos));
+    }
+
+    pool.insert(entities.cbegin(), entities.cend(), values.data());
+
+    ASSERT_EQ(pool.size(), page_size * 2u + 1u);
+    ASSERT_EQ(pool.capacity(), page_size * 3u);
+    ASSERT_EQ(pool.get(entt::entity{0}), -1);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(pool.index(entities[pos]), pos + 1u);
+        ASSERT_EQ(pool.get(entities[pos]), values[pos]);
+    }
+
+    pool.insert(entities.cbegin(), entities.cbegin(), values.data());
+
+    ASSERT_EQ(pool.size(), page_size * 2u + 1u);
+}
+
+TEST(Storage, InsertContiguousRange) {
+    entt::storage<int> pool;
+    constexpr auto page_size = entt::component_traits<int>::page_size;
+    std::vector<entt::entity> entities{};
+    std::vector<int> values{};
+
+    for(std::size_t pos{}; pos < page_size * 2u; ++pos) {
+        entities.push_back(entt::entity{static_cast<entt::id_type>(pos)});
+        values.push_back(static_cast<int>(pos));
+    }
+
+    pool.insert(entities.cbegin(), entities.cend(), values.cbegin());
+
+    ASSERT_EQ(pool.size(), page_size * 2u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(pool.get(entities[pos]), values[pos]);
+    }
+
+    pool.clear();
+    pool.insert(entities.cbegin(), entities.cend(), 42);
+
+    ASSERT_EQ(pool.size(), page_size * 2u);
+    ASSERT_EQ(pool.capacity(), page_size * 2u);
+
+    for(auto entity: entities) {
+        ASSERT_EQ(pool.get(entity), 42);
+    }
+}
+
 TEST(Storage, InsertEmptyType) {
     entt::storage<empty_stable_type> pool;
     entt::entity entities[2u]{entt::entity{3}, entt::entity{42}};
@@ -312,6 +601,50 @@ TEST(Storage, InsertEmptyType) {
     ASSERT_EQ(pool.index(entities[1u]), 2u);
 }
 
+TEST(Storage, ClearInBulk) {
+    entt::storage<std::shared_ptr<int>> pool;
+    entt::storage<soa_type> soa;
+    entt::storage<cow_type> cow;
+    auto value = std::make_shared<int>(42);
+    std::vector<entt::entity> entities(3000u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        entities[pos] = entt::entity{static_cast<entt::id_type>(pos * 3u)};
+    }
+
+    pool.insert(entities.begin(), entities.end(), value);
+    soa.insert(entities.begin(), entities.end(), soa_type{1.f, 2.f, 3});
+    cow.insert(entities.begin(), entities.begin() + 10u, cow_type{0});
+
+    ASSERT_EQ(value.use_count(), 3001);
+    ASSERT_EQ(cow_type::instances, 10);
+
+    const auto frame = cow.freeze();
+    pool.clear();
+    soa.clear();
+    cow.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(soa.empty());
+    ASSERT_TRUE(cow.empty());
+    ASSERT_EQ(value.use_count(), 1);
+    ASSERT_EQ(cow_type::instances, 10);
+    ASSERT_EQ(frame.size(), 10u);
+
+    for(auto entity: entities) {
+        ASSERT_FALSE(pool.contains(entity));
+        ASSERT_FALSE(soa.contains(entity));
+    }
+
+    pool.insert(entities.begin() + 1u, entities.begin() + 3u, value);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.index(entities[2u]), 1u);
+    ASSERT_EQ(*pool.get(entities[1u]), 42);
+    // sparse pages are still allocated but only the first one is in use
+    ASSERT_EQ(pool.trim(), 2u);
+}
+
 TEST(Storage, Erase) {
     entt::storage<int> pool;
     entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{9}};
@@ -604,6 +937,19 @@ TEST(Storage, TypeFromBase) {
     ASSERT_TRUE(pool.empty());
 }
 
+TEST(Storage, MoveEmplaceFromBase) {
+    entt::storage<std::unique_ptr<int>> pool;
+    entt::sparse_set &base = pool;
+    auto instance = std::make_unique<int>(42);
+
+    ASSERT_EQ(base.emplace(entt::entity{3}, &instance), base.end());
+    ASSERT_NE(base.move_emplace(entt::entity{3}, &instance), base.end());
+
+    ASSERT_TRUE(pool.contains(entt::entity{3}));
+    ASSERT_EQ(*pool.get(entt::entity{3}), 42);
+    ASSERT_EQ(instance, nullptr);
+}
+
 TEST(Storage, EmptyTypeFromBase) {
     entt::storage<empty_stable_type> pool;
     entt::sparse_set &base = pool;
@@ -778,6 +1124,38 @@ TEST(Storage, Compact) {
 
     ASSERT_TRUE(pool.empty());
 }
+TEST(Storage, Defragment) {
+    entt::storage<stable_type> pool;
+
+    ASSERT_TRUE(pool.defragment(0u));
+
+    for(int next{}; next < 8; ++next) {
+        pool.emplace(entt::entity(next), stable_type{next});
+    }
+
+    for(int next{}; next < 8; next += 2) {
+        pool.erase(entt::entity(next));
+    }
+
+    ASSERT_EQ(pool.size(), 8u);
+
+    while(!pool.defragment(1u)) {}
+
+    ASSERT_EQ(pool.size(), 4u);
+
+    for(int next = 1; next < 8; next += 2) {
+        ASSERT_EQ(pool.index(entt::entity(next)), static_cast<std::size_t>(next / 2));
+        ASSERT_EQ(pool.get(entt::entity(next)).value, next);
+    }
+
+    pool.erase(entt::entity{1});
+    pool.defragment();
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.index(entt::entity{3}), 0u);
+    ASSERT_EQ(pool.get(entt::entity{7}).value, 7);
+}
+
 
 TEST(Storage, ShrinkToFit) {
     entt::storage<int> pool;
@@ -808,6 +1186,41 @@ TEST(Storage, ShrinkToFit) {
     ASSERT_EQ(pool.size(), 0u);
 }
 
+
+TEST(Storage, Replenish) {
+    entt::storage<int> pool;
+
+    ASSERT_EQ(pool.spare_pages(), 0u);
+    ASSERT_EQ(pool.replenish(0u), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    ASSERT_EQ(pool.replenish(2u), 2u);
+    ASSERT_EQ(pool.spare_pages(), 2u);
+    ASSERT_EQ(pool.capacity(), 2 * ENTT_PACKED_PAGE);
+
+    pool.emplace(entt::entity{0}, 0);
+    const auto *page = &pool.get(entt::entity{0});
+
+    ASSERT_EQ(pool.spare_pages(), 1u);
+    ASSERT_EQ(pool.replenish(2u), 1u);
+    ASSERT_EQ(pool.replenish(2u), 0u);
+    ASSERT_EQ(pool.spare_pages(), 2u);
+    ASSERT_EQ(pool.capacity(), 3 * ENTT_PACKED_PAGE);
+    ASSERT_EQ(&pool.get(entt::entity{0}), page);
+
+    for(std::size_t next{1u}; next <= ENTT_PACKED_PAGE; ++next) {
+        pool.emplace(entt::entity(next), static_cast<int>(next));
+    }
+
+    ASSERT_EQ(pool.capacity(), 3 * ENTT_PACKED_PAGE);
+    ASSERT_EQ(pool.spare_pages(), 1u);
+    ASSERT_EQ(pool.get(entt::entity{ENTT_PACKED_PAGE}), ENTT_PACKED_PAGE);
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.spare_pages(), 0u);
+    ASSERT_EQ(pool.capacity(), 2 * ENTT_PACKED_PAGE);
+}
 TEST(Storage, AggregatesMustWork) {
     struct aggregate_type {
         int value;
@@ -1264,84 +1677,291 @@ TEST(Storage, Raw) {
     ASSERT_EQ(pool.raw()[0u][2u], 9);
 }
 
-TEST(Storage, SortOrdered) {
-    entt::storage<boxed_int> pool;
-    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
-    boxed_int values[5u]{{12}, {9}, {6}, {3}, {1}};
+TEST(Storage, Chunks) {
+    using traits_type = entt::component_traits<int>;
+    entt::storage<int> pool;
 
-    pool.insert(std::begin(entities), std::end(entities), values);
-    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    ASSERT_EQ(pool.chunks().begin(), pool.chunks().end());
 
-    ASSERT_TRUE(std::equal(std::rbegin(entities), std::rend(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
-    ASSERT_TRUE(std::equal(std::rbegin(values), std::rend(values), pool.begin(), pool.end()));
-}
+    for(std::size_t pos{}; pos < traits_type::page_size + 2u; ++pos) {
+        pool.emplace(entt::entity(pos), static_cast<int>(pos));
+    }
 
-TEST(Storage, SortReverse) {
-    entt::storage<boxed_int> pool;
-    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
-    boxed_int values[5u]{{1}, {3}, {6}, {9}, {12}};
+    auto chunks = pool.chunks();
+    auto it = chunks.begin();
 
-    pool.insert(std::begin(entities), std::end(entities), values);
-    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    static_assert(std::is_same_v<decltype(*it), std::tuple<const entt::entity *, int *, std::size_t>>);
+    static_assert(std::is_same_v<decltype(*std::as_const(pool).chunks().begin()), std::tuple<const entt::entity *, const int *, std::size_t>>);
 
-    ASSERT_TRUE(std::equal(std::begin(entities), std::end(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
-    ASSERT_TRUE(std::equal(std::begin(values), std::end(values), pool.begin(), pool.end()));
-}
+    ASSERT_EQ(chunks.end() - chunks.begin(), 2);
+    ASSERT_EQ(std::get<0>(*it), pool.data());
+    ASSERT_EQ(std::get<1>(*it), pool.raw()[0u]);
+    ASSERT_EQ(std::get<2>(*it), traits_type::page_size);
 
-TEST(Storage, SortUnordered) {
-    entt::storage<boxed_int> pool;
-    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
-    boxed_int values[5u]{{6}, {3}, {1}, {9}, {12}};
+    ASSERT_EQ(std::get<0>(it[1]), pool.data() + traits_type::page_size);
+    ASSERT_EQ(std::get<1>(it[1]), pool.raw()[1u]);
+    ASSERT_EQ(std::get<2>(it[1]), 2u);
 
-    pool.insert(std::begin(entities), std::end(entities), values);
-    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    std::size_t count{};
 
-    auto begin = pool.begin();
-    auto end = pool.end();
+    for(auto [entities, values, length]: chunks) {
+        for(std::size_t pos{}; pos < length; ++pos, ++count) {
+            ASSERT_EQ(values[pos], static_cast<int>(entt::to_integral(entities[pos])));
+            values[pos] = -values[pos];
+        }
+    }
 
-    ASSERT_EQ(*(begin++), values[2u]);
-    ASSERT_EQ(*(begin++), values[1u]);
-    ASSERT_EQ(*(begin++), values[0u]);
-    ASSERT_EQ(*(begin++), values[3u]);
-    ASSERT_EQ(*(begin++), values[4u]);
-    ASSERT_EQ(begin, end);
+    ASSERT_EQ(count, pool.size());
+    ASSERT_EQ(pool.get(entt::entity{3}), -3);
 
-    ASSERT_EQ(pool.data()[0u], entities[4u]);
-    ASSERT_EQ(pool.data()[1u], entities[3u]);
-    ASSERT_EQ(pool.data()[2u], entities[0u]);
-    ASSERT_EQ(pool.data()[3u], entities[1u]);
-    ASSERT_EQ(pool.data()[4u], entities[2u]);
+    for(auto [entities, values, length]: std::as_const(pool).chunks()) {
+        ASSERT_EQ(values[length - 1u], -static_cast<int>(entt::to_integral(entities[length - 1u])));
+    }
 }
 
-TEST(Storage, SortRange) {
-    entt::storage<boxed_int> pool;
-    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
-    boxed_int values[5u]{{3}, {6}, {1}, {9}, {12}};
+TEST(Storage, Pinned) {
+    static_assert(entt::pinned_v<pinned_type>);
+    static_assert(entt::component_traits<pinned_type>::in_place_delete);
 
-    pool.insert(std::begin(entities), std::end(entities), values);
-    pool.sort_n(0u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    entt::storage<pinned_type> pool;
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
 
-    ASSERT_TRUE(std::equal(std::rbegin(entities), std::rend(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
-    ASSERT_TRUE(std::equal(std::rbegin(values), std::rend(values), pool.begin(), pool.end()));
+    pool.insert(std::begin(entities), std::end(entities), pinned_type{2});
+    pool.get(entities[1u]).value = 1;
+    pool.get(entities[2u]).value = 3;
 
-    pool.sort_n(2u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::pinned);
 
-    ASSERT_EQ(pool.raw()[0u][0u], values[1u]);
-    ASSERT_EQ(pool.raw()[0u][1u], values[0u]);
-    ASSERT_EQ(pool.raw()[0u][2u], values[2u]);
+    const auto handle = pool.pin(entities[2u]);
+    const auto *instance = &pool.get(entities[2u]);
 
-    ASSERT_EQ(pool.data()[0u], entities[1u]);
-    ASSERT_EQ(pool.data()[1u], entities[0u]);
-    ASSERT_EQ(pool.data()[2u], entities[2u]);
+    ASSERT_EQ(pool.pinned(handle, entities[2u]), instance);
+    ASSERT_EQ(pool.pinned(handle, entities[1u]), nullptr);
+    ASSERT_EQ(pool.pinned(pool.size(), entities[2u]), nullptr);
 
-    pool.sort_n(5u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+    pool.erase(entities[0u]);
+    pool.erase(entities[1u]);
+    pool.compact();
 
-    auto begin = pool.begin();
-    auto end = pool.end();
+    ASSERT_FALSE(pool.defragment(1u));
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.pin(entities[2u]), handle);
+    ASSERT_EQ(pool.pinned(handle, entities[2u]), instance);
+    ASSERT_EQ(instance->value, 3);
 
-    ASSERT_EQ(*(begin++), values[2u]);
-    ASSERT_EQ(*(begin++), values[0u]);
-    ASSERT_EQ(*(begin++), values[1u]);
+    pool.erase(entities[2u]);
+
+    ASSERT_EQ(pool.pinned(handle, entities[2u]), nullptr);
+
+    pool.emplace(entt::entity{99}, 4);
+
+    ASSERT_EQ(pool.pinned(handle, entities[2u]), nullptr);
+    ASSERT_EQ(pool.pinned(pool.pin(entt::entity{99}), entt::entity{99})->value, 4);
+}
+
+TEST(Storage, TriviallyRelocatable) {
+    static_assert(entt::trivially_relocatable_v<relocatable_type>);
+    static_assert(!entt::trivially_relocatable_v<int>);
+
+    entt::storage<relocatable_type> pool;
+    const entt::entity entities[4u]{entt::entity{3}, entt::entity{42}, entt::entity{7}, entt::entity{9}};
+
+    for(auto pos = 0; pos < 4; ++pos) {
+        pool.emplace(entities[pos], pos);
+    }
+
+    relocatable_type::moves = {};
+    relocatable_type::destroyed = {};
+
+    pool.erase(entities[0u]);
+    pool.erase(std::begin(entities) + 2u, std::end(entities));
+
+    ASSERT_EQ(relocatable_type::moves, 0);
+    ASSERT_EQ(relocatable_type::destroyed, 3);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(*pool.get(entities[1u]).value, 1);
+
+    entt::storage<stable_relocatable_type> stable;
+
+    for(auto pos = 0; pos < 4; ++pos) {
+        stable.emplace(entities[pos], pos);
+    }
+
+    stable.erase(entities[0u]);
+    stable.erase(entities[2u]);
+
+    relocatable_type::moves = {};
+    relocatable_type::destroyed = {};
+
+    stable.compact();
+
+    ASSERT_EQ(relocatable_type::moves, 0);
+    ASSERT_EQ(relocatable_type::destroyed, 0);
+    ASSERT_EQ(stable.size(), 2u);
+    ASSERT_EQ(*stable.get(entities[1u]).value, 1);
+    ASSERT_EQ(*stable.get(entities[3u]).value, 3);
+}
+
+TEST(Storage, DirtyPages) {
+    entt::basic_storage<entt::entity, dirty_type, entt::aligned_allocator<dirty_type, 256u>> pool;
+    std::vector<std::size_t> pages{};
+
+    const auto clean = [&pages](std::size_t page, const entt::entity *entities, const dirty_type *values, std::size_t length) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(values) % 256u, 0u);
+
+        for(std::size_t pos{}; pos < length; ++pos) {
+            ASSERT_EQ(values[pos].value, static_cast<int>(entt::to_integral(entities[pos])));
+        }
+
+        pages.push_back(page);
+    };
+
+    ASSERT_FALSE(pool.dirty_page(0u));
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        pool.emplace(entt::entity(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_TRUE(pool.dirty_page(0u));
+    ASSERT_TRUE(pool.dirty_page(2u));
+
+    pool.clean_pages(clean);
+
+    ASSERT_EQ(pages, (std::vector<std::size_t>{0u, 1u, 2u}));
+    ASSERT_FALSE(pool.dirty_page(0u));
+    ASSERT_FALSE(pool.dirty_page(1u));
+    ASSERT_FALSE(pool.dirty_page(2u));
+
+    pool.patch(entt::entity{5}, [](auto &elem) { elem.value = 5; });
+    pool.get(entt::entity{9}).value = 9;
+
+    ASSERT_FALSE(pool.dirty_page(0u));
+    ASSERT_TRUE(pool.dirty_page(1u));
+    ASSERT_FALSE(pool.dirty_page(2u));
+
+    pool.touch_page(entt::entity{9});
+    pages.clear();
+    pool.clean_pages(clean);
+
+    ASSERT_EQ(pages, (std::vector<std::size_t>{1u, 2u}));
+
+    pool.erase(entt::entity{0});
+    pages.clear();
+    pool.clean_pages(clean);
+
+    // the last element is moved to the front
+    ASSERT_EQ(pages, (std::vector<std::size_t>{0u}));
+
+    for([[maybe_unused]] auto &&curr: std::as_const(pool).each()) {}
+
+    ASSERT_FALSE(pool.dirty_page(1u));
+
+    for(auto [entt, elem]: pool.each()) {
+        elem.value = static_cast<int>(entt::to_integral(entt));
+    }
+
+    pages.clear();
+    pool.clean_pages(clean);
+
+    ASSERT_EQ(pages, (std::vector<std::size_t>{0u, 1u, 2u}));
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_FALSE(pool.dirty_page(0u));
+}
+
+TEST(Storage, ChunksIteratorConversion) {
+    entt::storage<boxed_int> pool;
+    pool.emplace(entt::entity{3}, 42);
+
+    typename entt::storage<boxed_int>::chunk_iterable::iterator it = pool.chunks().begin();
+    typename entt::storage<boxed_int>::const_chunk_iterable::iterator cit = it;
+
+    ASSERT_EQ(it, cit);
+    ASSERT_EQ(std::get<1>(*cit)->value, 42);
+    ASSERT_NE(++cit, it);
+    ASSERT_EQ(cit, std::as_const(pool).chunks().end());
+}
+
+TEST(Storage, SortOrdered) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+    boxed_int values[5u]{{12}, {9}, {6}, {3}, {1}};
+
+    pool.insert(std::begin(entities), std::end(entities), values);
+    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_TRUE(std::equal(std::rbegin(entities), std::rend(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
+    ASSERT_TRUE(std::equal(std::rbegin(values), std::rend(values), pool.begin(), pool.end()));
+}
+
+TEST(Storage, SortReverse) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+    boxed_int values[5u]{{1}, {3}, {6}, {9}, {12}};
+
+    pool.insert(std::begin(entities), std::end(entities), values);
+    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_TRUE(std::equal(std::begin(entities), std::end(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
+    ASSERT_TRUE(std::equal(std::begin(values), std::end(values), pool.begin(), pool.end()));
+}
+
+TEST(Storage, SortUnordered) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+    boxed_int values[5u]{{6}, {3}, {1}, {9}, {12}};
+
+    pool.insert(std::begin(entities), std::end(entities), values);
+    pool.sort([&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    auto begin = pool.begin();
+    auto end = pool.end();
+
+    ASSERT_EQ(*(begin++), values[2u]);
+    ASSERT_EQ(*(begin++), values[1u]);
+    ASSERT_EQ(*(begin++), values[0u]);
+    ASSERT_EQ(*(begin++), values[3u]);
+    ASSERT_EQ(*(begin++), values[4u]);
+    ASSERT_EQ(begin, end);
+
+    ASSERT_EQ(pool.data()[0u], entities[4u]);
+    ASSERT_EQ(pool.data()[1u], entities[3u]);
+    ASSERT_EQ(pool.data()[2u], entities[0u]);
+    ASSERT_EQ(pool.data()[3u], entities[1u]);
+    ASSERT_EQ(pool.data()[4u], entities[2u]);
+}
+
+TEST(Storage, SortRange) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+    boxed_int values[5u]{{3}, {6}, {1}, {9}, {12}};
+
+    pool.insert(std::begin(entities), std::end(entities), values);
+    pool.sort_n(0u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_TRUE(std::equal(std::rbegin(entities), std::rend(entities), pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
+    ASSERT_TRUE(std::equal(std::rbegin(values), std::rend(values), pool.begin(), pool.end()));
+
+    pool.sort_n(2u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_EQ(pool.raw()[0u][0u], values[1u]);
+    ASSERT_EQ(pool.raw()[0u][1u], values[0u]);
+    ASSERT_EQ(pool.raw()[0u][2u], values[2u]);
+
+    ASSERT_EQ(pool.data()[0u], entities[1u]);
+    ASSERT_EQ(pool.data()[1u], entities[0u]);
+    ASSERT_EQ(pool.data()[2u], entities[2u]);
+
+    pool.sort_n(5u, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    auto begin = pool.begin();
+    auto end = pool.end();
+
+    ASSERT_EQ(*(begin++), values[2u]);
+    ASSERT_EQ(*(begin++), values[0u]);
+    ASSERT_EQ(*(begin++), values[1u]);
     ASSERT_EQ(*(begin++), values[3u]);
     ASSERT_EQ(*(begin++), values[4u]);
     ASSERT_EQ(begin, end);
@@ -1643,6 +2263,26 @@ TEST(Storage, CustomAllocator) {
     test(entt::basic_storage<entt::entity, stable_type, test::throwing_allocator<stable_type>>{allocator}, allocator);
 }
 
+TEST(Storage, HugePageAllocator) {
+    using traits_type = entt::component_traits<int>;
+    entt::basic_storage<entt::entity, int, entt::huge_page_allocator<int>> pool;
+    std::vector<entt::entity> entities(traits_type::page_size * 2u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        entities[pos] = entt::entity{static_cast<entt::id_type>(pos)};
+    }
+
+    pool.insert(entities.begin(), entities.end(), 42);
+
+    ASSERT_EQ(pool.size(), entities.size());
+    ASSERT_EQ(pool.get(entities.back()), 42);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
 TEST(Storage, ThrowingAllocator) {
     auto test = [](auto pool) {
         using pool_allocator_type = typename decltype(pool)::allocator_type;
@@ -1757,8 +2397,188 @@ TEST(Storage, ThrowingComponent) {
     ASSERT_EQ(pool.get(entt::entity{42}), 42);
 }
 
+TEST(Storage, SoALayout) {
+    static_assert(entt::soa_layout_v<soa_type>);
+    static_assert(!entt::soa_layout_v<boxed_int>);
+    static_assert(!entt::soa_layout_v<std::unordered_set<char>>);
+
+    entt::storage<soa_type> pool;
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    pool.emplace(entity[0u], 1.f, 2.f, 3);
+    pool.emplace(entity[1u], 4.f, 5.f, 6);
+    pool.emplace(entity[2u]);
+
+    static_assert(std::is_same_v<decltype(pool.get(entity[0u])), typename entt::storage<soa_type>::reference>);
+    static_assert(std::is_same_v<decltype(std::as_const(pool).get(entity[0u]).get<&soa_type::x>()), const float &>);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.capacity(), ENTT_PACKED_PAGE);
+    ASSERT_EQ(pool.get(entity[0u]).get<&soa_type::x>(), 1.f);
+    ASSERT_EQ(pool.get(entity[0u]).get<&soa_type::y>(), 2.f);
+    ASSERT_EQ(std::as_const(pool).get(entity[1u]).get<&soa_type::value>(), 6);
+    ASSERT_EQ(static_cast<soa_type>(pool.get(entity[2u])).value, 0);
+
+    ASSERT_EQ(pool.raw<&soa_type::x>()[0u][1u], 4.f);
+    ASSERT_EQ(std::as_const(pool).raw<&soa_type::value>()[0u][0u], 3);
+    ASSERT_EQ(static_cast<const void *>(pool.raw<&soa_type::x>()[0u]), static_cast<const void *>(&pool.get(entity[0u]).get<&soa_type::x>()));
+    ASSERT_EQ(static_cast<const entt::sparse_set &>(pool).get(entity[0u]), nullptr);
+
+    pool.get(entity[2u]) = soa_type{7.f, 8.f, 9};
+    pool.patch(entity[1u], [](auto &elem) { elem.y = 0.f; });
+
+    ASSERT_EQ(pool.get(entity[2u]).get<&soa_type::y>(), 8.f);
+    ASSERT_EQ(pool.get(entity[1u]).get<&soa_type::x>(), 4.f);
+    ASSERT_EQ(pool.get(entity[1u]).get<&soa_type::y>(), 0.f);
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(pool.raw<&soa_type::value>()[0u][0u], 9);
+    ASSERT_EQ(pool.get(entity[2u]).get<&soa_type::value>(), 9);
+
+    pool.swap_elements(entity[1u], entity[2u]);
+
+    ASSERT_EQ(pool.index(entity[1u]), 0u);
+    ASSERT_EQ(pool.get(entity[1u]).get<&soa_type::x>(), 4.f);
+    ASSERT_EQ(pool.get(entity[2u]).get<&soa_type::x>(), 7.f);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(Storage, SoALayoutIterator) {
+    using iterator = typename entt::storage<soa_type>::iterator;
+
+    static_assert(std::is_same_v<iterator::value_type, soa_type>);
+    static_assert(std::is_same_v<iterator::reference, typename entt::storage<soa_type>::reference>);
+
+    entt::storage<soa_type> pool;
+    const soa_type values[2u]{{1.f, 2.f, 3}, {4.f, 5.f, 6}};
+    const entt::entity entity[2u]{entt::entity{3}, entt::entity{42}};
+
+    pool.insert(std::begin(entity), std::end(entity), std::begin(values));
+
+    iterator it = pool.begin();
+    typename entt::storage<soa_type>::const_iterator cit = it;
+
+    ASSERT_EQ(it, cit);
+    ASSERT_EQ(pool.end() - it, 2);
+    ASSERT_EQ(it->get<&soa_type::value>(), 6);
+    ASSERT_EQ((*cit).get<&soa_type::value>(), 6);
+    ASSERT_EQ(it[1u].get<&soa_type::value>(), 3);
+    ASSERT_EQ((++cit)->get<&soa_type::value>(), 3);
+    ASSERT_EQ(pool.rbegin()->get<&soa_type::value>(), 3);
+
+    for(auto [entt, elem]: pool.each()) {
+        static_assert(std::is_same_v<decltype(elem), typename entt::storage<soa_type>::reference>);
+        elem.get<&soa_type::x>() = static_cast<float>(entt::to_integral(entt));
+    }
+
+    for(auto [entt, elem]: std::as_const(pool).each()) {
+        static_assert(std::is_same_v<decltype(elem), typename entt::storage<soa_type>::const_reference>);
+        ASSERT_EQ(elem.get<&soa_type::x>(), static_cast<float>(entt::to_integral(entt)));
+    }
+}
+
+TEST(Storage, SoALayoutInPlaceDelete) {
+    entt::storage<stable_soa_type> pool;
+
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{3}, 3);
+    pool.erase(entt::entity{1});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.at(0u), static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(pool.get(entt::entity{3}).get<&stable_soa_type::value>(), 3);
+
+    pool.emplace(entt::entity{42}, 42);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.index(entt::entity{42}), 0u);
+
+    pool.compact();
+
+    ASSERT_EQ(pool.get(entt::entity{3}).get<&stable_soa_type::value>(), 3);
+    ASSERT_EQ(pool.get(entt::entity{42}).get<&stable_soa_type::value>(), 42);
+}
+
 #if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
 
+TEST(Storage, Shared) {
+    static_assert(entt::shared_v<shared_type>);
+    static_assert(!entt::shared_v<boxed_int>);
+
+    entt::storage<shared_type> pool;
+    entt::sparse_set &base = pool;
+    const entt::entity entity[4u]{entt::entity{1}, entt::entity{3}, entt::entity{42}, entt::entity{99}};
+
+    static_assert(std::is_same_v<decltype(pool.get(entity[0u])), const shared_type &>);
+    static_assert(std::is_same_v<decltype(*pool.begin()), const shared_type &>);
+
+    pool.emplace(entity[0u], 1, 2);
+    pool.emplace(entity[1u], 1, 3);
+    pool.emplace(entity[2u], 1, 2);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.distinct(), 2u);
+    ASSERT_EQ(&pool.get(entity[0u]), &pool.get(entity[2u]));
+    ASSERT_NE(&pool.get(entity[0u]), &pool.get(entity[1u]));
+    ASSERT_EQ(pool.get(entity[1u]).material, 3);
+    ASSERT_EQ(base.get(entity[2u]), &pool.get(entity[0u]));
+
+    const auto *instance = &pool.get(entity[1u]);
+    pool.patch(entity[0u], [](auto &elem) { elem.material = 3; });
+
+    ASSERT_EQ(pool.distinct(), 2u);
+    ASSERT_EQ(&pool.get(entity[0u]), instance);
+    ASSERT_EQ(pool.get(entity[2u]).material, 2);
+
+    pool.patch(entity[2u], [](auto &elem) { elem.mesh = 4; });
+
+    ASSERT_EQ(pool.distinct(), 2u);
+    ASSERT_EQ(pool.get(entity[2u]).mesh, 4);
+
+    pool.insert(std::begin(entity) + 3u, std::end(entity), shared_type{4, 2});
+
+    ASSERT_EQ(pool.distinct(), 2u);
+    ASSERT_EQ(&pool.get(entity[3u]), &pool.get(entity[2u]));
+
+    pool.erase(entity[0u]);
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.distinct(), 1u);
+    ASSERT_EQ(pool.get(entity[3u]).mesh, 4);
+
+    pool.swap_elements(entity[2u], entity[3u]);
+
+    ASSERT_EQ(pool.index(entity[3u]), 1u);
+    ASSERT_EQ(pool.get(entity[3u]).material, 2);
+
+    base.emplace(entity[0u]);
+
+    ASSERT_EQ(pool.distinct(), 2u);
+    ASSERT_EQ(pool.get(entity[0u]).mesh, 0);
+
+    for(auto [entt, elem]: pool.each()) {
+        ASSERT_EQ(&elem, &pool.get(entt));
+    }
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.distinct(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
 TEST(Storage, NoUsesAllocatorConstruction) {
     test::tracked_memory_resource memory_resource{};
     entt::basic_storage<entt::entity, int, std::pmr::polymorphic_allocator<int>> pool{&memory_resource};
@@ -1792,3 +2612,404 @@ TEST(Storage, UsesAllocatorConstruction) {
 }
 
 #endif
+
+TEST(Storage, MemoryUsage) {
+    entt::storage<int> pool;
+    entt::storage<soa_type> soa;
+    entt::storage<empty_stable_type> empty;
+
+    pool.emplace(entt::entity{0});
+    soa.emplace(entt::entity{0});
+    empty.emplace(entt::entity{0});
+
+    const auto usage = pool.memory_usage();
+    const entt::sparse_set &base = pool;
+
+    ASSERT_EQ(usage.sparse, base.memory_usage().sparse);
+    ASSERT_EQ(usage.packed, base.memory_usage().packed);
+    ASSERT_EQ(usage.payload, sizeof(int *) * pool.capacity() / ENTT_PACKED_PAGE + ENTT_PACKED_PAGE * sizeof(int));
+    ASSERT_EQ(base.memory_usage().payload, usage.payload);
+
+    ASSERT_EQ(soa.memory_usage().payload, 3u * sizeof(void *) + ENTT_PACKED_PAGE * (2u * sizeof(float) + sizeof(int)));
+    ASSERT_EQ(empty.memory_usage().payload, 0u);
+    ASSERT_NE(empty.memory_usage().total(), 0u);
+
+    pool.erase(entt::entity{0});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().payload, usage.payload - ENTT_PACKED_PAGE * sizeof(int));
+}
+
+TEST(Storage, HashedIndex) {
+    entt::storage<hashed_type> pool;
+    entt::storage<int> paged;
+    const entt::entity entities[2u]{entt::entity{3}, entt::entity{1u << 19u}};
+
+    ASSERT_EQ(pool.index_policy(), entt::sparse_policy::hashed);
+    ASSERT_EQ(paged.index_policy(), entt::sparse_policy::paged);
+
+    pool.emplace(entities[0u], 1);
+    pool.emplace(entities[1u], 2);
+    paged.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(pool.get(entities[0u]).value, 1);
+    ASSERT_EQ(pool.get(entities[1u]).value, 2);
+    ASSERT_LT(pool.memory_usage().sparse, paged.memory_usage().sparse);
+
+    pool.erase(entities[0u]);
+
+    ASSERT_FALSE(pool.contains(entities[0u]));
+    ASSERT_EQ(pool.get(entities[1u]).value, 2);
+}
+
+TEST(Storage, CompactIndex) {
+    entt::storage<compact_type> pool;
+    entt::storage<int> paged;
+    const entt::entity entities[2u]{entt::entity{3}, entt::entity{ENTT_SPARSE_PAGE}};
+
+    ASSERT_EQ(pool.index_policy(), entt::sparse_policy::compact);
+
+    pool.emplace(entities[0u], 1);
+    pool.emplace(entities[1u], 2);
+    paged.insert(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(pool.get(entities[0u]).value, 1);
+    ASSERT_EQ(pool.get(entities[1u]).value, 2);
+    ASSERT_LT(pool.memory_usage().sparse, paged.memory_usage().sparse);
+
+    pool.erase(entities[0u]);
+
+    ASSERT_FALSE(pool.contains(entities[0u]));
+    ASSERT_EQ(pool.get(entities[1u]).value, 2);
+}
+
+TEST(Storage, PageAlignment) {
+    using storage_type = entt::storage_traits<entt::entity, simd_type>::storage_type;
+    static_assert(std::is_same_v<storage_type::allocator_type, entt::aligned_allocator<simd_type, 64u>>);
+    static_assert(std::is_same_v<entt::storage_traits<entt::entity, int>::storage_type::allocator_type, std::allocator<int>>);
+
+    entt::basic_storage<entt::entity, simd_type, storage_type::allocator_type> pool;
+
+    std::vector<entt::entity> entities(2u * ENTT_PACKED_PAGE + 1u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        entities[pos] = static_cast<entt::entity>(pos);
+    }
+
+    pool.insert(entities.begin(), entities.end(), simd_type{{1.f, 2.f, 3.f, 4.f}});
+
+    for(std::size_t pos{}; pos < pool.size(); pos += ENTT_PACKED_PAGE) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&pool.get(pool.data()[pos])) % 64u, 0u);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pool.raw()[pos / ENTT_PACKED_PAGE]) % 64u, 0u);
+    }
+}
+
+TEST(Storage, CopyOnWrite) {
+    entt::storage<cow_type> pool;
+    entt::entity entities[10u];
+
+    for(auto pos = 0; pos < 10; ++pos) {
+        entities[pos] = entt::entity(pos);
+        pool.emplace(entities[pos], pos);
+    }
+
+    const auto *pages = std::as_const(pool).raw();
+    const auto first = pages[0u];
+    const auto second = pages[1u];
+
+    auto frame = pool.freeze();
+
+    ASSERT_TRUE(frame);
+    ASSERT_EQ(frame.size(), 10u);
+    ASSERT_EQ(std::as_const(pool).raw()[0u], first);
+
+    pool.get(entities[0u]).value = 42;
+
+    ASSERT_NE(std::as_const(pool).raw()[0u], first);
+    ASSERT_EQ(std::as_const(pool).raw()[1u], second);
+
+    pool.patch(entities[1u], [](auto &elem) { elem.value = 0; });
+    pool.erase(entities[5u]);
+    pool.emplace(entt::entity{42}, 3);
+
+    ASSERT_NE(std::as_const(pool).raw()[1u], second);
+    ASSERT_EQ(pool.get(entities[0u]).value, 42);
+    ASSERT_EQ(pool.get(entities[9u]).value, 9);
+    ASSERT_FALSE(pool.contains(entities[5u]));
+
+    for(auto [entt, elem]: frame.each()) {
+        ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entt)));
+    }
+
+    ASSERT_EQ(frame.data()[5u], entities[5u]);
+    ASSERT_EQ(std::distance(frame.begin(), frame.end()), 10);
+
+    frame.release();
+
+    ASSERT_FALSE(frame);
+    ASSERT_TRUE(frame.empty());
+
+    const auto third = std::as_const(pool).raw()[2u];
+    pool.get(entities[8u]).value = 0;
+
+    ASSERT_EQ(std::as_const(pool).raw()[2u], third);
+}
+
+TEST(Storage, CopyOnWriteLifetime) {
+    ASSERT_EQ(cow_type::instances, 0);
+
+    {
+        entt::frozen_storage<cow_type> frame{};
+
+        {
+            entt::storage<cow_type> pool;
+
+            for(auto pos = 0; pos < 6; ++pos) {
+                pool.emplace(entt::entity(pos), pos);
+            }
+
+            auto previous = pool.freeze();
+            pool.get(entt::entity{0}).value = 42;
+            frame = pool.freeze();
+
+            ASSERT_EQ(cow_type::instances, 12);
+
+            previous.release();
+
+            ASSERT_EQ(cow_type::instances, 6);
+
+            pool.clear();
+            pool.emplace(entt::entity{3}, 3);
+        }
+
+        ASSERT_EQ(cow_type::instances, 6);
+        ASSERT_EQ(frame.size(), 6u);
+
+        for(auto [entt, elem]: frame.each()) {
+            ASSERT_EQ(elem.value, entt::to_integral(entt) ? static_cast<int>(entt::to_integral(entt)) : 42);
+        }
+    }
+
+    ASSERT_EQ(cow_type::instances, 0);
+}
+
+TEST(Storage, CopyOnWriteInPlaceDelete) {
+    entt::storage<stable_cow_type> pool;
+
+    for(auto pos = 0; pos < 8; ++pos) {
+        pool.emplace(entt::entity(pos), pos);
+    }
+
+    pool.erase(entt::entity{1});
+
+    auto frame = pool.freeze();
+    pool.erase(entt::entity{6});
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 6u);
+    ASSERT_EQ(frame.size(), 8u);
+    ASSERT_EQ(frame.data()[1u], static_cast<entt::entity>(entt::tombstone));
+
+    for(auto [entt, elem]: frame.each()) {
+        if(entt != entt::tombstone) {
+            ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entt)));
+        }
+    }
+
+    for(auto [entt, elem]: pool.each()) {
+        ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entt)));
+    }
+}
+
+TEST(Storage, CopyOnWriteConcurrentReader) {
+    entt::storage<stable_cow_type> pool;
+
+    for(auto pos = 0; pos < 64; ++pos) {
+        pool.emplace(entt::entity(pos), 1);
+    }
+
+    auto frame = pool.freeze();
+
+    std::thread reader{[&frame]() {
+        for(auto iteration = 0; iteration < 100; ++iteration) {
+            int sum{};
+
+            for(auto &&elem: frame) {
+                sum += elem.value;
+            }
+
+            ASSERT_EQ(sum, 64);
+        }
+    }};
+
+    for(auto pos = 0; pos < 64; ++pos) {
+        pool.patch(entt::entity(pos), [](auto &elem) { ++elem.value; });
+    }
+
+    reader.join();
+
+    for(auto &&elem: std::as_const(pool)) {
+        ASSERT_EQ(elem.value, 2);
+    }
+}
+
+TEST(StorageEntity, Functionalities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+    entt::storage<entt::entity> pool;
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.in_use(), 0u);
+
+    const auto e0 = pool.emplace();
+    const auto e1 = pool.emplace();
+
+    ASSERT_EQ(e0, entt::entity{0});
+    ASSERT_EQ(e1, entt::entity{1});
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.in_use(), 2u);
+    ASSERT_TRUE(pool.alive(e0));
+    ASSERT_TRUE(pool.alive(e1));
+
+    pool.erase(e0);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.in_use(), 1u);
+    ASSERT_FALSE(pool.alive(e0));
+    ASSERT_TRUE(pool.alive(e1));
+    ASSERT_EQ(pool.current(e0), 1u);
+    ASSERT_EQ(pool.data()[0u], e1);
+
+    const auto other = pool.emplace();
+
+    ASSERT_EQ(traits_type::to_entity(other), traits_type::to_entity(e0));
+    ASSERT_EQ(traits_type::to_version(other), 1u);
+    ASSERT_TRUE(pool.alive(other));
+    ASSERT_FALSE(pool.alive(e0));
+
+    pool.clear();
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.in_use(), 0u);
+}
+
+TEST(StorageEntity, Each) {
+    entt::storage<entt::entity> pool;
+    entt::entity entities[4u]{};
+
+    pool.insert(std::begin(entities), std::end(entities));
+    pool.erase(entities[1u]);
+    pool.erase(entities[3u]);
+
+    std::size_t count{};
+
+    for(auto [entt]: pool.each()) {
+        ASSERT_TRUE(entt == entities[0u] || entt == entities[2u]);
+        ++count;
+    }
+
+    ASSERT_EQ(count, 2u);
+
+    for(auto [entt]: std::as_const(pool).each()) {
+        ASSERT_TRUE(pool.alive(entt));
+    }
+}
+
+TEST(StorageEntity, EmplaceWithHint) {
+    entt::storage<entt::entity> pool;
+
+    ASSERT_EQ(pool.emplace(entt::entity{3}), entt::entity{3});
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(pool.in_use(), 1u);
+    ASSERT_EQ(pool.emplace(entt::entity{3}), entt::entity{2});
+    ASSERT_EQ(pool.emplace(entt::null), entt::entity{1});
+
+    const auto hint = entt::entt_traits<entt::entity>::construct(0u, 7u);
+
+    ASSERT_EQ(pool.emplace(hint), hint);
+    ASSERT_EQ(pool.in_use(), 4u);
+    ASSERT_EQ(pool.emplace(), entt::entity{4});
+}
+
+TEST(StorageEntity, RecyclingPolicy) {
+    using traits_type = entt::entt_traits<entt::entity>;
+    entt::storage<entt::entity> pool;
+    entt::entity entities[200u]{};
+
+    ASSERT_EQ(pool.recycling(), entt::recycle_policy::last_released);
+
+    pool.insert(std::begin(entities), std::end(entities));
+    pool.erase(entities[150u]);
+    pool.erase(entities[3u]);
+
+    ASSERT_EQ(traits_type::to_entity(pool.emplace()), 3u);
+
+    pool.erase(pool.data()[pool.in_use() - 1u]);
+    pool.recycling(entt::recycle_policy::lowest_id);
+    pool.erase(entities[130u]);
+    pool.erase(entities[70u]);
+
+    ASSERT_EQ(pool.recycling(), entt::recycle_policy::lowest_id);
+    ASSERT_EQ(pool.in_use(), 196u);
+
+    ASSERT_EQ(pool.emplace(), traits_type::construct(3u, 2u));
+    ASSERT_EQ(pool.emplace(), traits_type::construct(70u, 1u));
+    ASSERT_EQ(pool.emplace(), traits_type::construct(130u, 1u));
+    ASSERT_EQ(pool.emplace(), traits_type::construct(150u, 1u));
+    ASSERT_EQ(pool.emplace(), entt::entity{200});
+
+    pool.erase(entt::entity{200});
+    pool.erase(entities[0u]);
+
+    const auto hint = traits_type::construct(200u, 1u);
+
+    ASSERT_EQ(pool.emplace(hint), hint);
+    ASSERT_EQ(pool.emplace(), traits_type::construct(0u, 1u));
+    ASSERT_EQ(pool.emplace(entt::entity{203}), entt::entity{203});
+    ASSERT_EQ(pool.emplace(), entt::entity{201});
+    ASSERT_EQ(pool.emplace(), entt::entity{202});
+    ASSERT_EQ(pool.emplace(), entt::entity{204});
+
+    entt::storage<entt::entity> other{std::move(pool)};
+    other.erase(entt::entity{202});
+    other.erase(entt::entity{201});
+
+    ASSERT_EQ(other.recycling(), entt::recycle_policy::lowest_id);
+    ASSERT_EQ(other.emplace(), traits_type::construct(201u, 1u));
+
+    other.clear();
+    other.push(std::begin(entities), std::begin(entities) + 3u);
+    other.in_use(1u);
+
+    ASSERT_EQ(other.emplace(), entities[1u]);
+    ASSERT_EQ(other.emplace(), entities[2u]);
+
+    other.recycling(entt::recycle_policy::last_released);
+    other.erase(entities[0u]);
+    other.erase(entities[2u]);
+
+    ASSERT_EQ(other.emplace(), traits_type::construct(2u, 1u));
+}
+
+TEST(StorageEntity, PushAndInUse) {
+    entt::storage<entt::entity> pool;
+    const entt::entity entities[3u]{entt::entity{1}, entt::entity{0}, entt::entity{2}};
+
+    pool.push(std::begin(entities), std::end(entities));
+    pool.in_use(2u);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_TRUE(pool.alive(entities[0u]));
+    ASSERT_TRUE(pool.alive(entities[1u]));
+    ASSERT_FALSE(pool.alive(entities[2u]));
+    ASSERT_EQ(pool.emplace(), entities[2u]);
+
+    entt::storage<entt::entity> other{std::move(pool)};
+
+    ASSERT_EQ(other.in_use(), 3u);
+    ASSERT_EQ(pool.in_use(), 0u);
+
+    pool = std::move(other);
+
+    ASSERT_EQ(pool.in_use(), 3u);
+    ASSERT_EQ(other.in_use(), 0u);
+}
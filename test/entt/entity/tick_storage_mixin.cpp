@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/tick_storage_mixin.hpp>
+
+struct tracked {
+    static constexpr auto change_ticks = true;
+    int value{};
+};
+
+struct silent {
+    static constexpr auto change_ticks = true;
+    static constexpr auto signals = false;
+    int value{};
+};
+
+TEST(TickStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &clock = registry.ctx().emplace<entt::change_clock>();
+    auto &storage = registry.storage<tracked>();
+
+    static_assert(std::is_base_of_v<entt::tick_storage_mixin<entt::basic_storage<entt::entity, tracked>>, std::remove_reference_t<decltype(storage)>>);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<tracked>(entity);
+
+    ASSERT_EQ(storage.last_changed(entity), 1u);
+    ASSERT_TRUE(storage.changed_since(entity, 0u));
+    ASSERT_FALSE(storage.changed_since(entity, 1u));
+    ASSERT_FALSE(storage.changed_since(other, 0u));
+
+    clock.tick = 3u;
+    registry.emplace<tracked>(other);
+    registry.patch<tracked>(entity, [](auto &elem) { elem.value = 42; });
+
+    ASSERT_EQ(storage.last_changed(entity), 3u);
+    ASSERT_EQ(storage.last_changed(other), 3u);
+
+    clock.tick = 5u;
+    registry.replace<tracked>(entity, 0);
+
+    ASSERT_TRUE(storage.changed_since(entity, 3u));
+    ASSERT_FALSE(storage.changed_since(other, 3u));
+
+    clock.tick = 7u;
+    registry.emplace_or_replace<tracked>(other, 1);
+    registry.get<tracked>(entity).value = 3;
+
+    ASSERT_FALSE(storage.changed_since(entity, 5u));
+    ASSERT_TRUE(storage.changed_since(other, 5u));
+
+    storage.touch(entity);
+
+    ASSERT_TRUE(storage.changed_since(entity, 5u));
+
+    registry.erase<tracked>(entity);
+
+    ASSERT_FALSE(storage.changed_since(entity, 0u));
+}
+
+TEST(TickStorageMixin, Insert) {
+    entt::registry registry;
+    std::array<entt::entity, 3u> entities{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.ctx().emplace<entt::change_clock>().tick = 2u;
+    registry.insert<tracked>(entities.begin(), entities.end());
+
+    auto &storage = registry.storage<tracked>();
+
+    for(auto entity: entities) {
+        ASSERT_EQ(storage.last_changed(entity), 2u);
+    }
+
+    registry.ctx().at<entt::change_clock>().tick = 4u;
+    const tracked instance{};
+    static_cast<entt::sparse_set &>(storage).remove(entities[1u]);
+    static_cast<entt::sparse_set &>(storage).emplace(entities[1u], &instance);
+
+    ASSERT_EQ(storage.last_changed(entities[0u]), 2u);
+    ASSERT_EQ(storage.last_changed(entities[1u]), 4u);
+}
+
+TEST(TickStorageMixin, ResortSince) {
+    entt::registry registry;
+    auto &clock = registry.ctx().emplace<entt::change_clock>();
+    auto &storage = registry.storage<tracked>();
+
+    for(int next{}; next < 8; ++next) {
+        registry.emplace<tracked>(registry.create(), 7 - next);
+    }
+
+    auto compare = [&storage](const entt::entity lhs, const entt::entity rhs) { return storage.get(lhs).value < storage.get(rhs).value; };
+    auto sorted = [&storage]() { return std::is_sorted(storage.begin(), storage.end(), [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; }); };
+
+    storage.sort(compare);
+
+    ASSERT_TRUE(sorted());
+
+    const auto last = clock.tick++;
+    registry.patch<tracked>(storage.data()[2u], [](auto &elem) { elem.value = 42; });
+    registry.replace<tracked>(storage.data()[5u], -1);
+    registry.emplace<tracked>(registry.create(), 3);
+
+    ASSERT_FALSE(sorted());
+
+    storage.resort_since(last, compare);
+
+    ASSERT_TRUE(sorted());
+    ASSERT_EQ(storage.begin()->value, -1);
+    ASSERT_EQ((storage.end() - 1)->value, 42);
+}
+
+TEST(TickStorageMixin, SignalFree) {
+    entt::registry registry;
+    auto &storage = registry.storage<silent>();
+
+    static_assert(std::is_same_v<std::remove_reference_t<decltype(storage)>, entt::tick_storage_mixin<entt::basic_storage<entt::entity, silent>>>);
+
+    const auto entity = registry.create();
+    registry.emplace<silent>(entity);
+
+    ASSERT_TRUE(registry.ctx().contains<entt::change_clock>());
+    ASSERT_EQ(storage.last_changed(entity), 1u);
+
+    registry.ctx().at<entt::change_clock>().tick = 2u;
+    registry.patch<silent>(entity);
+
+    ASSERT_TRUE(storage.changed_since(entity, 1u));
+}
+
+TEST(TickStorageMixin, View) {
+    entt::registry registry;
+    auto &clock = registry.ctx().emplace<entt::change_clock>();
+
+    for(auto pos = 0; pos < 8; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<tracked>(entity, pos);
+    }
+
+    const auto last = clock.tick++;
+    auto view = registry.view<int, tracked>();
+
+    view.each([&registry](const auto entity, const int value, const tracked &) {
+        if(value % 2) {
+            registry.patch<tracked>(entity);
+        }
+    });
+
+    auto &&storage = view.storage<tracked>();
+    std::size_t count{};
+
+    view.each([&](const auto entity, const int value, const tracked &) {
+        if(storage.changed_since(entity, last)) {
+            ASSERT_TRUE(value % 2);
+            ++count;
+        }
+    });
+
+    ASSERT_EQ(count, 4u);
+}
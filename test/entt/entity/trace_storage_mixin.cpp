@@ -0,0 +1,131 @@
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/trace_storage_mixin.hpp>
+
+struct recorded {
+    static constexpr auto trace_operations = true;
+    int value{};
+};
+
+struct stable_recorded {
+    static constexpr auto trace_operations = true;
+    static constexpr auto in_place_delete = true;
+    int value{};
+};
+
+struct replayed {
+    int value{};
+};
+
+struct stable {
+    static constexpr auto in_place_delete = true;
+    int value{};
+};
+
+TEST(TraceStorageMixin, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<recorded>();
+    auto &trace = registry.ctx().at<entt::operation_trace>();
+
+    static_assert(std::is_base_of_v<entt::trace_storage_mixin<entt::basic_storage<entt::entity, recorded>>, std::remove_reference_t<decltype(storage)>>);
+    static_assert(!std::is_base_of_v<entt::trace_storage_mixin<entt::basic_storage<entt::entity, replayed>>, std::remove_reference_t<decltype(registry.storage<replayed>())>>);
+
+    ASSERT_TRUE(trace.empty());
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<recorded>(entity);
+    registry.emplace<replayed>(entity);
+    registry.emplace<recorded>(other);
+    registry.remove<recorded>(entity);
+    registry.clear<recorded>();
+
+    ASSERT_EQ(trace.size(), 4u);
+    ASSERT_EQ(trace.size_bytes() % trace.size(), 0u);
+
+    std::vector<entt::trace_operation> ops{};
+    std::vector<entt::entity> entities{};
+
+    trace.each([&](const entt::trace_operation op, const entt::id_type id, const entt::entity entt) {
+        ASSERT_EQ(id, entt::type_hash<recorded>::value());
+        ops.push_back(op);
+        entities.push_back(entt);
+    });
+
+    ASSERT_EQ(ops, (std::vector<entt::trace_operation>{entt::trace_operation::emplace, entt::trace_operation::emplace, entt::trace_operation::erase, entt::trace_operation::clear}));
+    ASSERT_EQ(entities, (std::vector<entt::entity>{entity, other, entity, entt::null}));
+
+    trace.clear();
+
+    ASSERT_TRUE(trace.empty());
+    ASSERT_EQ(trace.size(), 0u);
+}
+
+TEST(TraceStorageMixin, InPlaceDelete) {
+    entt::registry registry;
+    auto &storage = registry.storage<stable_recorded>();
+    auto &trace = registry.ctx().at<entt::operation_trace>();
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<stable_recorded>(entity);
+    registry.emplace<stable_recorded>(other);
+    registry.destroy(entity);
+
+    ASSERT_EQ(storage.size(), 2u);
+    ASSERT_EQ(trace.size(), 3u);
+
+    // tombstones aren't recorded, entities are erased one at a time
+    registry.clear<stable_recorded>();
+
+    ASSERT_EQ(trace.size(), 4u);
+}
+
+TEST(TraceStorageMixin, Replay) {
+    entt::registry registry;
+    registry.storage<recorded>();
+    std::vector<entt::entity> entities(8u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<recorded>(entities.begin(), entities.end());
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[3u]);
+    registry.emplace<recorded>(registry.create());
+
+    const auto &trace = registry.ctx().at<entt::operation_trace>();
+    const entt::operation_trace copy{trace.data(), trace.size_bytes()};
+
+    ASSERT_EQ(copy.size(), trace.size());
+
+    entt::registry target;
+    auto &storage = target.storage<stable>(entt::type_hash<recorded>::value());
+    copy.replay(target);
+
+    std::size_t count{};
+
+    for(auto entt: static_cast<const entt::sparse_set &>(storage)) {
+        count += (entt != entt::tombstone);
+    }
+
+    ASSERT_EQ(storage.size(), entities.size());
+    ASSERT_EQ(count, registry.storage<recorded>().size());
+    // entities without components are never destroyed during a replay
+    ASSERT_EQ(target.alive(), entities.size());
+
+    entt::registry other;
+    copy.replay(other);
+
+    ASSERT_EQ(other.alive(), 0u);
+
+    copy.replay(other, [&other](const entt::id_type id) -> entt::sparse_set * {
+        return (id == entt::type_hash<recorded>::value()) ? &other.storage<replayed>() : nullptr;
+    });
+
+    ASSERT_EQ(other.storage<replayed>().size(), registry.storage<recorded>().size());
+}
@@ -1,8 +1,12 @@
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <iterator>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
@@ -14,6 +18,48 @@ struct stable_type {
     int value;
 };
 
+struct soa_type {
+    int x;
+    int y;
+};
+
+template<>
+struct entt::component_traits<soa_type> {
+    static constexpr auto in_place_delete = false;
+    static constexpr auto page_size = ENTT_PACKED_PAGE;
+    using soa_members = entt::value_list<&soa_type::x, &soa_type::y>;
+};
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) {
+        std::vector<std::thread> workers{};
+        chunks += count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back([&task, pos]() { task(pos); });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t chunks{};
+};
+
+struct page_aware_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task, const std::size_t page) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            pages.push_back(page + pos);
+            task(pos);
+        }
+    }
+
+    std::vector<std::size_t> pages{};
+};
+
 TEST(SingleComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<char>();
@@ -209,6 +255,63 @@ TEST(SingleComponentView, Each) {
     }
 }
 
+TEST(SingleComponentView, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entity(ENTT_PACKED_PAGE * 2u + 3u);
+    std::atomic<std::size_t> count{};
+    thread_executor executor{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<empty_type>(entity.begin(), entity.end());
+
+    registry.view<int>().par_each(executor, [](const auto entt, int &value) {
+        value = static_cast<int>(entt::to_integral(entt));
+    });
+
+    ASSERT_EQ(executor.chunks, 3u);
+
+    registry.view<int>().par_each(executor, [&count](int &value) {
+        ++value;
+        ++count;
+    });
+
+    ASSERT_EQ(executor.chunks, 6u);
+    ASSERT_EQ(count, entity.size());
+
+    for(auto entt: entity) {
+        ASSERT_EQ(registry.get<int>(entt), static_cast<int>(entt::to_integral(entt)) + 1);
+    }
+
+    count = 0u;
+    registry.view<empty_type>().par_each(executor, [&registry, &count](const auto entt) {
+        ASSERT_TRUE(registry.valid(entt));
+        ++count;
+    });
+
+    ASSERT_EQ(count, entity.size());
+
+    registry.clear<int>();
+    registry.view<int>().par_each(executor, [](int &) { FAIL(); });
+
+    ASSERT_EQ(executor.chunks, 9u);
+}
+
+TEST(SingleComponentView, PageAwareParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entity(ENTT_PACKED_PAGE + 1u);
+    page_aware_executor executor{};
+    std::size_t count{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+
+    registry.view<int>().par_each(executor, [&count](int &) { ++count; });
+
+    ASSERT_EQ(executor.pages, (std::vector<std::size_t>{0u, 1u}));
+    ASSERT_EQ(count, entity.size());
+}
+
 TEST(SingleComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int>();
@@ -374,6 +477,28 @@ TEST(SingleComponentView, FrontBack) {
     ASSERT_EQ(view.back(), e0);
 }
 
+TEST(SingleComponentView, Range) {
+    entt::registry registry;
+
+    for(int next{}; next < 4; ++next) {
+        registry.emplace<int>(registry.create(), next);
+        registry.emplace<empty_type>(registry.create());
+    }
+
+    const auto view = registry.view<int>();
+    const auto range = view.range(1u, 3u);
+    auto it = range.begin();
+
+    ASSERT_EQ(std::get<1>(*it), 2);
+    ASSERT_EQ(std::get<0>(*it), view.begin()[1u]);
+    ASSERT_EQ(std::get<1>(*++it), 1);
+    ASSERT_EQ(++it, range.end());
+
+    const auto empty = registry.view<empty_type>().range(0u, 4u);
+
+    ASSERT_EQ(std::distance(empty.begin(), empty.end()), 4);
+}
+
 TEST(SingleComponentView, DeductionGuide) {
     entt::registry registry;
     typename entt::storage_traits<entt::entity, int>::storage_type istorage;
@@ -438,6 +563,30 @@ TEST(SingleComponentView, StableType) {
     ASSERT_EQ(view.size_hint(), 1u);
 }
 
+TEST(SingleComponentView, SoALayout) {
+    entt::registry registry;
+    const auto view = registry.view<soa_type>();
+    const auto cview = std::as_const(registry).view<const soa_type>();
+
+    for(int pos{}; pos < 4; ++pos) {
+        registry.emplace<soa_type>(registry.create(), pos, pos);
+    }
+
+    view.each([](auto elem) { ++elem.template get<&soa_type::y>(); });
+    view.each([](const auto entity, auto elem) { elem.template get<&soa_type::x>() = static_cast<int>(entt::to_integral(entity)); });
+
+    for(auto [entity, elem]: cview.each()) {
+        static_assert(std::is_same_v<decltype(elem.get<&soa_type::x>()), const int &>);
+        ASSERT_EQ(elem.get<&soa_type::x>(), static_cast<int>(entt::to_integral(entity)));
+        ASSERT_EQ(elem.get<&soa_type::y>(), elem.get<&soa_type::x>() + 1);
+    }
+
+    registry.replace<soa_type>(view.front(), 42, 3);
+
+    ASSERT_EQ(view.get<soa_type>(view.front()).get<&soa_type::x>(), 42);
+    ASSERT_EQ(static_cast<soa_type>(cview.get<const soa_type>(view.front())).y, 3);
+}
+
 TEST(SingleComponentView, Storage) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -609,6 +758,60 @@ TEST(MultiComponentView, Iterator) {
     ASSERT_EQ(*begin, entity[0u]);
     ASSERT_EQ(*begin.operator->(), entity[0u]);
     ASSERT_EQ(++begin, view.end());
+
+    ASSERT_EQ(begin--, view.end());
+    ASSERT_EQ(*begin, entity[0u]);
+    ASSERT_EQ(--begin, view.begin());
+}
+
+TEST(MultiComponentView, ReverseIterator) {
+    entt::registry registry;
+    const entt::entity entity[3]{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<int>(std::begin(entity), std::end(entity));
+    registry.emplace<char>(entity[0u]);
+    registry.emplace<char>(entity[2u]);
+
+    const auto view = registry.view<int, char>();
+    auto it = view.rbegin();
+
+    ASSERT_EQ(*it, entity[0u]);
+    ASSERT_EQ(*++it, entity[2u]);
+    ASSERT_EQ(++it, view.rend());
+    ASSERT_EQ(*--it, entity[2u]);
+
+    ASSERT_TRUE(std::equal(view.rbegin(), view.rend(), std::make_reverse_iterator(view.end())));
+}
+
+TEST(MultiComponentView, Range) {
+    entt::registry registry;
+
+    for(int next{}; next < 10; ++next) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, next);
+
+        if(next % 3) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    const auto view = registry.view<int, const char>().use<int>();
+    const auto half = view.size_hint() / 2u;
+    std::vector<int> values{};
+
+    ASSERT_EQ(view.range(0u, 0u).begin(), view.range(0u, 0u).end());
+
+    for(auto [entity, value, ch]: view.range(0u, half)) {
+        ASSERT_TRUE(view.contains(entity));
+        values.push_back(value);
+    }
+
+    for(auto [entity, value, ch]: view.range(half, view.size_hint())) {
+        ASSERT_TRUE(view.contains(entity));
+        values.push_back(value);
+    }
+
+    ASSERT_EQ(values, (std::vector<int>{8, 7, 5, 4, 2, 1}));
 }
 
 TEST(MultiComponentView, ElementAccess) {
@@ -715,6 +918,62 @@ TEST(MultiComponentView, Each) {
     }
 }
 
+TEST(MultiComponentView, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entity(ENTT_PACKED_PAGE * 3u);
+    std::atomic<std::size_t> count{};
+    thread_executor executor{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin(), entity.begin() + ENTT_PACKED_PAGE + 1u);
+    registry.insert<stable_type>(entity.begin(), entity.end());
+    registry.erase<stable_type>(entity.back());
+
+    registry.view<int, const char>().par_each(executor, [&count](const auto entt, int &value, const char &) {
+        value = static_cast<int>(entt::to_integral(entt));
+        ++count;
+    });
+
+    // the smallest pool leads the iteration
+    ASSERT_EQ(executor.chunks, 2u);
+    ASSERT_EQ(count, ENTT_PACKED_PAGE + 1u);
+
+    for(auto pos = 0u; pos < entity.size(); ++pos) {
+        ASSERT_EQ(registry.get<int>(entity[pos]), pos <= ENTT_PACKED_PAGE ? static_cast<int>(entt::to_integral(entity[pos])) : 0);
+    }
+
+    count = 0u;
+    registry.view<int, stable_type>().use<stable_type>().par_each(executor, [&count](int &, stable_type &) { ++count; });
+
+    ASSERT_EQ(executor.chunks, 5u);
+    ASSERT_EQ(count, entity.size() - 1u);
+
+    count = 0u;
+    registry.view<int>(entt::exclude<char>).use<int>().par_each(executor, [&count](int &value) {
+        ASSERT_EQ(value, 0);
+        ++count;
+    });
+
+    ASSERT_EQ(count, entity.size() - ENTT_PACKED_PAGE - 1u);
+}
+
+TEST(MultiComponentView, PageAwareParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entity(ENTT_PACKED_PAGE + 1u);
+    page_aware_executor executor{};
+    std::size_t count{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin(), entity.end());
+
+    registry.view<int, char>().par_each(executor, [&count](int &, char &) { ++count; });
+
+    ASSERT_EQ(executor.pages, (std::vector<std::size_t>{0u, 1u}));
+    ASSERT_EQ(count, entity.size());
+}
+
 TEST(MultiComponentView, EachWithSuggestedType) {
     entt::registry registry;
 
@@ -789,6 +1048,118 @@ TEST(MultiComponentView, EachWithHoles) {
     }
 }
 
+TEST(MultiComponentView, EachArranged) {
+    entt::registry registry;
+    std::vector<entt::entity> entities{};
+
+    for(int pos{}; pos < 32; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 3) {
+            registry.emplace<char>(entity, static_cast<char>(pos));
+        }
+
+        if(pos % 4) {
+            registry.emplace<empty_type>(entity);
+        }
+
+        if(pos % 5 == 0) {
+            registry.emplace<double>(entity);
+        }
+    }
+
+    registry.emplace<char>(registry.create());
+
+    auto view = registry.view<int, const char, empty_type>(entt::exclude<double>);
+    view = view.use<int>();
+
+    registry.sort<int>([](const int lhs, const int rhs) { return lhs < rhs; });
+    registry.sort<char, int>();
+    registry.sort<empty_type, int>();
+
+    ASSERT_TRUE(registry.storage<char>().arranged_as(registry.storage<int>()));
+    ASSERT_TRUE(registry.storage<empty_type>().arranged_as(registry.storage<int>()));
+    ASSERT_FALSE(registry.storage<int>().arranged_as(registry.storage<char>()));
+
+    for(auto entity: view) {
+        entities.push_back(entity);
+    }
+
+    ASSERT_EQ(entities.size(), 13u);
+    ASSERT_EQ(&view.handle(), &registry.storage<int>());
+
+    auto it = entities.cbegin();
+
+    view.each([&it](const auto entity, const int &value, const char &other) {
+        ASSERT_EQ(entity, *it++);
+        ASSERT_EQ(value, static_cast<int>(other));
+        ASSERT_TRUE((value % 3) && (value % 4) && (value % 5));
+    });
+
+    ASSERT_EQ(it, entities.cend());
+
+    registry.emplace<char>(registry.create());
+
+    ASSERT_FALSE(registry.storage<char>().arranged_as(registry.storage<int>()));
+    ASSERT_TRUE(registry.storage<empty_type>().arranged_as(registry.storage<int>()));
+
+    registry.emplace<int>(registry.create());
+
+    ASSERT_FALSE(registry.storage<empty_type>().arranged_as(registry.storage<int>()));
+}
+
+TEST(MultiComponentView, Statistics) {
+    entt::registry registry;
+    auto view = registry.view<int, const char>();
+
+    for(int pos{}; pos < 5; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 2 == 0) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    std::size_t count{};
+    view = view.use<int>();
+    view.each([&count](auto &&...) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(&view.handle(), &registry.storage<int>());
+
+    view.adapt();
+
+    ASSERT_EQ(&view.handle(), &registry.storage<char>());
+
+    view.each([&count](auto &&...) { ++count; });
+    view.adapt();
+
+    ASSERT_EQ(count, 6u);
+    ASSERT_EQ(&view.handle(), &registry.storage<char>());
+
+    if constexpr(ENTT_VIEW_STATISTICS != 0) {
+        ASSERT_EQ(view.statistics<int>().runs, 1u);
+        ASSERT_EQ(view.statistics<int>().visited, 5u);
+        ASSERT_EQ(view.statistics<int>().probes, 5u);
+        ASSERT_EQ(view.statistics<int>().matched, 3u);
+        ASSERT_EQ(view.statistics<const char>().visited, 3u);
+        ASSERT_EQ(view.statistics<1u>().matched, 3u);
+        ASSERT_EQ(view.statistics<const char>().hit_rate(), 1.);
+        ASSERT_LT(view.statistics<const char>().cost(), view.statistics<int>().cost());
+    } else {
+        ASSERT_EQ(view.statistics<int>().runs, 0u);
+        ASSERT_EQ(view.statistics<const char>().runs, 0u);
+    }
+
+    view.reset_statistics();
+
+    ASSERT_EQ(view.statistics<int>().runs, 0u);
+    ASSERT_EQ(view.statistics<int>().hit_rate(), 0.);
+    ASSERT_EQ(view.statistics<const char>().cost(), 0.);
+}
+
 TEST(MultiComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int, empty_type, const char>();
@@ -1244,3 +1615,86 @@ TEST(MultiComponentView, Storage) {
     ASSERT_TRUE(view.storage<1u>().contains(entity));
     ASSERT_FALSE((registry.all_of<int, char>(entity)));
 }
+
+TEST(EntityView, Functionalities) {
+    entt::registry registry;
+    auto view = registry.view(entt::exclude_t<>{});
+
+    ASSERT_TRUE(view);
+    ASSERT_FALSE(decltype(view){});
+    ASSERT_EQ(view.size_hint(), 0u);
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_EQ(view.front(), static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(view.back(), static_cast<entt::entity>(entt::null));
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.destroy(e1);
+
+    ASSERT_EQ(view.size_hint(), 2u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_EQ(view.front(), e2);
+    ASSERT_EQ(view.back(), e0);
+
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+    ASSERT_TRUE(view.contains(e2));
+
+    ASSERT_EQ(*view.find(e0), e0);
+    ASSERT_EQ(view.find(e1), view.end());
+
+    std::size_t count{};
+    view.each([&count](const auto) { ++count; });
+
+    ASSERT_EQ(count, 2u);
+
+    for(auto [entt]: view.each()) {
+        ASSERT_TRUE(entt == e0 || entt == e2);
+    }
+
+    ASSERT_EQ(view.storage().in_use(), 2u);
+}
+
+TEST(EntityView, ExcludedComponent) {
+    entt::registry registry;
+    auto view = registry.view(entt::exclude<int, char>);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<int>(e0);
+    registry.emplace<char>(e2);
+
+    ASSERT_EQ(view.size_hint(), 3u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(view.front(), e1);
+    ASSERT_EQ(view.back(), e1);
+
+    ASSERT_FALSE(view.contains(e0));
+    ASSERT_TRUE(view.contains(e1));
+    ASSERT_FALSE(view.contains(e2));
+
+    registry.remove<int>(e0);
+
+    ASSERT_EQ(view.front(), e1);
+    ASSERT_EQ(view.back(), e0);
+}
+
+TEST(EntityView, DestroyDuringIteration) {
+    entt::registry registry;
+    auto view = registry.view(entt::exclude<int>);
+
+    for(auto pos = 0; pos < 8; ++pos) {
+        registry.emplace<char>(registry.create());
+    }
+
+    view.each([&registry](const auto entt) {
+        registry.destroy(entt);
+    });
+
+    ASSERT_EQ(registry.alive(), 0u);
+    ASSERT_EQ(view.begin(), view.end());
+}
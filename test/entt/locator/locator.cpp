@@ -1,4 +1,5 @@
 #include <memory>
+#include <thread>
 #include <gtest/gtest.h>
 #include <entt/locator/locator.hpp>
 
@@ -59,6 +60,38 @@ TEST(ServiceLocator, Functionalities) {
     ASSERT_TRUE(derived_service::invoked);
 }
 
+TEST(ServiceLocator, Local) {
+    entt::locator<base_service>::emplace<null_service>();
+
+    ASSERT_FALSE(entt::locator<base_service>::has_local());
+    ASSERT_EQ(&entt::locator<base_service>::local(), &entt::locator<base_service>::value());
+
+    std::thread thread{[]() {
+        ASSERT_FALSE(entt::locator<base_service>::has_local());
+
+        entt::locator<base_service>::emplace_local<derived_service>();
+
+        ASSERT_TRUE(entt::locator<base_service>::has_local());
+        ASSERT_NE(&entt::locator<base_service>::local(), &entt::locator<base_service>::value());
+    }};
+
+    thread.join();
+
+    ASSERT_FALSE(entt::locator<base_service>::has_local());
+
+    derived_service::invoked = false;
+    entt::locator<base_service>::allocate_emplace_local<derived_service>(std::allocator<derived_service>{}).invoke();
+
+    ASSERT_TRUE(entt::locator<base_service>::has_local());
+    ASSERT_TRUE(derived_service::invoked);
+    ASSERT_NE(&entt::locator<base_service>::local(), &entt::locator<base_service>::value());
+
+    entt::locator<base_service>::reset_local();
+
+    ASSERT_FALSE(entt::locator<base_service>::has_local());
+    ASSERT_EQ(&entt::locator<base_service>::local(), &entt::locator<base_service>::value());
+}
+
 TEST(ServiceLocatorDeathTest, UninitializedValue) {
     ASSERT_NO_FATAL_FAILURE(entt::locator<base_service>::value_or().invoke());
 
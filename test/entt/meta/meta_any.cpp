@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
@@ -432,6 +433,19 @@ TEST_F(MetaAny, NoSBOInPlaceTypeConstruction) {
     ASSERT_NE(entt::meta_any{fat_t{}}, any);
 }
 
+TEST_F(MetaAny, NoSBOAllocatorConstruction) {
+    fat_t instance{.1, .2, .3, .4};
+    entt::meta_any any{std::allocator_arg, std::allocator<fat_t>{}, std::in_place_type<fat_t>, instance};
+    entt::meta_any copy{any};
+
+    ASSERT_TRUE(any);
+    ASSERT_TRUE(any.owner());
+    ASSERT_EQ(any.type(), entt::resolve<fat_t>());
+    ASSERT_EQ(any.cast<fat_t>(), instance);
+    ASSERT_EQ(copy, any);
+    ASSERT_NE(copy.data(), any.data());
+}
+
 TEST_F(MetaAny, NoSBOAsRefConstruction) {
     fat_t instance{.1, .2, .3, .4};
     auto any = entt::forward_as_meta(instance);
@@ -152,6 +152,30 @@ TEST_F(MetaBase, OpaqueConvWithMutatingThis) {
     ASSERT_EQ(as_cref.cast<int>(), 42);
 }
 
+TEST_F(MetaBase, CachedPath) {
+    using namespace entt::literals;
+
+    entt::meta_reset<derived_t>();
+    entt::meta<derived_t>().base<base_1_t>();
+
+    entt::meta_any any{derived_t{}};
+
+    ASSERT_NE(any.try_cast<base_1_t>(), nullptr);
+    ASSERT_EQ(any.try_cast<base_2_t>(), nullptr);
+    ASSERT_FALSE(std::as_const(any).allow_cast<int>());
+
+    entt::meta<derived_t>().type("derived"_hs).base<base_3_t>();
+
+    ASSERT_NE(any.try_cast<base_1_t>(), nullptr);
+    ASSERT_NE(any.try_cast<base_2_t>(), nullptr);
+    ASSERT_TRUE(std::as_const(any).allow_cast<int>());
+
+    entt::meta_reset<derived_t>();
+
+    ASSERT_EQ(any.try_cast<base_1_t>(), nullptr);
+    ASSERT_FALSE(std::as_const(any).allow_cast<int>());
+}
+
 TEST_F(MetaBase, AssignWithMutatingThis) {
     using namespace entt::literals;
 
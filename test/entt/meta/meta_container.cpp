@@ -199,6 +199,40 @@ TEST_F(MetaContainer, StdArray) {
     ASSERT_EQ(view.size(), 3u);
 }
 
+TEST_F(MetaContainer, ContiguousData) {
+    std::vector<float> vec{1.f, 2.f, 3.f};
+    std::array<int, 2> arr{4, 5};
+    std::vector<bool> bits{true, false};
+    std::set<int> set{6};
+
+    auto view = entt::forward_as_meta(vec).as_sequence_container();
+
+    ASSERT_EQ(view.data(), vec.data());
+    ASSERT_EQ(std::as_const(view).data(), vec.data());
+    ASSERT_EQ(view.value_type().size_of(), sizeof(float));
+
+    view = entt::forward_as_meta(arr).as_sequence_container();
+
+    ASSERT_EQ(view.data(), arr.data());
+    ASSERT_EQ(static_cast<const int *>(std::as_const(view).data())[1u], 5);
+
+    view = entt::forward_as_meta(std::as_const(vec)).as_sequence_container();
+
+    ASSERT_EQ(view.data(), nullptr);
+    ASSERT_EQ(std::as_const(view).data(), vec.data());
+
+    view = entt::forward_as_meta(bits).as_sequence_container();
+
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.data(), nullptr);
+    ASSERT_EQ(std::as_const(view).data(), nullptr);
+
+    view = entt::meta_sequence_container{};
+
+    ASSERT_EQ(std::as_const(view).data(), nullptr);
+    ASSERT_FALSE(entt::forward_as_meta(set).as_sequence_container());
+}
+
 TEST_F(MetaContainer, StdMap) {
     std::map<int, char> map{{2, 'c'}, {3, 'd'}, {4, 'e'}};
     auto any = entt::forward_as_meta(map);
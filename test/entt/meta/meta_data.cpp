@@ -1,6 +1,8 @@
 #include <cstdlib>
+#include <iterator>
 #include <string>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/core/type_traits.hpp>
@@ -654,6 +656,50 @@ TEST_F(MetaData, SetGetFromBase) {
     ASSERT_EQ(instance.value, 42);
 }
 
+TEST_F(MetaData, GetN) {
+    using namespace entt::literals;
+
+    clazz_t clazz[3u]{};
+    derived_t derived[2u]{};
+    std::vector<int> values{};
+
+    clazz[0u].i = 1;
+    clazz[1u].i = 2;
+    clazz[2u].i = 3;
+    derived[1u].value = 42;
+
+    auto data = entt::resolve<clazz_t>().data("i"_hs);
+    auto out = data.get_n<int>(std::begin(clazz), std::end(clazz), std::back_inserter(values));
+
+    ASSERT_EQ(values, (std::vector<int>{1, 2, 3}));
+
+    *out = 4;
+    ASSERT_EQ(values.size(), 4u);
+    ASSERT_EQ(values.back(), 4);
+
+    values.clear();
+    data = entt::resolve<clazz_t>().data("j"_hs);
+    data.get_n<int>(std::begin(clazz), std::end(clazz) - 1, std::back_inserter(values));
+
+    ASSERT_EQ(values, (std::vector<int>{1, 1}));
+
+    values.clear();
+    data = entt::resolve<derived_t>().data("value"_hs);
+    data.get_n<int>(std::begin(derived), std::end(derived), std::back_inserter(values));
+
+    ASSERT_EQ(values, (std::vector<int>{3, 42}));
+
+    values.clear();
+    data = entt::resolve<setter_getter_t>().data("z_ro"_hs);
+    setter_getter_t instance[2u]{};
+    data.get_n<int>(std::begin(instance), std::end(instance), std::back_inserter(values));
+
+    ASSERT_EQ(values.size(), 2u);
+    ASSERT_EQ(values[0u], instance[0u].getter());
+
+    ASSERT_EQ(data.get_n<int>(std::begin(instance), std::begin(instance), values.begin()), values.begin());
+}
+
 TEST_F(MetaData, ReRegistration) {
     using namespace entt::literals;
 
@@ -582,6 +582,73 @@ TEST_F(MetaFunc, ExternalMemberFunction) {
     ASSERT_TRUE(registry.all_of<func_t>(entity));
 }
 
+TEST_F(MetaFunc, InvokeInto) {
+    using namespace entt::literals;
+
+    func_t instance{};
+    int value = 3;
+    int ret = 0;
+    double other = 0.;
+    const auto type = entt::resolve<func_t>();
+
+    ASSERT_TRUE(type.func("f1"_hs).invoke_into(ret, instance, value));
+    ASSERT_EQ(ret, 9);
+
+    ASSERT_TRUE(type.func("f2"_hs).invoke_into(ret, instance, 2, 4));
+    ASSERT_EQ(ret, 16);
+    ASSERT_EQ(func_t::value, 2);
+
+    ASSERT_TRUE(type.func("h"_hs).invoke_into(ret, {}, value));
+    ASSERT_EQ(value, 6);
+    ASSERT_EQ(ret, 6);
+
+    ASSERT_TRUE(type.func("a"_hs).invoke_into(other, instance));
+    ASSERT_EQ(other, 2.);
+
+    ASSERT_TRUE(type.func("v"_hs).invoke_into(ret, instance, 5));
+    ASSERT_EQ(func_t::value, 5);
+    ASSERT_EQ(ret, 6);
+
+    ASSERT_FALSE(type.func("f1"_hs).invoke_into(ret, instance));
+    ASSERT_FALSE(type.func("f1"_hs).invoke_into(ret, instance, base_t{}));
+    ASSERT_FALSE(type.func("f1"_hs).invoke_into(instance, instance, 3));
+}
+
+TEST_F(MetaFunc, InvokeN) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    derived_t instance[3u]{};
+
+    for(auto entt: {registry.create(), registry.create(), registry.create()}) {
+        registry.emplace<base_t>(entt);
+    }
+
+    auto &&storage = registry.storage<base_t>();
+    const auto type = entt::resolve<base_t>();
+
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(storage.begin(), storage.end(), 42), 3u);
+    ASSERT_EQ(storage.rbegin()->value, 42);
+    ASSERT_EQ(type.func("fake_member"_hs).invoke_n(storage.begin(), storage.end() - 1, 2.), 2u);
+    ASSERT_EQ(storage.begin()->value, 2);
+    ASSERT_EQ(storage.rbegin()->value, 42);
+    ASSERT_EQ(type.func("fake_const_member"_hs).invoke_n(std::as_const(storage).begin(), std::as_const(storage).end()), 3u);
+
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(std::as_const(storage).begin(), std::as_const(storage).end(), 0), 0u);
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(storage.begin(), storage.end()), 0u);
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(storage.begin(), storage.end(), instance[0u]), 0u);
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(storage.begin(), storage.begin(), 0), 0u);
+    ASSERT_EQ(storage.begin()->value, 2);
+
+    ASSERT_EQ(entt::resolve<derived_t>().func("setter_from_base"_hs).invoke_n(std::begin(instance), std::end(instance), 7), 3u);
+    ASSERT_EQ(entt::resolve<derived_t>().func("static_setter_from_base"_hs).invoke_n(std::begin(instance), std::end(instance) - 1, 5), 2u);
+    ASSERT_EQ(type.func("setter"_hs).invoke_n(std::begin(instance), std::begin(instance) + 1, 1), 1u);
+
+    ASSERT_EQ(instance[0u].value, 1);
+    ASSERT_EQ(instance[1u].value, 5);
+    ASSERT_EQ(instance[2u].value, 7);
+}
+
 TEST_F(MetaFunc, ReRegistration) {
     using namespace entt::literals;
 
@@ -70,6 +70,25 @@ TEST_F(MetaProp, FromBase) {
     ASSERT_EQ(key_value.value().cast<int>(), 42);
 }
 
+TEST_F(MetaProp, Sealed) {
+    using namespace entt::literals;
+
+    entt::meta_seal();
+
+    auto type = entt::resolve<derived_t>();
+
+    ASSERT_TRUE(type.prop("bool"_hs));
+    ASSERT_TRUE(type.prop("key_only"_hs));
+    ASSERT_EQ(type.prop("int"_hs).value().cast<int>(), 42);
+    ASSERT_EQ(type.prop("key"_hs).value().cast<int>(), 42);
+    ASSERT_EQ(entt::resolve<base_2_t>().prop("char[]"_hs).key(), "char[]"_hs);
+
+    ASSERT_FALSE(type.prop("none"_hs));
+    ASSERT_FALSE(type.prop(entt::id_type{"int"_hs}));
+    ASSERT_FALSE(type.prop(42));
+    ASSERT_FALSE(type.prop({}));
+}
+
 TEST_F(MetaProp, DeducedArrayType) {
     using namespace entt::literals;
 
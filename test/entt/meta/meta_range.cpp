@@ -22,7 +22,7 @@ struct MetaRange: ::testing::Test {
 TEST_F(MetaRange, Range) {
     using namespace entt::literals;
 
-    entt::meta_range<entt::meta_type> range{entt::internal::meta_context::local()};
+    entt::meta_range<entt::meta_type> range{entt::internal::meta_context::local().chain};
     auto it = range.begin();
 
     ASSERT_NE(it, range.end());
@@ -44,7 +44,7 @@ TEST_F(MetaRange, EmptyRange) {
 TEST_F(MetaRange, IteratorConversion) {
     using namespace entt::literals;
 
-    entt::meta_range<entt::meta_type> range{entt::internal::meta_context::local()};
+    entt::meta_range<entt::meta_type> range{entt::internal::meta_context::local().chain};
     typename decltype(range)::iterator it = range.begin();
     typename decltype(range)::const_iterator cit = it;
 
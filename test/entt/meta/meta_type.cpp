@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
@@ -53,6 +54,15 @@ struct concrete_t: base_t, abstract_t {
     int value{3};
 };
 
+struct lazy_t {
+    inline static int registered{};
+    int value{};
+};
+
+struct other_lazy_t {
+    int value{};
+};
+
 struct clazz_t {
     clazz_t() = default;
 
@@ -106,6 +116,11 @@ enum class property_t {
     list
 };
 
+template<std::size_t>
+struct concurrent_t: base_t {
+    int value{};
+};
+
 struct MetaType: ::testing::Test {
     void SetUp() override {
         using namespace entt::literals;
@@ -230,6 +245,14 @@ TEST_F(MetaType, SizeOf) {
     ASSERT_EQ(entt::resolve<int[3]>().size_of(), sizeof(int[3]));
 }
 
+TEST_F(MetaType, Layout) {
+    ASSERT_EQ(entt::resolve<void>().layout(), nullptr);
+    ASSERT_EQ(entt::resolve<int[3]>().layout(), nullptr);
+    ASSERT_EQ(entt::resolve<int>().layout(), &entt::type_layout_of<int>());
+    ASSERT_EQ(entt::resolve<clazz_t>().layout()->size, sizeof(clazz_t));
+    ASSERT_EQ(*entt::resolve<clazz_t>().layout()->info, entt::resolve<clazz_t>().info());
+}
+
 TEST_F(MetaType, Traits) {
     ASSERT_TRUE(entt::resolve<bool>().is_arithmetic());
     ASSERT_TRUE(entt::resolve<double>().is_arithmetic());
@@ -407,6 +430,33 @@ TEST_F(MetaType, OverloadedFunc) {
     ASSERT_FALSE(ambiguous);
 }
 
+TEST_F(MetaType, OverloadedFuncWithArgs) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<overloaded_func_t>();
+    overloaded_func_t instance{};
+
+    const auto binary = type.func<int, int>("f"_hs);
+    const auto unary = type.func<int>("f"_hs);
+    const auto mixed = type.func<int, float>("f"_hs);
+
+    ASSERT_TRUE(binary);
+    ASSERT_TRUE(unary);
+    ASSERT_TRUE(mixed);
+
+    ASSERT_EQ(binary.arity(), 2u);
+    ASSERT_EQ(unary.arity(), 1u);
+    ASSERT_EQ(mixed.arity(), 2u);
+    ASSERT_EQ(mixed.ret(), entt::resolve<float>());
+
+    ASSERT_EQ(unary.invoke(instance, 5).cast<int>(), 25);
+    ASSERT_EQ(type.invoke("f"_hs, instance, 5).cast<int>(), 25);
+
+    ASSERT_FALSE((type.func<int, double>("f"_hs)));
+    ASSERT_FALSE(type.func<>("f"_hs));
+    ASSERT_TRUE(type.func<int>("e"_hs));
+}
+
 TEST_F(MetaType, Construct) {
     auto any = entt::resolve<clazz_t>().construct(base_t{}, 42);
 
@@ -494,6 +544,59 @@ TEST_F(MetaType, ResetAll) {
     ASSERT_EQ(entt::resolve().begin(), entt::resolve().end());
 }
 
+TEST_F(MetaType, Seal) {
+    using namespace entt::literals;
+
+    ASSERT_FALSE(entt::meta_ctx::sealed());
+
+    entt::meta_seal();
+
+    ASSERT_TRUE(entt::meta_ctx::sealed());
+    ASSERT_TRUE(entt::resolve("clazz"_hs));
+    ASSERT_TRUE(entt::resolve<clazz_t>().func("member"_hs));
+    ASSERT_TRUE(entt::resolve<derived_t>().base("base"_hs));
+
+    entt::meta_reset();
+
+    ASSERT_FALSE(entt::meta_ctx::sealed());
+    ASSERT_FALSE(entt::resolve("clazz"_hs));
+}
+
+TEST_F(MetaTypeDeathTest, Seal) {
+    using namespace entt::literals;
+
+    entt::meta_seal();
+
+    ASSERT_DEATH([[maybe_unused]] auto factory = entt::meta<clazz_t>(), "");
+    ASSERT_DEATH(entt::meta_reset("clazz"_hs), "");
+    ASSERT_DEATH(entt::meta_reset<clazz_t>(), "");
+}
+
+TEST_F(MetaType, ConcurrentRegistration) {
+    using namespace entt::literals;
+
+    auto reflect = [](auto... value) {
+        ((entt::meta<concurrent_t<value>>()
+              .type(entt::type_hash<concurrent_t<value>>::value())
+              .template base<base_t>()
+              .template data<&concurrent_t<value>::value>("value"_hs)),
+         ...);
+    };
+
+    std::thread first{[reflect]() { reflect(std::integral_constant<std::size_t, 0u>{}, std::integral_constant<std::size_t, 1u>{}, std::integral_constant<std::size_t, 2u>{}); }};
+    std::thread second{[reflect]() { reflect(std::integral_constant<std::size_t, 3u>{}, std::integral_constant<std::size_t, 4u>{}, std::integral_constant<std::size_t, 5u>{}); }};
+
+    first.join();
+    second.join();
+
+    ASSERT_TRUE(entt::resolve(entt::type_hash<concurrent_t<0u>>::value()));
+    ASSERT_TRUE(entt::resolve(entt::type_hash<concurrent_t<2u>>::value()));
+    ASSERT_TRUE(entt::resolve(entt::type_hash<concurrent_t<3u>>::value()));
+    ASSERT_TRUE(entt::resolve(entt::type_hash<concurrent_t<5u>>::value()));
+    ASSERT_TRUE(entt::resolve<concurrent_t<4u>>().data("value"_hs));
+    ASSERT_TRUE(entt::resolve<concurrent_t<1u>>().base("base"_hs));
+}
+
 TEST_F(MetaType, AbstractClass) {
     using namespace entt::literals;
 
@@ -589,7 +692,7 @@ TEST_F(MetaType, PropertiesAndCornerCases) {
 TEST_F(MetaType, ResetAndReRegistrationAfterReset) {
     using namespace entt::literals;
 
-    ASSERT_NE(*entt::internal::meta_context::global(), nullptr);
+    ASSERT_NE(entt::internal::meta_context::global()->chain, nullptr);
 
     entt::meta_reset<double>();
     entt::meta_reset<unsigned int>();
@@ -605,8 +708,10 @@ TEST_F(MetaType, ResetAndReRegistrationAfterReset) {
     ASSERT_FALSE(entt::resolve("base"_hs));
     ASSERT_FALSE(entt::resolve("derived"_hs));
     ASSERT_FALSE(entt::resolve("clazz"_hs));
+    ASSERT_FALSE(entt::resolve(entt::type_id<double>()));
+    ASSERT_FALSE(entt::resolve(entt::type_id<clazz_t>()));
 
-    ASSERT_EQ(*entt::internal::meta_context::global(), nullptr);
+    ASSERT_EQ(entt::internal::meta_context::global()->chain, nullptr);
 
     ASSERT_FALSE(entt::resolve<clazz_t>().prop(property_t::value));
     // implicitly generated default constructor is not cleared
@@ -655,9 +760,64 @@ TEST_F(MetaType, ReRegistration) {
 
     ASSERT_FALSE(entt::resolve("double"_hs));
     ASSERT_TRUE(entt::resolve("real"_hs));
+    ASSERT_EQ(entt::resolve("real"_hs), entt::resolve(entt::type_id<double>()));
     ASSERT_TRUE(entt::resolve("real"_hs).data("var"_hs));
 }
 
+TEST_F(MetaType, LazyRegistration) {
+    using namespace entt::literals;
+
+    auto func = []() {
+        ++lazy_t::registered;
+        entt::meta<lazy_t>().type("lazy"_hs).data<&lazy_t::value>("value"_hs);
+    };
+
+    lazy_t::registered = {};
+    entt::meta_lazy<lazy_t>("lazy"_hs, func);
+
+    for(auto type: entt::resolve()) {
+        ASSERT_NE(type.id(), "lazy"_hs);
+    }
+
+    ASSERT_EQ(lazy_t::registered, 0);
+    ASSERT_FALSE(entt::resolve("other"_hs));
+    ASSERT_EQ(lazy_t::registered, 0);
+
+    ASSERT_TRUE(entt::resolve("lazy"_hs));
+    ASSERT_TRUE(entt::resolve("lazy"_hs).data("value"_hs));
+    ASSERT_EQ(entt::resolve("lazy"_hs), entt::resolve<lazy_t>());
+    ASSERT_EQ(lazy_t::registered, 1);
+
+    entt::meta_reset<lazy_t>();
+    entt::meta_lazy<lazy_t>("lazy"_hs, func);
+
+    ASSERT_TRUE(entt::resolve<const lazy_t &>().data("value"_hs));
+    ASSERT_EQ(entt::resolve<lazy_t>().id(), "lazy"_hs);
+    ASSERT_EQ(lazy_t::registered, 2);
+
+    entt::meta_reset<lazy_t>();
+    entt::meta_lazy<lazy_t>("lazy"_hs, func);
+
+    ASSERT_TRUE(entt::resolve(entt::type_id<lazy_t>()));
+    ASSERT_EQ(entt::resolve(entt::type_id<lazy_t>()).id(), "lazy"_hs);
+    ASSERT_EQ(lazy_t::registered, 3);
+
+    entt::meta_lazy<other_lazy_t>("other"_hs, []() { entt::meta<other_lazy_t>().type("other"_hs); });
+    entt::meta_reset();
+
+    ASSERT_FALSE(entt::resolve("other"_hs));
+}
+
+TEST_F(MetaType, LazyRegistrationAndSeal) {
+    using namespace entt::literals;
+
+    entt::meta_lazy<other_lazy_t>("other"_hs, []() { entt::meta<other_lazy_t>().type("other"_hs); });
+    entt::meta_seal();
+
+    ASSERT_TRUE(entt::meta_ctx::sealed());
+    ASSERT_TRUE(entt::resolve("other"_hs));
+}
+
 TEST_F(MetaType, NameCollision) {
     using namespace entt::literals;
 
@@ -1,10 +1,12 @@
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
 #include <entt/core/type_traits.hpp>
 #include <entt/poly/poly.hpp>
+#include "../common/tracked_memory_resource.hpp"
 
 template<typename Base>
 struct common_type: Base {
@@ -114,6 +116,23 @@ struct DefinedEmbedded
     using impl = entt::value_list<&Type::get>;
 };
 
+struct Small
+    : entt::type_list<> {
+    template<typename Base>
+    struct type: Base {
+        void set(int v) {
+            entt::poly_call<0>(*this, v);
+        }
+
+        int get() const {
+            return entt::poly_call<1>(*this);
+        }
+    };
+
+    template<typename Type>
+    using impl = entt::value_list<&Type::set, &Type::get>;
+};
+
 struct impl {
     impl() = default;
 
@@ -245,6 +264,33 @@ TYPED_TEST(PolyEmbedded, EmbeddedVtable) {
     ASSERT_EQ(poly->get(), 2);
 }
 
+TEST(PolySmall, InlineVtable) {
+    using vtable_type = typename entt::poly_vtable<Small, sizeof(double[2]), alignof(double[2])>::type;
+    static_assert(std::is_pointer_v<vtable_type> == (ENTT_POLY_INLINE_VTABLE < 2));
+
+    entt::poly<Small> poly{impl{}};
+    auto ref = poly.as_ref();
+    auto copy = poly;
+
+    ASSERT_TRUE(poly);
+    ASSERT_EQ(poly->get(), 0);
+
+    ref->set(3);
+
+    ASSERT_EQ(poly->get(), 3);
+    ASSERT_EQ(ref->get(), 3);
+    ASSERT_EQ(copy->get(), 0);
+
+    copy.reset();
+
+    ASSERT_FALSE(copy);
+
+    copy.emplace<impl>(42);
+
+    ASSERT_TRUE(copy);
+    ASSERT_EQ(copy->get(), 42);
+}
+
 TYPED_TEST(Poly, Owned) {
     using poly_type = typename TestFixture::template type<>;
 
@@ -414,3 +460,34 @@ TYPED_TEST(Poly, NoSboAlignment) {
 
     ASSERT_EQ(data, nosbo[1].data());
 }
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TYPED_TEST(Poly, CustomAllocator) {
+    test::tracked_memory_resource memory_resource{};
+    std::pmr::polymorphic_allocator<impl> allocator{&memory_resource};
+    typename TestFixture::template type<0u> poly{std::allocator_arg, allocator, std::in_place_type<impl>, 3};
+
+    ASSERT_TRUE(poly);
+    ASSERT_EQ(poly->get(), 3);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    auto other = poly;
+    other->set(1);
+
+    ASSERT_EQ(poly->get(), 3);
+    ASSERT_EQ(other->get(), 1);
+    // polymorphic allocators don't propagate on copy construction
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    poly.reset();
+
+    ASSERT_EQ(memory_resource.do_deallocate_counter(), 1u);
+
+    typename TestFixture::template type<sizeof(impl)> sbo{std::allocator_arg, allocator, std::in_place_type<impl>, 3};
+
+    ASSERT_EQ(sbo->get(), 3);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+}
+
+#endif
@@ -0,0 +1,131 @@
+#include <cstddef>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/core/type_traits.hpp>
+#include <entt/poly/poly.hpp>
+#include <entt/poly/poly_vector.hpp>
+
+struct Shape: entt::type_list<> {
+    template<typename Base>
+    struct type: Base {
+        void scale(int value) {
+            entt::poly_call<0>(*this, value);
+        }
+
+        int area() const {
+            return entt::poly_call<1>(*this);
+        }
+    };
+
+    template<typename Type>
+    using impl = entt::value_list<&Type::scale, &Type::area>;
+};
+
+struct square {
+    void scale(int value) {
+        side *= value;
+    }
+
+    int area() const {
+        return side * side;
+    }
+
+    int side{};
+};
+
+struct rectangle {
+    void scale(int value) {
+        width *= value;
+        height *= value;
+    }
+
+    int area() const {
+        return width * height;
+    }
+
+    int width{};
+    int height{};
+};
+
+TEST(PolyVector, Functionalities) {
+    entt::poly_vector<Shape> vec{};
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.size(), 0u);
+    ASSERT_EQ(vec.size<square>(), 0u);
+
+    vec.emplace<square>(2);
+    vec.emplace<rectangle>(2, 3);
+    auto &elem = vec.emplace<square>(3);
+
+    ASSERT_FALSE(vec.empty());
+    ASSERT_EQ(vec.size(), 3u);
+    ASSERT_EQ(vec.size<square>(), 2u);
+    ASSERT_EQ(vec.size<rectangle>(), 1u);
+    ASSERT_EQ(elem.side, 3);
+
+    int total{};
+    std::size_t count{};
+
+    std::as_const(vec).each([&total](auto value) { total += value->area(); });
+
+    ASSERT_EQ(total, 19);
+
+    vec.each([](auto value) { value->scale(2); });
+    vec.each<square>([&count](square &value) { count += (value.side % 2 == 0); });
+
+    ASSERT_EQ(count, 2u);
+
+    total = {};
+    std::as_const(vec).each<rectangle>([&total](const rectangle &value) { total += value.area(); });
+
+    ASSERT_EQ(total, 24);
+
+    vec.clear();
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.size<square>(), 0u);
+}
+
+TEST(PolyVector, GroupedByType) {
+    entt::poly_vector<Shape> vec{};
+    const entt::type_info *last{};
+    std::size_t changes{};
+
+    for(int pos{}; pos < 8; ++pos) {
+        if(pos % 2) {
+            vec.emplace<square>(pos);
+        } else {
+            vec.emplace<rectangle>(pos, 1);
+        }
+    }
+
+    vec.each([&](auto value) {
+        changes += (!last || *last != value.type());
+        last = &value.type();
+
+        // elements are referenced rather than copied
+        ASSERT_EQ(value.data(), value.as_ref().data());
+    });
+
+    ASSERT_EQ(changes, 2u);
+    ASSERT_EQ(vec.size(), 8u);
+}
+
+TEST(PolyVector, Copy) {
+    entt::poly_vector<Shape> vec{};
+    vec.emplace<square>(2);
+
+    auto other = vec;
+    other.each([](auto value) { value->scale(3); });
+
+    int lhs{};
+    int rhs{};
+
+    vec.each([&lhs](auto value) { lhs += value->area(); });
+    other.each([&rhs](auto value) { rhs += value->area(); });
+
+    ASSERT_EQ(lhs, 4);
+    ASSERT_EQ(rhs, 36);
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <entt/process/coroutine.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+struct event {
+    int value;
+};
+
+struct tracker {
+    int steps{};
+    int value{};
+    bool resumed{};
+};
+
+entt::coroutine_process<int> ticks(tracker &data) {
+    ++data.steps;
+    co_await entt::next_tick{};
+    ++data.steps;
+    co_await entt::next_tick{};
+    ++data.steps;
+}
+
+entt::coroutine_process<int> wait(tracker &data) {
+    co_await entt::delay{10};
+    data.resumed = true;
+}
+
+entt::coroutine_process<int> listen(tracker &data, entt::dispatcher &dispatcher) {
+    const auto ev = co_await entt::wait_event<event>{dispatcher};
+    data.value = ev.value;
+}
+
+entt::coroutine_process<int> quest(tracker &data, entt::dispatcher &dispatcher) {
+    data.value = (co_await dispatcher.next<event>()).value;
+    ++data.steps;
+    data.value += (co_await dispatcher.next<event>()).value;
+    ++data.steps;
+}
+
+struct test_emitter: entt::emitter<test_emitter> {};
+
+entt::coroutine_process<int> observe(tracker &data, test_emitter &emitter) {
+    data.value = (co_await emitter.next<event>()).value;
+    co_await entt::next_tick{};
+    data.resumed = true;
+}
+
+TEST(Coroutine, NextTick) {
+    entt::scheduler<int> scheduler;
+    tracker data{};
+
+    scheduler.attach(ticks(data));
+
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(data.steps, 0);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(data.steps, 1);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(data.steps, 2);
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(1);
+
+    ASSERT_EQ(data.steps, 3);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Delay) {
+    entt::scheduler<int> scheduler;
+    tracker data{};
+
+    scheduler.attach(wait(data));
+    scheduler.update(0);
+
+    for(auto pos = 0; pos < 3; ++pos) {
+        scheduler.update(3);
+        ASSERT_FALSE(data.resumed);
+    }
+
+    scheduler.update(3);
+
+    ASSERT_TRUE(data.resumed);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, WaitEvent) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    tracker data{};
+
+    scheduler.attach(listen(data, dispatcher));
+    scheduler.update(1);
+
+    ASSERT_FALSE(dispatcher.sink<event>().empty());
+
+    scheduler.update(1);
+    dispatcher.trigger(event{42});
+    dispatcher.trigger(event{3});
+
+    ASSERT_EQ(data.value, 0);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(data.value, 42);
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_TRUE(dispatcher.sink<event>().empty());
+}
+
+TEST(Coroutine, Chain) {
+    entt::scheduler<int> scheduler;
+    tracker first{};
+    tracker second{};
+
+    scheduler.attach(ticks(first)).then(ticks(second));
+
+    for(auto pos = 0; pos < 3; ++pos) {
+        scheduler.update(1);
+    }
+
+    ASSERT_EQ(first.steps, 3);
+    ASSERT_EQ(second.steps, 0);
+
+    for(auto pos = 0; pos < 3; ++pos) {
+        scheduler.update(1);
+    }
+
+    ASSERT_EQ(second.steps, 3);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Abort) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    tracker data{};
+
+    scheduler.attach(listen(data, dispatcher));
+    scheduler.update(1);
+
+    ASSERT_FALSE(dispatcher.sink<event>().empty());
+
+    scheduler.abort(true);
+    scheduler.update(1);
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_TRUE(dispatcher.sink<event>().empty());
+
+    dispatcher.trigger(event{42});
+
+    ASSERT_EQ(data.value, 0);
+}
+
+TEST(Coroutine, NextEvent) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    tracker data{};
+
+    scheduler.attach(quest(data, dispatcher));
+    scheduler.update(1);
+    scheduler.update(1);
+
+    ASSERT_EQ(data.steps, 0);
+    ASSERT_TRUE(dispatcher.sink<event>().empty());
+
+    dispatcher.trigger(event{42});
+
+    ASSERT_EQ(data.value, 42);
+    ASSERT_EQ(data.steps, 1);
+
+    dispatcher.enqueue(event{3});
+    scheduler.update(1);
+
+    ASSERT_EQ(data.steps, 1);
+
+    dispatcher.update();
+
+    ASSERT_EQ(data.value, 45);
+    ASSERT_EQ(data.steps, 2);
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(1);
+
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, NextEmitterEvent) {
+    entt::scheduler<int> scheduler;
+    test_emitter emitter;
+    tracker data{};
+
+    scheduler.attach(observe(data, emitter));
+    scheduler.update(1);
+    emitter.publish<event>(42);
+
+    ASSERT_EQ(data.value, 42);
+    ASSERT_FALSE(data.resumed);
+
+    scheduler.update(1);
+
+    ASSERT_TRUE(data.resumed);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, AbortNextEvent) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    tracker data{};
+
+    scheduler.attach(quest(data, dispatcher));
+    scheduler.update(1);
+    scheduler.abort(true);
+    scheduler.update(1);
+
+    ASSERT_TRUE(scheduler.empty());
+
+    dispatcher.trigger(event{42});
+
+    ASSERT_EQ(data.value, 0);
+}
+
+#endif
@@ -1,8 +1,14 @@
+#include <cstddef>
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/process/process.hpp>
 #include <entt/process/scheduler.hpp>
+#include "../common/tracked_memory_resource.hpp"
 
 struct foo_process: entt::process<foo_process, int> {
     foo_process(std::function<void()> upd, std::function<void()> abort)
@@ -38,6 +44,42 @@ struct failed_process: entt::process<failed_process, int> {
     static inline unsigned int invoked;
 };
 
+struct concurrent_process: entt::process<concurrent_process, int> {
+    static constexpr auto thread_safe = true;
+
+    concurrent_process(std::atomic<int> &ref)
+        : counter{&ref} {}
+
+    void update(delta_type delta, void *) {
+        counter->fetch_add(delta);
+
+        if((elapsed += delta) >= 3) {
+            succeed();
+        }
+    }
+
+    std::atomic<int> *counter;
+    int elapsed{};
+};
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, const Task &task) {
+        std::vector<std::thread> workers{};
+        tasks += count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back([&task, pos]() { task(pos); });
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t tasks{};
+};
+
 struct Scheduler: ::testing::Test {
     void SetUp() override {
         succeeded_process::invoked = 0u;
@@ -152,3 +194,289 @@ TEST_F(Scheduler, SpawningProcess) {
     ASSERT_EQ(succeeded_process::invoked, 1u);
     ASSERT_EQ(failed_process::invoked, 1u);
 }
+
+TEST_F(Scheduler, RecycleMemory) {
+    entt::scheduler<int> scheduler;
+
+    for(auto pos = 0; pos < 3; ++pos) {
+        scheduler.attach<succeeded_process>().then<failed_process>().then<succeeded_process>();
+        scheduler.attach([](auto, void *, auto resolve, auto) { resolve(); });
+
+        while(!scheduler.empty()) {
+            scheduler.update(0);
+        }
+    }
+
+    ASSERT_EQ(succeeded_process::invoked, 3u);
+    ASSERT_EQ(failed_process::invoked, 3u);
+
+    scheduler.attach<succeeded_process>().then<succeeded_process>();
+    scheduler.shrink_to_fit();
+    scheduler.update(0);
+    scheduler.clear();
+    scheduler.shrink_to_fit();
+
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST_F(Scheduler, PackedByType) {
+    entt::scheduler<int> scheduler;
+    std::vector<int> ticks(2u);
+
+    for(auto pos = 0; pos < 64; ++pos) {
+        scheduler.attach([&ticks](auto, void *, auto, auto) { ++ticks[0u]; });
+        scheduler.attach<succeeded_process>().then([&ticks](auto, void *, auto resolve, auto) { ++ticks[1u]; resolve(); });
+    }
+
+    ASSERT_EQ(scheduler.size(), 128u);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(ticks, (std::vector<int>{64, 0}));
+    ASSERT_EQ(succeeded_process::invoked, 64u);
+    ASSERT_EQ(scheduler.size(), 128u);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(ticks, (std::vector<int>{128, 64}));
+    ASSERT_EQ(scheduler.size(), 64u);
+
+    scheduler.clear();
+    scheduler.shrink_to_fit();
+
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST_F(Scheduler, Move) {
+    entt::scheduler<int> scheduler;
+    scheduler.attach<succeeded_process>().then<succeeded_process>();
+
+    entt::scheduler<int> other{std::move(scheduler)};
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_EQ(other.size(), 1u);
+
+    scheduler = std::move(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(scheduler.size(), 1u);
+
+    while(!scheduler.empty()) {
+        scheduler.update(0);
+    }
+
+    ASSERT_EQ(succeeded_process::invoked, 2u);
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TEST_F(Scheduler, CustomAllocator) {
+    test::tracked_memory_resource memory_resource{};
+    entt::scheduler<int, std::pmr::polymorphic_allocator<std::byte>> scheduler{&memory_resource};
+
+    ASSERT_TRUE(scheduler.get_allocator().resource()->is_equal(memory_resource));
+
+    const auto spawn = [&scheduler]() {
+        scheduler.attach<succeeded_process>().then<succeeded_process>();
+        scheduler.attach<failed_process>().then<succeeded_process>();
+
+        while(!scheduler.empty()) {
+            scheduler.update(0);
+        }
+    };
+
+    spawn();
+
+    ASSERT_NE(memory_resource.do_allocate_counter(), 0u);
+
+    memory_resource.reset();
+    spawn();
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 0u);
+    ASSERT_EQ(memory_resource.do_deallocate_counter(), 0u);
+}
+
+#endif
+
+TEST_F(Scheduler, ParallelUpdate) {
+    entt::scheduler<int> scheduler;
+    thread_executor executor{};
+    std::atomic<int> counter{};
+
+    scheduler.attach<concurrent_process>(counter).then<succeeded_process>();
+    scheduler.attach<concurrent_process>(counter);
+    scheduler.attach<failed_process>();
+    scheduler.attach<succeeded_process>().then<concurrent_process>(counter);
+
+    scheduler.par_update(executor, 1);
+
+    ASSERT_EQ(executor.tasks, 2u);
+    ASSERT_EQ(counter, 2);
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+    ASSERT_EQ(failed_process::invoked, 1u);
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.par_update(executor, 2);
+
+    ASSERT_EQ(executor.tasks, 5u);
+    ASSERT_EQ(counter, 8);
+    ASSERT_EQ(scheduler.size(), 2u);
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+
+    scheduler.par_update(executor, 1);
+
+    ASSERT_EQ(executor.tasks, 6u);
+    ASSERT_EQ(counter, 9);
+    ASSERT_EQ(succeeded_process::invoked, 2u);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+struct position_process: entt::process<position_process, int> {
+    using resources = entt::type_list<int, const char>;
+
+    void update(delta_type delta, void *) {
+        if((elapsed += delta) >= 3) {
+            succeed();
+        }
+    }
+
+    int elapsed{};
+};
+
+TEST_F(Scheduler, Tick) {
+    entt::scheduler<int> scheduler;
+
+    scheduler.attach<position_process>().then<succeeded_process>();
+    scheduler.attach<failed_process>();
+
+    scheduler.tick<int>(2);
+    scheduler.tick<const char, int>(2);
+
+    ASSERT_EQ(scheduler.size(), 2u);
+    ASSERT_EQ(failed_process::invoked, 0u);
+
+    scheduler.tick<int, const char>(2);
+
+    ASSERT_EQ(scheduler.size(), 2u);
+
+    scheduler.update(2);
+
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(failed_process::invoked, 1u);
+    ASSERT_EQ(succeeded_process::invoked, 0u);
+
+    scheduler.tick<int, const char>(2);
+    scheduler.update(2);
+
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(succeeded_process::invoked, 0u);
+
+    scheduler.update(0);
+
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST_F(Scheduler, Defer) {
+    entt::scheduler<int> scheduler;
+    bool invoked = false;
+
+    scheduler.defer<succeeded_process>(3);
+    scheduler.defer(5, [&invoked](auto, void *, auto resolve, auto) {
+        invoked = true;
+        resolve();
+    });
+
+    ASSERT_EQ(scheduler.size(), 2u);
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(2);
+    scheduler.update(1);
+
+    ASSERT_EQ(scheduler.size(), 2u);
+    ASSERT_EQ(succeeded_process::invoked, 0u);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+    ASSERT_FALSE(invoked);
+
+    scheduler.update(1);
+    scheduler.update(0);
+
+    ASSERT_TRUE(invoked);
+    ASSERT_TRUE(scheduler.empty());
+
+    scheduler.defer<succeeded_process>(1).then<failed_process>();
+    scheduler.defer<failed_process>(1);
+    scheduler.abort();
+
+    ASSERT_TRUE(scheduler.empty());
+
+    scheduler.defer<succeeded_process>(1);
+    scheduler.clear();
+    scheduler.update(1);
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+    ASSERT_EQ(failed_process::invoked, 0u);
+}
+
+TEST_F(Scheduler, DeferPartialTicks) {
+    entt::scheduler<float> scheduler;
+    bool invoked = false;
+
+    scheduler.defer(1.5f, [&invoked](auto, void *, auto resolve, auto) {
+        invoked = true;
+        resolve();
+    });
+
+    scheduler.update(.75f);
+    scheduler.update(.75f);
+    scheduler.update(0.f);
+
+    ASSERT_FALSE(invoked);
+
+    scheduler.update(.5f);
+    scheduler.update(0.f);
+
+    ASSERT_TRUE(invoked);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST_F(Scheduler, BudgetedUpdate) {
+    entt::scheduler<int> scheduler;
+    std::vector<int> deltas{};
+    const auto past = std::chrono::steady_clock::now();
+
+    for(auto pos = 0; pos < 3; ++pos) {
+        scheduler.attach([&deltas](auto delta, void *, auto, auto) {
+            deltas.push_back(delta);
+        });
+    }
+
+    // at least a process is ticked, no matter the deadline
+    ASSERT_EQ(scheduler.update(1, nullptr, past), 2u);
+    ASSERT_EQ(deltas, (std::vector<int>{1}));
+
+    ASSERT_EQ(scheduler.update(2, nullptr, past), 1u);
+    ASSERT_EQ(scheduler.update(4, nullptr, past), 0u);
+
+    // processes receive the time elapsed since they were last ticked
+    ASSERT_EQ(deltas, (std::vector<int>{1, 3, 7}));
+
+    ASSERT_EQ(scheduler.update(1, nullptr, std::chrono::steady_clock::now() + std::chrono::hours{1}), 0u);
+    ASSERT_EQ(deltas, (std::vector<int>{1, 3, 7, 7, 5, 1}));
+
+    scheduler.attach<succeeded_process>();
+
+    ASSERT_EQ(scheduler.update(1, nullptr, past), 3u);
+    ASSERT_EQ(succeeded_process::invoked, 1u);
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.update(1);
+
+    ASSERT_EQ(scheduler.update(1, nullptr, past), 2u);
+    ASSERT_EQ(deltas.back(), 1);
+}
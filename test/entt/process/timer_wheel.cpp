@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/process/timer_wheel.hpp>
+
+TEST(TimerWheel, Functionalities) {
+    entt::timer_wheel<int> wheel{};
+    std::vector<int> expired{};
+    const auto collect = [&expired](int value) { expired.push_back(value); };
+
+    ASSERT_NO_FATAL_FAILURE([[maybe_unused]] auto alloc = wheel.get_allocator());
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_EQ(wheel.size(), 0u);
+    ASSERT_EQ(wheel.time(), 0u);
+
+    const auto first = wheel.schedule(3u, 3);
+    const auto second = wheel.schedule(0u, 1);
+    const auto third = wheel.schedule(100u, 100);
+
+    ASSERT_EQ(wheel.size(), 3u);
+    ASSERT_TRUE(wheel.contains(first));
+    ASSERT_EQ(wheel.get(third), 100);
+    ASSERT_EQ(wheel.remaining(second), 1u);
+    ASSERT_EQ(wheel.remaining(third), 100u);
+
+    ASSERT_EQ(wheel.advance(2u, collect), 1u);
+    ASSERT_EQ(wheel.time(), 2u);
+    ASSERT_EQ(expired, (std::vector<int>{1}));
+    ASSERT_FALSE(wheel.contains(second));
+    ASSERT_EQ(wheel.remaining(third), 98u);
+
+    ASSERT_EQ(wheel.cancel(first), 3);
+    ASSERT_FALSE(wheel.contains(first));
+    ASSERT_EQ(wheel.size(), 1u);
+
+    ASSERT_EQ(wheel.advance(97u, collect), 0u);
+    ASSERT_EQ(wheel.advance(1u, collect), 1u);
+    ASSERT_EQ(expired, (std::vector<int>{1, 100}));
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_EQ(wheel.time(), 100u);
+
+    const auto other = wheel.schedule(1u, 42);
+
+    // identifiers of expired timers are never confused with new ones
+    ASSERT_FALSE(wheel.contains(second));
+    ASSERT_TRUE(wheel.contains(other));
+
+    wheel.clear();
+
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_EQ(wheel.time(), 100u);
+    ASSERT_EQ(wheel.advance(1u), 0u);
+}
+
+TEST(TimerWheel, Order) {
+    entt::timer_wheel<std::uint64_t> wheel{};
+    std::vector<std::uint64_t> expired{};
+    const std::uint64_t delays[]{5u, 64u, 63u, 4096u, 1u, 4097u, 262143u, 262144u, 70000u, 4095u, 65u, (std::uint64_t{1u} << 40u) + 3u};
+
+    for(auto delay: delays) {
+        wheel.schedule(delay, delay);
+    }
+
+    wheel.advance(7u, [&expired, &wheel](std::uint64_t value) {
+        ASSERT_EQ(value, wheel.time());
+        expired.push_back(value);
+    });
+
+    ASSERT_EQ(expired, (std::vector<std::uint64_t>{1u, 5u}));
+
+    for(std::uint64_t step = 1u; !wheel.empty(); step *= 3u) {
+        wheel.advance(step, [&expired, &wheel](std::uint64_t value) {
+            ASSERT_EQ(value, wheel.time());
+            expired.push_back(value);
+        });
+    }
+
+    ASSERT_EQ(expired, (std::vector<std::uint64_t>{1u, 5u, 63u, 64u, 65u, 4095u, 4096u, 4097u, 70000u, 262143u, 262144u, (std::uint64_t{1u} << 40u) + 3u}));
+}
+
+TEST(TimerWheel, Reschedule) {
+    entt::timer_wheel<int> wheel{};
+    std::size_t counter{};
+
+    wheel.schedule(10u, 0);
+
+    // periodic timers are rescheduled from within the callback
+    while(counter < 5u) {
+        wheel.advance(10u, [&wheel, &counter](int value) {
+            ASSERT_EQ(wheel.time(), 10u * (value + 1u));
+            wheel.schedule(10u, value + 1);
+            ++counter;
+        });
+    }
+
+    ASSERT_EQ(wheel.size(), 1u);
+    ASSERT_EQ(wheel.time(), 50u);
+}
+
+TEST(TimerWheel, MoveOnlyType) {
+    entt::timer_wheel<std::unique_ptr<int>> wheel{};
+    std::size_t counter{};
+
+    const auto timer = wheel.schedule(2u, std::make_unique<int>(3));
+    wheel.schedule(1u, std::make_unique<int>(1));
+
+    wheel.each([&counter](auto, const std::unique_ptr<int> &value) {
+        counter += static_cast<std::size_t>(*value);
+    });
+
+    ASSERT_EQ(counter, 4u);
+    ASSERT_EQ(*wheel.cancel(timer), 3);
+
+    wheel.advance(1u, [&counter](std::unique_ptr<int> &value) {
+        ASSERT_EQ(*value, 1);
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, 5u);
+    ASSERT_TRUE(wheel.empty());
+}
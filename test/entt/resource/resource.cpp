@@ -1,6 +1,9 @@
+#include <functional>
 #include <memory>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
 #include <entt/core/hashed_string.hpp>
@@ -8,6 +11,7 @@
 #include <entt/resource/cache.hpp>
 #include <entt/resource/handle.hpp>
 #include <entt/resource/loader.hpp>
+#include "../common/tracked_memory_resource.hpp"
 
 struct resource {
     virtual ~resource() = default;
@@ -41,6 +45,21 @@ struct broken_loader: entt::resource_loader<broken_loader<Resource>, Resource> {
     }
 };
 
+struct id_loader: entt::resource_loader<id_loader, resource> {
+    entt::resource_handle<resource> load(const entt::id_type id, const int offset) const {
+        if(id == 0u) {
+            return {};
+        }
+
+        ++*count;
+        auto res = entt::make_resource<resource>();
+        res->value = static_cast<int>(id) + offset;
+        return res;
+    }
+
+    inline static int *count{};
+};
+
 template<typename Type, typename Other>
 entt::resource_handle<Type> dynamic_resource_handle_cast(const entt::resource_handle<Other> &other) {
     if(other->type() == entt::type_id<Type>()) {
@@ -140,6 +159,202 @@ TEST(Resource, Functionalities) {
     ASSERT_TRUE(std::is_move_assignable_v<entt::resource_handle<resource>>);
 }
 
+TEST(Resource, AsyncLoad) {
+    entt::resource_cache<resource> cache;
+    std::vector<std::function<void()>> tasks{};
+    std::vector<std::pair<entt::id_type, int>> loaded{};
+
+    auto executor = [&tasks](auto task) { tasks.emplace_back(std::move(task)); };
+
+    struct listener {
+        void receive(const entt::id_type id, entt::resource_handle<resource> handle) {
+            loaded->emplace_back(id, handle ? handle->value : -1);
+        }
+
+        std::vector<std::pair<entt::id_type, int>> *loaded;
+    } instance{&loaded};
+
+    constexpr auto hs1 = entt::hashed_string{"res1"};
+    constexpr auto hs2 = entt::hashed_string{"res2"};
+    constexpr auto hs3 = entt::hashed_string{"res3"};
+
+    cache.on_load().connect<&listener::receive>(instance);
+
+    ASSERT_TRUE(cache.async_load<loader<resource>>(hs1, executor, 1));
+    ASSERT_FALSE(cache.async_load<loader<resource>>(hs1, executor, 2));
+    ASSERT_TRUE(cache.async_load<broken_loader<resource>>(hs2, executor, 3));
+    ASSERT_TRUE(cache.async_load<loader<resource>>(hs3, executor, 4));
+
+    ASSERT_EQ(tasks.size(), 3u);
+    ASSERT_TRUE(cache.is_pending(hs1));
+    ASSERT_FALSE(cache.contains(hs1));
+
+    std::thread worker{[&tasks]() {
+        for(auto &&task: tasks) {
+            task();
+        }
+    }};
+
+    worker.join();
+
+    ASSERT_EQ(cache.load<loader<resource>>(hs3, 5)->value, 5);
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_TRUE(loaded.empty());
+
+    ASSERT_EQ(cache.update(), 3u);
+    ASSERT_EQ(cache.update(), 0u);
+
+    ASSERT_FALSE(cache.is_pending(hs1));
+    ASSERT_FALSE(cache.is_pending(hs2));
+    ASSERT_TRUE(cache.contains(hs1));
+    ASSERT_FALSE(cache.contains(hs2));
+    ASSERT_EQ(cache.handle(hs1)->value, 1);
+    ASSERT_EQ(cache.handle(hs3)->value, 5);
+
+    ASSERT_EQ(loaded.size(), 3u);
+    ASSERT_EQ(loaded[0u], (std::pair<entt::id_type, int>{hs1, 1}));
+    ASSERT_EQ(loaded[1u], (std::pair<entt::id_type, int>{hs2, -1}));
+    ASSERT_EQ(loaded[2u], (std::pair<entt::id_type, int>{hs3, 5}));
+
+    ASSERT_FALSE(cache.async_load<loader<resource>>(hs1, executor, 6));
+}
+
+TEST(Resource, Budget) {
+    using namespace entt::literals;
+
+    struct costly_loader: entt::resource_loader<costly_loader, resource> {
+        entt::resource_handle<resource> load(int value) const {
+            return loader<resource>{}.load(value);
+        }
+
+        std::size_t cost(const resource &res) const {
+            return static_cast<std::size_t>(res.value);
+        }
+    };
+
+    entt::resource_cache<resource> cache;
+
+    ASSERT_EQ(cache.budget(), 0u);
+    ASSERT_EQ(cache.footprint(), 0u);
+
+    cache.load<loader<resource>>("res"_hs, 42);
+
+    ASSERT_EQ(cache.footprint(), sizeof(resource));
+
+    cache.discard("res"_hs);
+
+    ASSERT_EQ(cache.footprint(), 0u);
+
+    cache.budget(10u);
+    auto pinned = cache.load<costly_loader>("pinned"_hs, 4);
+    cache.load<costly_loader>("first"_hs, 3);
+    cache.load<costly_loader>("second"_hs, 3);
+
+    ASSERT_EQ(cache.size(), 3u);
+    ASSERT_EQ(cache.footprint(), 10u);
+
+    ASSERT_TRUE(cache.handle("second"_hs));
+    cache.load<costly_loader>("third"_hs, 3);
+
+    ASSERT_EQ(cache.footprint(), 10u);
+    ASSERT_TRUE(cache.contains("pinned"_hs));
+    ASSERT_FALSE(cache.contains("first"_hs));
+    ASSERT_TRUE(cache.contains("second"_hs));
+    ASSERT_TRUE(cache.contains("third"_hs));
+
+    cache.budget(4u);
+
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_EQ(cache.footprint(), 4u);
+    ASSERT_TRUE(cache.contains("pinned"_hs));
+
+    cache.budget(2u);
+
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_EQ(cache.footprint(), 4u);
+
+    pinned = {};
+    cache.budget(2u);
+
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(cache.footprint(), 0u);
+
+    cache.budget(0u);
+    cache.load<costly_loader>("first"_hs, 3);
+    cache.clear();
+
+    ASSERT_EQ(cache.footprint(), 0u);
+}
+
+TEST(Resource, Stream) {
+    struct stream_loader: entt::resource_loader<stream_loader, resource> {
+        entt::resource_handle<resource> load() const {
+            auto res = entt::make_resource<resource>();
+            res->value = 0;
+            return res;
+        }
+
+        bool stream(resource &res, const int *data, const std::size_t length) const {
+            for(std::size_t pos{}; pos < length; ++pos) {
+                res.value += data[pos];
+            }
+
+            return res.value >= 10;
+        }
+    };
+
+    entt::resource_cache<resource> cache;
+    const int data[4u]{1, 2, 3, 4};
+    int completed{};
+
+    struct listener {
+        void receive(const entt::id_type, entt::resource_handle<resource> handle) {
+            *completed = handle->value;
+        }
+
+        int *completed;
+    } instance{&completed};
+
+    constexpr auto hs = entt::hashed_string{"res"};
+
+    cache.on_load().connect<&listener::receive>(instance);
+    cache.load<stream_loader>(hs);
+
+    ASSERT_FALSE(cache.stream<stream_loader>(hs, data, 2u));
+    ASSERT_EQ(cache.handle(hs)->value, 3);
+    ASSERT_EQ(completed, 0);
+
+    ASSERT_TRUE(cache.stream<stream_loader>(hs, data + 2u, 2u));
+    ASSERT_EQ(cache.handle(hs)->value, 10);
+    ASSERT_EQ(completed, 10);
+}
+
+TEST(Resource, LoadN) {
+    entt::resource_cache<resource> cache;
+    const entt::id_type ids[5u]{1u, 2u, 1u, 0u, 3u};
+    std::vector<entt::resource_handle<resource>> handles{};
+    int count{};
+
+    id_loader::count = &count;
+    cache.load<loader<resource>>(3u, 42);
+
+    auto out = cache.load_n<id_loader>(std::begin(ids), std::end(ids), std::back_inserter(handles), 10);
+
+    ASSERT_EQ(handles.size(), 5u);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(cache.size(), 3u);
+
+    ASSERT_EQ(handles[0u]->value, 11);
+    ASSERT_EQ(handles[1u]->value, 12);
+    ASSERT_EQ(handles[2u], handles[0u]);
+    ASSERT_FALSE(handles[3u]);
+    ASSERT_EQ(handles[4u]->value, 42);
+
+    *out = {};
+
+    ASSERT_EQ(handles.size(), 6u);
+}
+
 TEST(Resource, ConstNonConstHandle) {
     entt::resource_cache<resource> cache;
 
@@ -198,6 +413,7 @@ TEST(Resource, HandleImplicitCast) {
     ASSERT_TRUE(temp);
     ASSERT_EQ(&*handle, &*other);
     ASSERT_EQ(resource.use_count(), 3u);
+    ASSERT_EQ(other.use_count(), 3u);
 
     temp = std::move(other);
 
@@ -206,6 +422,7 @@ TEST(Resource, HandleImplicitCast) {
     ASSERT_TRUE(temp);
     ASSERT_EQ(&*handle, &*temp);
     ASSERT_EQ(resource.use_count(), 3u);
+    ASSERT_EQ(temp.use_count(), 3u);
 
     temp = handle = {};
 
@@ -215,6 +432,84 @@ TEST(Resource, HandleImplicitCast) {
     ASSERT_EQ(resource.use_count(), 1u);
 }
 
+TEST(Resource, MakeResource) {
+    auto handle = entt::make_resource<derived_resource>();
+    entt::resource_handle<const resource> base = handle;
+    entt::resource_handle<const int> value{base, handle->value};
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(handle, base);
+    ASSERT_EQ(handle.use_count(), 3u);
+    ASSERT_EQ(&*value, &handle->value);
+
+    handle = {};
+
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(base.use_count(), 2u);
+    ASSERT_EQ(base->type(), entt::type_id<derived_resource>());
+
+    base = {};
+
+    ASSERT_EQ(value.use_count(), 1u);
+
+    auto other = entt::allocate_resource<const resource>(std::allocator<resource>{});
+
+    ASSERT_TRUE(other);
+    ASSERT_EQ(other.use_count(), 1u);
+    ASSERT_EQ(other->type(), entt::type_id<resource>());
+}
+
+TEST(Resource, LocalHandle) {
+    auto handle = entt::make_resource<derived_resource, false>();
+    entt::resource_handle<const resource, false> base = handle;
+    entt::resource_handle<const int, false> value{base, handle->value};
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(handle, base);
+    ASSERT_EQ(handle.use_count(), 3u);
+    ASSERT_EQ(&*value, &handle->value);
+
+    handle = {};
+
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(base.use_count(), 2u);
+    ASSERT_EQ(base->type(), entt::type_id<derived_resource>());
+
+    base = {};
+
+    ASSERT_EQ(value.use_count(), 1u);
+
+    auto ptr = std::make_shared<derived_resource>();
+    entt::resource_handle<derived_resource, false> other{ptr};
+    auto copy = other;
+
+    ASSERT_EQ(&*copy, ptr.get());
+    ASSERT_EQ(copy.use_count(), 2u);
+    ASSERT_EQ(ptr.use_count(), 2u);
+
+    other = copy = {};
+
+    ASSERT_EQ(ptr.use_count(), 1u);
+
+    entt::resource_cache<resource> cache;
+    auto shared = cache.temp<loader<resource>>(42);
+    entt::resource_handle<resource, false> local{shared};
+
+    ASSERT_EQ(local, shared);
+    ASSERT_EQ(local->value, 42);
+    ASSERT_EQ(local.use_count(), 1u);
+    ASSERT_EQ(shared.use_count(), 2u);
+
+    auto instance = local;
+
+    ASSERT_EQ(local.use_count(), 2u);
+    ASSERT_EQ(shared.use_count(), 2u);
+
+    local = instance = {};
+
+    ASSERT_EQ(shared.use_count(), 1u);
+}
+
 TEST(Resource, DynamicResourceHandleCast) {
     entt::resource_handle<derived_resource> handle = entt::resource_cache<derived_resource>{}.temp<loader<derived_resource>>(42);
     entt::resource_handle<const resource> base = handle;
@@ -266,3 +561,29 @@ TEST(Resource, Each) {
 
     ASSERT_TRUE(cache.empty());
 }
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TEST(Resource, CustomAllocator) {
+    using namespace entt::literals;
+
+    test::tracked_memory_resource memory_resource{};
+    entt::resource_cache<resource, std::pmr::polymorphic_allocator<resource>> cache{&memory_resource};
+
+    ASSERT_TRUE(cache.get_allocator().resource()->is_equal(memory_resource));
+    ASSERT_TRUE(cache.load<loader<resource>>("resource"_hs, 42));
+    ASSERT_NE(memory_resource.do_allocate_counter(), 0u);
+
+    memory_resource.reset();
+
+    ASSERT_TRUE(cache.async_load<loader<resource>>("other"_hs, [](auto task) { task(); }, 3));
+    ASSERT_NE(memory_resource.do_allocate_counter(), 0u);
+    ASSERT_EQ(cache.update(), 1u);
+    ASSERT_EQ(cache.handle("other"_hs)->value, 3);
+
+    cache = {};
+
+    ASSERT_NE(memory_resource.do_deallocate_counter(), 0u);
+}
+
+#endif
@@ -197,6 +197,7 @@ TEST(Delegate, Comparison) {
 
     ASSERT_EQ(lhs, (entt::delegate<int(int)>{entt::connect_arg<&delegate_functor::operator()>, other}));
     ASSERT_NE(lhs.data(), rhs.data());
+    ASSERT_EQ(lhs.target(), rhs.target());
     ASSERT_TRUE(lhs != rhs);
     ASSERT_FALSE(lhs == rhs);
     ASSERT_NE(lhs, rhs);
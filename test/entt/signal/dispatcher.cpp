@@ -1,8 +1,13 @@
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include "../common/throwing_type.hpp"
 
 struct an_event {};
 struct another_event {};
@@ -12,6 +17,23 @@ struct one_more_event {
     one_more_event(int) {}
 };
 
+struct sequenced_event {
+    int producer;
+    int value;
+};
+
+struct keyed_event {
+    int key;
+    int value;
+};
+
+template<>
+struct entt::event_key<keyed_event> {
+    int operator()(const keyed_event &event) const {
+        return event.key;
+    }
+};
+
 struct receiver {
     static void forward(entt::dispatcher &dispatcher, an_event &event) {
         dispatcher.enqueue(event);
@@ -28,6 +50,54 @@ struct receiver {
     int cnt{0};
 };
 
+template<typename Event>
+struct resume_probe {
+    entt::event_awaiter<Event> *awaiter;
+    int resumed{};
+    Event last{};
+};
+
+// minimal coroutine handle, resuming it means consuming the event
+template<typename Event>
+struct probe_handle {
+    [[nodiscard]] static probe_handle from_address(void *addr) {
+        return probe_handle{static_cast<resume_probe<Event> *>(addr)};
+    }
+
+    [[nodiscard]] void *address() const {
+        return probe;
+    }
+
+    void resume() const {
+        ++probe->resumed;
+        probe->last = probe->awaiter->await_resume();
+    }
+
+    resume_probe<Event> *probe;
+};
+
+void record_sequence(std::vector<int> &data, sequenced_event &event) {
+    // events from the same producer are delivered in order
+    ASSERT_EQ(data[static_cast<std::size_t>(event.producer)], event.value);
+    ++data[static_cast<std::size_t>(event.producer)];
+}
+
+void record_value(std::vector<int> &data, sequenced_event &event) {
+    data.push_back(event.value);
+}
+
+void record_keyed_value(std::vector<int> &data, keyed_event &event) {
+    data.push_back(event.value);
+}
+
+void count_event(int &data, an_event &) {
+    ++data;
+}
+
+void count_throwing(int &data, test::throwing_type &) {
+    ++data;
+}
+
 TEST(Dispatcher, Functionalities) {
     entt::dispatcher dispatcher;
     entt::dispatcher other;
@@ -198,3 +268,444 @@ TEST(Dispatcher, CustomAllocator) {
 
     ASSERT_EQ(other.size<an_event>(), 1u);
 }
+
+TEST(Dispatcher, OverflowPolicy) {
+    entt::dispatcher dispatcher;
+    std::vector<int> data{};
+
+    dispatcher.sink<sequenced_event>().connect<&record_value>(data);
+
+    ASSERT_EQ(dispatcher.capacity<sequenced_event>(), 0u);
+
+    dispatcher.reserve<sequenced_event>(2u);
+
+    ASSERT_EQ(dispatcher.capacity<sequenced_event>(), 2u);
+
+    for(int next{}; next < 3; ++next) {
+        dispatcher.enqueue<sequenced_event>(0, next);
+    }
+
+    ASSERT_EQ(dispatcher.size<sequenced_event>(), 3u);
+    ASSERT_EQ(dispatcher.capacity<sequenced_event>(), 4u);
+
+    dispatcher.clear<sequenced_event>();
+    dispatcher.reserve<sequenced_event>(2u, entt::overflow_policy::discard_oldest);
+
+    for(int next{}; next < 5; ++next) {
+        dispatcher.enqueue<sequenced_event>(0, next);
+    }
+
+    // capacity never shrinks
+    ASSERT_EQ(dispatcher.size<sequenced_event>(), 4u);
+    ASSERT_EQ(dispatcher.capacity<sequenced_event>(), 4u);
+
+    dispatcher.update<sequenced_event>();
+
+    ASSERT_EQ(data, (std::vector<int>{1, 2, 3, 4}));
+
+    dispatcher.reserve<sequenced_event>(0u, entt::overflow_policy::discard_newest);
+
+    for(int next{}; next < 6; ++next) {
+        dispatcher.enqueue<sequenced_event>(0, next);
+    }
+
+    ASSERT_EQ(dispatcher.size<sequenced_event>(), 4u);
+
+    data.clear();
+    dispatcher.update<sequenced_event>();
+
+    ASSERT_EQ(data, (std::vector<int>{0, 1, 2, 3}));
+    ASSERT_EQ(dispatcher.capacity<sequenced_event>(), 4u);
+}
+
+TEST(Dispatcher, Priority) {
+    entt::dispatcher dispatcher;
+    std::vector<int> data{};
+    receiver receiver;
+
+    dispatcher.sink<sequenced_event>().connect<&record_value>(data);
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+
+    ASSERT_EQ(dispatcher.priority<an_event>(), 0);
+
+    dispatcher.prioritize<an_event>(1);
+
+    ASSERT_EQ(dispatcher.priority<an_event>(), 1);
+    ASSERT_EQ(dispatcher.priority<sequenced_event>(), 0);
+
+    for(int next{}; next < 3; ++next) {
+        dispatcher.enqueue<sequenced_event>(0, next);
+        dispatcher.enqueue<an_event>();
+    }
+
+    ASSERT_EQ(dispatcher.update(4u), 4u);
+    ASSERT_EQ(receiver.cnt, 3);
+    ASSERT_EQ(data, (std::vector<int>{0}));
+    ASSERT_EQ(dispatcher.size(), 2u);
+
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(dispatcher.update(2u), 2u);
+    ASSERT_EQ(receiver.cnt, 4);
+    ASSERT_EQ(data, (std::vector<int>{0, 1}));
+
+    // at least one event is delivered, whatever the deadline
+    ASSERT_EQ(dispatcher.update(std::chrono::steady_clock::now() - std::chrono::seconds{1}), 1u);
+    ASSERT_EQ(data, (std::vector<int>{0, 1, 2}));
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<sequenced_event>(0, 3);
+
+    ASSERT_EQ(dispatcher.update(std::chrono::steady_clock::now() + std::chrono::hours{1}), 2u);
+    ASSERT_EQ(receiver.cnt, 5);
+    ASSERT_EQ(data, (std::vector<int>{0, 1, 2, 3}));
+    ASSERT_EQ(dispatcher.size(), 0u);
+}
+
+TEST(Dispatcher, Coalescing) {
+    entt::dispatcher dispatcher;
+    std::vector<int> data{};
+
+    dispatcher.sink<keyed_event>().connect<&record_keyed_value>(data);
+
+    dispatcher.enqueue<keyed_event>(0, 1);
+    dispatcher.enqueue<keyed_event>(1, 2);
+    dispatcher.enqueue(keyed_event{0, 3});
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 2u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(data, (std::vector<int>{3, 2}));
+
+    dispatcher.enqueue<keyed_event>(1, 4);
+    dispatcher.update(1u);
+    dispatcher.enqueue<keyed_event>(1, 5);
+    dispatcher.enqueue<keyed_event>(1, 6);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 1u);
+
+    dispatcher.reserve<keyed_event>(0u, entt::overflow_policy::discard_oldest);
+    dispatcher.enqueue<keyed_event>(0, 7);
+    dispatcher.enqueue<keyed_event>(2, 8);
+    dispatcher.enqueue<keyed_event>(1, 9);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 2u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(data, (std::vector<int>{3, 2, 4, 8, 9}));
+
+    dispatcher.enqueue<keyed_event>(0, 10);
+    dispatcher.clear<keyed_event>();
+    dispatcher.enqueue<keyed_event>(0, 11);
+    dispatcher.update();
+
+    ASSERT_EQ(data, (std::vector<int>{3, 2, 4, 8, 9, 11}));
+}
+
+TEST(Dispatcher, Trace) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher;
+    entt::event_trace trace{4u};
+    std::vector<int> data{};
+    int count{};
+
+    dispatcher.record(&trace);
+    dispatcher.trigger(sequenced_event{0, 1});
+    dispatcher.enqueue<sequenced_event>(0, 2);
+    dispatcher.enqueue(an_event{});
+    dispatcher.enqueue<one_more_event>(42);
+    dispatcher.trigger(std::vector<int>{});
+
+    ASSERT_EQ(trace.size(), 4u);
+    ASSERT_EQ(trace.capacity(), 4u);
+
+    dispatcher.trigger("named"_hs, sequenced_event{0, 3});
+    dispatcher.record(nullptr);
+    dispatcher.trigger(sequenced_event{0, 4});
+
+    ASSERT_EQ(trace.size(), 4u);
+
+    std::vector<entt::dispatch_kind> kinds{};
+    trace.each([&kinds](const entt::dispatch_kind kind, const entt::id_type, const void *, const std::size_t) { kinds.push_back(kind); });
+
+    ASSERT_EQ(kinds, (std::vector<entt::dispatch_kind>{entt::dispatch_kind::enqueue, entt::dispatch_kind::enqueue, entt::dispatch_kind::enqueue, entt::dispatch_kind::trigger}));
+
+    entt::dispatcher other;
+    other.sink<sequenced_event>().connect<&record_value>(data);
+    other.sink<sequenced_event>("named"_hs).connect<&record_value>(data);
+    other.sink<an_event>().connect<&count_event>(count);
+
+    entt::event_replayer<entt::dispatcher> replayer{};
+    replayer.bind<sequenced_event>().bind<sequenced_event>("named"_hs);
+
+    ASSERT_EQ(replayer.replay(trace, other), 2u);
+    ASSERT_EQ(data, (std::vector<int>{3}));
+    ASSERT_EQ(other.size(), 1u);
+
+    other.update();
+
+    ASSERT_EQ(data, (std::vector<int>{3, 2}));
+    ASSERT_EQ(count, 0);
+
+    replayer.bind<an_event>();
+
+    ASSERT_EQ(replayer.replay(trace, other), 3u);
+
+    other.update();
+
+    ASSERT_EQ(data, (std::vector<int>{3, 2, 3, 2}));
+    ASSERT_EQ(count, 1);
+
+    trace.clear();
+
+    ASSERT_TRUE(trace.empty());
+    ASSERT_EQ(replayer.replay(trace, other), 0u);
+}
+
+TEST(ConcurrentDispatcher, Functionalities) {
+    entt::concurrent_dispatcher dispatcher;
+    receiver receiver;
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    dispatcher.trigger<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<one_more_event>(42);
+
+    ASSERT_EQ(dispatcher.size<an_event>(), 1u);
+    ASSERT_EQ(dispatcher.size(), 2u);
+    ASSERT_EQ(receiver.cnt, 1);
+
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(receiver.cnt, 2);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.clear<an_event>();
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(receiver.cnt, 2);
+
+    dispatcher.enqueue<an_event>();
+    entt::concurrent_dispatcher other{std::move(dispatcher)};
+
+    ASSERT_EQ(other.size<an_event>(), 1u);
+
+    other.clear();
+
+    ASSERT_EQ(other.size(), 0u);
+}
+
+TEST(ConcurrentDispatcher, MultipleProducers) {
+    constexpr int producers = 4;
+    constexpr int events = 1000;
+
+    entt::concurrent_dispatcher dispatcher;
+    std::vector<std::thread> threads{};
+    std::vector<int> last(static_cast<std::size_t>(producers));
+    int count{};
+
+    dispatcher.sink<sequenced_event>().connect<&record_sequence>(last);
+    dispatcher.sink<an_event>().connect<&count_event>(count);
+
+    for(int producer{}; producer < producers; ++producer) {
+        threads.emplace_back([&dispatcher, producer]() {
+            for(int value{}; value < events; ++value) {
+                dispatcher.enqueue<sequenced_event>(producer, value);
+                dispatcher.enqueue<an_event>();
+            }
+        });
+    }
+
+    while(count < producers * events) {
+        dispatcher.update();
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(count, producers * events);
+
+    for(int producer{}; producer < producers; ++producer) {
+        ASSERT_EQ(last[static_cast<std::size_t>(producer)], events);
+    }
+}
+
+TEST(StaticDispatcher, Functionalities) {
+    entt::static_dispatcher<an_event, one_more_event, sequenced_event> dispatcher;
+    std::vector<int> data{};
+    receiver receiver;
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(dispatcher.get_allocator(), std::allocator<char>{});
+
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    dispatcher.sink<sequenced_event>().connect<&record_value>(data);
+
+    dispatcher.trigger<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<one_more_event>(42);
+    dispatcher.enqueue(sequenced_event{0, 42});
+
+    ASSERT_EQ(dispatcher.size<an_event>(), 1u);
+    ASSERT_EQ(dispatcher.size(), 3u);
+    ASSERT_EQ(receiver.cnt, 1);
+
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(dispatcher.size(), 2u);
+    ASSERT_EQ(receiver.cnt, 2);
+
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(data, (std::vector<int>{42}));
+
+    dispatcher.reserve<an_event>(1u, entt::overflow_policy::discard_newest);
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(dispatcher.capacity<an_event>(), 1u);
+    ASSERT_EQ(dispatcher.size<an_event>(), 1u);
+
+    dispatcher.clear<an_event>();
+    dispatcher.enqueue<one_more_event>(42);
+    dispatcher.clear();
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(receiver.cnt, 2);
+
+    dispatcher.disconnect(receiver);
+    dispatcher.trigger<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 2);
+}
+
+TEST(StaticDispatcher, Concurrent) {
+    entt::basic_static_dispatcher<entt::type_list<an_event>, std::allocator<char>, true> dispatcher;
+    int count{};
+
+    dispatcher.sink<an_event>().connect<&count_event>(count);
+
+    std::thread producer{[&dispatcher]() {
+        for(int value{}; value < 1000; ++value) {
+            dispatcher.enqueue<an_event>();
+        }
+    }};
+
+    producer.join();
+    dispatcher.update();
+
+    ASSERT_EQ(count, 1000);
+}
+
+TEST(ConcurrentDispatcher, ProducerLists) {
+    entt::concurrent_dispatcher dispatcher;
+    entt::concurrent_dispatcher other;
+    int count{};
+
+    dispatcher.sink<an_event>().connect<&count_event>(count);
+    other.sink<an_event>().connect<&count_event>(count);
+
+    std::thread producer{[&dispatcher, &other]() {
+        for(int value{}; value < 100; ++value) {
+            // alternates between queues of the same type
+            dispatcher.enqueue<an_event>();
+            other.enqueue<an_event>();
+        }
+    }};
+
+    producer.join();
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(dispatcher.size<an_event>(), 101u);
+    ASSERT_EQ(other.size<an_event>(), 100u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(count, 101);
+    ASSERT_EQ(dispatcher.size(), 0u);
+
+    other.clear();
+    other.update();
+
+    ASSERT_EQ(count, 101);
+    ASSERT_EQ(other.size(), 0u);
+}
+
+TEST(ConcurrentDispatcher, ThrowingEvent) {
+    entt::concurrent_dispatcher dispatcher;
+    int count{};
+
+    test::throwing_type::trigger_on_value = 42;
+    dispatcher.sink<test::throwing_type>().connect<&count_throwing>(count);
+
+    dispatcher.enqueue<test::throwing_type>(1);
+    dispatcher.enqueue<test::throwing_type>(2);
+    dispatcher.enqueue<test::throwing_type>(3);
+
+    ASSERT_EQ(dispatcher.size<test::throwing_type>(), 3u);
+
+    test::throwing_type::trigger_on_value = 2;
+
+    ASSERT_THROW(dispatcher.update<test::throwing_type>(), test::throwing_type::exception_type);
+    // the failing event is lost, the one not yet collected is still pending
+    ASSERT_EQ(dispatcher.size<test::throwing_type>(), 2u);
+    ASSERT_EQ(count, 0);
+
+    test::throwing_type::trigger_on_value = 42;
+    dispatcher.update<test::throwing_type>();
+
+    ASSERT_EQ(dispatcher.size<test::throwing_type>(), 0u);
+    ASSERT_EQ(count, 2);
+}
+
+TEST(Dispatcher, Next) {
+    entt::dispatcher dispatcher;
+    auto awaiter = dispatcher.next<sequenced_event>();
+    resume_probe<sequenced_event> probe{&awaiter};
+
+    ASSERT_FALSE(awaiter.await_ready());
+
+    awaiter.await_suspend(probe_handle<sequenced_event>{&probe});
+    dispatcher.trigger(sequenced_event{0, 42});
+
+    ASSERT_TRUE(dispatcher.sink<sequenced_event>().empty());
+    ASSERT_EQ(probe.resumed, 1);
+    ASSERT_EQ(probe.last.value, 42);
+
+    dispatcher.trigger(sequenced_event{0, 3});
+
+    ASSERT_EQ(probe.resumed, 1);
+
+    awaiter.await_suspend(probe_handle<sequenced_event>{&probe});
+    dispatcher.enqueue(sequenced_event{0, 1});
+
+    ASSERT_EQ(probe.resumed, 1);
+
+    dispatcher.update();
+
+    ASSERT_EQ(probe.resumed, 2);
+    ASSERT_EQ(probe.last.value, 1);
+
+    {
+        auto other = dispatcher.next<sequenced_event>();
+        resume_probe<sequenced_event> other_probe{&other};
+        other.await_suspend(probe_handle<sequenced_event>{&other_probe});
+    }
+
+    dispatcher.trigger(sequenced_event{0, 3});
+
+    ASSERT_EQ(probe.resumed, 2);
+}
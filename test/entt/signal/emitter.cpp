@@ -3,6 +3,32 @@
 
 struct test_emitter: entt::emitter<test_emitter> {};
 
+template<typename Event>
+struct resume_probe {
+    entt::event_awaiter<Event> *awaiter;
+    int resumed{};
+    Event last{};
+};
+
+// minimal coroutine handle, resuming it means consuming the event
+template<typename Event>
+struct probe_handle {
+    [[nodiscard]] static probe_handle from_address(void *addr) {
+        return probe_handle{static_cast<resume_probe<Event> *>(addr)};
+    }
+
+    [[nodiscard]] void *address() const {
+        return probe;
+    }
+
+    void resume() const {
+        ++probe->resumed;
+        probe->last = probe->awaiter->await_resume();
+    }
+
+    resume_probe<Event> *probe;
+};
+
 struct foo_event {
     int i;
     char c;
@@ -131,3 +157,175 @@ TEST(Emitter, OnAndErase) {
     ASSERT_TRUE(emitter.empty());
     ASSERT_TRUE(emitter.empty<bar_event>());
 }
+
+TEST(Emitter, StaleConnection) {
+    test_emitter emitter;
+    int count{};
+
+    auto conn = emitter.on<bar_event>([&count](const auto &, const auto &) { ++count; });
+    emitter.erase(conn);
+
+    // the slot is reused, the old connection doesn't refer to the new listener
+    auto other = emitter.on<bar_event>([&count](const auto &, const auto &) { ++count; });
+    emitter.erase(conn);
+    emitter.erase(test_emitter::connection<bar_event>{});
+
+    ASSERT_FALSE(emitter.empty<bar_event>());
+
+    emitter.publish<bar_event>();
+
+    ASSERT_EQ(count, 1);
+
+    emitter.erase(other);
+
+    ASSERT_TRUE(emitter.empty<bar_event>());
+}
+
+TEST(Emitter, ErasePublishing) {
+    test_emitter emitter;
+    test_emitter::connection<foo_event> conn{};
+    int count{};
+
+    emitter.on<foo_event>([&conn](auto &, auto &em) { em.erase(conn); });
+
+    for(int next{}; next < 8; ++next) {
+        conn = emitter.on<foo_event>([&count](auto &, auto &em) {
+            ++count;
+            em.template once<foo_event>([&count](auto &, auto &) { ++count; });
+        });
+    }
+
+    // the last listener is erased before it's invoked
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(count, 7);
+
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(count, 21);
+}
+
+TEST(Emitter, CustomAllocator) {
+    std::allocator<char> allocator;
+    test_emitter emitter{};
+
+    ASSERT_EQ(emitter.get_allocator(), allocator);
+    ASSERT_FALSE(emitter.get_allocator() != allocator);
+}
+
+struct test_static_emitter: entt::static_emitter<test_static_emitter, entt::type_list<foo_event, bar_event>> {};
+
+TEST(StaticEmitter, Functionalities) {
+    test_static_emitter emitter;
+    int count{};
+
+    ASSERT_TRUE(emitter.empty());
+    ASSERT_EQ(emitter.get_allocator(), std::allocator<char>{});
+
+    auto conn = emitter.on<foo_event>([&count](auto &event, auto &) { count += event.i; });
+    emitter.once<bar_event>([&count](auto &, auto &) { ++count; });
+
+    ASSERT_FALSE(emitter.empty());
+    ASSERT_FALSE(emitter.empty<foo_event>());
+    ASSERT_FALSE(emitter.empty<bar_event>());
+
+    emitter.publish<foo_event>(2, 'c');
+    emitter.publish<bar_event>();
+    emitter.publish<bar_event>();
+
+    ASSERT_EQ(count, 3);
+    ASSERT_TRUE(emitter.empty<bar_event>());
+
+    emitter.erase(conn);
+
+    ASSERT_TRUE(emitter.empty());
+
+    emitter.on<foo_event>([](auto &, auto &) {});
+    test_static_emitter other{std::move(emitter)};
+
+    ASSERT_FALSE(other.empty());
+
+    other.clear();
+
+    ASSERT_TRUE(other.empty());
+}
+
+TEST(Emitter, EnqueueAndUpdate) {
+    test_emitter emitter;
+    int count{};
+
+    emitter.on<foo_event>([&count](auto &event, auto &em) {
+        count += event.i;
+        // delivered on the next update
+        em.template enqueue<bar_event>();
+        em.template enqueue<quux_event>();
+    });
+
+    emitter.on<bar_event>([&count](auto &, auto &) { ++count; });
+
+    emitter.enqueue<foo_event>(2, 'c');
+    emitter.enqueue<foo_event>(3, 'c');
+
+    ASSERT_EQ(emitter.size<foo_event>(), 2u);
+    ASSERT_EQ(emitter.size<bar_event>(), 0u);
+    ASSERT_EQ(count, 0);
+
+    emitter.update<foo_event>();
+
+    ASSERT_EQ(emitter.size<foo_event>(), 0u);
+    ASSERT_EQ(emitter.size<bar_event>(), 2u);
+    ASSERT_EQ(emitter.size<quux_event>(), 2u);
+    ASSERT_EQ(count, 5);
+
+    emitter.enqueue<foo_event>(4, 'c');
+    emitter.update<foo_event>();
+
+    ASSERT_EQ(count, 9);
+    ASSERT_EQ(emitter.size<bar_event>(), 3u);
+
+    emitter.update();
+
+    ASSERT_EQ(count, 12);
+    ASSERT_EQ(emitter.size<foo_event>(), 0u);
+    ASSERT_EQ(emitter.size<bar_event>(), 0u);
+    ASSERT_EQ(emitter.size<quux_event>(), 0u);
+}
+
+TEST(StaticEmitter, EnqueueAndUpdate) {
+    test_static_emitter emitter;
+    int count{};
+
+    emitter.on<foo_event>([&count](auto &event, auto &) { count += event.i; });
+    emitter.enqueue<foo_event>(2, 'c');
+    emitter.enqueue<bar_event>();
+
+    ASSERT_EQ(emitter.size<foo_event>(), 1u);
+    ASSERT_EQ(emitter.size<bar_event>(), 1u);
+
+    emitter.update<bar_event>();
+
+    ASSERT_EQ(emitter.size<bar_event>(), 0u);
+    ASSERT_EQ(count, 0);
+
+    emitter.update();
+
+    ASSERT_EQ(emitter.size<foo_event>(), 0u);
+    ASSERT_EQ(count, 2);
+}
+
+TEST(Emitter, Next) {
+    test_emitter emitter;
+    auto awaiter = emitter.next<foo_event>();
+    resume_probe<foo_event> probe{&awaiter};
+
+    awaiter.await_suspend(probe_handle<foo_event>{&probe});
+    emitter.publish<foo_event>(42, 'c');
+
+    ASSERT_TRUE(emitter.empty());
+    ASSERT_EQ(probe.resumed, 1);
+    ASSERT_EQ(probe.last.i, 42);
+
+    emitter.publish<foo_event>(3, 'c');
+
+    ASSERT_EQ(probe.resumed, 1);
+}
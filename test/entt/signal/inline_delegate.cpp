@@ -0,0 +1,140 @@
+#include <array>
+#include <memory>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/signal/inline_delegate.hpp>
+#include <entt/signal/sigh.hpp>
+
+struct tracked_callable {
+    tracked_callable(int &ref)
+        : instances{&ref} {
+        ++*instances;
+    }
+
+    tracked_callable(const tracked_callable &other)
+        : instances{other.instances} {
+        ++*instances;
+    }
+
+    tracked_callable(tracked_callable &&other) noexcept
+        : instances{other.instances} {
+        ++*instances;
+    }
+
+    ~tracked_callable() {
+        --*instances;
+    }
+
+    int operator()(int value) const {
+        return value * 2;
+    }
+
+    int *instances;
+};
+
+TEST(InlineDelegate, Functionalities) {
+    int counter{};
+    entt::inline_delegate<void(int)> func{};
+
+    ASSERT_FALSE(func);
+
+    func = [&counter](int value) { counter += value; };
+
+    ASSERT_TRUE(func);
+
+    func(3);
+    func(4);
+
+    ASSERT_EQ(counter, 7);
+
+    func.reset();
+
+    ASSERT_FALSE(func);
+}
+
+TEST(InlineDelegate, Inline) {
+    using delegate_type = entt::inline_delegate<int(int)>;
+    int value{};
+    const auto small = [&value](int other) { return value + other; };
+    const auto large = [data = std::array<int, 32u>{}](int other) { return data[0u] + other; };
+
+    ASSERT_TRUE(delegate_type::is_inline_v<decltype(small)>);
+    ASSERT_FALSE(delegate_type::is_inline_v<decltype(large)>);
+    ASSERT_TRUE((entt::inline_delegate<int(int), sizeof(large)>::is_inline_v<decltype(large)>));
+
+    delegate_type func{small};
+    delegate_type other{large};
+    value = 2;
+
+    ASSERT_EQ(func(1), 3);
+    ASSERT_EQ(other(1), 1);
+
+    std::swap(func, other);
+
+    ASSERT_EQ(func(1), 1);
+    ASSERT_EQ(other(1), 3);
+}
+
+TEST(InlineDelegate, CopyAndMove) {
+    int instances{};
+
+    {
+        entt::inline_delegate<int(int)> func{tracked_callable{instances}};
+
+        ASSERT_EQ(instances, 1);
+
+        entt::inline_delegate<int(int)> copy{func};
+
+        ASSERT_EQ(instances, 2);
+        ASSERT_EQ(copy(2), 4);
+
+        entt::inline_delegate<int(int)> moved{std::move(func)};
+
+        ASSERT_EQ(instances, 2);
+        ASSERT_FALSE(func);
+        ASSERT_EQ(moved(3), 6);
+
+        copy = moved;
+
+        ASSERT_EQ(instances, 2);
+
+        moved = std::move(copy);
+
+        ASSERT_EQ(instances, 1);
+        ASSERT_FALSE(copy);
+        ASSERT_EQ(moved(4), 8);
+    }
+
+    ASSERT_EQ(instances, 0);
+}
+
+TEST(InlineDelegate, MoveOnly) {
+    entt::inline_delegate<int()> func{[ptr = std::make_unique<int>(42)]() { return *ptr; }};
+    entt::inline_delegate<int()> other{std::move(func)};
+
+    ASSERT_FALSE(func);
+    ASSERT_EQ(other(), 42);
+
+    // non-copyable callables result in empty delegates when copied
+    func = other;
+
+    ASSERT_FALSE(func);
+    ASSERT_TRUE(other);
+}
+
+TEST(InlineDelegate, Signal) {
+    int counter{};
+    entt::sigh<void(int)> signal{};
+    entt::sink sink{signal};
+    entt::inline_delegate<void(int)> listener{[&counter](int value) { counter += value; }};
+
+    sink.connect<&decltype(listener)::operator()>(listener);
+    signal.publish(3);
+
+    ASSERT_EQ(counter, 3);
+
+    sink.disconnect(listener);
+    signal.publish(3);
+
+    ASSERT_EQ(counter, 3);
+}
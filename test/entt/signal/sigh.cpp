@@ -1,7 +1,14 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/signal/sigh.hpp>
+#include "../common/tracked_memory_resource.hpp"
 
 struct sigh_listener {
     static void f(int &v) {
@@ -45,6 +52,30 @@ struct before_after {
     static inline int value{};
 };
 
+struct concurrent_listener {
+    void incr(int v) {
+        value += v;
+    }
+
+    static void release(entt::connection &conn, int) {
+        conn.release();
+    }
+
+    std::atomic<int> value{};
+};
+
+struct cost_listener {
+    int cost(int v) const {
+        return v * factor;
+    }
+
+    static int fixed(int) {
+        return 1;
+    }
+
+    int factor{};
+};
+
 struct SigH: ::testing::Test {
     void SetUp() override {
         before_after::value = 0;
@@ -271,6 +302,41 @@ TEST_F(SigH, CollectorVoid) {
     ASSERT_EQ(cnt, 1);
 }
 
+TEST_F(SigH, Reduce) {
+    entt::sigh<int(int)> sigh;
+    entt::sink sink{sigh};
+    cost_listener first{2};
+    cost_listener second{3};
+
+    ASSERT_EQ(sigh.reduce(0, std::plus<>{}, 1), 0);
+
+    sink.connect<&cost_listener::cost>(first);
+    sink.connect<&cost_listener::fixed>();
+    sink.connect<&cost_listener::cost>(second);
+
+    ASSERT_EQ(sigh.reduce(0, std::plus<>{}, 2), 11);
+    ASSERT_EQ(sigh.reduce(0, [](int lhs, int rhs) { return std::max(lhs, rhs); }, 2), 6);
+    ASSERT_EQ(sigh.reduce(100, [](int lhs, int rhs) { return std::min(lhs, rhs); }, 2), 1);
+}
+
+TEST_F(SigH, Gather) {
+    entt::sigh<int(int)> sigh;
+    entt::sink sink{sigh};
+    cost_listener first{2};
+    cost_listener second{3};
+    std::array<int, 3u> out{};
+
+    ASSERT_EQ(sigh.gather(out.begin(), 1), out.begin());
+
+    sink.connect<&cost_listener::cost>(first);
+    sink.connect<&cost_listener::cost>(second);
+
+    ASSERT_EQ(sigh.gather(out.begin(), 2), out.begin() + 2u);
+    ASSERT_EQ(out[0u], 4);
+    ASSERT_EQ(out[1u], 6);
+    ASSERT_EQ(out[2u], 0);
+}
+
 TEST_F(SigH, Connection) {
     entt::sigh<void(int &)> sigh;
     entt::sink sink{sigh};
@@ -503,6 +569,27 @@ TEST_F(SigH, BeforeListenerNotPresent) {
     ASSERT_EQ(functor.value, 2);
 }
 
+TEST_F(SigH, GroupedListeners) {
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    before_after first;
+    before_after second;
+    before_after third;
+
+    sink.connect<&before_after::add>(first);
+    sink.connect<&before_after::mul>(second);
+    // listeners bound to the same function are invoked in a row
+    sink.connect<&before_after::add>(third);
+    sigh.publish(2);
+
+    ASSERT_EQ(before_after::value, 8);
+
+    sink.before<&before_after::mul>(second).connect<&before_after::static_add>();
+    sigh.publish(2);
+
+    ASSERT_EQ(before_after::value, 28);
+}
+
 TEST_F(SigH, UnboundDataMember) {
     sigh_listener listener;
     entt::sigh<bool &(sigh_listener &)> sigh;
@@ -575,3 +662,180 @@ TEST_F(SigH, CustomAllocator) {
     ASSERT_TRUE(copy.empty());
     ASSERT_TRUE(move.empty());
 }
+
+TEST_F(SigH, InlineCapacity) {
+    entt::sigh<void(int), std::allocator<void (*)(int)>, 2u> sigh;
+    entt::sink sink{sigh};
+    before_after functor;
+
+    sink.connect<&before_after::add>(functor);
+    sink.connect<&before_after::static_add>();
+    sink.before<&before_after::static_add>().connect<&before_after::mul>(functor);
+
+    ASSERT_EQ(sigh.size(), 3u);
+
+    sigh.publish(2);
+
+    ASSERT_EQ(functor.value, 6);
+
+    decltype(sigh) copy{sigh};
+    sink.disconnect(functor);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(copy.size(), 3u);
+
+    decltype(sigh) move{std::move(copy)};
+
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(move.size(), 3u);
+
+    copy = std::move(sigh);
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(copy.size(), 1u);
+
+    copy.swap(move);
+
+    ASSERT_EQ(copy.size(), 3u);
+    ASSERT_EQ(move.size(), 1u);
+
+    functor.value = 0;
+    copy.publish(2);
+
+    ASSERT_EQ(functor.value, 6);
+
+    entt::sink{copy}.disconnect<&before_after::static_add>();
+    entt::sink{copy}.disconnect<&before_after::mul>(functor);
+    copy.publish(2);
+
+    ASSERT_EQ(copy.size(), 1u);
+    ASSERT_EQ(functor.value, 8);
+}
+
+TEST(ConcurrentSigH, Functionalities) {
+    entt::concurrent_sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    concurrent_listener listener;
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_TRUE(sink.empty());
+
+    sigh.publish(1);
+    auto conn = sink.connect<&concurrent_listener::incr>(listener);
+    sink.connect<&concurrent_listener::incr>(listener);
+
+    ASSERT_FALSE(sigh.empty());
+    ASSERT_EQ(sigh.size(), 1u);
+
+    sigh.publish(2);
+
+    ASSERT_EQ(listener.value.load(), 2);
+
+    int count{};
+    sigh.collect([&count]() { ++count; }, 1);
+
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(listener.value.load(), 3);
+
+    conn.release();
+
+    ASSERT_TRUE(sigh.empty());
+
+    sink.connect<&concurrent_listener::incr>(listener);
+    sink.disconnect(listener);
+
+    ASSERT_TRUE(sink.empty());
+
+    entt::connection self{};
+    self = sink.connect<&concurrent_listener::release>(self);
+    sigh.publish(1);
+
+    ASSERT_TRUE(sink.empty());
+}
+
+TEST(ConcurrentSigH, ConnectWhilePublishing) {
+    entt::concurrent_sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    concurrent_listener first;
+    concurrent_listener second;
+    std::atomic<bool> done{};
+    std::vector<std::thread> threads{};
+
+    sink.connect<&concurrent_listener::incr>(first);
+
+    for(auto i = 0; i < 2; ++i) {
+        threads.emplace_back([&sigh, &done]() {
+            while(!done) {
+                sigh.publish(1);
+            }
+        });
+    }
+
+    while(first.value.load() == 0) {
+        std::this_thread::yield();
+    }
+
+    for(auto i = 0; i < 1000; ++i) {
+        sink.connect<&concurrent_listener::incr>(second);
+        sink.disconnect<&concurrent_listener::incr>(second);
+    }
+
+    done = true;
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(sigh.size(), 1u);
+
+    const int value = first.value;
+    second.value = 0;
+    sigh.publish(1);
+
+    ASSERT_EQ(first.value.load(), value + 1);
+    ASSERT_EQ(second.value.load(), 0);
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TEST_F(SigH, InlineCapacityAllocator) {
+    test::tracked_memory_resource memory_resource{};
+    entt::sigh<void(int), std::pmr::polymorphic_allocator<void (*)(int)>, 2u> sigh{&memory_resource};
+    entt::sink sink{sigh};
+    sigh_listener listener;
+    before_after functor;
+
+    sink.connect<&sigh_listener::g>(listener);
+    sink.connect<&before_after::add>(functor);
+    sigh.publish(42);
+
+    ASSERT_EQ(sigh.size(), 2u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 0u);
+
+    sink.connect<&before_after::static_add>();
+
+    ASSERT_EQ(sigh.size(), 3u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 1u);
+
+    decltype(sigh) copy{sigh, &memory_resource};
+
+    ASSERT_EQ(copy.size(), 3u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 2u);
+
+    decltype(sigh) move{std::move(copy), &memory_resource};
+
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(move.size(), 3u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 2u);
+
+    sink.disconnect();
+    memory_resource.reset();
+    sink.connect<&sigh_listener::g>(listener);
+    sink.connect<&before_after::add>(functor);
+    sink.connect<&before_after::static_add>();
+
+    ASSERT_EQ(sigh.size(), 3u);
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 0u);
+}
+
+#endif